@@ -28,6 +28,7 @@
 #define __ALLOCATIONOPERATORS__
 
 #include <new>
+#include <cstring>
 #include "ZCommon/Alignment.h"
 
 
@@ -126,6 +127,56 @@ inline void* aligned_alloc_z (const z::puint_z uSize, const z::Alignment& alignm
     #endif
 #endif
 
+/// <summary>
+/// Aligned reallocation wrapper function, for using the reallocation function provided for operative system and compiler.
+/// </summary>
+/// <remarks>
+/// The content of the memory block is kept, up to the lesser of both sizes. Depending on the operative system, the block may grow in place or, 
+/// when it is big, its memory pages may be remapped (mremap) instead of being copied.<br/>
+/// <br/><B>MSVC, MinGW:</B> The alignment is always kept by the reallocation functions of the CRT.<br/>
+/// <br/><B>GCC (Linux, Mac):</B> realloc only guarantees the default alignment of malloc, so it is used only when the alignment value is not 
+/// greater than 2 * sizeof(void*); otherwise a new block is allocated and the content is copied.<br/>
+/// The memory block has to be allocated using the corresponding allocation wrapper function, or undefined bahaviour (such as heap corruption assertion) may occur.
+/// </remarks>
+/// <param name="pMemoryBlock">[IN] Pointer to the aligned memory block to be reallocated. If reallocation succeeds, it must not be used anymore.</param>
+/// <param name="uOldSize">[IN] Size (in bytes) of the memory block to be reallocated.</param>
+/// <param name="uNewSize">[IN] Size (in bytes) of the reallocated memory block.</param>
+/// <param name="alignment">[IN] The data alignment value (must be always a power of two). It must be the same used to allocate the block.</param>
+/// <returns>
+/// The reallocated memory block. If it is null, the reallocation failed and the input memory block is still valid.
+/// </returns>
+inline void* aligned_realloc_z (void* pMemoryBlock, const z::puint_z uOldSize, const z::puint_z uNewSize, const z::Alignment& alignment)
+{
+    void* pNewMemoryBlock = null_z;
+
+#ifdef Z_OS_WINDOWS
+    #ifdef Z_COMPILER_MSVC
+        pNewMemoryBlock = _aligned_realloc(pMemoryBlock, uNewSize, alignment);
+    #elif  Z_COMPILER_GCC
+        pNewMemoryBlock = __mingw_aligned_realloc(pMemoryBlock, uNewSize, alignment);
+    #endif
+#elif  defined (Z_OS_LINUX) || defined (Z_OS_MAC)
+    #ifdef Z_COMPILER_GCC
+        if(alignment <= 2U * sizeof(void*))
+        {
+            pNewMemoryBlock = realloc(pMemoryBlock, uNewSize);
+        }
+        else
+        {
+            pNewMemoryBlock = aligned_alloc_z(uNewSize, alignment);
+
+            if(pNewMemoryBlock != null_z)
+            {
+                memcpy(pNewMemoryBlock, pMemoryBlock, uOldSize < uNewSize ? uOldSize : uNewSize);
+                aligned_free_z(pMemoryBlock);
+            }
+        }
+    #endif
+#endif
+
+    return pNewMemoryBlock;
+}
+
 /// <summary>
 /// Allocates a memory block. Overrides the global new operator provided by the CRT libraries.
 /// </summary>
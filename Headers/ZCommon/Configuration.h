@@ -86,6 +86,31 @@ namespace z
 
 #define Z_CONFIG_ASSERTSTRACING_DEFAULT Z_CONFIG_ASSERTSTRACING_ENABLED // [Configurable]
 
+// --------------------------------------------------------------------------------------------------------
+// Lock statistics: Specifies whether Mutex and SharedMutex record how many times they are acquired, how many
+// of those acquisitions had to wait, and how long threads wait for them and hold them (see SLockStatistics).
+// Recording them adds the cost of reading the clock to every lock and unlock; when disabled, locks are
+// not affected at all.
+//
+// How to use it: Write a behavior value as the default definition.
+// --------------------------------------------------------------------------------------------------------
+#define Z_CONFIG_LOCKSTATISTICS_DISABLED 0x0
+#define Z_CONFIG_LOCKSTATISTICS_ENABLED  0x1
+
+#define Z_CONFIG_LOCKSTATISTICS_DEFAULT Z_CONFIG_LOCKSTATISTICS_DISABLED // [Configurable]
+
+// --------------------------------------------------------------------------------------------------------
+// String hash cache: Specifies whether strings keep the hash code calculated by GetHashCode until they are
+// modified, so hash tables and comparators that use string keys do not traverse them again. Enabling it
+// adds 8 bytes to every string.
+//
+// How to use it: Write a behavior value as the default definition.
+// --------------------------------------------------------------------------------------------------------
+#define Z_CONFIG_STRINGHASHCACHE_DISABLED 0x0
+#define Z_CONFIG_STRINGHASHCACHE_ENABLED  0x1
+
+#define Z_CONFIG_STRINGHASHCACHE_DEFAULT Z_CONFIG_STRINGHASHCACHE_ENABLED // [Configurable]
+
 
 } // namespace z
 
@@ -45,6 +45,10 @@
 #include "ZCommon/DataTypes/EComparisonType.h"
 #include "ZCommon/Assertions.h"
 
+#if Z_CONFIG_STRINGHASHCACHE_DEFAULT == Z_CONFIG_STRINGHASHCACHE_ENABLED
+    #include <boost/atomic.hpp>
+#endif
+
 
 namespace z
 {
@@ -911,6 +915,22 @@ public:
     /// </returns>
     int CompareTo(const StringUnicode &strInputString, const EComparisonType &eComparisonType=EComparisonType::E_BinaryCaseSensitive) const;
 
+    /// <summary>
+    /// Calculates a 64-bits hash code from the sequence of UTF-16 code units that compose the string.
+    /// </summary>
+    /// <remarks>
+    /// It implements the wyhash function (https://github.com/wangyi-fudan/wyhash), which consumes 16 bytes per step and 48 bytes per step
+    /// in long strings, using the full product of 64-bits multiplications to mix them.<br/>
+    /// Equal strings always produce the same hash code, but strings that are equivalent when using canonical comparisons may not; normalize them first if that is needed.
+    /// The result depends on the endianness of the machine, so it should not be stored nor sent to other machines.<br/>
+    /// When the hash cache is enabled (see Z_CONFIG_STRINGHASHCACHE_DEFAULT), the result is kept in the string and returned again until the string is modified; 
+    /// copies of the string keep it too. Calling this method on the same instance from several threads is safe as long as none of them modifies it.
+    /// </remarks>
+    /// <returns>
+    /// The hash code of the string.
+    /// </returns>
+    u64_z GetHashCode() const;
+
     /// <summary>
     /// Searches for a string pattern throughout the resident string and returns the character position of the first occurrence.
     /// </summary>
@@ -1476,6 +1496,41 @@ private:
     /// </returns>
     static const icu::Collator* _GetCollator(const EComparisonType &eComparisonType);
 
+    /// <summary>
+    /// Discards the hash code kept in the string, if any, so it is calculated again the next time it is requested.
+    /// </summary>
+    /// <remarks>
+    /// It must be called every time the internal string is modified.
+    /// </remarks>
+    void _InvalidateHashCode();
+
+    /// <summary>
+    /// Calculates the wyhash hash code of a sequence of bytes.
+    /// </summary>
+    /// <param name="pBuffer">[IN] The sequence of bytes. It can be null only if the size is zero.</param>
+    /// <param name="uSize">[IN] The number of bytes in the sequence.</param>
+    /// <returns>
+    /// The hash code.
+    /// </returns>
+    static u64_z _CalculateHashCode(const void* pBuffer, const puint_z uSize);
+
+    /// <summary>
+    /// Multiplies two 64-bits integers, obtaining the 128 bits of the product.
+    /// </summary>
+    /// <param name="uA">[IN/OUT] The first operand. It will contain the lower 64 bits of the product.</param>
+    /// <param name="uB">[IN/OUT] The second operand. It will contain the higher 64 bits of the product.</param>
+    static void _Multiply(u64_z &uA, u64_z &uB);
+
+    /// <summary>
+    /// Multiplies two 64-bits integers and combines both halves of the 128-bits product using an XOR operation.
+    /// </summary>
+    /// <param name="uA">[IN] The first operand.</param>
+    /// <param name="uB">[IN] The second operand.</param>
+    /// <returns>
+    /// The lower half of the product XOR the higher half.
+    /// </returns>
+    static u64_z _MultiplyAndMix(u64_z uA, u64_z uB);
+
 
     // PROPERTIES
     // ---------------
@@ -1549,6 +1604,19 @@ private:
     /// </summary>
     unsigned int m_uLength;
 
+#if Z_CONFIG_STRINGHASHCACHE_DEFAULT == Z_CONFIG_STRINGHASHCACHE_ENABLED
+
+    /// <summary>
+    /// The hash code of the string, calculated the first time it is requested. Zero means that it has not been calculated yet.
+    /// </summary>
+    /// <remarks>
+    /// It is atomic because constant strings may be hashed by several threads at the same time. Accesses are not ordered, since every thread 
+    /// that finds it empty calculates the same value.
+    /// </remarks>
+    mutable boost::atomic<u64_z> m_uHashCode;
+
+#endif
+
 };
 
 
@@ -140,6 +140,13 @@ const unsigned int Z_VERSION_REVISION = 0;
 #define align_z(startingPointer, alignment) (void*)(puint_z(startingPointer) + alignment_offset_z(startingPointer, alignment))
 
 
+// --------------------------------------------------------------------------------------------------------
+// The size, in bytes, of a line of the data cache. Data written by different threads should be separated by, at least,
+// this distance to avoid false sharing.
+// --------------------------------------------------------------------------------------------------------
+#define Z_CACHE_LINE_SIZE 64U
+
+
 // --------------------------------------------------------------------------------------------------------
 // Function signature printing definition: Alias for every compiler's function printing definition.
 // --------------------------------------------------------------------------------------------------------
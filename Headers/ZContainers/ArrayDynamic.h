@@ -46,17 +46,16 @@ namespace z
 /// If SComparatorDefault is used as comparator, elements will be forced to implement operators "==" and "<".
 /// </remarks>
 /// <typeparam name="T">The type of every element in the array.</typeparam>
-/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the array. By default, PoolAllocator will
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the array. By default, ContiguousAllocator will
 /// be used.</typeparam>
 /// <typeparam name="ComparatorT">Optional. The type of comparator to compare elements to each other, used in search and ordering
 /// algorithms. By default, SComparatorDefault will be used.</typeparam>
-template<class T, class AllocatorT = PoolAllocator, class ComparatorT = SComparatorDefault<T> >
+template<class T, class AllocatorT = ContiguousAllocator, class ComparatorT = SComparatorDefault<T> >
 class ArrayDynamic : public ArrayFixed<T, AllocatorT, ComparatorT>
 {
     using ArrayFixed<T, AllocatorT, ComparatorT>::m_allocator;
     using ArrayFixed<T, AllocatorT, ComparatorT>::m_uFirst;
     using ArrayFixed<T, AllocatorT, ComparatorT>::m_uLast;
-    using ArrayFixed<T, AllocatorT, ComparatorT>::m_pElementBasePointer;
     
 
     // CONSTANTS
@@ -83,8 +82,6 @@ public:
     {
         if(sm_uDefaultCapacity > ArrayDynamic::DEFAULT_CAPACITY)
             this->Reserve(sm_uDefaultCapacity);
-
-        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
     }
 
     /// <summary>
@@ -103,8 +100,6 @@ public:
 
         if(uCapacity > ArrayDynamic::DEFAULT_CAPACITY)
             this->Reserve(uCapacity);
-
-        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
     }
     
     /// <summary>
@@ -129,8 +124,6 @@ public:
         // Copies every element
         for(puint_z uIndex = 0; uIndex < m_uLast + 1U; ++uIndex) // Fixed arrays are supposed not to be empty
             new(m_allocator.Allocate()) T(arInputArray[uIndex]);
-
-        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
     }
 
     /// <summary>
@@ -156,8 +149,6 @@ public:
         if(m_uLast != ArrayDynamic::END_POSITION_FORWARD)
             for(puint_z uIndex = 0; uIndex < m_uLast + 1U; ++uIndex)
                 new(m_allocator.Allocate()) T(arInputArray[uIndex]);
-
-        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
     }
     
     /// <summary>
@@ -282,10 +273,7 @@ public:
     void Reserve(const puint_z uNumberOfElements)
     {
         if(uNumberOfElements > this->GetCapacity())
-        {
             m_allocator.Reallocate(uNumberOfElements * sizeof(T));
-            m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
-        }
     }
 
     /// <summary>
@@ -298,15 +286,70 @@ public:
     /// <param name="newElement">[IN] The element to be copied.</param>
     void Add(const T &newElement)
     {
-        if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
-        
-        if(this->IsEmpty())
-            m_uFirst = m_uLast = 0;
-        else
-            ++m_uLast;
-
-        new(m_allocator.Allocate()) T(newElement);
+        new(this->_AllocateLast()) T(newElement);
+    }
+    
+    /// <summary>
+    /// Constructs an element at the end of the array, passing no arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// Unlike Add, no temporary element is created nor copied.
+    /// </remarks>
+    void Emplace()
+    {
+        new(this->_AllocateLast()) T();
+    }
+    
+    /// <summary>
+    /// Constructs an element at the end of the array, passing an argument to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// Unlike Add, no temporary element is created nor copied.
+    /// </remarks>
+    /// <typeparam name="Arg1T">The type of the only argument of the constructor.</typeparam>
+    /// <param name="argument1">[IN] The only argument of the constructor.</param>
+    template<class Arg1T>
+    void Emplace(const Arg1T &argument1)
+    {
+        new(this->_AllocateLast()) T(argument1);
+    }
+    
+    /// <summary>
+    /// Constructs an element at the end of the array, passing two arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// Unlike Add, no temporary element is created nor copied.
+    /// </remarks>
+    /// <typeparam name="Arg1T">The type of the first argument of the constructor.</typeparam>
+    /// <typeparam name="Arg2T">The type of the second argument of the constructor.</typeparam>
+    /// <param name="argument1">[IN] The first argument of the constructor.</param>
+    /// <param name="argument2">[IN] The second argument of the constructor.</param>
+    template<class Arg1T, class Arg2T>
+    void Emplace(const Arg1T &argument1, const Arg2T &argument2)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2);
+    }
+    
+    /// <summary>
+    /// Constructs an element at the end of the array, passing three arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// Unlike Add, no temporary element is created nor copied.
+    /// </remarks>
+    /// <typeparam name="Arg1T">The type of the first argument of the constructor.</typeparam>
+    /// <typeparam name="Arg2T">The type of the second argument of the constructor.</typeparam>
+    /// <typeparam name="Arg3T">The type of the third argument of the constructor.</typeparam>
+    /// <param name="argument1">[IN] The first argument of the constructor.</param>
+    /// <param name="argument2">[IN] The second argument of the constructor.</param>
+    /// <param name="argument3">[IN] The third argument of the constructor.</param>
+    template<class Arg1T, class Arg2T, class Arg3T>
+    void Emplace(const Arg1T &argument1, const Arg2T &argument2, const Arg3T &argument3)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2, argument3);
     }
     
     /// <summary>
@@ -329,7 +372,7 @@ public:
         Z_ASSERT_WARNING(!this->IsEmpty() && !position.IsEnd(), "The input iterator is out of bounds");
 
         // Gets the position of the iterator
-        puint_z uIndex = &(*position) - m_pElementBasePointer;
+        puint_z uIndex = &(*position) - this->_GetElementBasePointer();
 
         if(this->GetCount() == this->GetCapacity())
             this->_ReallocateByFactor(this->GetCapacity() + 1U);
@@ -351,12 +394,12 @@ public:
             m_allocator.Allocate();
             
             // Moves all the contiguous elements 1 position forward
-            memmove(m_pElementBasePointer + uIndex + 1U,   // The position where the next blocks are to be moved
-                    m_pElementBasePointer + uIndex,        // The position where the element is to be inserted
+            memmove(this->_GetElementBasePointer() + uIndex + 1U,   // The position where the next blocks are to be moved
+                    this->_GetElementBasePointer() + uIndex,        // The position where the element is to be inserted
                     (m_uLast - uIndex) * sizeof(T));       // The (size of) number of blocks to move (count - index - 1)
                    
             // Calls the copy constructor using the position where the element is inserted
-            new(m_pElementBasePointer + uIndex) T(newElement);
+            new(this->_GetElementBasePointer() + uIndex) T(newElement);
         }
     }
     
@@ -397,12 +440,12 @@ public:
             m_allocator.Allocate();
 
             // Moves all the contiguous elements 1 position forward
-            memmove(m_pElementBasePointer + uIndex + 1U,   // The position where the next blocks are to be moved
-                    m_pElementBasePointer + uIndex,        // The position where the element is to be inserted
+            memmove(this->_GetElementBasePointer() + uIndex + 1U,   // The position where the next blocks are to be moved
+                    this->_GetElementBasePointer() + uIndex,        // The position where the element is to be inserted
                     (m_uLast - uIndex) * sizeof(T));       // The (size of) number of blocks to move (count - index - 1)
 
             // Calls the copy constructor using the position where the element is inserted
-            new(m_pElementBasePointer + uIndex) T(newElement);
+            new(this->_GetElementBasePointer() + uIndex) T(newElement);
         }
     }
     
@@ -424,14 +467,14 @@ public:
         Z_ASSERT_WARNING(!this->IsEmpty() && !position.IsEnd(), "The input iterator is out of bounds");
 
         // Gets the position of the iterator
-        puint_z uIndex = &(*position) - m_pElementBasePointer;
+        puint_z uIndex = &(*position) - this->_GetElementBasePointer();
 
         if(!this->IsEmpty() && uIndex <= m_uLast)
         {
             if(this->GetCount() == 1U)
             {
                 // The container is emptied
-                m_pElementBasePointer->~T();
+                this->_GetElementBasePointer()->~T();
                 m_uFirst = ArrayDynamic::END_POSITION_BACKWARD;
                 m_uLast = ArrayDynamic::END_POSITION_FORWARD;
                 m_allocator.Clear();
@@ -439,15 +482,15 @@ public:
             else
             {
                 // Calls the destructor using the position where the element is removed
-                (m_pElementBasePointer + uIndex)->~T();
+                (this->_GetElementBasePointer() + uIndex)->~T();
 
                 // Moves all the contiguous elements 1 position backward
-                memmove(m_pElementBasePointer + uIndex,        // The position where the next blocks are to be moved
-                        m_pElementBasePointer + uIndex + 1U,   // The position where the next blocks are currently
+                memmove(this->_GetElementBasePointer() + uIndex,        // The position where the next blocks are to be moved
+                        this->_GetElementBasePointer() + uIndex + 1U,   // The position where the next blocks are currently
                         (m_uLast - uIndex) * sizeof(T));       // The (size of) number of blocks to move (count - index - 1)
 
                 // Decreases the allocated space
-                m_allocator.Deallocate(m_pElementBasePointer + m_uLast);
+                m_allocator.Deallocate(this->_GetElementBasePointer() + m_uLast);
                 --m_uLast;
             }
         }
@@ -473,7 +516,7 @@ public:
             if(this->GetCount() == 1U)
             {
                 // The container is emptied
-                m_pElementBasePointer->~T();
+                this->_GetElementBasePointer()->~T();
                 m_uFirst = ArrayDynamic::END_POSITION_BACKWARD;
                 m_uLast = ArrayDynamic::END_POSITION_FORWARD;
                 m_allocator.Clear();
@@ -481,15 +524,15 @@ public:
             else
             {
                 // Calls the destructor using the position where the element is removed
-                (m_pElementBasePointer + uIndex)->~T();
+                (this->_GetElementBasePointer() + uIndex)->~T();
 
                 // Moves all the contiguous elements 1 position backward
-                memmove(m_pElementBasePointer + uIndex,        // The position where the next blocks are to be moved
-                        m_pElementBasePointer + uIndex + 1U,   // The position where the next blocks are currently
+                memmove(this->_GetElementBasePointer() + uIndex,        // The position where the next blocks are to be moved
+                        this->_GetElementBasePointer() + uIndex + 1U,   // The position where the next blocks are currently
                         (m_uLast - uIndex) * sizeof(T));       // The (size of) number of blocks to move (count - index - 1)
 
                 // Decreases the allocated space
-                m_allocator.Deallocate(m_pElementBasePointer + m_uLast);
+                m_allocator.Deallocate(this->_GetElementBasePointer() + m_uLast);
                 --m_uLast;
             }
         }
@@ -508,7 +551,7 @@ public:
         {
             // Calls every destructor, from first to last
             for(puint_z uIndex = m_uFirst; uIndex <= m_uLast; ++uIndex)
-                (m_pElementBasePointer + uIndex)->~T();
+                (this->_GetElementBasePointer() + uIndex)->~T();
 
             m_uFirst = ArrayDynamic::END_POSITION_BACKWARD;
             m_uLast = ArrayDynamic::END_POSITION_FORWARD;
@@ -612,7 +655,7 @@ public:
         if(this->GetCapacity() < this->GetCount() + NEW_ELEMENTS_COUNT)
             this->_ReallocateByFactor(this->GetCount() + NEW_ELEMENTS_COUNT);
         
-        T* pCurrentResident = m_pElementBasePointer + FIXED_INDEX;
+        T* pCurrentResident = this->_GetElementBasePointer() + FIXED_INDEX;
         const T* pCurrentInput = &*first;
         const T* pAfterLast = (&*last) + 1U;
 
@@ -676,7 +719,7 @@ public:
             this->_ReallocateByFactor(this->GetCount() + NEW_ELEMENTS_COUNT);
         }
         
-        T* pCurrentResident = m_pElementBasePointer + FIXED_INDEX;
+        T* pCurrentResident = this->_GetElementBasePointer() + FIXED_INDEX;
         const T* pCurrentInput = &*first;
         const T* pAfterLast = (&*last) + 1U;
 
@@ -732,7 +775,7 @@ public:
         for(T* pElementToDelete = pFirstInRange; pElementToDelete != pAfterLast; ++pElementToDelete)
             (*pElementToDelete).~T();
 
-        const puint_z FIRST_DELETED_POSITION = pFirstInRange - m_pElementBasePointer;
+        const puint_z FIRST_DELETED_POSITION = pFirstInRange - this->_GetElementBasePointer();
         const puint_z ELEMENTS_AFTER_LAST = this->GetCount() - FIRST_DELETED_POSITION - ELEMENTS_TO_REMOVE_COUNT;
 
         // Moves all the elements of positions posterior to the last deleted element to the position of the first removed element
@@ -772,14 +815,14 @@ public:
 
         const puint_z ELEMENTS_TO_REMOVE_COUNT = uLast - uFirst + 1U;
 
-        T* pFirstInRange = m_pElementBasePointer + uFirst;
-        T* pAfterLast = m_pElementBasePointer + uLast + 1U;
+        T* pFirstInRange = this->_GetElementBasePointer() + uFirst;
+        T* pAfterLast = this->_GetElementBasePointer() + uLast + 1U;
 
         // Deletes each element in the input range
         for(T* pElementToDelete = pFirstInRange; pElementToDelete != pAfterLast; ++pElementToDelete)
             (*pElementToDelete).~T();
         
-        const puint_z FIRST_DELETED_POSITION = pFirstInRange - m_pElementBasePointer;
+        const puint_z FIRST_DELETED_POSITION = pFirstInRange - this->_GetElementBasePointer();
         const puint_z ELEMENTS_AFTER_LAST = this->GetCount() - FIRST_DELETED_POSITION - ELEMENTS_TO_REMOVE_COUNT;
 
         // Moves all the elements of positions posterior to the last deleted element to the position of the first removed element
@@ -859,8 +902,8 @@ public:
         
         ArrayDynamic arResult(ELEMENTS_TO_GET_COUNT);
 
-        T* pCurrentResult = m_pElementBasePointer + uFirst;
-        T* pAfterLast = m_pElementBasePointer + uLast + 1U;
+        T* pCurrentResult = this->_GetElementBasePointer() + uFirst;
+        T* pAfterLast = this->_GetElementBasePointer() + uLast + 1U;
 
         // Copies each element in the input range
         for(; pCurrentResult != pAfterLast; ++pCurrentResult)
@@ -874,6 +917,25 @@ public:
 
 private:
 
+    /// <summary>
+    /// Reserves the memory for a new element at the end of the array, increasing the capacity if necessary.
+    /// </summary>
+    /// <returns>
+    /// The address where the new element must be constructed.
+    /// </returns>
+    void* _AllocateLast()
+    {
+        if(this->GetCount() == this->GetCapacity())
+            this->_ReallocateByFactor(this->GetCapacity() + 1U);
+        
+        if(this->IsEmpty())
+            m_uFirst = m_uLast = 0;
+        else
+            ++m_uLast;
+
+        return m_allocator.Allocate();
+    }
+
     /// <summary>
     /// Increases the capacity of the array, reserving memory for more elements than necessary, depending on the reallocation factor.
     /// </summary>
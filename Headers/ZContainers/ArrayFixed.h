@@ -32,6 +32,7 @@
 #include "ZCommon/Assertions.h"
 #include "ZCommon/DataTypes/StringsDefinitions.h"
 #include "ZMemory/PoolAllocator.h"
+#include "ZMemory/ContiguousAllocator.h"
 #include "ZCommon/Alignment.h"
 #include "ZContainers/SComparatorDefault.h"
 #include "ZCommon/AllocationOperators.h"
@@ -56,11 +57,11 @@ namespace z
 /// If SComparatorDefault is used as comparator, elements will be forced to implement operators "==" and "<".
 /// </remarks>
 /// <typeparam name="T">The type of every element in the array.</typeparam>
-/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the array. By default, PoolAllocator will
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the array. By default, ContiguousAllocator will
 /// be used.</typeparam>
 /// <typeparam name="ComparatorT">Optional. The type of comparator to compare elements to each other, used in search and ordering
 /// algorithms. By default, SComparatorDefault will be used.</typeparam>
-template <class T, class AllocatorT = PoolAllocator, class ComparatorT = SComparatorDefault<T> >
+template <class T, class AllocatorT = ContiguousAllocator, class ComparatorT = SComparatorDefault<T> >
 class ArrayFixed
 {
 
@@ -140,7 +141,7 @@ public:
             Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the reference to the array element");
             Z_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the reference to the array element");
 
-            return *(m_pArray->m_pElementBasePointer + m_uPosition);
+            return *(m_pArray->_GetElementBasePointer() + m_uPosition);
         }
 
         /// <summary>
@@ -157,7 +158,7 @@ public:
             Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the pointer to the array element");
             Z_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the reference to the array element");
 
-            return m_pArray->m_pElementBasePointer + m_uPosition;
+            return m_pArray->_GetElementBasePointer() + m_uPosition;
         }
 
         /// <summary>
@@ -628,7 +629,7 @@ public:
             Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the reference to the array element");
             Z_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the reference to the array element");
 
-            return *(m_pArray->m_pElementBasePointer + m_uPosition);
+            return *(m_pArray->_GetElementBasePointer() + m_uPosition);
         }
 
         /// <summary>
@@ -645,7 +646,7 @@ public:
             Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the pointer to the array element");
             Z_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the reference to the array element");
 
-            return m_pArray->m_pElementBasePointer + m_uPosition;
+            return m_pArray->_GetElementBasePointer() + m_uPosition;
         }
         
         /// <summary>
@@ -883,8 +884,7 @@ public:
     ArrayFixed(const puint_z uCount, const T &initialValue) :
             m_uFirst(0),
             m_uLast(uCount - 1),
-            m_allocator(uCount * sizeof(T), sizeof(T), Alignment(alignof_z(T))),
-            m_pElementBasePointer(null_z)
+            m_allocator(uCount * sizeof(T), sizeof(T), Alignment(alignof_z(T)))
     {
         Z_ASSERT_ERROR( uCount > 0, "Zero elements array is not allowed." );
         Z_ASSERT_ERROR( this->_MultiplicationOverflows(uCount, sizeof(T)) == false, "The amount of memory requested overflows the maximum allowed by this container." );
@@ -894,8 +894,6 @@ public:
             // Allocates and writes in the returned buffer the initial value
             new(m_allocator.Allocate()) T(initialValue);
         }
-
-        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
     }
 
     /// <summary>
@@ -909,8 +907,7 @@ public:
     ArrayFixed(const T* pArray, const puint_z uNumberOfElements) :
             m_uFirst(0),
             m_uLast(uNumberOfElements - 1),
-            m_allocator(uNumberOfElements * sizeof(T), sizeof(T), Alignment(alignof_z(T))),
-            m_pElementBasePointer(null_z)
+            m_allocator(uNumberOfElements * sizeof(T), sizeof(T), Alignment(alignof_z(T)))
     {
         Z_ASSERT_ERROR( pArray != null_z, "The argument pArray is null." );
         Z_ASSERT_ERROR( uNumberOfElements > 0, "Zero elements array is not allowed." );
@@ -920,8 +917,6 @@ public:
             // Allocates and writes in the returned buffer a copy of the input array
             new(m_allocator.Allocate()) T(pArray[uIndex]);
         }
-
-        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
     }
 
     /// <summary>
@@ -934,8 +929,7 @@ public:
     ArrayFixed(const ArrayFixed &fixedArray) :
             m_uFirst(fixedArray.m_uFirst),
             m_uLast(fixedArray.m_uLast),
-            m_allocator(fixedArray.GetCount() * sizeof(T), sizeof(T), Alignment(alignof_z(T))),
-            m_pElementBasePointer(null_z)
+            m_allocator(fixedArray.GetCount() * sizeof(T), sizeof(T), Alignment(alignof_z(T)))
     {
         for(puint_z uIndex = 0; uIndex < fixedArray.m_uLast + 1U; ++uIndex)
         {
@@ -943,8 +937,6 @@ public:
             // the value of the origin element in the corresponding array position.
             new(m_allocator.Allocate()) T(fixedArray[uIndex]);
         }
-
-        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
     }
 
 protected:
@@ -955,8 +947,7 @@ protected:
     ArrayFixed() :
         m_uFirst(END_POSITION_BACKWARD),
         m_uLast(END_POSITION_FORWARD),
-        m_allocator(ArrayFixed::DEFAULT_CAPACITY * sizeof(T), sizeof(T), Alignment(alignof_z(T))),
-        m_pElementBasePointer(null_z)
+        m_allocator(ArrayFixed::DEFAULT_CAPACITY * sizeof(T), sizeof(T), Alignment(alignof_z(T)))
     {
     }
 
@@ -1039,7 +1030,7 @@ public:
     T& GetValue(const puint_z uIndex) const
     {
         Z_ASSERT_ERROR( uIndex < this->GetCount(), "Index must be less than the array's size." );
-        return *(m_pElementBasePointer + uIndex);
+        return *(this->_GetElementBasePointer() + uIndex);
     }
 
     /// <summary>
@@ -1067,7 +1058,7 @@ public:
     void SetValue(const puint_z uIndex, const T& value)
     {
         Z_ASSERT_ERROR( uIndex < this->GetCount(), "Index must be less than the array's size." );
-        *(m_pElementBasePointer + uIndex) = value;
+        *(this->_GetElementBasePointer() + uIndex) = value;
     }
 
     /// <summary>
@@ -1127,7 +1118,7 @@ public:
         Z_ASSERT_ERROR(uLast < this->GetCount(), "The last index is out of bounds.");
         Z_ASSERT_ERROR(uFirst <= uLast, "The first index must be lower than or equal to the last index.");
 
-        return ArrayFixed(m_pElementBasePointer + uFirst, uLast - uFirst + 1U);
+        return ArrayFixed(this->_GetElementBasePointer() + uFirst, uLast - uFirst + 1U);
     }
     
     /// <summary>
@@ -1205,6 +1196,31 @@ public:
         memcpy(pElementB, arBytes,   sizeof(T));
     }
     
+    /// <summary>
+    /// Exchanges the elements and the capacity of two arrays.
+    /// </summary>
+    /// <remarks>
+    /// It is the cheapest way to transfer the content of an array to another, since neither copy constructors, nor assignment operators nor destructors 
+    /// are called and no memory is copied, regardless of the number of elements.<br/>
+    /// Pointers to elements remain valid, although they will point to elements of the other array. Iterators keep pointing to the same array and 
+    /// positions, so they may become invalid.<br/>
+    /// If the allocator stores the elements inside the instance (see InlineAllocator), those elements are copied bitwise and pointers to them become invalid.<br/>
+    /// Both arrays must be of the same kind, either fixed or dynamic.
+    /// </remarks>
+    /// <param name="arInputArray">[IN/OUT] The array whose elements will be exchanged with the resident array's. It can be the resident array.</param>
+    void Swap(ArrayFixed &arInputArray)
+    {
+        m_allocator.Swap(arInputArray.m_allocator);
+
+        const puint_z FIRST = m_uFirst;
+        m_uFirst = arInputArray.m_uFirst;
+        arInputArray.m_uFirst = FIRST;
+
+        const puint_z LAST = m_uLast;
+        m_uLast = arInputArray.m_uLast;
+        arInputArray.m_uLast = LAST;
+    }
+    
     /// <summary>
     /// Equality operator that checks whether two arrays are equal.
     /// </summary>
@@ -1269,7 +1285,7 @@ public:
     /// </returns>
     bool Contains(const T &element) const
     {
-        const T* pElement = m_pElementBasePointer;
+        const T* pElement = this->_GetElementBasePointer();
         puint_z uIndex = 0;
         const puint_z ARRAY_COUNT = this->GetCount();
         
@@ -1298,7 +1314,7 @@ public:
     /// </returns>
     puint_z IndexOf(const T &element) const
     {
-        const T* pElement = m_pElementBasePointer;
+        const T* pElement = this->_GetElementBasePointer();
         puint_z uIndex = 0;
         const puint_z ARRAY_COUNT = this->GetCount();
         
@@ -1333,7 +1349,7 @@ public:
 
         Z_ASSERT_WARNING(uIndex < ARRAY_COUNT, "The input start index must be lower than the number of elements in the array.");
 
-        const T* pElement = m_pElementBasePointer + uStartIndex;
+        const T* pElement = this->_GetElementBasePointer() + uStartIndex;
         
         bool bElementFound = false;
 
@@ -1360,7 +1376,7 @@ public:
     /// </returns>
     ArrayIterator PositionOf(const T &element) const
     {
-        const T* pElement = m_pElementBasePointer;
+        const T* pElement = this->_GetElementBasePointer();
         ArrayFixed::ArrayIterator position = this->GetFirst();
 
         bool bElementFound = false;
@@ -1393,7 +1409,7 @@ public:
         Z_ASSERT_ERROR(startPosition.IsValid(), "The input start position must not point to an end position.");
 
         const T* pElement = startPosition.IsEnd() ? null_z : &*startPosition;
-        ArrayFixed::ArrayIterator position(this, pElement - m_pElementBasePointer);
+        ArrayFixed::ArrayIterator position(this, pElement - this->_GetElementBasePointer());
 
         bool bElementFound = false;
 
@@ -1407,6 +1423,23 @@ public:
         return bElementFound ? --position : position;
     }
 
+protected:
+
+    /// <summary>
+    /// Gets the address of the first element in the buffer of the allocator.
+    /// </summary>
+    /// <remarks>
+    /// It is obtained from the allocator every time instead of being stored, so the array does not point to itself when the allocator keeps the 
+    /// elements inside the instance (see InlineAllocator) and can be moved bitwise.
+    /// </remarks>
+    /// <returns>
+    /// The address of the first element.
+    /// </returns>
+    T* _GetElementBasePointer() const
+    {
+        return scast_z(m_allocator.GetPointer(), T*);
+    }
+
 private:
 
     /// <summary>
@@ -1511,11 +1544,6 @@ protected:
     /// The allocator which stores the array elements.
     /// </summary>
     AllocatorT m_allocator;
-    
-    /// <summary>
-    /// A pointer to the buffer stored in the memory allocator, casted to the element type, intended to improve overall performance.
-    /// </summary>
-    T* m_pElementBasePointer;
 };
 
 
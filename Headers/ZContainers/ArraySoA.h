@@ -0,0 +1,523 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __ARRAYSOA__
+#define __ARRAYSOA__
+
+#include <cstring>
+#include "ZContainers/ContainersModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Assertions.h"
+#include "ZCommon/Alignment.h"
+#include "ZCommon/AllocationOperators.h"
+#include "ZContainers/ArrayFixed.h"
+#include "ZContainers/Span.h"
+#include "ZMath/Vector3.h"
+#include "ZMath/Vector4.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a set of rows, all of them with the same number of values, stored as a structure of arrays: the values of every column are placed 
+/// contiguously in memory, one column after another.
+/// </summary>
+/// <remarks>
+/// This layout allows processing one component of many rows at once (for example, the X coordinate of many points) using SIMD instructions, since 
+/// consecutive values of the same column can be loaded with a single instruction.<br/>
+/// Every column starts at an address aligned to the size of a cache line, and the capacity is always a multiple of the number of values that fit in 
+/// it, so algorithms may process whole packs of values up to the capacity without exceeding the column. Unused positions are initialized to zero.<br/>
+/// Columns can be accessed through spans, which do not copy any value.<br/>
+/// Rows are removed by moving the last row to the position of the removed one, so the order of rows is not preserved.<br/>
+/// Values are copied with memcpy when the array grows and no constructor nor destructor is called, so the type of values must be a plain type, 
+/// like integers or floating point numbers.
+/// </remarks>
+/// <typeparam name="T">The type of every value.</typeparam>
+/// <typeparam name="COLUMN_COUNT">The number of values in every row, or columns. It must be greater than zero.</typeparam>
+template<class T, unsigned int COLUMN_COUNT>
+class ArraySoA
+{
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The alignment, in bytes, of the first value of every column.
+    /// </summary>
+    static const puint_z COLUMN_ALIGNMENT = Z_CACHE_LINE_SIZE;
+
+    /// <summary>
+    /// The reallocation factor to be applied to calculate the new capacity on every reallocation. It must be greater than or equal to 1.
+    /// </summary>
+    static float REALLOCATION_FACTOR;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <remarks>
+    /// No memory is reserved until the first row is added.
+    /// </remarks>
+    ArraySoA() : m_pColumns(null_z),
+                 m_uColumnSize(0),
+                 m_uCount(0)
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of rows for which to reserve memory, at least.</param>
+    explicit ArraySoA(const puint_z uInitialCapacity) : m_pColumns(null_z),
+                                                         m_uColumnSize(0),
+                                                         m_uCount(0)
+    {
+        this->Reserve(uInitialCapacity);
+    }
+
+    /// <summary>
+    /// Copy constructor that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// The capacity of the resultant array will be just the necessary to store the rows of the input array.
+    /// </remarks>
+    /// <param name="array">[IN] The other array to be copied.</param>
+    ArraySoA(const ArraySoA &array) : m_pColumns(null_z),
+                                      m_uColumnSize(0),
+                                      m_uCount(0)
+    {
+        this->_CopyFrom(array);
+    }
+
+    /// <summary>
+    /// Constructor that converts an array of 3D vectors, whose X, Y and Z components are copied to the first, second and third column, respectively.
+    /// </summary>
+    /// <remarks>
+    /// The array must have 3 columns.
+    /// </remarks>
+    /// <typeparam name="AllocatorT">The allocator of the input array.</typeparam>
+    /// <typeparam name="ComparatorT">The comparator of the input array.</typeparam>
+    /// <param name="arVectors">[IN] The vectors to convert, like an ArrayDynamic of vectors.</param>
+    template<class AllocatorT, class ComparatorT>
+    explicit ArraySoA(const ArrayFixed<Vector3, AllocatorT, ComparatorT> &arVectors) : m_pColumns(null_z),
+                                                                                       m_uColumnSize(0),
+                                                                                       m_uCount(0)
+    {
+        Z_ASSERT_ERROR(COLUMN_COUNT == 3U, "The array must have 3 columns to store 3D vectors.");
+
+        const puint_z VECTOR_COUNT = arVectors.GetCount();
+        this->Reserve(VECTOR_COUNT);
+
+        T* arX = this->_GetColumnPointer(0);
+        T* arY = this->_GetColumnPointer(1U);
+        T* arZ = this->_GetColumnPointer(2U);
+
+        for(puint_z i = 0; i < VECTOR_COUNT; ++i)
+        {
+            const Vector3 &vVector = arVectors[i];
+            arX[i] = vVector.x;
+            arY[i] = vVector.y;
+            arZ[i] = vVector.z;
+        }
+
+        m_uCount = VECTOR_COUNT;
+    }
+
+    /// <summary>
+    /// Constructor that converts an array of 4D vectors, whose X, Y, Z and W components are copied to the first, second, third and fourth column, 
+    /// respectively.
+    /// </summary>
+    /// <remarks>
+    /// The array must have 4 columns.
+    /// </remarks>
+    /// <typeparam name="AllocatorT">The allocator of the input array.</typeparam>
+    /// <typeparam name="ComparatorT">The comparator of the input array.</typeparam>
+    /// <param name="arVectors">[IN] The vectors to convert, like an ArrayDynamic of vectors.</param>
+    template<class AllocatorT, class ComparatorT>
+    explicit ArraySoA(const ArrayFixed<Vector4, AllocatorT, ComparatorT> &arVectors) : m_pColumns(null_z),
+                                                                                       m_uColumnSize(0),
+                                                                                       m_uCount(0)
+    {
+        Z_ASSERT_ERROR(COLUMN_COUNT == 4U, "The array must have 4 columns to store 4D vectors.");
+
+        const puint_z VECTOR_COUNT = arVectors.GetCount();
+        this->Reserve(VECTOR_COUNT);
+
+        T* arX = this->_GetColumnPointer(0);
+        T* arY = this->_GetColumnPointer(1U);
+        T* arZ = this->_GetColumnPointer(2U);
+        T* arW = this->_GetColumnPointer(3U);
+
+        for(puint_z i = 0; i < VECTOR_COUNT; ++i)
+        {
+            const Vector4 &vVector = arVectors[i];
+            arX[i] = vVector.x;
+            arY[i] = vVector.y;
+            arZ[i] = vVector.z;
+            arW[i] = vVector.w;
+        }
+
+        m_uCount = VECTOR_COUNT;
+    }
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~ArraySoA()
+    {
+        if(m_pColumns != null_z)
+            operator delete(m_pColumns, Alignment(ArraySoA::COLUMN_ALIGNMENT));
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Assignment operator that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// Memory is reserved only if the capacity of the resident array is not enough.
+    /// </remarks>
+    /// <param name="array">[IN] The other array to be copied.</param>
+    /// <returns>
+    /// A reference to the resultant array.
+    /// </returns>
+    ArraySoA& operator=(const ArraySoA &array)
+    {
+        if(this != &array)
+        {
+            m_uCount = 0;
+            this->_CopyFrom(array);
+        }
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Adds a row to the end of the array.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer or span invalid.
+    /// </remarks>
+    /// <param name="arRow">[IN] The values of the row, one per column. It must not be null.</param>
+    void Add(const T* arRow)
+    {
+        Z_ASSERT_ERROR(arRow != null_z, "The input row cannot be null.");
+
+        if(m_uCount == this->GetCapacity())
+            this->_ReallocateByFactor(m_uCount + 1U);
+
+        for(unsigned int uColumn = 0; uColumn < COLUMN_COUNT; ++uColumn)
+            this->_GetColumnPointer(uColumn)[m_uCount] = arRow[uColumn];
+
+        ++m_uCount;
+    }
+
+    /// <summary>
+    /// Removes a row by moving the last row to its position.
+    /// </summary>
+    /// <remarks>
+    /// The order of the rows is not preserved, but only one row is moved regardless of the number of rows.
+    /// </remarks>
+    /// <param name="uIndex">[IN] The position (zero-based) of the row to remove. It must be lower than the number of rows.</param>
+    void Remove(const puint_z uIndex)
+    {
+        Z_ASSERT_ERROR(uIndex < m_uCount, "The input index is out of bounds.");
+
+        --m_uCount;
+
+        for(unsigned int uColumn = 0; uColumn < COLUMN_COUNT; ++uColumn)
+        {
+            T* arColumn = this->_GetColumnPointer(uColumn);
+            arColumn[uIndex] = arColumn[m_uCount];
+            arColumn[m_uCount] = T(0);
+        }
+    }
+
+    /// <summary>
+    /// Copies the values of a row.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position (zero-based) of the row. It must be lower than the number of rows.</param>
+    /// <param name="arRow">[OUT] The array where the values of the row will be copied, one per column. It must not be null.</param>
+    void GetRow(const puint_z uIndex, T* arRow) const
+    {
+        Z_ASSERT_ERROR(uIndex < m_uCount, "The input index is out of bounds.");
+        Z_ASSERT_ERROR(arRow != null_z, "The output row cannot be null.");
+
+        for(unsigned int uColumn = 0; uColumn < COLUMN_COUNT; ++uColumn)
+            arRow[uColumn] = this->_GetColumnPointer(uColumn)[uIndex];
+    }
+
+    /// <summary>
+    /// Replaces the values of a row.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position (zero-based) of the row. It must be lower than the number of rows.</param>
+    /// <param name="arRow">[IN] The new values of the row, one per column. It must not be null.</param>
+    void SetRow(const puint_z uIndex, const T* arRow)
+    {
+        Z_ASSERT_ERROR(uIndex < m_uCount, "The input index is out of bounds.");
+        Z_ASSERT_ERROR(arRow != null_z, "The input row cannot be null.");
+
+        for(unsigned int uColumn = 0; uColumn < COLUMN_COUNT; ++uColumn)
+            this->_GetColumnPointer(uColumn)[uIndex] = arRow[uColumn];
+    }
+
+    /// <summary>
+    /// Gets a span that views the values of a column, which can be modified through it.
+    /// </summary>
+    /// <remarks>
+    /// The span becomes invalid when the array reallocates its memory.
+    /// </remarks>
+    /// <param name="uColumn">[IN] The position (zero-based) of the column. It must be lower than the number of columns.</param>
+    /// <returns>
+    /// A span that views as many values as rows in the array. The first value is aligned to the size of a cache line.
+    /// </returns>
+    Span<T> GetColumn(const unsigned int uColumn)
+    {
+        Z_ASSERT_ERROR(uColumn < COLUMN_COUNT, "The input column is out of bounds.");
+
+        return Span<T>(this->_GetColumnPointer(uColumn), m_uCount);
+    }
+
+    /// <summary>
+    /// Gets a span that views the values of a column.
+    /// </summary>
+    /// <remarks>
+    /// The span becomes invalid when the array reallocates its memory.
+    /// </remarks>
+    /// <param name="uColumn">[IN] The position (zero-based) of the column. It must be lower than the number of columns.</param>
+    /// <returns>
+    /// A span that views as many values as rows in the array. The first value is aligned to the size of a cache line.
+    /// </returns>
+    Span<const T> GetColumn(const unsigned int uColumn) const
+    {
+        Z_ASSERT_ERROR(uColumn < COLUMN_COUNT, "The input column is out of bounds.");
+
+        return Span<const T>(this->_GetColumnPointer(uColumn), m_uCount);
+    }
+
+    /// <summary>
+    /// Removes all the rows of the array.
+    /// </summary>
+    /// <remarks>
+    /// The capacity does not change.
+    /// </remarks>
+    void Clear()
+    {
+        if(m_pColumns != null_z)
+            memset(m_pColumns, 0, m_uColumnSize * COLUMN_COUNT);
+
+        m_uCount = 0;
+    }
+
+    /// <summary>
+    /// Increases the capacity of the array, reserving memory for more rows.
+    /// </summary>
+    /// <remarks>
+    /// This operation implies a reallocation, which means that any pointer or span to values of this array will be pointing to garbage.<br/>
+    /// The capacity is rounded up so the size of every column is a multiple of the size of a cache line.
+    /// </remarks>
+    /// <param name="uNumberOfRows">[IN] The number of rows for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void Reserve(const puint_z uNumberOfRows)
+    {
+        if(uNumberOfRows > this->GetCapacity())
+        {
+            const puint_z COLUMN_SIZE = (uNumberOfRows * sizeof(T) + ArraySoA::COLUMN_ALIGNMENT - 1U) / ArraySoA::COLUMN_ALIGNMENT * ArraySoA::COLUMN_ALIGNMENT;
+            u8_z* pNewColumns = scast_z(operator new(COLUMN_SIZE * COLUMN_COUNT, Alignment(ArraySoA::COLUMN_ALIGNMENT)), u8_z*);
+            memset(pNewColumns, 0, COLUMN_SIZE * COLUMN_COUNT);
+
+            if(m_pColumns != null_z)
+            {
+                for(unsigned int uColumn = 0; uColumn < COLUMN_COUNT; ++uColumn)
+                    memcpy(pNewColumns + uColumn * COLUMN_SIZE, m_pColumns + uColumn * m_uColumnSize, m_uCount * sizeof(T));
+
+                operator delete(m_pColumns, Alignment(ArraySoA::COLUMN_ALIGNMENT));
+            }
+
+            m_pColumns = pNewColumns;
+            m_uColumnSize = COLUMN_SIZE;
+        }
+    }
+
+    /// <summary>
+    /// Exchanges the rows and the capacity of two arrays.
+    /// </summary>
+    /// <remarks>
+    /// No value is copied, regardless of the number of rows. Spans keep pointing to the same values, which will belong to the other array.
+    /// </remarks>
+    /// <param name="array">[IN/OUT] The array whose rows will be exchanged with the resident array's. It can be the resident array.</param>
+    void Swap(ArraySoA &array)
+    {
+        u8_z* pColumns = m_pColumns;
+        m_pColumns = array.m_pColumns;
+        array.m_pColumns = pColumns;
+
+        const puint_z COLUMN_SIZE = m_uColumnSize;
+        m_uColumnSize = array.m_uColumnSize;
+        array.m_uColumnSize = COLUMN_SIZE;
+
+        const puint_z COUNT = m_uCount;
+        m_uCount = array.m_uCount;
+        array.m_uCount = COUNT;
+    }
+
+private:
+
+    /// <summary>
+    /// Gets the first value of a column.
+    /// </summary>
+    /// <param name="uColumn">[IN] The position of the column.</param>
+    /// <returns>
+    /// A pointer to the first value.
+    /// </returns>
+    T* _GetColumnPointer(const unsigned int uColumn) const
+    {
+        return rcast_z(m_pColumns + uColumn * m_uColumnSize, T*);
+    }
+
+    /// <summary>
+    /// Copies the rows of another array, reserving memory if the capacity is not enough. The resident array must be empty.
+    /// </summary>
+    /// <param name="array">[IN] The array to copy.</param>
+    void _CopyFrom(const ArraySoA &array)
+    {
+        this->Reserve(array.m_uCount);
+
+        for(unsigned int uColumn = 0; uColumn < COLUMN_COUNT; ++uColumn)
+        {
+            memcpy(this->_GetColumnPointer(uColumn), array._GetColumnPointer(uColumn), array.m_uCount * sizeof(T));
+            memset(this->_GetColumnPointer(uColumn) + array.m_uCount, 0, m_uColumnSize - array.m_uCount * sizeof(T));
+        }
+
+        m_uCount = array.m_uCount;
+    }
+
+    /// <summary>
+    /// Increases the capacity of the array, reserving memory for more rows than necessary, depending on the reallocation factor.
+    /// </summary>
+    /// <param name="uNumberOfRows">[IN] The number of rows for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void _ReallocateByFactor(const puint_z uNumberOfRows)
+    {
+        const puint_z FINAL_CAPACITY = scast_z(scast_z(uNumberOfRows, float) * ArraySoA::REALLOCATION_FACTOR, puint_z);
+        this->Reserve(FINAL_CAPACITY);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of columns, or values in every row.
+    /// </summary>
+    /// <returns>
+    /// The number of columns.
+    /// </returns>
+    static unsigned int GetColumnCount()
+    {
+        return COLUMN_COUNT;
+    }
+
+    /// <summary>
+    /// Gets the capacity of the array, which means the number of rows that can be added before the columns are reallocated to
+    /// another part of memory.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the array. It is zero if no memory has been reserved yet.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_uColumnSize / sizeof(T);
+    }
+
+    /// <summary>
+    /// Gets the number of rows in the array.
+    /// </summary>
+    /// <returns>
+    /// The number of rows.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Indicates whether the array is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if there are no rows; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_uCount == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The memory block that contains all the columns, one after another.
+    /// </summary>
+    u8_z* m_pColumns;
+
+    /// <summary>
+    /// The size, in bytes, of every column, which is a multiple of the alignment of columns.
+    /// </summary>
+    puint_z m_uColumnSize;
+
+    /// <summary>
+    /// The number of rows.
+    /// </summary>
+    puint_z m_uCount;
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class T, unsigned int COLUMN_COUNT>
+float ArraySoA<T, COLUMN_COUNT>::REALLOCATION_FACTOR = 1.5f;
+
+
+} // namespace z
+
+
+#endif // __ARRAYSOA__
@@ -0,0 +1,1977 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __BTREE__
+#define __BTREE__
+
+#include "ZContainers/ContainersModuleDefinitions.h"
+
+#include <cstring>
+#include <boost/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include "ZCommon/Assertions.h"
+#include "ZMemory/PoolAllocator.h"
+#include "ZCommon/Alignment.h"
+#include "ZContainers/SComparatorDefault.h"
+#include "ZContainers/ETreeTraversalOrder.h"
+#include "ZContainers/EIterationDirection.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a B-tree, a balanced search tree whose nodes store several sorted elements and have one child more than elements. Elements are unique and 
+/// they are compared using a comparator component whose type is provided as a template parameter.
+/// </summary>
+/// <remarks>
+/// Every node occupies a whole number of cache lines and stores its elements contiguously, so most of the comparisons performed when searching for 
+/// an element take place in memory that was already loaded, instead of following a pointer per comparison as in a binary search tree. The number of 
+/// elements per node depends on the size of the elements (up to 4 cache lines of elements, 3 elements at least). All the leaves are at the same depth, 
+/// so the tree is always balanced, regardless of the order in which elements are added.<br/>
+/// It provides the same interface as BinarySearchTree, so both can be used as the internal tree of a Dictionary. Only depth-first in-order traversal 
+/// is supported, which visits the elements in ascending order.<br/>
+/// Elements are moved in memory when nodes are split or merged, so adding or removing elements invalidates the iterators and pointers to other elements.<br/>
+/// In a B-tree, elements cannot be modified, their position in the tree may become inconsistent since it depends on their value and the comparison algorithm.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// If SComparatorDefault is used as comparator, elements will be forced to implement operators "==" and "<".
+/// </remarks>
+/// <typeparam name="T">The type of the tree elements.</typeparam>
+/// <typeparam name="AllocatorT">The allocator used to reserve memory for the nodes. It must be able to deallocate blocks in any order. The default type is PoolAllocator.</typeparam>
+/// <typeparam name="ComparatorT">The comparator. The default type is SComparatorDefault.</typeparam>
+template<class T, class AllocatorT = PoolAllocator, class ComparatorT = SComparatorDefault<T> >
+class BTree
+{
+    // CONSTANTS (I)
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The minimum number of children of the nodes, except the root and the leaves.
+    /// </summary>
+    static const puint_z MINIMUM_DEGREE = (4U * Z_CACHE_LINE_SIZE / sizeof(T) + 1U) / 2U < 2U ? 2U : (4U * Z_CACHE_LINE_SIZE / sizeof(T) + 1U) / 2U;
+
+    /// <summary>
+    /// The maximum number of elements of a node.
+    /// </summary>
+    static const puint_z MAXIMUM_ELEMENTS = 2U * MINIMUM_DEGREE - 1U;
+
+    /// <summary>
+    /// The minimum number of elements of a node, except the root.
+    /// </summary>
+    static const puint_z MINIMUM_ELEMENTS = MINIMUM_DEGREE - 1U;
+
+
+    // INTERNAL CLASSES
+    // -----------------
+protected:
+
+    /// <summary>
+    /// Data structure that stores the elements of a node and the positions of its parent and its children.
+    /// </summary>
+    class BTreeNode
+    {
+        // METHODS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Sets the node up as a leaf with no elements and no parent.
+        /// </summary>
+        void Reset()
+        {
+            m_uParent = BTree::END_POSITION_FORWARD;
+            m_uElementCount = 0;
+
+            for(puint_z i = 0; i <= BTree::MAXIMUM_ELEMENTS; ++i)
+                m_arChildren[i] = BTree::END_POSITION_FORWARD;
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the position of the parent node.
+        /// </summary>
+        /// <returns>
+        /// The position of the parent node. If the node is the root, it is the end position.
+        /// </returns>
+        puint_z GetParent() const
+        {
+            return m_uParent;
+        }
+
+        /// <summary>
+        /// Sets the position of the parent node.
+        /// </summary>
+        /// <param name="uPosition">[IN] The position of the parent node.</param>
+        void SetParent(const puint_z uPosition)
+        {
+            m_uParent = uPosition;
+        }
+
+        /// <summary>
+        /// Gets the number of elements stored in the node.
+        /// </summary>
+        /// <returns>
+        /// The number of elements.
+        /// </returns>
+        puint_z GetElementCount() const
+        {
+            return m_uElementCount;
+        }
+
+        /// <summary>
+        /// Sets the number of elements stored in the node.
+        /// </summary>
+        /// <param name="uCount">[IN] The number of elements.</param>
+        void SetElementCount(const puint_z uCount)
+        {
+            m_uElementCount = uCount;
+        }
+
+        /// <summary>
+        /// Gets the positions of the children, which are one more than the elements. They are end positions in the leaves.
+        /// </summary>
+        /// <returns>
+        /// The positions of the children.
+        /// </returns>
+        puint_z* GetChildren()
+        {
+            return m_arChildren;
+        }
+
+        /// <summary>
+        /// Gets the positions of the children, which are one more than the elements. They are end positions in the leaves.
+        /// </summary>
+        /// <returns>
+        /// The positions of the children.
+        /// </returns>
+        const puint_z* GetChildren() const
+        {
+            return m_arChildren;
+        }
+
+        /// <summary>
+        /// Gets the sorted elements of the node.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the first element.
+        /// </returns>
+        T* GetElements()
+        {
+            return rcast_z(&m_elements, T*);
+        }
+
+        /// <summary>
+        /// Gets the sorted elements of the node.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the first element.
+        /// </returns>
+        const T* GetElements() const
+        {
+            return rcast_z(&m_elements, const T*);
+        }
+
+        /// <summary>
+        /// Indicates whether the node has no children.
+        /// </summary>
+        /// <returns>
+        /// True if the node is a leaf; False otherwise.
+        /// </returns>
+        bool IsLeaf() const
+        {
+            return m_arChildren[0] == BTree::END_POSITION_FORWARD;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The position of the parent node.
+        /// </summary>
+        puint_z m_uParent;
+
+        /// <summary>
+        /// The number of elements stored in the node.
+        /// </summary>
+        puint_z m_uElementCount;
+
+        /// <summary>
+        /// The positions of the children.
+        /// </summary>
+        puint_z m_arChildren[MAXIMUM_ELEMENTS + 1U];
+
+        /// <summary>
+        /// The memory where the elements are stored.
+        /// </summary>
+        typename boost::aligned_storage<MAXIMUM_ELEMENTS * sizeof(T), boost::alignment_of<T>::value>::type m_elements;
+    };
+
+public:
+
+    /// <summary>
+    /// Iterator that steps once per element of a B-tree, in ascending order.
+    /// </summary>
+    /// <remarks>
+    /// Once an interator have been bound to a tree, it cannot point to another tree ever.<br/>
+    /// Iterators can be invalid, this means, they may not point to an existing position of the tree.<br/>
+    /// The position just before the first element or just after the last one (end positions) are considered as valid positions.
+    /// </remarks>
+    class ConstBTreeIterator
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the tree to iterate through, the position to physically point to and the traversal order. This constructor is intended 
+        /// to be used internally, use GetIterator method of the BTree class instead.
+        /// </summary>
+        /// <remarks>
+        /// If the tree is empty, it will point to the end position (forward iteration).
+        /// </remarks>
+        /// <param name="pTree">[IN] The tree to iterate through. It must not be null.</param>
+        /// <param name="uPosition">[IN] The position the iterator will point to. This is not the logical position of tree elements, but the physical.</param>
+        /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. Only depth-first in-order is supported.</param>
+        ConstBTreeIterator(const BTree* pTree, const puint_z uPosition, const ETreeTraversalOrder &eTraversalOrder) : m_pTree(pTree), 
+                                                                                                                      m_uPosition(uPosition), 
+                                                                                                                      m_eTraversalOrder(eTraversalOrder)
+        {
+            Z_ASSERT_ERROR(pTree != null_z, "Invalid argument: The pointer to the tree cannot be null");
+            Z_ASSERT_ERROR(eTraversalOrder == ETreeTraversalOrder::E_DepthFirstInOrder, string_z("The traversal order specified (") + eTraversalOrder.ToString() + ") is not supported. The only traversal order available is: DepthFirstInOrder.");
+
+            if(pTree == null_z || pTree->IsEmpty())
+                m_uPosition = BTree::END_POSITION_FORWARD;
+        }
+
+
+        // METHODS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Assignment operator that moves the iterator to the same position of other iterator.
+        /// </summary>
+        /// <param name="iterator">[IN] Iterator whose position will be copied. It must point to the same tree as the resident iterator.</param>
+        /// <returns>
+        /// A reference to the resident iterator.
+        /// </returns>
+        ConstBTreeIterator& operator=(const ConstBTreeIterator &iterator)
+        {
+            Z_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid.");
+            Z_ASSERT_ERROR(m_pTree == iterator.m_pTree, "The input iterator points to a different tree");
+
+            if(m_pTree == iterator.m_pTree)
+                m_uPosition = iterator.m_uPosition;
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Indirection operator that returns a reference to the tree element the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A reference to the tree element the iterator points to. If the iterator is invalid or points to an end position,
+        /// the result is undefined.
+        /// </returns>
+        const T& operator*() const
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the reference to the tree element");
+            Z_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the reference to the tree element");
+
+            return *m_pTree->_GetElement(m_uPosition);
+        }
+
+        /// <summary>
+        /// Dereferencing operator that returns a pointer to the tree element the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the tree element the iterator points to. If the iterator is invalid or points to an end position,
+        /// the result is undefined.
+        /// </returns>
+        const T* operator->() const
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the pointer to the tree element");
+            Z_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the pointer to the tree element");
+
+            return m_pTree->_GetElement(m_uPosition);
+        }
+
+        /// <summary>
+        /// Post-increment operator that makes the iterator step forward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// It is not possible to increment an invalid iterator.
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        ConstBTreeIterator operator++(int)
+        {
+            ConstBTreeIterator iteratorCopy = *this;
+            ++(*this);
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Post-decrement operator that makes the iterator step backward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to decrement an iterator that already points to the position before the first element (end position).<br/>
+        /// It is not possible to decrement an invalid iterator.
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        ConstBTreeIterator operator--(int)
+        {
+            ConstBTreeIterator iteratorCopy = *this;
+            --(*this);
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Pre-increment operator that makes the iterator step forward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// It is not possible to increment an invalid iterator.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        ConstBTreeIterator& operator++()
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be incremented");
+            Z_ASSERT_WARNING(m_uPosition != BTree::END_POSITION_FORWARD, "The iterator points to an end position, it is not possible to increment it");
+
+            if(m_uPosition == BTree::END_POSITION_BACKWARD)
+                this->MoveFirst();
+            else if(m_uPosition != BTree::END_POSITION_FORWARD)
+                m_uPosition = m_pTree->_GetNextPosition(m_uPosition);
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Pre-decrement operator that makes the iterator step backward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to decrement an iterator that already points to the position before the first element (end position).<br/>
+        /// It is not possible to decrement an invalid iterator.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        ConstBTreeIterator& operator--()
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be decremented");
+            Z_ASSERT_WARNING(m_uPosition != BTree::END_POSITION_BACKWARD, "The iterator points to an end position, it is not possible to decrement it");
+
+            if(m_uPosition == BTree::END_POSITION_FORWARD)
+            {
+                this->MoveLast();
+
+                if(m_uPosition == BTree::END_POSITION_FORWARD)
+                    m_uPosition = BTree::END_POSITION_BACKWARD;
+            }
+            else if(m_uPosition != BTree::END_POSITION_BACKWARD)
+            {
+                m_uPosition = m_pTree->_GetPreviousPosition(m_uPosition);
+            }
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Equality operator that checks if both iterators are the same.
+        /// </summary>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if they are pointing to the same position of the same tree; False otherwise.
+        /// </returns>
+        bool operator==(const ConstBTreeIterator &iterator) const
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            Z_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            Z_ASSERT_ERROR(m_pTree == iterator.m_pTree, "Iterators point to different trees");
+
+            return m_uPosition == iterator.m_uPosition && m_pTree == iterator.m_pTree;
+        }
+
+        /// <summary>
+        /// Inequality operator that checks if both iterators are different.
+        /// </summary>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if they are pointing to a different position or a different tree; False otherwise.
+        /// </returns>
+        bool operator!=(const ConstBTreeIterator &iterator) const
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            Z_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            Z_ASSERT_ERROR(m_pTree == iterator.m_pTree, "Iterators point to different trees");
+
+            return m_uPosition != iterator.m_uPosition || m_pTree != iterator.m_pTree;
+        }
+
+        /// <summary>
+        /// Greater than operator that checks whether resident iterator points to a more posterior position than the input iterator.
+        /// </summary>
+        /// <remarks>
+        /// Since elements are sorted, their positions are compared by comparing the elements they point to.<br/>
+        /// If iterators point to different trees or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more posterior position than the input iterator; False otherwise.
+        /// </returns>
+        bool operator>(const ConstBTreeIterator &iterator) const
+        {
+            return iterator < *this;
+        }
+
+        /// <summary>
+        /// Lower than operator that checks whether resident iterator points to a more anterior position than the input iterator.
+        /// </summary>
+        /// <remarks>
+        /// Since elements are sorted, their positions are compared by comparing the elements they point to.<br/>
+        /// If iterators point to different trees or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more anterior position than the input iterator; False otherwise.
+        /// </returns>
+        bool operator<(const ConstBTreeIterator &iterator) const
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            Z_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            Z_ASSERT_ERROR(m_pTree == iterator.m_pTree, "Iterators point to different trees");
+
+            bool bResult = false;
+
+            if(m_pTree == iterator.m_pTree && m_uPosition != iterator.m_uPosition)
+            {
+                if(m_uPosition == BTree::END_POSITION_BACKWARD || iterator.m_uPosition == BTree::END_POSITION_FORWARD)
+                    bResult = true;
+                else if(m_uPosition != BTree::END_POSITION_FORWARD && iterator.m_uPosition != BTree::END_POSITION_BACKWARD)
+                    bResult = ComparatorT::Compare(**this, *iterator) < 0;
+            }
+
+            return bResult;
+        }
+
+        /// <summary>
+        /// Greater than or equal to operator that checks whether resident iterator points to a more posterior position than the
+        /// input iterator or to the same position.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different trees or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more posterior position than the input iterator or to the same position; False otherwise.
+        /// </returns>
+        bool operator>=(const ConstBTreeIterator &iterator) const
+        {
+            return !(*this < iterator);
+        }
+
+        /// <summary>
+        /// Lower than or equal to operator that checks whether resident iterator points to a more anterior position than the input 
+        /// iterator or to the same position.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different trees or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more anterior position than the input iterator or to the same position; False otherwise.
+        /// </returns>
+        bool operator<=(const ConstBTreeIterator &iterator) const
+        {
+            return !(iterator < *this);
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to one of the ends of the tree, distinguishing which of them.
+        /// </summary>
+        /// <returns>
+        /// True if the iterator is pointing to the position after the last element or before the first element; False otherwise.
+        /// </returns>
+        bool IsEnd() const
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+
+            return m_uPosition == BTree::END_POSITION_BACKWARD || m_uPosition == BTree::END_POSITION_FORWARD;
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to one of the ends of the tree, distinguishing which of them.
+        /// </summary>
+        /// <param name="eIterationDirection">[IN] The iteration direction used to identify which of the end positions is checked.</param>
+        /// <returns>
+        /// True if the iterator is pointing to the position after the last element when iterating forward or to the position before the first 
+        /// element when iterating backward; False otherwise.
+        /// </returns>
+        bool IsEnd(const EIterationDirection &eIterationDirection) const
+        {
+            Z_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+
+            return (eIterationDirection == EIterationDirection::E_Backward && m_uPosition == BTree::END_POSITION_BACKWARD) ||
+                   (eIterationDirection == EIterationDirection::E_Forward  && m_uPosition == BTree::END_POSITION_FORWARD);
+        }
+
+        /// <summary>
+        /// Moves the iterator to the first (lowest) element.
+        /// </summary>
+        /// <remarks>
+        /// If the tree is empty, the iterator will point to the end position.
+        /// </remarks>
+        void MoveFirst()
+        {
+            m_uPosition = m_pTree->_GetFirstPosition();
+        }
+
+        /// <summary>
+        /// Moves the iterator to the last (greatest) element.
+        /// </summary>
+        /// <remarks>
+        /// If the tree is empty, the iterator will point to the end position.
+        /// </remarks>
+        void MoveLast()
+        {
+            m_uPosition = m_pTree->_GetLastPosition();
+        }
+
+        /// <summary>
+        /// Checks whether the iterator is valid or not.
+        /// </summary>
+        /// <remarks>
+        /// An iterator is considered invalid when it points to a position out of the nodes reserved by the tree.
+        /// </remarks>
+        /// <returns>
+        /// True if the iterator is valid; False otherwise.
+        /// </returns>
+        bool IsValid() const
+        {
+            return m_pTree != null_z && 
+                   (m_uPosition / BTree::MAXIMUM_ELEMENTS < m_pTree->m_nodeAllocator.GetPoolSize() / BTree::NODE_SIZE ||
+                    m_uPosition == BTree::END_POSITION_BACKWARD ||
+                    m_uPosition == BTree::END_POSITION_FORWARD);
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the order in which the elements of the tree are visited.
+        /// </summary>
+        /// <returns>
+        /// The traversal order.
+        /// </returns>
+        ETreeTraversalOrder GetTraversalOrder() const
+        {
+            return m_eTraversalOrder;
+        }
+
+        /// <summary>
+        /// Gets the container that the iterator is traversing.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the tree.
+        /// </returns>
+        const BTree* GetContainer() const
+        {
+            return m_pTree;
+        }
+
+        /// <summary>
+        /// Gets the "physical" position of the element the iterator points to, which combines the position of the node and the position 
+        /// of the element in the node.
+        /// </summary>
+        /// <returns>
+        /// The position of the element the iterator points to.
+        /// </returns>
+        puint_z GetInternalPosition() const
+        {
+            return m_uPosition;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    protected:
+
+        /// <summary>
+        /// The tree the iterator points to.
+        /// </summary>
+        const BTree* m_pTree;
+
+        /// <summary>
+        /// The current iteration position, which combines the position of the node and the position of the element in the node.
+        /// </summary>
+        puint_z m_uPosition;
+
+        /// <summary>
+        /// The order in which elements will be visited.
+        /// </summary>
+        const ETreeTraversalOrder m_eTraversalOrder;
+
+    }; // ConstBTreeIterator
+
+
+    // TYPEDEFS
+    // --------------
+public:
+
+    typedef typename BTree::ConstBTreeIterator ConstIterator;
+
+
+    // CONSTANTS (II)
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Constant to symbolize the end of the sequence when the tree is traversed backward.
+    /// </summary>
+    static const puint_z END_POSITION_BACKWARD = -1;
+
+    /// <summary>
+    /// Constant to symbolize the absence of a node or the end of the sequence when the tree is traversed forward.
+    /// </summary>
+    static const puint_z END_POSITION_FORWARD = -2;
+
+    /// <summary>
+    /// The size of the memory block of every node, which occupies a whole number of cache lines.
+    /// </summary>
+    static const puint_z NODE_SIZE = (sizeof(BTreeNode) + Z_CACHE_LINE_SIZE - 1U) / Z_CACHE_LINE_SIZE * Z_CACHE_LINE_SIZE;
+
+private:
+
+    /// <summary>
+    /// The reallocation factor to be applied to calculate the new number of nodes on every reallocation. It must be greater than or equal to 1.
+    /// </summary>
+    static float REALLOCATION_FACTOR;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    BTree() : m_nodeAllocator(BTree::NODE_SIZE, BTree::NODE_SIZE, Alignment(Z_CACHE_LINE_SIZE)),
+              m_uRoot(BTree::END_POSITION_FORWARD),
+              m_uCount(0),
+              m_pNodeBasePointer(null_z)
+    {
+        m_pNodeBasePointer = scast_z(m_nodeAllocator.GetPointer(), u8_z*);
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory, assuming that nodes are half full. It must be greater than zero.</param>
+    explicit BTree(const puint_z uInitialCapacity) : m_nodeAllocator(BTree::_GetNodeCount(uInitialCapacity) * BTree::NODE_SIZE, BTree::NODE_SIZE, Alignment(Z_CACHE_LINE_SIZE)),
+                                                     m_uRoot(BTree::END_POSITION_FORWARD),
+                                                     m_uCount(0),
+                                                     m_pNodeBasePointer(null_z)
+    {
+        Z_ASSERT_ERROR(uInitialCapacity > 0, "The initial capacity of the tree must be greater than zero.");
+
+        m_pNodeBasePointer = scast_z(m_nodeAllocator.GetPointer(), u8_z*);
+    }
+    
+    /// <summary>
+    /// Copy constructor that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor is called for every copied element, in ascending order. The nodes are copied as they are, so both trees have the same structure.
+    /// </remarks>
+    /// <param name="tree">[IN] The other tree to be copied.</param>
+    BTree(const BTree &tree) : m_nodeAllocator(tree.m_nodeAllocator.GetPoolSize(), BTree::NODE_SIZE, Alignment(Z_CACHE_LINE_SIZE)),
+                               m_uRoot(BTree::END_POSITION_FORWARD),
+                               m_uCount(0),
+                               m_pNodeBasePointer(null_z)
+    {
+        m_pNodeBasePointer = scast_z(m_nodeAllocator.GetPointer(), u8_z*);
+        this->_CopyElementsFrom(tree);
+    }
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every element will be called in ascending order.
+    /// </remarks>
+    ~BTree()
+    {
+        this->_DestroyElements();
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Assignment operator that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// All the elements in the resident tree will be firstly removed, calling each element's destructor.
+    /// The copy constructor is then called for every copied element, in ascending order.
+    /// </remarks>
+    /// <param name="tree">[IN] The other tree to be copied.</param>
+    /// <returns>
+    /// A reference to the resultant tree.
+    /// </returns>
+    BTree& operator=(const BTree &tree)
+    {
+        if(this != &tree)
+        {
+            this->Clear();
+
+            if(m_nodeAllocator.GetPoolSize() < tree.m_nodeAllocator.GetPoolSize())
+                this->_ReserveNodes(tree.m_nodeAllocator.GetPoolSize() / BTree::NODE_SIZE);
+
+            this->_CopyElementsFrom(tree);
+        }
+
+        return *this;
+    }
+    
+    /// <summary>
+    /// Equality operator that checks whether two trees are equal.
+    /// </summary>
+    /// <remarks>
+    /// Every element is compared with the element at the same position in the other tree, in ascending order, using the tree's comparator. 
+    /// The structure of the trees is not compared.
+    /// </remarks>
+    /// <param name="tree">[IN] The tree to compare to.</param>
+    /// <returns>
+    /// True if both trees contain the same elements; False otherwise.
+    /// </returns>
+    bool operator==(const BTree &tree) const
+    {
+        bool bAreEqual = this == &tree;
+
+        if(!bAreEqual && this->GetCount() == tree.GetCount())
+        {
+            BTree::ConstBTreeIterator itThis = this->GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder);
+            BTree::ConstBTreeIterator itInput = tree.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder);
+            bAreEqual = true;
+
+            while(bAreEqual && !itThis.IsEnd())
+            {
+                bAreEqual = ComparatorT::Compare(*itThis, *itInput) == 0;
+                ++itThis;
+                ++itInput;
+            }
+        }
+
+        return bAreEqual;
+    }
+    
+    /// <summary>
+    /// Inequality operator that checks whether two trees are not equal.
+    /// </summary>
+    /// <remarks>
+    /// Every element is compared with the element at the same position in the other tree, in ascending order, using the tree's comparator. 
+    /// The structure of the trees is not compared.
+    /// </remarks>
+    /// <param name="tree">[IN] The tree to compare to.</param>
+    /// <returns>
+    /// True if the trees do not contain the same elements; False otherwise.
+    /// </returns>
+    bool operator!=(const BTree &tree) const
+    {
+        return !this->operator==(tree);
+    }
+
+    /// <summary>
+    /// Increases the capacity of the tree, reserving memory for more elements.
+    /// </summary>
+    /// <remarks>
+    /// The number of nodes reserved is enough to store the elements even if every node is half full.<br/>
+    /// This operation implies a reallocation, which means that any pointer to elements of this tree will be pointing to garbage.
+    /// </remarks>
+    /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void Reserve(const puint_z uNumberOfElements)
+    {
+        this->_ReserveNodes(BTree::_GetNodeCount(uNumberOfElements));
+    }
+    
+    /// <summary>
+    /// Adds an element to the tree, in the leaf that corresponds to its value.
+    /// </summary>
+    /// <remarks>
+    /// Full nodes found while descending from the root are split, so the element always fits in the leaf.<br/>
+    /// This operation may imply a reallocation or moving other elements, which means that any pointer to elements of this tree will be pointing to garbage.<br/>
+    /// The copy constructor of the new element will be called.
+    /// </remarks>
+    /// <param name="newElement">[IN] The value of the new element. There must not be any element in the tree with the same value.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
+    /// <returns>
+    /// An iterator that points to the just added element. If the element was already in the tree, the returned iterator will point to the end position.
+    /// </returns>
+    ConstBTreeIterator Add(const T &newElement, const ETreeTraversalOrder &eTraversalOrder)
+    {
+        puint_z uResultPosition = BTree::END_POSITION_FORWARD;
+
+        if(m_uRoot == BTree::END_POSITION_FORWARD)
+        {
+            m_uRoot = this->_AllocateNode();
+            BTreeNode* pRoot = this->_GetNode(m_uRoot);
+            new(pRoot->GetElements()) T(newElement);
+            pRoot->SetElementCount(1U);
+            ++m_uCount;
+            uResultPosition = m_uRoot * BTree::MAXIMUM_ELEMENTS;
+        }
+        else
+        {
+            // A full root is split, which is the only way the tree grows in height
+            if(this->_GetNode(m_uRoot)->GetElementCount() == BTree::MAXIMUM_ELEMENTS)
+            {
+                const puint_z NEW_ROOT = this->_AllocateNode();
+                this->_GetNode(NEW_ROOT)->GetChildren()[0] = m_uRoot;
+                this->_GetNode(m_uRoot)->SetParent(NEW_ROOT);
+                m_uRoot = NEW_ROOT;
+                this->_SplitChild(NEW_ROOT, 0);
+            }
+
+            puint_z uNode = m_uRoot;
+            bool bExists = false;
+
+            while(!bExists && uResultPosition == BTree::END_POSITION_FORWARD)
+            {
+                BTreeNode* pNode = this->_GetNode(uNode);
+                puint_z uIndex = BTree::_GetLowerBoundInNode(pNode, newElement);
+
+                bExists = uIndex < pNode->GetElementCount() && ComparatorT::Compare(newElement, pNode->GetElements()[uIndex]) == 0;
+
+                if(!bExists)
+                {
+                    if(pNode->IsLeaf())
+                    {
+                        T* arElements = pNode->GetElements();
+                        memmove(arElements + uIndex + 1U, arElements + uIndex, (pNode->GetElementCount() - uIndex) * sizeof(T));
+                        new(arElements + uIndex) T(newElement);
+                        pNode->SetElementCount(pNode->GetElementCount() + 1U);
+                        ++m_uCount;
+                        uResultPosition = uNode * BTree::MAXIMUM_ELEMENTS + uIndex;
+                    }
+                    else
+                    {
+                        // Full children are split before descending, so there is room for the element that may be moved up
+                        if(this->_GetNode(pNode->GetChildren()[uIndex])->GetElementCount() == BTree::MAXIMUM_ELEMENTS)
+                        {
+                            this->_SplitChild(uNode, uIndex);
+                            pNode = this->_GetNode(uNode);
+
+                            const i8_z COMPARISON_RESULT = ComparatorT::Compare(newElement, pNode->GetElements()[uIndex]);
+                            bExists = COMPARISON_RESULT == 0;
+
+                            if(COMPARISON_RESULT > 0)
+                                ++uIndex;
+                        }
+
+                        uNode = pNode->GetChildren()[uIndex];
+                    }
+                }
+            }
+        }
+
+        return BTree::ConstBTreeIterator(this, uResultPosition, eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Deletes an element from the tree.
+    /// </summary>
+    /// <remarks>
+    /// Elements of internal nodes are replaced with their predecessor, which is removed from its leaf. Nodes that keep too few elements 
+    /// borrow one from a sibling or are merged with it, up to the root.<br/>
+    /// The destructor of the element will be called.
+    /// </remarks>
+    /// <param name="elementPosition">[IN] The position of the element to remove. It must not point to the end position.</param>
+    /// <returns>
+    /// An iterator that points to the next element. If the removed element was the last one in the tree, the returned iterator will point to the end position.
+    /// The traversal order of the returned iterator will be the same as the input iterator's.
+    /// </returns>
+    ConstBTreeIterator Remove(const typename BTree::ConstBTreeIterator &elementPosition)
+    {
+        Z_ASSERT_ERROR(!elementPosition.IsEnd(), "The input iterator must not point to an end position.");
+        Z_ASSERT_ERROR(elementPosition.IsValid(), "The input iterator is invalid.");
+        Z_ASSERT_ERROR(!this->IsEmpty(), "The tree is empty, the element does not exist.");
+
+        const puint_z POSITION = elementPosition.GetInternalPosition();
+        const puint_z INDEX = POSITION % BTree::MAXIMUM_ELEMENTS;
+        puint_z uNode = POSITION / BTree::MAXIMUM_ELEMENTS;
+        BTreeNode* pNode = this->_GetNode(uNode);
+
+        // The element is moved out of the tree so its successor can be found once the tree is rebalanced
+        typename boost::aligned_storage<sizeof(T), boost::alignment_of<T>::value>::type removedElement;
+        T* pRemovedElement = rcast_z(&removedElement, T*);
+        memcpy(pRemovedElement, pNode->GetElements() + INDEX, sizeof(T));
+
+        if(pNode->IsLeaf())
+        {
+            T* arElements = pNode->GetElements();
+            memmove(arElements + INDEX, arElements + INDEX + 1U, (pNode->GetElementCount() - INDEX - 1U) * sizeof(T));
+            pNode->SetElementCount(pNode->GetElementCount() - 1U);
+        }
+        else
+        {
+            // The element is replaced with its predecessor, the greatest element of the left subtree, which is always in a leaf
+            puint_z uLeaf = pNode->GetChildren()[INDEX];
+
+            while(!this->_GetNode(uLeaf)->IsLeaf())
+                uLeaf = this->_GetNode(uLeaf)->GetChildren()[this->_GetNode(uLeaf)->GetElementCount()];
+
+            BTreeNode* pLeaf = this->_GetNode(uLeaf);
+            pLeaf->SetElementCount(pLeaf->GetElementCount() - 1U);
+            memcpy(pNode->GetElements() + INDEX, pLeaf->GetElements() + pLeaf->GetElementCount(), sizeof(T));
+            uNode = uLeaf;
+        }
+
+        --m_uCount;
+        this->_Rebalance(uNode);
+
+        const puint_z NEXT_POSITION = this->_GetLowerBoundPosition(*pRemovedElement);
+        pRemovedElement->~T();
+
+        return BTree::ConstBTreeIterator(this, NEXT_POSITION, elementPosition.GetTraversalOrder());
+    }
+    
+    /// <summary>
+    /// Empties the tree.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of each element will be called in ascending order.
+    /// </remarks>
+    void Clear()
+    {
+        this->_DestroyElements();
+        m_nodeAllocator.Clear();
+        m_uRoot = BTree::END_POSITION_FORWARD;
+        m_uCount = 0;
+    }
+    
+    /// <summary>
+    /// Checks whether there is any element in the tree that is equal to other given element.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared to the provided value using the container's comparator.
+    /// </remarks>
+    /// <param name="value">[IN] The value of the element to search for.</param>
+    /// <returns>
+    /// True if the element is present in the tree; False otherwise.
+    /// </returns>
+    bool Contains(const T &value) const
+    {
+        return this->_Find(value) != BTree::END_POSITION_FORWARD;
+    }
+    
+    /// <summary>
+    /// Gets the first (lowest) element in the tree.
+    /// </summary>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited.</param>
+    /// <returns>
+    /// An iterator that points to the first element. If the tree is empty, the iterator will point to the end position.
+    /// </returns>
+    ConstBTreeIterator GetFirst(const ETreeTraversalOrder &eTraversalOrder) const
+    {
+        return BTree::ConstBTreeIterator(this, this->_GetFirstPosition(), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Gets the last (greatest) element in the tree.
+    /// </summary>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited.</param>
+    /// <returns>
+    /// An iterator that points to the last element. If the tree is empty, the iterator will point to the end position.
+    /// </returns>
+    ConstBTreeIterator GetLast(const ETreeTraversalOrder &eTraversalOrder) const
+    {
+        return BTree::ConstBTreeIterator(this, this->_GetLastPosition(), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Gets an iterator that points to a given position in the tree.
+    /// </summary>
+    /// <param name="uIndex">[IN] Position in the tree, starting at zero, to which the iterator will point. It must be lower than the number of elements in the tree.
+    /// If it is out of bounds, the returned iterator will point to the end position.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited.</param>
+    /// <returns>
+    /// An iterator that points to the position of the element.
+    /// </returns>
+    ConstBTreeIterator GetIterator(const puint_z uIndex, const ETreeTraversalOrder &eTraversalOrder) const
+    {
+        Z_ASSERT_ERROR(uIndex < this->GetCount(), "The input index must be lower than the number of elements in the tree.");
+
+        BTree::ConstBTreeIterator itResult = this->GetFirst(eTraversalOrder);
+
+        for(puint_z i = 0; i < uIndex && !itResult.IsEnd(); ++i)
+            ++itResult;
+
+        return itResult;
+    }
+    
+    /// <summary>
+    /// Searches for a given element and obtains its position.
+    /// </summary>
+    /// <param name="element">[IN] The value of the element to search for.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited by the resultant iterator, 
+    /// it does not affect the search.</param>
+    /// <returns>
+    /// An iterator that points to the position of the element. If the element is not present in the tree, the iterator will point to the end position.
+    /// </returns>
+    ConstBTreeIterator PositionOf(const T &element, const ETreeTraversalOrder &eTraversalOrder) const
+    {
+        return BTree::ConstBTreeIterator(this, this->_Find(element), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Searches for the first element that is not lower than a given value.
+    /// </summary>
+    /// <param name="value">[IN] The value to compare the elements to.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited by the resultant iterator.</param>
+    /// <returns>
+    /// An iterator that points to the lowest element that is greater than or equal to the value. If there is no such element, the iterator will 
+    /// point to the end position.
+    /// </returns>
+    ConstBTreeIterator LowerBound(const T &value, const ETreeTraversalOrder &eTraversalOrder) const
+    {
+        return BTree::ConstBTreeIterator(this, this->_GetLowerBoundPosition(value), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Searches for the first element that is greater than a given value.
+    /// </summary>
+    /// <param name="value">[IN] The value to compare the elements to.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited by the resultant iterator.</param>
+    /// <returns>
+    /// An iterator that points to the lowest element that is greater than the value. If there is no such element, the iterator will point to the end position.
+    /// </returns>
+    ConstBTreeIterator UpperBound(const T &value, const ETreeTraversalOrder &eTraversalOrder) const
+    {
+        return BTree::ConstBTreeIterator(this, this->_GetUpperBoundPosition(value), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Gets a copy of the elements whose values are between two given values, both included.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of every copied element will be called.
+    /// </remarks>
+    /// <param name="lowerValue">[IN] The lowest value of the range.</param>
+    /// <param name="upperValue">[IN] The greatest value of the range. It must not be lower than the lowest value.</param>
+    /// <returns>
+    /// A tree that contains the elements of the range.
+    /// </returns>
+    BTree GetRange(const T &lowerValue, const T &upperValue) const
+    {
+        Z_ASSERT_ERROR(ComparatorT::Compare(lowerValue, upperValue) <= 0, "The lowest value of the range must not be greater than the greatest value.");
+
+        BTree range;
+        BTree::ConstBTreeIterator it = this->LowerBound(lowerValue, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+        for(; !it.IsEnd() && ComparatorT::Compare(*it, upperValue) <= 0; ++it)
+            range.Add(*it, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+        return range;
+    }
+    
+    /// <summary>
+    /// Performs a shallow copy of the contents of the tree to another tree.
+    /// </summary>
+    /// <remarks>
+    /// Care must be taken when instances store pointers to other objects (like strings do); cloning such types may lead to hard-to-debug errors.<br/>
+    /// If the capacity of the destination tree is lower than the resident's, it will reserve more memory before the copy takes place.<br/>
+    /// No constructors will be called during this operation.
+    /// </remarks>
+    /// <param name="destinationTree">[IN/OUT] The destination tree to which the contents will be copied.</param>
+    void Clone(BTree &destinationTree) const
+    {
+        if(destinationTree.m_nodeAllocator.GetPoolSize() < m_nodeAllocator.GetPoolSize())
+            destinationTree._ReserveNodes(m_nodeAllocator.GetPoolSize() / BTree::NODE_SIZE);
+
+        m_nodeAllocator.CopyTo(destinationTree.m_nodeAllocator);
+        destinationTree.m_uRoot = m_uRoot;
+        destinationTree.m_uCount = m_uCount;
+    }
+    
+    /// <summary>
+    /// Exchanges the elements and the capacity of two trees.
+    /// </summary>
+    /// <remarks>
+    /// It is the cheapest way to transfer the content of a tree to another, since neither copy constructors, nor assignment operators nor destructors 
+    /// are called and no memory is copied, regardless of the number of elements.<br/>
+    /// Pointers to elements remain valid, although they will point to elements of the other tree. Iterators keep pointing to the same tree and 
+    /// positions, so they may become invalid.
+    /// </remarks>
+    /// <param name="inputTree">[IN/OUT] The tree whose elements will be exchanged with the resident tree's. It can be the resident tree.</param>
+    void Swap(BTree &inputTree)
+    {
+        m_nodeAllocator.Swap(inputTree.m_nodeAllocator);
+
+        const puint_z ROOT = m_uRoot;
+        m_uRoot = inputTree.m_uRoot;
+        inputTree.m_uRoot = ROOT;
+
+        const puint_z COUNT = m_uCount;
+        m_uCount = inputTree.m_uCount;
+        inputTree.m_uCount = COUNT;
+
+        m_pNodeBasePointer = scast_z(m_nodeAllocator.GetPointer(), u8_z*);
+        inputTree.m_pNodeBasePointer = scast_z(inputTree.m_nodeAllocator.GetPointer(), u8_z*);
+    }
+    
+    /// <summary>
+    /// Replaces the content of the tree with a sequence of sorted elements, building a tree of the minimum height in linear time.
+    /// </summary>
+    /// <remarks>
+    /// All the elements in the resident tree will be firstly removed, calling each element's destructor.<br/>
+    /// Memory is reserved only once, if the capacity is not enough, and elements are distributed evenly among the nodes of every level.<br/>
+    /// The copy constructor of every element will be called, in ascending order.
+    /// </remarks>
+    /// <param name="arElements">[IN] The elements to store, sorted in ascending order according to the tree's comparator. There must not be 
+    /// repeated elements. It must not be null unless the number of elements is zero.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    void BuildFromSorted(const T* arElements, const puint_z uNumberOfElements)
+    {
+        Z_ASSERT_ERROR(arElements != null_z || uNumberOfElements == 0, "The input sequence of elements cannot be null.");
+
+        for(puint_z i = 1U; i < uNumberOfElements; ++i)
+        {
+            Z_ASSERT_ERROR(ComparatorT::Compare(arElements[i - 1U], arElements[i]) < 0, "The input elements must be sorted in ascending order and must not be repeated.");
+        }
+
+        this->Clear();
+
+        if(uNumberOfElements > 0)
+        {
+            this->_ReserveNodes(BTree::_GetNodeCount(uNumberOfElements));
+
+            // The capacity of a tree of height H is (MAXIMUM_ELEMENTS + 1)^H - 1
+            puint_z uHeight = 1U;
+            puint_z uCapacity = BTree::MAXIMUM_ELEMENTS;
+
+            while(uCapacity < uNumberOfElements)
+            {
+                uCapacity = uCapacity * (BTree::MAXIMUM_ELEMENTS + 1U) + BTree::MAXIMUM_ELEMENTS;
+                ++uHeight;
+            }
+
+            m_uRoot = this->_BuildSubtree(arElements, uNumberOfElements, uHeight, uCapacity, BTree::END_POSITION_FORWARD);
+            m_uCount = uNumberOfElements;
+        }
+    }
+    
+private:
+
+    /// <summary>
+    /// Gets the number of nodes needed to store a number of elements when every node is half full.
+    /// </summary>
+    /// <param name="uNumberOfElements">[IN] The number of elements.</param>
+    /// <returns>
+    /// The number of nodes.
+    /// </returns>
+    static puint_z _GetNodeCount(const puint_z uNumberOfElements)
+    {
+        return uNumberOfElements / BTree::MINIMUM_ELEMENTS + 1U;
+    }
+
+    /// <summary>
+    /// Searches for the position, in a node, of the first element that is not lower than a given value, using a binary search.
+    /// </summary>
+    /// <param name="pNode">[IN] The node whose elements are searched.</param>
+    /// <param name="value">[IN] The value to compare the elements to.</param>
+    /// <returns>
+    /// The position of the element in the node. It equals the number of elements of the node if all of them are lower than the value.
+    /// </returns>
+    static puint_z _GetLowerBoundInNode(const BTreeNode* pNode, const T &value)
+    {
+        const T* arElements = pNode->GetElements();
+        puint_z uFirst = 0;
+        puint_z uCount = pNode->GetElementCount();
+
+        while(uCount > 0)
+        {
+            const puint_z HALF = uCount / 2U;
+
+            if(ComparatorT::Compare(arElements[uFirst + HALF], value) < 0)
+            {
+                uFirst += HALF + 1U;
+                uCount -= HALF + 1U;
+            }
+            else
+            {
+                uCount = HALF;
+            }
+        }
+
+        return uFirst;
+    }
+
+    /// <summary>
+    /// Searches for the position, in a node, of the first element that is greater than a given value, using a binary search.
+    /// </summary>
+    /// <param name="pNode">[IN] The node whose elements are searched.</param>
+    /// <param name="value">[IN] The value to compare the elements to.</param>
+    /// <returns>
+    /// The position of the element in the node. It equals the number of elements of the node if none of them is greater than the value.
+    /// </returns>
+    static puint_z _GetUpperBoundInNode(const BTreeNode* pNode, const T &value)
+    {
+        const T* arElements = pNode->GetElements();
+        puint_z uFirst = 0;
+        puint_z uCount = pNode->GetElementCount();
+
+        while(uCount > 0)
+        {
+            const puint_z HALF = uCount / 2U;
+
+            if(ComparatorT::Compare(arElements[uFirst + HALF], value) <= 0)
+            {
+                uFirst += HALF + 1U;
+                uCount -= HALF + 1U;
+            }
+            else
+            {
+                uCount = HALF;
+            }
+        }
+
+        return uFirst;
+    }
+
+    /// <summary>
+    /// Gets a node from its position.
+    /// </summary>
+    /// <param name="uNode">[IN] The position of the node.</param>
+    /// <returns>
+    /// A pointer to the node.
+    /// </returns>
+    BTreeNode* _GetNode(const puint_z uNode) const
+    {
+        return rcast_z(m_pNodeBasePointer + uNode * BTree::NODE_SIZE, BTreeNode*);
+    }
+
+    /// <summary>
+    /// Gets an element from its position.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element, which combines the position of the node and the position of the element in the node.</param>
+    /// <returns>
+    /// A pointer to the element.
+    /// </returns>
+    const T* _GetElement(const puint_z uPosition) const
+    {
+        return this->_GetNode(uPosition / BTree::MAXIMUM_ELEMENTS)->GetElements() + uPosition % BTree::MAXIMUM_ELEMENTS;
+    }
+
+    /// <summary>
+    /// Gets the position of a node among the children of its parent.
+    /// </summary>
+    /// <param name="pParent">[IN] The parent node.</param>
+    /// <param name="uChild">[IN] The position of the child node.</param>
+    /// <returns>
+    /// The index of the child in the parent.
+    /// </returns>
+    static puint_z _GetChildIndex(const BTreeNode* pParent, const puint_z uChild)
+    {
+        const puint_z* arChildren = pParent->GetChildren();
+        puint_z uIndex = 0;
+
+        while(arChildren[uIndex] != uChild)
+            ++uIndex;
+
+        return uIndex;
+    }
+
+    /// <summary>
+    /// Allocates a node with no elements and no children, increasing the number of nodes of the tree if necessary.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, so pointers to other nodes must be obtained again.
+    /// </remarks>
+    /// <returns>
+    /// The position of the node.
+    /// </returns>
+    puint_z _AllocateNode()
+    {
+        if(!m_nodeAllocator.CanAllocate())
+            this->_ReallocateByFactor(m_nodeAllocator.GetPoolSize() / BTree::NODE_SIZE + 1U);
+
+        const puint_z NODE = (scast_z(m_nodeAllocator.Allocate(), u8_z*) - m_pNodeBasePointer) / BTree::NODE_SIZE;
+        this->_GetNode(NODE)->Reset();
+        return NODE;
+    }
+
+    /// <summary>
+    /// Increases the number of nodes of the tree.
+    /// </summary>
+    /// <param name="uNumberOfNodes">[IN] The number of nodes for which to reserve memory. It should be greater than the
+    /// current number of nodes or nothing will happen.</param>
+    void _ReserveNodes(const puint_z uNumberOfNodes)
+    {
+        if(uNumberOfNodes * BTree::NODE_SIZE > m_nodeAllocator.GetPoolSize())
+        {
+            m_nodeAllocator.Reallocate(uNumberOfNodes * BTree::NODE_SIZE);
+            m_pNodeBasePointer = scast_z(m_nodeAllocator.GetPointer(), u8_z*);
+        }
+    }
+
+    /// <summary>
+    /// Increases the number of nodes of the tree, reserving memory for more nodes than necessary, depending on the reallocation factor.
+    /// </summary>
+    /// <param name="uNumberOfNodes">[IN] The number of nodes for which to reserve memory. It should be greater than the
+    /// current number of nodes or nothing will happen.</param>
+    void _ReallocateByFactor(const puint_z uNumberOfNodes)
+    {
+        const puint_z FINAL_NODE_COUNT = scast_z(scast_z(uNumberOfNodes, float) * BTree::REALLOCATION_FACTOR, puint_z);
+        this->_ReserveNodes(FINAL_NODE_COUNT);
+    }
+
+    /// <summary>
+    /// Creates a subtree that contains a sequence of sorted elements, whose leaves are all at the same given height.
+    /// </summary>
+    /// <remarks>
+    /// Every node has, at least, the minimum number of children (2 for the root) and elements are distributed as evenly as possible among them.
+    /// </remarks>
+    /// <param name="arElements">[IN] The sorted elements to store.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements. It must not be greater than the capacity of the subtree.</param>
+    /// <param name="uHeight">[IN] The height of the subtree, being 1 for a leaf.</param>
+    /// <param name="uCapacity">[IN] The maximum number of elements that fit in a subtree of such height.</param>
+    /// <param name="uParent">[IN] The position of the parent node, or the end position if the subtree is the whole tree.</param>
+    /// <returns>
+    /// The position of the root node of the subtree.
+    /// </returns>
+    puint_z _BuildSubtree(const T* arElements, const puint_z uNumberOfElements, const puint_z uHeight, const puint_z uCapacity, const puint_z uParent)
+    {
+        const puint_z NODE = this->_AllocateNode();
+        this->_GetNode(NODE)->SetParent(uParent);
+
+        if(uHeight == 1U)
+        {
+            T* arNodeElements = this->_GetNode(NODE)->GetElements();
+
+            for(puint_z i = 0; i < uNumberOfElements; ++i)
+                new(arNodeElements + i) T(arElements[i]);
+
+            this->_GetNode(NODE)->SetElementCount(uNumberOfElements);
+        }
+        else
+        {
+            const puint_z SUBTREE_CAPACITY = (uCapacity - BTree::MAXIMUM_ELEMENTS) / (BTree::MAXIMUM_ELEMENTS + 1U);
+
+            // The fewest children that can hold the elements, but never less than the minimum allowed for a non-root node
+            puint_z uChildren = (uNumberOfElements + SUBTREE_CAPACITY + 1U) / (SUBTREE_CAPACITY + 1U);
+
+            if(uParent != BTree::END_POSITION_FORWARD && uChildren < BTree::MINIMUM_DEGREE)
+                uChildren = BTree::MINIMUM_DEGREE;
+
+            const puint_z ELEMENTS_IN_CHILDREN = uNumberOfElements - (uChildren - 1U);
+            puint_z uElement = 0;
+
+            for(puint_z i = 0; i < uChildren; ++i)
+            {
+                const puint_z CHILD_ELEMENTS = ELEMENTS_IN_CHILDREN / uChildren + (i < ELEMENTS_IN_CHILDREN % uChildren ? 1U : 0);
+                const puint_z CHILD = this->_BuildSubtree(arElements + uElement, CHILD_ELEMENTS, uHeight - 1U, SUBTREE_CAPACITY, NODE);
+                uElement += CHILD_ELEMENTS;
+
+                // The pointer is obtained after building the child, as allocating nodes may imply a reallocation
+                BTreeNode* pNode = this->_GetNode(NODE);
+                pNode->GetChildren()[i] = CHILD;
+
+                if(i < uChildren - 1U)
+                {
+                    new(pNode->GetElements() + i) T(arElements[uElement]);
+                    ++uElement;
+                }
+            }
+
+            this->_GetNode(NODE)->SetElementCount(uChildren - 1U);
+        }
+
+        return NODE;
+    }
+
+    /// <summary>
+    /// Splits a full child of a node into two nodes, moving its median element to the node.
+    /// </summary>
+    /// <remarks>
+    /// The node must not be full.
+    /// </remarks>
+    /// <param name="uParent">[IN] The position of the node whose child is split.</param>
+    /// <param name="uChildIndex">[IN] The index of the child in the node.</param>
+    void _SplitChild(const puint_z uParent, const puint_z uChildIndex)
+    {
+        const puint_z RIGHT = this->_AllocateNode();
+        BTreeNode* pParent = this->_GetNode(uParent);
+        BTreeNode* pLeft = this->_GetNode(pParent->GetChildren()[uChildIndex]);
+        BTreeNode* pRight = this->_GetNode(RIGHT);
+
+        // The greatest half of the elements and children are moved to the new node
+        memcpy(pRight->GetElements(), pLeft->GetElements() + BTree::MINIMUM_DEGREE, BTree::MINIMUM_ELEMENTS * sizeof(T));
+
+        if(!pLeft->IsLeaf())
+        {
+            memcpy(pRight->GetChildren(), pLeft->GetChildren() + BTree::MINIMUM_DEGREE, BTree::MINIMUM_DEGREE * sizeof(puint_z));
+
+            for(puint_z i = 0; i < BTree::MINIMUM_DEGREE; ++i)
+                this->_GetNode(pRight->GetChildren()[i])->SetParent(RIGHT);
+        }
+
+        pRight->SetElementCount(BTree::MINIMUM_ELEMENTS);
+        pRight->SetParent(uParent);
+
+        // The median element is moved to the parent, followed by the new node
+        T* arParentElements = pParent->GetElements();
+        puint_z* arParentChildren = pParent->GetChildren();
+        const puint_z PARENT_COUNT = pParent->GetElementCount();
+        memmove(arParentElements + uChildIndex + 1U, arParentElements + uChildIndex, (PARENT_COUNT - uChildIndex) * sizeof(T));
+        memmove(arParentChildren + uChildIndex + 2U, arParentChildren + uChildIndex + 1U, (PARENT_COUNT - uChildIndex) * sizeof(puint_z));
+        memcpy(arParentElements + uChildIndex, pLeft->GetElements() + BTree::MINIMUM_ELEMENTS, sizeof(T));
+        arParentChildren[uChildIndex + 1U] = RIGHT;
+        pParent->SetElementCount(PARENT_COUNT + 1U);
+
+        pLeft->SetElementCount(BTree::MINIMUM_ELEMENTS);
+    }
+
+    /// <summary>
+    /// Restores the minimum number of elements of a node after one was removed, borrowing an element from a sibling or merging the node with 
+    /// it; merges may propagate to the root, which is removed when it becomes empty.
+    /// </summary>
+    /// <param name="uNode">[IN] The position of the node one of whose elements was removed.</param>
+    void _Rebalance(const puint_z uNode)
+    {
+        puint_z uCurrent = uNode;
+        bool bIsBalanced = false;
+
+        while(!bIsBalanced)
+        {
+            BTreeNode* pNode = this->_GetNode(uCurrent);
+
+            if(uCurrent == m_uRoot)
+            {
+                // An empty root is replaced with its only child, or the tree becomes empty
+                if(pNode->GetElementCount() == 0)
+                {
+                    m_uRoot = pNode->IsLeaf() ? BTree::END_POSITION_FORWARD : pNode->GetChildren()[0];
+
+                    if(m_uRoot != BTree::END_POSITION_FORWARD)
+                        this->_GetNode(m_uRoot)->SetParent(BTree::END_POSITION_FORWARD);
+
+                    m_nodeAllocator.Deallocate(pNode);
+                }
+
+                bIsBalanced = true;
+            }
+            else if(pNode->GetElementCount() >= BTree::MINIMUM_ELEMENTS)
+            {
+                bIsBalanced = true;
+            }
+            else
+            {
+                const puint_z PARENT = pNode->GetParent();
+                BTreeNode* pParent = this->_GetNode(PARENT);
+                const puint_z CHILD_INDEX = BTree::_GetChildIndex(pParent, uCurrent);
+
+                if(CHILD_INDEX > 0 && this->_GetNode(pParent->GetChildren()[CHILD_INDEX - 1U])->GetElementCount() > BTree::MINIMUM_ELEMENTS)
+                {
+                    this->_RotateRight(PARENT, CHILD_INDEX - 1U);
+                    bIsBalanced = true;
+                }
+                else if(CHILD_INDEX < pParent->GetElementCount() && this->_GetNode(pParent->GetChildren()[CHILD_INDEX + 1U])->GetElementCount() > BTree::MINIMUM_ELEMENTS)
+                {
+                    this->_RotateLeft(PARENT, CHILD_INDEX);
+                    bIsBalanced = true;
+                }
+                else
+                {
+                    this->_Merge(PARENT, CHILD_INDEX > 0 ? CHILD_INDEX - 1U : CHILD_INDEX);
+                    uCurrent = PARENT;
+                }
+            }
+        }
+    }
+
+    /// <summary>
+    /// Moves the greatest element of a child to its parent and the separator element of the parent to the next child.
+    /// </summary>
+    /// <param name="uParent">[IN] The position of the parent node.</param>
+    /// <param name="uSeparatorIndex">[IN] The index of the element of the parent that separates both children.</param>
+    void _RotateRight(const puint_z uParent, const puint_z uSeparatorIndex)
+    {
+        BTreeNode* pParent = this->_GetNode(uParent);
+        const puint_z RIGHT = pParent->GetChildren()[uSeparatorIndex + 1U];
+        BTreeNode* pLeft = this->_GetNode(pParent->GetChildren()[uSeparatorIndex]);
+        BTreeNode* pRight = this->_GetNode(RIGHT);
+        const puint_z LEFT_COUNT = pLeft->GetElementCount();
+        const puint_z RIGHT_COUNT = pRight->GetElementCount();
+
+        memmove(pRight->GetElements() + 1U, pRight->GetElements(), RIGHT_COUNT * sizeof(T));
+        memcpy(pRight->GetElements(), pParent->GetElements() + uSeparatorIndex, sizeof(T));
+        memcpy(pParent->GetElements() + uSeparatorIndex, pLeft->GetElements() + LEFT_COUNT - 1U, sizeof(T));
+
+        if(!pRight->IsLeaf())
+        {
+            memmove(pRight->GetChildren() + 1U, pRight->GetChildren(), (RIGHT_COUNT + 1U) * sizeof(puint_z));
+            pRight->GetChildren()[0] = pLeft->GetChildren()[LEFT_COUNT];
+            pLeft->GetChildren()[LEFT_COUNT] = BTree::END_POSITION_FORWARD;
+            this->_GetNode(pRight->GetChildren()[0])->SetParent(RIGHT);
+        }
+
+        pLeft->SetElementCount(LEFT_COUNT - 1U);
+        pRight->SetElementCount(RIGHT_COUNT + 1U);
+    }
+
+    /// <summary>
+    /// Moves the lowest element of a child to its parent and the separator element of the parent to the previous child.
+    /// </summary>
+    /// <param name="uParent">[IN] The position of the parent node.</param>
+    /// <param name="uSeparatorIndex">[IN] The index of the element of the parent that separates both children.</param>
+    void _RotateLeft(const puint_z uParent, const puint_z uSeparatorIndex)
+    {
+        BTreeNode* pParent = this->_GetNode(uParent);
+        const puint_z LEFT = pParent->GetChildren()[uSeparatorIndex];
+        BTreeNode* pLeft = this->_GetNode(LEFT);
+        BTreeNode* pRight = this->_GetNode(pParent->GetChildren()[uSeparatorIndex + 1U]);
+        const puint_z LEFT_COUNT = pLeft->GetElementCount();
+        const puint_z RIGHT_COUNT = pRight->GetElementCount();
+
+        memcpy(pLeft->GetElements() + LEFT_COUNT, pParent->GetElements() + uSeparatorIndex, sizeof(T));
+        memcpy(pParent->GetElements() + uSeparatorIndex, pRight->GetElements(), sizeof(T));
+        memmove(pRight->GetElements(), pRight->GetElements() + 1U, (RIGHT_COUNT - 1U) * sizeof(T));
+
+        if(!pLeft->IsLeaf())
+        {
+            pLeft->GetChildren()[LEFT_COUNT + 1U] = pRight->GetChildren()[0];
+            this->_GetNode(pRight->GetChildren()[0])->SetParent(LEFT);
+            memmove(pRight->GetChildren(), pRight->GetChildren() + 1U, RIGHT_COUNT * sizeof(puint_z));
+            pRight->GetChildren()[RIGHT_COUNT] = BTree::END_POSITION_FORWARD;
+        }
+
+        pLeft->SetElementCount(LEFT_COUNT + 1U);
+        pRight->SetElementCount(RIGHT_COUNT - 1U);
+    }
+
+    /// <summary>
+    /// Merges two children and their separator element into the first child, removing the second child.
+    /// </summary>
+    /// <param name="uParent">[IN] The position of the parent node.</param>
+    /// <param name="uSeparatorIndex">[IN] The index of the element of the parent that separates both children.</param>
+    void _Merge(const puint_z uParent, const puint_z uSeparatorIndex)
+    {
+        BTreeNode* pParent = this->_GetNode(uParent);
+        const puint_z LEFT = pParent->GetChildren()[uSeparatorIndex];
+        BTreeNode* pLeft = this->_GetNode(LEFT);
+        BTreeNode* pRight = this->_GetNode(pParent->GetChildren()[uSeparatorIndex + 1U]);
+        const puint_z LEFT_COUNT = pLeft->GetElementCount();
+        const puint_z RIGHT_COUNT = pRight->GetElementCount();
+        const puint_z PARENT_COUNT = pParent->GetElementCount();
+
+        memcpy(pLeft->GetElements() + LEFT_COUNT, pParent->GetElements() + uSeparatorIndex, sizeof(T));
+        memcpy(pLeft->GetElements() + LEFT_COUNT + 1U, pRight->GetElements(), RIGHT_COUNT * sizeof(T));
+
+        if(!pLeft->IsLeaf())
+        {
+            memcpy(pLeft->GetChildren() + LEFT_COUNT + 1U, pRight->GetChildren(), (RIGHT_COUNT + 1U) * sizeof(puint_z));
+
+            for(puint_z i = LEFT_COUNT + 1U; i <= LEFT_COUNT + 1U + RIGHT_COUNT; ++i)
+                this->_GetNode(pLeft->GetChildren()[i])->SetParent(LEFT);
+        }
+
+        pLeft->SetElementCount(LEFT_COUNT + 1U + RIGHT_COUNT);
+
+        memmove(pParent->GetElements() + uSeparatorIndex, pParent->GetElements() + uSeparatorIndex + 1U, (PARENT_COUNT - uSeparatorIndex - 1U) * sizeof(T));
+        memmove(pParent->GetChildren() + uSeparatorIndex + 1U, pParent->GetChildren() + uSeparatorIndex + 2U, (PARENT_COUNT - uSeparatorIndex - 1U) * sizeof(puint_z));
+        pParent->GetChildren()[PARENT_COUNT] = BTree::END_POSITION_FORWARD;
+        pParent->SetElementCount(PARENT_COUNT - 1U);
+
+        m_nodeAllocator.Deallocate(pRight);
+    }
+
+    /// <summary>
+    /// Searches for an element.
+    /// </summary>
+    /// <param name="value">[IN] The value of the element to search for.</param>
+    /// <returns>
+    /// The position of the element, or the end position if it is not present in the tree.
+    /// </returns>
+    puint_z _Find(const T &value) const
+    {
+        puint_z uResultPosition = BTree::END_POSITION_FORWARD;
+        puint_z uNode = m_uRoot;
+
+        while(uNode != BTree::END_POSITION_FORWARD)
+        {
+            const BTreeNode* pNode = this->_GetNode(uNode);
+            const puint_z INDEX = BTree::_GetLowerBoundInNode(pNode, value);
+
+            if(INDEX < pNode->GetElementCount() && ComparatorT::Compare(value, pNode->GetElements()[INDEX]) == 0)
+            {
+                uResultPosition = uNode * BTree::MAXIMUM_ELEMENTS + INDEX;
+                uNode = BTree::END_POSITION_FORWARD;
+            }
+            else
+            {
+                uNode = pNode->GetChildren()[INDEX];
+            }
+        }
+
+        return uResultPosition;
+    }
+
+    /// <summary>
+    /// Searches for the first element that is not lower than a given value.
+    /// </summary>
+    /// <param name="value">[IN] The value to compare the elements to.</param>
+    /// <returns>
+    /// The position of the element, or the end position if there is no such element.
+    /// </returns>
+    puint_z _GetLowerBoundPosition(const T &value) const
+    {
+        puint_z uResultPosition = BTree::END_POSITION_FORWARD;
+        puint_z uNode = m_uRoot;
+
+        // The last element found while descending that is not lower than the value is the lowest one
+        while(uNode != BTree::END_POSITION_FORWARD)
+        {
+            const BTreeNode* pNode = this->_GetNode(uNode);
+            const puint_z INDEX = BTree::_GetLowerBoundInNode(pNode, value);
+
+            if(INDEX < pNode->GetElementCount())
+                uResultPosition = uNode * BTree::MAXIMUM_ELEMENTS + INDEX;
+
+            uNode = pNode->GetChildren()[INDEX];
+        }
+
+        return uResultPosition;
+    }
+
+    /// <summary>
+    /// Searches for the first element that is greater than a given value.
+    /// </summary>
+    /// <param name="value">[IN] The value to compare the elements to.</param>
+    /// <returns>
+    /// The position of the element, or the end position if there is no such element.
+    /// </returns>
+    puint_z _GetUpperBoundPosition(const T &value) const
+    {
+        puint_z uResultPosition = BTree::END_POSITION_FORWARD;
+        puint_z uNode = m_uRoot;
+
+        // The last element found while descending that is greater than the value is the lowest one
+        while(uNode != BTree::END_POSITION_FORWARD)
+        {
+            const BTreeNode* pNode = this->_GetNode(uNode);
+            const puint_z INDEX = BTree::_GetUpperBoundInNode(pNode, value);
+
+            if(INDEX < pNode->GetElementCount())
+                uResultPosition = uNode * BTree::MAXIMUM_ELEMENTS + INDEX;
+
+            uNode = pNode->GetChildren()[INDEX];
+        }
+
+        return uResultPosition;
+    }
+
+    /// <summary>
+    /// Gets the position of the lowest element, which is the first element of the leftmost leaf.
+    /// </summary>
+    /// <returns>
+    /// The position of the element, or the end position if the tree is empty.
+    /// </returns>
+    puint_z _GetFirstPosition() const
+    {
+        puint_z uResultPosition = BTree::END_POSITION_FORWARD;
+
+        if(m_uRoot != BTree::END_POSITION_FORWARD)
+        {
+            puint_z uNode = m_uRoot;
+
+            while(!this->_GetNode(uNode)->IsLeaf())
+                uNode = this->_GetNode(uNode)->GetChildren()[0];
+
+            uResultPosition = uNode * BTree::MAXIMUM_ELEMENTS;
+        }
+
+        return uResultPosition;
+    }
+
+    /// <summary>
+    /// Gets the position of the greatest element, which is the last element of the rightmost leaf.
+    /// </summary>
+    /// <returns>
+    /// The position of the element, or the end position if the tree is empty.
+    /// </returns>
+    puint_z _GetLastPosition() const
+    {
+        puint_z uResultPosition = BTree::END_POSITION_FORWARD;
+
+        if(m_uRoot != BTree::END_POSITION_FORWARD)
+        {
+            puint_z uNode = m_uRoot;
+
+            while(!this->_GetNode(uNode)->IsLeaf())
+                uNode = this->_GetNode(uNode)->GetChildren()[this->_GetNode(uNode)->GetElementCount()];
+
+            uResultPosition = uNode * BTree::MAXIMUM_ELEMENTS + this->_GetNode(uNode)->GetElementCount() - 1U;
+        }
+
+        return uResultPosition;
+    }
+
+    /// <summary>
+    /// Gets the position of the element that follows another one.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of an element.</param>
+    /// <returns>
+    /// The position of the next element, or the forward end position if the element is the greatest one.
+    /// </returns>
+    puint_z _GetNextPosition(const puint_z uPosition) const
+    {
+        puint_z uNode = uPosition / BTree::MAXIMUM_ELEMENTS;
+        const puint_z INDEX = uPosition % BTree::MAXIMUM_ELEMENTS;
+        const BTreeNode* pNode = this->_GetNode(uNode);
+        puint_z uResultPosition = BTree::END_POSITION_FORWARD;
+
+        if(!pNode->IsLeaf())
+        {
+            // The lowest element of the right subtree
+            uNode = pNode->GetChildren()[INDEX + 1U];
+
+            while(!this->_GetNode(uNode)->IsLeaf())
+                uNode = this->_GetNode(uNode)->GetChildren()[0];
+
+            uResultPosition = uNode * BTree::MAXIMUM_ELEMENTS;
+        }
+        else if(INDEX + 1U < pNode->GetElementCount())
+        {
+            uResultPosition = uPosition + 1U;
+        }
+        else
+        {
+            // The first ancestor reached from a child that is not its last one
+            while(uResultPosition == BTree::END_POSITION_FORWARD && pNode->GetParent() != BTree::END_POSITION_FORWARD)
+            {
+                const puint_z PARENT = pNode->GetParent();
+                const BTreeNode* pParent = this->_GetNode(PARENT);
+                const puint_z CHILD_INDEX = BTree::_GetChildIndex(pParent, uNode);
+
+                if(CHILD_INDEX < pParent->GetElementCount())
+                    uResultPosition = PARENT * BTree::MAXIMUM_ELEMENTS + CHILD_INDEX;
+
+                uNode = PARENT;
+                pNode = pParent;
+            }
+        }
+
+        return uResultPosition;
+    }
+
+    /// <summary>
+    /// Gets the position of the element that precedes another one.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of an element.</param>
+    /// <returns>
+    /// The position of the previous element, or the backward end position if the element is the lowest one.
+    /// </returns>
+    puint_z _GetPreviousPosition(const puint_z uPosition) const
+    {
+        puint_z uNode = uPosition / BTree::MAXIMUM_ELEMENTS;
+        const puint_z INDEX = uPosition % BTree::MAXIMUM_ELEMENTS;
+        const BTreeNode* pNode = this->_GetNode(uNode);
+        puint_z uResultPosition = BTree::END_POSITION_BACKWARD;
+
+        if(!pNode->IsLeaf())
+        {
+            // The greatest element of the left subtree
+            uNode = pNode->GetChildren()[INDEX];
+
+            while(!this->_GetNode(uNode)->IsLeaf())
+                uNode = this->_GetNode(uNode)->GetChildren()[this->_GetNode(uNode)->GetElementCount()];
+
+            uResultPosition = uNode * BTree::MAXIMUM_ELEMENTS + this->_GetNode(uNode)->GetElementCount() - 1U;
+        }
+        else if(INDEX > 0)
+        {
+            uResultPosition = uPosition - 1U;
+        }
+        else
+        {
+            // The first ancestor reached from a child that is not its first one
+            while(uResultPosition == BTree::END_POSITION_BACKWARD && pNode->GetParent() != BTree::END_POSITION_FORWARD)
+            {
+                const puint_z PARENT = pNode->GetParent();
+                const BTreeNode* pParent = this->_GetNode(PARENT);
+                const puint_z CHILD_INDEX = BTree::_GetChildIndex(pParent, uNode);
+
+                if(CHILD_INDEX > 0)
+                    uResultPosition = PARENT * BTree::MAXIMUM_ELEMENTS + CHILD_INDEX - 1U;
+
+                uNode = PARENT;
+                pNode = pParent;
+            }
+        }
+
+        return uResultPosition;
+    }
+
+    /// <summary>
+    /// Copies the nodes of another tree and calls the copy constructor of every element. The resident tree must be empty and have, at least, 
+    /// the same number of nodes.
+    /// </summary>
+    /// <param name="tree">[IN] The tree to copy.</param>
+    void _CopyElementsFrom(const BTree &tree)
+    {
+        if(!tree.IsEmpty())
+        {
+            tree.m_nodeAllocator.CopyTo(m_nodeAllocator);
+            m_uRoot = tree.m_uRoot;
+            m_uCount = tree.m_uCount;
+
+            for(puint_z uPosition = tree._GetFirstPosition(); uPosition != BTree::END_POSITION_FORWARD; uPosition = tree._GetNextPosition(uPosition))
+                new(ccast_z(this->_GetElement(uPosition), T*)) T(*tree._GetElement(uPosition));
+        }
+    }
+
+    /// <summary>
+    /// Calls the destructor of every element, in ascending order.
+    /// </summary>
+    void _DestroyElements()
+    {
+        for(puint_z uPosition = this->_GetFirstPosition(); uPosition != BTree::END_POSITION_FORWARD; uPosition = this->_GetNextPosition(uPosition))
+            this->_GetElement(uPosition)->~T();
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the node allocator.
+    /// </summary>
+    /// <returns>
+    /// The node allocator.
+    /// </returns>
+    const AllocatorT* GetAllocator() const
+    {
+        return &m_nodeAllocator;
+    }
+
+    /// <summary>
+    /// Gets the capacity of the tree, which means the number of elements that the reserved nodes could store if they were full.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the tree.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_nodeAllocator.GetPoolSize() / BTree::NODE_SIZE * BTree::MAXIMUM_ELEMENTS;
+    }
+
+    /// <summary>
+    /// Gets the number of elements added to the tree.
+    /// </summary>
+    /// <returns>
+    /// The number of elements in the tree.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Indicates whether the tree is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if the tree is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_uRoot == BTree::END_POSITION_FORWARD;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The allocator which stores the nodes, and the elements inside them.
+    /// </summary>
+    AllocatorT m_nodeAllocator;
+
+    /// <summary>
+    /// The position of the root node in the internal buffer.
+    /// </summary>
+    puint_z m_uRoot;
+
+    /// <summary>
+    /// The number of elements in the tree.
+    /// </summary>
+    puint_z m_uCount;
+
+    /// <summary>
+    /// A pointer to the buffer stored in the memory allocator, intended to improve overall performance.
+    /// </summary>
+    u8_z* m_pNodeBasePointer;
+};
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class T, class AllocatorT, class ComparatorT>
+float BTree<T, AllocatorT, ComparatorT>::REALLOCATION_FACTOR = 1.5f;
+
+
+} // namespace z
+
+
+
+#endif // __BTREE__
@@ -1556,6 +1556,69 @@ public:
         return BinarySearchTree::ConstBinarySearchTreeIterator(this, uCurrentPosition, eTraversalOrder);
     }
     
+    /// <summary>
+    /// Searches for the first element, in ascending order, that is not lower than a given value.
+    /// </summary>
+    /// <param name="value">[IN] The value to compare the elements to.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited by the resultant iterator, 
+    /// it does not affect the binary search.</param>
+    /// <returns>
+    /// An iterator that points to the lowest element that is greater than or equal to the value. If there is no such element, the iterator will 
+    /// point to the end position.
+    /// </returns>
+    ConstBinarySearchTreeIterator LowerBound(const T &value, const ETreeTraversalOrder &eTraversalOrder) const
+    {
+        puint_z uResultPosition = BinarySearchTree::END_POSITION_FORWARD;
+        puint_z uCurrentPosition = m_uRoot;
+
+        // The last element found while descending that is not lower than the value is the lowest one
+        while(uCurrentPosition != BinarySearchTree::END_POSITION_FORWARD)
+        {
+            if(ComparatorT::Compare(m_pElementBasePointer[uCurrentPosition], value) < 0)
+            {
+                uCurrentPosition = m_pNodeBasePointer[uCurrentPosition].GetRightChild();
+            }
+            else
+            {
+                uResultPosition = uCurrentPosition;
+                uCurrentPosition = m_pNodeBasePointer[uCurrentPosition].GetLeftChild();
+            }
+        }
+
+        return BinarySearchTree::ConstBinarySearchTreeIterator(this, uResultPosition, eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Searches for the first element, in ascending order, that is greater than a given value.
+    /// </summary>
+    /// <param name="value">[IN] The value to compare the elements to.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited by the resultant iterator, 
+    /// it does not affect the binary search.</param>
+    /// <returns>
+    /// An iterator that points to the lowest element that is greater than the value. If there is no such element, the iterator will point to the end position.
+    /// </returns>
+    ConstBinarySearchTreeIterator UpperBound(const T &value, const ETreeTraversalOrder &eTraversalOrder) const
+    {
+        puint_z uResultPosition = BinarySearchTree::END_POSITION_FORWARD;
+        puint_z uCurrentPosition = m_uRoot;
+
+        // The last element found while descending that is greater than the value is the lowest one
+        while(uCurrentPosition != BinarySearchTree::END_POSITION_FORWARD)
+        {
+            if(ComparatorT::Compare(m_pElementBasePointer[uCurrentPosition], value) <= 0)
+            {
+                uCurrentPosition = m_pNodeBasePointer[uCurrentPosition].GetRightChild();
+            }
+            else
+            {
+                uResultPosition = uCurrentPosition;
+                uCurrentPosition = m_pNodeBasePointer[uCurrentPosition].GetLeftChild();
+            }
+        }
+
+        return BinarySearchTree::ConstBinarySearchTreeIterator(this, uResultPosition, eTraversalOrder);
+    }
+    
     /// <summary>
     /// Performs a shallow copy of the contents of the tree to another tree.
     /// </summary>
@@ -1575,6 +1638,64 @@ public:
         destinationTree.m_uRoot = m_uRoot;
     }
     
+    /// <summary>
+    /// Exchanges the elements and the capacity of two trees.
+    /// </summary>
+    /// <remarks>
+    /// It is the cheapest way to transfer the content of a tree to another, since neither copy constructors, nor assignment operators nor destructors 
+    /// are called and no memory is copied, regardless of the number of elements.<br/>
+    /// Pointers to elements remain valid, although they will point to elements of the other tree. Iterators keep pointing to the same tree and 
+    /// positions, so they may become invalid.
+    /// </remarks>
+    /// <param name="inputTree">[IN/OUT] The tree whose elements will be exchanged with the resident tree's. It can be the resident tree.</param>
+    void Swap(BinarySearchTree &inputTree)
+    {
+        m_elementAllocator.Swap(inputTree.m_elementAllocator);
+        m_nodeAllocator.Swap(inputTree.m_nodeAllocator);
+
+        const puint_z ROOT = m_uRoot;
+        m_uRoot = inputTree.m_uRoot;
+        inputTree.m_uRoot = ROOT;
+
+        m_pElementBasePointer = scast_z(m_elementAllocator.GetPointer(), T*);
+        m_pNodeBasePointer = scast_z(m_nodeAllocator.GetPointer(), BinarySearchTree::BinaryNode*);
+        inputTree.m_pElementBasePointer = scast_z(inputTree.m_elementAllocator.GetPointer(), T*);
+        inputTree.m_pNodeBasePointer = scast_z(inputTree.m_nodeAllocator.GetPointer(), BinarySearchTree::BinaryNode*);
+    }
+    
+    /// <summary>
+    /// Replaces the content of the tree with a sequence of sorted elements, building a balanced tree in linear time.
+    /// </summary>
+    /// <remarks>
+    /// All the elements in the resident tree will be firstly removed, calling each element's destructor.<br/>
+    /// Memory is reserved only once, if the capacity is not enough, and elements are stored in ascending order, so traversing the tree in depth-first 
+    /// in-order visits consecutive memory positions.<br/>
+    /// The copy constructor of every element will be called, in ascending order.
+    /// </remarks>
+    /// <param name="arElements">[IN] The elements to store, sorted in ascending order according to the tree's comparator. There must not be 
+    /// repeated elements. It must not be null unless the number of elements is zero.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    void BuildFromSorted(const T* arElements, const puint_z uNumberOfElements)
+    {
+        Z_ASSERT_ERROR(arElements != null_z || uNumberOfElements == 0, "The input sequence of elements cannot be null.");
+
+        this->Clear();
+        this->Reserve(uNumberOfElements);
+        m_elementAllocator.Clear();
+        m_nodeAllocator.Clear();
+
+        // Blocks are allocated in order after clearing the allocators, so the element at every position of the sequence occupies the same position in the tree
+        for(puint_z i = 0; i < uNumberOfElements; ++i)
+        {
+            Z_ASSERT_ERROR(i == 0 || ComparatorT::Compare(arElements[i - 1U], arElements[i]) < 0, "The input elements must be sorted in ascending order and must not be repeated.");
+
+            new(m_elementAllocator.Allocate()) T(arElements[i]);
+            m_nodeAllocator.Allocate();
+        }
+
+        m_uRoot = this->_BuildBalancedSubtree(0, uNumberOfElements, BinarySearchTree::END_POSITION_FORWARD);
+    }
+    
 private:
 
     /// <summary>
@@ -1588,6 +1709,32 @@ private:
         this->Reserve(FINAL_CAPACITY);
     }
 
+    /// <summary>
+    /// Links the nodes of a range of consecutive positions, whose elements are sorted, forming a balanced subtree whose root is the node in the middle.
+    /// </summary>
+    /// <param name="uFirstPosition">[IN] The first position of the range.</param>
+    /// <param name="uNumberOfNodes">[IN] The number of nodes in the range.</param>
+    /// <param name="uParentPosition">[IN] The position of the parent of the subtree.</param>
+    /// <returns>
+    /// The position of the root of the subtree, or the end position if the range is empty.
+    /// </returns>
+    puint_z _BuildBalancedSubtree(const puint_z uFirstPosition, const puint_z uNumberOfNodes, const puint_z uParentPosition)
+    {
+        puint_z uRootPosition = BinarySearchTree::END_POSITION_FORWARD;
+
+        if(uNumberOfNodes > 0)
+        {
+            const puint_z LEFT_NODES = uNumberOfNodes / 2U;
+            uRootPosition = uFirstPosition + LEFT_NODES;
+
+            const puint_z LEFT_CHILD = this->_BuildBalancedSubtree(uFirstPosition, LEFT_NODES, uRootPosition);
+            const puint_z RIGHT_CHILD = this->_BuildBalancedSubtree(uRootPosition + 1U, uNumberOfNodes - LEFT_NODES - 1U, uRootPosition);
+            new(m_pNodeBasePointer + uRootPosition) BinarySearchTree::BinaryNode(uParentPosition, LEFT_CHILD, RIGHT_CHILD);
+        }
+
+        return uRootPosition;
+    }
+
     // PROPERTIES
     // ---------------
 public:
@@ -0,0 +1,671 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __CONCURRENTHASHTABLE__
+#define __CONCURRENTHASHTABLE__
+
+#include "ZContainers/ContainersModuleDefinitions.h"
+#include "ZContainers/Hashtable.h"
+#include "ZContainers/ArrayDynamic.h"
+#include "ZContainers/KeyValuePair.h"
+#include "ZContainers/SComparatorDefault.h"
+#include "ZContainers/SIntegerHashProvider.h"
+#include "ZMemory/PoolAllocator.h"
+#include "ZCommon/Alignment.h"
+#include "ZCommon/AllocationOperators.h"
+#include "ZThreading/SharedMutex.h"
+#include "ZThreading/ScopedSharedLock.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a hash table that can be read and modified by many threads at the same time.
+/// </summary>
+/// <remarks>
+/// The key-value pairs are distributed among a fixed number of segments, each of them being a Hashtable protected by its own SharedMutex. The segment 
+/// of a key is chosen by remixing the hash calculated by the hash provider, so adjacent keys are spread across segments; threads that use keys of 
+/// different segments never wait for each other, and readers of the same segment do not wait for each other either; only writers lock a segment exclusively.<br/>
+/// Values are returned by copy since another thread may replace or remove them as soon as the segment is unlocked.<br/>
+/// Iterators are weakly consistent: they copy the key-value pairs of one segment at a time, so they never block writers for long, never fail 
+/// and every pair they return was stored in the hash table at some point during the traversal, although modifications made after a segment 
+/// was copied are not reflected.<br/>
+/// Keys and values are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// If SComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".
+/// </remarks>
+/// <typeparam name="KeyT">The type of the key associated to every value in the table.</typeparam>
+/// <typeparam name="ValueT">The type of the values stored in the table.</typeparam>
+/// <typeparam name="HashProviderT">Optional. The type of the hash provider. By default, it is SIntegerHashProvider.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of the allocator that reserves memory for keys, values and buckets in every segment. By default, it is PoolAllocator.</typeparam>
+/// <typeparam name="KeyComparatorT">Optional. The type of comparator utilized to compare keys. The default type is SComparatorDefault.</typeparam>
+template<class KeyT, class ValueT, class HashProviderT = SIntegerHashProvider, 
+                                   class AllocatorT = PoolAllocator, 
+                                   class KeyComparatorT = SComparatorDefault<KeyT> >
+class ConcurrentHashtable
+{
+    // TYPEDEFS (I)
+    // ---------------
+protected:
+
+    typedef KeyValuePair<KeyT, ValueT> KeyValuePairType;
+    typedef Hashtable<KeyT, ValueT, HashProviderT, AllocatorT, KeyComparatorT> SegmentTableType;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// A part of the hash table with its own lock.
+    /// </summary>
+    class Segment
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the dimensions of the hash table of the segment.
+        /// </summary>
+        /// <param name="uNumberOfBuckets">[IN] The number of buckets of the hash table. It must be greater than zero.</param>
+        /// <param name="uSlotsPerBucket">[IN] The initial number of slots per bucket. It must be greater than zero.</param>
+        Segment(const puint_z uNumberOfBuckets, const puint_z uSlotsPerBucket) : m_table(uNumberOfBuckets, uSlotsPerBucket)
+        {
+        }
+
+    private:
+
+        // Hidden
+        Segment(const Segment&);
+
+
+        // METHODS
+        // ---------------
+    private:
+
+        // Hidden
+        Segment& operator=(const Segment&);
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The lock that protects the hash table of the segment.
+        /// </summary>
+        SharedMutex m_mutex;
+
+        /// <summary>
+        /// The key-value pairs that belong to the segment.
+        /// </summary>
+        SegmentTableType m_table;
+
+        /// <summary>
+        /// Keeps the lock away from the data of the next segment.
+        /// </summary>
+        u8_z m_arPadding[Z_CACHE_LINE_SIZE];
+    };
+
+public:
+
+    /// <summary>
+    /// Weakly consistent iterator that steps once per key-value pair of a concurrent hash table, in an undefined order.
+    /// </summary>
+    /// <remarks>
+    /// The iterator copies all the key-value pairs of a segment when it enters it, locking the segment only while copying, so the pairs it 
+    /// returns are not affected by later modifications. Pairs added to or removed from segments that have not been copied yet will be reflected.<br/>
+    /// Once an interator have been bound to a hash table, it cannot point to another hash table ever.
+    /// </remarks>
+    class ConstConcurrentHashtableIterator
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the hash table to iterate through. This constructor is intended to be used internally, use GetFirst method 
+        /// of the ConcurrentHashtable class instead.
+        /// </summary>
+        /// <remarks>
+        /// The iterator points to the first key-value pair of the first segment that is not empty, or to the end position if there is no such segment.
+        /// </remarks>
+        /// <param name="pHashtable">[IN] The hash table to iterate through. It must not be null.</param>
+        explicit ConstConcurrentHashtableIterator(const ConcurrentHashtable* pHashtable) : m_pHashtable(pHashtable),
+                                                                                           m_uSegment(0),
+                                                                                           m_uPair(0)
+        {
+            Z_ASSERT_ERROR(pHashtable != null_z, "The input hash table must not be null.");
+
+            this->_CopySegment();
+        }
+
+
+        // METHODS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Indirection operator that returns a reference to the copy of the key-value pair the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A reference to the key-value pair the iterator points to. If the iterator points to the end position, the result is undefined.
+        /// </returns>
+        const KeyValuePairType& operator*() const
+        {
+            Z_ASSERT_ERROR(!this->IsEnd(), "The iterator points to the end position, it is not possible to get the reference to the hash table element.");
+
+            return m_arSegmentPairs[m_uPair];
+        }
+
+        /// <summary>
+        /// Dereferencing operator that returns a pointer to the copy of the key-value pair the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the key-value pair the iterator points to. If the iterator points to the end position, the result is undefined.
+        /// </returns>
+        const KeyValuePairType* operator->() const
+        {
+            Z_ASSERT_ERROR(!this->IsEnd(), "The iterator points to the end position, it is not possible to get the pointer to the hash table element.");
+
+            return &m_arSegmentPairs[m_uPair];
+        }
+
+        /// <summary>
+        /// Post-increment operator that makes the iterator step forward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        ConstConcurrentHashtableIterator operator++(int)
+        {
+            ConstConcurrentHashtableIterator iteratorCopy = *this;
+            ++(*this);
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Pre-increment operator that makes the iterator step forward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// When the iterator leaves a segment, the key-value pairs of the next segment that is not empty are copied.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        ConstConcurrentHashtableIterator& operator++()
+        {
+            Z_ASSERT_WARNING(!this->IsEnd(), "The iterator points to an end position, it is not possible to increment it");
+
+            if(!this->IsEnd())
+            {
+                ++m_uPair;
+
+                if(m_uPair == m_arSegmentPairs.GetCount())
+                {
+                    ++m_uSegment;
+                    this->_CopySegment();
+                }
+            }
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to the position after the last element.
+        /// </summary>
+        /// <returns>
+        /// True if the iterator points to the end position; False otherwise.
+        /// </returns>
+        bool IsEnd() const
+        {
+            return m_uSegment == m_pHashtable->m_uSegmentCount;
+        }
+
+    private:
+
+        /// <summary>
+        /// Copies the key-value pairs of the current segment or, if it is empty, of the next one that is not empty.
+        /// </summary>
+        void _CopySegment()
+        {
+            m_arSegmentPairs.Clear();
+            m_uPair = 0;
+
+            while(m_uSegment < m_pHashtable->m_uSegmentCount && m_arSegmentPairs.IsEmpty())
+            {
+                Segment &segment = m_pHashtable->m_arSegments[m_uSegment];
+
+                // ---------- Critical section -----------
+                {
+                    ScopedSharedLock<SharedMutex> sharedLock(segment.m_mutex);
+
+                    for(typename SegmentTableType::ConstIterator it = segment.m_table.GetFirst(); !it.IsEnd(); ++it)
+                        m_arSegmentPairs.Add(*it);
+
+                } // --------- Critical section ----------
+
+                if(m_arSegmentPairs.IsEmpty())
+                    ++m_uSegment;
+            }
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the hash table the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// The hash table the iterator points to.
+        /// </returns>
+        const ConcurrentHashtable* GetContainer() const
+        {
+            return m_pHashtable;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    protected:
+
+        /// <summary>
+        /// The hash table the iterator points to.
+        /// </summary>
+        const ConcurrentHashtable* m_pHashtable;
+
+        /// <summary>
+        /// The index of the segment whose key-value pairs are being traversed.
+        /// </summary>
+        puint_z m_uSegment;
+
+        /// <summary>
+        /// The position of the current key-value pair in the copy of the segment.
+        /// </summary>
+        puint_z m_uPair;
+
+        /// <summary>
+        /// The copy of the key-value pairs of the current segment.
+        /// </summary>
+        ArrayDynamic<KeyValuePairType> m_arSegmentPairs;
+
+    }; // ConstConcurrentHashtableIterator
+
+
+    // TYPEDEFS (II)
+    // ---------------
+public:
+
+    typedef typename ConcurrentHashtable::ConstConcurrentHashtableIterator ConstIterator;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the number of segments and their dimensions.
+    /// </summary>
+    /// <remarks>
+    /// The number of segments cannot change; it should be, at least, similar to the number of threads that will modify the hash table at the same time.
+    /// </remarks>
+    /// <param name="uNumberOfSegments">[IN] The number of independently locked segments. It must be greater than zero.</param>
+    /// <param name="uBucketsPerSegment">[IN] The number of buckets of every segment. It must be greater than zero.</param>
+    /// <param name="uSlotsPerBucket">[IN] The initial number of slots per bucket. It must be greater than zero.</param>
+    ConcurrentHashtable(const puint_z uNumberOfSegments, const puint_z uBucketsPerSegment, const puint_z uSlotsPerBucket) : 
+                                                                                                    m_uSegmentCount(uNumberOfSegments),
+                                                                                                    m_uBucketsPerSegment(uBucketsPerSegment)
+    {
+        Z_ASSERT_ERROR(uNumberOfSegments > 0, "The number of segments must be greater than zero.");
+        Z_ASSERT_ERROR(uBucketsPerSegment > 0, "The number of buckets per segment must be greater than zero.");
+
+        m_arSegments = scast_z(operator new(uNumberOfSegments * sizeof(Segment), Alignment(Z_CACHE_LINE_SIZE)), Segment*);
+
+        for(puint_z i = 0; i < uNumberOfSegments; ++i)
+            new(&m_arSegments[i]) Segment(uBucketsPerSegment, uSlotsPerBucket);
+    }
+
+private:
+
+    // Hidden
+    ConcurrentHashtable(const ConcurrentHashtable&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// No thread can be using the hash table.
+    /// </remarks>
+    ~ConcurrentHashtable()
+    {
+        for(puint_z i = 0; i < m_uSegmentCount; ++i)
+            m_arSegments[i].~Segment();
+
+        operator delete(m_arSegments, Alignment(Z_CACHE_LINE_SIZE));
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    ConcurrentHashtable& operator=(const ConcurrentHashtable&);
+
+public:
+
+    /// <summary>
+    /// Gets the value associated to a key or, if the key does not exist, adds a key-value pair and gets the added value.
+    /// </summary>
+    /// <remarks>
+    /// The segment of the key is locked exclusively only when the key does not exist.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for or to add.</param>
+    /// <param name="value">[IN] The value to add if the key does not exist.</param>
+    /// <returns>
+    /// A copy of the value associated to the key, either the existing one or the added one.
+    /// </returns>
+    ValueT GetOrAdd(const KeyT &key, const ValueT &value)
+    {
+        Segment &segment = this->_GetSegment(key);
+        ValueT result = value;
+        bool bFound = false;
+
+        // ---------- Critical section -----------
+        {
+            ScopedSharedLock<SharedMutex> sharedLock(segment.m_mutex);
+
+            typename SegmentTableType::ConstIterator itPair = segment.m_table.PositionOfKey(key);
+            bFound = !itPair.IsEnd();
+
+            if(bFound)
+                result = itPair->GetValue();
+
+        } // --------- Critical section ----------
+
+        if(!bFound)
+        {
+            // ---------- Critical section -----------
+            {
+                ScopedExclusiveLock<SharedMutex> exclusiveLock(segment.m_mutex);
+
+                // Another thread may have added the key meanwhile
+                typename SegmentTableType::ConstIterator itPair = segment.m_table.PositionOfKey(key);
+
+                if(itPair.IsEnd())
+                    itPair = segment.m_table.Add(key, value);
+
+                result = itPair->GetValue();
+
+            } // --------- Critical section ----------
+        }
+
+        return result;
+    }
+
+    /// <summary>
+    /// Gets the value associated to a key, if it exists.
+    /// </summary>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <param name="value">[OUT] A copy of the value associated to the key. It is not modified if the key does not exist.</param>
+    /// <returns>
+    /// True if the key exists; False otherwise.
+    /// </returns>
+    bool TryGetValue(const KeyT &key, ValueT &value) const
+    {
+        Segment &segment = this->_GetSegment(key);
+        bool bExists = false;
+
+        // ---------- Critical section -----------
+        {
+            ScopedSharedLock<SharedMutex> sharedLock(segment.m_mutex);
+
+            typename SegmentTableType::ConstIterator itPair = segment.m_table.PositionOfKey(key);
+            bExists = !itPair.IsEnd();
+
+            if(bExists)
+                value = itPair->GetValue();
+
+        } // --------- Critical section ----------
+
+        return bExists;
+    }
+
+    /// <summary>
+    /// Adds a key-value pair or, if the key already exists, replaces its value.
+    /// </summary>
+    /// <param name="key">[IN] The key to add or whose value is replaced.</param>
+    /// <param name="value">[IN] The value to add or the new value.</param>
+    /// <returns>
+    /// True if the key-value pair was added; False if the value was replaced.
+    /// </returns>
+    bool AddOrUpdate(const KeyT &key, const ValueT &value)
+    {
+        Segment &segment = this->_GetSegment(key);
+        bool bAdded = false;
+
+        // ---------- Critical section -----------
+        {
+            ScopedExclusiveLock<SharedMutex> exclusiveLock(segment.m_mutex);
+
+            typename SegmentTableType::ConstIterator itPair = segment.m_table.PositionOfKey(key);
+            bAdded = itPair.IsEnd();
+
+            if(bAdded)
+                segment.m_table.Add(key, value);
+            else
+                ccast_z(itPair->GetValue(), ValueT&) = value;
+
+        } // --------- Critical section ----------
+
+        return bAdded;
+    }
+
+    /// <summary>
+    /// Removes a key-value pair, if the key exists.
+    /// </summary>
+    /// <param name="key">[IN] The key of the pair to remove.</param>
+    /// <returns>
+    /// True if the key-value pair was removed; False if the key did not exist.
+    /// </returns>
+    bool TryRemove(const KeyT &key)
+    {
+        Segment &segment = this->_GetSegment(key);
+        bool bExists = false;
+
+        // ---------- Critical section -----------
+        {
+            ScopedExclusiveLock<SharedMutex> exclusiveLock(segment.m_mutex);
+
+            bExists = segment.m_table.ContainsKey(key);
+
+            if(bExists)
+                segment.m_table.Remove(key);
+
+        } // --------- Critical section ----------
+
+        return bExists;
+    }
+
+    /// <summary>
+    /// Checks whether a key exists in the hash table.
+    /// </summary>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// True if the key exists; False otherwise.
+    /// </returns>
+    bool ContainsKey(const KeyT &key) const
+    {
+        Segment &segment = this->_GetSegment(key);
+        ScopedSharedLock<SharedMutex> sharedLock(segment.m_mutex);
+
+        return segment.m_table.ContainsKey(key);
+    }
+
+    /// <summary>
+    /// Gets a weakly consistent iterator that points to the first key-value pair.
+    /// </summary>
+    /// <remarks>
+    /// If the hash table is empty, the iterator points to the end position.
+    /// </remarks>
+    /// <returns>
+    /// An iterator that points to the first key-value pair of the first segment that is not empty.
+    /// </returns>
+    ConstConcurrentHashtableIterator GetFirst() const
+    {
+        return ConcurrentHashtable::ConstConcurrentHashtableIterator(this);
+    }
+
+private:
+
+    /// <summary>
+    /// Gets the segment a key belongs to.
+    /// </summary>
+    /// <remarks>
+    /// The hash of the key is calculated for all the buckets of all the segments and its bits are mixed before taking the remainder of dividing 
+    /// it by the number of segments. Without the mixing, consecutive integer keys would either fall in the same segment or, since the hash table 
+    /// of the segment calculates the same hash for its buckets, the keys of a segment would only use a fraction of its buckets.
+    /// </remarks>
+    /// <param name="key">[IN] A key.</param>
+    /// <returns>
+    /// The segment of the key.
+    /// </returns>
+    Segment& _GetSegment(const KeyT &key) const
+    {
+        const puint_z HASH_KEY = HashProviderT::GenerateHashKey(key, m_uSegmentCount * m_uBucketsPerSegment);
+
+        // Finalization step of MurmurHash3 (fmix64), every bit of the input affects every bit of the output
+        u64_z uMixedHashKey = scast_z(HASH_KEY, u64_z);
+        uMixedHashKey ^= uMixedHashKey >> 33U;
+        uMixedHashKey *= 0xFF51AFD7ED558CCDULL;
+        uMixedHashKey ^= uMixedHashKey >> 33U;
+        uMixedHashKey *= 0xC4CEB9FE1A85EC53ULL;
+        uMixedHashKey ^= uMixedHashKey >> 33U;
+
+        return m_arSegments[scast_z(uMixedHashKey % m_uSegmentCount, puint_z)];
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of key-value pairs in the hash table.
+    /// </summary>
+    /// <remarks>
+    /// Segments are locked one by one, so the result may not match the number of pairs at any instant if other threads modify the hash table meanwhile.
+    /// </remarks>
+    /// <returns>
+    /// The number of key-value pairs.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        puint_z uCount = 0;
+
+        for(puint_z i = 0; i < m_uSegmentCount; ++i)
+        {
+            ScopedSharedLock<SharedMutex> sharedLock(m_arSegments[i].m_mutex);
+            uCount += m_arSegments[i].m_table.GetCount();
+        }
+
+        return uCount;
+    }
+
+    /// <summary>
+    /// Indicates whether the hash table is empty.
+    /// </summary>
+    /// <remarks>
+    /// Segments are locked one by one, so the result may be outdated if other threads modify the hash table meanwhile.
+    /// </remarks>
+    /// <returns>
+    /// True if there are no key-value pairs; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        bool bIsEmpty = true;
+
+        for(puint_z i = 0; i < m_uSegmentCount && bIsEmpty; ++i)
+        {
+            ScopedSharedLock<SharedMutex> sharedLock(m_arSegments[i].m_mutex);
+            bIsEmpty = m_arSegments[i].m_table.IsEmpty();
+        }
+
+        return bIsEmpty;
+    }
+
+    /// <summary>
+    /// Gets the number of independently locked segments.
+    /// </summary>
+    /// <returns>
+    /// The number of segments.
+    /// </returns>
+    puint_z GetSegmentCount() const
+    {
+        return m_uSegmentCount;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The number of segments.
+    /// </summary>
+    const puint_z m_uSegmentCount;
+
+    /// <summary>
+    /// The number of buckets of every segment.
+    /// </summary>
+    const puint_z m_uBucketsPerSegment;
+
+    /// <summary>
+    /// The segments, every one of them aligned to a cache line.
+    /// </summary>
+    Segment* m_arSegments;
+
+};
+
+} // namespace z
+
+
+#endif // __CONCURRENTHASHTABLE__
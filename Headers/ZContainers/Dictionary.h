@@ -32,8 +32,12 @@
 #include "ZMemory/PoolAllocator.h"
 #include "ZContainers/KeyValuePair.h"
 #include "ZContainers/BinarySearchTree.h"
+#include "ZContainers/BTree.h"
 #include "ZContainers/SKeyValuePairComparator.h"
 #include "ZCommon/DataTypes/SAnyTypeToStringConverter.h"
+#include "ZCommon/Alignment.h"
+#include "ZCommon/AllocationOperators.h"
+#include "ZThreading/Thread.h"
 
 
 namespace z
@@ -44,22 +48,30 @@ namespace z
 /// Represents a data structure that stores pairs composed of a value and its associated key which must be unique in the container. 
 /// </summary>
 /// <remarks>
+/// Key-value pairs are stored in a search tree sorted by key, whose type can be chosen: BinarySearchTree (the default) or BTree, which keeps several 
+/// pairs per node and remains balanced, so it is faster when there are many pairs or keys are added in order. Adding or removing pairs invalidates 
+/// iterators when BTree is used.<br/>
 /// Key and value types are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
-/// If SComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".
+/// If SComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".<br/>
+/// Dictionaries can be built at once from arrays of keys and values (see FromSorted and FromUnsorted), which is much faster than adding pairs one by one 
+/// and produces a balanced tree.
 /// </remarks>
 /// <typeparam name="KeyT">The type of the keys associated to every value.</typeparam>
 /// <typeparam name="ValueT">The type of the values.</typeparam>
 /// <typeparam name="AllocatorT">Optional. The allocator used to reserve memory. The default type is PoolAllocator.</typeparam>
 /// <typeparam name="KeyComparatorT">Optional. The type of comparator utilized to compare keys. The default type is SComparatorDefault.</typeparam>
 /// <typeparam name="ValueComparatorT">Optional. The type of comparator utilized to compare values. The default type is SComparatorDefault.</typeparam>
-template<class KeyT, class ValueT, class AllocatorT = PoolAllocator, class KeyComparatorT = SComparatorDefault<KeyT>, class ValueComparatorT = SComparatorDefault<ValueT> >
+/// <typeparam name="TreeT">Optional. The template of the search tree that stores the key-value pairs, which receives the type of the elements, the allocator 
+/// and the comparator. The default template is BinarySearchTree.</typeparam>
+template<class KeyT, class ValueT, class AllocatorT = PoolAllocator, class KeyComparatorT = SComparatorDefault<KeyT>, class ValueComparatorT = SComparatorDefault<ValueT>, 
+         template<class, class, class> class TreeT = BinarySearchTree>
 class Dictionary
 {
     // TYPEDEFS (I)
     // ---------------
 protected:
 
-    typedef BinarySearchTree<KeyValuePair<KeyT, ValueT>, AllocatorT, SKeyValuePairComparator<KeyT, ValueT, KeyComparatorT> > InternalBinaryTreeType;
+    typedef TreeT<KeyValuePair<KeyT, ValueT>, AllocatorT, SKeyValuePairComparator<KeyT, ValueT, KeyComparatorT> > InternalBinaryTreeType;
     typedef KeyValuePair<KeyT, ValueT> KeyValuePairType;
 
 
@@ -487,6 +499,12 @@ protected:
     static const puint_z END_POSITION_FORWARD = -2;
 
 
+    /// <summary>
+    /// Number of indices that are sorted by insertion before they are merged, when sorting keys.
+    /// </summary>
+    static const puint_z INSERTION_SORT_LENGTH = 16U;
+
+
     // CONSTRUCTORS
     // ---------------
 public:
@@ -802,6 +820,134 @@ public:
         return ConstDictionaryIterator(this, treeIterator.GetInternalPosition());
     }
 
+    /// <summary>
+    /// Searches for the first key-value pair whose key is not lower than a given key.
+    /// </summary>
+    /// <param name="key">[IN] The key to compare the keys of the dictionary to.</param>
+    /// <returns>
+    /// An iterator that points to the pair with the lowest key that is greater than or equal to the input key. If there is no such pair, the iterator 
+    /// will point to the end position.
+    /// </returns>
+    ConstDictionaryIterator LowerBound(const KeyT &key) const
+    {
+        // Creates a key-value by copying the key without calling its constructor
+        u8_z pKeyValueBlock[sizeof(KeyValuePairType)];
+        memcpy(pKeyValueBlock, &key, sizeof(KeyT));
+        KeyValuePairType* pKeyValue = rcast_z(pKeyValueBlock, KeyValuePairType*);
+
+        typename InternalBinaryTreeType::ConstIterator treeIterator = m_keyValues.LowerBound(*pKeyValue, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+        return ConstDictionaryIterator(this, treeIterator.GetInternalPosition());
+    }
+
+    /// <summary>
+    /// Searches for the first key-value pair whose key is greater than a given key.
+    /// </summary>
+    /// <param name="key">[IN] The key to compare the keys of the dictionary to.</param>
+    /// <returns>
+    /// An iterator that points to the pair with the lowest key that is greater than the input key. If there is no such pair, the iterator will point 
+    /// to the end position.
+    /// </returns>
+    ConstDictionaryIterator UpperBound(const KeyT &key) const
+    {
+        // Creates a key-value by copying the key without calling its constructor
+        u8_z pKeyValueBlock[sizeof(KeyValuePairType)];
+        memcpy(pKeyValueBlock, &key, sizeof(KeyT));
+        KeyValuePairType* pKeyValue = rcast_z(pKeyValueBlock, KeyValuePairType*);
+
+        typename InternalBinaryTreeType::ConstIterator treeIterator = m_keyValues.UpperBound(*pKeyValue, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+        return ConstDictionaryIterator(this, treeIterator.GetInternalPosition());
+    }
+
+    /// <summary>
+    /// Gets a copy of the key-value pairs whose keys are between two given keys, both included.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructors of every copied key and value will be called.
+    /// </remarks>
+    /// <param name="lowerKey">[IN] The lowest key of the range.</param>
+    /// <param name="upperKey">[IN] The greatest key of the range. It must not be lower than the lowest key.</param>
+    /// <returns>
+    /// A dictionary that contains the key-value pairs of the range.
+    /// </returns>
+    Dictionary GetRange(const KeyT &lowerKey, const KeyT &upperKey) const
+    {
+        Z_ASSERT_ERROR(KeyComparatorT::Compare(lowerKey, upperKey) <= 0, "The lowest key of the range must not be greater than the greatest key.");
+
+        const Dictionary::ConstDictionaryIterator FIRST_PAIR = this->LowerBound(lowerKey);
+        puint_z uPairCount = 0;
+
+        for(Dictionary::ConstDictionaryIterator it = FIRST_PAIR; !it.IsEnd() && KeyComparatorT::Compare(it->GetKey(), upperKey) <= 0; ++it)
+            ++uPairCount;
+
+        // Pairs are already sorted, so the tree is built at once
+        KeyValuePairType* arPairs = scast_z(operator new(uPairCount * sizeof(KeyValuePairType), Alignment(alignof_z(KeyValuePairType))), KeyValuePairType*);
+        Dictionary::ConstDictionaryIterator it = FIRST_PAIR;
+
+        for(puint_z i = 0; i < uPairCount; ++i, ++it)
+            Dictionary::_CopyPairTo(it->GetKey(), it->GetValue(), arPairs + i);
+
+        Dictionary range;
+        range.m_keyValues.BuildFromSorted(arPairs, uPairCount);
+        operator delete(arPairs, Alignment(alignof_z(KeyValuePairType)));
+
+        return range;
+    }
+
+    /// <summary>
+    /// Adds the key-value pairs of another dictionary to the resident dictionary, in linear time.
+    /// </summary>
+    /// <remarks>
+    /// Both sequences of pairs are merged in order and the internal tree is built again at once, balanced, instead of adding the pairs one by one.<br/>
+    /// When a key exists in both dictionaries, the value of the input dictionary replaces the resident one.<br/>
+    /// The copy constructors of every key and value of both dictionaries will be called, and then the destructors of the keys and values the 
+    /// resident dictionary had. Any pointer to elements of this dictionary will be pointing to garbage.
+    /// </remarks>
+    /// <param name="dictionary">[IN] The dictionary whose key-value pairs will be added. If it is the resident dictionary, nothing will happen.</param>
+    void MergeFrom(const Dictionary &dictionary)
+    {
+        if(this != &dictionary && !dictionary.IsEmpty())
+        {
+            KeyValuePairType* arPairs = scast_z(operator new((this->GetCount() + dictionary.GetCount()) * sizeof(KeyValuePairType), Alignment(alignof_z(KeyValuePairType))), 
+                                                KeyValuePairType*);
+            puint_z uPairCount = 0;
+
+            Dictionary::ConstDictionaryIterator itThisKeyValuePair = this->GetFirst();
+            Dictionary::ConstDictionaryIterator itInputKeyValuePair = dictionary.GetFirst();
+
+            while(!itThisKeyValuePair.IsEnd() || !itInputKeyValuePair.IsEnd())
+            {
+                const i8_z COMPARISON_RESULT = itThisKeyValuePair.IsEnd()  ? 1 :
+                                               itInputKeyValuePair.IsEnd() ? -1 :
+                                                                             KeyComparatorT::Compare(itThisKeyValuePair->GetKey(), itInputKeyValuePair->GetKey());
+
+                if(COMPARISON_RESULT < 0)
+                {
+                    Dictionary::_CopyPairTo(itThisKeyValuePair->GetKey(), itThisKeyValuePair->GetValue(), arPairs + uPairCount);
+                    ++itThisKeyValuePair;
+                }
+                else
+                {
+                    Dictionary::_CopyPairTo(itInputKeyValuePair->GetKey(), itInputKeyValuePair->GetValue(), arPairs + uPairCount);
+                    ++itInputKeyValuePair;
+
+                    if(COMPARISON_RESULT == 0)
+                        ++itThisKeyValuePair;
+                }
+
+                ++uPairCount;
+            }
+
+            // The pairs are copied from the elements of the resident tree, so it cannot be rebuilt in place
+            Dictionary merged;
+            merged.m_keyValues.BuildFromSorted(arPairs, uPairCount);
+            operator delete(arPairs, Alignment(alignof_z(KeyValuePairType)));
+
+            this->Swap(merged);
+        }
+    }
+
     /// <summary>
     /// Equality operator that checks whether two dictionaries are equal.
     /// </summary>
@@ -849,6 +995,226 @@ public:
     {
         return !Dictionary::operator==(dictionary);
     }
+    
+    /// <summary>
+    /// Exchanges the key-value pairs and the capacity of two dictionaries.
+    /// </summary>
+    /// <remarks>
+    /// It is the cheapest way to transfer the content of a dictionary to another, since neither copy constructors, nor assignment operators nor destructors 
+    /// are called and no memory is copied, regardless of the number of key-value pairs.<br/>
+    /// Iterators keep pointing to the same dictionary and positions, so they may become invalid.
+    /// </remarks>
+    /// <param name="dictionary">[IN/OUT] The dictionary whose key-value pairs will be exchanged with the resident dictionary's. It can be the resident dictionary.</param>
+    void Swap(Dictionary &dictionary)
+    {
+        m_keyValues.Swap(dictionary.m_keyValues);
+    }
+    
+    /// <summary>
+    /// Creates a dictionary from a sequence of keys, sorted in ascending order, and their associated values, in linear time.
+    /// </summary>
+    /// <remarks>
+    /// Memory is reserved only once and the internal tree is built balanced.<br/>
+    /// The copy constructors of every key and value will be called, in ascending order.
+    /// </remarks>
+    /// <param name="arKeys">[IN] The keys, sorted in ascending order according to the key comparator. There must not be repeated keys. 
+    /// It must not be null unless the number of pairs is zero.</param>
+    /// <param name="arValues">[IN] The values associated to every key, in the same order. It must not be null unless the number of pairs is zero.</param>
+    /// <param name="uNumberOfPairs">[IN] The number of keys and values.</param>
+    /// <returns>
+    /// A dictionary that contains the key-value pairs.
+    /// </returns>
+    static Dictionary FromSorted(const KeyT* arKeys, const ValueT* arValues, const puint_z uNumberOfPairs)
+    {
+        Z_ASSERT_ERROR((arKeys != null_z && arValues != null_z) || uNumberOfPairs == 0, "The input arrays of keys and values cannot be null.");
+
+        KeyValuePairType* arPairs = scast_z(operator new(uNumberOfPairs * sizeof(KeyValuePairType), Alignment(alignof_z(KeyValuePairType))), KeyValuePairType*);
+
+        for(puint_z i = 0; i < uNumberOfPairs; ++i)
+            Dictionary::_CopyPairTo(arKeys[i], arValues[i], arPairs + i);
+
+        Dictionary dictionary;
+        dictionary.m_keyValues.BuildFromSorted(arPairs, uNumberOfPairs);
+        operator delete(arPairs, Alignment(alignof_z(KeyValuePairType)));
+
+        return dictionary;
+    }
+    
+    /// <summary>
+    /// Creates a dictionary from a sequence of keys, in any order, and their associated values, sorting them in several threads.
+    /// </summary>
+    /// <remarks>
+    /// Keys are not moved; an array of indices is sorted by key instead. The array is divided into as many runs as threads, which are sorted at the same 
+    /// time (one of them by the calling thread), and then runs are merged. Finally, the internal tree is built balanced, at once.<br/>
+    /// The copy constructors of every key and value will be called, in ascending order of keys.
+    /// </remarks>
+    /// <param name="arKeys">[IN] The keys. There must not be repeated keys. It must not be null unless the number of pairs is zero.</param>
+    /// <param name="arValues">[IN] The values associated to every key, in the same order. It must not be null unless the number of pairs is zero.</param>
+    /// <param name="uNumberOfPairs">[IN] The number of keys and values.</param>
+    /// <param name="uNumberOfThreads">[IN] The number of threads that will sort the keys, including the calling thread. It must be greater than zero.</param>
+    /// <returns>
+    /// A dictionary that contains the key-value pairs.
+    /// </returns>
+    static Dictionary FromUnsorted(const KeyT* arKeys, const ValueT* arValues, const puint_z uNumberOfPairs, const puint_z uNumberOfThreads)
+    {
+        Z_ASSERT_ERROR((arKeys != null_z && arValues != null_z) || uNumberOfPairs == 0, "The input arrays of keys and values cannot be null.");
+        Z_ASSERT_ERROR(uNumberOfThreads > 0, "The number of threads must be greater than zero.");
+
+        puint_z* arIndices = new puint_z[uNumberOfPairs];
+        puint_z* arBuffer = new puint_z[uNumberOfPairs];
+
+        for(puint_z i = 0; i < uNumberOfPairs; ++i)
+            arIndices[i] = i;
+
+        if(uNumberOfPairs > 0)
+        {
+            const puint_z RUN_LENGTH = (uNumberOfPairs + uNumberOfThreads - 1U) / uNumberOfThreads;
+            const puint_z RUN_COUNT = (uNumberOfPairs + RUN_LENGTH - 1U) / RUN_LENGTH;
+            const puint_z LAST_RUN_START = (RUN_COUNT - 1U) * RUN_LENGTH;
+
+            Thread** arThreads = new Thread*[RUN_COUNT];
+
+            for(puint_z i = 0; i < RUN_COUNT - 1U; ++i)
+                arThreads[i] = new Thread(Delegate<void(const KeyT*, puint_z*, puint_z*, const puint_z)>(&Dictionary::_SortIndices), 
+                                          arKeys, 
+                                          arIndices + i * RUN_LENGTH, 
+                                          arBuffer + i * RUN_LENGTH, 
+                                          RUN_LENGTH);
+
+            Dictionary::_SortIndices(arKeys, arIndices + LAST_RUN_START, arBuffer + LAST_RUN_START, uNumberOfPairs - LAST_RUN_START);
+
+            for(puint_z i = 0; i < RUN_COUNT - 1U; ++i)
+            {
+                arThreads[i]->Join();
+                delete arThreads[i];
+            }
+
+            delete[] arThreads;
+
+            Dictionary::_MergeRuns(arKeys, arIndices, arBuffer, uNumberOfPairs, RUN_LENGTH);
+        }
+
+        KeyValuePairType* arPairs = scast_z(operator new(uNumberOfPairs * sizeof(KeyValuePairType), Alignment(alignof_z(KeyValuePairType))), KeyValuePairType*);
+
+        for(puint_z i = 0; i < uNumberOfPairs; ++i)
+            Dictionary::_CopyPairTo(arKeys[arIndices[i]], arValues[arIndices[i]], arPairs + i);
+
+        Dictionary dictionary;
+        dictionary.m_keyValues.BuildFromSorted(arPairs, uNumberOfPairs);
+        operator delete(arPairs, Alignment(alignof_z(KeyValuePairType)));
+
+        delete[] arIndices;
+        delete[] arBuffer;
+
+        return dictionary;
+    }
+
+private:
+
+    /// <summary>
+    /// Copies the data of a key and a value to a key-value pair, without calling any constructor.
+    /// </summary>
+    /// <param name="key">[IN] The key to copy.</param>
+    /// <param name="value">[IN] The value to copy.</param>
+    /// <param name="pPair">[OUT] The uninitialized key-value pair where the key and the value will be copied.</param>
+    static void _CopyPairTo(const KeyT &key, const ValueT &value, KeyValuePairType* pPair)
+    {
+        u8_z* pKeyValueBlock = rcast_z(pPair, u8_z*);
+        memcpy(pKeyValueBlock, &key, sizeof(KeyT));
+
+        void* pValue = (void*)align_z(pKeyValueBlock + sizeof(KeyT), alignof_z(ValueT));
+        memcpy(pValue, &value, sizeof(ValueT));
+    }
+
+    /// <summary>
+    /// Sorts an array of indices by the keys they refer to, using a merge sort that starts from short runs sorted by insertion.
+    /// </summary>
+    /// <param name="arKeys">[IN] The keys the indices refer to.</param>
+    /// <param name="arIndices">[IN/OUT] The indices to sort.</param>
+    /// <param name="arBuffer">[IN/OUT] An auxiliary array with the same number of elements as the array of indices.</param>
+    /// <param name="uCount">[IN] The number of indices.</param>
+    static void _SortIndices(const KeyT* arKeys, puint_z* arIndices, puint_z* arBuffer, const puint_z uCount)
+    {
+        for(puint_z uRunStart = 0; uRunStart < uCount; uRunStart += Dictionary::INSERTION_SORT_LENGTH)
+        {
+            const puint_z RUN_END = uRunStart + Dictionary::INSERTION_SORT_LENGTH < uCount ? uRunStart + Dictionary::INSERTION_SORT_LENGTH : uCount;
+
+            for(puint_z i = uRunStart + 1U; i < RUN_END; ++i)
+            {
+                const puint_z INDEX = arIndices[i];
+                puint_z j = i;
+
+                for(; j > uRunStart && KeyComparatorT::Compare(arKeys[INDEX], arKeys[arIndices[j - 1U]]) < 0; --j)
+                    arIndices[j] = arIndices[j - 1U];
+
+                arIndices[j] = INDEX;
+            }
+        }
+
+        Dictionary::_MergeRuns(arKeys, arIndices, arBuffer, uCount, Dictionary::INSERTION_SORT_LENGTH);
+    }
+
+    /// <summary>
+    /// Merges consecutive sorted runs of indices by pairs, repeatedly, until the whole array of indices is sorted by the keys they refer to.
+    /// </summary>
+    /// <param name="arKeys">[IN] The keys the indices refer to.</param>
+    /// <param name="arIndices">[IN/OUT] The indices to sort, divided into sorted runs of the same length (except the last one, which may be shorter).</param>
+    /// <param name="arBuffer">[IN/OUT] An auxiliary array with the same number of elements as the array of indices.</param>
+    /// <param name="uCount">[IN] The number of indices.</param>
+    /// <param name="uRunLength">[IN] The number of indices in every sorted run. It must be greater than zero.</param>
+    static void _MergeRuns(const KeyT* arKeys, puint_z* arIndices, puint_z* arBuffer, const puint_z uCount, const puint_z uRunLength)
+    {
+        puint_z* arSource = arIndices;
+        puint_z* arDestination = arBuffer;
+
+        for(puint_z uWidth = uRunLength; uWidth < uCount; uWidth *= 2U)
+        {
+            for(puint_z uFirst = 0; uFirst < uCount; uFirst += 2U * uWidth)
+            {
+                const puint_z MIDDLE = uFirst + uWidth < uCount ? uFirst + uWidth : uCount;
+                const puint_z END = MIDDLE + uWidth < uCount ? MIDDLE + uWidth : uCount;
+                Dictionary::_MergeIndices(arKeys, arSource + uFirst, MIDDLE - uFirst, arSource + MIDDLE, END - MIDDLE, arDestination + uFirst);
+            }
+
+            puint_z* arMerged = arDestination;
+            arDestination = arSource;
+            arSource = arMerged;
+        }
+
+        if(arSource != arIndices)
+            memcpy(arIndices, arSource, uCount * sizeof(puint_z));
+    }
+
+    /// <summary>
+    /// Merges two sorted sequences of indices into one, keeping the indices sorted by the keys they refer to.
+    /// </summary>
+    /// <param name="arKeys">[IN] The keys the indices refer to.</param>
+    /// <param name="arFirstIndices">[IN] The first sorted sequence.</param>
+    /// <param name="uFirstCount">[IN] The number of indices in the first sequence.</param>
+    /// <param name="arSecondIndices">[IN] The second sorted sequence.</param>
+    /// <param name="uSecondCount">[IN] The number of indices in the second sequence.</param>
+    /// <param name="arOutput">[OUT] The array where the indices of both sequences will be written.</param>
+    static void _MergeIndices(const KeyT* arKeys, 
+                              const puint_z* arFirstIndices, 
+                              const puint_z uFirstCount, 
+                              const puint_z* arSecondIndices, 
+                              const puint_z uSecondCount, 
+                              puint_z* arOutput)
+    {
+        puint_z uFirst = 0;
+        puint_z uSecond = 0;
+
+        while(uFirst < uFirstCount && uSecond < uSecondCount)
+        {
+            if(KeyComparatorT::Compare(arKeys[arSecondIndices[uSecond]], arKeys[arFirstIndices[uFirst]]) < 0)
+                *arOutput++ = arSecondIndices[uSecond++];
+            else
+                *arOutput++ = arFirstIndices[uFirst++];
+        }
+
+        memcpy(arOutput, arFirstIndices + uFirst, (uFirstCount - uFirst) * sizeof(puint_z));
+        memcpy(arOutput + uFirstCount - uFirst, arSecondIndices + uSecond, (uSecondCount - uSecond) * sizeof(puint_z));
+    }
 
 
     // PROPERTIES
@@ -906,7 +1272,7 @@ public:
 protected:
 
     /// <summary>
-    /// The internal binary search tree that holds all the keys.
+    /// The internal search tree that holds all the keys.
     /// </summary>
     InternalBinaryTreeType m_keyValues;
 };
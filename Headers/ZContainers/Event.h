@@ -29,6 +29,7 @@
 
 #include "ZContainers/ContainersModuleDefinitions.h"
 #include "ZContainers/ArrayDynamic.h"
+#include "ZMemory/InlineAllocator.h"
 #include "ZCommon/Delegate.h"
 #include "ZContainers/SEqualityComparator.h"
 
@@ -70,7 +71,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)();
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
@@ -176,7 +177,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)(Param1T);
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
@@ -282,7 +283,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T);
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
@@ -390,7 +391,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T);
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
@@ -500,7 +501,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T);
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
@@ -612,7 +613,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T);
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
@@ -726,7 +727,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T);
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
@@ -842,7 +843,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
@@ -960,7 +961,7 @@ public:
     typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
     typedef Delegate<FunctionSignatureT> Subscriber;
     typedef ArrayDynamic<Subscriber, 
-                                                                     PoolAllocator, 
+                                                                     InlineAllocator<Subscriber, 4U>, 
                                                                      SEqualityComparator<Subscriber> > 
                                                                         SubscriberArray;
 
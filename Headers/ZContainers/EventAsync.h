@@ -0,0 +1,1896 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+
+#ifndef __EVENTASYNC__
+#define __EVENTASYNC__
+
+#include "ZContainers/ContainersModuleDefinitions.h"
+#include "ZContainers/EventConcurrent.h"
+#include "ZContainers/QueueBlocking.h"
+#include "ZContainers/EQueueFullPolicy.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include <boost/atomic.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+
+namespace z
+{
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <remarks>
+/// References and constant qualifiers are removed from the parameter types, so subscribers that receive a reference get a reference to the copy.
+/// </remarks>
+/// <typeparam name="FunctionSignatureT">The signature of the functions that subscribe to the event.</typeparam>
+template<typename FunctionSignatureT>
+class EventAsyncMessage;
+
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT>
+class EventAsyncMessage< ReturnValueT(void) >
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage()
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(void) > &event)
+    {
+        event.Raise();
+    }
+};
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T>
+class EventAsyncMessage< ReturnValueT(Param1T) >
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param1T>::type>::type Argument1T;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage() : m_p1()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that copies the arguments.
+    /// </summary>
+    /// <param name="p1">[IN] The argument to be passed as parameter to every function.</param>
+    EventAsyncMessage(const Argument1T &p1) : m_p1(p1)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(Param1T) > &event)
+    {
+        event.Raise(m_p1);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the first argument.
+    /// </summary>
+    Argument1T m_p1;
+};
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T>
+class EventAsyncMessage< ReturnValueT(Param1T, Param2T) >
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param1T>::type>::type Argument1T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param2T>::type>::type Argument2T;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage() : m_p1(),
+                          m_p2()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that copies the arguments.
+    /// </summary>
+    /// <param name="p1">[IN] The argument to be passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] The argument to be passed as second parameter to every function.</param>
+    EventAsyncMessage(const Argument1T &p1, const Argument2T &p2) : m_p1(p1),
+                                                                    m_p2(p2)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(Param1T, Param2T) > &event)
+    {
+        event.Raise(m_p1, m_p2);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the first argument.
+    /// </summary>
+    Argument1T m_p1;
+
+    /// <summary>
+    /// The copy of the second argument.
+    /// </summary>
+    Argument2T m_p2;
+};
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T>
+class EventAsyncMessage< ReturnValueT(Param1T, Param2T, Param3T) >
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param1T>::type>::type Argument1T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param2T>::type>::type Argument2T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param3T>::type>::type Argument3T;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage() : m_p1(),
+                          m_p2(),
+                          m_p3()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that copies the arguments.
+    /// </summary>
+    /// <param name="p1">[IN] The argument to be passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] The argument to be passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] The argument to be passed as third parameter to every function.</param>
+    EventAsyncMessage(const Argument1T &p1, const Argument2T &p2, const Argument3T &p3) : m_p1(p1),
+                                                                                          m_p2(p2),
+                                                                                          m_p3(p3)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T) > &event)
+    {
+        event.Raise(m_p1, m_p2, m_p3);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the first argument.
+    /// </summary>
+    Argument1T m_p1;
+
+    /// <summary>
+    /// The copy of the second argument.
+    /// </summary>
+    Argument2T m_p2;
+
+    /// <summary>
+    /// The copy of the third argument.
+    /// </summary>
+    Argument3T m_p3;
+};
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T>
+class EventAsyncMessage< ReturnValueT(Param1T, Param2T, Param3T, Param4T) >
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param1T>::type>::type Argument1T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param2T>::type>::type Argument2T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param3T>::type>::type Argument3T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param4T>::type>::type Argument4T;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage() : m_p1(),
+                          m_p2(),
+                          m_p3(),
+                          m_p4()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that copies the arguments.
+    /// </summary>
+    /// <param name="p1">[IN] The argument to be passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] The argument to be passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] The argument to be passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] The argument to be passed as fourth parameter to every function.</param>
+    EventAsyncMessage(const Argument1T &p1, const Argument2T &p2, const Argument3T &p3, const Argument4T &p4) : m_p1(p1),
+                                                                                                                m_p2(p2),
+                                                                                                                m_p3(p3),
+                                                                                                                m_p4(p4)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T) > &event)
+    {
+        event.Raise(m_p1, m_p2, m_p3, m_p4);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the first argument.
+    /// </summary>
+    Argument1T m_p1;
+
+    /// <summary>
+    /// The copy of the second argument.
+    /// </summary>
+    Argument2T m_p2;
+
+    /// <summary>
+    /// The copy of the third argument.
+    /// </summary>
+    Argument3T m_p3;
+
+    /// <summary>
+    /// The copy of the fourth argument.
+    /// </summary>
+    Argument4T m_p4;
+};
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T>
+class EventAsyncMessage< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T) >
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param1T>::type>::type Argument1T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param2T>::type>::type Argument2T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param3T>::type>::type Argument3T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param4T>::type>::type Argument4T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param5T>::type>::type Argument5T;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage() : m_p1(),
+                          m_p2(),
+                          m_p3(),
+                          m_p4(),
+                          m_p5()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that copies the arguments.
+    /// </summary>
+    /// <param name="p1">[IN] The argument to be passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] The argument to be passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] The argument to be passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] The argument to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">[IN] The argument to be passed as fifth parameter to every function.</param>
+    EventAsyncMessage(const Argument1T &p1, const Argument2T &p2, const Argument3T &p3, const Argument4T &p4, const Argument5T &p5) : m_p1(p1),
+                                                                                                                                      m_p2(p2),
+                                                                                                                                      m_p3(p3),
+                                                                                                                                      m_p4(p4),
+                                                                                                                                      m_p5(p5)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T) > &event)
+    {
+        event.Raise(m_p1, m_p2, m_p3, m_p4, m_p5);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the first argument.
+    /// </summary>
+    Argument1T m_p1;
+
+    /// <summary>
+    /// The copy of the second argument.
+    /// </summary>
+    Argument2T m_p2;
+
+    /// <summary>
+    /// The copy of the third argument.
+    /// </summary>
+    Argument3T m_p3;
+
+    /// <summary>
+    /// The copy of the fourth argument.
+    /// </summary>
+    Argument4T m_p4;
+
+    /// <summary>
+    /// The copy of the fifth argument.
+    /// </summary>
+    Argument5T m_p5;
+};
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T>
+class EventAsyncMessage< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param1T>::type>::type Argument1T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param2T>::type>::type Argument2T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param3T>::type>::type Argument3T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param4T>::type>::type Argument4T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param5T>::type>::type Argument5T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param6T>::type>::type Argument6T;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage() : m_p1(),
+                          m_p2(),
+                          m_p3(),
+                          m_p4(),
+                          m_p5(),
+                          m_p6()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that copies the arguments.
+    /// </summary>
+    /// <param name="p1">[IN] The argument to be passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] The argument to be passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] The argument to be passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] The argument to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">[IN] The argument to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">[IN] The argument to be passed as sixth parameter to every function.</param>
+    EventAsyncMessage(const Argument1T &p1, const Argument2T &p2, const Argument3T &p3, const Argument4T &p4, const Argument5T &p5, const Argument6T &p6) : m_p1(p1),
+                                                                                                                                                            m_p2(p2),
+                                                                                                                                                            m_p3(p3),
+                                                                                                                                                            m_p4(p4),
+                                                                                                                                                            m_p5(p5),
+                                                                                                                                                            m_p6(p6)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) > &event)
+    {
+        event.Raise(m_p1, m_p2, m_p3, m_p4, m_p5, m_p6);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the first argument.
+    /// </summary>
+    Argument1T m_p1;
+
+    /// <summary>
+    /// The copy of the second argument.
+    /// </summary>
+    Argument2T m_p2;
+
+    /// <summary>
+    /// The copy of the third argument.
+    /// </summary>
+    Argument3T m_p3;
+
+    /// <summary>
+    /// The copy of the fourth argument.
+    /// </summary>
+    Argument4T m_p4;
+
+    /// <summary>
+    /// The copy of the fifth argument.
+    /// </summary>
+    Argument5T m_p5;
+
+    /// <summary>
+    /// The copy of the sixth argument.
+    /// </summary>
+    Argument6T m_p6;
+};
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param7T">The type of the seventh parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T>
+class EventAsyncMessage< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param1T>::type>::type Argument1T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param2T>::type>::type Argument2T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param3T>::type>::type Argument3T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param4T>::type>::type Argument4T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param5T>::type>::type Argument5T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param6T>::type>::type Argument6T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param7T>::type>::type Argument7T;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage() : m_p1(),
+                          m_p2(),
+                          m_p3(),
+                          m_p4(),
+                          m_p5(),
+                          m_p6(),
+                          m_p7()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that copies the arguments.
+    /// </summary>
+    /// <param name="p1">[IN] The argument to be passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] The argument to be passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] The argument to be passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] The argument to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">[IN] The argument to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">[IN] The argument to be passed as sixth parameter to every function.</param>
+    /// <param name="p7">[IN] The argument to be passed as seventh parameter to every function.</param>
+    EventAsyncMessage(const Argument1T &p1, const Argument2T &p2, const Argument3T &p3, const Argument4T &p4, const Argument5T &p5, const Argument6T &p6, const Argument7T &p7) : m_p1(p1),
+                                                                                                                                                                                  m_p2(p2),
+                                                                                                                                                                                  m_p3(p3),
+                                                                                                                                                                                  m_p4(p4),
+                                                                                                                                                                                  m_p5(p5),
+                                                                                                                                                                                  m_p6(p6),
+                                                                                                                                                                                  m_p7(p7)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) > &event)
+    {
+        event.Raise(m_p1, m_p2, m_p3, m_p4, m_p5, m_p6, m_p7);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the first argument.
+    /// </summary>
+    Argument1T m_p1;
+
+    /// <summary>
+    /// The copy of the second argument.
+    /// </summary>
+    Argument2T m_p2;
+
+    /// <summary>
+    /// The copy of the third argument.
+    /// </summary>
+    Argument3T m_p3;
+
+    /// <summary>
+    /// The copy of the fourth argument.
+    /// </summary>
+    Argument4T m_p4;
+
+    /// <summary>
+    /// The copy of the fifth argument.
+    /// </summary>
+    Argument5T m_p5;
+
+    /// <summary>
+    /// The copy of the sixth argument.
+    /// </summary>
+    Argument6T m_p6;
+
+    /// <summary>
+    /// The copy of the seventh argument.
+    /// </summary>
+    Argument7T m_p7;
+};
+
+/// <summary>
+/// Stores a copy of the arguments passed to EventAsync::Raise until they are passed to the subscribers by a dispatcher thread.
+/// </summary>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param7T">The type of the seventh parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param8T">The type of the eighth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T>
+class EventAsyncMessage< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param1T>::type>::type Argument1T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param2T>::type>::type Argument2T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param3T>::type>::type Argument3T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param4T>::type>::type Argument4T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param5T>::type>::type Argument5T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param6T>::type>::type Argument6T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param7T>::type>::type Argument7T;
+    typedef typename boost::remove_cv<typename boost::remove_reference<Param8T>::type>::type Argument8T;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventAsyncMessage() : m_p1(),
+                          m_p2(),
+                          m_p3(),
+                          m_p4(),
+                          m_p5(),
+                          m_p6(),
+                          m_p7(),
+                          m_p8()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that copies the arguments.
+    /// </summary>
+    /// <param name="p1">[IN] The argument to be passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] The argument to be passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] The argument to be passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] The argument to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">[IN] The argument to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">[IN] The argument to be passed as sixth parameter to every function.</param>
+    /// <param name="p7">[IN] The argument to be passed as seventh parameter to every function.</param>
+    /// <param name="p8">[IN] The argument to be passed as eighth parameter to every function.</param>
+    EventAsyncMessage(const Argument1T &p1, const Argument2T &p2, const Argument3T &p3, const Argument4T &p4, const Argument5T &p5, const Argument6T &p6, const Argument7T &p7, const Argument8T &p8) : m_p1(p1),
+                                                                                                                                                                                                        m_p2(p2),
+                                                                                                                                                                                                        m_p3(p3),
+                                                                                                                                                                                                        m_p4(p4),
+                                                                                                                                                                                                        m_p5(p5),
+                                                                                                                                                                                                        m_p6(p6),
+                                                                                                                                                                                                        m_p7(p7),
+                                                                                                                                                                                                        m_p8(p8)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every function subscribed to an event, passing them the stored arguments.
+    /// </summary>
+    /// <param name="event">[IN] The event whose subscribers are called.</param>
+    void Dispatch(const EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) > &event)
+    {
+        event.Raise(m_p1, m_p2, m_p3, m_p4, m_p5, m_p6, m_p7, m_p8);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The copy of the first argument.
+    /// </summary>
+    Argument1T m_p1;
+
+    /// <summary>
+    /// The copy of the second argument.
+    /// </summary>
+    Argument2T m_p2;
+
+    /// <summary>
+    /// The copy of the third argument.
+    /// </summary>
+    Argument3T m_p3;
+
+    /// <summary>
+    /// The copy of the fourth argument.
+    /// </summary>
+    Argument4T m_p4;
+
+    /// <summary>
+    /// The copy of the fifth argument.
+    /// </summary>
+    Argument5T m_p5;
+
+    /// <summary>
+    /// The copy of the sixth argument.
+    /// </summary>
+    Argument6T m_p6;
+
+    /// <summary>
+    /// The copy of the seventh argument.
+    /// </summary>
+    Argument7T m_p7;
+
+    /// <summary>
+    /// The copy of the eighth argument.
+    /// </summary>
+    Argument8T m_p8;
+};
+
+
+/// <summary>
+/// Base class for the asynchronous events, which contains the management of the queue of pending raises, the dispatcher threads and the subscribers.
+/// </summary>
+/// <remarks>
+/// Every raise copies the arguments into a message that is added to a bounded queue whose positions are allocated when the event is created, so raising 
+/// does not allocate memory. One or more dispatcher threads extract the messages in batches and call the subscribers. When the queue is full, 
+/// the policy provided to the constructor decides whether the raising thread waits or a message is discarded.<br/>
+/// If messages are coalesced, only the last message of every batch is dispatched; the others are discarded. This is useful when subscribers only need 
+/// the most recent state and raises are more frequent than the subscribers can process.<br/>
+/// The subscribers are stored in an EventConcurrent, so they can be changed from any thread, including the dispatcher threads.
+/// </remarks>
+/// <typeparam name="FunctionSignatureT">The signature of the functions that subscribe to the event.</typeparam>
+template<typename FunctionSignatureT>
+class EventAsyncBase
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef typename EventConcurrent<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrent<FunctionSignatureT>::SubscriberArray SubscriberArray;
+    typedef EventAsyncMessage<FunctionSignatureT> Message;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// An element of the queue, which contains either a message or the signal that makes a dispatcher thread finish.
+    /// </summary>
+    class Envelope
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        Envelope() : m_bStop(false)
+        {
+        }
+
+        /// <summary>
+        /// Constructor that receives the message.
+        /// </summary>
+        /// <param name="message">[IN] The message to be copied.</param>
+        /// <param name="bStop">[IN] Indicates whether the envelope is the signal that makes a dispatcher thread finish.</param>
+        Envelope(const Message &message, const bool bStop) : m_message(message),
+                                                             m_bStop(bStop)
+        {
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The message.
+        /// </summary>
+        Message m_message;
+
+        /// <summary>
+        /// Indicates whether the envelope is the signal that makes a dispatcher thread finish.
+        /// </summary>
+        bool m_bStop;
+    };
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[IN] What to do when an event is raised and the queue is full.</param>
+    /// <param name="uBatchSize">[IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero.</param>
+    /// <param name="bCoalesce">[IN] Indicates whether only the last message of every batch is dispatched.</param>
+    /// <param name="uDispatcherCount">[IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time.</param>
+    EventAsyncBase(const puint_z uQueueCapacity, 
+                   const EQueueFullPolicy &eQueueFullPolicy, 
+                   const puint_z uBatchSize, 
+                   const bool bCoalesce, 
+                   const u32_z uDispatcherCount) : m_queue(uQueueCapacity),
+                                                   m_eQueueFullPolicy(eQueueFullPolicy),
+                                                   m_uBatchSize(uBatchSize),
+                                                   m_bCoalesce(bCoalesce),
+                                                   m_uDispatcherCount(uDispatcherCount),
+                                                   m_uPendingCount(0),
+                                                   m_uDiscardedCount(0)
+    {
+        Z_ASSERT_ERROR(uBatchSize > 0, "The batch size must be greater than zero.");
+        Z_ASSERT_ERROR(uDispatcherCount > 0, "The number of dispatcher threads must be greater than zero.");
+
+        m_arDispatcherThreads = new Thread*[uDispatcherCount];
+
+        for(u32_z i = 0; i < uDispatcherCount; ++i)
+            m_arDispatcherThreads[i] = new Thread(Delegate<void(EventAsyncBase*)>(&EventAsyncBase::_DispatchMessages), this);
+    }
+
+private:
+
+    // Hidden
+    EventAsyncBase(const EventAsyncBase&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor that waits for all the pending raises to be dispatched and stops the dispatcher threads. No thread can be raising the event.
+    /// </summary>
+    ~EventAsyncBase()
+    {
+        for(u32_z i = 0; i < m_uDispatcherCount; ++i)
+            m_queue.Enqueue(Envelope(Message(), true));
+
+        for(u32_z i = 0; i < m_uDispatcherCount; ++i)
+        {
+            m_arDispatcherThreads[i]->Join();
+            delete m_arDispatcherThreads[i];
+        }
+
+        delete[] m_arDispatcherThreads;
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    EventAsyncBase& operator=(const EventAsyncBase&);
+
+public:
+
+    /// <summary>
+    /// Subscribes a function to the event.
+    /// </summary>
+    /// <remarks>
+    /// Pending raises will call the new subscriber.
+    /// </remarks>
+    /// <param name="subscriber">[IN] A function to subscribe. It should not be already subscribed. It must not be null.</param>
+    void operator+=(const Subscriber &subscriber)
+    {
+        m_event += subscriber;
+    }
+    
+    /// <summary>
+    /// Unsubscribes a function from the event.
+    /// </summary>
+    /// <remarks>
+    /// Pending raises will not call the removed subscriber, unless they are already being dispatched.
+    /// </remarks>
+    /// <param name="subscriber">[IN] A function to unsubscribe. It must be already subscribed. It must not be null.</param>
+    void operator-=(const Subscriber &subscriber)
+    {
+        m_event -= subscriber;
+    }
+
+    /// <summary>
+    /// Unsubscribes all the subscribed functions.
+    /// </summary>
+    void UnsubscribeAll()
+    {
+        m_event.UnsubscribeAll();
+    }
+
+    /// <summary>
+    /// Waits until all the pending raises have been dispatched or discarded.
+    /// </summary>
+    /// <remarks>
+    /// Raises made by other threads while waiting are waited for too. It must not be called by a subscriber.
+    /// </remarks>
+    void Flush() const
+    {
+        while(m_uPendingCount.load() > 0)
+            SThisThread::Yield();
+    }
+
+protected:
+
+    /// <summary>
+    /// Adds a message to the queue, applying the policy if the queue is full.
+    /// </summary>
+    /// <param name="message">[IN] The message to be copied.</param>
+    /// <returns>
+    /// True if the message was added; False if it was discarded.
+    /// </returns>
+    bool _Enqueue(const Message &message)
+    {
+        const Envelope ENVELOPE(message, false);
+        bool bAdded = true;
+
+        m_uPendingCount.fetch_add(1U);
+
+        if(m_eQueueFullPolicy == EQueueFullPolicy::E_Block)
+        {
+            m_queue.Enqueue(ENVELOPE);
+        }
+        else if(m_eQueueFullPolicy == EQueueFullPolicy::E_DiscardNewest)
+        {
+            bAdded = m_queue.TryEnqueue(ENVELOPE);
+
+            if(!bAdded)
+                this->_Discard(1U);
+        }
+        else
+        {
+            Envelope discardedEnvelope;
+
+            while(!m_queue.TryEnqueue(ENVELOPE))
+            {
+                if(m_queue.TryDequeue(discardedEnvelope))
+                    this->_Discard(1U);
+            }
+        }
+
+        return bAdded;
+    }
+
+    /// <summary>
+    /// Counts a number of discarded messages, which are not pending anymore.
+    /// </summary>
+    /// <param name="uCount">[IN] The number of discarded messages.</param>
+    void _Discard(const puint_z uCount)
+    {
+        m_uDiscardedCount.fetch_add(uCount, boost::memory_order_relaxed);
+        m_uPendingCount.fetch_sub(uCount);
+    }
+
+    /// <summary>
+    /// The function executed by the dispatcher threads, which extracts messages from the queue and dispatches them until it receives the signal to finish.
+    /// </summary>
+    /// <param name="pEvent">[IN] The event whose messages are dispatched.</param>
+    static void _DispatchMessages(EventAsyncBase* pEvent)
+    {
+        Envelope* arEnvelopes = new Envelope[pEvent->m_uBatchSize];
+        bool bStop = false;
+
+        while(!bStop)
+        {
+            const puint_z EXTRACTED_COUNT = pEvent->m_queue.Dequeue(arEnvelopes, pEvent->m_uBatchSize);
+            puint_z uMessageCount = 0;
+
+            while(uMessageCount < EXTRACTED_COUNT && !arEnvelopes[uMessageCount].m_bStop)
+                ++uMessageCount;
+
+            if(uMessageCount < EXTRACTED_COUNT)
+            {
+                // No raise can happen after the signals to finish, so the rest of the batch are signals for other dispatcher threads
+                bStop = true;
+
+                for(puint_z i = uMessageCount + 1U; i < EXTRACTED_COUNT; ++i)
+                    pEvent->m_queue.Enqueue(arEnvelopes[i]);
+            }
+
+            if(uMessageCount > 0)
+            {
+                if(pEvent->m_bCoalesce)
+                {
+                    pEvent->_Discard(uMessageCount - 1U);
+                    arEnvelopes[uMessageCount - 1U].m_message.Dispatch(pEvent->m_event);
+                    pEvent->m_uPendingCount.fetch_sub(1U);
+                }
+                else
+                {
+                    for(puint_z i = 0; i < uMessageCount; ++i)
+                    {
+                        arEnvelopes[i].m_message.Dispatch(pEvent->m_event);
+                        pEvent->m_uPendingCount.fetch_sub(1U);
+                    }
+                }
+            }
+        }
+
+        delete[] arEnvelopes;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Gets the entire list of subscribed functions.
+    /// </summary>
+    /// <returns>
+    /// A copy of the list of subscribed functions at the moment of the call.
+    /// </returns>
+    SubscriberArray GetSubscribers() const
+    {
+        return m_event.GetSubscribers();
+    }
+
+    /// <summary>
+    /// Gets the number of raises that have not been dispatched nor discarded yet.
+    /// </summary>
+    /// <returns>
+    /// The number of pending raises.
+    /// </returns>
+    puint_z GetPendingCount() const
+    {
+        return m_uPendingCount.load(boost::memory_order_relaxed);
+    }
+
+    /// <summary>
+    /// Gets the number of raises that have been discarded, either because the queue was full or because they were coalesced.
+    /// </summary>
+    /// <returns>
+    /// The number of discarded raises since the event was created.
+    /// </returns>
+    puint_z GetDiscardedCount() const
+    {
+        return m_uDiscardedCount.load(boost::memory_order_relaxed);
+    }
+
+    /// <summary>
+    /// Gets what to do when an event is raised and the queue is full.
+    /// </summary>
+    /// <returns>
+    /// The policy.
+    /// </returns>
+    EQueueFullPolicy GetQueueFullPolicy() const
+    {
+        return m_eQueueFullPolicy;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The subscribers, called by the dispatcher threads.
+    /// </summary>
+    EventConcurrent<FunctionSignatureT> m_event;
+
+    /// <summary>
+    /// The queue of pending raises.
+    /// </summary>
+    QueueBlocking<Envelope> m_queue;
+
+    /// <summary>
+    /// What to do when an event is raised and the queue is full.
+    /// </summary>
+    EQueueFullPolicy m_eQueueFullPolicy;
+
+    /// <summary>
+    /// The maximum number of messages a dispatcher thread extracts from the queue at once.
+    /// </summary>
+    puint_z m_uBatchSize;
+
+    /// <summary>
+    /// Indicates whether only the last message of every batch is dispatched.
+    /// </summary>
+    bool m_bCoalesce;
+
+    /// <summary>
+    /// The number of dispatcher threads.
+    /// </summary>
+    u32_z m_uDispatcherCount;
+
+    /// <summary>
+    /// The dispatcher threads.
+    /// </summary>
+    Thread** m_arDispatcherThreads;
+
+    /// <summary>
+    /// The number of raises that have not been dispatched nor discarded yet.
+    /// </summary>
+    boost::atomic<puint_z> m_uPendingCount;
+
+    /// <summary>
+    /// The number of discarded raises.
+    /// </summary>
+    boost::atomic<puint_z> m_uDiscardedCount;
+};
+
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// It is thread-safe: it can be raised, subscribed and unsubscribed by several threads at the same time.<br/>
+/// The types of the parameters must have a public default constructor, copy constructor and assignment operator.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="FunctionSignatureT">The signature of the functions that subscribe to the event.</typeparam>
+template<typename FunctionSignatureT>
+class EventAsync;
+
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT>
+class EventAsync< ReturnValueT(void) > : public EventAsyncBase< ReturnValueT(void) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)();
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise()
+    {
+        return this->_Enqueue(typename EventAsync::Message());
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T>
+class EventAsync< ReturnValueT(Param1T) > : public EventAsyncBase< ReturnValueT(Param1T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T);
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <param name="p1">[IN] An instance to be copied and passed as parameter to every function.</param>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise(Param1T p1)
+    {
+        return this->_Enqueue(typename EventAsync::Message(p1));
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T>
+class EventAsync< ReturnValueT(Param1T, Param2T) > : public EventAsyncBase< ReturnValueT(Param1T, Param2T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T);
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <param name="p1">[IN] An instance to be copied and passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] An instance to be copied and passed as second parameter to every function.</param>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise(Param1T p1, Param2T p2)
+    {
+        return this->_Enqueue(typename EventAsync::Message(p1, p2));
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T>
+class EventAsync< ReturnValueT(Param1T, Param2T, Param3T) > : public EventAsyncBase< ReturnValueT(Param1T, Param2T, Param3T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T);
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <param name="p1">[IN] An instance to be copied and passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] An instance to be copied and passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] An instance to be copied and passed as third parameter to every function.</param>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise(Param1T p1, Param2T p2, Param3T p3)
+    {
+        return this->_Enqueue(typename EventAsync::Message(p1, p2, p3));
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T>
+class EventAsync< ReturnValueT(Param1T, Param2T, Param3T, Param4T) > : public EventAsyncBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T);
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <param name="p1">[IN] An instance to be copied and passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] An instance to be copied and passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] An instance to be copied and passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] An instance to be copied and passed as fourth parameter to every function.</param>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4)
+    {
+        return this->_Enqueue(typename EventAsync::Message(p1, p2, p3, p4));
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T>
+class EventAsync< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T) > : public EventAsyncBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T);
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <param name="p1">[IN] An instance to be copied and passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] An instance to be copied and passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] An instance to be copied and passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] An instance to be copied and passed as fourth parameter to every function.</param>
+    /// <param name="p5">[IN] An instance to be copied and passed as fifth parameter to every function.</param>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5)
+    {
+        return this->_Enqueue(typename EventAsync::Message(p1, p2, p3, p4, p5));
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T>
+class EventAsync< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) > : public EventAsyncBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T);
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <param name="p1">[IN] An instance to be copied and passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] An instance to be copied and passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] An instance to be copied and passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] An instance to be copied and passed as fourth parameter to every function.</param>
+    /// <param name="p5">[IN] An instance to be copied and passed as fifth parameter to every function.</param>
+    /// <param name="p6">[IN] An instance to be copied and passed as sixth parameter to every function.</param>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6)
+    {
+        return this->_Enqueue(typename EventAsync::Message(p1, p2, p3, p4, p5, p6));
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param7T">The type of the seventh parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T>
+class EventAsync< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) > : public EventAsyncBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <param name="p1">[IN] An instance to be copied and passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] An instance to be copied and passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] An instance to be copied and passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] An instance to be copied and passed as fourth parameter to every function.</param>
+    /// <param name="p5">[IN] An instance to be copied and passed as fifth parameter to every function.</param>
+    /// <param name="p6">[IN] An instance to be copied and passed as sixth parameter to every function.</param>
+    /// <param name="p7">[IN] An instance to be copied and passed as seventh parameter to every function.</param>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7)
+    {
+        return this->_Enqueue(typename EventAsync::Message(p1, p2, p3, p4, p5, p6, p7));
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, whose subscribers are called asynchronously by dedicated dispatcher threads. 
+/// When an event is raised, a copy of the arguments is queued and the raising thread continues; then all the functions subscribed to it will be called 
+/// using the copy of the arguments.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param7T">The type of the seventh parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param8T">The type of the eighth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T>
+class EventAsync< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) > : public EventAsyncBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+    typedef typename EventAsyncBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventAsyncBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the queue and how raises are dispatched, and starts the dispatcher threads.
+    /// </summary>
+    /// <param name="uQueueCapacity">[IN] The maximum number of pending raises. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    /// <param name="eQueueFullPolicy">[Optional][IN] What to do when an event is raised and the queue is full. By default, the raising thread waits.</param>
+    /// <param name="uBatchSize">[Optional][IN] The maximum number of messages a dispatcher thread extracts from the queue at once. It must be greater than zero. By default, 32.</param>
+    /// <param name="bCoalesce">[Optional][IN] Indicates whether only the last message of every batch is dispatched. By default, all of them are dispatched.</param>
+    /// <param name="uDispatcherCount">[Optional][IN] The number of dispatcher threads. It must be greater than zero. When there is more than one, raises may 
+    /// be dispatched in a different order and the same subscriber may be called by several threads at the same time. By default, 1.</param>
+    explicit EventAsync(const puint_z uQueueCapacity,
+                        const EQueueFullPolicy &eQueueFullPolicy=EQueueFullPolicy::E_Block,
+                        const puint_z uBatchSize=32U,
+                        const bool bCoalesce=false,
+                        const u32_z uDispatcherCount=1U) : EventAsyncBase<FunctionSignatureT>(uQueueCapacity, eQueueFullPolicy, uBatchSize, bCoalesce, uDispatcherCount)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Queues a copy of the provided arguments, if any, so the dispatcher threads call every subscribed function in FIFO order.
+    /// </summary>
+    /// <remarks>
+    /// If the queue is full, the calling thread may wait depending on the policy. It must not be called by a subscriber if the policy is E_Block.
+    /// </remarks>
+    /// <param name="p1">[IN] An instance to be copied and passed as first parameter to every function.</param>
+    /// <param name="p2">[IN] An instance to be copied and passed as second parameter to every function.</param>
+    /// <param name="p3">[IN] An instance to be copied and passed as third parameter to every function.</param>
+    /// <param name="p4">[IN] An instance to be copied and passed as fourth parameter to every function.</param>
+    /// <param name="p5">[IN] An instance to be copied and passed as fifth parameter to every function.</param>
+    /// <param name="p6">[IN] An instance to be copied and passed as sixth parameter to every function.</param>
+    /// <param name="p7">[IN] An instance to be copied and passed as seventh parameter to every function.</param>
+    /// <param name="p8">[IN] An instance to be copied and passed as eighth parameter to every function.</param>
+    /// <returns>
+    /// True if the raise was queued; False if it was discarded because the queue was full.
+    /// </returns>
+    bool Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8)
+    {
+        return this->_Enqueue(typename EventAsync::Message(p1, p2, p3, p4, p5, p6, p7, p8));
+    }
+};
+
+} // namespace z
+
+#endif // __EVENTASYNC__
@@ -0,0 +1,996 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+
+#ifndef __EVENTCONCURRENT__
+#define __EVENTCONCURRENT__
+
+#include "ZContainers/ContainersModuleDefinitions.h"
+#include "ZContainers/ArrayDynamic.h"
+#include "ZMemory/InlineAllocator.h"
+#include "ZCommon/Delegate.h"
+#include "ZContainers/SEqualityComparator.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include <boost/atomic.hpp>
+
+
+namespace z
+{
+
+/// <summary>
+/// Base class for the thread-safe events, which contains the management of the subscribers and the reclamation of the discarded lists of subscribers.
+/// </summary>
+/// <remarks>
+/// The subscribers are stored in an immutable list (a snapshot) that is replaced as a whole every time a function is subscribed or unsubscribed. Raising 
+/// the event only requires registering the calling thread as a reader and loading the current snapshot, both lock-free; subscribing and unsubscribing 
+/// lock a mutex to serialize the creation of new snapshots.<br/>
+/// Replaced snapshots cannot be deleted while a thread may still be calling their subscribers, so they are retired and deleted later (epoch-based reclamation). 
+/// There are 3 epochs, each of them with a counter of the readers registered in it; the current epoch can only advance when no reader remains in 
+/// the previous one, and snapshots retired in an epoch are deleted once the current epoch has advanced twice since then. Epochs only advance when the 
+/// list of subscribers changes, so up to two retired snapshots may remain alive until the next change or the destruction of the event.
+/// </remarks>
+/// <typeparam name="FunctionSignatureT">The signature of the functions that subscribe to the event.</typeparam>
+template<typename FunctionSignatureT>
+class EventConcurrentBase
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef Delegate<FunctionSignatureT> Subscriber;
+    typedef ArrayDynamic<Subscriber, 
+                         InlineAllocator<Subscriber, 4U>, 
+                         SEqualityComparator<Subscriber> > 
+                            SubscriberArray;
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The number of epochs used for reclaiming retired snapshots.
+    /// </summary>
+    static const u32_z EPOCH_COUNT = 3U;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// An immutable list of subscribers, shared by all the threads that raise the event while it is the current one.
+    /// </summary>
+    class Snapshot
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the list of subscribers.
+        /// </summary>
+        /// <param name="arSubscribers">[IN] The subscribers to be copied.</param>
+        explicit Snapshot(const SubscriberArray &arSubscribers) : m_arSubscribers(arSubscribers),
+                                                                  m_pNextRetired(null_z)
+        {
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The list of subscribed functions.
+        /// </summary>
+        SubscriberArray m_arSubscribers;
+
+        /// <summary>
+        /// The next snapshot retired in the same epoch, if any.
+        /// </summary>
+        Snapshot* m_pNextRetired;
+    };
+
+    /// <summary>
+    /// A counter of the readers registered in an epoch, which occupies its own cache line so readers of different epochs do not interfere.
+    /// </summary>
+    class ReaderCounter
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        ReaderCounter() : m_uCount(0)
+        {
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The number of readers.
+        /// </summary>
+        boost::atomic<u32_z> m_uCount;
+
+        /// <summary>
+        /// Unused space up to the size of a cache line.
+        /// </summary>
+        u8_z m_arPadding[Z_CACHE_LINE_SIZE - sizeof(boost::atomic<u32_z>)];
+    };
+
+    /// <summary>
+    /// Registers the calling thread as a reader of the event and gets the current snapshot, until the instance is destroyed.
+    /// </summary>
+    class ReadSection
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that registers the calling thread as a reader in the current epoch.
+        /// </summary>
+        /// <param name="event">[IN] The event to be read.</param>
+        explicit ReadSection(const EventConcurrentBase &event) : m_event(event)
+        {
+            // The epoch is read again after registering so the reader is registered in the epoch that was current when the snapshot is loaded
+            u32_z uEpoch = event.m_uEpoch.load();
+            event.m_arReaderCounters[uEpoch].m_uCount.fetch_add(1U);
+
+            u32_z uCurrentEpoch = event.m_uEpoch.load();
+
+            while(uCurrentEpoch != uEpoch)
+            {
+                event.m_arReaderCounters[uCurrentEpoch].m_uCount.fetch_add(1U);
+                event.m_arReaderCounters[uEpoch].m_uCount.fetch_sub(1U);
+                uEpoch = uCurrentEpoch;
+                uCurrentEpoch = event.m_uEpoch.load();
+            }
+
+            m_uEpoch = uEpoch;
+            m_pSnapshot = event.m_pSnapshot.load();
+        }
+
+    private:
+
+        // Hidden
+        ReadSection(const ReadSection&);
+
+
+        // DESTRUCTOR
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Destructor that unregisters the calling thread.
+        /// </summary>
+        ~ReadSection()
+        {
+            m_event.m_arReaderCounters[m_uEpoch].m_uCount.fetch_sub(1U, boost::memory_order_release);
+        }
+
+
+        // METHODS
+        // ---------------
+    private:
+
+        // Hidden
+        ReadSection& operator=(const ReadSection&);
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the snapshot that was current when the thread was registered. It cannot be deleted until the instance is destroyed.
+        /// </summary>
+        /// <returns>
+        /// The snapshot. It is null when there are no subscribers.
+        /// </returns>
+        const Snapshot* GetSnapshot() const
+        {
+            return m_pSnapshot;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The event being read.
+        /// </summary>
+        const EventConcurrentBase &m_event;
+
+        /// <summary>
+        /// The epoch in which the thread is registered.
+        /// </summary>
+        u32_z m_uEpoch;
+
+        /// <summary>
+        /// The current snapshot when the thread was registered.
+        /// </summary>
+        const Snapshot* m_pSnapshot;
+    };
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventConcurrentBase() : m_pSnapshot(null_z),
+                            m_uEpoch(0)
+    {
+        for(u32_z i = 0; i < EventConcurrentBase::EPOCH_COUNT; ++i)
+            m_arRetiredSnapshots[i] = null_z;
+    }
+
+private:
+
+    // Hidden
+    EventConcurrentBase(const EventConcurrentBase&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. No thread can be using the event.
+    /// </summary>
+    ~EventConcurrentBase()
+    {
+        delete m_pSnapshot.load(boost::memory_order_relaxed);
+
+        for(u32_z i = 0; i < EventConcurrentBase::EPOCH_COUNT; ++i)
+            EventConcurrentBase::_DeleteSnapshots(m_arRetiredSnapshots[i]);
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    EventConcurrentBase& operator=(const EventConcurrentBase&);
+
+public:
+
+    /// <summary>
+    /// Subscribes a function to the event.
+    /// </summary>
+    /// <remarks>
+    /// It can be called while other threads are raising the event, even from a subscribed function. Threads that are already raising the event
+    /// will not call the new subscriber.
+    /// </remarks>
+    /// <param name="subscriber">[IN] A function to subscribe. It should not be already subscribed. It must not be null.</param>
+    void operator+=(const Subscriber &subscriber)
+    {
+        Z_ASSERT_ERROR(!subscriber.IsNull(), "The input function must not be null.");
+
+        ScopedExclusiveLock<> lock(m_writerMutex);
+
+        const Snapshot* pCurrentSnapshot = m_pSnapshot.load(boost::memory_order_relaxed);
+
+        Z_ASSERT_WARNING(pCurrentSnapshot == null_z || !pCurrentSnapshot->m_arSubscribers.Contains(subscriber), "The input function is already subscribed to the event.");
+
+        Snapshot* pNewSnapshot = pCurrentSnapshot == null_z ? new Snapshot(SubscriberArray()) :
+                                                              new Snapshot(pCurrentSnapshot->m_arSubscribers);
+        pNewSnapshot->m_arSubscribers.Add(subscriber);
+
+        this->_Publish(pNewSnapshot);
+    }
+    
+    /// <summary>
+    /// Unsubscribes a function from the event.
+    /// </summary>
+    /// <remarks>
+    /// It can be called while other threads are raising the event, even from a subscribed function. Threads that are already raising the event
+    /// may still call the removed subscriber.
+    /// </remarks>
+    /// <param name="subscriber">[IN] A function to unsubscribe. It must be already subscribed. It must not be null.</param>
+    void operator-=(const Subscriber &subscriber)
+    {
+        Z_ASSERT_ERROR(!subscriber.IsNull(), "The input function must not be null.");
+
+        ScopedExclusiveLock<> lock(m_writerMutex);
+
+        const Snapshot* pCurrentSnapshot = m_pSnapshot.load(boost::memory_order_relaxed);
+        const puint_z INDEX = pCurrentSnapshot == null_z ? SubscriberArray::ELEMENT_NOT_FOUND :
+                                                           pCurrentSnapshot->m_arSubscribers.IndexOf(subscriber);
+
+        Z_ASSERT_WARNING(INDEX != SubscriberArray::ELEMENT_NOT_FOUND, "The input function cannot be removed, it is not subscribed to the event.");
+
+        if(INDEX != SubscriberArray::ELEMENT_NOT_FOUND)
+        {
+            Snapshot* pNewSnapshot = null_z;
+
+            if(pCurrentSnapshot->m_arSubscribers.GetCount() > 1U)
+            {
+                pNewSnapshot = new Snapshot(pCurrentSnapshot->m_arSubscribers);
+                pNewSnapshot->m_arSubscribers.Remove(INDEX);
+            }
+
+            this->_Publish(pNewSnapshot);
+        }
+    }
+
+    /// <summary>
+    /// Unsubscribes all the subscribed functions.
+    /// </summary>
+    void UnsubscribeAll()
+    {
+        ScopedExclusiveLock<> lock(m_writerMutex);
+
+        if(m_pSnapshot.load(boost::memory_order_relaxed) != null_z)
+            this->_Publish(null_z);
+    }
+
+protected:
+
+    /// <summary>
+    /// Replaces the current snapshot, retires the previous one and deletes the retired snapshots that no thread can be reading.
+    /// </summary>
+    /// <remarks>
+    /// The writer mutex must be locked.
+    /// </remarks>
+    /// <param name="pNewSnapshot">[IN] The new snapshot. It may be null if there are no subscribers.</param>
+    void _Publish(Snapshot* pNewSnapshot)
+    {
+        Snapshot* pPreviousSnapshot = m_pSnapshot.exchange(pNewSnapshot);
+
+        if(pPreviousSnapshot != null_z)
+        {
+            const u32_z EPOCH = m_uEpoch.load(boost::memory_order_relaxed);
+            pPreviousSnapshot->m_pNextRetired = m_arRetiredSnapshots[EPOCH];
+            m_arRetiredSnapshots[EPOCH] = pPreviousSnapshot;
+        }
+
+        // Two advances are enough for the snapshot retired now to be deleted if no thread is raising the event
+        if(this->_TryAdvanceEpoch())
+            this->_TryAdvanceEpoch();
+    }
+
+    /// <summary>
+    /// Makes the next epoch the current one, if no reader remains in the previous epoch, and deletes the snapshots retired in the previous epoch.
+    /// </summary>
+    /// <remarks>
+    /// The writer mutex must be locked.
+    /// </remarks>
+    /// <returns>
+    /// True if the epoch advanced; False otherwise.
+    /// </returns>
+    bool _TryAdvanceEpoch()
+    {
+        const u32_z EPOCH = m_uEpoch.load(boost::memory_order_relaxed);
+        const u32_z PREVIOUS_EPOCH = (EPOCH + EventConcurrentBase::EPOCH_COUNT - 1U) % EventConcurrentBase::EPOCH_COUNT;
+
+        bool bAdvanced = false;
+
+        if(m_arReaderCounters[PREVIOUS_EPOCH].m_uCount.load() == 0)
+        {
+            // Readers of the previous epoch have finished and those of the current epoch cannot load snapshots retired before it,
+            // so snapshots retired in the previous epoch are unreachable; the previous epoch becomes the next one
+            m_uEpoch.store((EPOCH + 1U) % EventConcurrentBase::EPOCH_COUNT);
+            EventConcurrentBase::_DeleteSnapshots(m_arRetiredSnapshots[PREVIOUS_EPOCH]);
+            m_arRetiredSnapshots[PREVIOUS_EPOCH] = null_z;
+            bAdvanced = true;
+        }
+
+        return bAdvanced;
+    }
+
+    /// <summary>
+    /// Deletes a list of retired snapshots.
+    /// </summary>
+    /// <param name="pSnapshot">[IN] The first snapshot of the list. It may be null.</param>
+    static void _DeleteSnapshots(Snapshot* pSnapshot)
+    {
+        while(pSnapshot != null_z)
+        {
+            Snapshot* pNextSnapshot = pSnapshot->m_pNextRetired;
+            delete pSnapshot;
+            pSnapshot = pNextSnapshot;
+        }
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Gets the entire list of subscribed functions.
+    /// </summary>
+    /// <returns>
+    /// A copy of the list of subscribed functions at the moment of the call.
+    /// </returns>
+    SubscriberArray GetSubscribers() const
+    {
+        ReadSection section(*this);
+        const Snapshot* pSnapshot = section.GetSnapshot();
+
+        return pSnapshot == null_z ? SubscriberArray() : pSnapshot->m_arSubscribers;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The current snapshot of the subscribers. It is null when there are no subscribers.
+    /// </summary>
+    boost::atomic<Snapshot*> m_pSnapshot;
+
+    /// <summary>
+    /// The current epoch, from 0 to EPOCH_COUNT - 1.
+    /// </summary>
+    boost::atomic<u32_z> m_uEpoch;
+
+    /// <summary>
+    /// The number of readers registered in every epoch.
+    /// </summary>
+    mutable ReaderCounter m_arReaderCounters[EPOCH_COUNT];
+
+    /// <summary>
+    /// The lists of snapshots retired in every epoch.
+    /// </summary>
+    Snapshot* m_arRetiredSnapshots[EPOCH_COUNT];
+
+    /// <summary>
+    /// The mutex that serializes the changes of the list of subscribers.
+    /// </summary>
+    Mutex m_writerMutex;
+};
+
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Raising the event does not lock any mutex and does not copy the list of subscribers, which makes it appropriate for events that are raised 
+/// frequently and whose subscribers change rarely. Every change of the subscribers copies the list.<br/>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="FunctionSignatureT">The signature of the functions that subscribe to the event.</typeparam>
+template<typename FunctionSignatureT>
+class EventConcurrent;
+
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT>
+class EventConcurrent< ReturnValueT(void) > : public EventConcurrentBase< ReturnValueT(void) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)();
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    void Raise() const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i]();
+        }
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T>
+class EventConcurrent< ReturnValueT(Param1T) > : public EventConcurrentBase< ReturnValueT(Param1T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T);
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as parameter to every function.</param>
+    void Raise(Param1T p1) const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i](p1);
+        }
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T>
+class EventConcurrent< ReturnValueT(Param1T, Param2T) > : public EventConcurrentBase< ReturnValueT(Param1T, Param2T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T);
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2) const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i](p1, p2);
+        }
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T>
+class EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T) > : public EventConcurrentBase< ReturnValueT(Param1T, Param2T, Param3T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T);
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3) const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i](p1, p2, p3);
+        }
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T>
+class EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T) > : public EventConcurrentBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T);
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4) const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i](p1, p2, p3, p4);
+        }
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T>
+class EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T) > : public EventConcurrentBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T);
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">An instance to be passed as fifth parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5) const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i](p1, p2, p3, p4, p5);
+        }
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T>
+class EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) > : public EventConcurrentBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T);
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">An instance to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">An instance to be passed as sixth parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6) const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i](p1, p2, p3, p4, p5, p6);
+        }
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param7T">The type of the seventh parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T>
+class EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) > : public EventConcurrentBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T);
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">An instance to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">An instance to be passed as sixth parameter to every function.</param>
+    /// <param name="p7">An instance to be passed as seventh parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7) const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i](p1, p2, p3, p4, p5, p6, p7);
+        }
+    }
+};
+
+/// <summary>
+/// Represents an event to which other components can subscribe, which can be raised, subscribed and unsubscribed by several threads at the same time. 
+/// When an event is raised, all the functions subscribed to it will be called using the arguments passed by the caller.
+/// </summary>
+/// <remarks>
+/// Recommended function signatures for event subscribers are:<br/>
+/// void f(arguments in an structure)<br/>
+/// void f(publisher object, arguments in an structure)
+/// </remarks>
+/// <typeparam name="ReturnValueT">The return type of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param1T">The type of the first parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param2T">The type of the second parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param3T">The type of the third parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param4T">The type of the fourth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param5T">The type of the fifth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param6T">The type of the sixth parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param7T">The type of the seventh parameter of the functions that subscribe to the event.</typeparam>
+/// <typeparam name="Param8T">The type of the eighth parameter of the functions that subscribe to the event.</typeparam>
+template<class ReturnValueT, class Param1T, class Param2T, class Param3T, class Param4T, class Param5T, class Param6T, class Param7T, class Param8T>
+class EventConcurrent< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) > : public EventConcurrentBase< ReturnValueT(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T) >
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    typedef ReturnValueT(FunctionSignatureT)(Param1T, Param2T, Param3T, Param4T, Param5T, Param6T, Param7T, Param8T);
+    typedef typename EventConcurrentBase<FunctionSignatureT>::Subscriber Subscriber;
+    typedef typename EventConcurrentBase<FunctionSignatureT>::SubscriberArray SubscriberArray;
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calls every subscribed function in FIFO order, passing them the same instance of the provided arguments if any.
+    /// </summary>
+    /// <remarks>
+    /// The subscribers called are those subscribed when the method starts, regardless of changes made meanwhile.
+    /// </remarks>
+    /// <param name="p1">An instance to be passed as first parameter to every function.</param>
+    /// <param name="p2">An instance to be passed as second parameter to every function.</param>
+    /// <param name="p3">An instance to be passed as third parameter to every function.</param>
+    /// <param name="p4">An instance to be passed as fourth parameter to every function.</param>
+    /// <param name="p5">An instance to be passed as fifth parameter to every function.</param>
+    /// <param name="p6">An instance to be passed as sixth parameter to every function.</param>
+    /// <param name="p7">An instance to be passed as seventh parameter to every function.</param>
+    /// <param name="p8">An instance to be passed as eighth parameter to every function.</param>
+    void Raise(Param1T p1, Param2T p2, Param3T p3, Param4T p4, Param5T p5, Param6T p6, Param7T p7, Param8T p8) const
+    {
+        typename EventConcurrent::ReadSection section(*this);
+        const typename EventConcurrent::Snapshot* pSnapshot = section.GetSnapshot();
+
+        if(pSnapshot != null_z)
+        {
+            const puint_z COUNT = pSnapshot->m_arSubscribers.GetCount();
+
+            for(puint_z i = 0; i < COUNT; ++i)
+                pSnapshot->m_arSubscribers[i](p1, p2, p3, p4, p5, p6, p7, p8);
+        }
+    }
+};
+
+} // namespace z
+
+#endif // __EVENTCONCURRENT__
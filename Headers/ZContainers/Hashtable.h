@@ -990,6 +990,21 @@ public:
         m_slots.Clone(destinationHashtable.m_slots);
         m_arBuckets.Clone(destinationHashtable.m_arBuckets);
     }
+
+    /// <summary>
+    /// Exchanges the key-value pairs and the capacity of two hashtables.
+    /// </summary>
+    /// <remarks>
+    /// It is the cheapest way to transfer the content of a hashtable to another, since neither copy constructors, nor assignment operators nor destructors 
+    /// are called and no memory is copied, regardless of the number of key-value pairs.<br/>
+    /// Iterators keep pointing to the same hashtable and positions, so they may become invalid.
+    /// </remarks>
+    /// <param name="hashtable">[IN/OUT] The hashtable whose key-value pairs will be exchanged with the resident hashtable's. It can be the resident hashtable.</param>
+    void Swap(Hashtable &hashtable)
+    {
+        m_arBuckets.Swap(hashtable.m_arBuckets);
+        m_slots.Swap(hashtable.m_slots);
+    }
    
 
     // PROPERTIES
@@ -0,0 +1,761 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __INDEXEDPRIORITYQUEUE__
+#define __INDEXEDPRIORITYQUEUE__
+
+#include "ZContainers/ContainersModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Assertions.h"
+#include "ZContainers/ArrayDynamic.h"
+#include "ZContainers/SComparatorDefault.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a queue whose elements are extracted in order of priority, according to a comparator, and that can be accessed, updated and 
+/// removed through handles. The element with the highest priority is the lowest one (the one that goes first when sorting in ascending order).
+/// </summary>
+/// <remarks>
+/// Elements are stored contiguously in memory as a d-ary heap, like in PriorityQueue. Besides, every element has a slot that stores its current 
+/// position in the heap, so the element identified by a handle is found in constant time and its priority can be changed (for example, decreasing 
+/// the distance of a node in graph searches) or the element can be removed in logarithmic time.<br/>
+/// Every slot has a generation number that changes when its element is removed and when the slot is reused, being odd while the slot is free, so 
+/// handles of removed elements are detected even if the slot has been reused, until the generation wraps around after 2^31 reuses.<br/>
+/// Elements with the same priority are extracted in an undefined order.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.
+/// </remarks>
+/// <typeparam name="T">The type of every element.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements. By default, ContiguousAllocator will be used.</typeparam>
+/// <typeparam name="ComparatorT">Optional. The type of comparator that establishes the priority of elements. By default, SComparatorDefault will 
+/// be used, so the lowest element is extracted first.</typeparam>
+/// <typeparam name="ARITY">Optional. The maximum number of children of every node of the heap. It must be greater than 1. By default, 4.</typeparam>
+template<class T, class AllocatorT = ContiguousAllocator, class ComparatorT = SComparatorDefault<T>, unsigned int ARITY = 4U>
+class IndexedPriorityQueue
+{
+    // INTERNAL CLASSES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Identifies an element of an indexed priority queue while it is not removed.
+    /// </summary>
+    /// <remarks>
+    /// Handles are returned by IndexedPriorityQueue::Push. A default-constructed handle does not identify any element.
+    /// </remarks>
+    class Handle
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor that creates a handle that does not identify any element.
+        /// </summary>
+        Handle() : m_uSlot(IndexedPriorityQueue::END_POSITION),
+                   m_uGeneration(0)
+        {
+        }
+
+        /// <summary>
+        /// Constructor that receives the slot and its generation.
+        /// </summary>
+        /// <param name="uSlot">[IN] The position of the slot.</param>
+        /// <param name="uGeneration">[IN] The generation of the slot when the element was added.</param>
+        Handle(const u32_z uSlot, const u32_z uGeneration) : m_uSlot(uSlot),
+                                                              m_uGeneration(uGeneration)
+        {
+        }
+
+
+        // METHODS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Equality operator that checks whether two handles identify the same element.
+        /// </summary>
+        /// <param name="handle">[IN] The other handle.</param>
+        /// <returns>
+        /// True if both handles have the same slot and generation; False otherwise.
+        /// </returns>
+        bool operator==(const Handle &handle) const
+        {
+            return m_uSlot == handle.m_uSlot && m_uGeneration == handle.m_uGeneration;
+        }
+
+        /// <summary>
+        /// Inequality operator that checks whether two handles identify different elements.
+        /// </summary>
+        /// <param name="handle">[IN] The other handle.</param>
+        /// <returns>
+        /// True if the handles have different slot or generation; False otherwise.
+        /// </returns>
+        bool operator!=(const Handle &handle) const
+        {
+            return !(*this == handle);
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the position of the slot.
+        /// </summary>
+        /// <returns>
+        /// The position of the slot.
+        /// </returns>
+        u32_z GetSlot() const
+        {
+            return m_uSlot;
+        }
+
+        /// <summary>
+        /// Gets the generation of the slot when the element was added.
+        /// </summary>
+        /// <returns>
+        /// The generation number.
+        /// </returns>
+        u32_z GetGeneration() const
+        {
+            return m_uGeneration;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The position of the slot.
+        /// </summary>
+        u32_z m_uSlot;
+
+        /// <summary>
+        /// The generation of the slot when the element was added.
+        /// </summary>
+        u32_z m_uGeneration;
+    };
+
+protected:
+
+    /// <summary>
+    /// Stores the generation of a slot and either the position of its element in the heap or, if the slot is free, the position of the next free slot.
+    /// </summary>
+    class Slot
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the generation and the position.
+        /// </summary>
+        /// <param name="uGeneration">[IN] The generation of the slot.</param>
+        /// <param name="uPosition">[IN] The position of the element in the heap or the position of the next free slot.</param>
+        Slot(const u32_z uGeneration, const u32_z uPosition) : m_uGeneration(uGeneration),
+                                                                m_uPosition(uPosition)
+        {
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the generation of the slot.
+        /// </summary>
+        /// <returns>
+        /// The generation number.
+        /// </returns>
+        u32_z GetGeneration() const
+        {
+            return m_uGeneration;
+        }
+
+        /// <summary>
+        /// Sets the generation of the slot.
+        /// </summary>
+        /// <param name="uGeneration">[IN] The generation number.</param>
+        void SetGeneration(const u32_z uGeneration)
+        {
+            m_uGeneration = uGeneration;
+        }
+
+        /// <summary>
+        /// Indicates whether the slot is free, which happens when its generation is odd.
+        /// </summary>
+        /// <returns>
+        /// True if the slot does not store the position of any element; False otherwise.
+        /// </returns>
+        bool IsFree() const
+        {
+            return (m_uGeneration & 1U) != 0;
+        }
+
+        /// <summary>
+        /// Gets the position of the element in the heap or, if the slot is free, the position of the next free slot.
+        /// </summary>
+        /// <returns>
+        /// The position.
+        /// </returns>
+        u32_z GetPosition() const
+        {
+            return m_uPosition;
+        }
+
+        /// <summary>
+        /// Sets the position of the element in the heap or, if the slot is free, the position of the next free slot.
+        /// </summary>
+        /// <param name="uPosition">[IN] The position.</param>
+        void SetPosition(const u32_z uPosition)
+        {
+            m_uPosition = uPosition;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The generation of the slot, which changes every time its element is removed or it is reused. It is odd while the slot is free.
+        /// </summary>
+        u32_z m_uGeneration;
+
+        /// <summary>
+        /// The position of the element in the heap or the position of the next free slot.
+        /// </summary>
+        u32_z m_uPosition;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Constant to symbolize the end of the list of free slots, or a handle that does not point to any slot.
+    /// </summary>
+    static const u32_z END_POSITION = -1;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    IndexedPriorityQueue() : m_uFirstFreeSlot(IndexedPriorityQueue::END_POSITION)
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory. It must be greater than zero.</param>
+    explicit IndexedPriorityQueue(const puint_z uInitialCapacity) : m_arElements(uInitialCapacity),
+                                                                      m_arElementSlots(uInitialCapacity),
+                                                                      m_arSlots(uInitialCapacity),
+                                                                      m_uFirstFreeSlot(IndexedPriorityQueue::END_POSITION)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Adds an element to the queue and gets a handle that identifies it.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity is exceeded, a reallocation will take place, which will make any existing pointer invalid, although handles remain valid.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    /// <returns>
+    /// The handle that identifies the new element.
+    /// </returns>
+    Handle Push(const T &newElement)
+    {
+        const Handle NEW_HANDLE = this->_AddLast(newElement);
+        this->_SiftUp(m_arElements.GetCount() - 1U);
+        return NEW_HANDLE;
+    }
+
+    /// <summary>
+    /// Adds a sequence of elements to the queue.
+    /// </summary>
+    /// <remarks>
+    /// When the number of added elements is greater than the number of elements in the queue, the whole heap is rearranged in linear time; 
+    /// otherwise, elements are placed one by one.<br/>
+    /// The copy constructor of every element will be called.
+    /// </remarks>
+    /// <param name="arElements">[IN] The elements to be copied. It must not be null.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the input sequence.</param>
+    /// <param name="arHandles">[OUT] Optional. The array where the handle of every element will be stored, in the same order. If it is null, 
+    /// handles are not returned.</param>
+    void PushRange(const T* arElements, const puint_z uNumberOfElements, Handle* arHandles)
+    {
+        Z_ASSERT_ERROR(arElements != null_z, "The input sequence cannot be null.");
+
+        const puint_z PREVIOUS_COUNT = m_arElements.GetCount();
+        this->Reserve(PREVIOUS_COUNT + uNumberOfElements);
+
+        for(puint_z i = 0; i < uNumberOfElements; ++i)
+        {
+            const Handle NEW_HANDLE = this->_AddLast(arElements[i]);
+
+            if(arHandles != null_z)
+                arHandles[i] = NEW_HANDLE;
+        }
+
+        if(uNumberOfElements > PREVIOUS_COUNT)
+        {
+            this->_Heapify();
+        }
+        else
+        {
+            for(puint_z i = PREVIOUS_COUNT; i < m_arElements.GetCount(); ++i)
+                this->_SiftUp(i);
+        }
+    }
+
+    /// <summary>
+    /// Removes the element with the highest priority.
+    /// </summary>
+    /// <remarks>
+    /// The handle of the element will not identify any element from now on.<br/>
+    /// The destructor of the last element of the heap will be called, after being assigned to the first position.
+    /// </remarks>
+    void Pop()
+    {
+        Z_ASSERT_ERROR(!m_arElements.IsEmpty(), "The queue is empty, there is nothing to remove.");
+
+        if(!m_arElements.IsEmpty())
+            this->_RemoveAt(0);
+    }
+
+    /// <summary>
+    /// Removes the element identified by a handle.
+    /// </summary>
+    /// <remarks>
+    /// The handle and any copy of it will not identify any element from now on. The handles of the other elements remain valid.<br/>
+    /// The destructor of the last element of the heap will be called, after being assigned to the position of the removed element.
+    /// </remarks>
+    /// <param name="handle">[IN] The handle of the element to remove. It must identify an element of the queue; otherwise, 
+    /// nothing will be done.</param>
+    void Remove(const Handle &handle)
+    {
+        Z_ASSERT_ERROR(this->Contains(handle), "The input handle does not identify any element of the queue.");
+
+        if(this->Contains(handle))
+            this->_RemoveAt(m_arSlots[handle.GetSlot()].GetPosition());
+    }
+
+    /// <summary>
+    /// Replaces the element identified by a handle, changing its priority.
+    /// </summary>
+    /// <remarks>
+    /// It can be used to either increase or decrease the priority of the element (for example, the decrease-key operation in graph searches). 
+    /// The handle remains valid.<br/>
+    /// The assignment operator of the element will be called.
+    /// </remarks>
+    /// <param name="handle">[IN] The handle of the element. It must identify an element of the queue; otherwise, nothing will be done.</param>
+    /// <param name="newValue">[IN] The new value of the element.</param>
+    void Update(const Handle &handle, const T &newValue)
+    {
+        Z_ASSERT_ERROR(this->Contains(handle), "The input handle does not identify any element of the queue.");
+
+        if(this->Contains(handle))
+        {
+            const puint_z POSITION = m_arSlots[handle.GetSlot()].GetPosition();
+            m_arElements[POSITION] = newValue;
+            this->_Restore(POSITION);
+        }
+    }
+
+    /// <summary>
+    /// Checks whether a handle identifies an element of the queue.
+    /// </summary>
+    /// <param name="handle">[IN] The handle to check.</param>
+    /// <returns>
+    /// True if the element has not been removed; False if it has been removed or the handle does not belong to the queue.
+    /// </returns>
+    bool Contains(const Handle &handle) const
+    {
+        // Free slots are rejected since their position is the next free slot, even if the handle was not returned by the queue
+        return handle.GetSlot() < m_arSlots.GetCount() && 
+               !m_arSlots[handle.GetSlot()].IsFree() && 
+               m_arSlots[handle.GetSlot()].GetGeneration() == handle.GetGeneration();
+    }
+
+    /// <summary>
+    /// Gets the element identified by a handle.
+    /// </summary>
+    /// <param name="handle">[IN] The handle of the element. It must identify an element of the queue.</param>
+    /// <returns>
+    /// A reference to the element. Use Update to change its priority.
+    /// </returns>
+    const T& GetValue(const Handle &handle) const
+    {
+        Z_ASSERT_ERROR(this->Contains(handle), "The input handle does not identify any element of the queue.");
+
+        return m_arElements[m_arSlots[handle.GetSlot()].GetPosition()];
+    }
+
+    /// <summary>
+    /// Removes all the elements.
+    /// </summary>
+    /// <remarks>
+    /// No existing handle will identify any element from now on.<br/>
+    /// The destructor of every element will be called. The capacity does not change.
+    /// </remarks>
+    void Clear()
+    {
+        for(puint_z i = 0; i < m_arElementSlots.GetCount(); ++i)
+            this->_ReleaseSlot(m_arElementSlots[i]);
+
+        m_arElements.Clear();
+        m_arElementSlots.Clear();
+    }
+
+    /// <summary>
+    /// Increases the capacity, reserving memory for more elements.
+    /// </summary>
+    /// <remarks>
+    /// This operation implies a reallocation, which means that any pointer to elements will be pointing to garbage. Handles remain valid.
+    /// </remarks>
+    /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void Reserve(const puint_z uNumberOfElements)
+    {
+        m_arElements.Reserve(uNumberOfElements);
+        m_arElementSlots.Reserve(uNumberOfElements);
+        m_arSlots.Reserve(uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Exchanges the elements of two queues.
+    /// </summary>
+    /// <remarks>
+    /// Handles will identify the same elements, which will belong to the other queue.
+    /// </remarks>
+    /// <param name="queue">[IN/OUT] The queue whose elements will be exchanged with the resident queue's.</param>
+    void Swap(IndexedPriorityQueue &queue)
+    {
+        m_arElements.Swap(queue.m_arElements);
+        m_arElementSlots.Swap(queue.m_arElementSlots);
+        m_arSlots.Swap(queue.m_arSlots);
+
+        const u32_z FIRST_FREE_SLOT = m_uFirstFreeSlot;
+        m_uFirstFreeSlot = queue.m_uFirstFreeSlot;
+        queue.m_uFirstFreeSlot = FIRST_FREE_SLOT;
+    }
+
+private:
+
+    /// <summary>
+    /// Adds an element to the end of the heap, assigning it a free slot, without restoring the order of the heap.
+    /// </summary>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    /// <returns>
+    /// The handle that identifies the new element.
+    /// </returns>
+    Handle _AddLast(const T &newElement)
+    {
+        const u32_z ELEMENT_POSITION = scast_z(m_arElements.GetCount(), u32_z);
+        u32_z uSlot = m_uFirstFreeSlot;
+
+        if(uSlot == IndexedPriorityQueue::END_POSITION)
+        {
+            Z_ASSERT_ERROR(m_arSlots.GetCount() < IndexedPriorityQueue::END_POSITION, "The maximum number of slots has been reached.");
+
+            uSlot = scast_z(m_arSlots.GetCount(), u32_z);
+            m_arSlots.Add(Slot(0, ELEMENT_POSITION));
+        }
+        else
+        {
+            // The first free slot is reused, its generation becomes even again
+            Slot &slot = m_arSlots[uSlot];
+            m_uFirstFreeSlot = slot.GetPosition();
+            slot.SetGeneration(slot.GetGeneration() + 1U);
+            slot.SetPosition(ELEMENT_POSITION);
+        }
+
+        m_arElements.Add(newElement);
+        m_arElementSlots.Add(uSlot);
+
+        return Handle(uSlot, m_arSlots[uSlot].GetGeneration());
+    }
+
+    /// <summary>
+    /// Removes the element at a position of the heap, moving the last element to its position and restoring the order of the heap.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element in the heap.</param>
+    void _RemoveAt(const puint_z uPosition)
+    {
+        const puint_z LAST_POSITION = m_arElements.GetCount() - 1U;
+        this->_ReleaseSlot(m_arElementSlots[uPosition]);
+
+        if(uPosition != LAST_POSITION)
+        {
+            m_arElements[uPosition] = m_arElements[LAST_POSITION];
+            m_arElementSlots[uPosition] = m_arElementSlots[LAST_POSITION];
+            m_arSlots[m_arElementSlots[uPosition]].SetPosition(scast_z(uPosition, u32_z));
+        }
+
+        m_arElements.Remove(LAST_POSITION);
+        m_arElementSlots.Remove(LAST_POSITION);
+
+        if(uPosition < LAST_POSITION)
+            this->_Restore(uPosition);
+    }
+
+    /// <summary>
+    /// Makes a slot free, changing its generation to an odd number so existing handles become invalid, and places it first in the list of free slots.
+    /// </summary>
+    /// <param name="uSlot">[IN] The position of the slot.</param>
+    void _ReleaseSlot(const u32_z uSlot)
+    {
+        Slot &slot = m_arSlots[uSlot];
+        slot.SetGeneration(slot.GetGeneration() + 1U);
+        slot.SetPosition(m_uFirstFreeSlot);
+        m_uFirstFreeSlot = uSlot;
+    }
+
+    /// <summary>
+    /// Moves an element whose value has changed up or down until the heap is ordered again.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element.</param>
+    void _Restore(const puint_z uPosition)
+    {
+        if(uPosition > 0 && ComparatorT::Compare(m_arElements[uPosition], m_arElements[(uPosition - 1U) / ARITY]) < 0)
+            this->_SiftUp(uPosition);
+        else
+            this->_SiftDown(uPosition);
+    }
+
+    /// <summary>
+    /// Moves an element towards the root of the heap while it is lower than its parent, updating the slots of the moved elements.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element.</param>
+    void _SiftUp(puint_z uPosition)
+    {
+        T* arElements = &m_arElements[0];
+        u32_z* arElementSlots = &m_arElementSlots[0];
+        const T ELEMENT = arElements[uPosition];
+        const u32_z ELEMENT_SLOT = arElementSlots[uPosition];
+
+        bool bContinue = uPosition > 0;
+
+        while(bContinue)
+        {
+            const puint_z PARENT = (uPosition - 1U) / ARITY;
+            bContinue = ComparatorT::Compare(ELEMENT, arElements[PARENT]) < 0;
+
+            if(bContinue)
+            {
+                // The parent is moved down, to the gap
+                arElements[uPosition] = arElements[PARENT];
+                arElementSlots[uPosition] = arElementSlots[PARENT];
+                m_arSlots[arElementSlots[uPosition]].SetPosition(scast_z(uPosition, u32_z));
+                uPosition = PARENT;
+                bContinue = uPosition > 0;
+            }
+        }
+
+        arElements[uPosition] = ELEMENT;
+        arElementSlots[uPosition] = ELEMENT_SLOT;
+        m_arSlots[ELEMENT_SLOT].SetPosition(scast_z(uPosition, u32_z));
+    }
+
+    /// <summary>
+    /// Moves an element towards the leaves of the heap while any of its children is lower than it, updating the slots of the moved elements.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element.</param>
+    void _SiftDown(puint_z uPosition)
+    {
+        T* arElements = &m_arElements[0];
+        u32_z* arElementSlots = &m_arElementSlots[0];
+        const puint_z COUNT = m_arElements.GetCount();
+        const T ELEMENT = arElements[uPosition];
+        const u32_z ELEMENT_SLOT = arElementSlots[uPosition];
+
+        puint_z uFirstChild = uPosition * ARITY + 1U;
+        bool bContinue = uFirstChild < COUNT;
+
+        while(bContinue)
+        {
+            const puint_z END_CHILD = COUNT - uFirstChild < ARITY ? COUNT : uFirstChild + ARITY;
+            puint_z uLowestChild = uFirstChild;
+
+            for(puint_z uChild = uFirstChild + 1U; uChild < END_CHILD; ++uChild)
+            {
+                if(ComparatorT::Compare(arElements[uChild], arElements[uLowestChild]) < 0)
+                    uLowestChild = uChild;
+            }
+
+            bContinue = ComparatorT::Compare(arElements[uLowestChild], ELEMENT) < 0;
+
+            if(bContinue)
+            {
+                // The lowest child is moved up, to the gap
+                arElements[uPosition] = arElements[uLowestChild];
+                arElementSlots[uPosition] = arElementSlots[uLowestChild];
+                m_arSlots[arElementSlots[uPosition]].SetPosition(scast_z(uPosition, u32_z));
+                uPosition = uLowestChild;
+                uFirstChild = uPosition * ARITY + 1U;
+                bContinue = uFirstChild < COUNT;
+            }
+        }
+
+        arElements[uPosition] = ELEMENT;
+        arElementSlots[uPosition] = ELEMENT_SLOT;
+        m_arSlots[ELEMENT_SLOT].SetPosition(scast_z(uPosition, u32_z));
+    }
+
+    /// <summary>
+    /// Arranges all the elements as a heap, in linear time, by sifting down every element that has children, from the last one to the root.
+    /// </summary>
+    void _Heapify()
+    {
+        const puint_z COUNT = m_arElements.GetCount();
+
+        if(COUNT > 1U)
+        {
+            puint_z uPosition = (COUNT - 2U) / ARITY + 1U;
+
+            while(uPosition > 0)
+            {
+                --uPosition;
+                this->_SiftDown(uPosition);
+            }
+        }
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the element with the highest priority, which is the next to be removed.
+    /// </summary>
+    /// <returns>
+    /// A reference to the element. Use Update to change its priority.
+    /// </returns>
+    const T& GetTop() const
+    {
+        Z_ASSERT_ERROR(!m_arElements.IsEmpty(), "The queue is empty.");
+
+        return m_arElements[0];
+    }
+
+    /// <summary>
+    /// Gets the handle of the element with the highest priority.
+    /// </summary>
+    /// <returns>
+    /// The handle of the element.
+    /// </returns>
+    Handle GetTopHandle() const
+    {
+        Z_ASSERT_ERROR(!m_arElements.IsEmpty(), "The queue is empty.");
+
+        const u32_z SLOT = m_arElementSlots[0];
+        return Handle(SLOT, m_arSlots[SLOT].GetGeneration());
+    }
+
+    /// <summary>
+    /// Gets the number of elements for which memory has been reserved.
+    /// </summary>
+    /// <returns>
+    /// The capacity.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_arElements.GetCapacity();
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the queue.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        return m_arElements.GetCount();
+    }
+
+    /// <summary>
+    /// Indicates whether the queue is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if there are no elements; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_arElements.IsEmpty();
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The elements, arranged as a heap.
+    /// </summary>
+    ArrayDynamic<T, AllocatorT, ComparatorT> m_arElements;
+
+    /// <summary>
+    /// The slot of every element of the heap, in the same order.
+    /// </summary>
+    ArrayDynamic<u32_z> m_arElementSlots;
+
+    /// <summary>
+    /// The slots, indexed by handles, that store the position of every element in the heap.
+    /// </summary>
+    ArrayDynamic<Slot> m_arSlots;
+
+    /// <summary>
+    /// The position of the first free slot, which is the last released one, or END_POSITION if there are no free slots.
+    /// </summary>
+    u32_z m_uFirstFreeSlot;
+};
+
+} // namespace z
+
+
+#endif // __INDEXEDPRIORITYQUEUE__
@@ -1387,34 +1387,70 @@ public:
     /// <param name="newElement">[IN] The element to be copied.</param>
     void Add(const T &newElement)
     {
-        if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
-        
-        puint_z uNewLinkPrevious = m_uLast;
-
-        if(this->IsEmpty())
-        {
-            // If the list is empty, there is no previous link
-            uNewLinkPrevious = List::END_POSITION_BACKWARD;
-        }
-
-        // Creates the new link
-        List::Link* pNewLastLink = new(m_linkAllocator.Allocate()) List::Link(uNewLinkPrevious, List::END_POSITION_FORWARD);
-
-        if(uNewLinkPrevious != List::END_POSITION_BACKWARD)
-        {
-            // Makes the last link point to the new link
-            List::Link* pLastLink = m_pLinkBasePointer + m_uLast;
-            pLastLink->SetNext(pNewLastLink - m_pLinkBasePointer);
-            m_uLast = pNewLastLink - m_pLinkBasePointer;
-        }
-        else
-        {
-            m_uFirst = m_uLast = pNewLastLink - m_pLinkBasePointer;
-        }
-
-        // Copies the new element
-        new(m_elementAllocator.Allocate()) T(newElement);
+        new(this->_AllocateLast()) T(newElement);
+    }
+    
+    /// <summary>
+    /// Constructs an element at the end of the list, passing no arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// Unlike Add, no temporary element is created nor copied.
+    /// </remarks>
+    void Emplace()
+    {
+        new(this->_AllocateLast()) T();
+    }
+    
+    /// <summary>
+    /// Constructs an element at the end of the list, passing an argument to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// Unlike Add, no temporary element is created nor copied.
+    /// </remarks>
+    /// <typeparam name="Arg1T">The type of the only argument of the constructor.</typeparam>
+    /// <param name="argument1">[IN] The only argument of the constructor.</param>
+    template<class Arg1T>
+    void Emplace(const Arg1T &argument1)
+    {
+        new(this->_AllocateLast()) T(argument1);
+    }
+    
+    /// <summary>
+    /// Constructs an element at the end of the list, passing two arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// Unlike Add, no temporary element is created nor copied.
+    /// </remarks>
+    /// <typeparam name="Arg1T">The type of the first argument of the constructor.</typeparam>
+    /// <typeparam name="Arg2T">The type of the second argument of the constructor.</typeparam>
+    /// <param name="argument1">[IN] The first argument of the constructor.</param>
+    /// <param name="argument2">[IN] The second argument of the constructor.</param>
+    template<class Arg1T, class Arg2T>
+    void Emplace(const Arg1T &argument1, const Arg2T &argument2)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2);
+    }
+    
+    /// <summary>
+    /// Constructs an element at the end of the list, passing three arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// Unlike Add, no temporary element is created nor copied.
+    /// </remarks>
+    /// <typeparam name="Arg1T">The type of the first argument of the constructor.</typeparam>
+    /// <typeparam name="Arg2T">The type of the second argument of the constructor.</typeparam>
+    /// <typeparam name="Arg3T">The type of the third argument of the constructor.</typeparam>
+    /// <param name="argument1">[IN] The first argument of the constructor.</param>
+    /// <param name="argument2">[IN] The second argument of the constructor.</param>
+    /// <param name="argument3">[IN] The third argument of the constructor.</param>
+    template<class Arg1T, class Arg2T, class Arg3T>
+    void Emplace(const Arg1T &argument1, const Arg2T &argument2, const Arg3T &argument3)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2, argument3);
     }
     
     /// <summary>
@@ -1862,6 +1898,35 @@ public:
         memcpy(pElementB, arBytes,   sizeof(T));
     }
     
+    /// <summary>
+    /// Exchanges the elements and the capacity of two lists.
+    /// </summary>
+    /// <remarks>
+    /// It is the cheapest way to transfer the content of a list to another, since neither copy constructors, nor assignment operators nor destructors 
+    /// are called and no memory is copied, regardless of the number of elements.<br/>
+    /// Pointers to elements remain valid, although they will point to elements of the other list. Iterators keep pointing to the same list and 
+    /// positions, so they may become invalid.
+    /// </remarks>
+    /// <param name="inputList">[IN/OUT] The list whose elements will be exchanged with the resident list's. It can be the resident list.</param>
+    void Swap(List &inputList)
+    {
+        m_elementAllocator.Swap(inputList.m_elementAllocator);
+        m_linkAllocator.Swap(inputList.m_linkAllocator);
+
+        const puint_z FIRST = m_uFirst;
+        m_uFirst = inputList.m_uFirst;
+        inputList.m_uFirst = FIRST;
+
+        const puint_z LAST = m_uLast;
+        m_uLast = inputList.m_uLast;
+        inputList.m_uLast = LAST;
+
+        m_pElementBasePointer = scast_z(m_elementAllocator.GetPointer(), T*);
+        m_pLinkBasePointer = scast_z(m_linkAllocator.GetPointer(), List::Link*);
+        inputList.m_pElementBasePointer = scast_z(inputList.m_elementAllocator.GetPointer(), T*);
+        inputList.m_pLinkBasePointer = scast_z(inputList.m_linkAllocator.GetPointer(), List::Link*);
+    }
+    
     /// <summary>
     /// Checks if any of the elements in the list is equal to a given one.
     /// </summary>
@@ -2155,6 +2220,43 @@ public:
     
 private:
 
+    /// <summary>
+    /// Reserves the memory for a new element at the end of the list and links it, increasing the capacity if necessary.
+    /// </summary>
+    /// <returns>
+    /// The address where the new element must be constructed.
+    /// </returns>
+    void* _AllocateLast()
+    {
+        if(this->GetCount() == this->GetCapacity())
+            this->_ReallocateByFactor(this->GetCapacity() + 1U);
+        
+        puint_z uNewLinkPrevious = m_uLast;
+
+        if(this->IsEmpty())
+        {
+            // If the list is empty, there is no previous link
+            uNewLinkPrevious = List::END_POSITION_BACKWARD;
+        }
+
+        // Creates the new link
+        List::Link* pNewLastLink = new(m_linkAllocator.Allocate()) List::Link(uNewLinkPrevious, List::END_POSITION_FORWARD);
+
+        if(uNewLinkPrevious != List::END_POSITION_BACKWARD)
+        {
+            // Makes the last link point to the new link
+            List::Link* pLastLink = m_pLinkBasePointer + m_uLast;
+            pLastLink->SetNext(pNewLastLink - m_pLinkBasePointer);
+            m_uLast = pNewLastLink - m_pLinkBasePointer;
+        }
+        else
+        {
+            m_uFirst = m_uLast = pNewLastLink - m_pLinkBasePointer;
+        }
+
+        return m_elementAllocator.Allocate();
+    }
+
     /// <summary>
     /// Increases the capacity of the list, reserving memory for more elements than necessary, depending on the reallocation factor.
     /// </summary>
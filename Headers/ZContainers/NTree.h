@@ -2662,6 +2662,34 @@ public:
         memcpy(pElementA, pElementB, sizeof(T));
         memcpy(pElementB, arBytes,   sizeof(T));
     }
+    
+    /// <summary>
+    /// Exchanges the elements and the capacity of two trees.
+    /// </summary>
+    /// <remarks>
+    /// It is the cheapest way to transfer the content of a tree to another, since neither copy constructors, nor assignment operators nor destructors 
+    /// are called and no memory is copied, regardless of the number of elements.<br/>
+    /// Pointers to elements remain valid, although they will point to elements of the other tree. Iterators keep pointing to the same tree and 
+    /// positions, so they may become invalid.<br/>
+    /// Both trees must have the same maximum number of child nodes per node.
+    /// </remarks>
+    /// <param name="inputTree">[IN/OUT] The tree whose elements will be exchanged with the resident tree's. It can be the resident tree.</param>
+    void Swap(NTree &inputTree)
+    {
+        Z_ASSERT_ERROR(inputTree.MAX_CHILDREN == MAX_CHILDREN, "The maximum number of child nodes per node of both trees must be the same.");
+
+        m_elementAllocator.Swap(inputTree.m_elementAllocator);
+        m_nodeAllocator.Swap(inputTree.m_nodeAllocator);
+
+        const puint_z ROOT = m_uRoot;
+        m_uRoot = inputTree.m_uRoot;
+        inputTree.m_uRoot = ROOT;
+
+        m_pElementBasePointer = scast_z(m_elementAllocator.GetPointer(), T*);
+        m_pNodeBasePointer = scast_z(m_nodeAllocator.GetPointer(), NTree::Node*);
+        inputTree.m_pElementBasePointer = scast_z(inputTree.m_elementAllocator.GetPointer(), T*);
+        inputTree.m_pNodeBasePointer = scast_z(inputTree.m_nodeAllocator.GetPointer(), NTree::Node*);
+    }
 
 private:
 
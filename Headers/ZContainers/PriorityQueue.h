@@ -0,0 +1,351 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __PRIORITYQUEUE__
+#define __PRIORITYQUEUE__
+
+#include "ZContainers/ContainersModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Assertions.h"
+#include "ZContainers/ArrayDynamic.h"
+#include "ZContainers/SComparatorDefault.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a queue whose elements are extracted in order of priority, according to a comparator, regardless of the order in which they were added. 
+/// The element with the highest priority is the lowest one (the one that goes first when sorting in ascending order).
+/// </summary>
+/// <remarks>
+/// Elements are stored contiguously in memory as a d-ary heap: every element has up to ARITY children, none of which is lower than it. Adding and 
+/// extracting elements take logarithmic time, while getting the first element takes constant time.<br/>
+/// Wider nodes make the heap shorter and the children of every node are contiguous, which reduces cache misses in large heaps.<br/>
+/// Elements with the same priority are extracted in an undefined order.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.
+/// </remarks>
+/// <typeparam name="T">The type of every element.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements. By default, ContiguousAllocator will be used.</typeparam>
+/// <typeparam name="ComparatorT">Optional. The type of comparator that establishes the priority of elements. By default, SComparatorDefault will 
+/// be used, so the lowest element is extracted first.</typeparam>
+/// <typeparam name="ARITY">Optional. The maximum number of children of every node of the heap. It must be greater than 1. By default, 4.</typeparam>
+template<class T, class AllocatorT = ContiguousAllocator, class ComparatorT = SComparatorDefault<T>, unsigned int ARITY = 4U>
+class PriorityQueue
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    PriorityQueue()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory. It must be greater than zero.</param>
+    explicit PriorityQueue(const puint_z uInitialCapacity) : m_arElements(uInitialCapacity)
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives a sequence of elements and arranges them in linear time.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of every element will be called.
+    /// </remarks>
+    /// <param name="arElements">[IN] The elements to be copied. It must not be null.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the input sequence. It must be greater than zero.</param>
+    PriorityQueue(const T* arElements, const puint_z uNumberOfElements) : m_arElements(arElements, uNumberOfElements)
+    {
+        this->_Heapify();
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Adds an element to the queue.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    void Push(const T &newElement)
+    {
+        m_arElements.Add(newElement);
+        this->_SiftUp(m_arElements.GetCount() - 1U);
+    }
+
+    /// <summary>
+    /// Adds a sequence of elements to the queue.
+    /// </summary>
+    /// <remarks>
+    /// When the number of added elements is greater than the number of elements in the queue, the whole heap is rearranged in linear time; 
+    /// otherwise, elements are placed one by one.<br/>
+    /// The copy constructor of every element will be called.
+    /// </remarks>
+    /// <param name="arElements">[IN] The elements to be copied. It must not be null.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the input sequence.</param>
+    void PushRange(const T* arElements, const puint_z uNumberOfElements)
+    {
+        Z_ASSERT_ERROR(arElements != null_z, "The input sequence cannot be null.");
+
+        const puint_z PREVIOUS_COUNT = m_arElements.GetCount();
+        m_arElements.Reserve(PREVIOUS_COUNT + uNumberOfElements);
+
+        for(puint_z i = 0; i < uNumberOfElements; ++i)
+            m_arElements.Add(arElements[i]);
+
+        if(uNumberOfElements > PREVIOUS_COUNT)
+        {
+            this->_Heapify();
+        }
+        else
+        {
+            for(puint_z i = PREVIOUS_COUNT; i < m_arElements.GetCount(); ++i)
+                this->_SiftUp(i);
+        }
+    }
+
+    /// <summary>
+    /// Removes the element with the highest priority.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of the last element of the heap will be called, after being assigned to the first position.
+    /// </remarks>
+    void Pop()
+    {
+        Z_ASSERT_ERROR(!m_arElements.IsEmpty(), "The queue is empty, there is nothing to remove.");
+
+        if(!m_arElements.IsEmpty())
+        {
+            const puint_z LAST_POSITION = m_arElements.GetCount() - 1U;
+
+            if(LAST_POSITION > 0)
+                m_arElements[0] = m_arElements[LAST_POSITION];
+
+            m_arElements.Remove(LAST_POSITION);
+
+            if(LAST_POSITION > 1U)
+                this->_SiftDown(0);
+        }
+    }
+
+    /// <summary>
+    /// Removes all the elements.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every element will be called. The capacity does not change.
+    /// </remarks>
+    void Clear()
+    {
+        m_arElements.Clear();
+    }
+
+    /// <summary>
+    /// Increases the capacity, reserving memory for more elements.
+    /// </summary>
+    /// <remarks>
+    /// This operation implies a reallocation, which means that any pointer to elements will be pointing to garbage.
+    /// </remarks>
+    /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void Reserve(const puint_z uNumberOfElements)
+    {
+        m_arElements.Reserve(uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Exchanges the elements of two queues.
+    /// </summary>
+    /// <param name="queue">[IN/OUT] The queue whose elements will be exchanged with the resident queue's.</param>
+    void Swap(PriorityQueue &queue)
+    {
+        m_arElements.Swap(queue.m_arElements);
+    }
+
+private:
+
+    /// <summary>
+    /// Moves an element towards the root of the heap while it is lower than its parent.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element.</param>
+    void _SiftUp(puint_z uPosition)
+    {
+        T* arElements = &m_arElements[0];
+        const T ELEMENT = arElements[uPosition];
+
+        bool bContinue = uPosition > 0;
+
+        while(bContinue)
+        {
+            const puint_z PARENT = (uPosition - 1U) / ARITY;
+            bContinue = ComparatorT::Compare(ELEMENT, arElements[PARENT]) < 0;
+
+            if(bContinue)
+            {
+                // The parent is moved down, to the gap
+                arElements[uPosition] = arElements[PARENT];
+                uPosition = PARENT;
+                bContinue = uPosition > 0;
+            }
+        }
+
+        arElements[uPosition] = ELEMENT;
+    }
+
+    /// <summary>
+    /// Moves an element towards the leaves of the heap while any of its children is lower than it.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element.</param>
+    void _SiftDown(puint_z uPosition)
+    {
+        T* arElements = &m_arElements[0];
+        const puint_z COUNT = m_arElements.GetCount();
+        const T ELEMENT = arElements[uPosition];
+
+        puint_z uFirstChild = uPosition * ARITY + 1U;
+        bool bContinue = uFirstChild < COUNT;
+
+        while(bContinue)
+        {
+            const puint_z END_CHILD = COUNT - uFirstChild < ARITY ? COUNT : uFirstChild + ARITY;
+            puint_z uLowestChild = uFirstChild;
+
+            for(puint_z uChild = uFirstChild + 1U; uChild < END_CHILD; ++uChild)
+            {
+                if(ComparatorT::Compare(arElements[uChild], arElements[uLowestChild]) < 0)
+                    uLowestChild = uChild;
+            }
+
+            bContinue = ComparatorT::Compare(arElements[uLowestChild], ELEMENT) < 0;
+
+            if(bContinue)
+            {
+                // The lowest child is moved up, to the gap
+                arElements[uPosition] = arElements[uLowestChild];
+                uPosition = uLowestChild;
+                uFirstChild = uPosition * ARITY + 1U;
+                bContinue = uFirstChild < COUNT;
+            }
+        }
+
+        arElements[uPosition] = ELEMENT;
+    }
+
+    /// <summary>
+    /// Arranges all the elements as a heap, in linear time, by sifting down every element that has children, from the last one to the root.
+    /// </summary>
+    void _Heapify()
+    {
+        const puint_z COUNT = m_arElements.GetCount();
+
+        if(COUNT > 1U)
+        {
+            puint_z uPosition = (COUNT - 2U) / ARITY + 1U;
+
+            while(uPosition > 0)
+            {
+                --uPosition;
+                this->_SiftDown(uPosition);
+            }
+        }
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the element with the highest priority, which is the next to be removed.
+    /// </summary>
+    /// <returns>
+    /// A reference to the element. It must not be modified in a way that changes its priority.
+    /// </returns>
+    const T& GetTop() const
+    {
+        Z_ASSERT_ERROR(!m_arElements.IsEmpty(), "The queue is empty.");
+
+        return m_arElements[0];
+    }
+
+    /// <summary>
+    /// Gets the number of elements for which memory has been reserved.
+    /// </summary>
+    /// <returns>
+    /// The capacity.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_arElements.GetCapacity();
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the queue.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        return m_arElements.GetCount();
+    }
+
+    /// <summary>
+    /// Indicates whether the queue is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if there are no elements; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_arElements.IsEmpty();
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The elements, arranged as a heap.
+    /// </summary>
+    ArrayDynamic<T, AllocatorT, ComparatorT> m_arElements;
+};
+
+} // namespace z
+
+
+#endif // __PRIORITYQUEUE__
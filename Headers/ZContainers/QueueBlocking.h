@@ -0,0 +1,339 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QUEUEBLOCKING__
+#define __QUEUEBLOCKING__
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZContainers/QueueMpmc.h"
+#include "ZThreading/EventCount.h"
+
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a bounded first-in first-out queue whose operations can block the calling thread until there are elements to extract or free space 
+/// to add new elements.
+/// </summary>
+/// <remarks>
+/// It wraps a lock-free queue (QueueMpmc or QueueSpsc) and uses an EventCount for producers and another for consumers to put threads to sleep when 
+/// they have to wait, without any mutex. Notifications only perform a system call when there are waiting threads, so the cost in the common case is 
+/// that of the wrapped queue plus a memory fence.<br/>
+/// The number of threads that can add or extract elements at the same time is that allowed by the wrapped queue.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.
+/// </remarks>
+/// <typeparam name="T">The type of every element in the queue.</typeparam>
+/// <typeparam name="QueueT">Optional. The type of the wrapped lock-free queue, which must have the same interface as QueueMpmc. By default, QueueMpmc will
+/// be used.</typeparam>
+template <class T, class QueueT = QueueMpmc<T> >
+class QueueBlocking
+{
+    // TYPEDEFS
+    // --------------
+public:
+
+    typedef T ElementType;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the maximum number of elements the queue can store.
+    /// </summary>
+    /// <param name="uCapacity">[IN] The maximum number of elements. It must be greater than zero. The wrapped queue may round it up.</param>
+    explicit QueueBlocking(const puint_z uCapacity) : m_queue(uCapacity)
+    {
+    }
+
+private:
+
+    // Hidden
+    QueueBlocking(const QueueBlocking&);
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QueueBlocking& operator=(const QueueBlocking&);
+
+public:
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, waiting until there is free space.
+    /// </summary>
+    /// <param name="element">[IN] The element to be copied.</param>
+    void Enqueue(const T &element)
+    {
+        bool bAdded = m_queue.TryEnqueue(element);
+
+        while(!bAdded)
+        {
+            const u32_z KEY = m_notFull.PrepareWait();
+            bAdded = m_queue.TryEnqueue(element);
+
+            if(bAdded)
+                m_notFull.CancelWait();
+            else
+                m_notFull.Wait(KEY);
+        }
+
+        m_notEmpty.NotifyOne();
+    }
+
+    /// <summary>
+    /// Adds a copy of a sequence of elements to the end of the queue, waiting until all of them have been added.
+    /// </summary>
+    /// <remarks>
+    /// Elements are added in groups, as soon as there is free space, so consumers may extract the first elements before the last ones have been added. 
+    /// Elements added by other producers in the meantime may be interleaved.
+    /// </remarks>
+    /// <param name="arElements">[IN] The elements to be copied. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of elements to be copied.</param>
+    void Enqueue(const T* arElements, const puint_z uCount)
+    {
+        puint_z uAdded = m_queue.TryEnqueue(arElements, uCount);
+
+        while(uAdded < uCount)
+        {
+            // Consumers must be able to extract the elements added so far, otherwise there may never be free space
+            if(uAdded > 0)
+                m_notEmpty.NotifyAll();
+
+            const u32_z KEY = m_notFull.PrepareWait();
+            const puint_z ADDED_NOW = m_queue.TryEnqueue(arElements + uAdded, uCount - uAdded);
+
+            if(ADDED_NOW > 0)
+            {
+                m_notFull.CancelWait();
+                uAdded += ADDED_NOW;
+            }
+            else
+            {
+                m_notFull.Wait(KEY);
+            }
+        }
+
+        m_notEmpty.NotifyAll();
+    }
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, if there is free space, without waiting.
+    /// </summary>
+    /// <param name="element">[IN] The element to be copied.</param>
+    /// <returns>
+    /// True if the element was added; False if the queue was full.
+    /// </returns>
+    bool TryEnqueue(const T &element)
+    {
+        const bool bAdded = m_queue.TryEnqueue(element);
+
+        if(bAdded)
+            m_notEmpty.NotifyOne();
+
+        return bAdded;
+    }
+
+    /// <summary>
+    /// Adds a copy of a sequence of elements to the end of the queue, as many as fit in the free space, without waiting.
+    /// </summary>
+    /// <param name="arElements">[IN] The elements to be copied. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of elements to be copied.</param>
+    /// <returns>
+    /// The number of elements that were added, from the first one. Zero if the queue was full.
+    /// </returns>
+    puint_z TryEnqueue(const T* arElements, const puint_z uCount)
+    {
+        const puint_z ADDED_COUNT = m_queue.TryEnqueue(arElements, uCount);
+
+        if(ADDED_COUNT > 0)
+            m_notEmpty.NotifyAll();
+
+        return ADDED_COUNT;
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, waiting until there is any.
+    /// </summary>
+    /// <param name="element">[OUT] The extracted element is assigned to this output parameter.</param>
+    void Dequeue(T &element)
+    {
+        bool bExtracted = m_queue.TryDequeue(element);
+
+        while(!bExtracted)
+        {
+            const u32_z KEY = m_notEmpty.PrepareWait();
+            bExtracted = m_queue.TryDequeue(element);
+
+            if(bExtracted)
+                m_notEmpty.CancelWait();
+            else
+                m_notEmpty.Wait(KEY);
+        }
+
+        m_notFull.NotifyOne();
+    }
+
+    /// <summary>
+    /// Extracts a sequence of elements from the front of the queue, as many as there are up to a maximum, waiting until there is at least one.
+    /// </summary>
+    /// <param name="arElements">[OUT] The extracted elements are assigned to the elements of this array, from the first one. It must not be null.</param>
+    /// <param name="uMaximumCount">[IN] The maximum number of elements to extract. It must be greater than zero.</param>
+    /// <returns>
+    /// The number of elements that were extracted, always greater than zero.
+    /// </returns>
+    puint_z Dequeue(T* arElements, const puint_z uMaximumCount)
+    {
+        Z_ASSERT_ERROR(uMaximumCount > 0, "The maximum number of elements to extract must be greater than zero.");
+
+        puint_z uExtracted = m_queue.TryDequeue(arElements, uMaximumCount);
+
+        while(uExtracted == 0)
+        {
+            const u32_z KEY = m_notEmpty.PrepareWait();
+            uExtracted = m_queue.TryDequeue(arElements, uMaximumCount);
+
+            if(uExtracted > 0)
+                m_notEmpty.CancelWait();
+            else
+                m_notEmpty.Wait(KEY);
+        }
+
+        m_notFull.NotifyAll();
+
+        return uExtracted;
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, if there is any, without waiting.
+    /// </summary>
+    /// <param name="element">[OUT] The extracted element is assigned to this output parameter.</param>
+    /// <returns>
+    /// True if an element was extracted; False if the queue was empty.
+    /// </returns>
+    bool TryDequeue(T &element)
+    {
+        const bool bExtracted = m_queue.TryDequeue(element);
+
+        if(bExtracted)
+            m_notFull.NotifyOne();
+
+        return bExtracted;
+    }
+
+    /// <summary>
+    /// Extracts a sequence of elements from the front of the queue, as many as there are up to a maximum, without waiting.
+    /// </summary>
+    /// <param name="arElements">[OUT] The extracted elements are assigned to the elements of this array, from the first one. It must not be null.</param>
+    /// <param name="uMaximumCount">[IN] The maximum number of elements to extract.</param>
+    /// <returns>
+    /// The number of elements that were extracted. Zero if the queue was empty.
+    /// </returns>
+    puint_z TryDequeue(T* arElements, const puint_z uMaximumCount)
+    {
+        const puint_z EXTRACTED_COUNT = m_queue.TryDequeue(arElements, uMaximumCount);
+
+        if(EXTRACTED_COUNT > 0)
+            m_notFull.NotifyAll();
+
+        return EXTRACTED_COUNT;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the maximum number of elements the queue can store.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the queue.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_queue.GetCapacity();
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the queue.
+    /// </summary>
+    /// <remarks>
+    /// If other threads are using the queue, the result is only an approximation, it may have changed when it is returned.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        return m_queue.GetCount();
+    }
+
+    /// <summary>
+    /// Checks whether the queue is empty.
+    /// </summary>
+    /// <remarks>
+    /// If other threads are using the queue, the result is only an approximation, it may have changed when it is returned.
+    /// </remarks>
+    /// <returns>
+    /// True if the queue is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_queue.IsEmpty();
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The wrapped lock-free queue.
+    /// </summary>
+    QueueT m_queue;
+
+    /// <summary>
+    /// The event count on which producers wait until there is free space.
+    /// </summary>
+    EventCount m_notFull;
+
+    /// <summary>
+    /// The event count on which consumers wait until there are elements.
+    /// </summary>
+    EventCount m_notEmpty;
+};
+
+} // namespace z
+
+
+#endif // __QUEUEBLOCKING__
@@ -0,0 +1,387 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QUEUEMPMC__
+#define __QUEUEMPMC__
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Assertions.h"
+#include "ZCommon/DataTypes/StringsDefinitions.h"
+#include "ZMemory/PoolAllocator.h"
+#include "ZCommon/Alignment.h"
+#include "ZCommon/AllocationOperators.h"
+#include <boost/atomic.hpp>
+
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a bounded first-in first-out queue that can be used by many producer threads and many consumer threads at the same time, without locks.
+/// </summary>
+/// <remarks>
+/// It is a ring buffer in which every position has a sequence number that indicates whether it is ready to be written or read in the current lap 
+/// (D. Vyukov's bounded MPMC queue). Producers and consumers only compete for the index of the next position to write or read, respectively, which are placed 
+/// in different cache lines; threads never wait for each other unless the queue is full or empty, in which case the operations fail instead of blocking.<br/>
+/// The capacity is rounded up to the next power of two, and it is 2 at least since a position cannot be ready to be written and read at the same time.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// Use QueueBlocking to wait until there are elements or free space.
+/// </remarks>
+/// <typeparam name="T">The type of every element in the queue.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the queue. By default, PoolAllocator will
+/// be used.</typeparam>
+template <class T, class AllocatorT = PoolAllocator>
+class QueueMpmc
+{
+    // TYPEDEFS
+    // --------------
+public:
+
+    typedef T ElementType;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the maximum number of elements the queue can store.
+    /// </summary>
+    /// <param name="uCapacity">[IN] The maximum number of elements. It must be greater than zero. It is rounded up to the next power of two, 2 at least.</param>
+    explicit QueueMpmc(const puint_z uCapacity) : m_uMask(QueueMpmc::_GetPowerOfTwo(uCapacity) - 1U),
+                                                  m_allocator((m_uMask + 1U) * sizeof(T), sizeof(T), Alignment(alignof_z(T))),
+                                                  m_uEnqueuePosition(0),
+                                                  m_uDequeuePosition(0)
+    {
+        Z_ASSERT_ERROR(uCapacity > 0, "The capacity of the queue must be greater than zero.");
+
+        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
+        m_arSequences = scast_z(operator new((m_uMask + 1U) * sizeof(boost::atomic<u64_z>), Alignment(Z_CACHE_LINE_SIZE)), boost::atomic<u64_z>*);
+
+        // Every position is ready to be written in the first lap
+        for(puint_z i = 0; i <= m_uMask; ++i)
+            new(&m_arSequences[i]) boost::atomic<u64_z>(i);
+    }
+
+private:
+
+    // Hidden
+    QueueMpmc(const QueueMpmc&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor is called for every element that remains in the queue. No thread can be using the queue.
+    /// </remarks>
+    ~QueueMpmc()
+    {
+        const u64_z LAST_POSITION = m_uEnqueuePosition.load(boost::memory_order_relaxed);
+
+        for(u64_z uPosition = m_uDequeuePosition.load(boost::memory_order_relaxed); uPosition != LAST_POSITION; ++uPosition)
+            m_pElementBasePointer[uPosition & m_uMask].~T();
+
+        for(puint_z i = 0; i <= m_uMask; ++i)
+            m_arSequences[i].~atomic();
+
+        operator delete(m_arSequences, Alignment(Z_CACHE_LINE_SIZE));
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QueueMpmc& operator=(const QueueMpmc&);
+
+public:
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, if there is free space.
+    /// </summary>
+    /// <param name="element">[IN] The element to be copied.</param>
+    /// <returns>
+    /// True if the element was added; False if the queue was full.
+    /// </returns>
+    bool TryEnqueue(const T &element)
+    {
+        return this->TryEnqueue(&element, 1U) == 1U;
+    }
+
+    /// <summary>
+    /// Adds a copy of a sequence of elements to the end of the queue, as many as fit in the free space.
+    /// </summary>
+    /// <remarks>
+    /// All the positions are reserved at once so the elements are added contiguously, in the same order, even if other threads are adding elements at the same time.
+    /// </remarks>
+    /// <param name="arElements">[IN] The elements to be copied. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of elements to be copied.</param>
+    /// <returns>
+    /// The number of elements that were added, from the first one. Zero if the queue was full.
+    /// </returns>
+    puint_z TryEnqueue(const T* arElements, const puint_z uCount)
+    {
+        Z_ASSERT_ERROR(arElements != null_z, "The input array of elements cannot be null.");
+
+        u64_z uPosition = m_uEnqueuePosition.load(boost::memory_order_relaxed);
+        puint_z uReserved = this->_Reserve(m_uEnqueuePosition, uPosition, 0, uCount);
+
+        for(puint_z i = 0; i < uReserved; ++i)
+        {
+            const puint_z INDEX = (uPosition + i) & m_uMask;
+            new(&m_pElementBasePointer[INDEX]) T(arElements[i]);
+
+            // The position is ready to be read in this lap
+            m_arSequences[INDEX].store(uPosition + i + 1U, boost::memory_order_release);
+        }
+
+        return uReserved;
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, if there is any.
+    /// </summary>
+    /// <param name="element">[OUT] The extracted element is assigned to this output parameter.</param>
+    /// <returns>
+    /// True if an element was extracted; False if the queue was empty.
+    /// </returns>
+    bool TryDequeue(T &element)
+    {
+        return this->TryDequeue(&element, 1U) == 1U;
+    }
+
+    /// <summary>
+    /// Extracts a sequence of elements from the front of the queue, as many as there are, up to a maximum.
+    /// </summary>
+    /// <remarks>
+    /// All the positions are reserved at once so the elements are extracted contiguously, in the same order they were added.
+    /// </remarks>
+    /// <param name="arElements">[OUT] The extracted elements are assigned to the elements of this array, from the first one. It must not be null.</param>
+    /// <param name="uMaximumCount">[IN] The maximum number of elements to extract.</param>
+    /// <returns>
+    /// The number of elements that were extracted. Zero if the queue was empty.
+    /// </returns>
+    puint_z TryDequeue(T* arElements, const puint_z uMaximumCount)
+    {
+        Z_ASSERT_ERROR(arElements != null_z, "The output array of elements cannot be null.");
+
+        u64_z uPosition = m_uDequeuePosition.load(boost::memory_order_relaxed);
+        puint_z uReserved = this->_Reserve(m_uDequeuePosition, uPosition, 1U, uMaximumCount);
+
+        for(puint_z i = 0; i < uReserved; ++i)
+        {
+            const puint_z INDEX = (uPosition + i) & m_uMask;
+            arElements[i] = m_pElementBasePointer[INDEX];
+            m_pElementBasePointer[INDEX].~T();
+
+            // The position is ready to be written in the next lap
+            m_arSequences[INDEX].store(uPosition + i + m_uMask + 1U, boost::memory_order_release);
+        }
+
+        return uReserved;
+    }
+
+private:
+
+    /// <summary>
+    /// Reserves a range of contiguous positions, either to write or to read, whose sequence numbers indicate that they are ready.
+    /// </summary>
+    /// <param name="uSharedPosition">[IN/OUT] The index of the next position to write or to read, shared by all producers or by all consumers.</param>
+    /// <param name="uPosition">[IN/OUT] The last known value of the shared index. It is replaced with the first reserved position.</param>
+    /// <param name="uSequenceOffset">[IN] The difference between a position and the sequence number it has when it is ready (0 to write, 1 to read).</param>
+    /// <param name="uMaximumCount">[IN] The maximum number of positions to reserve.</param>
+    /// <returns>
+    /// The number of reserved positions. Zero if no position was ready (the queue was full or empty).
+    /// </returns>
+    puint_z _Reserve(boost::atomic<u64_z> &uSharedPosition, u64_z &uPosition, const u64_z uSequenceOffset, const puint_z uMaximumCount)
+    {
+        const puint_z MAXIMUM_COUNT = uMaximumCount > m_uMask + 1U ? m_uMask + 1U : uMaximumCount;
+        puint_z uReady = 0;
+        bool bFinished = MAXIMUM_COUNT == 0;
+
+        while(!bFinished)
+        {
+            const u64_z FIRST_SEQUENCE = m_arSequences[uPosition & m_uMask].load(boost::memory_order_acquire);
+            const i64_z DIFFERENCE = scast_z(FIRST_SEQUENCE - (uPosition + uSequenceOffset), i64_z);
+
+            if(DIFFERENCE == 0)
+            {
+                // Counts how many contiguous positions are ready too
+                uReady = 1U;
+
+                while(uReady < MAXIMUM_COUNT && 
+                      m_arSequences[(uPosition + uReady) & m_uMask].load(boost::memory_order_acquire) == uPosition + uReady + uSequenceOffset)
+                    ++uReady;
+
+                // If another thread reserved any of them first, uPosition is updated and it is tried again
+                bFinished = uSharedPosition.compare_exchange_weak(uPosition, uPosition + uReady, boost::memory_order_relaxed);
+
+                if(!bFinished)
+                    uReady = 0;
+            }
+            else if(DIFFERENCE < 0)
+            {
+                // The position has not been released yet in the previous lap: the queue is full (producers) or empty (consumers)
+                bFinished = true;
+            }
+            else
+            {
+                // Another thread already reserved the position
+                uPosition = uSharedPosition.load(boost::memory_order_relaxed);
+            }
+        }
+
+        return uReady;
+    }
+
+    /// <summary>
+    /// Calculates the lowest power of two that is greater than or equal to a number, and to 2.
+    /// </summary>
+    /// <param name="uValue">[IN] A number.</param>
+    /// <returns>
+    /// The power of two. If the input number is lower than 2, it returns 2.
+    /// </returns>
+    static puint_z _GetPowerOfTwo(const puint_z uValue)
+    {
+        puint_z uPowerOfTwo = 2U;
+
+        while(uPowerOfTwo < uValue)
+            uPowerOfTwo <<= 1U;
+
+        return uPowerOfTwo;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the maximum number of elements the queue can store.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the queue, a power of two.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_uMask + 1U;
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the queue.
+    /// </summary>
+    /// <remarks>
+    /// If other threads are using the queue, the result is only an approximation, it may have changed when it is returned. 
+    /// Elements whose addition or extraction has not finished yet are counted.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        const u64_z DEQUEUE_POSITION = m_uDequeuePosition.load(boost::memory_order_relaxed);
+        const u64_z ENQUEUE_POSITION = m_uEnqueuePosition.load(boost::memory_order_relaxed);
+
+        return ENQUEUE_POSITION > DEQUEUE_POSITION ? scast_z(ENQUEUE_POSITION - DEQUEUE_POSITION, puint_z) : 0;
+    }
+
+    /// <summary>
+    /// Checks whether the queue is empty.
+    /// </summary>
+    /// <remarks>
+    /// If other threads are using the queue, the result is only an approximation, it may have changed when it is returned.
+    /// </remarks>
+    /// <returns>
+    /// True if the queue is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return this->GetCount() == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The capacity of the queue minus one, used to calculate the index of a position in the buffer.
+    /// </summary>
+    const puint_z m_uMask;
+
+    /// <summary>
+    /// The allocator which stores the elements.
+    /// </summary>
+    AllocatorT m_allocator;
+
+    /// <summary>
+    /// A pointer to the buffer stored in the memory allocator, casted to the element type.
+    /// </summary>
+    T* m_pElementBasePointer;
+
+    /// <summary>
+    /// The sequence number of every position in the buffer.
+    /// </summary>
+    boost::atomic<u64_z>* m_arSequences;
+
+    /// <summary>
+    /// Keeps the index of the next position to write in a different cache line.
+    /// </summary>
+    u8_z m_arPadding1[Z_CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The next position to write, never wrapped, shared by all the producers.
+    /// </summary>
+    boost::atomic<u64_z> m_uEnqueuePosition;
+
+    /// <summary>
+    /// Keeps the index of the next position to read in a different cache line.
+    /// </summary>
+    u8_z m_arPadding2[Z_CACHE_LINE_SIZE - sizeof(boost::atomic<u64_z>)];
+
+    /// <summary>
+    /// The next position to read, never wrapped, shared by all the consumers.
+    /// </summary>
+    boost::atomic<u64_z> m_uDequeuePosition;
+
+    /// <summary>
+    /// Keeps the index of the next position to read away from the data that follows the queue.
+    /// </summary>
+    u8_z m_arPadding3[Z_CACHE_LINE_SIZE - sizeof(boost::atomic<u64_z>)];
+};
+
+} // namespace z
+
+
+#endif // __QUEUEMPMC__
@@ -0,0 +1,343 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __QUEUESPSC__
+#define __QUEUESPSC__
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Assertions.h"
+#include "ZCommon/DataTypes/StringsDefinitions.h"
+#include "ZMemory/PoolAllocator.h"
+#include "ZCommon/Alignment.h"
+#include "ZCommon/AllocationOperators.h"
+#include <boost/atomic.hpp>
+
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a bounded first-in first-out queue that can be used by one producer thread and one consumer thread at the same time, without locks.
+/// </summary>
+/// <remarks>
+/// It is a ring buffer whose operations are wait-free: they always finish in a bounded number of steps. The index written by the producer and the index 
+/// written by the consumer are placed in different cache lines, and every thread keeps a copy of the other thread's index which is only refreshed when the 
+/// queue seems to be full or empty, so they rarely read each other's cache line.<br/>
+/// Only one thread can add elements and only one thread can extract them; otherwise, the behavior is undefined. Use QueueMpmc if there are more.<br/>
+/// The capacity is rounded up to the next power of two.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// Use QueueBlocking to wait until there are elements or free space.
+/// </remarks>
+/// <typeparam name="T">The type of every element in the queue.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the queue. By default, PoolAllocator will
+/// be used.</typeparam>
+template <class T, class AllocatorT = PoolAllocator>
+class QueueSpsc
+{
+    // TYPEDEFS
+    // --------------
+public:
+
+    typedef T ElementType;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the maximum number of elements the queue can store.
+    /// </summary>
+    /// <param name="uCapacity">[IN] The maximum number of elements. It must be greater than zero. It is rounded up to the next power of two.</param>
+    explicit QueueSpsc(const puint_z uCapacity) : m_uMask(QueueSpsc::_GetPowerOfTwo(uCapacity) - 1U),
+                                                  m_allocator((m_uMask + 1U) * sizeof(T), sizeof(T), Alignment(alignof_z(T))),
+                                                  m_uEnqueuePosition(0),
+                                                  m_uCachedDequeuePosition(0),
+                                                  m_uDequeuePosition(0),
+                                                  m_uCachedEnqueuePosition(0)
+    {
+        Z_ASSERT_ERROR(uCapacity > 0, "The capacity of the queue must be greater than zero.");
+
+        m_pElementBasePointer = scast_z(m_allocator.GetPointer(), T*);
+    }
+
+private:
+
+    // Hidden
+    QueueSpsc(const QueueSpsc&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor is called for every element that remains in the queue. No thread can be using the queue.
+    /// </remarks>
+    ~QueueSpsc()
+    {
+        const u64_z LAST_POSITION = m_uEnqueuePosition.load(boost::memory_order_relaxed);
+
+        for(u64_z uPosition = m_uDequeuePosition.load(boost::memory_order_relaxed); uPosition != LAST_POSITION; ++uPosition)
+            m_pElementBasePointer[uPosition & m_uMask].~T();
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    QueueSpsc& operator=(const QueueSpsc&);
+
+public:
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, if there is free space. Only the producer thread can call this method.
+    /// </summary>
+    /// <param name="element">[IN] The element to be copied.</param>
+    /// <returns>
+    /// True if the element was added; False if the queue was full.
+    /// </returns>
+    bool TryEnqueue(const T &element)
+    {
+        return this->TryEnqueue(&element, 1U) == 1U;
+    }
+
+    /// <summary>
+    /// Adds a copy of a sequence of elements to the end of the queue, as many as fit in the free space. Only the producer thread can call this method.
+    /// </summary>
+    /// <remarks>
+    /// The consumer does not see any of the elements until all of them have been added.
+    /// </remarks>
+    /// <param name="arElements">[IN] The elements to be copied. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of elements to be copied.</param>
+    /// <returns>
+    /// The number of elements that were added, from the first one. Zero if the queue was full.
+    /// </returns>
+    puint_z TryEnqueue(const T* arElements, const puint_z uCount)
+    {
+        Z_ASSERT_ERROR(arElements != null_z, "The input array of elements cannot be null.");
+
+        const u64_z POSITION = m_uEnqueuePosition.load(boost::memory_order_relaxed);
+        const u64_z CAPACITY = m_uMask + 1U;
+
+        // The position of the consumer is only read again when the queue seems to be full
+        if(POSITION + uCount - m_uCachedDequeuePosition > CAPACITY)
+            m_uCachedDequeuePosition = m_uDequeuePosition.load(boost::memory_order_acquire);
+
+        const u64_z FREE_COUNT = CAPACITY - (POSITION - m_uCachedDequeuePosition);
+        const puint_z ADDED_COUNT = uCount < FREE_COUNT ? uCount : scast_z(FREE_COUNT, puint_z);
+
+        for(puint_z i = 0; i < ADDED_COUNT; ++i)
+            new(&m_pElementBasePointer[(POSITION + i) & m_uMask]) T(arElements[i]);
+
+        if(ADDED_COUNT > 0)
+            m_uEnqueuePosition.store(POSITION + ADDED_COUNT, boost::memory_order_release);
+
+        return ADDED_COUNT;
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, if there is any. Only the consumer thread can call this method.
+    /// </summary>
+    /// <param name="element">[OUT] The extracted element is assigned to this output parameter.</param>
+    /// <returns>
+    /// True if an element was extracted; False if the queue was empty.
+    /// </returns>
+    bool TryDequeue(T &element)
+    {
+        return this->TryDequeue(&element, 1U) == 1U;
+    }
+
+    /// <summary>
+    /// Extracts a sequence of elements from the front of the queue, as many as there are, up to a maximum. Only the consumer thread can call this method.
+    /// </summary>
+    /// <remarks>
+    /// The producer cannot reuse the free space until all of them have been extracted.
+    /// </remarks>
+    /// <param name="arElements">[OUT] The extracted elements are assigned to the elements of this array, from the first one. It must not be null.</param>
+    /// <param name="uMaximumCount">[IN] The maximum number of elements to extract.</param>
+    /// <returns>
+    /// The number of elements that were extracted. Zero if the queue was empty.
+    /// </returns>
+    puint_z TryDequeue(T* arElements, const puint_z uMaximumCount)
+    {
+        Z_ASSERT_ERROR(arElements != null_z, "The output array of elements cannot be null.");
+
+        const u64_z POSITION = m_uDequeuePosition.load(boost::memory_order_relaxed);
+
+        // The position of the producer is only read again when the queue seems to be empty
+        if(m_uCachedEnqueuePosition - POSITION < uMaximumCount)
+            m_uCachedEnqueuePosition = m_uEnqueuePosition.load(boost::memory_order_acquire);
+
+        const u64_z AVAILABLE_COUNT = m_uCachedEnqueuePosition - POSITION;
+        const puint_z EXTRACTED_COUNT = uMaximumCount < AVAILABLE_COUNT ? uMaximumCount : scast_z(AVAILABLE_COUNT, puint_z);
+
+        for(puint_z i = 0; i < EXTRACTED_COUNT; ++i)
+        {
+            T &element = m_pElementBasePointer[(POSITION + i) & m_uMask];
+            arElements[i] = element;
+            element.~T();
+        }
+
+        if(EXTRACTED_COUNT > 0)
+            m_uDequeuePosition.store(POSITION + EXTRACTED_COUNT, boost::memory_order_release);
+
+        return EXTRACTED_COUNT;
+    }
+
+private:
+
+    /// <summary>
+    /// Calculates the lowest power of two that is greater than or equal to a number.
+    /// </summary>
+    /// <param name="uValue">[IN] A number.</param>
+    /// <returns>
+    /// The power of two. If the input number is zero, it returns 1.
+    /// </returns>
+    static puint_z _GetPowerOfTwo(const puint_z uValue)
+    {
+        puint_z uPowerOfTwo = 1U;
+
+        while(uPowerOfTwo < uValue)
+            uPowerOfTwo <<= 1U;
+
+        return uPowerOfTwo;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the maximum number of elements the queue can store.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the queue, a power of two.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_uMask + 1U;
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the queue.
+    /// </summary>
+    /// <remarks>
+    /// If other threads are using the queue, the result is only an approximation, it may have changed when it is returned.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        const u64_z DEQUEUE_POSITION = m_uDequeuePosition.load(boost::memory_order_acquire);
+        const u64_z ENQUEUE_POSITION = m_uEnqueuePosition.load(boost::memory_order_acquire);
+
+        return ENQUEUE_POSITION > DEQUEUE_POSITION ? scast_z(ENQUEUE_POSITION - DEQUEUE_POSITION, puint_z) : 0;
+    }
+
+    /// <summary>
+    /// Checks whether the queue is empty.
+    /// </summary>
+    /// <remarks>
+    /// If other threads are using the queue, the result is only an approximation, it may have changed when it is returned.
+    /// </remarks>
+    /// <returns>
+    /// True if the queue is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return this->GetCount() == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The capacity of the queue minus one, used to calculate the index of a position in the buffer.
+    /// </summary>
+    const puint_z m_uMask;
+
+    /// <summary>
+    /// The allocator which stores the elements.
+    /// </summary>
+    AllocatorT m_allocator;
+
+    /// <summary>
+    /// A pointer to the buffer stored in the memory allocator, casted to the element type.
+    /// </summary>
+    T* m_pElementBasePointer;
+
+    /// <summary>
+    /// Keeps the data of the producer in a different cache line.
+    /// </summary>
+    u8_z m_arPadding1[Z_CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The next position to write, never wrapped. It is only written by the producer.
+    /// </summary>
+    boost::atomic<u64_z> m_uEnqueuePosition;
+
+    /// <summary>
+    /// The last known value of the next position to read. It is only used by the producer.
+    /// </summary>
+    u64_z m_uCachedDequeuePosition;
+
+    /// <summary>
+    /// Keeps the data of the consumer in a different cache line.
+    /// </summary>
+    u8_z m_arPadding2[Z_CACHE_LINE_SIZE - sizeof(boost::atomic<u64_z>) - sizeof(u64_z)];
+
+    /// <summary>
+    /// The next position to read, never wrapped. It is only written by the consumer.
+    /// </summary>
+    boost::atomic<u64_z> m_uDequeuePosition;
+
+    /// <summary>
+    /// The last known value of the next position to write. It is only used by the consumer.
+    /// </summary>
+    u64_z m_uCachedEnqueuePosition;
+
+    /// <summary>
+    /// Keeps the data of the consumer away from the data that follows the queue.
+    /// </summary>
+    u8_z m_arPadding3[Z_CACHE_LINE_SIZE - sizeof(boost::atomic<u64_z>) - sizeof(u64_z)];
+};
+
+} // namespace z
+
+
+#endif // __QUEUESPSC__
@@ -0,0 +1,79 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SSTRINGEQUALITYCOMPARATOR__
+#define __SSTRINGEQUALITYCOMPARATOR__
+
+#include "ZContainers/ContainersModuleDefinitions.h"
+
+#include "ZCommon/DataTypes/StringsDefinitions.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Implements functionality for checking if two strings are equal or not, rejecting different strings without comparing their characters when possible.
+/// </summary>
+/// <remarks>
+/// It is intended to be used as the key comparator of hash tables whose keys are strings, along with SStringHashProvider.
+/// </remarks>
+class Z_CONTAINERS_MODULE_SYMBOLS SStringEqualityComparator
+{
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SStringEqualityComparator();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Compares two strings using binary case-sensitive comparison.
+    /// </summary>
+    /// <remarks>
+    /// Strings are considered different if their lengths are different or, when the hash cache is enabled (see Z_CONFIG_STRINGHASHCACHE_DEFAULT), if their 
+    /// hash codes are different, before comparing their characters. Hash codes are calculated only once per string, so comparing the same strings many times
+    /// is cheap.
+    /// </remarks>
+    /// <param name="strLeftOperand">[IN] First operand to compare.</param>
+    /// <param name="strRightOperand">[IN] Second operand to compare.</param>
+    /// <returns>
+    /// 1 in case operands are different; 0 if they are equal.
+    /// </returns>
+    static i8_z Compare(const string_z &strLeftOperand, const string_z &strRightOperand);
+
+};
+
+} // namespace z
+
+
+#endif // __SSTRINGEQUALITYCOMPARATOR__
@@ -57,7 +57,8 @@ public:
     /// Generates a hash key from a string.
     /// </summary>
     /// <remarks>
-    /// It implements the Jenkins' one-at-a-time hash function, followed by the calculation of the remainder of dividing the result by the number of buckets.
+    /// It calculates the remainder of dividing the hash code of the string (see StringUnicode::GetHashCode) by the number of buckets. When the hash cache is 
+    /// enabled, the string is traversed only the first time, so keys stored in a hash table are not traversed again when they are moved to other buckets.
     /// </remarks>
     /// <param name="strInput">[IN] A string value. It can be empty.</param>
     /// <param name="uBucketsInTable">[IN] The number of buckets in the table for which the hash key is to be calculated.</param>
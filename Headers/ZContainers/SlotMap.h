@@ -0,0 +1,598 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SLOTMAP__
+#define __SLOTMAP__
+
+#include "ZContainers/ContainersModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Assertions.h"
+#include "ZContainers/ArrayDynamic.h"
+#include "ZContainers/Span.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a set of elements identified by handles that remain valid until the element is removed, regardless of other elements being added or 
+/// removed. Adding, removing and accessing an element through its handle take constant time.
+/// </summary>
+/// <remarks>
+/// Elements are placed contiguously in memory (dense array) so they can be traversed as an array, although in an undefined order. Handles point to 
+/// slots (sparse array) that store the position of the element in the dense array; when an element is removed, the last element is moved to its 
+/// position and only the slot of the moved element is updated.<br/>
+/// Every slot has a generation number that changes when its element is removed and when the slot is reused, being even while the slot is in use and 
+/// odd while it is free. Handles store the generation of the slot when the element was added, so handles to removed elements are detected even if the 
+/// slot has been reused by a new element. After 2^31 reuses of the same slot, the generation wraps around and a very old handle could be taken as valid.<br/>
+/// Handles of a slot map are also valid for its copies.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.
+/// </remarks>
+/// <typeparam name="T">The type of every element.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator that stores the dense array of elements. By default, ContiguousAllocator will
+/// be used.</typeparam>
+template<class T, class AllocatorT = ContiguousAllocator>
+class SlotMap
+{
+    // INTERNAL CLASSES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Identifies an element of a slot map while it is not removed.
+    /// </summary>
+    /// <remarks>
+    /// Handles are returned by SlotMap::Add. A default-constructed handle does not identify any element.
+    /// </remarks>
+    class Handle
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor that creates a handle that does not identify any element.
+        /// </summary>
+        Handle() : m_uSlot(SlotMap::END_POSITION),
+                   m_uGeneration(0)
+        {
+        }
+
+        /// <summary>
+        /// Constructor that receives the slot and its generation.
+        /// </summary>
+        /// <param name="uSlot">[IN] The position of the slot in the sparse array.</param>
+        /// <param name="uGeneration">[IN] The generation of the slot when the element was added.</param>
+        Handle(const u32_z uSlot, const u32_z uGeneration) : m_uSlot(uSlot),
+                                                              m_uGeneration(uGeneration)
+        {
+        }
+
+
+        // METHODS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Equality operator that checks whether two handles identify the same element.
+        /// </summary>
+        /// <param name="handle">[IN] The other handle.</param>
+        /// <returns>
+        /// True if both handles have the same slot and generation; False otherwise.
+        /// </returns>
+        bool operator==(const Handle &handle) const
+        {
+            return m_uSlot == handle.m_uSlot && m_uGeneration == handle.m_uGeneration;
+        }
+
+        /// <summary>
+        /// Inequality operator that checks whether two handles identify different elements.
+        /// </summary>
+        /// <param name="handle">[IN] The other handle.</param>
+        /// <returns>
+        /// True if the handles have different slot or generation; False otherwise.
+        /// </returns>
+        bool operator!=(const Handle &handle) const
+        {
+            return !(*this == handle);
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the position of the slot in the sparse array.
+        /// </summary>
+        /// <returns>
+        /// The position of the slot.
+        /// </returns>
+        u32_z GetSlot() const
+        {
+            return m_uSlot;
+        }
+
+        /// <summary>
+        /// Gets the generation of the slot when the element was added.
+        /// </summary>
+        /// <returns>
+        /// The generation number.
+        /// </returns>
+        u32_z GetGeneration() const
+        {
+            return m_uGeneration;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The position of the slot in the sparse array.
+        /// </summary>
+        u32_z m_uSlot;
+
+        /// <summary>
+        /// The generation of the slot when the element was added.
+        /// </summary>
+        u32_z m_uGeneration;
+    };
+
+protected:
+
+    /// <summary>
+    /// Stores the generation of a position of the sparse array and either the position of its element in the dense array or, if the slot is free, 
+    /// the position of the next free slot.
+    /// </summary>
+    class Slot
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the generation and the position.
+        /// </summary>
+        /// <param name="uGeneration">[IN] The generation of the slot.</param>
+        /// <param name="uPosition">[IN] The position of the element in the dense array or the position of the next free slot.</param>
+        Slot(const u32_z uGeneration, const u32_z uPosition) : m_uGeneration(uGeneration),
+                                                                m_uPosition(uPosition)
+        {
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the generation of the slot.
+        /// </summary>
+        /// <returns>
+        /// The generation number.
+        /// </returns>
+        u32_z GetGeneration() const
+        {
+            return m_uGeneration;
+        }
+
+        /// <summary>
+        /// Sets the generation of the slot.
+        /// </summary>
+        /// <param name="uGeneration">[IN] The generation number.</param>
+        void SetGeneration(const u32_z uGeneration)
+        {
+            m_uGeneration = uGeneration;
+        }
+
+        /// <summary>
+        /// Indicates whether the slot is free, which happens when its generation is odd.
+        /// </summary>
+        /// <returns>
+        /// True if the slot does not store the position of any element; False otherwise.
+        /// </returns>
+        bool IsFree() const
+        {
+            return (m_uGeneration & 1U) != 0;
+        }
+
+        /// <summary>
+        /// Gets the position of the element in the dense array or, if the slot is free, the position of the next free slot.
+        /// </summary>
+        /// <returns>
+        /// The position.
+        /// </returns>
+        u32_z GetPosition() const
+        {
+            return m_uPosition;
+        }
+
+        /// <summary>
+        /// Sets the position of the element in the dense array or, if the slot is free, the position of the next free slot.
+        /// </summary>
+        /// <param name="uPosition">[IN] The position.</param>
+        void SetPosition(const u32_z uPosition)
+        {
+            m_uPosition = uPosition;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The generation of the slot, which changes every time its element is removed or it is reused. It is odd while the slot is free.
+        /// </summary>
+        u32_z m_uGeneration;
+
+        /// <summary>
+        /// The position of the element in the dense array or the position of the next free slot.
+        /// </summary>
+        u32_z m_uPosition;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Constant to symbolize the end of the list of free slots, or a handle that does not point to any slot.
+    /// </summary>
+    static const u32_z END_POSITION = -1;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    SlotMap() : m_uFirstFreeSlot(SlotMap::END_POSITION)
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory. It must be greater than zero.</param>
+    explicit SlotMap(const puint_z uInitialCapacity) : m_arElements(uInitialCapacity),
+                                                         m_arElementSlots(uInitialCapacity),
+                                                         m_arSlots(uInitialCapacity),
+                                                         m_uFirstFreeSlot(SlotMap::END_POSITION)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Copies an element to the end of the dense array and gets a handle that identifies it.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity is exceeded, a reallocation will take place, which will make any existing pointer or span invalid, although handles remain 
+    /// valid.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    /// <returns>
+    /// The handle that identifies the new element.
+    /// </returns>
+    Handle Add(const T &newElement)
+    {
+        const u32_z ELEMENT_POSITION = scast_z(m_arElements.GetCount(), u32_z);
+        u32_z uSlot = m_uFirstFreeSlot;
+
+        if(uSlot == SlotMap::END_POSITION)
+        {
+            Z_ASSERT_ERROR(m_arSlots.GetCount() < SlotMap::END_POSITION, "The maximum number of slots has been reached.");
+
+            uSlot = scast_z(m_arSlots.GetCount(), u32_z);
+            m_arSlots.Add(Slot(0, ELEMENT_POSITION));
+        }
+        else
+        {
+            // The first free slot is reused, its generation becomes even again
+            Slot &slot = m_arSlots[uSlot];
+            m_uFirstFreeSlot = slot.GetPosition();
+            slot.SetGeneration(slot.GetGeneration() + 1U);
+            slot.SetPosition(ELEMENT_POSITION);
+        }
+
+        m_arElements.Add(newElement);
+        m_arElementSlots.Add(uSlot);
+
+        return Handle(uSlot, m_arSlots[uSlot].GetGeneration());
+    }
+
+    /// <summary>
+    /// Removes the element identified by a handle, moving the last element of the dense array to its position.
+    /// </summary>
+    /// <remarks>
+    /// The handle and any copy of it will not identify any element from now on. The handles of the other elements remain valid.<br/>
+    /// The destructor of the last element will be called, after being assigned to the removed element.
+    /// </remarks>
+    /// <param name="handle">[IN] The handle of the element to remove. It must identify an element of the slot map; otherwise, 
+    /// nothing will be done.</param>
+    void Remove(const Handle &handle)
+    {
+        Z_ASSERT_ERROR(this->Contains(handle), "The input handle does not identify any element of the slot map.");
+
+        if(this->Contains(handle))
+        {
+            Slot &slot = m_arSlots[handle.GetSlot()];
+            const u32_z ELEMENT_POSITION = slot.GetPosition();
+            const puint_z LAST_POSITION = m_arElements.GetCount() - 1U;
+
+            if(ELEMENT_POSITION != LAST_POSITION)
+            {
+                // The last element fills the gap and its slot is updated
+                const u32_z LAST_ELEMENT_SLOT = m_arElementSlots[LAST_POSITION];
+                m_arElements[ELEMENT_POSITION] = m_arElements[LAST_POSITION];
+                m_arElementSlots[ELEMENT_POSITION] = LAST_ELEMENT_SLOT;
+                m_arSlots[LAST_ELEMENT_SLOT].SetPosition(ELEMENT_POSITION);
+            }
+
+            m_arElements.Remove(LAST_POSITION);
+            m_arElementSlots.Remove(LAST_POSITION);
+
+            // The generation changes, becoming odd, so existing handles become invalid, and the slot is the first to be reused
+            slot.SetGeneration(slot.GetGeneration() + 1U);
+            slot.SetPosition(m_uFirstFreeSlot);
+            m_uFirstFreeSlot = handle.GetSlot();
+        }
+    }
+
+    /// <summary>
+    /// Checks whether a handle identifies an element of the slot map.
+    /// </summary>
+    /// <param name="handle">[IN] The handle to check.</param>
+    /// <returns>
+    /// True if the element has not been removed; False if it has been removed or the handle does not belong to the slot map.
+    /// </returns>
+    bool Contains(const Handle &handle) const
+    {
+        // Free slots are rejected since their position is the next free slot, even if the handle was not returned by the slot map
+        return handle.GetSlot() < m_arSlots.GetCount() && 
+               !m_arSlots[handle.GetSlot()].IsFree() && 
+               m_arSlots[handle.GetSlot()].GetGeneration() == handle.GetGeneration();
+    }
+
+    /// <summary>
+    /// Gets the element identified by a handle.
+    /// </summary>
+    /// <param name="handle">[IN] The handle of the element. It must identify an element of the slot map.</param>
+    /// <returns>
+    /// A reference to the element.
+    /// </returns>
+    T& GetValue(const Handle &handle) const
+    {
+        Z_ASSERT_ERROR(this->Contains(handle), "The input handle does not identify any element of the slot map.");
+
+        return m_arElements[m_arSlots[handle.GetSlot()].GetPosition()];
+    }
+
+    /// <summary>
+    /// Replaces the element identified by a handle.
+    /// </summary>
+    /// <remarks>
+    /// The assignment operator of the element will be called.
+    /// </remarks>
+    /// <param name="handle">[IN] The handle of the element. It must identify an element of the slot map.</param>
+    /// <param name="value">[IN] The new value of the element.</param>
+    void SetValue(const Handle &handle, const T &value)
+    {
+        this->GetValue(handle) = value;
+    }
+
+    /// <summary>
+    /// Gets the element identified by a handle.
+    /// </summary>
+    /// <param name="handle">[IN] The handle of the element. It must identify an element of the slot map.</param>
+    /// <returns>
+    /// A reference to the element.
+    /// </returns>
+    T& operator[](const Handle &handle) const
+    {
+        return this->GetValue(handle);
+    }
+
+    /// <summary>
+    /// Gets the handle of the element that occupies a position of the dense array.
+    /// </summary>
+    /// <remarks>
+    /// This allows knowing which element is being processed when traversing the dense array (see GetValues).
+    /// </remarks>
+    /// <param name="uPosition">[IN] The position (zero-based) of the element in the dense array. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// The handle of the element.
+    /// </returns>
+    Handle GetHandle(const puint_z uPosition) const
+    {
+        Z_ASSERT_ERROR(uPosition < m_arElements.GetCount(), "The input position is out of bounds.");
+
+        const u32_z SLOT = m_arElementSlots[uPosition];
+        return Handle(SLOT, m_arSlots[SLOT].GetGeneration());
+    }
+
+    /// <summary>
+    /// Increases the capacity, reserving memory for more elements.
+    /// </summary>
+    /// <remarks>
+    /// This operation implies a reallocation, which means that any pointer or span to elements will be pointing to garbage. Handles remain valid.
+    /// </remarks>
+    /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void Reserve(const puint_z uNumberOfElements)
+    {
+        m_arElements.Reserve(uNumberOfElements);
+        m_arElementSlots.Reserve(uNumberOfElements);
+        m_arSlots.Reserve(uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Removes all the elements.
+    /// </summary>
+    /// <remarks>
+    /// No existing handle will identify any element from now on.<br/>
+    /// The destructor of every element will be called. The capacity does not change.
+    /// </remarks>
+    void Clear()
+    {
+        for(puint_z i = 0; i < m_arElementSlots.GetCount(); ++i)
+        {
+            Slot &slot = m_arSlots[m_arElementSlots[i]];
+            slot.SetGeneration(slot.GetGeneration() + 1U);
+            slot.SetPosition(m_uFirstFreeSlot);
+            m_uFirstFreeSlot = m_arElementSlots[i];
+        }
+
+        m_arElements.Clear();
+        m_arElementSlots.Clear();
+    }
+
+    /// <summary>
+    /// Exchanges the elements of two slot maps.
+    /// </summary>
+    /// <remarks>
+    /// Handles will identify the same elements, which will belong to the other slot map.
+    /// </remarks>
+    /// <param name="slotMap">[IN/OUT] The slot map whose elements will be exchanged with the resident slot map's.</param>
+    void Swap(SlotMap &slotMap)
+    {
+        m_arElements.Swap(slotMap.m_arElements);
+        m_arElementSlots.Swap(slotMap.m_arElementSlots);
+        m_arSlots.Swap(slotMap.m_arSlots);
+
+        const u32_z FIRST_FREE_SLOT = m_uFirstFreeSlot;
+        m_uFirstFreeSlot = slotMap.m_uFirstFreeSlot;
+        slotMap.m_uFirstFreeSlot = FIRST_FREE_SLOT;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets a span that views the dense array, through which all the elements can be traversed and modified.
+    /// </summary>
+    /// <remarks>
+    /// The order of the elements is undefined and changes when elements are removed.<br/>
+    /// The span becomes invalid when elements are added or removed.
+    /// </remarks>
+    /// <returns>
+    /// A span that views all the elements.
+    /// </returns>
+    Span<T> GetValues()
+    {
+        return m_arElements.IsEmpty() ? Span<T>() : Span<T>(&m_arElements[0], m_arElements.GetCount());
+    }
+
+    /// <summary>
+    /// Gets a span that views the dense array, through which all the elements can be traversed.
+    /// </summary>
+    /// <remarks>
+    /// The order of the elements is undefined and changes when elements are removed.<br/>
+    /// The span becomes invalid when elements are added or removed.
+    /// </remarks>
+    /// <returns>
+    /// A span that views all the elements.
+    /// </returns>
+    Span<const T> GetValues() const
+    {
+        return m_arElements.IsEmpty() ? Span<const T>() : Span<const T>(&m_arElements[0], m_arElements.GetCount());
+    }
+
+    /// <summary>
+    /// Gets the number of elements for which memory has been reserved in the dense array.
+    /// </summary>
+    /// <returns>
+    /// The capacity.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_arElements.GetCapacity();
+    }
+
+    /// <summary>
+    /// Gets the number of elements.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        return m_arElements.GetCount();
+    }
+
+    /// <summary>
+    /// Indicates whether the slot map is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if there are no elements; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_arElements.IsEmpty();
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The dense array that stores the elements contiguously.
+    /// </summary>
+    ArrayDynamic<T, AllocatorT> m_arElements;
+
+    /// <summary>
+    /// The slot of every element of the dense array, in the same order.
+    /// </summary>
+    ArrayDynamic<u32_z> m_arElementSlots;
+
+    /// <summary>
+    /// The sparse array of slots, indexed by handles.
+    /// </summary>
+    ArrayDynamic<Slot> m_arSlots;
+
+    /// <summary>
+    /// The position of the first free slot, which is the last removed one, or END_POSITION if there are no free slots.
+    /// </summary>
+    u32_z m_uFirstFreeSlot;
+};
+
+} // namespace z
+
+
+#endif // __SLOTMAP__
@@ -0,0 +1,164 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SPAN__
+#define __SPAN__
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Assertions.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a view of a sequence of elements placed contiguously in memory and owned by another object, through which they can be 
+/// read and modified without copying them.
+/// </summary>
+/// <remarks>
+/// Spans do not own the elements, so they do not call constructors nor destructors and become invalid when the owner reallocates or 
+/// destroys the elements.<br/>
+/// Copying a span is cheap, it only copies a pointer and a number.
+/// </remarks>
+/// <typeparam name="T">The type of the elements. It can be const-qualified so the elements can only be read.</typeparam>
+template<class T>
+class Span
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor that creates an empty span.
+    /// </summary>
+    Span() : m_pElements(null_z),
+             m_uCount(0)
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the sequence of elements to view.
+    /// </summary>
+    /// <param name="pElements">[IN] The first element of the sequence. It must not be null unless the number of elements is zero.</param>
+    /// <param name="uCount">[IN] The number of elements in the sequence.</param>
+    Span(T* pElements, const puint_z uCount) : m_pElements(pElements),
+                                               m_uCount(uCount)
+    {
+        Z_ASSERT_ERROR(pElements != null_z || uCount == 0, "The sequence of elements cannot be null.");
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Array subscript operator that retrieves an element by its position.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position (zero-based) of the element. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// A reference to the element.
+    /// </returns>
+    T& operator[](const puint_z uIndex) const
+    {
+        Z_ASSERT_ERROR(uIndex < m_uCount, "The index is out of bounds.");
+
+        return m_pElements[uIndex];
+    }
+
+    /// <summary>
+    /// Gets a span that views a part of the sequence.
+    /// </summary>
+    /// <param name="uFirst">[IN] The position (zero-based) of the first element of the part. It must not be greater than the number of elements.</param>
+    /// <param name="uCount">[IN] The number of elements of the part. The part must not exceed the end of the sequence.</param>
+    /// <returns>
+    /// A span that views the part of the sequence.
+    /// </returns>
+    Span GetSubspan(const puint_z uFirst, const puint_z uCount) const
+    {
+        Z_ASSERT_ERROR(uFirst <= m_uCount && uCount <= m_uCount - uFirst, "The part exceeds the end of the sequence.");
+
+        return Span(m_pElements + uFirst, uCount);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the first element of the sequence.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first element. It is null if the span was created empty.
+    /// </returns>
+    T* GetData() const
+    {
+        return m_pElements;
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the sequence.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    puint_z GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Indicates whether the sequence is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if there are no elements; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_uCount == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The first element of the sequence.
+    /// </summary>
+    T* m_pElements;
+
+    /// <summary>
+    /// The number of elements in the sequence.
+    /// </summary>
+    puint_z m_uCount;
+};
+
+} // namespace z
+
+
+#endif // __SPAN__
@@ -31,6 +31,9 @@
 
 #include "ZDiagnosis/ICallStackTraceFormatter.h"
 #include "ZDiagnosis/CallStackTrace.h"
+#include "ZDiagnosis/ICallProfileFormatter.h"
+#include "ZDiagnosis/CallProfile.h"
+#include "ZContainers/ArrayDynamic.h"
 #include "ZCommon/RTTIDefinitions.h"
 #include <boost/shared_ptr.hpp>
 
@@ -56,6 +59,20 @@ public:
     /// <param name="callStackTrace">[IN] A call stack trace.</param>
     virtual void PrintCallStackTrace(const CallStackTrace &callStackTrace);
     
+    /// <summary>
+    /// Prints information from a call profile using the format provided by a call profile formatter.
+    /// </summary>
+    /// <param name="profile">[IN] A call profile.</param>
+    /// <param name="formatter">[IN] The formatter that converts the profile to text.</param>
+    virtual void PrintCallProfile(const CallProfile &profile, const ICallProfileFormatter &formatter);
+    
+    /// <summary>
+    /// Prints information from a sequence of call profiles, as a single document, using the format provided by a call profile formatter.
+    /// </summary>
+    /// <param name="arProfiles">[IN] A sequence of call profiles.</param>
+    /// <param name="formatter">[IN] The formatter that converts the profiles to text.</param>
+    virtual void PrintCallProfiles(const ArrayDynamic<CallProfile> &arProfiles, const ICallProfileFormatter &formatter);
+    
     /// <summary>
     /// Prints text to the output channel.
     /// </summary>
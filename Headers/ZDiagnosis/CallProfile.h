@@ -0,0 +1,145 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __CALLPROFILE__
+#define __CALLPROFILE__
+
+#include "ZDiagnosis/DiagnosisModuleDefinitions.h"
+
+#include "ZDiagnosis/CallSiteProfile.h"
+#include "ZContainers/ArrayDynamic.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// A call profile, which stores the timing statistics of the profiled function calls arranged as a call tree. It may be associated to a concrete thread 
+/// or be the result of merging the profiles of several threads.
+/// </summary>
+/// <remarks>
+/// Call sites are stored in pre-order: every call site is followed by the call sites of the functions it called, whose depth is greater by one unit.<br/>
+/// A function called from two different callers produces two call sites.
+/// </remarks>
+class Z_DIAGNOSIS_MODULE_SYMBOLS CallProfile
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Index used as parent when adding call sites that were not called from any other profiled function.
+    /// </summary>
+    static const puint_z NO_PARENT;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Constructor that receives the id of a thread as a string.
+    /// </summary>
+    /// <param name="strThreadId">[IN] The Id of the thread, or any other text that identifies the profile.</param>
+    explicit CallProfile(const string_z &strThreadId);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Adds a call site as a callee of another call site. If the parent already has a callee that refers to the same function, the statistics are merged instead.
+    /// </summary>
+    /// <remarks>
+    /// The depth of the added call site is calculated from its parent's, the one stored in the input call site is ignored.<br/>
+    /// Call sites placed after the parent's subtree are moved one position forward.
+    /// </remarks>
+    /// <param name="uParentIndex">[IN] The position index of the caller's call site, or NO_PARENT. It must be lower than the number of call sites.</param>
+    /// <param name="callSite">[IN] The call site to be added or merged.</param>
+    /// <returns>
+    /// The position index of the added or merged call site.
+    /// </returns>
+    puint_z AddCallSite(const puint_z uParentIndex, const CallSiteProfile &callSite);
+
+    /// <summary>
+    /// Merges the call tree of another profile into this one. Call sites that appear in the same position of both trees are combined; 
+    /// the rest are added.
+    /// </summary>
+    /// <param name="profile">[IN] The profile to be merged.</param>
+    void Merge(const CallProfile &profile);
+
+    /// <summary>
+    /// Gets a call site.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position index (zero-based) of the call site, in pre-order. It must be lower than the number of call sites.</param>
+    /// <returns>
+    /// The obtained call site.
+    /// </returns>
+    const CallSiteProfile& GetCallSite(const puint_z uIndex) const;
+
+
+    // PROPERTIES
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Gets the number of call sites in the profile.
+    /// </summary>
+    /// <returns>
+    /// The number of call sites.
+    /// </returns>
+    puint_z GetCount() const;
+    
+    /// <summary>
+    /// Gets the thread Id.
+    /// </summary>
+    /// <returns>
+    /// The thread Id as a string.
+    /// </returns>
+    string_z GetThreadId() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+    
+    /// <summary>
+    /// The call sites of the profile, in pre-order.
+    /// </summary>
+    ArrayDynamic<CallSiteProfile> m_arCallSites;
+    
+    /// <summary>
+    /// The Id of the thread associated to this profile.
+    /// </summary>
+    string_z m_strThreadId;
+
+};
+
+} // namespace z
+
+
+#endif // __CALLPROFILE__
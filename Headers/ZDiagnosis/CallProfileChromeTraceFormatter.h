@@ -0,0 +1,106 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __CALLPROFILECHROMETRACEFORMATTER__
+#define __CALLPROFILECHROMETRACEFORMATTER__
+
+#include "ZDiagnosis/DiagnosisModuleDefinitions.h"
+
+#include "ICallProfileFormatter.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// A call profile formatter implementation that generates JSON text using the Trace Event Format, which can be loaded by the trace viewer of Chromium 
+/// based browsers and other tools.
+/// </summary>
+/// <remarks>
+/// Every profile is shown as a separate thread. Since profiles store accumulated times instead of individual calls, every call site produces one 
+/// complete event whose duration is its inclusive time; callees are placed one after another from the beginning of their caller, like in a flame graph.<br/>
+/// The number of calls, the exclusive, minimum and maximum times are stored in the arguments of every event.
+/// </remarks>
+class Z_DIAGNOSIS_MODULE_SYMBOLS CallProfileChromeTraceFormatter : public ICallProfileFormatter
+{
+public:
+
+    Z_RTTI_SUPPORT_DERIVED_FROM_1_CLASS(CallProfileChromeTraceFormatter, ICallProfileFormatter);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    virtual ~CallProfileChromeTraceFormatter();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// @copydoc ICallProfileFormatter::FormatCallProfilesFooter
+    virtual void FormatCallProfilesFooter(string_z &strFormattedProfile) const;
+
+    /// @copydoc ICallProfileFormatter::FormatCallProfilesHeader
+    virtual void FormatCallProfilesHeader(string_z &strFormattedProfile) const;
+
+    /// @copydoc ICallProfileFormatter::FormatCallProfile
+    virtual void FormatCallProfile(const CallProfile &profile, const puint_z uProfileIndex, string_z &strFormattedProfile) const;
+    
+    /// <summary>
+    /// A string representation of the instance.
+    /// </summary>
+    /// <returns>
+    /// The name of the class.
+    /// </returns>
+    virtual string_z ToString() const;
+
+protected:
+
+    /// <summary>
+    /// Appends a text as a JSON string, between quotation marks and escaping the characters that require it.
+    /// </summary>
+    /// <param name="strText">[IN] The text to append.</param>
+    /// <param name="strFormattedProfile">[OUT] The text to which the JSON string will be appended.</param>
+    static void _AppendJsonString(const string_z &strText, string_z &strFormattedProfile);
+
+    /// <summary>
+    /// Appends an amount of nanoseconds as microseconds, with 3 decimals.
+    /// </summary>
+    /// <param name="uNanoseconds">[IN] The amount of nanoseconds.</param>
+    /// <param name="strFormattedProfile">[OUT] The text to which the number will be appended.</param>
+    static void _AppendMicroseconds(const u64_z uNanoseconds, string_z &strFormattedProfile);
+
+};
+
+} // namespace z
+
+
+#endif // __CALLPROFILECHROMETRACEFORMATTER__
@@ -0,0 +1,98 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __CALLPROFILEPLAINTEXTFORMATTER__
+#define __CALLPROFILEPLAINTEXTFORMATTER__
+
+#include "ZDiagnosis/DiagnosisModuleDefinitions.h"
+
+#include "ICallProfileFormatter.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// A call profile formatter implementation that generates a flat report in plain text: one row per function, no matter where it was called from, 
+/// sorted by exclusive time in descending order.
+/// </summary>
+/// <remarks>
+/// The inclusive time of recursive calls is counted only once, for the outermost call.
+/// </remarks>
+class Z_DIAGNOSIS_MODULE_SYMBOLS CallProfilePlainTextFormatter : public ICallProfileFormatter
+{
+public:
+
+    Z_RTTI_SUPPORT_DERIVED_FROM_1_CLASS(CallProfilePlainTextFormatter, ICallProfileFormatter);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    virtual ~CallProfilePlainTextFormatter();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// @copydoc ICallProfileFormatter::FormatCallProfilesFooter
+    virtual void FormatCallProfilesFooter(string_z &strFormattedProfile) const;
+
+    /// @copydoc ICallProfileFormatter::FormatCallProfilesHeader
+    virtual void FormatCallProfilesHeader(string_z &strFormattedProfile) const;
+
+    /// @copydoc ICallProfileFormatter::FormatCallProfile
+    virtual void FormatCallProfile(const CallProfile &profile, const puint_z uProfileIndex, string_z &strFormattedProfile) const;
+    
+    /// <summary>
+    /// A string representation of the instance.
+    /// </summary>
+    /// <returns>
+    /// The name of the class.
+    /// </returns>
+    virtual string_z ToString() const;
+
+protected:
+
+    /// <summary>
+    /// Appends a text, adding spaces to its left so it occupies a minimum number of characters.
+    /// </summary>
+    /// <param name="strText">[IN] The text to append.</param>
+    /// <param name="uWidth">[IN] The minimum number of characters.</param>
+    /// <param name="strFormattedProfile">[OUT] The text to which the aligned text will be appended.</param>
+    static void _AppendRightAligned(const string_z &strText, const unsigned int uWidth, string_z &strFormattedProfile);
+
+};
+
+} // namespace z
+
+
+#endif // __CALLPROFILEPLAINTEXTFORMATTER__
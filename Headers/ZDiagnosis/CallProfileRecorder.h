@@ -0,0 +1,312 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __CALLPROFILERECORDER__
+#define __CALLPROFILERECORDER__
+
+#include <boost/atomic.hpp>
+
+#include "ZDiagnosis/DiagnosisModuleDefinitions.h"
+#include "ZDiagnosis/CallTrace.h"
+#include "ZDiagnosis/CallProfile.h"
+#include "ZContainers/ArrayDynamic.h"
+#include "ZTiming/Stopwatch.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Accumulates the timing statistics of the function calls performed by a single thread, arranged as a call tree.
+/// </summary>
+/// <remarks>
+/// Only the owner thread can begin and end calls, which never blocks. Any thread can obtain a copy of the current statistics at any moment.<br/>
+/// Function signatures and class names are stored as pointers so they must have static storage duration, as the string literals used by call 
+/// stack tracing macros have.<br/>
+/// It uses the time-stamp counter of the processor when available.
+/// </remarks>
+class Z_DIAGNOSIS_MODULE_SYMBOLS CallProfileRecorder
+{
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// A node of the call tree, which stores the statistics of a call site.
+    /// </summary>
+    /// <remarks>
+    /// Statistics are only written by the owner thread and are atomic so they can be read by any thread.
+    /// </remarks>
+    class CallNode
+    {
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The function signature.
+        /// </summary>
+        const char* m_szFunctionSignature;
+
+        /// <summary>
+        /// The name of the class. It can be null.
+        /// </summary>
+        const char* m_szClassName;
+
+        /// <summary>
+        /// The index of the parent node, or NO_NODE.
+        /// </summary>
+        puint_z m_uParent;
+
+        /// <summary>
+        /// The index of the first child node, or NO_NODE. Only accessed by the owner thread.
+        /// </summary>
+        puint_z m_uFirstChild;
+
+        /// <summary>
+        /// The index of the next sibling node, or NO_NODE. Only accessed by the owner thread.
+        /// </summary>
+        puint_z m_uNextSibling;
+
+        /// <summary>
+        /// The number of finished calls.
+        /// </summary>
+        boost::atomic<u64_z> m_uCallCount;
+
+        /// <summary>
+        /// The inclusive time, in nanoseconds.
+        /// </summary>
+        boost::atomic<u64_z> m_uInclusiveTime;
+
+        /// <summary>
+        /// The exclusive time, in nanoseconds.
+        /// </summary>
+        boost::atomic<u64_z> m_uExclusiveTime;
+
+        /// <summary>
+        /// The minimum time, in nanoseconds.
+        /// </summary>
+        boost::atomic<u64_z> m_uMinimumTime;
+
+        /// <summary>
+        /// The maximum time, in nanoseconds.
+        /// </summary>
+        boost::atomic<u64_z> m_uMaximumTime;
+    };
+
+    /// <summary>
+    /// A call that has begun and has not ended yet.
+    /// </summary>
+    class CallFrame
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the node of the call and a stopwatch that has been set when the call began.
+        /// </summary>
+        /// <param name="uNode">[IN] The index of the node, or NO_NODE if the call is not being profiled.</param>
+        /// <param name="stopwatch">[IN] The stopwatch that measures the duration of the call.</param>
+        CallFrame(const puint_z uNode, const Stopwatch &stopwatch) : m_uNode(uNode),
+                                                                      m_stopwatch(stopwatch),
+                                                                      m_uCalleesTime(0)
+        {
+        }
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The index of the node, or NO_NODE.
+        /// </summary>
+        puint_z m_uNode;
+
+        /// <summary>
+        /// The stopwatch that measures the duration of the call.
+        /// </summary>
+        Stopwatch m_stopwatch;
+
+        /// <summary>
+        /// The time spent in calls made from this one, in nanoseconds.
+        /// </summary>
+        u64_z m_uCalleesTime;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Index that represents the absence of a node.
+    /// </summary>
+    static const puint_z NO_NODE;
+
+    /// <summary>
+    /// The number of nodes allocated together. Nodes are never moved once allocated.
+    /// </summary>
+    static const puint_z NODES_PER_CHUNK = 256U;
+
+    /// <summary>
+    /// The maximum number of chunks of nodes. It limits the number of different call sites that can be recorded.
+    /// </summary>
+    static const puint_z MAXIMUM_CHUNKS = 1024U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the id of the owner thread as a string.
+    /// </summary>
+    /// <param name="strThreadId">[IN] The Id of the owner thread.</param>
+    explicit CallProfileRecorder(const string_z &strThreadId);
+
+private:
+
+    // Hidden
+    CallProfileRecorder(const CallProfileRecorder&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~CallProfileRecorder();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    CallProfileRecorder& operator=(const CallProfileRecorder&);
+
+public:
+
+    /// <summary>
+    /// Starts measuring a call to a function, as a callee of the last call that has not ended yet. It must be called by the owner thread.
+    /// </summary>
+    /// <param name="trace">[IN] The trace of the function call. Only the function signature and the class name are used.</param>
+    void BeginCall(const CallTrace &trace);
+
+    /// <summary>
+    /// Stops measuring the last call that has not ended yet and accumulates its duration. It must be called by the owner thread.
+    /// </summary>
+    void EndCall();
+
+    /// <summary>
+    /// Gets a copy of the statistics recorded so far. It can be called by any thread.
+    /// </summary>
+    /// <remarks>
+    /// Calls that have not ended yet are not counted. Call sites whose signatures are equal but are stored in different strings are combined.
+    /// </remarks>
+    /// <returns>
+    /// A call profile with the statistics of every call site.
+    /// </returns>
+    CallProfile GetProfile() const;
+
+protected:
+
+    /// <summary>
+    /// Searches for a child node with the same function signature and class name or creates a new one.
+    /// </summary>
+    /// <param name="uParent">[IN] The index of the parent node, or NO_NODE.</param>
+    /// <param name="trace">[IN] The trace of the function call.</param>
+    /// <returns>
+    /// The index of the node, or NO_NODE if there is no space for more nodes.
+    /// </returns>
+    puint_z _FindOrAddNode(const puint_z uParent, const CallTrace &trace);
+
+    /// <summary>
+    /// Gets a node.
+    /// </summary>
+    /// <param name="uIndex">[IN] The index of the node. It must be lower than the number of nodes.</param>
+    /// <returns>
+    /// The node.
+    /// </returns>
+    CallNode& _GetNode(const puint_z uIndex) const;
+
+
+    // PROPERTIES
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Gets the Id of the owner thread.
+    /// </summary>
+    /// <returns>
+    /// The thread Id as a string.
+    /// </returns>
+    string_z GetThreadId() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The chunks of nodes of the call tree. Only the owner thread allocates them.
+    /// </summary>
+    CallNode* m_arChunks[MAXIMUM_CHUNKS];
+
+    /// <summary>
+    /// The number of nodes that have been completely initialized.
+    /// </summary>
+    boost::atomic<puint_z> m_uNodeCount;
+
+    /// <summary>
+    /// The index of the first node that was not called from any other profiled function, or NO_NODE. Only accessed by the owner thread.
+    /// </summary>
+    puint_z m_uFirstRootNode;
+
+    /// <summary>
+    /// The calls that have not ended yet, from the outermost to the innermost. Only accessed by the owner thread.
+    /// </summary>
+    ArrayDynamic<CallFrame> m_arCallFrames;
+
+    /// <summary>
+    /// A stopwatch that is copied for every new call so the clock source is selected only once.
+    /// </summary>
+    Stopwatch m_stopwatch;
+
+    /// <summary>
+    /// The Id of the owner thread.
+    /// </summary>
+    string_z m_strThreadId;
+
+};
+
+} // namespace z
+
+
+#endif // __CALLPROFILERECORDER__
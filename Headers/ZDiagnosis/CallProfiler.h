@@ -0,0 +1,198 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __CALLPROFILER__
+#define __CALLPROFILER__
+
+#include <boost/atomic.hpp>
+#include <boost/thread/tss.hpp>
+
+#include "ZDiagnosis/DiagnosisModuleDefinitions.h"
+#include "ZDiagnosis/CallTrace.h"
+#include "ZDiagnosis/CallProfile.h"
+#include "ZDiagnosis/CallProfileRecorder.h"
+#include "ZThreading/SharedMutex.h"
+#include "ZContainers/ArrayDynamic.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Measures the time spent in every traced function of every thread in a single process, keeping a separate call tree per thread. It is fed by 
+/// the call stack tracing macros when it is enabled.
+/// </summary>
+/// <remarks>
+/// It is a singleton.<br/>
+/// It is thread-safe. Beginning and ending calls does not use locks, except the first time a thread calls a function.<br/>
+/// The statistics of a thread are kept after the thread finishes.
+/// </remarks>
+class Z_DIAGNOSIS_MODULE_SYMBOLS CallProfiler
+{
+    // TYPEDEFS
+    // ---------------
+protected:
+
+    typedef ArrayDynamic<CallProfileRecorder*> CallProfileRecorderContainer;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    CallProfiler();
+
+
+    // DESTRUCTOR
+    // ---------------
+private:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~CallProfiler();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the instance of the call profiler.
+    /// </summary>
+    /// <returns>
+    /// A unique instance of the call profiler.
+    /// </returns>
+    static CallProfiler* Get();
+
+    /// <summary>
+    /// Starts measuring a function call in the current thread, as a callee of the last call that has not ended yet.
+    /// </summary>
+    /// <remarks>
+    /// It does not check whether the profiler is enabled.
+    /// </remarks>
+    /// <param name="trace">[IN] The trace of the function call. The function signature and the class name must have static storage duration.</param>
+    void BeginCall(const CallTrace &trace);
+
+    /// <summary>
+    /// Stops measuring the last call of the current thread that has not ended yet. There must be a call to end.
+    /// </summary>
+    void EndCall();
+
+    /// <summary>
+    /// Gets a copy of the statistics recorded for the current thread.
+    /// </summary>
+    /// <returns>
+    /// The call profile of the current thread. It is empty if the thread has not called any profiled function.
+    /// </returns>
+    CallProfile GetProfile() const;
+
+    /// <summary>
+    /// Gets a copy of the statistics recorded for every thread.
+    /// </summary>
+    /// <returns>
+    /// The call profiles of all the threads, in the order they called a profiled function for the first time.
+    /// </returns>
+    ArrayDynamic<CallProfile> GetThreadProfiles() const;
+
+    /// <summary>
+    /// Gets the statistics of all the threads merged into one call tree.
+    /// </summary>
+    /// <returns>
+    /// A call profile that combines the profiles of all the threads.
+    /// </returns>
+    CallProfile GetMergedProfile() const;
+
+private:
+
+    /// <summary>
+    /// Gets the recorder of the current thread, creating and registering it if it does not exist.
+    /// </summary>
+    /// <returns>
+    /// The recorder of the current thread.
+    /// </returns>
+    CallProfileRecorder* _GetOrCreateRecorder();
+
+    /// <summary>
+    /// Function used by the thread-specific pointer when a thread finishes. It does nothing since recorders are owned by the profiler.
+    /// </summary>
+    /// <param name="pRecorder">[IN] The recorder of the finished thread.</param>
+    static void _KeepRecorder(CallProfileRecorder* pRecorder);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Indicates whether the call stack tracing macros send calls to the profiler.
+    /// </summary>
+    /// <returns>
+    /// True if the profiler is enabled; False otherwise. By default, it is disabled.
+    /// </returns>
+    bool IsEnabled() const;
+
+    /// <summary>
+    /// Enables or disables the profiler. Calls that began while the profiler was enabled are always ended.
+    /// </summary>
+    /// <param name="bIsEnabled">[IN] True to enable the profiler; False to disable it.</param>
+    void SetEnabled(const bool bIsEnabled);
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The recorder of every thread that has called a profiled function.
+    /// </summary>
+    CallProfileRecorderContainer m_arRecorders;
+
+    /// <summary>
+    /// The recorder of the current thread.
+    /// </summary>
+    boost::thread_specific_ptr<CallProfileRecorder> m_pThreadRecorder;
+
+    /// <summary>
+    /// Indicates whether the profiler is enabled.
+    /// </summary>
+    boost::atomic<bool> m_bIsEnabled;
+
+    // Synchronization
+    
+    /// <summary>
+    /// Mutex to synchronize the access to the recorder container.
+    /// </summary>
+    mutable SharedMutex m_recordersMutex;
+};
+
+} // namespace z
+
+
+#endif // __CALLPROFILER__
@@ -0,0 +1,218 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __CALLSITEPROFILE__
+#define __CALLSITEPROFILE__
+
+#include "ZDiagnosis/DiagnosisModuleDefinitions.h"
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Stores the timing statistics gathered by the call profiler for a concrete function call site, which is identified by the function signature 
+/// and the name of the class, and its position in a call tree.
+/// </summary>
+/// <remarks>
+/// All times are expressed in nanoseconds.
+/// </remarks>
+class Z_DIAGNOSIS_MODULE_SYMBOLS CallSiteProfile
+{
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives all the statistics of the call site.
+    /// </summary>
+    /// <param name="szFunctionSignature">[IN] The function signature. It must not be null and it must remain valid during the lifetime of the instance.</param>
+    /// <param name="szClassName">[IN] The name of the class. It can be null. It must remain valid during the lifetime of the instance.</param>
+    /// <param name="uDepth">[IN] The depth of the call site in the call tree, where zero means it was called from no other profiled function.</param>
+    /// <param name="uCallCount">[IN] The number of times the function was called.</param>
+    /// <param name="uInclusiveTime">[IN] The total time spent in the function, including the time spent in other profiled functions called from it.</param>
+    /// <param name="uExclusiveTime">[IN] The total time spent in the function, excluding the time spent in other profiled functions called from it.</param>
+    /// <param name="uMinimumTime">[IN] The shortest inclusive time of a single call.</param>
+    /// <param name="uMaximumTime">[IN] The longest inclusive time of a single call.</param>
+    CallSiteProfile(const char* szFunctionSignature, 
+                    const char* szClassName, 
+                    const unsigned int uDepth, 
+                    const u64_z uCallCount, 
+                    const u64_z uInclusiveTime, 
+                    const u64_z uExclusiveTime, 
+                    const u64_z uMinimumTime, 
+                    const u64_z uMaximumTime);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Checks whether another call site profile refers to the same function, comparing the function signatures and class names.
+    /// </summary>
+    /// <param name="callSite">[IN] The other call site profile.</param>
+    /// <returns>
+    /// True if both refer to the same function; False otherwise.
+    /// </returns>
+    bool IsSameFunction(const CallSiteProfile &callSite) const;
+
+    /// <summary>
+    /// Accumulates the statistics of another call site profile into this one. Call counts and times are added, minimum and maximum times 
+    /// are recalculated.
+    /// </summary>
+    /// <param name="callSite">[IN] The other call site profile. It should refer to the same function.</param>
+    void Merge(const CallSiteProfile &callSite);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Gets the function signature.
+    /// </summary>
+    /// <returns>
+    /// The function signature.
+    /// </returns>
+    const char* GetFunctionSignature() const;
+    
+    /// <summary>
+    /// Gets the name of the class.
+    /// </summary>
+    /// <returns>
+    /// The name of the class, if any. It can be null.
+    /// </returns>
+    const char* GetClassName() const;
+    
+    /// <summary>
+    /// Gets the depth of the call site in the call tree.
+    /// </summary>
+    /// <returns>
+    /// The depth, where zero means it was called from no other profiled function.
+    /// </returns>
+    unsigned int GetDepth() const;
+
+    /// <summary>
+    /// Sets the depth of the call site in the call tree.
+    /// </summary>
+    /// <param name="uDepth">[IN] The depth, where zero means it was called from no other profiled function.</param>
+    void SetDepth(const unsigned int uDepth);
+    
+    /// <summary>
+    /// Gets the number of times the function was called.
+    /// </summary>
+    /// <returns>
+    /// The number of calls.
+    /// </returns>
+    u64_z GetCallCount() const;
+    
+    /// <summary>
+    /// Gets the total time spent in the function, including the time spent in other profiled functions called from it.
+    /// </summary>
+    /// <returns>
+    /// The inclusive time, in nanoseconds.
+    /// </returns>
+    u64_z GetInclusiveTime() const;
+    
+    /// <summary>
+    /// Gets the total time spent in the function, excluding the time spent in other profiled functions called from it.
+    /// </summary>
+    /// <returns>
+    /// The exclusive time, in nanoseconds.
+    /// </returns>
+    u64_z GetExclusiveTime() const;
+    
+    /// <summary>
+    /// Gets the shortest inclusive time of a single call.
+    /// </summary>
+    /// <returns>
+    /// The minimum time, in nanoseconds. It is zero when the function has not returned yet.
+    /// </returns>
+    u64_z GetMinimumTime() const;
+    
+    /// <summary>
+    /// Gets the longest inclusive time of a single call.
+    /// </summary>
+    /// <returns>
+    /// The maximum time, in nanoseconds.
+    /// </returns>
+    u64_z GetMaximumTime() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The function signature.
+    /// </summary>
+    const char* m_szFunctionSignature;
+
+    /// <summary>
+    /// The name of the class, if any. It can be null.
+    /// </summary>
+    const char* m_szClassName;
+
+    /// <summary>
+    /// The depth of the call site in the call tree.
+    /// </summary>
+    unsigned int m_uDepth;
+
+    /// <summary>
+    /// The number of times the function was called.
+    /// </summary>
+    u64_z m_uCallCount;
+
+    /// <summary>
+    /// The inclusive time, in nanoseconds.
+    /// </summary>
+    u64_z m_uInclusiveTime;
+
+    /// <summary>
+    /// The exclusive time, in nanoseconds.
+    /// </summary>
+    u64_z m_uExclusiveTime;
+
+    /// <summary>
+    /// The minimum time, in nanoseconds.
+    /// </summary>
+    u64_z m_uMinimumTime;
+
+    /// <summary>
+    /// The maximum time, in nanoseconds.
+    /// </summary>
+    u64_z m_uMaximumTime;
+
+};
+
+} // namespace z
+
+
+#endif // __CALLSITEPROFILE__
@@ -35,6 +35,7 @@
 #include "ZDiagnosis/CallStackTrace.h"
 #include "ZThreading/Thread.h"
 #include "ZThreading/SharedMutex.h"
+#include "ZThreading/ThreadLocalObjectPool.h"
 #include "ZContainers/Dictionary.h"
 
 
@@ -133,6 +134,11 @@ protected:
     /// A dictionary which contains every call stack trace associated to its thread Id.
     /// </summary>
     CallStackTraceContainer m_callStackTraces;
+
+    /// <summary>
+    /// The pools from which every thread borrows its call stack trace, which is returned when its last trace is removed.
+    /// </summary>
+    ThreadLocalObjectPool<CallStackTrace> m_callStackTracePool;
     
     /// <summary>
     /// The custom printer to be used by the tracer.
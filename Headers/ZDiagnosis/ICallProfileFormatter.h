@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __ICALLPROFILEFORMATTER__
+#define __ICALLPROFILEFORMATTER__
+
+#include "ZDiagnosis/DiagnosisModuleDefinitions.h"
+
+#include "ZDiagnosis/CallProfile.h"
+#include "ZCommon/RTTIDefinitions.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a component whose job is to convert call profiles to text with a concrete format, depending on the implementation.
+/// </summary>
+/// <remarks>
+/// Several profiles can be formatted into the same text; the header is generated once before the first profile and the footer once after the last.
+/// </remarks>
+class Z_DIAGNOSIS_MODULE_SYMBOLS ICallProfileFormatter
+{
+public:
+
+    Z_RTTI_SUPPORT_INTERFACE(ICallProfileFormatter);
+
+
+    // METHODS
+    // ---------------
+public:
+    
+    /// <summary>
+    /// Creates a footer text that closes a sequence of call profiles.
+    /// </summary>
+    /// <param name="strFormattedProfile">[OUT] The text to which the formatted footer will be appended.</param>
+    virtual void FormatCallProfilesFooter(string_z &strFormattedProfile) const=0;
+    
+    /// <summary>
+    /// Creates a header text that opens a sequence of call profiles.
+    /// </summary>
+    /// <param name="strFormattedProfile">[OUT] The text to which the formatted header will be appended.</param>
+    virtual void FormatCallProfilesHeader(string_z &strFormattedProfile) const=0;
+    
+    /// <summary>
+    /// Creates a text with a certain format using the information provided by a call profile.
+    /// </summary>
+    /// <param name="profile">[IN] A call profile.</param>
+    /// <param name="uProfileIndex">[IN] The position of the profile in the sequence, starting at zero.</param>
+    /// <param name="strFormattedProfile">[OUT] The text to which the formatted text will be appended.</param>
+    virtual void FormatCallProfile(const CallProfile &profile, const puint_z uProfileIndex, string_z &strFormattedProfile) const=0;
+
+};
+
+} // namespace z
+
+
+#endif // __ICALLPROFILEFORMATTER__
@@ -39,6 +39,9 @@ namespace z
 /// Adds or removes call traces from the calling thread's call stack trace. It is intended to be instanced at the very beginning of a function body so it adds
 /// a trace through the call stack tracer; when the control flow leaves the function and the instance is destroyed, the last registered trace is removed.
 /// </summary>
+/// <remarks>
+/// If the call profiler is enabled when the instance is created, it also measures the time spent in the function.
+/// </remarks>
 class Z_DIAGNOSIS_MODULE_SYMBOLS ScopedCallTraceNotifier
 {
     // CONSTRUCTORS
@@ -61,6 +64,16 @@ public:
     /// </summary>
     ~ScopedCallTraceNotifier();
 
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// Indicates whether the call profiler began measuring the call, so it has to be ended.
+    /// </summary>
+    bool m_bIsProfiled;
+
 };
 
 } // namespace z
@@ -0,0 +1,111 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __ASYNCFILEREAD__
+#define __ASYNCFILEREAD__
+
+#include "ZFileSystem/FileSystemModuleDefinitions.h"
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZThreading/AsyncTask.h"
+
+
+namespace z
+{
+
+// Forward declarations
+class FileStream;
+
+
+/// <summary>
+/// Represents a blocking asynchronous task that reads a group of bytes from a file stream, so other tasks can await the operation without 
+/// blocking their worker thread.
+/// </summary>
+/// <remarks>
+/// The task is executed by the threads of the AsyncTaskExecutor dedicated to blocking tasks.<br/>
+/// Every time the task is executed, it reads the next group of bytes from the current position of the stream (see FileStream::Read) and 
+/// copies them to the same output buffer.<br/>
+/// The stream must not be used by other threads while the task is running.
+/// </remarks>
+class Z_FILESYSTEM_MODULE_SYMBOLS AsyncFileRead : public AsyncTask
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the stream and the output buffer.
+    /// </summary>
+    /// <param name="stream">[IN] The stream from which bytes are read. It must exist while the task exists.</param>
+    /// <param name="pOutput">[IN] The output buffer where bytes are to be copied. It must not be null.</param>
+    /// <param name="uOutputOffset">[IN] The offset, in bytes, from where to start writing to the output buffer.</param>
+    /// <param name="uOutputSize">[IN] The number of bytes to be read. It must not equal zero.</param>
+    AsyncFileRead(FileStream &stream, void* pOutput, const puint_z uOutputOffset, const puint_z uOutputSize);
+
+
+    // METHODS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Reads the bytes from the stream.
+    /// </summary>
+    /// <returns>
+    /// Always True.
+    /// </returns>
+    virtual bool Resume();
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The stream from which bytes are read.
+    /// </summary>
+    FileStream* m_pStream;
+
+    /// <summary>
+    /// The output buffer where bytes are to be copied.
+    /// </summary>
+    void* m_pOutput;
+
+    /// <summary>
+    /// The offset, in bytes, from where to start writing to the output buffer.
+    /// </summary>
+    puint_z m_uOutputOffset;
+
+    /// <summary>
+    /// The number of bytes to be read.
+    /// </summary>
+    puint_z m_uOutputSize;
+};
+
+} // namespace z
+
+
+#endif // __ASYNCFILEREAD__
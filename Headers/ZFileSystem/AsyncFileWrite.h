@@ -0,0 +1,111 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __ASYNCFILEWRITE__
+#define __ASYNCFILEWRITE__
+
+#include "ZFileSystem/FileSystemModuleDefinitions.h"
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZThreading/AsyncTask.h"
+
+
+namespace z
+{
+
+// Forward declarations
+class FileStream;
+
+
+/// <summary>
+/// Represents a blocking asynchronous task that writes a group of bytes to a file stream and flushes it, so other tasks can await the operation without 
+/// blocking their worker thread.
+/// </summary>
+/// <remarks>
+/// The task is executed by the threads of the AsyncTaskExecutor dedicated to blocking tasks.<br/>
+/// Every time the task is executed, it writes the content of the same input buffer at the current position of the stream (see FileStream::Write) and 
+/// then updates the file (see FileStream::Flush).<br/>
+/// The stream must not be used by other threads while the task is running.
+/// </remarks>
+class Z_FILESYSTEM_MODULE_SYMBOLS AsyncFileWrite : public AsyncTask
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the stream and the input buffer.
+    /// </summary>
+    /// <param name="stream">[IN] The stream to which bytes are written. It must exist while the task exists.</param>
+    /// <param name="pInput">[IN] The input buffer from which bytes are to be copied. It must not be null.</param>
+    /// <param name="uInputOffset">[IN] The offset, in bytes, from where to start reading from the input buffer.</param>
+    /// <param name="uInputSize">[IN] The number of bytes to be written. It must not equal zero.</param>
+    AsyncFileWrite(FileStream &stream, const void* pInput, const puint_z uInputOffset, const puint_z uInputSize);
+
+
+    // METHODS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Writes the bytes to the stream and flushes it.
+    /// </summary>
+    /// <returns>
+    /// Always True.
+    /// </returns>
+    virtual bool Resume();
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The stream to which bytes are written.
+    /// </summary>
+    FileStream* m_pStream;
+
+    /// <summary>
+    /// The input buffer from which bytes are to be copied.
+    /// </summary>
+    const void* m_pInput;
+
+    /// <summary>
+    /// The offset, in bytes, from where to start reading from the input buffer.
+    /// </summary>
+    puint_z m_uInputOffset;
+
+    /// <summary>
+    /// The number of bytes to be written.
+    /// </summary>
+    puint_z m_uInputSize;
+};
+
+} // namespace z
+
+
+#endif // __ASYNCFILEWRITE__
@@ -32,6 +32,8 @@
 #include "ZCommon/DataTypes/DataTypesDefinitions.h"
 #include "ZFileSystem/EFileSystemError.h"
 #include "ZMemory/LinearAllocator.h"
+#include "ZMemory/ScopedScratchMark.h"
+#include "ZThreading/SThisThread.h"
 #include "ZFileSystem/EFileOpenMode.h"
 #include "ZFileSystem/Path.h"
 
@@ -213,9 +215,12 @@ public:
         // If offsets point to valid positions
         if(uSourceOffset < this->GetLength() && uDestinationOffset <= destinationStream.GetLength())
         {
-            // The stream is copied batch by batch
+            // The stream is copied batch by batch, using temporary memory of the current thread
+            ScratchAllocator &scratchAllocator = SThisThread::GetScratchAllocator();
+            ScopedScratchMark scratchMark(scratchAllocator);
+
             const puint_z NUMBER_OF_BATCHES = uNumberOfBytes / uBatchSize;
-            u8_z* arBatch = new u8_z[uBatchSize];
+            u8_z* arBatch = scast_z(scratchAllocator.Allocate(uBatchSize), u8_z*);
             
             this->SetPosition(uSourceOffset);
             destinationStream.SetPosition(uDestinationOffset);
@@ -233,8 +238,6 @@ public:
                 this->Read(arBatch, 0, REST_OF_BYTES);
                 destinationStream.Write(arBatch, 0, REST_OF_BYTES);
             }
-
-            delete[] arBatch;
         }
     }
 
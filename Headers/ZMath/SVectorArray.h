@@ -410,6 +410,34 @@ public:
     /// <param name="uElements">[IN] Number of elements in the array.</param>
     static void Transform(const SpaceConversionMatrix &spaceConversion, Vector4* arPoints, const unsigned int uElements);
 
+    /// <summary>
+    /// Transforms 3D points whose components are stored in separate arrays (structure of arrays), like the columns of an ArraySoA.
+    /// </summary>
+    /// <remarks>
+    /// Transformation will be applied to all points in the arrays.<br/>
+    /// When floating point numbers have simple precision, 4 points are transformed at once using SIMD instructions; arrays do not need to be aligned.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x3 matrix that contains the transformation to be applied.</param>
+    /// <param name="arX">[IN/OUT] Array of X components of the points. If it is null, the behavior is undefined.</param>
+    /// <param name="arY">[IN/OUT] Array of Y components of the points. If it is null, the behavior is undefined.</param>
+    /// <param name="arZ">[IN/OUT] Array of Z components of the points. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in every array.</param>
+    static void Transform(const TransformationMatrix4x3 &transformation, float_z* arX, float_z* arY, float_z* arZ, const unsigned int uElements);
+
+    /// <summary>
+    /// Transforms 3D points whose components are stored in separate arrays (structure of arrays), like the columns of an ArraySoA.
+    /// </summary>
+    /// <remarks>
+    /// Transformation will be applied to all points in the arrays.<br/>
+    /// When floating point numbers have simple precision, 4 points are transformed at once using SIMD instructions; arrays do not need to be aligned.
+    /// </remarks>
+    /// <param name="transformation">[IN] 4x4 matrix that contains the transformation to be applied.</param>
+    /// <param name="arX">[IN/OUT] Array of X components of the points. If it is null, the behavior is undefined.</param>
+    /// <param name="arY">[IN/OUT] Array of Y components of the points. If it is null, the behavior is undefined.</param>
+    /// <param name="arZ">[IN/OUT] Array of Z components of the points. If it is null, the behavior is undefined.</param>
+    /// <param name="uElements">[IN] Number of elements in every array.</param>
+    static void Transform(const TransformationMatrix4x4 &transformation, float_z* arX, float_z* arY, float_z* arZ, const unsigned int uElements);
+
     /// <summary>
     /// Rotates 2D points, using the provided pivot as the center of transformation.
     /// </summary>
@@ -641,6 +669,19 @@ public:
 
 private:
 
+    /// <summary>
+    /// Transforms 3D points whose components are stored in separate arrays.
+    /// </summary>
+    /// <typeparam name="MatrixT">Allowed types: Matrix4x3, Matrix4x4.</typeparam>
+    /// <param name="transformation">[IN] 4x3 or 4x4 matrix that contains the transformation to be applied.</param>
+    /// <param name="arX">[IN/OUT] Array of X components of the points.</param>
+    /// <param name="arY">[IN/OUT] Array of Y components of the points.</param>
+    /// <param name="arZ">[IN/OUT] Array of Z components of the points.</param>
+    /// <param name="uElements">[IN] Number of elements in every array.</param>
+    template <class MatrixT>
+    static void TransformImp(const Internals::TransformationMatrix<MatrixT> &transformation, float_z* arX, float_z* arY, float_z* arZ,
+                             const unsigned int uElements);
+
     /// <summary>
     /// Translates 3D or 4D points.
     /// </summary>
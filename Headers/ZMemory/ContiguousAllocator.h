@@ -0,0 +1,229 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __CONTIGUOUSALLOCATOR__
+#define __CONTIGUOUSALLOCATOR__
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/CommonModuleDefinitions.h"
+#include "ZCommon/Alignment.h"
+#include "ZMemory/MemoryModuleDefinitions.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents an allocator of fixed-size blocks that are stored contiguously in a single buffer, one after another, intended to be used by arrays.
+/// </summary>
+/// <remarks>
+/// Unlike PoolAllocator, it does not keep a list of free blocks: allocated blocks always occupy the beginning of the buffer and every deallocation 
+/// releases the last one, which is how arrays use it since their elements are always contiguous. Allocating a block only increments a counter.<br/>
+/// The buffer is reallocated with the functions of the operative system, which may extend it in place or remap its memory pages instead of copying it 
+/// (see aligned_realloc_z).
+/// </remarks>
+class Z_MEMORY_MODULE_SYMBOLS ContiguousAllocator
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructs an allocator passing the size of the buffer, the block size and the memory alignment.
+    /// </summary>
+    /// <param name="uSize">[IN] Size of the buffer, in bytes. It must be greater than zero.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    ContiguousAllocator(const puint_z uSize, const puint_z uBlockSize, const Alignment &alignment);
+
+private:
+
+    // Hidden
+    ContiguousAllocator(const ContiguousAllocator&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It frees the buffer.
+    /// </summary>
+    ~ContiguousAllocator();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    ContiguousAllocator& operator=(const ContiguousAllocator&);
+
+public:
+
+    /// <summary>
+    /// Allocates a block after the last allocated block and returns its address.
+    /// </summary>
+    /// <returns>
+    /// Pointer to the allocated memory block. Returns null if the buffer is full.
+    /// </returns>
+    void* Allocate();
+
+    /// <summary>
+    /// Deallocates the last allocated block.
+    /// </summary>
+    /// <param name="pBlock">[IN] The address of an allocated block. It must not be null.</param>
+    void Deallocate(const void* pBlock);
+
+    /// <summary>
+    /// Deallocates all the blocks.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Copies the allocated blocks to another allocator, which will have the same number of allocated blocks.
+    /// </summary>
+    /// <remarks>
+    /// The blocks are copied bitwise.
+    /// </remarks>
+    /// <param name="allocator">[IN/OUT] The destination allocator. Its buffer must be, at least, as big as the allocated bytes of the resident allocator 
+    /// and its block size must be the same.</param>
+    void CopyTo(ContiguousAllocator &allocator) const;
+
+    /// <summary>
+    /// Increases the size of the buffer, keeping the allocated blocks.
+    /// </summary>
+    /// <remarks>
+    /// Pointers to the blocks become invalid.
+    /// </remarks>
+    /// <param name="uNewSize">[IN] The new size of the buffer, in bytes. It must be greater than the current size.</param>
+    void Reallocate(const puint_z uNewSize);
+
+    /// <summary>
+    /// Exchanges the buffers and the allocated blocks of two allocators.
+    /// </summary>
+    /// <remarks>
+    /// No memory is copied.
+    /// </remarks>
+    /// <param name="allocator">[IN/OUT] The other allocator. It can be the resident allocator.</param>
+    void Swap(ContiguousAllocator &allocator);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Returns the size of the buffer in which blocks are allocated.
+    /// </summary>
+    /// <returns>
+    /// The size of the buffer, in bytes.
+    /// </returns>
+    inline puint_z GetPoolSize() const
+    {
+        return m_uPoolSize;
+    }
+
+    /// <summary>
+    /// Returns if there are free blocks to allocate.
+    /// </summary>
+    /// <returns>
+    /// True if there are free blocks to allocate. Otherwise returns false.
+    /// </returns>
+    inline bool CanAllocate() const
+    {
+        return m_uAllocatedBytes + m_uBlockSize <= m_uPoolSize;
+    }
+
+    /// <summary>
+    /// Returns the bytes sum of current allocated blocks.
+    /// </summary>
+    /// <returns>
+    /// The bytes sum of current allocated blocks.
+    /// </returns>
+    inline puint_z GetAllocatedBytes() const
+    {
+        return m_uAllocatedBytes;
+    }
+
+    /// <summary>
+    /// Returns a pointer to the first block of the buffer.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first block.
+    /// </returns>
+    inline void* GetPointer() const
+    {
+        return m_pBuffer;
+    }
+
+    /// <summary>
+    /// Returns the memory alignment.
+    /// </summary>
+    /// <returns>
+    /// The memory alignment.
+    /// </returns>
+    inline Alignment GetAlignment() const
+    {
+        return m_uAlignment;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The buffer where blocks are allocated.
+    /// </summary>
+    void* m_pBuffer;
+
+    /// <summary>
+    /// The size of the buffer, in bytes.
+    /// </summary>
+    puint_z m_uPoolSize;
+
+    /// <summary>
+    /// The bytes sum of current allocated blocks.
+    /// </summary>
+    puint_z m_uAllocatedBytes;
+
+    /// <summary>
+    /// The size of every block, in bytes.
+    /// </summary>
+    puint_z m_uBlockSize;
+
+    /// <summary>
+    /// The alignment of the buffer.
+    /// </summary>
+    Alignment m_uAlignment;
+};
+
+} // namespace z
+
+
+#endif // __CONTIGUOUSALLOCATOR__
@@ -0,0 +1,360 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __INLINEALLOCATOR__
+#define __INLINEALLOCATOR__
+
+#include <cstring>
+#include <boost/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/Alignment.h"
+#include "ZCommon/AllocationOperators.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents an allocator of fixed-size blocks, intended to be used by arrays, that stores up to a fixed number of blocks inside the instance 
+/// and only uses the heap when more blocks are needed.
+/// </summary>
+/// <remarks>
+/// It can replace PoolAllocator as the allocator of ArrayFixed and ArrayDynamic when most of the arrays store very few elements; such arrays 
+/// do not allocate any memory in the heap until their capacity is exceeded.<br/>
+/// It does not keep a list of free blocks: allocated blocks always occupy the beginning of the buffer and every deallocation releases the last one, 
+/// which is how arrays use it since their elements are always contiguous.<br/>
+/// Since the buffer may be part of the instance, the address of the blocks changes when the allocator is swapped. The allocator does not store 
+/// pointers to itself, so it can be moved bitwise, like arrays do with their elements.
+/// </remarks>
+/// <typeparam name="T">The type of the elements stored in the blocks. It is used to align the internal buffer.</typeparam>
+/// <typeparam name="INLINE_COUNT">The number of elements that fit in the internal buffer. It must be greater than zero.</typeparam>
+template<class T, puint_z INLINE_COUNT>
+class InlineAllocator
+{
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The size, in bytes, of the internal buffer.
+    /// </summary>
+    static const puint_z INLINE_SIZE = sizeof(T) * INLINE_COUNT;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructs an allocator passing the size of the buffer, the block size and the memory alignment.
+    /// </summary>
+    /// <remarks>
+    /// If the requested size fits in the internal buffer and the alignment is not greater than the alignment of T, no memory is allocated in the heap; 
+    /// in that case, the size of the buffer will be the size of the internal buffer, which may be greater than requested.
+    /// </remarks>
+    /// <param name="uSize">[IN] Size of the buffer, in bytes. It must be greater than zero.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    InlineAllocator(const puint_z uSize, const puint_z uBlockSize, const Alignment &alignment) : m_pHeapBuffer(null_z),
+                                                                                                  m_uPoolSize((INLINE_SIZE / uBlockSize) * uBlockSize),
+                                                                                                  m_uAllocatedBytes(0),
+                                                                                                  m_uBlockSize(uBlockSize),
+                                                                                                  m_uAlignment(alignment)
+    {
+        Z_ASSERT_ERROR( 0 != uSize, "Size cannot be zero" );
+        Z_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
+
+        if(uSize > m_uPoolSize || alignment > boost::alignment_of<T>::value)
+        {
+            m_pHeapBuffer = ::operator new(uSize, m_uAlignment);
+            m_uPoolSize = uSize;
+        }
+    }
+
+private:
+
+    // Hidden
+    InlineAllocator(const InlineAllocator&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It frees the buffer allocated in the heap, if any.
+    /// </summary>
+    ~InlineAllocator()
+    {
+        if(m_pHeapBuffer != null_z)
+            ::operator delete(m_pHeapBuffer, m_uAlignment);
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    InlineAllocator& operator=(const InlineAllocator&);
+
+public:
+
+    /// <summary>
+    /// Allocates a block after the last allocated block and returns its address.
+    /// </summary>
+    /// <returns>
+    /// Pointer to the allocated memory block. Returns null if the buffer is full.
+    /// </returns>
+    void* Allocate()
+    {
+        if(m_uAllocatedBytes + m_uBlockSize > m_uPoolSize)
+            return null_z;
+
+        void* pBlock = scast_z(this->GetPointer(), u8_z*) + m_uAllocatedBytes;
+        m_uAllocatedBytes += m_uBlockSize;
+
+        return pBlock;
+    }
+
+    /// <summary>
+    /// Deallocates the last allocated block.
+    /// </summary>
+    /// <param name="pBlock">[IN] The address of an allocated block. It must not be null.</param>
+    void Deallocate(const void* pBlock)
+    {
+        Z_ASSERT_ERROR( null_z != pBlock, "Pointer to block to deallocate cannot be null" );
+        Z_ASSERT_ERROR( rcast_z(pBlock, puint_z) >= rcast_z(this->GetPointer(), puint_z) && 
+                        rcast_z(pBlock, puint_z) < rcast_z(this->GetPointer(), puint_z) + m_uPoolSize, "Pointer to block to deallocate must be an address provided by this allocator" );
+        Z_ASSERT_ERROR( m_uAllocatedBytes > 0, "There are no allocated blocks" );
+
+        m_uAllocatedBytes -= m_uBlockSize;
+    }
+
+    /// <summary>
+    /// Deallocates all the blocks.
+    /// </summary>
+    void Clear()
+    {
+        m_uAllocatedBytes = 0;
+    }
+
+    /// <summary>
+    /// Copies the allocated blocks to another allocator, which will have the same number of allocated blocks.
+    /// </summary>
+    /// <remarks>
+    /// The blocks are copied bitwise.
+    /// </remarks>
+    /// <param name="allocator">[IN/OUT] The destination allocator. Its buffer must be, at least, as big as the resident allocator's and its block size must be the same.</param>
+    void CopyTo(InlineAllocator &allocator) const
+    {
+        Z_ASSERT_ERROR(m_uAllocatedBytes <= allocator.m_uPoolSize, "The size of the buffer of the destination allocator must be greater than or equal to the allocated bytes of the source allocator" );
+        Z_ASSERT_ERROR(m_uBlockSize == allocator.m_uBlockSize, "Block sizes of origin and destination allocators must be equal");
+
+        memcpy(allocator.GetPointer(), this->GetPointer(), m_uAllocatedBytes);
+        allocator.m_uAllocatedBytes = m_uAllocatedBytes;
+    }
+
+    /// <summary>
+    /// Increases the size of the buffer, moving it to the heap, and copies the allocated blocks to the new location.
+    /// </summary>
+    /// <remarks>
+    /// Pointers to the blocks become invalid.
+    /// </remarks>
+    /// <param name="uNewSize">[IN] The new size of the buffer, in bytes. It must be greater than the current size.</param>
+    void Reallocate(const puint_z uNewSize)
+    {
+        Z_ASSERT_WARNING(uNewSize > m_uPoolSize, "The new size must be greater than the current size of the buffer.");
+
+        if(uNewSize > m_uPoolSize)
+        {
+            void* pNewBuffer = ::operator new(uNewSize, m_uAlignment);
+            memcpy(pNewBuffer, this->GetPointer(), m_uAllocatedBytes);
+
+            if(m_pHeapBuffer != null_z)
+                ::operator delete(m_pHeapBuffer, m_uAlignment);
+
+            m_pHeapBuffer = pNewBuffer;
+            m_uPoolSize = uNewSize;
+        }
+    }
+
+    /// <summary>
+    /// Exchanges the buffers and the allocated blocks of two allocators.
+    /// </summary>
+    /// <remarks>
+    /// The content of the internal buffers is copied bitwise; blocks stored in the heap are not copied.
+    /// </remarks>
+    /// <param name="allocator">[IN/OUT] The other allocator. It can be the resident allocator.</param>
+    void Swap(InlineAllocator &allocator)
+    {
+        if(this == &allocator)
+            return;
+
+        if(m_pHeapBuffer == null_z || allocator.m_pHeapBuffer == null_z)
+        {
+            u8_z arBytes[INLINE_SIZE];
+            memcpy(arBytes,                            m_inlineBuffer.address(),           INLINE_SIZE);
+            memcpy(m_inlineBuffer.address(),           allocator.m_inlineBuffer.address(), INLINE_SIZE);
+            memcpy(allocator.m_inlineBuffer.address(), arBytes,                            INLINE_SIZE);
+        }
+
+        void* pHeapBuffer = m_pHeapBuffer;
+        m_pHeapBuffer = allocator.m_pHeapBuffer;
+        allocator.m_pHeapBuffer = pHeapBuffer;
+
+        const puint_z uPoolSize = m_uPoolSize;
+        m_uPoolSize = allocator.m_uPoolSize;
+        allocator.m_uPoolSize = uPoolSize;
+
+        const puint_z uAllocatedBytes = m_uAllocatedBytes;
+        m_uAllocatedBytes = allocator.m_uAllocatedBytes;
+        allocator.m_uAllocatedBytes = uAllocatedBytes;
+
+        const puint_z uBlockSize = m_uBlockSize;
+        m_uBlockSize = allocator.m_uBlockSize;
+        allocator.m_uBlockSize = uBlockSize;
+
+        const Alignment alignment = m_uAlignment;
+        m_uAlignment = allocator.m_uAlignment;
+        allocator.m_uAlignment = alignment;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Returns the size of the buffer in which blocks are allocated.
+    /// </summary>
+    /// <returns>
+    /// The size of the buffer, in bytes.
+    /// </returns>
+    puint_z GetPoolSize() const
+    {
+        return m_uPoolSize;
+    }
+
+    /// <summary>
+    /// Returns if there are free blocks to allocate.
+    /// </summary>
+    /// <returns>
+    /// True if there are free blocks to allocate. Otherwise returns false.
+    /// </returns>
+    bool CanAllocate() const
+    {
+        return m_uAllocatedBytes + m_uBlockSize <= m_uPoolSize;
+    }
+
+    /// <summary>
+    /// Returns the bytes sum of current allocated blocks.
+    /// </summary>
+    /// <returns>
+    /// The bytes sum of current allocated blocks.
+    /// </returns>
+    puint_z GetAllocatedBytes() const
+    {
+        return m_uAllocatedBytes;
+    }
+
+    /// <summary>
+    /// Returns a pointer to the first block of the buffer, either the internal buffer or the buffer allocated in the heap.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first block.
+    /// </returns>
+    void* GetPointer() const
+    {
+        return m_pHeapBuffer == null_z ? ccast_z(m_inlineBuffer.address(), void*) : m_pHeapBuffer;
+    }
+
+    /// <summary>
+    /// Returns the memory alignment.
+    /// </summary>
+    /// <returns>
+    /// The memory alignment.
+    /// </returns>
+    Alignment GetAlignment() const
+    {
+        return m_uAlignment;
+    }
+
+    /// <summary>
+    /// Indicates whether the blocks are stored in the internal buffer or in the heap.
+    /// </summary>
+    /// <returns>
+    /// True if the blocks are stored in the internal buffer; False if they are stored in the heap.
+    /// </returns>
+    bool IsInline() const
+    {
+        return m_pHeapBuffer == null_z;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The buffer stored in the instance, where blocks are allocated until more space is needed.
+    /// </summary>
+    boost::aligned_storage<INLINE_SIZE, boost::alignment_of<T>::value> m_inlineBuffer;
+
+    /// <summary>
+    /// The buffer allocated in the heap, where blocks are allocated when they do not fit in the internal buffer. It is null while the internal buffer is used.
+    /// </summary>
+    void* m_pHeapBuffer;
+
+    /// <summary>
+    /// The size of the buffer in use, in bytes.
+    /// </summary>
+    puint_z m_uPoolSize;
+
+    /// <summary>
+    /// The bytes sum of current allocated blocks.
+    /// </summary>
+    puint_z m_uAllocatedBytes;
+
+    /// <summary>
+    /// The size of every block, in bytes.
+    /// </summary>
+    puint_z m_uBlockSize;
+
+    /// <summary>
+    /// The alignment of the blocks.
+    /// </summary>
+    Alignment m_uAlignment;
+};
+
+} // namespace z
+
+
+#endif // __INLINEALLOCATOR__
@@ -31,6 +31,8 @@
 #include "ZCommon/DataTypes/DataTypesDefinitions.h"
 #include "ZCommon/Alignment.h"
 #include "ZMemory/MemoryModuleDefinitions.h"
+#include "ZMemory/EMemoryPlacement.h"
+#include "ZMemory/StackAllocator.h"
 
 
 
@@ -43,6 +45,15 @@ namespace z
 /// </summary>
 class Z_MEMORY_MODULE_SYMBOLS LinearAllocator
 {
+    // TYPEDEFS
+    // ---------------
+public:
+
+    /// <summary>
+    /// A position in the buffer, obtained with GetMark, to which the allocator can be rewound.
+    /// </summary>
+    typedef StackAllocator::Mark Mark;
+
 
     // CONSTRUCTORS
     // ---------------
@@ -77,6 +88,19 @@ public:
     /// <param name="alignment">[IN] The alingment of the memory block.</param>
     LinearAllocator(const puint_z uSize, void* pBuffer, const Alignment &alignment);
 
+    /// <summary>
+    /// Creates a linear allocator by specifying the size of its internal buffer, its alignment and where its memory is to be placed.
+    /// </summary>
+    /// <remarks>
+    /// When the memory is placed in the NUMA node of the calling thread, the buffer is allocated with SNumaMemory, which reserves whole memory pages, so 
+    /// it is only worth for big buffers used by threads bound to the processors of the same node. Reallocations keep the same placement, using the NUMA 
+    /// node of the thread that reallocates.
+    /// </remarks>
+    /// <param name="uSize">[IN] The size, in bytes, of the buffer. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] The alignment of the memory block to be reserved.</param>
+    /// <param name="eMemoryPlacement">[IN] Where the memory of the buffer is to be placed.</param>
+    LinearAllocator(const puint_z uSize, const Alignment &alignment, const EMemoryPlacement &eMemoryPlacement);
+
 private:
 
     // Hidden
@@ -122,6 +146,15 @@ public:
     /// </returns>
     void* Allocate(const puint_z uSize, const Alignment &alignment);
 
+    /// <summary>
+    /// Deallocates all the memory blocks that were allocated after a mark was obtained, rewinding the allocator to that position.
+    /// </summary>
+    /// <remarks>
+    /// Marks are invalidated by Clear, by deallocating to a prior mark and by reallocations.
+    /// </remarks>
+    /// <param name="mark">[IN] A mark obtained from this allocator. It must point between the beginning of the buffer and the current position.</param>
+    void Deallocate(const Mark &mark);
+
     /// <summary>
     /// Empties the internal buffer, deallocating everything.
     /// </summary>
@@ -187,6 +220,21 @@ private:
     // Hidden
     LinearAllocator& operator=(const LinearAllocator&);
 
+    /// <summary>
+    /// Allocates an internal buffer, taking into account the memory placement of the allocator.
+    /// </summary>
+    /// <param name="uSize">[IN] The size, in bytes, of the buffer.</param>
+    /// <returns>
+    /// The address of the buffer, aligned as the allocator.
+    /// </returns>
+    void* _AllocateBuffer(const puint_z uSize) const;
+
+    /// <summary>
+    /// Frees an internal buffer allocated with _AllocateBuffer.
+    /// </summary>
+    /// <param name="pBuffer">[IN] The address of the buffer.</param>
+    void _FreeBuffer(void* pBuffer) const;
+
 
     // PROPERTIES
     // ---------------
@@ -221,6 +269,14 @@ public:
     /// </returns>
     void* GetPointer() const;
 
+    /// <summary>
+    /// Gets a mark that points to the current position in the buffer, so every memory block allocated afterwards can be deallocated at once.
+    /// </summary>
+    /// <returns>
+    /// The mark of the current position.
+    /// </returns>
+    Mark GetMark() const;
+
 
     // ATTRIBUTES
     // ---------------
@@ -251,6 +307,11 @@ protected:
     /// </summary>
     const puint_z m_uAlignment;
 
+    /// <summary>
+    /// Where the internal buffer is placed. It is not used when the allocator uses an external buffer.
+    /// </summary>
+    const EMemoryPlacement m_eMemoryPlacement;
+
 };
 
 } // namespace z
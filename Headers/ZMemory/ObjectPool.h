@@ -0,0 +1,249 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __OBJECTPOOL__
+#define __OBJECTPOOL__
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/Alignment.h"
+#include "ZCommon/AllocationOperators.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZMemory/PoolAllocator.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a pool of objects of the same type which can be borrowed and returned without allocating memory in the heap.
+/// </summary>
+/// <remarks>
+/// Objects are constructed when they are borrowed and destroyed when they are returned. Their memory is allocated in a preallocated buffer 
+/// (see PoolAllocator); when all the blocks of the buffer are in use, objects are allocated in the heap instead, so borrowing never fails.<br/>
+/// This class is not thread-safe, every thread is expected to use its own instance (see ThreadLocalObjectPool).
+/// </remarks>
+/// <typeparam name="T">The type of the objects.</typeparam>
+template<class T>
+class ObjectPool
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the number of objects that fit in the pool.
+    /// </summary>
+    /// <param name="uCapacity">[IN] The maximum number of objects that can be borrowed at the same time without allocating memory in the heap. 
+    /// It must be greater than zero.</param>
+    explicit ObjectPool(const puint_z uCapacity) : m_allocator(uCapacity * sizeof(T), sizeof(T), Alignment(alignof_z(T))),
+                                                   m_uOverflowCount(0)
+    {
+    }
+
+private:
+
+    // Hidden
+    ObjectPool(const ObjectPool&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. All the borrowed objects must have been returned before.
+    /// </summary>
+    ~ObjectPool()
+    {
+        Z_ASSERT_WARNING(m_allocator.GetAllocatedBytes() == 0, "Some objects were not returned to the pool.");
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    ObjectPool& operator=(const ObjectPool&);
+
+public:
+
+    /// <summary>
+    /// Borrows an object constructed with its default constructor.
+    /// </summary>
+    /// <returns>
+    /// The borrowed object. It is never null.
+    /// </returns>
+    T* Borrow()
+    {
+        return new(this->_Allocate()) T();
+    }
+
+    /// <summary>
+    /// Borrows an object constructed with a constructor that receives one parameter.
+    /// </summary>
+    /// <typeparam name="P1">The type of the parameter of the constructor.</typeparam>
+    /// <param name="p1">[IN] The parameter passed to the constructor.</param>
+    /// <returns>
+    /// The borrowed object. It is never null.
+    /// </returns>
+    template<class P1>
+    T* Borrow(const P1 &p1)
+    {
+        return new(this->_Allocate()) T(p1);
+    }
+
+    /// <summary>
+    /// Borrows an object constructed with a constructor that receives two parameters.
+    /// </summary>
+    /// <typeparam name="P1">The type of the first parameter of the constructor.</typeparam>
+    /// <typeparam name="P2">The type of the second parameter of the constructor.</typeparam>
+    /// <param name="p1">[IN] The first parameter passed to the constructor.</param>
+    /// <param name="p2">[IN] The second parameter passed to the constructor.</param>
+    /// <returns>
+    /// The borrowed object. It is never null.
+    /// </returns>
+    template<class P1, class P2>
+    T* Borrow(const P1 &p1, const P2 &p2)
+    {
+        return new(this->_Allocate()) T(p1, p2);
+    }
+
+    /// <summary>
+    /// Returns a borrowed object to the pool, destroying it.
+    /// </summary>
+    /// <param name="pObject">[IN] An object borrowed from this pool. It must not be null.</param>
+    void Return(T* pObject)
+    {
+        Z_ASSERT_ERROR(pObject != null_z, "The object to return cannot be null.");
+
+        pObject->~T();
+
+        if(this->_Contains(pObject))
+            m_allocator.Deallocate(pObject);
+        else
+            ::operator delete(pObject, Alignment(alignof_z(T)));
+    }
+
+private:
+
+    /// <summary>
+    /// Allocates the memory for an object, in the buffer if there are free blocks or in the heap otherwise.
+    /// </summary>
+    /// <returns>
+    /// The address of the allocated memory.
+    /// </returns>
+    void* _Allocate()
+    {
+        void* pMemory = m_allocator.Allocate();
+
+        if(pMemory == null_z)
+        {
+            pMemory = ::operator new(sizeof(T), Alignment(alignof_z(T)));
+            ++m_uOverflowCount;
+        }
+
+        return pMemory;
+    }
+
+    /// <summary>
+    /// Checks whether an object was allocated in the buffer of the pool.
+    /// </summary>
+    /// <param name="pObject">[IN] The object to check.</param>
+    /// <returns>
+    /// True if the object is in the buffer; False if it was allocated in the heap.
+    /// </returns>
+    bool _Contains(const T* pObject) const
+    {
+        const puint_z FIRST_ADDRESS = rcast_z(m_allocator.GetPointer(), puint_z);
+        const puint_z OBJECT_ADDRESS = rcast_z(pObject, puint_z);
+
+        return OBJECT_ADDRESS >= FIRST_ADDRESS && OBJECT_ADDRESS < FIRST_ADDRESS + m_allocator.GetPoolSize();
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the maximum number of objects that can be borrowed at the same time without allocating memory in the heap.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the pool.
+    /// </returns>
+    puint_z GetCapacity() const
+    {
+        return m_allocator.GetPoolSize() / sizeof(T);
+    }
+
+    /// <summary>
+    /// Gets the number of borrowed objects that are stored in the buffer of the pool.
+    /// </summary>
+    /// <returns>
+    /// The number of borrowed objects, not including those allocated in the heap.
+    /// </returns>
+    puint_z GetBorrowedCount() const
+    {
+        return m_allocator.GetAllocatedBytes() / sizeof(T);
+    }
+
+    /// <summary>
+    /// Gets the number of objects that did not fit in the buffer and were allocated in the heap, since the pool was created.
+    /// </summary>
+    /// <remarks>
+    /// It can be used to choose a better capacity for the pool.
+    /// </remarks>
+    /// <returns>
+    /// The number of objects allocated in the heap.
+    /// </returns>
+    puint_z GetOverflowCount() const
+    {
+        return m_uOverflowCount;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The allocator of the buffer where objects are stored.
+    /// </summary>
+    PoolAllocator m_allocator;
+
+    /// <summary>
+    /// The number of objects allocated in the heap since the pool was created.
+    /// </summary>
+    puint_z m_uOverflowCount;
+
+};
+
+} // namespace z
+
+
+#endif // __OBJECTPOOL__
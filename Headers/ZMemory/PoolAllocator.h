@@ -31,6 +31,7 @@
 #include "ZCommon/CommonModuleDefinitions.h"
 #include "ZCommon/Alignment.h"
 #include "ZMemory/MemoryModuleDefinitions.h"
+#include "ZMemory/EMemoryPlacement.h"
 
 
 namespace z
@@ -87,6 +88,22 @@ public:
     /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
     PoolAllocator(const puint_z uSize, const puint_z uBlockSize, const void *pBuffer, const Alignment &alignment); 
 
+    /// <summary>
+    /// Constructs a pool allocator passing the pool size, block size, memory alignment and where the memory of the pool is to be placed.
+    /// </summary>
+    /// <remarks>
+    /// Pre-allocates uSize bytes plus a maximum of (uSize/uBlockSize)*sizeof(void**) bytes for internals.<br/>
+    /// When the memory is placed in the NUMA node of the calling thread, the blocks are allocated with SNumaMemory, which reserves whole memory pages, so 
+    /// it is only worth for big pools used by threads bound to the processors of the same node. Internals are always allocated with the default operators. 
+    /// Reallocations keep the same placement, using the NUMA node of the thread that reallocates.<br/>
+    /// Invalid values of the parameters may cause an unexpected behaviour.
+    /// </remarks>
+    /// <param name="uSize">[IN] Size of the pool, in bytes. It must be greater than zero.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    /// <param name="eMemoryPlacement">[IN] Where the memory of the blocks is to be placed.</param>
+    PoolAllocator(const puint_z uSize, const puint_z uBlockSize, const Alignment &alignment, const EMemoryPlacement &eMemoryPlacement); 
+
 private:
 
     // Disabled.
@@ -158,6 +175,15 @@ public:
     /// <param name="pNewLocation">[IN] The new memory address where the new block will be reserved. It must not be null, or no reallocation will be done.</param>
     void Reallocate(const puint_z uNewSize, const void* pNewLocation);
 
+    /// <summary>
+    /// Exchanges the memory chunks, the allocated blocks and the configuration of two pool allocators.
+    /// </summary>
+    /// <remarks>
+    /// No block is copied, and pointers to allocated blocks remain valid, although they will belong to the other allocator.
+    /// </remarks>
+    /// <param name="poolAllocator">[IN/OUT] The allocator whose state will be exchanged with the resident allocator's.</param>
+    void Swap(PoolAllocator &poolAllocator);
+
 
 private:
 
@@ -182,6 +208,21 @@ private:
     /// <param name="pNewLocation">[IN] The new memory address where the new block will be reserved. It must not be null, or no reallocation will be done.</param>
     void InternalReallocate(const puint_z uNewSize, void* pNewLocation);
 
+    /// <summary>
+    /// Allocates the chunk for the blocks of the pool, taking into account the memory placement of the pool.
+    /// </summary>    
+    /// <param name="uSize">[IN] The size of the chunk, in bytes.</param>
+    /// <returns>
+    /// The address of the chunk, aligned as the blocks of the pool.
+    /// </returns>
+    void* AllocateMemoryChunk(const puint_z uSize) const;
+
+    /// <summary>
+    /// Frees a chunk allocated with AllocateMemoryChunk.
+    /// </summary>    
+    /// <param name="pMemoryChunk">[IN] The address of the chunk.</param>
+    void FreeMemoryChunk(void* pMemoryChunk) const;
+
 
     // PROPERTIES
     // ---------------
@@ -321,6 +362,11 @@ private:
     /// Otherwise True and memory buffer needs to be destroyed.
     /// </summary>    
     bool m_bNeedDestroyMemoryChunk;
+
+    /// <summary>
+    /// Where the chunk allocated by the pool is placed. It is not used when a buffer is passed to the constructor.
+    /// </summary>    
+    EMemoryPlacement m_eMemoryPlacement;
 };
 
 } // namespace z
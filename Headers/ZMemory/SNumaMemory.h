@@ -0,0 +1,131 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __SNUMAMEMORY__
+#define __SNUMAMEMORY__
+
+#include "ZMemory/MemoryModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Alignment.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Provides memory whose physical pages are placed, preferably, in a given NUMA node, so the threads running on the processors of that node access it faster.
+/// </summary>
+/// <remarks>
+/// The node is only a hint: if the node has not enough free memory or the operating system does not support NUMA placement, the memory is placed anywhere.<br/>
+/// On Linux, memory is mapped with mmap and bound to the node through the mbind system call (libnuma is not required). On Windows, VirtualAllocExNuma is used. 
+/// On Mac, there is no NUMA support and the memory is allocated with malloc.<br/>
+/// Every allocation occupies, at least, one memory page, so this class is intended for big buffers that live long, like those of the allocators.
+/// </remarks>
+class Z_MEMORY_MODULE_SYMBOLS SNumaMemory
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SNumaMemory();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Allocates a buffer whose memory is placed, preferably, in a given NUMA node.
+    /// </summary>
+    /// <param name="uSize">[IN] The size of the buffer, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] The alignment of the address of the buffer.</param>
+    /// <param name="uNode">[IN] The index of the NUMA node. If it is greater than or equal to the number of nodes, the memory is placed anywhere.</param>
+    /// <returns>
+    /// The address of the allocated buffer. It must be freed by calling Deallocate. Null if there is not enough memory.
+    /// </returns>
+    static void* Allocate(const puint_z uSize, const Alignment &alignment, const u32_z uNode);
+
+    /// <summary>
+    /// Allocates a buffer whose memory is placed, preferably, in the NUMA node of the processor that executes the calling thread.
+    /// </summary>
+    /// <remarks>
+    /// The calling thread should be bound to the processors of its node (see Thread::SetAffinity); otherwise, the operating system may move it to another node afterwards.
+    /// </remarks>
+    /// <param name="uSize">[IN] The size of the buffer, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] The alignment of the address of the buffer.</param>
+    /// <returns>
+    /// The address of the allocated buffer. It must be freed by calling Deallocate. Null if there is not enough memory.
+    /// </returns>
+    static void* AllocateLocal(const puint_z uSize, const Alignment &alignment);
+
+    /// <summary>
+    /// Frees a buffer allocated by any of the allocation methods of this class.
+    /// </summary>
+    /// <param name="pBuffer">[IN] The address of the buffer. If it is null, nothing happens.</param>
+    static void Deallocate(void* pBuffer);
+
+private:
+
+#if defined(Z_OS_LINUX)
+
+    /// <summary>
+    /// Reads the number of NUMA nodes from sysfs.
+    /// </summary>
+    /// <returns>
+    /// The number of nodes. It is 1 when the information is not available.
+    /// </returns>
+    static u32_z _ReadNodeCount();
+
+#endif
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of NUMA nodes in the machine.
+    /// </summary>
+    /// <returns>
+    /// The number of nodes. It is 1 when the machine is not a NUMA system or NUMA is not supported by the operating system.
+    /// </returns>
+    static u32_z GetNodeCount();
+
+    /// <summary>
+    /// Gets the NUMA node of the processor that executes the calling thread.
+    /// </summary>
+    /// <returns>
+    /// The index of the node. It is zero when it cannot be known.
+    /// </returns>
+    static u32_z GetCurrentNode();
+};
+
+} // namespace z
+
+
+#endif // __SNUMAMEMORY__
@@ -0,0 +1,101 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __SCOPEDSCRATCHMARK__
+#define __SCOPEDSCRATCHMARK__
+
+#include "ZMemory/MemoryModuleDefinitions.h"
+#include "ZMemory/ScratchAllocator.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Obtains a mark from a scratch allocator when it is created and rewinds the allocator to that mark when it is destroyed, so all the memory 
+/// blocks allocated during its lifetime are deallocated at the end of the scope.
+/// </summary>
+/// <remarks>
+/// Instances of this class are expected to be created in the stack and destroyed in the reverse order they were created.<br/>
+/// This class is not thread-safe.
+/// </remarks>
+class Z_MEMORY_MODULE_SYMBOLS ScopedScratchMark
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that obtains a mark of the current position of a scratch allocator.
+    /// </summary>
+    /// <param name="allocator">[IN] The scratch allocator to be rewound when the instance is destroyed.</param>
+    explicit ScopedScratchMark(ScratchAllocator &allocator);
+
+private:
+
+    // Hidden
+    ScopedScratchMark(const ScopedScratchMark&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor that rewinds the scratch allocator to the mark obtained when the instance was created.
+    /// </summary>
+    ~ScopedScratchMark();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    ScopedScratchMark& operator=(const ScopedScratchMark&);
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The scratch allocator to be rewound.
+    /// </summary>
+    ScratchAllocator &m_allocator;
+
+    /// <summary>
+    /// The mark obtained when the instance was created.
+    /// </summary>
+    const ScratchAllocator::Mark m_mark;
+
+};
+
+} // namespace z
+
+
+#endif // __SCOPEDSCRATCHMARK__
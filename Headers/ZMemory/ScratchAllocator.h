@@ -0,0 +1,266 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __SCRATCHALLOCATOR__
+#define __SCRATCHALLOCATOR__
+
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Alignment.h"
+#include "ZMemory/MemoryModuleDefinitions.h"
+#include "ZMemory/LinearAllocator.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents an allocator for short-lived temporary memory blocks that are all deallocated at once, by rewinding the allocator to a mark 
+/// obtained before allocating them.
+/// </summary>
+/// <remarks>
+/// Memory blocks are allocated in a preallocated buffer (see LinearAllocator). When a block does not fit in the free space of the buffer, it is 
+/// allocated in the heap instead and freed when the allocator is rewound to a prior mark, so allocations never fail.<br/>
+/// This class is not thread-safe, every thread is expected to use its own instance (see SThisThread::GetScratchAllocator).<br/>
+/// Use ScopedScratchMark to rewind the allocator automatically at the end of a scope.
+/// </remarks>
+class Z_MEMORY_MODULE_SYMBOLS ScratchAllocator
+{
+    // INTERNAL CLASSES
+    // ---------------
+public:
+
+    /// <summary>
+    /// A position of the allocator, obtained with GetMark, to which it can be rewound.
+    /// </summary>
+    class Z_MEMORY_MODULE_SYMBOLS Mark
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the position of the buffer and the last memory block allocated in the heap.
+        /// </summary>
+        /// <param name="bufferMark">[IN] The position of the buffer.</param>
+        /// <param name="pLastOverflowBlock">[IN] The last memory block allocated in the heap. It may be null.</param>
+        Mark(const LinearAllocator::Mark &bufferMark, void* pLastOverflowBlock);
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the position of the buffer.
+        /// </summary>
+        /// <returns>
+        /// The position of the buffer.
+        /// </returns>
+        LinearAllocator::Mark GetBufferMark() const;
+
+        /// <summary>
+        /// Gets the last memory block allocated in the heap when the mark was obtained.
+        /// </summary>
+        /// <returns>
+        /// The last memory block allocated in the heap. It may be null.
+        /// </returns>
+        void* GetLastOverflowBlock() const;
+
+
+        // ATTRIBUTES
+        // ---------------
+    protected:
+
+        /// <summary>
+        /// The position of the buffer.
+        /// </summary>
+        LinearAllocator::Mark m_bufferMark;
+
+        /// <summary>
+        /// The last memory block allocated in the heap.
+        /// </summary>
+        void* m_pLastOverflowBlock;
+
+    }; // --- Mark ---
+
+
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The default size, in bytes, of the buffer.
+    /// </summary>
+    static const puint_z DEFAULT_SIZE;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Creates a scratch allocator by specifying the size of its buffer.
+    /// </summary>
+    /// <param name="uSize">[IN] The size, in bytes, of the buffer. It must be greater than zero.</param>
+    explicit ScratchAllocator(const puint_z uSize);
+
+private:
+
+    // Hidden
+    ScratchAllocator(const ScratchAllocator&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It frees the buffer and the memory blocks allocated in the heap.
+    /// </summary>
+    ~ScratchAllocator();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    ScratchAllocator& operator=(const ScratchAllocator&);
+
+public:
+
+    /// <summary>
+    /// Allocates a memory block and returns its address.
+    /// </summary>
+    /// <remarks>
+    /// Memory blocks are aligned to the size of a pointer.
+    /// </remarks>
+    /// <param name="uSize">[IN] The size, in bytes, of the memory block to be allocated. It must be greater than zero.</param>
+    /// <returns>
+    /// Pointer to the allocated memory block. It is never null.
+    /// </returns>
+    void* Allocate(const puint_z uSize);
+
+    /// <summary>
+    /// Allocates a memory block, whose memory address depends on the alignment, and returns its address.
+    /// </summary>
+    /// <param name="uSize">[IN] The size, in bytes, of the memory block to be allocated. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] The alignment of the memory block.</param>
+    /// <returns>
+    /// Pointer to the allocated memory block. It is never null.
+    /// </returns>
+    void* Allocate(const puint_z uSize, const Alignment &alignment);
+
+    /// <summary>
+    /// Deallocates all the memory blocks that were allocated after a mark was obtained, rewinding the allocator to that position.
+    /// </summary>
+    /// <remarks>
+    /// Marks obtained after the input mark are invalidated.
+    /// </remarks>
+    /// <param name="mark">[IN] A mark obtained from this allocator.</param>
+    void Deallocate(const Mark &mark);
+
+    /// <summary>
+    /// Deallocates all the memory blocks.
+    /// </summary>
+    void Clear();
+
+private:
+
+    /// <summary>
+    /// Frees the memory blocks allocated in the heap, from the last one to a given one, not included.
+    /// </summary>
+    /// <param name="pLastBlockToKeep">[IN] The newest memory block that is not to be freed. If it is null, all the blocks are freed.</param>
+    void _FreeOverflowBlocks(void* pLastBlockToKeep);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets a mark that points to the current position of the allocator, so every memory block allocated afterwards can be deallocated at once.
+    /// </summary>
+    /// <returns>
+    /// The mark of the current position.
+    /// </returns>
+    Mark GetMark() const;
+
+    /// <summary>
+    /// Gets the size of the buffer.
+    /// </summary>
+    /// <returns>
+    /// The size of the buffer, in bytes.
+    /// </returns>
+    puint_z GetSize() const;
+
+    /// <summary>
+    /// Gets the number of bytes of the buffer already allocated.
+    /// </summary>
+    /// <returns>
+    /// The number of bytes already allocated in the buffer, taking into account the alignment adjustments too. Memory blocks allocated in the heap are 
+    /// not included.
+    /// </returns>
+    puint_z GetAllocatedBytes() const;
+
+    /// <summary>
+    /// Gets the number of memory blocks that did not fit in the buffer and were allocated in the heap, since the allocator was created.
+    /// </summary>
+    /// <remarks>
+    /// It can be used to choose a better size for the buffer.
+    /// </remarks>
+    /// <returns>
+    /// The number of memory blocks allocated in the heap.
+    /// </returns>
+    puint_z GetOverflowCount() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The buffer where memory blocks are allocated.
+    /// </summary>
+    LinearAllocator m_buffer;
+
+    /// <summary>
+    /// The last memory block allocated in the heap, whose header points to the previous one and stores its alignment. It is null if there are none.
+    /// </summary>
+    void* m_pLastOverflowBlock;
+
+    /// <summary>
+    /// The number of memory blocks allocated in the heap since the allocator was created.
+    /// </summary>
+    puint_z m_uOverflowCount;
+
+};
+
+} // namespace z
+
+
+#endif // __SCRATCHALLOCATOR__
@@ -0,0 +1,163 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __ASYNCMUTEX__
+#define __ASYNCMUTEX__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZThreading/Mutex.h"
+
+
+namespace z
+{
+
+// Forward declarations
+class AsyncTask;
+
+
+/// <summary>
+/// Represents a mutex that tasks executed by an AsyncTaskExecutor can acquire without blocking the worker thread, through AsyncTask::AwaitLock.
+/// </summary>
+/// <remarks>
+/// This class is thread-safe.<br/>
+/// While the mutex is owned, the tasks that await it are kept in a list instead of blocking their threads; when the owner unlocks it, the ownership 
+/// is passed directly to the first waiting task, which is resumed. Tasks acquire the mutex in the order they started waiting.<br/>
+/// It is not owned by any thread, so a task may unlock it after being resumed by a different worker thread. It is not recursive.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS AsyncMutex
+{
+    friend class AsyncTaskExecutor; // It acquires the mutex for the tasks that await it
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    AsyncMutex();
+
+private:
+
+    // Hidden
+    AsyncMutex(const AsyncMutex&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. No task must be waiting for the mutex.
+    /// </summary>
+    ~AsyncMutex();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    AsyncMutex& operator=(const AsyncMutex&);
+
+public:
+
+    /// <summary>
+    /// Tries to acquire the mutex. It never blocks the calling thread.
+    /// </summary>
+    /// <returns>
+    /// True if the mutex was acquired; False if it is already owned.
+    /// </returns>
+    bool TryLock();
+
+    /// <summary>
+    /// Releases the mutex or, if there are tasks waiting for it, passes the ownership to the first of them and resumes it.
+    /// </summary>
+    /// <remarks>
+    /// The mutex must be owned.
+    /// </remarks>
+    void Unlock();
+
+private:
+
+    /// <summary>
+    /// Acquires the mutex for a task or, if it is already owned, adds the task to the end of the list of waiters.
+    /// </summary>
+    /// <param name="pTask">[IN] The task that awaits the mutex. It must not be null.</param>
+    /// <returns>
+    /// True if the mutex was acquired; False if the task has to wait.
+    /// </returns>
+    bool _LockOrWait(AsyncTask* pTask);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Indicates whether the mutex is owned.
+    /// </summary>
+    /// <remarks>
+    /// The value may change right after it is returned, so it is only meaningful when no other thread uses the mutex.
+    /// </remarks>
+    /// <returns>
+    /// True if the mutex is owned; False otherwise.
+    /// </returns>
+    bool IsLocked() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The mutex that protects the rest of attributes.
+    /// </summary>
+    mutable Mutex m_mutex;
+
+    /// <summary>
+    /// Indicates whether the mutex is owned.
+    /// </summary>
+    bool m_bIsLocked;
+
+    /// <summary>
+    /// The first task of the list of tasks waiting for the mutex, which is the next to acquire it.
+    /// </summary>
+    AsyncTask* m_pFirstWaiter;
+
+    /// <summary>
+    /// The last task of the list of tasks waiting for the mutex.
+    /// </summary>
+    AsyncTask* m_pLastWaiter;
+};
+
+} // namespace z
+
+
+#endif // __ASYNCMUTEX__
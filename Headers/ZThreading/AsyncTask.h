@@ -0,0 +1,275 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __ASYNCTASK__
+#define __ASYNCTASK__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZTime/TimeSpan.h"
+#include <boost/atomic.hpp>
+
+
+namespace z
+{
+
+// Forward declarations
+class AsyncTaskExecutor;
+class AsyncMutex;
+
+
+/// <summary>
+/// Represents a job that can suspend its execution, without blocking the thread that executes it, while it waits for some time to elapse, for a 
+/// mutex to be acquired or for another task to complete. Tasks are executed by an AsyncTaskExecutor.
+/// </summary>
+/// <remarks>
+/// Derived classes implement the Resume method, which is called by a worker thread of the executor every time the task can continue. The task 
+/// stores in its own attributes the point where it stopped, so the next call continues from there (it is a state machine, like the frame of a coroutine). 
+/// Before returning False, Resume may call one of the Await methods to indicate what the task waits for; if it does not call any, the task is executed 
+/// again after the tasks that are already waiting for their turn, which lets them run.<br/>
+/// A task that awaits another task starts it, and it is resumed when the awaited task completes. A completed task can be awaited or submitted again, 
+/// which executes it from the beginning.<br/>
+/// Blocking tasks are executed by the threads of the executor dedicated to operations that block the thread, like reading a file, so they do 
+/// not delay the rest of tasks.<br/>
+/// Tasks are not owned by the executor: they must exist until they complete.<br/>
+/// Only the methods Wait and IsCompleted can be called by several threads at the same time.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS AsyncTask
+{
+    friend class AsyncTaskExecutor; // It changes the state of the task and reads what it awaits
+    friend class AsyncMutex; // It links the tasks that wait for the mutex
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// State of a task that has never been submitted to an executor.
+    /// </summary>
+    static const u32_z STATE_NOT_STARTED = 0;
+
+    /// <summary>
+    /// State of a task that has been submitted to an executor and has not completed yet.
+    /// </summary>
+    static const u32_z STATE_RUNNING = 1U;
+
+    /// <summary>
+    /// State of a task that has not completed yet and for which a thread is waiting in the Wait method.
+    /// </summary>
+    static const u32_z STATE_RUNNING_WITH_WAITERS = 2U;
+
+    /// <summary>
+    /// State of a task that has completed.
+    /// </summary>
+    static const u32_z STATE_COMPLETED = 3U;
+
+    /// <summary>
+    /// The task does not await anything.
+    /// </summary>
+    static const u32_z AWAITING_NOTHING = 0;
+
+    /// <summary>
+    /// The task awaits an instant.
+    /// </summary>
+    static const u32_z AWAITING_TIME = 1U;
+
+    /// <summary>
+    /// The task awaits the acquisition of a mutex.
+    /// </summary>
+    static const u32_z AWAITING_LOCK = 2U;
+
+    /// <summary>
+    /// The task awaits the completion of another task.
+    /// </summary>
+    static const u32_z AWAITING_TASK = 3U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor that creates a task that does not block the thread that executes it.
+    /// </summary>
+    AsyncTask();
+
+    /// <summary>
+    /// Constructor that receives whether the task blocks the thread that executes it.
+    /// </summary>
+    /// <param name="bIsBlocking">[IN] Indicates whether the task performs operations that block the thread, like reading a file.</param>
+    explicit AsyncTask(const bool bIsBlocking);
+
+private:
+
+    // Hidden
+    AsyncTask(const AsyncTask&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. The task must not be running.
+    /// </summary>
+    virtual ~AsyncTask();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    AsyncTask& operator=(const AsyncTask&);
+
+public:
+
+    /// <summary>
+    /// Blocks the calling thread until the task completes.
+    /// </summary>
+    /// <remarks>
+    /// It must not be called from a task, since it would block the worker thread; tasks await other tasks instead. The task must have been submitted.
+    /// </remarks>
+    void Wait();
+
+protected:
+
+    /// <summary>
+    /// Executes the task from the point where it stopped until it completes or has to wait for something.
+    /// </summary>
+    /// <remarks>
+    /// It is called by only one thread at a time.
+    /// </remarks>
+    /// <returns>
+    /// True if the task has completed; False otherwise.
+    /// </returns>
+    virtual bool Resume() = 0;
+
+    /// <summary>
+    /// Makes the task wait for some time after Resume returns. The worker thread executes other tasks meanwhile.
+    /// </summary>
+    /// <remarks>
+    /// It can be called only once per call to Resume, which must return False afterwards.
+    /// </remarks>
+    /// <param name="duration">[IN] The time to wait.</param>
+    void AwaitSleep(const TimeSpan &duration);
+
+    /// <summary>
+    /// Makes the task wait, after Resume returns, until it acquires a mutex. The worker thread executes other tasks meanwhile.
+    /// </summary>
+    /// <remarks>
+    /// It can be called only once per call to Resume, which must return False afterwards. When the task is resumed, it owns the mutex.
+    /// </remarks>
+    /// <param name="mutex">[IN] The mutex to acquire.</param>
+    void AwaitLock(AsyncMutex &mutex);
+
+    /// <summary>
+    /// Starts another task after Resume returns and makes this task wait until the other task completes. The worker thread executes other tasks meanwhile.
+    /// </summary>
+    /// <remarks>
+    /// It can be called only once per call to Resume, which must return False afterwards.
+    /// </remarks>
+    /// <param name="task">[IN] The task to start. It must not be running and must not be this task.</param>
+    void AwaitTask(AsyncTask &task);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Indicates whether the task has completed.
+    /// </summary>
+    /// <returns>
+    /// True if the task has completed; False if it is running or it has never been submitted.
+    /// </returns>
+    bool IsCompleted() const;
+
+    /// <summary>
+    /// Indicates whether the task performs operations that block the thread that executes it.
+    /// </summary>
+    /// <returns>
+    /// True if the task is blocking; False otherwise.
+    /// </returns>
+    bool IsBlocking() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// Indicates whether the task performs operations that block the thread that executes it.
+    /// </summary>
+    bool m_bIsBlocking;
+
+    /// <summary>
+    /// The state of the task, on which the threads that call Wait sleep.
+    /// </summary>
+    boost::atomic<u32_z> m_uState;
+
+    /// <summary>
+    /// The executor that runs the task. Null if it has never been submitted.
+    /// </summary>
+    AsyncTaskExecutor* m_pExecutor;
+
+    /// <summary>
+    /// The task that awaits the completion of this task, if any.
+    /// </summary>
+    AsyncTask* m_pContinuation;
+
+    /// <summary>
+    /// The next task in the queue or the list of waiters where the task is, if any.
+    /// </summary>
+    AsyncTask* m_pNext;
+
+    /// <summary>
+    /// What the task awaits since the last call to Resume.
+    /// </summary>
+    u32_z m_uAwaiting;
+
+    /// <summary>
+    /// The instant when the task has to be resumed, in nanoseconds measured by SMonotonicClock, when it awaits an instant.
+    /// </summary>
+    u64_z m_uResumeInstant;
+
+    /// <summary>
+    /// The mutex the task awaits, if any.
+    /// </summary>
+    AsyncMutex* m_pAwaitedMutex;
+
+    /// <summary>
+    /// The task this task awaits, if any.
+    /// </summary>
+    AsyncTask* m_pAwaitedTask;
+};
+
+} // namespace z
+
+
+#endif // __ASYNCTASK__
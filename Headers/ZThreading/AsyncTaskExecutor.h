@@ -0,0 +1,320 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __ASYNCTASKEXECUTOR__
+#define __ASYNCTASKEXECUTOR__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZThreading/AsyncTask.h"
+#include "ZThreading/EventCount.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/MutexConditionVariable.h"
+#include <boost/atomic.hpp>
+
+
+namespace z
+{
+
+// Forward declarations
+class Thread;
+
+
+/// <summary>
+/// Represents a set of worker threads that execute asynchronous tasks (see AsyncTask), so a great number of jobs that spend most of their time waiting 
+/// can run concurrently on a few threads.
+/// </summary>
+/// <remarks>
+/// There are two groups of worker threads: the ones that execute the tasks that never block the thread and the ones that execute blocking tasks, 
+/// like file operations. Every group extracts the tasks from its own queue, in the order they were added. A task that awaits another task of its 
+/// same group is executed immediately by the same thread, without passing through the queue, and so is its continuation when it completes.<br/>
+/// An additional thread resumes the tasks that sleep when their time comes.<br/>
+/// The threads start when the executor is created and finish when it is destroyed. All the submitted tasks must have completed by then, otherwise 
+/// they are abandoned.<br/>
+/// This class is thread-safe.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS AsyncTaskExecutor
+{
+    friend class AsyncMutex; // It resumes the tasks that acquire the mutex
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// A list of tasks ready to be executed, from which a group of worker threads extracts them.
+    /// </summary>
+    class TaskQueue
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        TaskQueue() : m_pFirst(null_z),
+                      m_pLast(null_z)
+        {
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The mutex that protects the list.
+        /// </summary>
+        Mutex m_mutex;
+
+        /// <summary>
+        /// The first task of the list, which is the next to be extracted.
+        /// </summary>
+        AsyncTask* m_pFirst;
+
+        /// <summary>
+        /// The last task of the list.
+        /// </summary>
+        AsyncTask* m_pLast;
+
+        /// <summary>
+        /// The event count on which the worker threads wait while the list is empty.
+        /// </summary>
+        EventCount m_taskAdded;
+    };
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the number of worker threads and starts them.
+    /// </summary>
+    /// <param name="uWorkerCount">[IN] The number of threads that execute non-blocking tasks. It must be greater than zero.</param>
+    /// <param name="uBlockingWorkerCount">[IN] The number of threads that execute blocking tasks. It must be greater than zero.</param>
+    AsyncTaskExecutor(const u32_z uWorkerCount, const u32_z uBlockingWorkerCount);
+
+private:
+
+    // Hidden
+    AsyncTaskExecutor(const AsyncTaskExecutor&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It stops the worker threads and waits for them to finish the tasks they are executing.
+    /// </summary>
+    ~AsyncTaskExecutor();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    AsyncTaskExecutor& operator=(const AsyncTaskExecutor&);
+
+public:
+
+    /// <summary>
+    /// Starts the execution of a task.
+    /// </summary>
+    /// <remarks>
+    /// The task must exist until it completes. It can be waited for with AsyncTask::Wait.
+    /// </remarks>
+    /// <param name="task">[IN] The task to execute. It must not be running.</param>
+    void Submit(AsyncTask &task);
+
+private:
+
+    /// <summary>
+    /// The function executed by the worker threads, which extract tasks from a queue and execute them until the executor is destroyed.
+    /// </summary>
+    /// <param name="pExecutor">[IN] The executor.</param>
+    /// <param name="pQueue">[IN] The queue from which the tasks are extracted.</param>
+    static void _ExecuteWorker(AsyncTaskExecutor* pExecutor, TaskQueue* pQueue);
+
+    /// <summary>
+    /// The function executed by the thread that resumes the sleeping tasks when their time comes, until the executor is destroyed.
+    /// </summary>
+    /// <param name="pExecutor">[IN] The executor.</param>
+    static void _ExecuteTimer(AsyncTaskExecutor* pExecutor);
+
+    /// <summary>
+    /// Extracts tasks from a queue and executes them, waiting while the queue is empty, until the executor is destroyed.
+    /// </summary>
+    /// <param name="queue">[IN] The queue from which the tasks are extracted.</param>
+    void _ExtractAndExecuteTasks(TaskQueue &queue);
+
+    /// <summary>
+    /// Resumes the sleeping tasks when their time comes, until the executor is destroyed.
+    /// </summary>
+    void _ResumeSleepingTasks();
+
+    /// <summary>
+    /// Executes a task until it awaits something that is not available yet, and then does what it awaits; executes the awaited task or the continuation 
+    /// when they belong to the same group of worker threads.
+    /// </summary>
+    /// <param name="pTask">[IN] The task to be executed. It must not be null.</param>
+    /// <param name="bIsBlockingWorker">[IN] Indicates whether the calling thread executes blocking tasks.</param>
+    void _Execute(AsyncTask* pTask, const bool bIsBlockingWorker);
+
+    /// <summary>
+    /// Marks a task as completed and wakes up the threads that wait for it.
+    /// </summary>
+    /// <param name="pTask">[IN] The task. It must not be null.</param>
+    /// <returns>
+    /// The task that awaited the completed task, if any; null otherwise.
+    /// </returns>
+    AsyncTask* _Complete(AsyncTask* pTask);
+
+    /// <summary>
+    /// Adds a task to the end of the queue that corresponds to it.
+    /// </summary>
+    /// <param name="pTask">[IN] The task. It must not be null.</param>
+    void _Schedule(AsyncTask* pTask);
+
+    /// <summary>
+    /// Extracts the first task of a queue.
+    /// </summary>
+    /// <param name="queue">[IN] The queue.</param>
+    /// <returns>
+    /// The first task of the queue, or null if it is empty.
+    /// </returns>
+    static AsyncTask* _Dequeue(TaskQueue &queue);
+
+    /// <summary>
+    /// Adds a task to the set of sleeping tasks, a binary min-heap sorted by the instant when they have to be resumed.
+    /// </summary>
+    /// <param name="pTask">[IN] The task. It must not be null.</param>
+    void _AddSleepingTask(AsyncTask* pTask);
+
+    /// <summary>
+    /// Removes the task that has to be resumed first from the set of sleeping tasks.
+    /// </summary>
+    /// <remarks>
+    /// The mutex of the sleeping tasks must be locked and the set must not be empty.
+    /// </remarks>
+    /// <returns>
+    /// The removed task.
+    /// </returns>
+    AsyncTask* _RemoveFirstSleepingTask();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of threads that execute non-blocking tasks.
+    /// </summary>
+    /// <returns>
+    /// The number of threads.
+    /// </returns>
+    u32_z GetWorkerCount() const;
+
+    /// <summary>
+    /// Gets the number of threads that execute blocking tasks.
+    /// </summary>
+    /// <returns>
+    /// The number of threads.
+    /// </returns>
+    u32_z GetBlockingWorkerCount() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The number of threads that execute non-blocking tasks.
+    /// </summary>
+    u32_z m_uWorkerCount;
+
+    /// <summary>
+    /// The number of threads that execute blocking tasks.
+    /// </summary>
+    u32_z m_uBlockingWorkerCount;
+
+    /// <summary>
+    /// All the threads: first the ones that execute non-blocking tasks, then the ones that execute blocking tasks and finally the one that resumes 
+    /// sleeping tasks.
+    /// </summary>
+    Thread** m_arThreads;
+
+    /// <summary>
+    /// The non-blocking tasks ready to be executed.
+    /// </summary>
+    TaskQueue m_queue;
+
+    /// <summary>
+    /// The blocking tasks ready to be executed.
+    /// </summary>
+    TaskQueue m_blockingQueue;
+
+    /// <summary>
+    /// The mutex that protects the set of sleeping tasks.
+    /// </summary>
+    Mutex m_sleepingTasksMutex;
+
+    /// <summary>
+    /// The condition variable that notifies the thread that resumes the sleeping tasks that a task must be resumed earlier than expected, or 
+    /// that the executor is being destroyed.
+    /// </summary>
+    MutexConditionVariable m_sleepingTasksChanged;
+
+    /// <summary>
+    /// The sleeping tasks, forming a binary min-heap sorted by the instant when they have to be resumed.
+    /// </summary>
+    AsyncTask** m_arSleepingTasks;
+
+    /// <summary>
+    /// The number of sleeping tasks.
+    /// </summary>
+    puint_z m_uSleepingTaskCount;
+
+    /// <summary>
+    /// The number of sleeping tasks that fit in the heap without reallocating it.
+    /// </summary>
+    puint_z m_uSleepingTaskCapacity;
+
+    /// <summary>
+    /// Indicates whether the threads have to finish.
+    /// </summary>
+    boost::atomic<bool> m_bStop;
+};
+
+} // namespace z
+
+
+#endif // __ASYNCTASKEXECUTOR__
@@ -0,0 +1,151 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __EVENTCOUNT__
+#define __EVENTCOUNT__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include <boost/atomic.hpp>
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a mechanism with which threads can wait for a change in a lock-free data structure without any mutex, until another thread that changes 
+/// the data structure notifies them.
+/// </summary>
+/// <remarks>
+/// This class is thread-safe.<br/>
+/// A waiting thread first announces that it is about to wait, then checks the data structure again and, only if there is still nothing to do, waits 
+/// using the key it obtained when announcing:<br/>
+/// <br/>
+/// u32_z uKey = eventCount.PrepareWait();<br/>
+/// if(queue.TryDequeue(element)) eventCount.CancelWait(); else eventCount.Wait(uKey);<br/>
+/// <br/>
+/// A thread that changes the data structure calls NotifyOne or NotifyAll afterwards. A notification sent after PrepareWait makes Wait return 
+/// immediately, so it cannot be missed. Notifications cost a memory fence and do not perform any system call when no thread is waiting.<br/>
+/// Waits may end without a notification (spurious wake-ups), so the data structure must be checked again.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS EventCount
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    EventCount();
+
+private:
+
+    // Hidden
+    EventCount(const EventCount&);
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    EventCount& operator=(const EventCount&);
+
+public:
+
+    /// <summary>
+    /// Announces that the calling thread is about to wait. It must be followed by either Wait or CancelWait.
+    /// </summary>
+    /// <returns>
+    /// The key to be passed to Wait.
+    /// </returns>
+    u32_z PrepareWait();
+
+    /// <summary>
+    /// Cancels the wait announced by the calling thread, when it is not necessary anymore.
+    /// </summary>
+    void CancelWait();
+
+    /// <summary>
+    /// Blocks the calling thread until a notification is sent after the wait was announced.
+    /// </summary>
+    /// <param name="uKey">[IN] The key obtained from PrepareWait.</param>
+    void Wait(const u32_z uKey);
+
+    /// <summary>
+    /// Wakes up one of the threads that wait or are about to wait, if any.
+    /// </summary>
+    /// <remarks>
+    /// The change made to the data structure must be visible before calling this method.
+    /// </remarks>
+    void NotifyOne();
+
+    /// <summary>
+    /// Wakes up all the threads that wait or are about to wait, if any.
+    /// </summary>
+    /// <remarks>
+    /// The change made to the data structure must be visible before calling this method.
+    /// </remarks>
+    void NotifyAll();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of threads that are waiting or about to wait.
+    /// </summary>
+    /// <remarks>
+    /// If other threads are using the instance, the result is only an approximation, it may have changed when it is returned.
+    /// </remarks>
+    /// <returns>
+    /// The number of waiting threads.
+    /// </returns>
+    u32_z GetWaiterCount() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+    
+    /// <summary>
+    /// The number that changes with every notification sent while there are waiting threads, on which those threads sleep.
+    /// </summary>
+    boost::atomic<u32_z> m_uEpoch;
+    
+    /// <summary>
+    /// The number of threads that are waiting or about to wait.
+    /// </summary>
+    boost::atomic<u32_z> m_uWaiterCount;
+};
+
+} // namespace z
+
+
+#endif // __EVENTCOUNT__
@@ -0,0 +1,238 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __LOCKSTATISTICS__
+#define __LOCKSTATISTICS__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZTime/TimeSpan.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Contains the statistics recorded by all the locks that share a name, added up for all the threads that used them (see SLockStatistics).
+/// </summary>
+/// <remarks>
+/// Wait and hold times are also classified in histograms whose buckets are powers of two: bucket N counts the times that lasted from 2^N to 2^(N+1) - 1 nanoseconds, 
+/// except the first one, which also counts the times under 1 nanosecond, and the last one, which also counts the longer times.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS LockStatistics
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The number of buckets of the histograms of wait and hold times. The last bucket starts at about 2 seconds.
+    /// </summary>
+    static const u32_z HISTOGRAM_BUCKET_COUNT = 32U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives all the statistics.
+    /// </summary>
+    /// <param name="strName">[IN] The name of the locks.</param>
+    /// <param name="uAcquisitionCount">[IN] The number of times the locks were acquired, in any mode.</param>
+    /// <param name="uContendedAcquisitionCount">[IN] The number of acquisitions that had to wait because another thread owned the lock. It must not be greater than 
+    /// the number of acquisitions.</param>
+    /// <param name="uWaitNanoseconds">[IN] The sum of the time spent waiting in contended acquisitions, in nanoseconds.</param>
+    /// <param name="uHoldCount">[IN] The number of times the locks were released after being acquired in exclusive mode.</param>
+    /// <param name="uHoldNanoseconds">[IN] The sum of the time the locks were held in exclusive mode, in nanoseconds.</param>
+    /// <param name="arWaitTimeHistogram">[IN] The number of contended acquisitions whose wait time belongs to every bucket. It must contain HISTOGRAM_BUCKET_COUNT elements.</param>
+    /// <param name="arHoldTimeHistogram">[IN] The number of exclusive holds whose duration belongs to every bucket. It must contain HISTOGRAM_BUCKET_COUNT elements.</param>
+    LockStatistics(const string_z &strName, 
+                   const u64_z uAcquisitionCount, 
+                   const u64_z uContendedAcquisitionCount, 
+                   const u64_z uWaitNanoseconds, 
+                   const u64_z uHoldCount, 
+                   const u64_z uHoldNanoseconds, 
+                   const u64_z* arWaitTimeHistogram, 
+                   const u64_z* arHoldTimeHistogram);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calculates the histogram bucket to which a time belongs.
+    /// </summary>
+    /// <param name="uNanoseconds">[IN] A time, in nanoseconds.</param>
+    /// <returns>
+    /// The index of the bucket, from 0 to HISTOGRAM_BUCKET_COUNT - 1.
+    /// </returns>
+    static u32_z GetHistogramBucket(const u64_z uNanoseconds);
+
+    /// <summary>
+    /// Gets a text representation of the statistics, made of space-separated key=value pairs so it can be processed by other tools. Only the histogram buckets 
+    /// that are not empty are listed, as bucket:count pairs.
+    /// </summary>
+    /// <remarks>
+    /// For example: "lock=Queue acquisitions=1200 contended=15 wait_ns=48000 holds=1200 hold_ns=96000 wait_histogram=11:10,12:5 hold_histogram=6:1100,7:100".
+    /// </remarks>
+    /// <returns>
+    /// The text representation of the statistics.
+    /// </returns>
+    string_z ToString() const;
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the name of the locks.
+    /// </summary>
+    /// <returns>
+    /// The name.
+    /// </returns>
+    string_z GetName() const;
+
+    /// <summary>
+    /// Gets the number of times the locks were acquired, in any mode.
+    /// </summary>
+    /// <returns>
+    /// The number of acquisitions.
+    /// </returns>
+    u64_z GetAcquisitionCount() const;
+
+    /// <summary>
+    /// Gets the number of acquisitions that had to wait because another thread owned the lock.
+    /// </summary>
+    /// <returns>
+    /// The number of contended acquisitions.
+    /// </returns>
+    u64_z GetContendedAcquisitionCount() const;
+
+    /// <summary>
+    /// Gets the proportion of acquisitions that had to wait because another thread owned the lock.
+    /// </summary>
+    /// <returns>
+    /// A value between 0 and 1. Zero if the locks were never acquired.
+    /// </returns>
+    float_z GetContentionRate() const;
+
+    /// <summary>
+    /// Gets the sum of the time spent waiting in contended acquisitions.
+    /// </summary>
+    /// <returns>
+    /// The total wait time.
+    /// </returns>
+    TimeSpan GetWaitTime() const;
+
+    /// <summary>
+    /// Gets the number of times the locks were released after being acquired in exclusive mode, whose duration was measured.
+    /// </summary>
+    /// <returns>
+    /// The number of exclusive holds.
+    /// </returns>
+    u64_z GetHoldCount() const;
+
+    /// <summary>
+    /// Gets the sum of the time the locks were held in exclusive mode.
+    /// </summary>
+    /// <returns>
+    /// The total hold time.
+    /// </returns>
+    TimeSpan GetHoldTime() const;
+
+    /// <summary>
+    /// Gets the number of contended acquisitions whose wait time belongs to a bucket of the histogram.
+    /// </summary>
+    /// <param name="uBucket">[IN] The index of the bucket. It must be lower than HISTOGRAM_BUCKET_COUNT.</param>
+    /// <returns>
+    /// The number of acquisitions.
+    /// </returns>
+    u64_z GetWaitTimeHistogram(const u32_z uBucket) const;
+
+    /// <summary>
+    /// Gets the number of exclusive holds whose duration belongs to a bucket of the histogram.
+    /// </summary>
+    /// <param name="uBucket">[IN] The index of the bucket. It must be lower than HISTOGRAM_BUCKET_COUNT.</param>
+    /// <returns>
+    /// The number of holds.
+    /// </returns>
+    u64_z GetHoldTimeHistogram(const u32_z uBucket) const;
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The name of the locks.
+    /// </summary>
+    string_z m_strName;
+
+    /// <summary>
+    /// The number of times the locks were acquired.
+    /// </summary>
+    u64_z m_uAcquisitionCount;
+
+    /// <summary>
+    /// The number of acquisitions that had to wait.
+    /// </summary>
+    u64_z m_uContendedAcquisitionCount;
+
+    /// <summary>
+    /// The sum of the time spent waiting in contended acquisitions, in nanoseconds.
+    /// </summary>
+    u64_z m_uWaitNanoseconds;
+
+    /// <summary>
+    /// The number of exclusive holds that were measured.
+    /// </summary>
+    u64_z m_uHoldCount;
+
+    /// <summary>
+    /// The sum of the time the locks were held in exclusive mode, in nanoseconds.
+    /// </summary>
+    u64_z m_uHoldNanoseconds;
+
+    /// <summary>
+    /// The histogram of wait times.
+    /// </summary>
+    u64_z m_arWaitTimeHistogram[HISTOGRAM_BUCKET_COUNT];
+
+    /// <summary>
+    /// The histogram of hold times.
+    /// </summary>
+    u64_z m_arHoldTimeHistogram[HISTOGRAM_BUCKET_COUNT];
+
+};
+
+} // namespace z
+
+
+#endif // __LOCKSTATISTICS__
@@ -28,7 +28,8 @@
 #define __MUTEX__
 
 #include "ZThreading/ThreadingModuleDefinitions.h"
-#include <boost/thread/mutex.hpp>
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include <boost/atomic.hpp>
 
 #ifdef Z_COMPILER_MSVC
     // This warning appears when instancing a template to create a data member and that template instance is not exported.
@@ -45,15 +46,146 @@ namespace z
 /// </summary>
 /// <remarks>
 /// This class is thread-safe.<br/>
-/// It is a wrapper for the mutex class, from Boost libraries.
+/// It is implemented on top of SFutex instead of the mutex of the operating system. Locking and unlocking a free mutex costs one atomic operation and 
+/// never enters the kernel. When the mutex is owned by another thread, the calling thread spins for a while before it goes to sleep, hoping the owner 
+/// releases it soon; the number of spins adapts to the time the mutex was held in previous contended locks, and it is zero on machines with only one logical processor.<br/>
+/// When lock statistics are enabled in the configuration, every mutex records its acquisitions, contention, wait times and hold times under its name (see SLockStatistics).
 /// </remarks>
 class Z_THREADING_MODULE_SYMBOLS Mutex
 {
+    // INTERNAL CLASSES
+    // ---------------
+public:
+
+    /// <summary>
+    /// The actual implementation of the mutex, whose interface fulfills the requirements of the Lockable concept of Boost libraries so it 
+    /// can be used by scoped locks and condition variables.
+    /// </summary>
+    /// <remarks>
+    /// Its state is stored in a single integer: 0 when it is free, 1 when it is locked and 2 when it is locked and there may be sleeping threads.
+    /// </remarks>
+    class Z_THREADING_MODULE_SYMBOLS FutexMutex
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor. The mutex is not locked and its statistics are not recorded.
+        /// </summary>
+        FutexMutex();
+
+        /// <summary>
+        /// Constructor that receives the name under which the statistics of the mutex are recorded. The mutex is not locked.
+        /// </summary>
+        /// <param name="szName">[IN] The name of the mutex. It must remain valid during the life of the process, like a string literal. If it is null, 
+        /// the statistics of the mutex are not recorded.</param>
+        explicit FutexMutex(const char* szName);
+
+    private:
+
+        // Hidden
+        FutexMutex(const FutexMutex&);
+
+
+        // METHODS
+        // ---------------
+    private:
+
+        // Hidden
+        FutexMutex& operator=(const FutexMutex&);
+
+    public:
+
+        /// <summary>
+        /// Locks the mutex, waiting until it is free if another thread owns it.
+        /// </summary>
+        void lock();
+
+        /// <summary>
+        /// Releases the mutex and wakes up one of the sleeping threads, if any.
+        /// </summary>
+        void unlock();
+
+        /// <summary>
+        /// Locks the mutex only if it is free.
+        /// </summary>
+        /// <returns>
+        /// True if the mutex has been locked by the calling thread; False otherwise.
+        /// </returns>
+        bool try_lock();
+
+    private:
+
+        /// <summary>
+        /// Spins and, eventually, sleeps until the mutex is locked by the calling thread, when the first attempt failed.
+        /// </summary>
+        void _LockContended();
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+
+        /// <summary>
+        /// Stores the instant the mutex was acquired and records the acquisition in the statistics, if the mutex is tracked.
+        /// </summary>
+        /// <param name="bIsContended">[IN] Whether the thread had to wait for another thread to release the mutex.</param>
+        /// <param name="uWaitStartInstant">[IN] The instant the thread started waiting, in nanoseconds. It is ignored if the acquisition was not contended.</param>
+        void _RecordAcquisition(const bool bIsContended, const u64_z uWaitStartInstant);
+
+#endif
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The state of the mutex: 0 (free), 1 (locked) or 2 (locked, there may be sleeping threads).
+        /// </summary>
+        boost::atomic<u32_z> m_uState;
+
+        /// <summary>
+        /// The average number of spins that were necessary to lock the mutex in previous contended locks. 
+        /// </summary>
+        boost::atomic<u32_z> m_uSpinCount;
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+
+        /// <summary>
+        /// The index of the name of the mutex in SLockStatistics, or SLockStatistics::UNTRACKED_LOCK if its statistics are not recorded.
+        /// </summary>
+        u32_z m_uLockIndex;
+
+        /// <summary>
+        /// The instant the mutex was acquired by its current owner, in nanoseconds.
+        /// </summary>
+        u64_z m_uAcquisitionInstant;
+
+#endif
+    };
+
+
     // TYPEDEFS
     // ---------------
 public:
 
-    typedef boost::mutex WrappedType;
+    typedef FutexMutex WrappedType;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor. Its statistics are recorded under the name "Mutex".
+    /// </summary>
+    Mutex();
+
+    /// <summary>
+    /// Constructor that receives the name under which the statistics of the mutex are recorded, so it can be told apart from other mutexes.
+    /// </summary>
+    /// <param name="szName">[IN] The name of the mutex. It must remain valid during the life of the process, like a string literal. If it is null, 
+    /// the statistics of the mutex are not recorded.</param>
+    explicit Mutex(const char* szName);
 
 
     // DESTRUCTOR
@@ -75,8 +207,7 @@ public:
     /// the order of execution of several waiting threads is not deterministic. When it is calling thread's turn, it locks the mutex so no other thread can execute the same code until Unlock is called.
     /// </summary>
     /// <remarks>
-    /// If the mutex is locked by a thread which is killed before calling Unlock, its state depends on the operating system. On Windows, it will stay in an special state until it is locked and unlocked again;
-    /// on Unix-based systems (using POSIX threads), the mutex ends up with an undefined state and it is not safe to try to lock it again. Either way, take into account that the resource protected by the mutex may 
+    /// If the mutex is locked by a thread which is killed before calling Unlock, it remains locked forever. Take into account that the resource protected by the mutex may 
     /// be in an inconsistent state when this happen.
     /// </remarks>
     void Lock();
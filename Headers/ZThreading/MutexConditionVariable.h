@@ -0,0 +1,189 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __MUTEXCONDITIONVARIABLE__
+#define __MUTEXCONDITIONVARIABLE__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/Assertions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZThreading/SMonotonicClock.h"
+#include "ZTime/TimeSpan.h"
+#include <boost/atomic.hpp>
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a mechanism with which threads can wait for a condition to be fulfilled until another thread sends a notification to either one 
+/// or all the threads waiting for the same condition, or until a maximum time elapses. It can only be used along with Mutex.
+/// </summary>
+/// <remarks>
+/// This class is thread-safe.<br/>
+/// Unlike ConditionVariable, it does not use any internal mutex: waiting threads sleep on a sequence number that every notification increments 
+/// (see SFutex), and notifications do not perform any system call when no thread is waiting.<br/>
+/// Waits may end without a notification (spurious wake-ups), so the condition must be checked again; the overloads that receive a predicate do so.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS MutexConditionVariable
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    MutexConditionVariable();
+
+private:
+
+    // Hidden
+    MutexConditionVariable(const MutexConditionVariable&);
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    MutexConditionVariable& operator=(const MutexConditionVariable&);
+
+public:
+    
+    /// <summary>
+    /// Blocks the thread until it gets notified from another thread.
+    /// </summary>
+    /// <remarks>
+    /// When the thread blocks, the input lock unlocks its associated mutex. When the thread is notified, the mutex will be locked again.
+    /// </remarks>
+    /// <param name="lock">[IN] A lock that owns its associated mutex.</param>
+    void Wait(ScopedExclusiveLock<> &lock);
+    
+    /// <summary>
+    /// Blocks the thread until a condition is fulfilled, waiting for notifications from other threads while it is not.
+    /// </summary>
+    /// <remarks>
+    /// The condition is checked with the mutex locked, before waiting and every time the thread is notified.
+    /// </remarks>
+    /// <typeparam name="PredicateT">The type of the function or function object, like Delegate, that checks the condition. It must have no 
+    /// parameters and return a boolean value.</typeparam>
+    /// <param name="lock">[IN] A lock that owns its associated mutex.</param>
+    /// <param name="predicate">[IN] The function that returns whether the condition is fulfilled.</param>
+    template<class PredicateT>
+    void Wait(ScopedExclusiveLock<> &lock, PredicateT predicate)
+    {
+        while(!predicate())
+            this->Wait(lock);
+    }
+    
+    /// <summary>
+    /// Blocks the thread until it gets notified from another thread or a maximum time elapses.
+    /// </summary>
+    /// <remarks>
+    /// When the thread blocks, the input lock unlocks its associated mutex. When the thread continues, the mutex will be locked again.
+    /// </remarks>
+    /// <param name="lock">[IN] A lock that owns its associated mutex.</param>
+    /// <param name="timeout">[IN] The maximum time to wait.</param>
+    /// <returns>
+    /// False if the maximum time elapsed; True otherwise.
+    /// </returns>
+    bool WaitFor(ScopedExclusiveLock<> &lock, const TimeSpan &timeout);
+    
+    /// <summary>
+    /// Blocks the thread until a condition is fulfilled or a maximum time elapses, waiting for notifications from other threads while the condition is not fulfilled.
+    /// </summary>
+    /// <remarks>
+    /// The condition is checked with the mutex locked, before waiting and every time the thread is notified.
+    /// </remarks>
+    /// <typeparam name="PredicateT">The type of the function or function object, like Delegate, that checks the condition. It must have no 
+    /// parameters and return a boolean value.</typeparam>
+    /// <param name="lock">[IN] A lock that owns its associated mutex.</param>
+    /// <param name="timeout">[IN] The maximum time to wait.</param>
+    /// <param name="predicate">[IN] The function that returns whether the condition is fulfilled.</param>
+    /// <returns>
+    /// The result of the last check of the condition, which is False if the maximum time elapsed before it was fulfilled.
+    /// </returns>
+    template<class PredicateT>
+    bool WaitFor(ScopedExclusiveLock<> &lock, const TimeSpan &timeout, PredicateT predicate)
+    {
+        static const u64_z NANOSECONDS_IN_HUNDRED = 100ULL;
+
+        const u64_z DEADLINE = SMonotonicClock::GetNanoseconds() + timeout.GetHundredsOfNanoseconds() * NANOSECONDS_IN_HUNDRED;
+        bool bIsFulfilled = predicate();
+        u64_z uCurrentInstant = SMonotonicClock::GetNanoseconds();
+
+        while(!bIsFulfilled && uCurrentInstant < DEADLINE)
+        {
+            this->WaitFor(lock, TimeSpan((DEADLINE - uCurrentInstant) / NANOSECONDS_IN_HUNDRED));
+            bIsFulfilled = predicate();
+            uCurrentInstant = SMonotonicClock::GetNanoseconds();
+        }
+
+        return bIsFulfilled;
+    }
+    
+    /// <summary>
+    /// Sends a notification to only one of the threads that wait for the condition, if any.
+    /// </summary>
+    /// <remarks>
+    /// The order in which waiting threads are notified is undefined.<br/>
+    /// When a thread is notified, the lock passed as parameter to Wait is locked again before it continues.
+    /// </remarks>
+    void NotifyOne();
+
+    /// <summary>
+    /// Sends a notification to all the threads that wait for the condition, if any.
+    /// </summary>
+    /// <remarks>
+    /// The order in which waiting threads are notified is undefined.<br/>
+    /// When a thread is notified, the lock passed as parameter to Wait is locked again before it continues.
+    /// </remarks>
+    void NotifyAll();
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+    
+    /// <summary>
+    /// The sequence number that changes with every notification, on which waiting threads sleep.
+    /// </summary>
+    boost::atomic<u32_z> m_uSequence;
+    
+    /// <summary>
+    /// The number of threads that are waiting or about to wait.
+    /// </summary>
+    boost::atomic<u32_z> m_uWaiterCount;
+};
+
+} // namespace z
+
+
+#endif // __MUTEXCONDITIONVARIABLE__
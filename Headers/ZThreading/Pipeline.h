@@ -0,0 +1,541 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __PIPELINE__
+#define __PIPELINE__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Delegate.h"
+#include "ZThreading/EPipelineStageMode.h"
+#include "ZThreading/PipelineStageStatistics.h"
+#include "ZThreading/EventCount.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/MutexConditionVariable.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZCommon/Assertions.h"
+#include <boost/atomic.hpp>
+
+#ifdef Z_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
+
+
+namespace z
+{
+
+// Forward declarations
+class Thread;
+
+
+/// <summary>
+/// Represents a chain of processing stages executed by a set of worker threads, where every stage receives the tokens produced by the previous one 
+/// through a bounded queue.
+/// </summary>
+/// <remarks>
+/// A token is a pointer to any data. The first stage produces the tokens: its function is called with null repeatedly and returns a new token every time, 
+/// or null when there are no more tokens. The function of the rest of stages receives a token and returns the token to be passed to the next stage, which may 
+/// be the same or another one; returning null filters the token out, so the next stages will not receive it. The value returned by the last stage is ignored.<br/>
+/// Every stage is executed by its own worker threads: one for serial stages and as many as its concurrency for parallel stages. Stages that process the tokens 
+/// in order receive them in the order they were produced by the first stage, no matter whether previous stages reordered them.<br/>
+/// The token limit passed to Run caps the number of tokens in flight, that is, produced by the first stage and not yet processed by the last one (filtered 
+/// tokens count until they reach the end). When it is reached, the first stage waits, which bounds the memory used by the tokens and the size of the queues.<br/>
+/// Statistics are collected for every stage during every run. The time spent inside the functions is measured with a monotonic clock, which adds the cost of two 
+/// readings per token.<br/>
+/// Stages cannot be added while the pipeline is running and Run must not be called by several threads at the same time.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS Pipeline
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The type of the functions executed by the stages, which receive a token and return the token for the next stage.
+    /// </summary>
+    typedef Delegate<void*(void*)> StageFunction;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// An element of the queues that connect the stages, which contains either a token or the signal that makes a worker thread finish.
+    /// </summary>
+    class Token
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        Token() : m_pData(null_z),
+                  m_uSequence(NO_SEQUENCE),
+                  m_bStop(false)
+        {
+        }
+
+        /// <summary>
+        /// Constructor that receives all the attributes.
+        /// </summary>
+        /// <param name="pData">[IN] The data of the token. Null if the token was filtered out.</param>
+        /// <param name="uSequence">[IN] The position of the token in the order in which tokens were produced by the first stage.</param>
+        /// <param name="bStop">[IN] Indicates whether the element is the signal that makes a worker thread finish.</param>
+        Token(void* pData, const u64_z uSequence, const bool bStop) : m_pData(pData),
+                                                                      m_uSequence(uSequence),
+                                                                      m_bStop(bStop)
+        {
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The data of the token. Filtered tokens keep flowing with null data, so stages that process tokens in order do not wait for them.
+        /// </summary>
+        void* m_pData;
+
+        /// <summary>
+        /// The position of the token in the order in which tokens were produced by the first stage.
+        /// </summary>
+        u64_z m_uSequence;
+
+        /// <summary>
+        /// Indicates whether the element is the signal that makes a worker thread finish.
+        /// </summary>
+        bool m_bStop;
+    };
+
+    /// <summary>
+    /// A first-in first-out queue of tokens that connects two stages. Extracting a token blocks the calling thread until there is one.
+    /// </summary>
+    /// <remarks>
+    /// It belongs to the pipeline so this module does not depend on the containers module, which depends on this one. Adding a token never blocks 
+    /// because the capacity is chosen so the queue is never full (see Run).
+    /// </remarks>
+    class TokenQueue
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the capacity.
+        /// </summary>
+        /// <param name="uCapacity">[IN] The maximum number of tokens in the queue. It must be greater than zero.</param>
+        explicit TokenQueue(const puint_z uCapacity) : m_arTokens(new Token[uCapacity]),
+                                                       m_uCapacity(uCapacity),
+                                                       m_uFirst(0),
+                                                       m_uCount(0)
+        {
+        }
+
+    private:
+
+        // Hidden
+        TokenQueue(const TokenQueue&);
+
+
+        // DESTRUCTOR
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        ~TokenQueue()
+        {
+            delete[] m_arTokens;
+        }
+
+
+        // METHODS
+        // ---------------
+    private:
+
+        // Hidden
+        TokenQueue& operator=(const TokenQueue&);
+
+    public:
+
+        /// <summary>
+        /// Adds a token to the end of the queue and wakes up a thread waiting for it, if any.
+        /// </summary>
+        /// <param name="token">[IN] The token to add. The queue must not be full.</param>
+        void Enqueue(const Token &token)
+        {
+            ScopedExclusiveLock<> lock(m_mutex);
+
+            const puint_z COUNT = m_uCount.load(boost::memory_order_relaxed);
+
+            Z_ASSERT_ERROR(COUNT < m_uCapacity, "The queue is full.");
+
+            m_arTokens[(m_uFirst + COUNT) % m_uCapacity] = token;
+            m_uCount.store(COUNT + 1U, boost::memory_order_relaxed);
+            m_notEmpty.NotifyOne();
+        }
+
+        /// <summary>
+        /// Extracts the first token of the queue, waiting until there is one.
+        /// </summary>
+        /// <param name="token">[OUT] The extracted token.</param>
+        void Dequeue(Token &token)
+        {
+            ScopedExclusiveLock<> lock(m_mutex);
+
+            while(m_uCount.load(boost::memory_order_relaxed) == 0)
+                m_notEmpty.Wait(lock);
+
+            token = m_arTokens[m_uFirst];
+            m_uFirst = (m_uFirst + 1U) % m_uCapacity;
+            m_uCount.store(m_uCount.load(boost::memory_order_relaxed) - 1U, boost::memory_order_relaxed);
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the number of tokens in the queue. It is read without locking, so it may be outdated as soon as it is returned.
+        /// </summary>
+        /// <returns>
+        /// The number of tokens.
+        /// </returns>
+        puint_z GetCount() const
+        {
+            return m_uCount.load(boost::memory_order_relaxed);
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The circular buffer that stores the tokens.
+        /// </summary>
+        Token* m_arTokens;
+
+        /// <summary>
+        /// The number of positions of the buffer.
+        /// </summary>
+        puint_z m_uCapacity;
+
+        /// <summary>
+        /// The position of the first token in the buffer.
+        /// </summary>
+        puint_z m_uFirst;
+
+        /// <summary>
+        /// The number of tokens in the queue. It is only modified while the mutex is locked.
+        /// </summary>
+        boost::atomic<puint_z> m_uCount;
+
+        /// <summary>
+        /// The mutex that protects the queue.
+        /// </summary>
+        Mutex m_mutex;
+
+        /// <summary>
+        /// The condition variable the threads wait on until there is a token.
+        /// </summary>
+        MutexConditionVariable m_notEmpty;
+    };
+
+    /// <summary>
+    /// A stage of the pipeline, with its input queue and its statistics.
+    /// </summary>
+    class Stage
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the function and how it is executed.
+        /// </summary>
+        /// <param name="function">[IN] The function executed by the stage.</param>
+        /// <param name="eMode">[IN] How the tokens are processed.</param>
+        /// <param name="uWorkerCount">[IN] The number of worker threads.</param>
+        Stage(const StageFunction &function, const EPipelineStageMode &eMode, const u32_z uWorkerCount) : m_function(function),
+                                                                                                           m_eMode(eMode),
+                                                                                                           m_uWorkerCount(uWorkerCount),
+                                                                                                           m_pInputQueue(null_z),
+                                                                                                           m_arReorderBuffer(null_z),
+                                                                                                           m_uNextSequence(0),
+                                                                                                           m_uProcessedCount(0),
+                                                                                                           m_uFilteredCount(0),
+                                                                                                           m_uBusyNanoseconds(0),
+                                                                                                           m_uQueueDepthSum(0),
+                                                                                                           m_uQueueDepthSampleCount(0),
+                                                                                                           m_uQueueDepthMaximum(0)
+        {
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The function executed by the stage.
+        /// </summary>
+        StageFunction m_function;
+
+        /// <summary>
+        /// How the tokens are processed.
+        /// </summary>
+        EPipelineStageMode m_eMode;
+
+        /// <summary>
+        /// The number of worker threads.
+        /// </summary>
+        u32_z m_uWorkerCount;
+
+        /// <summary>
+        /// The queue from which the worker threads extract the tokens, only while running. The first stage has no input queue.
+        /// </summary>
+        TokenQueue* m_pInputQueue;
+
+        /// <summary>
+        /// The tokens that arrived before their turn, stored at the position given by their sequence modulo the token limit. Only used by stages 
+        /// that process tokens in order, while running.
+        /// </summary>
+        Token* m_arReorderBuffer;
+
+        /// <summary>
+        /// The sequence of the next token to be processed by a stage that processes tokens in order, or produced by the first stage.
+        /// </summary>
+        u64_z m_uNextSequence;
+
+        /// <summary>
+        /// The number of tokens passed to the function.
+        /// </summary>
+        boost::atomic<u64_z> m_uProcessedCount;
+
+        /// <summary>
+        /// The number of tokens for which the function returned null.
+        /// </summary>
+        boost::atomic<u64_z> m_uFilteredCount;
+
+        /// <summary>
+        /// The sum of the time spent by all the worker threads inside the function, in nanoseconds.
+        /// </summary>
+        boost::atomic<u64_z> m_uBusyNanoseconds;
+
+        /// <summary>
+        /// The sum of the number of tokens found in the input queue every time it was sampled.
+        /// </summary>
+        boost::atomic<u64_z> m_uQueueDepthSum;
+
+        /// <summary>
+        /// The number of times the input queue was sampled.
+        /// </summary>
+        boost::atomic<u64_z> m_uQueueDepthSampleCount;
+
+        /// <summary>
+        /// The maximum number of tokens found in the input queue.
+        /// </summary>
+        boost::atomic<puint_z> m_uQueueDepthMaximum;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Sequence that represents that a position of a reorder buffer does not contain any token.
+    /// </summary>
+    static const u64_z NO_SEQUENCE = -1;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor that creates a pipeline with no stages.
+    /// </summary>
+    Pipeline();
+
+private:
+
+    // Hidden
+    Pipeline(const Pipeline&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. The pipeline must not be running.
+    /// </summary>
+    ~Pipeline();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    Pipeline& operator=(const Pipeline&);
+
+public:
+
+    /// <summary>
+    /// Adds a stage to the end of the pipeline.
+    /// </summary>
+    /// <remarks>
+    /// The first stage, which produces the tokens, must be serial.
+    /// </remarks>
+    /// <param name="function">[IN] The function executed by the stage. It must not be null. The function of parallel stages is called by several 
+    /// threads at the same time.</param>
+    /// <param name="eMode">[IN] How the tokens are processed by the stage.</param>
+    /// <param name="uConcurrency">[IN] The number of tokens the stage processes at the same time. It must be greater than zero; it must be 1 for serial stages.</param>
+    void AddStage(const StageFunction &function, const EPipelineStageMode &eMode, const u32_z uConcurrency);
+
+    /// <summary>
+    /// Starts the worker threads of all the stages and blocks the calling thread until the first stage returns null and all the tokens have been processed.
+    /// </summary>
+    /// <remarks>
+    /// The statistics of the previous run are discarded.
+    /// </remarks>
+    /// <param name="uTokenLimit">[IN] The maximum number of tokens in flight. It must be greater than zero.</param>
+    void Run(const puint_z uTokenLimit);
+
+private:
+
+    /// <summary>
+    /// The function executed by the worker threads of a stage.
+    /// </summary>
+    /// <param name="pPipeline">[IN] The pipeline.</param>
+    /// <param name="uStageIndex">[IN] The position of the stage in the pipeline.</param>
+    static void _ExecuteStage(Pipeline* pPipeline, const puint_z uStageIndex);
+
+    /// <summary>
+    /// Calls the function of the first stage until it returns null, waiting when the token limit is reached, and passes the tokens to the next stage.
+    /// </summary>
+    void _ProduceTokens();
+
+    /// <summary>
+    /// Extracts tokens from the input queue of a stage and processes them, until the signal to finish is extracted.
+    /// </summary>
+    /// <param name="uStageIndex">[IN] The position of the stage in the pipeline. It must not be the first one.</param>
+    void _ConsumeTokens(const puint_z uStageIndex);
+
+    /// <summary>
+    /// Calls the function of a stage with a token, unless it was filtered out, and passes the result to the next stage.
+    /// </summary>
+    /// <param name="uStageIndex">[IN] The position of the stage in the pipeline.</param>
+    /// <param name="token">[IN] The token to be processed.</param>
+    /// <param name="uProcessedCount">[IN/OUT] The number of tokens processed by the calling thread, which is incremented if the function is called.</param>
+    /// <param name="uFilteredCount">[IN/OUT] The number of tokens filtered out by the calling thread, which is incremented if the function returns null.</param>
+    /// <param name="uBusyNanoseconds">[IN/OUT] The time spent by the calling thread inside the function, to which the time of this call is added.</param>
+    void _ProcessToken(const puint_z uStageIndex, Token token, u64_z &uProcessedCount, u64_z &uFilteredCount, u64_z &uBusyNanoseconds);
+
+    /// <summary>
+    /// Passes a token to the next stage or, if it is the last stage, releases the token so the first stage can produce another one.
+    /// </summary>
+    /// <param name="uStageIndex">[IN] The position of the stage that processed the token.</param>
+    /// <param name="token">[IN] The token.</param>
+    void _ForwardToken(const puint_z uStageIndex, const Token &token);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of stages.
+    /// </summary>
+    /// <returns>
+    /// The number of stages.
+    /// </returns>
+    puint_z GetStageCount() const;
+
+    /// <summary>
+    /// Gets the statistics collected by a stage during the last run.
+    /// </summary>
+    /// <remarks>
+    /// Every worker thread adds its statistics when it finishes, so they are complete only when Run returns.
+    /// </remarks>
+    /// <param name="uStageIndex">[IN] The position of the stage in the pipeline. It must be lower than the number of stages.</param>
+    /// <returns>
+    /// A copy of the statistics.
+    /// </returns>
+    PipelineStageStatistics GetStageStatistics(const puint_z uStageIndex) const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The stages, in order.
+    /// </summary>
+    Stage** m_arStages;
+
+    /// <summary>
+    /// The number of stages.
+    /// </summary>
+    puint_z m_uStageCount;
+
+    /// <summary>
+    /// The maximum number of tokens in flight in the current run.
+    /// </summary>
+    puint_z m_uTokenLimit;
+
+    /// <summary>
+    /// The number of tokens produced by the first stage that have not reached the end of the pipeline yet.
+    /// </summary>
+    boost::atomic<puint_z> m_uTokensInFlight;
+
+    /// <summary>
+    /// The event count on which the first stage waits until a token is released, and Run waits until all the tokens are released.
+    /// </summary>
+    EventCount m_tokenReleased;
+
+};
+
+} // namespace z
+
+
+#ifdef Z_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
+
+#endif // __PIPELINE__
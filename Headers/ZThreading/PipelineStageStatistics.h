@@ -0,0 +1,178 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __PIPELINESTAGESTATISTICS__
+#define __PIPELINESTAGESTATISTICS__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZTime/TimeSpan.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Contains the statistics collected by a stage of a Pipeline during its last run.
+/// </summary>
+class Z_THREADING_MODULE_SYMBOLS PipelineStageStatistics
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives all the statistics.
+    /// </summary>
+    /// <param name="uProcessedCount">[IN] The number of tokens passed to the function of the stage.</param>
+    /// <param name="uFilteredCount">[IN] The number of tokens for which the function of the stage returned null.</param>
+    /// <param name="uWorkerCount">[IN] The number of threads that executed the stage. It must be greater than zero.</param>
+    /// <param name="uBusyNanoseconds">[IN] The sum of the time spent by all the threads inside the function of the stage, in nanoseconds.</param>
+    /// <param name="uQueueDepthSum">[IN] The sum of the number of tokens found in the input queue of the stage every time it was sampled.</param>
+    /// <param name="uQueueDepthSampleCount">[IN] The number of times the input queue of the stage was sampled.</param>
+    /// <param name="uQueueDepthMaximum">[IN] The maximum number of tokens found in the input queue of the stage.</param>
+    PipelineStageStatistics(const u64_z uProcessedCount, 
+                            const u64_z uFilteredCount, 
+                            const u32_z uWorkerCount, 
+                            const u64_z uBusyNanoseconds, 
+                            const u64_z uQueueDepthSum, 
+                            const u64_z uQueueDepthSampleCount, 
+                            const puint_z uQueueDepthMaximum);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of tokens passed to the function of the stage.
+    /// </summary>
+    /// <remarks>
+    /// For the first stage, it is the number of tokens it produced.
+    /// </remarks>
+    /// <returns>
+    /// The number of processed tokens.
+    /// </returns>
+    u64_z GetProcessedCount() const;
+
+    /// <summary>
+    /// Gets the number of tokens for which the function of the stage returned null, which were not passed to the next stages.
+    /// </summary>
+    /// <returns>
+    /// The number of filtered tokens. Always zero for the first stage.
+    /// </returns>
+    u64_z GetFilteredCount() const;
+
+    /// <summary>
+    /// Gets the number of threads that executed the stage.
+    /// </summary>
+    /// <returns>
+    /// The number of worker threads.
+    /// </returns>
+    u32_z GetWorkerCount() const;
+
+    /// <summary>
+    /// Gets the sum of the time spent by all the threads inside the function of the stage.
+    /// </summary>
+    /// <returns>
+    /// The busy time of the stage.
+    /// </returns>
+    TimeSpan GetBusyTime() const;
+
+    /// <summary>
+    /// Gets the number of tokens the stage can process per second, calculated as if all its threads spent their busy time in parallel.
+    /// </summary>
+    /// <remarks>
+    /// Comparing the throughput of all the stages shows which one limits the pipeline.
+    /// </remarks>
+    /// <returns>
+    /// The number of tokens per second. Zero if the stage did not spend any measurable time.
+    /// </returns>
+    float_z GetThroughput() const;
+
+    /// <summary>
+    /// Gets the average number of tokens waiting in the input queue of the stage, sampled every time a thread of the stage extracted a token.
+    /// </summary>
+    /// <returns>
+    /// The average queue depth. Always zero for the first stage, which has no input queue.
+    /// </returns>
+    float_z GetAverageQueueDepth() const;
+
+    /// <summary>
+    /// Gets the maximum number of tokens found waiting in the input queue of the stage.
+    /// </summary>
+    /// <returns>
+    /// The maximum queue depth. Always zero for the first stage, which has no input queue.
+    /// </returns>
+    puint_z GetMaximumQueueDepth() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The number of tokens passed to the function of the stage.
+    /// </summary>
+    u64_z m_uProcessedCount;
+
+    /// <summary>
+    /// The number of tokens for which the function of the stage returned null.
+    /// </summary>
+    u64_z m_uFilteredCount;
+
+    /// <summary>
+    /// The number of threads that executed the stage.
+    /// </summary>
+    u32_z m_uWorkerCount;
+
+    /// <summary>
+    /// The sum of the time spent by all the threads inside the function of the stage, in nanoseconds.
+    /// </summary>
+    u64_z m_uBusyNanoseconds;
+
+    /// <summary>
+    /// The sum of the number of tokens found in the input queue every time it was sampled.
+    /// </summary>
+    u64_z m_uQueueDepthSum;
+
+    /// <summary>
+    /// The number of times the input queue was sampled.
+    /// </summary>
+    u64_z m_uQueueDepthSampleCount;
+
+    /// <summary>
+    /// The maximum number of tokens found in the input queue.
+    /// </summary>
+    puint_z m_uQueueDepthMaximum;
+
+};
+
+} // namespace z
+
+
+#endif // __PIPELINESTAGESTATISTICS__
@@ -0,0 +1,200 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __PROCESSORSET__
+#define __PROCESSORSET__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/DataTypes/StringsDefinitions.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a set of logical processors, identified by the index the operating system gives to each of them.
+/// </summary>
+/// <remarks>
+/// It is used to describe the hardware topology (which processors share a core, a cache or a NUMA node) and the affinity of threads.<br/>
+/// It can store up to 1024 processors.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS ProcessorSet
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The maximum number of logical processors that can be stored. Processor indices must be lower than this value.
+    /// </summary>
+    static const u32_z MAXIMUM_PROCESSORS = 1024U;
+
+    /// <summary>
+    /// Value returned when a processor is not found.
+    /// </summary>
+    static const u32_z NO_PROCESSOR = -1;
+
+protected:
+
+    /// <summary>
+    /// The number of processors stored in every element of the array of masks.
+    /// </summary>
+    static const u32_z PROCESSORS_PER_MASK = 64U;
+
+    /// <summary>
+    /// The number of elements of the array of masks.
+    /// </summary>
+    static const u32_z MASKS_COUNT = MAXIMUM_PROCESSORS / PROCESSORS_PER_MASK;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor that creates an empty set.
+    /// </summary>
+    ProcessorSet();
+
+    /// <summary>
+    /// Constructor that creates a set that contains only one processor.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the processor. It must be lower than MAXIMUM_PROCESSORS.</param>
+    explicit ProcessorSet(const u32_z uProcessor);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Equality operator.
+    /// </summary>
+    /// <param name="processorSet">[IN] The other set.</param>
+    /// <returns>
+    /// True if both sets contain the same processors; False otherwise.
+    /// </returns>
+    bool operator==(const ProcessorSet &processorSet) const;
+
+    /// <summary>
+    /// Inequality operator.
+    /// </summary>
+    /// <param name="processorSet">[IN] The other set.</param>
+    /// <returns>
+    /// True if the sets do not contain the same processors; False otherwise.
+    /// </returns>
+    bool operator!=(const ProcessorSet &processorSet) const;
+
+    /// <summary>
+    /// Adds a processor to the set. Nothing happens if it is already in the set.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the processor. It must be lower than MAXIMUM_PROCESSORS.</param>
+    void Add(const u32_z uProcessor);
+
+    /// <summary>
+    /// Adds all the processors of another set to the set.
+    /// </summary>
+    /// <param name="processorSet">[IN] The set whose processors will be added.</param>
+    void Add(const ProcessorSet &processorSet);
+
+    /// <summary>
+    /// Removes a processor from the set. Nothing happens if it is not in the set.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the processor. It must be lower than MAXIMUM_PROCESSORS.</param>
+    void Remove(const u32_z uProcessor);
+
+    /// <summary>
+    /// Removes all the processors from the set.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Checks whether a processor is in the set.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the processor. It must be lower than MAXIMUM_PROCESSORS.</param>
+    /// <returns>
+    /// True if the processor is in the set; False otherwise.
+    /// </returns>
+    bool Contains(const u32_z uProcessor) const;
+
+    /// <summary>
+    /// Gets the first processor of the set whose index is greater than or equal to a given index.
+    /// </summary>
+    /// <remarks>
+    /// It can be used to traverse the set: for(u32_z i = set.GetNext(0); i != ProcessorSet::NO_PROCESSOR; i = set.GetNext(i + 1U)).
+    /// </remarks>
+    /// <param name="uProcessor">[IN] The index from which to search.</param>
+    /// <returns>
+    /// The index of the processor found, or NO_PROCESSOR if there are no more processors in the set.
+    /// </returns>
+    u32_z GetNext(const u32_z uProcessor) const;
+
+    /// <summary>
+    /// Gets a text representation of the set, which is a list of indices and ranges of indices separated by commas (for example, "0-3,8,10-11").
+    /// </summary>
+    /// <returns>
+    /// The text representation of the set. It is empty if the set is empty.
+    /// </returns>
+    string_z ToString() const;
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of processors in the set.
+    /// </summary>
+    /// <returns>
+    /// The number of processors.
+    /// </returns>
+    u32_z GetCount() const;
+
+    /// <summary>
+    /// Indicates whether the set is empty.
+    /// </summary>
+    /// <returns>
+    /// True if the set does not contain any processor; False otherwise.
+    /// </returns>
+    bool IsEmpty() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Bit masks where every bit indicates whether the processor with the same index is in the set.
+    /// </summary>
+    u64_z m_arMasks[MASKS_COUNT];
+
+};
+
+} // namespace z
+
+
+#endif // __PROCESSORSET__
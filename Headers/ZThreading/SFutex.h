@@ -0,0 +1,143 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __SFUTEX__
+#define __SFUTEX__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZTime/TimeSpan.h"
+#include <boost/atomic.hpp>
+
+
+namespace z
+{
+
+/// <summary>
+/// Provides the means to put threads to sleep until the value of a 32-bits integer in memory changes, and to wake them up, without any other 
+/// synchronization object. It is the building block of the synchronization primitives of the library.
+/// </summary>
+/// <remarks>
+/// On Linux, it uses the futex system call (private to the process). On Windows, it uses WaitOnAddress and WakeByAddressSingle / WakeByAddressAll (Windows 8 or later). 
+/// On Mac, where there is no public equivalent, waiting threads just yield, so waits degrade to a spin loop.<br/>
+/// Waits may end spuriously, callers must check the value again.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS SFutex
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The maximum number of times a thread checks a contended synchronization object, pausing between checks, before it goes to sleep.
+    /// </summary>
+    static const u32_z MAXIMUM_SPIN_COUNT = 100U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SFutex();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Puts the calling thread to sleep if an integer has an expected value, until another thread calls WakeOne or WakeAll on the same integer.
+    /// </summary>
+    /// <remarks>
+    /// The comparison and the start of the sleep are atomic with respect to WakeOne and WakeAll, so a change followed by a wake-up cannot be missed.
+    /// </remarks>
+    /// <param name="uValue">[IN] The integer to watch.</param>
+    /// <param name="uExpectedValue">[IN] The value the integer must have for the thread to sleep. If it is different, the method returns immediately.</param>
+    static void Wait(const boost::atomic<u32_z> &uValue, const u32_z uExpectedValue);
+
+    /// <summary>
+    /// Puts the calling thread to sleep if an integer has an expected value, until another thread calls WakeOne or WakeAll on the same integer or 
+    /// a maximum time elapses.
+    /// </summary>
+    /// <remarks>
+    /// The comparison and the start of the sleep are atomic with respect to WakeOne and WakeAll, so a change followed by a wake-up cannot be missed.<br/>
+    /// On Mac, the thread yields once and the method returns True.
+    /// </remarks>
+    /// <param name="uValue">[IN] The integer to watch.</param>
+    /// <param name="uExpectedValue">[IN] The value the integer must have for the thread to sleep. If it is different, the method returns immediately.</param>
+    /// <param name="timeout">[IN] The maximum time to sleep.</param>
+    /// <returns>
+    /// False if the maximum time elapsed; True otherwise.
+    /// </returns>
+    static bool Wait(const boost::atomic<u32_z> &uValue, const u32_z uExpectedValue, const TimeSpan &timeout);
+
+    /// <summary>
+    /// Wakes up one of the threads that sleep on an integer, if any.
+    /// </summary>
+    /// <param name="uValue">[IN] The integer threads sleep on.</param>
+    static void WakeOne(boost::atomic<u32_z> &uValue);
+
+    /// <summary>
+    /// Wakes up all the threads that sleep on an integer, if any.
+    /// </summary>
+    /// <param name="uValue">[IN] The integer threads sleep on.</param>
+    static void WakeAll(boost::atomic<u32_z> &uValue);
+
+private:
+
+    /// <summary>
+    /// Gets the address of the integer stored in an atomic object, as expected by the operating system.
+    /// </summary>
+    /// <param name="uValue">[IN] The atomic object.</param>
+    /// <returns>
+    /// The address of the integer.
+    /// </returns>
+    static u32_z* _GetAddress(const boost::atomic<u32_z> &uValue);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of times a thread should check a contended synchronization object before it goes to sleep.
+    /// </summary>
+    /// <remarks>
+    /// Spinning is useless when there is only one logical processor, since the owner of the object cannot run meanwhile.
+    /// </remarks>
+    /// <returns>
+    /// MAXIMUM_SPIN_COUNT if the machine has more than one logical processor; zero otherwise.
+    /// </returns>
+    static u32_z GetSpinCount();
+
+};
+
+} // namespace z
+
+
+#endif // __SFUTEX__
@@ -0,0 +1,321 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __SLOCKSTATISTICS__
+#define __SLOCKSTATISTICS__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Delegate.h"
+#include "ZThreading/LockStatistics.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/SharedMutex.h"
+#include <boost/atomic.hpp>
+#include <boost/thread/tss.hpp>
+
+
+namespace z
+{
+
+/// <summary>
+/// Collects the statistics of contention recorded by Mutex and SharedMutex, which include the instances wrapped by ScopedExclusiveLock and ScopedSharedLock, 
+/// and exposes them per lock name.
+/// </summary>
+/// <remarks>
+/// Statistics are only recorded when the library is compiled with Z_CONFIG_LOCKSTATISTICS_DEFAULT set to Z_CONFIG_LOCKSTATISTICS_ENABLED; otherwise, 
+/// locks do not record anything and there are no names.<br/>
+/// Locks are grouped by the name passed to their constructor, so all the locks that protect the same kind of resource add up their statistics. Locks 
+/// created without a name are grouped under "Mutex" or "SharedMutex". Once MAXIMUM_LOCK_NAMES different names have been used, locks with new names are not tracked.<br/>
+/// Every thread has its own set of counters, which only that thread modifies, so recording does not require any atomic read-modify-write operation nor 
+/// shares cache lines among threads. The counters of a thread that ends are reused by the next thread that needs them, so their values are not lost. Reading 
+/// the statistics adds up the counters of all the threads; values recorded at the same time may or may not be included.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS SLockStatistics
+{
+    friend class Mutex::FutexMutex;
+    friend class SharedMutex::FutexSharedMutex;
+
+
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The maximum number of different lock names.
+    /// </summary>
+    static const u32_z MAXIMUM_LOCK_NAMES = 128U;
+
+private:
+
+    /// <summary>
+    /// The index assigned to locks whose statistics are not recorded. It is zero so locks that are used before being constructed, which may happen 
+    /// to static objects while the process starts, are not tracked; the indices of the lock names start at 1.
+    /// </summary>
+    static const u32_z UNTRACKED_LOCK = 0;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The counters of a lock name in a thread. Only the owner thread modifies them, while any thread may read them.
+    /// </summary>
+    class LockCounters
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor. All the counters are zero.
+        /// </summary>
+        LockCounters();
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The number of acquisitions.
+        /// </summary>
+        boost::atomic<u64_z> m_uAcquisitionCount;
+
+        /// <summary>
+        /// The number of acquisitions that had to wait.
+        /// </summary>
+        boost::atomic<u64_z> m_uContendedAcquisitionCount;
+
+        /// <summary>
+        /// The sum of the time spent waiting in contended acquisitions, in nanoseconds.
+        /// </summary>
+        boost::atomic<u64_z> m_uWaitNanoseconds;
+
+        /// <summary>
+        /// The number of exclusive holds that were measured.
+        /// </summary>
+        boost::atomic<u64_z> m_uHoldCount;
+
+        /// <summary>
+        /// The sum of the time locks were held in exclusive mode, in nanoseconds.
+        /// </summary>
+        boost::atomic<u64_z> m_uHoldNanoseconds;
+
+        /// <summary>
+        /// The histogram of wait times.
+        /// </summary>
+        boost::atomic<u64_z> m_arWaitTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT];
+
+        /// <summary>
+        /// The histogram of hold times.
+        /// </summary>
+        boost::atomic<u64_z> m_arHoldTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT];
+    };
+
+    /// <summary>
+    /// The counters of all the lock names used by a thread. The counters of every name are created the first time the thread uses a lock with that name.
+    /// </summary>
+    class ThreadCounters
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor. There are no counters.
+        /// </summary>
+        ThreadCounters();
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The counters of every lock name, or null if the thread has not used it.
+        /// </summary>
+        boost::atomic<LockCounters*> m_arLockCounters[MAXIMUM_LOCK_NAMES];
+
+        /// <summary>
+        /// The next set of counters in the list of all the sets.
+        /// </summary>
+        ThreadCounters* m_pNext;
+
+        /// <summary>
+        /// The next set of counters in the list of sets that no thread is using.
+        /// </summary>
+        ThreadCounters* m_pNextFree;
+    };
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SLockStatistics();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Writes the statistics of every lock name through SInternalLogger, one line per name (see LockStatistics::ToString).
+    /// </summary>
+    static void Dump();
+
+    /// <summary>
+    /// Passes the statistics of every lock name to a function, so they can be exported in any format.
+    /// </summary>
+    /// <param name="exporter">[IN] The function that receives the statistics of every lock name.</param>
+    static void Dump(const Delegate<void (const LockStatistics&)> &exporter);
+
+private:
+
+    /// <summary>
+    /// Gets the index of a lock name, registering it the first time it is used.
+    /// </summary>
+    /// <param name="szName">[IN] The name of the lock. It must remain valid during the life of the process, like a string literal. If it is null, 
+    /// the lock is not tracked.</param>
+    /// <returns>
+    /// The index of the name plus one, or UNTRACKED_LOCK if the name is null or the maximum number of names was reached.
+    /// </returns>
+    static u32_z _RegisterLock(const char* szName);
+
+    /// <summary>
+    /// Records an acquisition of a lock in the counters of the calling thread.
+    /// </summary>
+    /// <param name="uLockIndex">[IN] The index of the name of the lock plus one. It must not be UNTRACKED_LOCK.</param>
+    /// <param name="bIsContended">[IN] Whether the thread had to wait for another thread to release the lock.</param>
+    /// <param name="uWaitNanoseconds">[IN] The time spent waiting, in nanoseconds. It is ignored if the acquisition was not contended.</param>
+    static void _RecordAcquisition(const u32_z uLockIndex, const bool bIsContended, const u64_z uWaitNanoseconds);
+
+    /// <summary>
+    /// Records the release of a lock that was acquired in exclusive mode in the counters of the calling thread.
+    /// </summary>
+    /// <param name="uLockIndex">[IN] The index of the name of the lock plus one. It must not be UNTRACKED_LOCK.</param>
+    /// <param name="uHoldNanoseconds">[IN] The time the lock was held, in nanoseconds.</param>
+    static void _RecordHold(const u32_z uLockIndex, const u64_z uHoldNanoseconds);
+
+    /// <summary>
+    /// Releases the counters of a thread that ends so another thread can use them.
+    /// </summary>
+    /// <param name="pThreadCounters">[IN] The counters of the thread.</param>
+    static void _ReleaseThreadCounters(ThreadCounters* pThreadCounters);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Indicates whether locks record statistics, which depends on the configuration the library was compiled with.
+    /// </summary>
+    /// <returns>
+    /// True if statistics are recorded; False otherwise.
+    /// </returns>
+    static bool IsEnabled();
+
+    /// <summary>
+    /// Gets the number of different lock names used so far.
+    /// </summary>
+    /// <returns>
+    /// The number of lock names.
+    /// </returns>
+    static u32_z GetLockNameCount();
+
+    /// <summary>
+    /// Gets the statistics of all the locks with a name, added up for all the threads.
+    /// </summary>
+    /// <param name="uLockName">[IN] The index of the name, in the order the names were used for the first time. It must be lower than the number of lock names.</param>
+    /// <returns>
+    /// The statistics.
+    /// </returns>
+    static LockStatistics GetStatistics(const u32_z uLockName);
+
+    /// <summary>
+    /// Gets the statistics of all the locks with a name, added up for all the threads.
+    /// </summary>
+    /// <param name="szName">[IN] The name of the locks.</param>
+    /// <returns>
+    /// The statistics. All of them are zero if the name was never used.
+    /// </returns>
+    static LockStatistics GetStatistics(const char* szName);
+
+private:
+
+    /// <summary>
+    /// Gets the counters of a lock name in the calling thread, creating them if necessary.
+    /// </summary>
+    /// <param name="uLockIndex">[IN] The index of the name plus one.</param>
+    /// <returns>
+    /// The counters.
+    /// </returns>
+    static LockCounters& _GetLockCounters(const u32_z uLockIndex);
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The lock names, in the order they were registered.
+    /// </summary>
+    static const char* sm_arLockNames[MAXIMUM_LOCK_NAMES];
+
+    /// <summary>
+    /// The number of registered lock names.
+    /// </summary>
+    static u32_z sm_uLockNameCount;
+
+    /// <summary>
+    /// The first element of the list of all the sets of counters ever created.
+    /// </summary>
+    static ThreadCounters* sm_pFirstThreadCounters;
+
+    /// <summary>
+    /// The first element of the list of sets of counters that no thread is using.
+    /// </summary>
+    static ThreadCounters* sm_pFirstFreeThreadCounters;
+
+    /// <summary>
+    /// The mutex that protects the names and the lists of counters. It is not tracked.
+    /// </summary>
+    static Mutex::FutexMutex sm_mutex;
+
+    /// <summary>
+    /// The set of counters used by every thread.
+    /// </summary>
+    static boost::thread_specific_ptr<ThreadCounters> sm_pThreadCounters;
+};
+
+} // namespace z
+
+
+#endif // __SLOCKSTATISTICS__
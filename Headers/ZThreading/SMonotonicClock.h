@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __SMONOTONICCLOCK__
+#define __SMONOTONICCLOCK__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Provides the current instant of a monotonic clock, which is not affected by changes of the system time, to measure time intervals in the 
+/// synchronization primitives and the statistics of the threading module.
+/// </summary>
+/// <remarks>
+/// On Linux, it uses clock_gettime with CLOCK_MONOTONIC, which is served by the vDSO. On Windows, it uses QueryPerformanceCounter. On Mac, it uses mach_absolute_time.
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS SMonotonicClock
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SMonotonicClock();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the current instant.
+    /// </summary>
+    /// <returns>
+    /// The current instant, in nanoseconds since an unspecified moment.
+    /// </returns>
+    static u64_z GetNanoseconds();
+
+};
+
+} // namespace z
+
+
+#endif // __SMONOTONICCLOCK__
@@ -0,0 +1,302 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SPROCESSORTOPOLOGY__
+#define __SPROCESSORTOPOLOGY__
+
+#include "ZThreading/ThreadingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZThreading/ProcessorSet.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Describes how the logical processors of the machine are organized: which of them belong to the same physical core (SMT siblings), 
+/// which share the same L2 or L3 cache, which are in the same package (socket) and which are attached to the same NUMA node.
+/// </summary>
+/// <remarks>
+/// The topology is discovered the first time any method is called and does not change afterwards.<br/>
+/// On Linux, it is read from sysfs (/sys/devices/system/cpu and /sys/devices/system/node). On Windows, it is obtained from GetLogicalProcessorInformationEx, 
+/// and only the first processor group (up to 64 processors) is taken into account. On Mac, only the number of processors and cores is known; 
+/// all the processors are considered to be in the same package and NUMA node, sharing the same caches.<br/>
+/// Processors are identified by the index the operating system gives to each of them, which is the same used in affinity masks (see Thread::SetAffinity).
+/// </remarks>
+class Z_THREADING_MODULE_SYMBOLS SProcessorTopology
+{
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The position of a logical processor in the topology.
+    /// </summary>
+    class ProcessorInfo
+    {
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The index of the physical core, unique in the machine.
+        /// </summary>
+        u32_z m_uCore;
+
+        /// <summary>
+        /// The index of the package (socket).
+        /// </summary>
+        u32_z m_uPackage;
+
+        /// <summary>
+        /// The index of the NUMA node.
+        /// </summary>
+        u32_z m_uNumaNode;
+
+        /// <summary>
+        /// An identifier of the L2 cache, shared by all the processors that use the same cache. It is the index of the first of those processors.
+        /// </summary>
+        u32_z m_uL2Cache;
+
+        /// <summary>
+        /// An identifier of the L3 cache, shared by all the processors that use the same cache. It is the index of the first of those processors.
+        /// </summary>
+        u32_z m_uL3Cache;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Value used when a processor does not have a cache of a given level.
+    /// </summary>
+    static const u32_z NO_CACHE = -1;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SProcessorTopology();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the physical core a logical processor belongs to.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the logical processor. It must be lower than the number of logical processors.</param>
+    /// <returns>
+    /// The index of the core, from zero to the number of cores minus one.
+    /// </returns>
+    static u32_z GetCore(const u32_z uProcessor);
+
+    /// <summary>
+    /// Gets the package (socket) a logical processor belongs to.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the logical processor. It must be lower than the number of logical processors.</param>
+    /// <returns>
+    /// The index of the package, from zero to the number of packages minus one.
+    /// </returns>
+    static u32_z GetPackage(const u32_z uProcessor);
+
+    /// <summary>
+    /// Gets the NUMA node a logical processor is attached to.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the logical processor. It must be lower than the number of logical processors.</param>
+    /// <returns>
+    /// The index of the NUMA node, as the operating system identifies it.
+    /// </returns>
+    static u32_z GetNumaNode(const u32_z uProcessor);
+
+    /// <summary>
+    /// Gets the logical processors that belong to the same physical core as a given processor (SMT siblings), including itself.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the logical processor. It must be lower than the number of logical processors.</param>
+    /// <returns>
+    /// The set of logical processors of the core.
+    /// </returns>
+    static ProcessorSet GetSmtSiblings(const u32_z uProcessor);
+
+    /// <summary>
+    /// Gets the logical processors that share a cache of a given level with a given processor, including itself.
+    /// </summary>
+    /// <param name="uProcessor">[IN] The index of the logical processor. It must be lower than the number of logical processors.</param>
+    /// <param name="uCacheLevel">[IN] The level of the cache. It must be 2 or 3.</param>
+    /// <returns>
+    /// The set of logical processors that share the cache. If the processor does not have a cache of that level, the set contains only the processor.
+    /// </returns>
+    static ProcessorSet GetProcessorsSharingCache(const u32_z uProcessor, const u32_z uCacheLevel);
+
+    /// <summary>
+    /// Gets the logical processors that belong to a package (socket).
+    /// </summary>
+    /// <param name="uPackage">[IN] The index of the package.</param>
+    /// <returns>
+    /// The set of logical processors of the package. It is empty if the package does not exist.
+    /// </returns>
+    static ProcessorSet GetPackageProcessors(const u32_z uPackage);
+
+    /// <summary>
+    /// Gets the logical processors attached to a NUMA node.
+    /// </summary>
+    /// <param name="uNumaNode">[IN] The index of the NUMA node.</param>
+    /// <returns>
+    /// The set of logical processors of the node. It is empty if the node does not exist or has no processors.
+    /// </returns>
+    static ProcessorSet GetNumaNodeProcessors(const u32_z uNumaNode);
+
+    /// <summary>
+    /// Gets all the logical processors of the machine.
+    /// </summary>
+    /// <returns>
+    /// The set of all the logical processors.
+    /// </returns>
+    static ProcessorSet GetAllProcessors();
+
+private:
+
+    /// <summary>
+    /// Gets the information about all the logical processors, discovering the topology the first time it is called.
+    /// </summary>
+    /// <returns>
+    /// An array with as many elements as logical processors.
+    /// </returns>
+    static const ProcessorInfo* _GetProcessors();
+
+    /// <summary>
+    /// Discovers the topology of the machine and stores the result in the static attributes.
+    /// </summary>
+    /// <returns>
+    /// Always True. It is used to initialize a constant only once.
+    /// </returns>
+    static bool _DiscoverTopology();
+
+#if defined(Z_OS_LINUX)
+
+    /// <summary>
+    /// Reads a non-negative integer number from a file.
+    /// </summary>
+    /// <param name="szPath">[IN] The path to the file.</param>
+    /// <param name="uDefaultValue">[IN] The value to return if the file cannot be read.</param>
+    /// <returns>
+    /// The number read from the file, or the default value.
+    /// </returns>
+    static u32_z _ReadNumber(const char* szPath, const u32_z uDefaultValue);
+
+    /// <summary>
+    /// Reads a list of processors, with the format used by sysfs (for example, "0-3,8,10-11"), from a file.
+    /// </summary>
+    /// <param name="szPath">[IN] The path to the file.</param>
+    /// <param name="processors">[OUT] The set where the processors will be added.</param>
+    /// <returns>
+    /// True if the file could be read; False otherwise.
+    /// </returns>
+    static bool _ReadProcessorList(const char* szPath, ProcessorSet &processors);
+
+#endif
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of logical processors of the machine.
+    /// </summary>
+    /// <returns>
+    /// The number of logical processors. It is never zero.
+    /// </returns>
+    static u32_z GetLogicalProcessorCount();
+
+    /// <summary>
+    /// Gets the number of physical cores of the machine.
+    /// </summary>
+    /// <returns>
+    /// The number of cores. It is never zero.
+    /// </returns>
+    static u32_z GetCoreCount();
+
+    /// <summary>
+    /// Gets the number of packages (sockets) of the machine.
+    /// </summary>
+    /// <returns>
+    /// The number of packages. It is never zero.
+    /// </returns>
+    static u32_z GetPackageCount();
+
+    /// <summary>
+    /// Gets the number of NUMA nodes of the machine.
+    /// </summary>
+    /// <remarks>
+    /// It is the highest node index plus one, so there may be nodes without processors.
+    /// </remarks>
+    /// <returns>
+    /// The number of NUMA nodes. It is never zero.
+    /// </returns>
+    static u32_z GetNumaNodeCount();
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The information about every logical processor.
+    /// </summary>
+    static ProcessorInfo sm_arProcessors[ProcessorSet::MAXIMUM_PROCESSORS];
+
+    /// <summary>
+    /// The number of logical processors.
+    /// </summary>
+    static u32_z sm_uProcessorCount;
+
+    /// <summary>
+    /// The number of physical cores.
+    /// </summary>
+    static u32_z sm_uCoreCount;
+
+    /// <summary>
+    /// The number of packages.
+    /// </summary>
+    static u32_z sm_uPackageCount;
+
+    /// <summary>
+    /// The number of NUMA nodes.
+    /// </summary>
+    static u32_z sm_uNumaNodeCount;
+
+};
+
+} // namespace z
+
+
+#endif // __SPROCESSORTOPOLOGY__
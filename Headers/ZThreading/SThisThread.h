@@ -33,6 +33,9 @@
 #include "ZTime/TimeSpan.h"
 #include "ZCommon/Delegate.h"
 #include "ZThreading/EThreadPriority.h"
+#include "ZThreading/ProcessorSet.h"
+#include "ZMemory/ScratchAllocator.h"
+#include <boost/thread/tss.hpp>
 
 #if defined(Z_OS_WINDOWS)
     #include <Windows.h>
@@ -70,6 +73,15 @@ public:
     /// </summary>
     static void Yield();
     
+    /// <summary>
+    /// Tells the processor that the calling thread is spinning while it waits for a value to change in memory, so it can save power and 
+    /// resources for another hardware thread in the same core.
+    /// </summary>
+    /// <remarks>
+    /// Unlike Yield, the thread is not descheduled; it only lasts a few dozens of cycles. It does nothing if the processor does not provide such hint.
+    /// </remarks>
+    static void Pause();
+    
     /// <summary>
     /// Suspends the calling thread for a given amount of time.
     /// </summary>
@@ -185,6 +197,65 @@ public:
     /// </remarks>
     /// <param name="ePriority">[IN] The new priority of the thread.</param>
     static void SetPriority(const EThreadPriority &ePriority);
+
+    /// <summary>
+    /// Gets the set of logical processors the calling thread is allowed to run on.
+    /// </summary>
+    /// <remarks>
+    /// On Mac, thread affinity is not supported and all the processors are returned.
+    /// </remarks>
+    /// <returns>
+    /// The set of logical processors.
+    /// </returns>
+    static ProcessorSet GetAffinity();
+
+    /// <summary>
+    /// Restricts the logical processors the calling thread is allowed to run on, so the operating system does not move it to other processors.
+    /// </summary>
+    /// <remarks>
+    /// If the thread is not running on any of the processors, it is moved immediately.<br/>
+    /// On Windows, only the processors of the first processor group (up to 64) can be used. On Mac, thread affinity is not supported and it always fails.
+    /// </remarks>
+    /// <param name="processors">[IN] The set of logical processors. It must not be empty.</param>
+    /// <returns>
+    /// True if the affinity was changed; False otherwise (for example, if none of the processors exists).
+    /// </returns>
+    static bool SetAffinity(const ProcessorSet &processors);
+
+    /// <summary>
+    /// Gets the logical processor the calling thread is running on.
+    /// </summary>
+    /// <remarks>
+    /// The thread may be moved to another processor right after calling this method, unless its affinity is restricted to only one processor.<br/>
+    /// On Mac, it is not supported and zero is always returned.
+    /// </remarks>
+    /// <returns>
+    /// The index of the logical processor.
+    /// </returns>
+    static u32_z GetCurrentProcessor();
+
+    /// <summary>
+    /// Gets the scratch allocator of the calling thread, which can be used to allocate short-lived temporary memory blocks without using the heap.
+    /// </summary>
+    /// <remarks>
+    /// The allocator is created the first time this method is called by a thread, with a buffer of ScratchAllocator::DEFAULT_SIZE bytes, and it is 
+    /// destroyed when the thread ends. It must not be used by other threads.<br/>
+    /// Memory blocks should be allocated inside the scope of a ScopedScratchMark, so they are deallocated when the scope ends.
+    /// </remarks>
+    /// <returns>
+    /// The scratch allocator of the calling thread.
+    /// </returns>
+    static ScratchAllocator& GetScratchAllocator();
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The scratch allocator of every thread.
+    /// </summary>
+    static boost::thread_specific_ptr<ScratchAllocator> sm_pScratchAllocator;
 };
 
 } // namespace z
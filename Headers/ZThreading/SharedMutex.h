@@ -28,7 +28,9 @@
 #define __SHAREDMUTEX__
 
 #include "ZThreading/ThreadingModuleDefinitions.h"
-#include <boost/thread/shared_mutex.hpp>
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZThreading/Mutex.h"
+#include <boost/atomic.hpp>
 
 #ifdef Z_COMPILER_MSVC
     // This warning appears when instancing a template to create a data member and that template instance is not exported.
@@ -46,15 +48,259 @@ namespace z
 /// </summary>
 /// <remarks>
 /// This class is thread-safe.<br/>
-/// It is a wrapper for the shared_mutex class, from Boost libraries.
+/// It is implemented on top of SFutex and is optimized for resources that are read much more often than they are modified. Every logical processor 
+/// has its own counter of readers, in its own cache line, so threads that lock the mutex in shared mode at the same time on different processors do not 
+/// compete for the same memory; they never enter the kernel unless there is a thread that owns or waits for the mutex in exclusive mode. In exchange, 
+/// locking in exclusive mode is more expensive, since the counters of all the processors have to be checked.<br/>
+/// Threads that want to lock in exclusive mode have preference: new readers wait while there is one, so they cannot starve.<br/>
+/// When lock statistics are enabled in the configuration, every mutex records its acquisitions in both modes, contention and wait times under its name, 
+/// and hold times only when it is locked in exclusive mode (see SLockStatistics).
 /// </remarks>
 class Z_THREADING_MODULE_SYMBOLS SharedMutex
 {
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// A counter of readers that occupies a whole cache line.
+    /// </summary>
+    class ReaderCounter
+    {
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The number of readers that locked the mutex on the processor minus those that unlocked it on the same processor. It may overflow, 
+        /// since a thread may unlock the mutex on a different processor; only the sum of all the counters is meaningful.
+        /// </summary>
+        boost::atomic<u32_z> m_uCount;
+
+        /// <summary>
+        /// Fills the rest of the cache line.
+        /// </summary>
+        u8_z m_arPadding[Z_CACHE_LINE_SIZE - sizeof(boost::atomic<u32_z>)];
+    };
+
+public:
+
+    /// <summary>
+    /// The actual implementation of the shared mutex, whose interface fulfills the requirements of the SharedLockable concept of Boost libraries so it 
+    /// can be used by scoped locks and condition variables.
+    /// </summary>
+    class Z_THREADING_MODULE_SYMBOLS FutexSharedMutex
+    {
+        // CONSTANTS
+        // ---------------
+    protected:
+
+        /// <summary>
+        /// The maximum number of reader counters. Processors whose index is greater share the counters.
+        /// </summary>
+        static const u32_z MAXIMUM_READER_COUNTERS = 64U;
+
+
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Default constructor. The mutex is not locked and its statistics are not recorded.
+        /// </summary>
+        FutexSharedMutex();
+
+        /// <summary>
+        /// Constructor that receives the name under which the statistics of the mutex are recorded. The mutex is not locked.
+        /// </summary>
+        /// <param name="szName">[IN] The name of the mutex. It must remain valid during the life of the process, like a string literal. If it is null, 
+        /// the statistics of the mutex are not recorded.</param>
+        explicit FutexSharedMutex(const char* szName);
+
+    private:
+
+        // Hidden
+        FutexSharedMutex(const FutexSharedMutex&);
+
+
+        // DESTRUCTOR
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        ~FutexSharedMutex();
+
+
+        // METHODS
+        // ---------------
+    private:
+
+        // Hidden
+        FutexSharedMutex& operator=(const FutexSharedMutex&);
+
+    public:
+
+        /// <summary>
+        /// Locks the mutex in exclusive mode, waiting until no other thread owns it.
+        /// </summary>
+        void lock();
+
+        /// <summary>
+        /// Releases the mutex, locked in exclusive mode, and wakes up the readers that wait for it.
+        /// </summary>
+        void unlock();
+
+        /// <summary>
+        /// Locks the mutex in exclusive mode only if no other thread owns it.
+        /// </summary>
+        /// <returns>
+        /// True if the mutex has been locked by the calling thread; False otherwise.
+        /// </returns>
+        bool try_lock();
+
+        /// <summary>
+        /// Locks the mutex in shared mode, waiting until no thread owns it or waits for it in exclusive mode.
+        /// </summary>
+        void lock_shared();
+
+        /// <summary>
+        /// Releases the mutex, locked in shared mode.
+        /// </summary>
+        void unlock_shared();
+
+        /// <summary>
+        /// Locks the mutex in shared mode only if no thread owns it or waits for it in exclusive mode.
+        /// </summary>
+        /// <returns>
+        /// True if the mutex has been locked by the calling thread; False otherwise.
+        /// </returns>
+        bool try_lock_shared();
+
+    private:
+
+        /// <summary>
+        /// Unregisters a reader and, if there is a thread that waits for the mutex in exclusive mode, notifies it.
+        /// </summary>
+        /// <param name="counter">[IN/OUT] The counter to decrement.</param>
+        void _RemoveReader(ReaderCounter &counter);
+
+        /// <summary>
+        /// Spins and, eventually, sleeps until the thread that owns the mutex in exclusive mode releases it.
+        /// </summary>
+        void _WaitForWriter();
+
+        /// <summary>
+        /// Spins and, eventually, sleeps until all the readers release the mutex.
+        /// </summary>
+        void _WaitForReaders();
+
+        /// <summary>
+        /// Allocates and initializes the reader counters.
+        /// </summary>
+        void _CreateReaderCounters();
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+
+        /// <summary>
+        /// Stores the instant the mutex was acquired in exclusive mode and records the acquisition in the statistics, if the mutex is tracked.
+        /// </summary>
+        /// <param name="bIsContended">[IN] Whether the thread had to wait for other threads to release the mutex.</param>
+        /// <param name="uWaitStartInstant">[IN] The instant the thread started waiting, in nanoseconds. It is ignored if the acquisition was not contended.</param>
+        void _RecordExclusiveAcquisition(const bool bIsContended, const u64_z uWaitStartInstant);
+
+#endif
+
+
+        // PROPERTIES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// Gets the reader counter of the processor the calling thread is running on.
+        /// </summary>
+        /// <returns>
+        /// The counter.
+        /// </returns>
+        ReaderCounter& _GetReaderCounter();
+
+        /// <summary>
+        /// Calculates the number of readers that own the mutex, adding up all the counters.
+        /// </summary>
+        /// <returns>
+        /// The number of readers. It may include readers that are about to realize that they cannot own the mutex.
+        /// </returns>
+        u32_z _GetReaderCount() const;
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The counters of readers, one per processor.
+        /// </summary>
+        ReaderCounter* m_arReaderCounters;
+
+        /// <summary>
+        /// The number of reader counters minus one, a power of two minus one, used to calculate which counter corresponds to a processor.
+        /// </summary>
+        u32_z m_uReaderCounterMask;
+
+        /// <summary>
+        /// The mutex that writers lock so only one of them at a time registers itself in the writer state.
+        /// </summary>
+        Mutex::FutexMutex m_writerMutex;
+
+        /// <summary>
+        /// Whether a writer owns or waits for the mutex: 0 (no writer), 1 (there is a writer) or 2 (there is a writer and there may be sleeping readers).
+        /// </summary>
+        boost::atomic<u32_z> m_uWriterState;
+
+        /// <summary>
+        /// A number that readers increment when they release the mutex while there is a writer, so the writer wakes up.
+        /// </summary>
+        boost::atomic<u32_z> m_uReaderExitSequence;
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+
+        /// <summary>
+        /// The index of the name of the mutex in SLockStatistics, or SLockStatistics::UNTRACKED_LOCK if its statistics are not recorded.
+        /// </summary>
+        u32_z m_uLockIndex;
+
+        /// <summary>
+        /// The instant the mutex was acquired in exclusive mode by its current owner, in nanoseconds.
+        /// </summary>
+        u64_z m_uAcquisitionInstant;
+
+#endif
+    };
+
+
     // TYPEDEFS
     // ---------------
 public:
 
-    typedef boost::shared_mutex WrappedType;
+    typedef FutexSharedMutex WrappedType;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor. Its statistics are recorded under the name "SharedMutex".
+    /// </summary>
+    SharedMutex();
+
+    /// <summary>
+    /// Constructor that receives the name under which the statistics of the mutex are recorded, so it can be told apart from other mutexes.
+    /// </summary>
+    /// <param name="szName">[IN] The name of the mutex. It must remain valid during the life of the process, like a string literal. If it is null, 
+    /// the statistics of the mutex are not recorded.</param>
+    explicit SharedMutex(const char* szName);
 
 
     // DESTRUCTOR
@@ -77,8 +323,7 @@ public:
     /// can execute the same code until Unlock is called.
     /// </summary>
     /// <remarks>
-    /// If the mutex is locked by a thread which is killed before calling Unlock, its state depends on the operating system. On Windows, it will stay in an special state until it is locked and unlocked again;
-    /// on Unix-based systems (using POSIX threads), the mutex ends up with an undefined state and it is not safe to try to lock it again. Either way, take into account that the resource protected by the mutex may 
+    /// If the mutex is locked by a thread which is killed before calling Unlock, it remains locked forever. Take into account that the resource protected by the mutex may 
     /// be in an inconsistent state when this happen.
     /// </remarks>
     void Lock();
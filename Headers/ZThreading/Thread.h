@@ -31,6 +31,7 @@
 #include "ZCommon/Delegate.h"
 #include "ZTime/TimeSpan.h"
 #include "ZThreading/EThreadPriority.h"
+#include "ZThreading/ProcessorSet.h"
 #include <boost/thread/thread.hpp>
 
 #ifdef Z_COMPILER_MSVC
@@ -54,6 +55,8 @@ namespace z
 /// </remarks>
 class Z_THREADING_MODULE_SYMBOLS Thread
 {
+    friend class SThisThread; // It uses the same functions to manage the affinity of the calling thread
+
     // TYPEDEFS
     // ---------------
 public:
@@ -464,6 +467,25 @@ private:
 
 #endif
 
+    /// <summary>
+    /// Gets the set of logical processors a thread is allowed to run on.
+    /// </summary>
+    /// <param name="handle">[IN] The native handle of the thread.</param>
+    /// <returns>
+    /// The set of logical processors. On Mac, it always contains all the processors.
+    /// </returns>
+    static ProcessorSet _GetAffinity(const Thread::NativeThreadHandle &handle);
+
+    /// <summary>
+    /// Restricts the logical processors a thread is allowed to run on.
+    /// </summary>
+    /// <param name="handle">[IN] The native handle of the thread.</param>
+    /// <param name="processors">[IN] The set of logical processors.</param>
+    /// <returns>
+    /// True if the affinity was changed; False otherwise.
+    /// </returns>
+    static bool _SetAffinity(const Thread::NativeThreadHandle &handle, const ProcessorSet &processors);
+
 
     // PROPERTIES
     // ---------------
@@ -529,6 +551,30 @@ public:
     /// <param name="ePriority">[IN] The new priority of the thread.</param>
     void SetPriority(const EThreadPriority &ePriority);
 
+    /// <summary>
+    /// Gets the set of logical processors the thread is allowed to run on.
+    /// </summary>
+    /// <remarks>
+    /// On Mac, thread affinity is not supported and all the processors are returned.
+    /// </remarks>
+    /// <returns>
+    /// The set of logical processors.
+    /// </returns>
+    ProcessorSet GetAffinity() const;
+
+    /// <summary>
+    /// Restricts the logical processors the thread is allowed to run on, so the operating system does not move it to other processors.
+    /// </summary>
+    /// <remarks>
+    /// Pinning a thread to the processors of a core, a cache or a NUMA node (see SProcessorTopology) keeps its data in the same caches and memory.<br/>
+    /// On Windows, only the processors of the first processor group (up to 64) can be used. On Mac, thread affinity is not supported and it always fails.
+    /// </remarks>
+    /// <param name="processors">[IN] The set of logical processors. It must not be empty.</param>
+    /// <returns>
+    /// True if the affinity was changed; False otherwise (for example, if none of the processors exists).
+    /// </returns>
+    bool SetAffinity(const ProcessorSet &processors);
+
 
     // ATTRIBUTES
     // ---------------
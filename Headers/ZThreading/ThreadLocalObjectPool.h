@@ -0,0 +1,185 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __THREADLOCALOBJECTPOOL__
+#define __THREADLOCALOBJECTPOOL__
+
+#include <boost/thread/tss.hpp>
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZMemory/ObjectPool.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// Represents a set of object pools, one per thread, from which threads can borrow and return objects without allocating memory in the heap 
+/// and without synchronization.
+/// </summary>
+/// <remarks>
+/// The pool of a thread is created the first time the thread uses it and destroyed when the thread ends.<br/>
+/// Objects must be returned by the same thread that borrowed them, before it ends.<br/>
+/// This class is thread-safe.
+/// </remarks>
+/// <typeparam name="T">The type of the objects.</typeparam>
+template<class T>
+class ThreadLocalObjectPool
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the number of objects that fit in the pool of every thread.
+    /// </summary>
+    /// <param name="uCapacityPerThread">[IN] The maximum number of objects that every thread can borrow at the same time without allocating memory 
+    /// in the heap. It must be greater than zero.</param>
+    explicit ThreadLocalObjectPool(const puint_z uCapacityPerThread) : m_uCapacityPerThread(uCapacityPerThread)
+    {
+    }
+
+private:
+
+    // Hidden
+    ThreadLocalObjectPool(const ThreadLocalObjectPool&);
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    ThreadLocalObjectPool& operator=(const ThreadLocalObjectPool&);
+
+public:
+
+    /// <summary>
+    /// Borrows an object constructed with its default constructor from the pool of the calling thread.
+    /// </summary>
+    /// <returns>
+    /// The borrowed object. It is never null.
+    /// </returns>
+    T* Borrow()
+    {
+        return this->GetThreadPool().Borrow();
+    }
+
+    /// <summary>
+    /// Borrows an object constructed with a constructor that receives one parameter from the pool of the calling thread.
+    /// </summary>
+    /// <typeparam name="P1">The type of the parameter of the constructor.</typeparam>
+    /// <param name="p1">[IN] The parameter passed to the constructor.</param>
+    /// <returns>
+    /// The borrowed object. It is never null.
+    /// </returns>
+    template<class P1>
+    T* Borrow(const P1 &p1)
+    {
+        return this->GetThreadPool().Borrow(p1);
+    }
+
+    /// <summary>
+    /// Borrows an object constructed with a constructor that receives two parameters from the pool of the calling thread.
+    /// </summary>
+    /// <typeparam name="P1">The type of the first parameter of the constructor.</typeparam>
+    /// <typeparam name="P2">The type of the second parameter of the constructor.</typeparam>
+    /// <param name="p1">[IN] The first parameter passed to the constructor.</param>
+    /// <param name="p2">[IN] The second parameter passed to the constructor.</param>
+    /// <returns>
+    /// The borrowed object. It is never null.
+    /// </returns>
+    template<class P1, class P2>
+    T* Borrow(const P1 &p1, const P2 &p2)
+    {
+        return this->GetThreadPool().Borrow(p1, p2);
+    }
+
+    /// <summary>
+    /// Returns an object to the pool of the calling thread, destroying it.
+    /// </summary>
+    /// <param name="pObject">[IN] An object borrowed by the calling thread. It must not be null.</param>
+    void Return(T* pObject)
+    {
+        this->GetThreadPool().Return(pObject);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the pool of the calling thread, creating it if it does not exist yet.
+    /// </summary>
+    /// <returns>
+    /// The pool of the calling thread. It must not be used by other threads.
+    /// </returns>
+    ObjectPool<T>& GetThreadPool()
+    {
+        ObjectPool<T>* pPool = m_pThreadPool.get();
+
+        if(pPool == null_z)
+        {
+            pPool = new ObjectPool<T>(m_uCapacityPerThread);
+            m_pThreadPool.reset(pPool);
+        }
+
+        return *pPool;
+    }
+
+    /// <summary>
+    /// Gets the number of objects that fit in the pool of every thread.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the pool of every thread.
+    /// </returns>
+    puint_z GetCapacityPerThread() const
+    {
+        return m_uCapacityPerThread;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The pool of every thread.
+    /// </summary>
+    boost::thread_specific_ptr< ObjectPool<T> > m_pThreadPool;
+
+    /// <summary>
+    /// The number of objects that fit in the pool of every thread.
+    /// </summary>
+    const puint_z m_uCapacityPerThread;
+
+};
+
+} // namespace z
+
+
+#endif // __THREADLOCALOBJECTPOOL__
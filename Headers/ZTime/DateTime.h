@@ -53,6 +53,8 @@ class TimeZone;
 /// </remarks>
 class Z_TIME_MODULE_SYMBOLS DateTime
 {
+    friend class STimeBatch; // Batch operations read and write the internal instant directly
+
     // CONSTANTS
     // ---------------
 private:
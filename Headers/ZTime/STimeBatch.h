@@ -0,0 +1,265 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __STIMEBATCH__
+#define __STIMEBATCH__
+
+#include "ZTime/TimeModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZTime/TimeSpan.h"
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+    #define Z_TIME_AVX2_SUPPORTED
+
+#endif
+
+
+namespace z
+{
+
+// Forward declarations
+class DateTime;
+
+
+/// <summary>
+/// Performs arithmetic operations and comparisons over arrays of instants, which are stored as raw amounts of hundreds of nanoseconds, like 
+/// time spans and date/times do internally.
+/// </summary>
+/// <remarks>
+/// It is intended for processing large amounts of instants stored in separate arrays (structure of arrays) instead of arrays of objects. Unlike the operators of 
+/// TimeSpan and DateTime, these operations do not check every element: arguments are checked once per call.<br/>
+/// Operations are vectorized using AVX2 instructions when the CPU supports them, processing 4 instants per instruction; otherwise, or for 
+/// the last elements of the arrays, they are performed one by one. The results are the same either way.<br/>
+/// Input and output arrays can be the same.
+/// </remarks>
+class Z_TIME_MODULE_SYMBOLS STimeBatch
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    STimeBatch();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Adds a time span to every instant of an array. Results that exceed the maximum value of a time span are set to the maximum value.
+    /// </summary>
+    /// <param name="arInstants">[IN] The instants, in hundreds of nanoseconds. It can be null if the count is zero.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="timeSpan">[IN] The time span to add.</param>
+    /// <param name="arResults">[OUT] An array with, at least, the same number of elements, where the results will be stored.</param>
+    static void Add(const u64_z* arInstants, const puint_z uCount, const TimeSpan &timeSpan, u64_z* arResults);
+
+    /// <summary>
+    /// Subtracts a time span from every instant of an array. Results that would be lower than zero are set to zero.
+    /// </summary>
+    /// <param name="arInstants">[IN] The instants, in hundreds of nanoseconds. It can be null if the count is zero.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="timeSpan">[IN] The time span to subtract.</param>
+    /// <param name="arResults">[OUT] An array with, at least, the same number of elements, where the results will be stored.</param>
+    static void Subtract(const u64_z* arInstants, const puint_z uCount, const TimeSpan &timeSpan, u64_z* arResults);
+
+    /// <summary>
+    /// Calculates the amount of time between every pair of instants of two arrays, regardless of which one is earlier, like the difference 
+    /// between two date/times does.
+    /// </summary>
+    /// <param name="arInstantsA">[IN] The first instant of every pair, in hundreds of nanoseconds. It can be null if the count is zero.</param>
+    /// <param name="arInstantsB">[IN] The second instant of every pair, in hundreds of nanoseconds. It can be null if the count is zero.</param>
+    /// <param name="uCount">[IN] The number of pairs.</param>
+    /// <param name="arDifferences">[OUT] An array with, at least, the same number of elements, where the differences will be stored.</param>
+    static void Difference(const u64_z* arInstantsA, const u64_z* arInstantsB, const puint_z uCount, u64_z* arDifferences);
+
+    /// <summary>
+    /// Calculates which window of time every instant of an array belongs to, given the beginning of the first window and the length of all of them.
+    /// </summary>
+    /// <remarks>
+    /// The index of the window of an instant is the amount of complete windows between the origin and the instant. Instants earlier than the origin 
+    /// belong to the first window.
+    /// </remarks>
+    /// <param name="arInstants">[IN] The instants, in hundreds of nanoseconds. It can be null if the count is zero.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="uOrigin">[IN] The instant at which the first window begins, in hundreds of nanoseconds.</param>
+    /// <param name="windowLength">[IN] The length of every window. It must be greater than zero.</param>
+    /// <param name="arWindowIndices">[OUT] An array with, at least, the same number of elements, where the index of the window of every instant will be stored.</param>
+    static void Bin(const u64_z* arInstants, const puint_z uCount, const u64_z uOrigin, const TimeSpan &windowLength, u64_z* arWindowIndices);
+
+    /// <summary>
+    /// Gets the earliest instant of an array.
+    /// </summary>
+    /// <param name="arInstants">[IN] The instants, in hundreds of nanoseconds. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of instants. It must be greater than zero.</param>
+    /// <returns>
+    /// The lowest value of the array.
+    /// </returns>
+    static u64_z GetMinimum(const u64_z* arInstants, const puint_z uCount);
+
+    /// <summary>
+    /// Gets the latest instant of an array.
+    /// </summary>
+    /// <param name="arInstants">[IN] The instants, in hundreds of nanoseconds. It must not be null.</param>
+    /// <param name="uCount">[IN] The number of instants. It must be greater than zero.</param>
+    /// <returns>
+    /// The highest value of the array.
+    /// </returns>
+    static u64_z GetMaximum(const u64_z* arInstants, const puint_z uCount);
+
+    /// <summary>
+    /// Copies the internal instants of an array of date/times to an array of raw instants, so they can be processed in batches.
+    /// </summary>
+    /// <remarks>
+    /// Instants are stored in UTC. Undefined date/times are copied as zero.
+    /// </remarks>
+    /// <param name="arDateTimes">[IN] The date/times. It can be null if the count is zero.</param>
+    /// <param name="uCount">[IN] The number of date/times.</param>
+    /// <param name="arInstants">[OUT] An array with, at least, the same number of elements, where the instants will be stored.</param>
+    static void GetInstants(const DateTime* arDateTimes, const puint_z uCount, u64_z* arInstants);
+
+    /// <summary>
+    /// Replaces the internal instants of an array of date/times with the values of an array of raw instants. The time zone of every date/time is kept.
+    /// </summary>
+    /// <remarks>
+    /// Instants must be in UTC. Zero produces undefined date/times.
+    /// </remarks>
+    /// <param name="arInstants">[IN] The instants, in hundreds of nanoseconds. It can be null if the count is zero.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="arDateTimes">[OUT] An array with, at least, the same number of elements, whose instants will be replaced.</param>
+    static void SetInstants(const u64_z* arInstants, const puint_z uCount, DateTime* arDateTimes);
+
+private:
+
+    /// <summary>
+    /// Checks whether the CPU and the operating system support AVX2 instructions.
+    /// </summary>
+    /// <returns>
+    /// True if AVX2 instructions can be used; False otherwise.
+    /// </returns>
+    static bool _IsAvx2SupportedByProcessor();
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+
+    /// <summary>
+    /// Vectorized version of Add. It processes groups of 4 instants and returns the number of instants processed.
+    /// </summary>
+    /// <param name="arInstants">[IN] The instants.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="uTimeSpan">[IN] The time span to add, in hundreds of nanoseconds.</param>
+    /// <param name="arResults">[OUT] The results.</param>
+    /// <returns>
+    /// The number of instants processed.
+    /// </returns>
+    static puint_z _AddAvx2(const u64_z* arInstants, const puint_z uCount, const u64_z uTimeSpan, u64_z* arResults);
+
+    /// <summary>
+    /// Vectorized version of Subtract. It processes groups of 4 instants and returns the number of instants processed.
+    /// </summary>
+    /// <param name="arInstants">[IN] The instants.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="uTimeSpan">[IN] The time span to subtract, in hundreds of nanoseconds.</param>
+    /// <param name="arResults">[OUT] The results.</param>
+    /// <returns>
+    /// The number of instants processed.
+    /// </returns>
+    static puint_z _SubtractAvx2(const u64_z* arInstants, const puint_z uCount, const u64_z uTimeSpan, u64_z* arResults);
+
+    /// <summary>
+    /// Vectorized version of Difference. It processes groups of 4 pairs and returns the number of pairs processed.
+    /// </summary>
+    /// <param name="arInstantsA">[IN] The first instant of every pair.</param>
+    /// <param name="arInstantsB">[IN] The second instant of every pair.</param>
+    /// <param name="uCount">[IN] The number of pairs.</param>
+    /// <param name="arDifferences">[OUT] The differences.</param>
+    /// <returns>
+    /// The number of pairs processed.
+    /// </returns>
+    static puint_z _DifferenceAvx2(const u64_z* arInstantsA, const u64_z* arInstantsB, const puint_z uCount, u64_z* arDifferences);
+
+    /// <summary>
+    /// Vectorized version of Bin. It processes groups of 4 instants and returns the number of instants processed.
+    /// </summary>
+    /// <remarks>
+    /// Divisions are performed with double precision floating point numbers and then corrected, which is exact as long as the distance between 
+    /// the instants and the origin is lower than 2^52; groups that contain farther instants are processed one by one.
+    /// </remarks>
+    /// <param name="arInstants">[IN] The instants.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="uOrigin">[IN] The beginning of the first window.</param>
+    /// <param name="uWindowLength">[IN] The length of every window. It must be greater than zero and lower than 2^52.</param>
+    /// <param name="arWindowIndices">[OUT] The indices of the windows.</param>
+    /// <returns>
+    /// The number of instants processed.
+    /// </returns>
+    static puint_z _BinAvx2(const u64_z* arInstants, const puint_z uCount, const u64_z uOrigin, const u64_z uWindowLength, u64_z* arWindowIndices);
+
+    /// <summary>
+    /// Vectorized version of GetMinimum. It processes groups of 4 instants and returns the number of instants processed.
+    /// </summary>
+    /// <param name="arInstants">[IN] The instants.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="uMinimum">[IN/OUT] The lowest value found so far, which is updated.</param>
+    /// <returns>
+    /// The number of instants processed.
+    /// </returns>
+    static puint_z _GetMinimumAvx2(const u64_z* arInstants, const puint_z uCount, u64_z &uMinimum);
+
+    /// <summary>
+    /// Vectorized version of GetMaximum. It processes groups of 4 instants and returns the number of instants processed.
+    /// </summary>
+    /// <param name="arInstants">[IN] The instants.</param>
+    /// <param name="uCount">[IN] The number of instants.</param>
+    /// <param name="uMaximum">[IN/OUT] The highest value found so far, which is updated.</param>
+    /// <returns>
+    /// The number of instants processed.
+    /// </returns>
+    static puint_z _GetMaximumAvx2(const u64_z* arInstants, const puint_z uCount, u64_z &uMaximum);
+
+#endif
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Indicates whether the operations are vectorized on this machine, which depends on the support of AVX2 instructions.
+    /// </summary>
+    /// <returns>
+    /// True if the operations are vectorized; False otherwise.
+    /// </returns>
+    static bool IsVectorized();
+
+};
+
+} // namespace z
+
+
+#endif // __STIMEBATCH__
@@ -0,0 +1,259 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __COARSECLOCK__
+#define __COARSECLOCK__
+
+#include <boost/atomic.hpp>
+
+#include "ZTiming/TimingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZTime/DateTime.h"
+#include "ZTime/TimeSpan.h"
+#include "ZTiming/ECoarseClockMode.h"
+
+#ifdef Z_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
+
+
+namespace z
+{
+
+// Forward declarations
+class Thread;
+class TimeZone;
+
+
+/// <summary>
+/// Provides the current UTC date and time at a very low cost, sacrificing resolution.
+/// </summary>
+/// <remarks>
+/// It is intended for code that needs timestamps very often but does not need them to be precise, like loggers.<br/>
+/// In the E_PublishedByThread mode, the system clock is read only when the clock is updated, either by a dedicated thread every given period of time 
+/// (see Start) or by calling Update; reading the current date and time then costs a single atomic load. The resolution is the update period.<br/>
+/// In the E_OperatingSystemCoarse mode, no thread is used and the coarse clock of the operating system is read every time, which is cheaper than the 
+/// precise clock used by DateTimeNow. Its resolution is usually between 1 and 16 milliseconds.<br/>
+/// Like DateTimeNow, it is wall-clock time, not monotonic; however, in the E_PublishedByThread mode the published date and time never decreases: if 
+/// the system clock is set back, the clock keeps returning the last published value until the system clock reaches it again.<br/>
+/// This class is thread-safe.
+/// </remarks>
+class Z_TIMING_MODULE_SYMBOLS CoarseClock
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that uses the E_PublishedByThread mode with an update period of one millisecond.
+    /// </summary>
+    /// <remarks>
+    /// The current date and time is published once during the construction. The dedicated thread is not created until Start is called.
+    /// </remarks>
+    CoarseClock();
+
+    /// <summary>
+    /// Constructor that receives the way the current date and time is obtained and the update period.
+    /// </summary>
+    /// <remarks>
+    /// In the E_PublishedByThread mode, the current date and time is published once during the construction. The dedicated thread is not created 
+    /// until Start is called.
+    /// </remarks>
+    /// <param name="eMode">[IN] The way the current date and time is obtained.</param>
+    /// <param name="updatePeriod">[IN] The time between two updates performed by the dedicated thread. It must be greater than zero. It is not 
+    /// used in the E_OperatingSystemCoarse mode.</param>
+    CoarseClock(const ECoarseClockMode &eMode, const TimeSpan &updatePeriod);
+
+private:
+
+    // Hidden
+    CoarseClock(const CoarseClock&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It stops the dedicated thread, if running.
+    /// </summary>
+    ~CoarseClock();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    CoarseClock& operator=(const CoarseClock&);
+
+public:
+
+    /// <summary>
+    /// Reads the system clock and publishes the result, so it is returned by subsequent calls to the getters.
+    /// </summary>
+    /// <remarks>
+    /// It can be called from any thread, for example, once per iteration of a main loop, as an alternative to the dedicated thread.<br/>
+    /// The result is not published if it is earlier than the published date and time.<br/>
+    /// It does nothing in the E_OperatingSystemCoarse mode.
+    /// </remarks>
+    void Update();
+
+    /// <summary>
+    /// Creates a thread that updates the clock every update period until Stop is called.
+    /// </summary>
+    /// <remarks>
+    /// The precision of the period depends on the granularity of the sleep function of the operating system.<br/>
+    /// It must not be called if the thread is already running. It does nothing in the E_OperatingSystemCoarse mode.
+    /// </remarks>
+    void Start();
+
+    /// <summary>
+    /// Stops the thread created by Start and waits for it to finish. It does nothing if the thread is not running.
+    /// </summary>
+    void Stop();
+
+private:
+
+    /// <summary>
+    /// Gets the internal instant used by DateTime that corresponds to the epoch of the real-time clock of the operating system.
+    /// </summary>
+    /// <returns>
+    /// The instant of the epoch, in hundreds of nanoseconds.
+    /// </returns>
+    static u64_z _GetSystemEpochInstant();
+
+    /// <summary>
+    /// Reads the real-time clock of the operating system.
+    /// </summary>
+    /// <param name="bCoarse">[IN] Whether to read the coarse clock of the operating system, when available, or the precise one.</param>
+    /// <returns>
+    /// The current UTC date and time, as the internal instant used by DateTime (see STimeBatch).
+    /// </returns>
+    static u64_z _GetSystemUtcInstant(const bool bCoarse);
+
+    /// <summary>
+    /// The function executed by the dedicated thread.
+    /// </summary>
+    void _RunThread();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the current UTC date and time, with the resolution of the clock.
+    /// </summary>
+    /// <returns>
+    /// The current date and time, whose time zone is UTC.
+    /// </returns>
+    DateTime GetUtcDateTime() const;
+
+    /// <summary>
+    /// Gets the current date and time, with the resolution of the clock, applying a time zone.
+    /// </summary>
+    /// <param name="pTimeZone">[IN] The time zone to apply. If it is null, the time will be UTC.</param>
+    /// <returns>
+    /// The current date and time.
+    /// </returns>
+    DateTime GetDateTime(const TimeZone* pTimeZone) const;
+
+    /// <summary>
+    /// Gets the current UTC date and time as the internal instant used by DateTime, with the resolution of the clock.
+    /// </summary>
+    /// <remarks>
+    /// It is the cheapest way to get a timestamp. The value can be converted to DateTime using STimeBatch.
+    /// </remarks>
+    /// <returns>
+    /// The current instant, in hundreds of nanoseconds.
+    /// </returns>
+    u64_z GetUtcInstant() const;
+
+    /// <summary>
+    /// Gets the way the current date and time is obtained.
+    /// </summary>
+    /// <returns>
+    /// The mode of the clock.
+    /// </returns>
+    ECoarseClockMode GetMode() const;
+
+    /// <summary>
+    /// Gets the time between two updates performed by the dedicated thread.
+    /// </summary>
+    /// <returns>
+    /// The update period.
+    /// </returns>
+    TimeSpan GetUpdatePeriod() const;
+
+    /// <summary>
+    /// Indicates whether the dedicated thread is running.
+    /// </summary>
+    /// <returns>
+    /// True if the thread is running; False otherwise.
+    /// </returns>
+    bool IsRunning() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The last published instant, in the format used internally by DateTime.
+    /// </summary>
+    boost::atomic<u64_z> m_uInstant;
+
+    /// <summary>
+    /// The way the current date and time is obtained.
+    /// </summary>
+    ECoarseClockMode m_eMode;
+
+    /// <summary>
+    /// The time between two updates performed by the dedicated thread, in hundreds of nanoseconds.
+    /// </summary>
+    u64_z m_uUpdatePeriod;
+
+    /// <summary>
+    /// The dedicated thread, or null if it is not running.
+    /// </summary>
+    Thread* m_pThread;
+
+    /// <summary>
+    /// Indicates to the dedicated thread that it must finish.
+    /// </summary>
+    boost::atomic<bool> m_bStopRequested;
+
+};
+
+} // namespace z
+
+#ifdef Z_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
+#endif // __COARSECLOCK__
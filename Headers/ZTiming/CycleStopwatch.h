@@ -0,0 +1,139 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __CYCLESTOPWATCH__
+#define __CYCLESTOPWATCH__
+
+#include "ZTiming/TimingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZTime/TimeSpan.h"
+
+
+namespace z
+{
+
+/// <summary>
+/// A stopwatch that counts the CPU cycles passed since the last time it was set, intended for measuring very short intervals 
+/// with the minimum overhead.
+/// </summary>
+/// <remarks>
+/// It reads the invariant timestamp counter of the CPU directly, without calling the operating system. If the counter is not available, 
+/// the monotonic clock of the operating system is used instead and every "cycle" equals one nanosecond (see IsCycleAccurate).<br/>
+/// Cycles can be converted to time using the frequency of the counter, which is calibrated once per process.
+/// </remarks>
+class Z_TIMING_MODULE_SYMBOLS CycleStopwatch
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor. It calibrates the counter if it has not been done yet. Call the Set method to start measuring.
+    /// </summary>
+    CycleStopwatch();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the current value of the counter used by cycle stopwatches.
+    /// </summary>
+    /// <returns>
+    /// The amount of cycles counted since an arbitrary moment. If the timestamp counter is not available, it is expressed in nanoseconds.
+    /// </returns>
+    static u64_z _GetCurrentCycles();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the amount of cycles passed since the last time the stopwatch was set.
+    /// </summary>
+    /// <returns>
+    /// The elapsed cycles.
+    /// </returns>
+    u64_z GetElapsedCycles() const;
+
+    /// <summary>
+    /// Gets the elapsed time since the last time the stopwatch was set.
+    /// </summary>
+    /// <returns>
+    /// The elapsed time, in nanoseconds, as an unsigned integer number.
+    /// </returns>
+    u64_z GetElapsedTimeAsInteger() const;
+
+    /// <summary>
+    /// Gets the elapsed time since the last time the stopwatch was set.
+    /// </summary>
+    /// <returns>
+    /// The elapsed time, in hundreds of nanosecond, as a time span.
+    /// </returns>
+    TimeSpan GetElapsedTimeAsTimeSpan() const;
+
+    /// <summary>
+    /// Sets the instant that serves as reference to calculate the elapsed cycles.
+    /// </summary>
+    /// <remarks>
+    /// It can be set as many times as necessary.
+    /// </remarks>
+    void Set();
+
+    /// <summary>
+    /// Indicates whether cycle stopwatches count actual CPU cycles or they fall back to the operating system clock.
+    /// </summary>
+    /// <returns>
+    /// True if the invariant timestamp counter is used; False otherwise.
+    /// </returns>
+    static bool IsCycleAccurate();
+
+    /// <summary>
+    /// Gets the number of cycles counted per second.
+    /// </summary>
+    /// <returns>
+    /// The calibrated frequency of the timestamp counter or, if it is not available, the number of nanoseconds in a second.
+    /// </returns>
+    static u64_z GetCyclesPerSecond();
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The amount of cycles that serves as reference to calculate the elapsed cycles.
+    /// </summary>
+    u64_z m_uReferenceCycles;
+};
+
+} // namespace z
+
+
+#endif // __CYCLESTOPWATCH__
@@ -0,0 +1,156 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __STIMESTAMPCOUNTER__
+#define __STIMESTAMPCOUNTER__
+
+#include "ZTiming/TimingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+
+    #define Z_TIMING_TIMESTAMPCOUNTER_SUPPORTED
+
+    #if defined(Z_COMPILER_MSVC)
+        #include <intrin.h>
+        #include <emmintrin.h>
+    #elif defined(Z_COMPILER_GCC)
+        #include <x86intrin.h>
+    #endif
+
+#endif
+
+
+namespace z
+{
+
+/// <summary>
+/// Provides access to the timestamp counter (TSC) of the CPU, which is a 64-bits register that counts clock cycles.
+/// </summary>
+/// <remarks>
+/// Reading the counter does not imply a system call, so it is much cheaper than querying the operating system's clocks.<br/>
+/// The counter is only used when the CPU reports it as invariant (its rate does not depend on frequency scaling or sleep states) and 
+/// the RDTSCP instruction is available; otherwise, it is considered not available. Its frequency is calibrated against the operating 
+/// system's monotonic clock the first time it is needed.
+/// </remarks>
+class Z_TIMING_MODULE_SYMBOLS STimestampCounter
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    STimestampCounter();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Reads the current value of the timestamp counter.
+    /// </summary>
+    /// <remarks>
+    /// The RDTSCP instruction waits until all the previous instructions have been executed and it is followed by a load fence, so 
+    /// subsequent instructions cannot be executed before the counter is read.<br/>
+    /// It does not check whether the counter is available; call IsAvailable first.
+    /// </remarks>
+    /// <returns>
+    /// The number of cycles counted since an arbitrary moment. If the CPU does not support the instruction, it returns zero.
+    /// </returns>
+    static u64_z GetCycles()
+    {
+#if defined(Z_TIMING_TIMESTAMPCOUNTER_SUPPORTED)
+        unsigned int uProcessorId = 0;
+        const u64_z uCycles = __rdtscp(&uProcessorId);
+        _mm_lfence();
+        return uCycles;
+#else
+        return 0;
+#endif
+    }
+
+    /// <summary>
+    /// Converts an amount of cycles of the timestamp counter to nanoseconds, using the calibrated frequency.
+    /// </summary>
+    /// <param name="uCycles">[IN] An amount of cycles.</param>
+    /// <returns>
+    /// The equivalent amount of time, in nanoseconds. If the counter is not available, it returns zero.
+    /// </returns>
+    static u64_z ConvertToNanoseconds(const u64_z uCycles);
+
+private:
+
+    /// <summary>
+    /// Asks the CPU whether it supports both the RDTSCP instruction and an invariant timestamp counter.
+    /// </summary>
+    /// <returns>
+    /// True if both features are supported; False otherwise.
+    /// </returns>
+    static bool _IsSupportedByProcessor();
+
+    /// <summary>
+    /// Calculates the frequency of the timestamp counter by comparing it to the monotonic clock of the operating system during 
+    /// a short period of time.
+    /// </summary>
+    /// <returns>
+    /// The number of cycles per second.
+    /// </returns>
+    static u64_z _CalibrateFrequency();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Indicates whether the timestamp counter can be used to measure time.
+    /// </summary>
+    /// <remarks>
+    /// The detection is performed only once.
+    /// </remarks>
+    /// <returns>
+    /// True if the CPU has an invariant timestamp counter and supports the RDTSCP instruction; False otherwise.
+    /// </returns>
+    static bool IsAvailable();
+
+    /// <summary>
+    /// Gets the calibrated frequency of the timestamp counter.
+    /// </summary>
+    /// <remarks>
+    /// The calibration is performed only once, the first time this method is called, and blocks the calling thread for some milliseconds.
+    /// </remarks>
+    /// <returns>
+    /// The number of cycles per second. If the counter is not available, it returns zero.
+    /// </returns>
+    static u64_z GetFrequency();
+};
+
+} // namespace z
+
+
+#endif // __STIMESTAMPCOUNTER__
@@ -30,6 +30,7 @@
 #include "ZTiming/TimingModuleDefinitions.h"
 #include "ZCommon/DataTypes/DataTypesDefinitions.h"
 #include "ZTime/TimeSpan.h"
+#include "ZTiming/EClockSource.h"
 
 #if defined(Z_OS_WINDOWS)
 
@@ -55,7 +56,9 @@ namespace z
 /// </summary>
 /// <remarks>
 /// Depending on the operating system, the resolution of the time counter may vary (from 100ns to 1ns).<br/>
-/// Internal time counter is not affected by thread interruptions nor by system adjustments.
+/// Internal time counter is not affected by thread interruptions nor by changes of the system time.<br/>
+/// The source of the time counter can be selected when the stopwatch is created. Reading the timestamp counter of the CPU is 
+/// much cheaper than querying the operating system, which may imply a system call, so it is preferable for fine-grained measurements.
 /// </remarks>
 class Z_TIMING_MODULE_SYMBOLS Stopwatch
 {
@@ -67,6 +70,15 @@ public:
     /// Default constructor. It only gets some data from the system. Call the Set method to start measuring the time.
     /// </summary>
     Stopwatch();
+
+    /// <summary>
+    /// Constructor that receives the source of the time counter. Call the Set method to start measuring the time.
+    /// </summary>
+    /// <remarks>
+    /// If the timestamp counter is requested but it is not available, the operating system counter will be used instead.
+    /// </remarks>
+    /// <param name="eClockSource">[IN] The source of the time counter to use.</param>
+    explicit Stopwatch(const EClockSource &eClockSource);
     
 
     // METHODS
@@ -81,6 +93,32 @@ public:
     /// </returns>
     static u64_z _GetCurrentInstant();
 
+protected:
+
+    /// <summary>
+    /// Reads the time counter selected for the stopwatch.
+    /// </summary>
+    /// <returns>
+    /// The current instant, expressed in the units of the selected time counter (see _GetCurrentInstant for the operating system counter, 
+    /// or cycles for the timestamp counter).
+    /// </returns>
+    u64_z _GetCurrentSample() const;
+
+    /// <summary>
+    /// Calculates the time passed since the reference instant.
+    /// </summary>
+    /// <returns>
+    /// The elapsed time, in nanoseconds.
+    /// </returns>
+    u64_z _GetElapsedNanoseconds() const;
+
+private:
+
+    /// <summary>
+    /// Initializes the data obtained from the system that is shared by all the stopwatches, only the first time it is called.
+    /// </summary>
+    static void _InitializeAuxiliarData();
+
 
     // PROPERTIES
     // ---------------
@@ -118,6 +156,14 @@ public:
     /// </remarks>
     void Set();
 
+    /// <summary>
+    /// Gets the source of the time counter used by the stopwatch.
+    /// </summary>
+    /// <returns>
+    /// The source of the time counter. It may differ from the one requested at construction if the timestamp counter is not available.
+    /// </returns>
+    EClockSource GetClockSource() const;
+
 
     // ATTRIBUTES
     // ---------------
@@ -145,6 +191,11 @@ protected:
     /// The instant that serves as reference to calculate the elapsed time.
     /// </summary>
     u64_z m_uReferenceTime;
+
+    /// <summary>
+    /// The source of the time counter used to obtain instants.
+    /// </summary>
+    EClockSource m_eClockSource;
 };
 
 } // namespace z
@@ -0,0 +1,452 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __TIMERWHEEL__
+#define __TIMERWHEEL__
+
+#include <boost/atomic.hpp>
+
+#include "ZTiming/TimingModuleDefinitions.h"
+#include "ZCommon/DataTypes/DataTypesDefinitions.h"
+#include "ZCommon/Delegate.h"
+#include "ZTime/TimeSpan.h"
+#include "ZTiming/Stopwatch.h"
+#include "ZThreading/Mutex.h"
+#include "ZContainers/ArrayDynamic.h"
+
+#ifdef Z_COMPILER_MSVC
+    #pragma warning( push )
+    #pragma warning( disable: 4251 ) // This warning occurs when using a template specialization as attribute
+#endif
+
+
+namespace z
+{
+
+// Forward declarations
+class Thread;
+
+
+/// <summary>
+/// Schedules functions to be called once or periodically when a given amount of time passes, using a hierarchical timer wheel.
+/// </summary>
+/// <remarks>
+/// Time is divided into ticks of the same duration, which is the precision of the timers. Adding or cancelling a timer has a constant cost, no matter 
+/// how many timers are pending; advancing one tick has also a constant cost, besides calling the functions of the expired timers.<br/>
+/// The wheel has 4 levels of 256 slots each. Timers that expire in less than 256 ticks are stored in the first level, which is processed tick by tick; 
+/// timers in upper levels are moved to lower levels (cascaded) as time passes. Timers that expire beyond the range of the wheel (2^32 ticks) are stored in the 
+/// last slot of the upper level and are placed again every time that slot is cascaded.<br/>
+/// The wheel can be driven either by calling Tick periodically from any thread or by a dedicated thread (see Start).<br/>
+/// Callbacks are executed in the thread that moves the wheel forward, without any lock held, so they can add or cancel timers.<br/>
+/// This class is thread-safe.
+/// </remarks>
+class Z_TIMING_MODULE_SYMBOLS TimerWheel
+{
+    // TYPEDEFS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Identifies a scheduled timer. Zero is never used as identifier.
+    /// </summary>
+    typedef u64_z TimerId;
+
+    /// <summary>
+    /// The type of the functions called when timers expire.
+    /// </summary>
+    typedef Delegate<void()> TimerCallback;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// A timer stored in the wheel, which is also a node of the doubly linked list of the slot it belongs to.
+    /// </summary>
+    class TimerNode
+    {
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The function to be called when the timer expires.
+        /// </summary>
+        TimerCallback m_callback;
+
+        /// <summary>
+        /// The tick in which the timer expires.
+        /// </summary>
+        u64_z m_uExpirationTick;
+
+        /// <summary>
+        /// The amount of ticks between two expirations of a periodic timer. Zero for one-shot timers.
+        /// </summary>
+        u64_z m_uPeriod;
+
+        /// <summary>
+        /// The index of the previous node in the slot, or NO_NODE. In free nodes, it is not used.
+        /// </summary>
+        puint_z m_uPrevious;
+
+        /// <summary>
+        /// The index of the next node in the slot, or NO_NODE. In free nodes, it is the index of the next free node.
+        /// </summary>
+        puint_z m_uNext;
+
+        /// <summary>
+        /// The index of the slot that contains the node, or NO_SLOT if the node is free.
+        /// </summary>
+        u32_z m_uSlot;
+
+        /// <summary>
+        /// A counter that changes every time the node is released, so identifiers of expired or cancelled timers are never valid again.
+        /// </summary>
+        u32_z m_uGeneration;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The number of levels of the wheel.
+    /// </summary>
+    static const u32_z LEVELS_COUNT = 4U;
+
+    /// <summary>
+    /// The number of bits of the tick counter that are used to select a slot in every level.
+    /// </summary>
+    static const u32_z BITS_PER_LEVEL = 8U;
+
+    /// <summary>
+    /// The number of slots of every level.
+    /// </summary>
+    static const u32_z SLOTS_PER_LEVEL = 1U << BITS_PER_LEVEL;
+
+    /// <summary>
+    /// Index that represents the absence of a node.
+    /// </summary>
+    static const puint_z NO_NODE = -1;
+
+    /// <summary>
+    /// Index of slot that represents that a node is not stored in the wheel.
+    /// </summary>
+    static const u32_z NO_SLOT = -1;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that uses ticks of one millisecond.
+    /// </summary>
+    TimerWheel();
+
+    /// <summary>
+    /// Constructor that receives the duration of the ticks.
+    /// </summary>
+    /// <param name="tickDuration">[IN] The duration of every tick, which is the precision of the timers. It must be greater than zero.</param>
+    explicit TimerWheel(const TimeSpan &tickDuration);
+
+private:
+
+    // Hidden
+    TimerWheel(const TimerWheel&);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It stops the dedicated thread, if running. Pending timers are discarded.
+    /// </summary>
+    ~TimerWheel();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Hidden
+    TimerWheel& operator=(const TimerWheel&);
+
+public:
+
+    /// <summary>
+    /// Schedules a function to be called once, when the given amount of time passes.
+    /// </summary>
+    /// <remarks>
+    /// The delay is rounded up to an integer amount of ticks, with a minimum of one tick, counted from the last tick processed.
+    /// </remarks>
+    /// <param name="delay">[IN] The time to wait before calling the function.</param>
+    /// <param name="callback">[IN] The function to be called. It must not be null.</param>
+    /// <returns>
+    /// The identifier of the timer, which can be used to cancel it.
+    /// </returns>
+    TimerId AddTimer(const TimeSpan &delay, const TimerCallback &callback);
+
+    /// <summary>
+    /// Schedules a function to be called periodically, every time the given amount of time passes, until the timer is cancelled.
+    /// </summary>
+    /// <remarks>
+    /// The period is rounded up to an integer amount of ticks, with a minimum of one tick. The first call occurs when the first period passes, counted from 
+    /// the last tick processed. Expirations are calculated from the previous expiration, not from the moment the function was called, so they do not drift.
+    /// </remarks>
+    /// <param name="period">[IN] The time between two calls to the function.</param>
+    /// <param name="callback">[IN] The function to be called. It must not be null.</param>
+    /// <returns>
+    /// The identifier of the timer, which can be used to cancel it.
+    /// </returns>
+    TimerId AddPeriodicTimer(const TimeSpan &period, const TimerCallback &callback);
+
+    /// <summary>
+    /// Cancels a timer so its function is not called anymore.
+    /// </summary>
+    /// <remarks>
+    /// If the timer expires in the same tick that is being processed by another thread, its function may be called once more.
+    /// </remarks>
+    /// <param name="timerId">[IN] The identifier of the timer.</param>
+    /// <returns>
+    /// True if the timer was pending and has been cancelled; False if it had already expired, was cancelled before or does not exist.
+    /// </returns>
+    bool CancelTimer(const TimerId timerId);
+
+    /// <summary>
+    /// Moves the wheel forward as many ticks as have passed according to the clock since the wheel was created, calling the functions of the timers that expire.
+    /// </summary>
+    /// <remarks>
+    /// It should be called at least once per tick to keep the precision of the timers. It must not be called while the dedicated thread is running.
+    /// </remarks>
+    /// <returns>
+    /// The number of functions called.
+    /// </returns>
+    puint_z Tick();
+
+    /// <summary>
+    /// Moves the wheel forward an amount of ticks, regardless of the clock, calling the functions of the timers that expire.
+    /// </summary>
+    /// <remarks>
+    /// It is useful when the wheel does not follow the real time, for example, in simulations. Since the clock is not used, calling Tick afterwards will not 
+    /// move the wheel until the clock reaches the current tick. It must not be called while the dedicated thread is running.
+    /// </remarks>
+    /// <param name="uTicks">[IN] The number of ticks to move forward.</param>
+    /// <returns>
+    /// The number of functions called.
+    /// </returns>
+    puint_z Advance(const u64_z uTicks);
+
+    /// <summary>
+    /// Creates a thread that moves the wheel forward tick by tick, following the clock, until Stop is called. The functions of the timers are called in that thread.
+    /// </summary>
+    /// <remarks>
+    /// The thread sleeps between ticks. The precision depends on the granularity of the sleep function of the operating system.<br/>
+    /// It must not be called if the thread is already running.
+    /// </remarks>
+    void Start();
+
+    /// <summary>
+    /// Stops the thread created by Start and waits for it to finish. It does nothing if the thread is not running.
+    /// </summary>
+    /// <remarks>
+    /// It must not be called from a timer function executed by the dedicated thread.
+    /// </remarks>
+    void Stop();
+
+private:
+
+    /// <summary>
+    /// Reserves a free node, or creates a new one, and schedules it.
+    /// </summary>
+    /// <param name="uDelayTicks">[IN] The amount of ticks until the timer expires.</param>
+    /// <param name="uPeriod">[IN] The amount of ticks between expirations, or zero for one-shot timers.</param>
+    /// <param name="callback">[IN] The function to be called.</param>
+    /// <returns>
+    /// The identifier of the timer.
+    /// </returns>
+    TimerId _AddTimer(const u64_z uDelayTicks, const u64_z uPeriod, const TimerCallback &callback);
+
+    /// <summary>
+    /// Links a node to the slot that corresponds to its expiration tick.
+    /// </summary>
+    /// <param name="uNode">[IN] The index of the node.</param>
+    void _InsertNode(const puint_z uNode);
+
+    /// <summary>
+    /// Unlinks a node from the slot it belongs to.
+    /// </summary>
+    /// <param name="uNode">[IN] The index of the node.</param>
+    void _RemoveNode(const puint_z uNode);
+
+    /// <summary>
+    /// Unlinks a node from its slot and adds it to the list of free nodes, invalidating its identifier.
+    /// </summary>
+    /// <param name="uNode">[IN] The index of the node.</param>
+    void _ReleaseNode(const puint_z uNode);
+
+    /// <summary>
+    /// Moves all the timers of a slot of an upper level to the levels below.
+    /// </summary>
+    /// <param name="uLevel">[IN] The level of the slot. It must be greater than zero.</param>
+    /// <returns>
+    /// True if the index of the cascaded slot is zero, which means that the slot of the next level must be cascaded too.
+    /// </returns>
+    bool _CascadeSlot(const u32_z uLevel);
+
+    /// <summary>
+    /// Moves the wheel forward one tick and collects the functions of the timers that expire. Periodic timers are scheduled again and one-shot timers are released.
+    /// </summary>
+    /// <param name="arExpiredCallbacks">[OUT] The array where the functions of the expired timers will be added.</param>
+    void _AdvanceOneTick(ArrayDynamic<TimerCallback> &arExpiredCallbacks);
+
+    /// <summary>
+    /// Converts a time span to an amount of ticks, rounding up. The result is never zero.
+    /// </summary>
+    /// <param name="timeSpan">[IN] The time to convert.</param>
+    /// <returns>
+    /// The amount of ticks.
+    /// </returns>
+    u64_z _ConvertToTicks(const TimeSpan &timeSpan) const;
+
+    /// <summary>
+    /// Gets the tick that corresponds to the current instant according to the clock.
+    /// </summary>
+    /// <returns>
+    /// The number of ticks passed since the wheel was created.
+    /// </returns>
+    u64_z _GetClockTick() const;
+
+    /// <summary>
+    /// The function executed by the dedicated thread.
+    /// </summary>
+    void _RunThread();
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the duration of the ticks.
+    /// </summary>
+    /// <returns>
+    /// The duration of every tick.
+    /// </returns>
+    TimeSpan GetTickDuration() const;
+
+    /// <summary>
+    /// Gets the number of ticks processed since the wheel was created.
+    /// </summary>
+    /// <returns>
+    /// The number of the last tick processed.
+    /// </returns>
+    u64_z GetCurrentTick() const;
+
+    /// <summary>
+    /// Gets the number of timers that have not expired nor been cancelled yet.
+    /// </summary>
+    /// <returns>
+    /// The number of pending timers.
+    /// </returns>
+    puint_z GetPendingTimersCount() const;
+
+    /// <summary>
+    /// Indicates whether the dedicated thread is running.
+    /// </summary>
+    /// <returns>
+    /// True if the thread is running; False otherwise.
+    /// </returns>
+    bool IsRunning() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The duration of every tick, in hundreds of nanoseconds.
+    /// </summary>
+    u64_z m_uTickDuration;
+
+    /// <summary>
+    /// The number of ticks processed.
+    /// </summary>
+    u64_z m_uCurrentTick;
+
+    /// <summary>
+    /// The number of pending timers.
+    /// </summary>
+    puint_z m_uPendingTimersCount;
+
+    /// <summary>
+    /// The first node of every slot, or NO_NODE. Slots of the same level are contiguous.
+    /// </summary>
+    puint_z m_arSlots[LEVELS_COUNT * SLOTS_PER_LEVEL];
+
+    /// <summary>
+    /// All the nodes ever created. They are reused when released.
+    /// </summary>
+    ArrayDynamic<TimerNode> m_arNodes;
+
+    /// <summary>
+    /// The first free node, or NO_NODE.
+    /// </summary>
+    puint_z m_uFirstFreeNode;
+
+    /// <summary>
+    /// The clock that determines which ticks have passed. It is set when the wheel is created.
+    /// </summary>
+    Stopwatch m_clock;
+
+    /// <summary>
+    /// Protects the state of the wheel.
+    /// </summary>
+    mutable Mutex m_mutex;
+
+    /// <summary>
+    /// The dedicated thread, or null if it is not running.
+    /// </summary>
+    Thread* m_pThread;
+
+    /// <summary>
+    /// Indicates to the dedicated thread that it must finish.
+    /// </summary>
+    boost::atomic<bool> m_bStopRequested;
+
+};
+
+} // namespace z
+
+#ifdef Z_COMPILER_MSVC
+    #pragma warning( pop )
+#endif
+
+#endif // __TIMERWHEEL__
@@ -199,6 +199,7 @@ void StringUnicode::CharIterator::SetChar(const CharUnicode &newCharacter)
     {
         // Changes the string
         ccast_z(m_pString, string_z*)->m_strString.setCharAt(m_iterator.getIndex(), newCharacter.GetCodePoint());
+        ccast_z(m_pString, string_z*)->_InvalidateHashCode();
 
         // Updates the iterator
         const i32_z CURRENT_INDEX = m_iterator.getIndex();
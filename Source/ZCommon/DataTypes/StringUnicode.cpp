@@ -40,7 +40,11 @@
 #include <unicode/uchar.h>
 #include <sstream>
 #include <iomanip>
-#include <cstring> // Needed for strlen function
+#include <cstring> // Needed for strlen and memcpy functions
+
+#if defined(Z_COMPILER_MSVC) && defined(Z_ARCH_64BITS)
+    #include <intrin.h> // Needed for _umul128 function
+#endif
 
 
 namespace z
@@ -71,11 +75,15 @@ const int StringUnicode::PATTERN_NOT_FOUND = -1;
 StringUnicode::StringUnicode() : m_strString(),
                                  m_uLength(0)
 {
+    this->_InvalidateHashCode();
 }
 
 StringUnicode::StringUnicode(const StringUnicode &strString) : m_strString(strString.m_strString),
                                                                m_uLength(strString.GetLength())
 {
+#if Z_CONFIG_STRINGHASHCACHE_DEFAULT == Z_CONFIG_STRINGHASHCACHE_ENABLED
+    m_uHashCode.store(strString.m_uHashCode.load(boost::memory_order_relaxed), boost::memory_order_relaxed);
+#endif
 }
 
 StringUnicode::StringUnicode(const i8_z* arBytes)
@@ -116,11 +124,13 @@ StringUnicode::StringUnicode(const i8_z* arBytes,
 
     m_strString = icu::UnicodeString(arBytes, nActualLength, pConverter, errorCode);
     m_uLength = scast_z(m_strString.countChar32(), unsigned int);
+    this->_InvalidateHashCode();
 }
 
 StringUnicode::StringUnicode(const CharUnicode &character) : m_strString(UChar32(character.GetCodePoint())),
                                                              m_uLength(1U)
 {
+    this->_InvalidateHashCode();
 }
 
 StringUnicode::StringUnicode(const wchar_t* szCharacters)
@@ -156,6 +166,11 @@ StringUnicode& StringUnicode::operator=(const StringUnicode &strString)
     //               In the future we should look for a solution, if there is any.
     m_strString = strString.m_strString;
     m_uLength = strString.GetLength();
+
+#if Z_CONFIG_STRINGHASHCACHE_DEFAULT == Z_CONFIG_STRINGHASHCACHE_ENABLED
+    m_uHashCode.store(strString.m_uHashCode.load(boost::memory_order_relaxed), boost::memory_order_relaxed);
+#endif
+
     return *this;
 }
 
@@ -591,6 +606,7 @@ StringUnicode StringUnicode::ToLowerCase() const
     // Use English as locale.
     const Locale &en = Locale::getEnglish();
     strLowerCase.m_strString.toLower(en);
+    strLowerCase._InvalidateHashCode();
     return strLowerCase;
 }
 
@@ -600,6 +616,7 @@ StringUnicode StringUnicode::ToUpperCase() const
     // Use English as locale.
     const Locale &en = Locale::getEnglish();
     strUpperCase.m_strString.toUpper(en);
+    strUpperCase._InvalidateHashCode();
     return strUpperCase;
 }
 
@@ -608,6 +625,7 @@ StringUnicode StringUnicode::ToCaseFolded() const
     StringUnicode strFoldedCase(*this);
     strFoldedCase.m_strString.foldCase(U_FOLD_CASE_DEFAULT);
     strFoldedCase.m_uLength = scast_z(strFoldedCase.m_strString.countChar32(), unsigned int);
+    strFoldedCase._InvalidateHashCode();
     return strFoldedCase;
 }
 
@@ -630,6 +648,7 @@ void StringUnicode::Normalize(const ENormalizationForm &eNormalizationForm)
         {
             m_strString = strNormalized;
             m_uLength = scast_z(strNormalized.countChar32(), unsigned int);;
+            this->_InvalidateHashCode();
         }
     }
 }
@@ -744,6 +763,154 @@ const icu::Collator* StringUnicode::_GetCollator(const EComparisonType &eCompari
     return pCollator;
 }
 
+u64_z StringUnicode::GetHashCode() const
+{
+    const puint_z SIZE_IN_BYTES = scast_z(m_strString.length(), puint_z) * sizeof(u16_z);
+
+#if Z_CONFIG_STRINGHASHCACHE_DEFAULT == Z_CONFIG_STRINGHASHCACHE_ENABLED
+    u64_z uHashCode = m_uHashCode.load(boost::memory_order_relaxed);
+
+    if(uHashCode == 0)
+    {
+        uHashCode = StringUnicode::_CalculateHashCode(m_strString.getBuffer(), SIZE_IN_BYTES);
+        m_uHashCode.store(uHashCode, boost::memory_order_relaxed);
+    }
+
+    return uHashCode;
+#else
+    return StringUnicode::_CalculateHashCode(m_strString.getBuffer(), SIZE_IN_BYTES);
+#endif
+}
+
+void StringUnicode::_InvalidateHashCode()
+{
+#if Z_CONFIG_STRINGHASHCACHE_DEFAULT == Z_CONFIG_STRINGHASHCACHE_ENABLED
+    m_uHashCode.store(0, boost::memory_order_relaxed);
+#endif
+}
+
+u64_z StringUnicode::_CalculateHashCode(const void* pBuffer, const puint_z uSize)
+{
+    // See: https://github.com/wangyi-fudan/wyhash (final version 4)
+
+    static const u64_z SECRET[] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+    static const u64_z SEED = 0;
+
+    const u8_z* pBytes = scast_z(pBuffer, const u8_z*);
+    u64_z uSeed = SEED ^ StringUnicode::_MultiplyAndMix(SEED ^ SECRET[0], SECRET[1]);
+    u64_z uA = 0;
+    u64_z uB = 0;
+
+    // Unaligned reads are performed by copying the bytes, which compilers translate into a single load
+    u32_z uRead32 = 0;
+    u64_z uRead64 = 0;
+    u64_z uRead64B = 0;
+
+    if(uSize <= 16U)
+    {
+        if(uSize >= 4U)
+        {
+            const puint_z MIDDLE_OFFSET = (uSize >> 3U) << 2U;
+
+            memcpy(&uRead32, pBytes, sizeof(u32_z));
+            uA = scast_z(uRead32, u64_z) << 32U;
+            memcpy(&uRead32, pBytes + MIDDLE_OFFSET, sizeof(u32_z));
+            uA |= uRead32;
+            memcpy(&uRead32, pBytes + uSize - 4U, sizeof(u32_z));
+            uB = scast_z(uRead32, u64_z) << 32U;
+            memcpy(&uRead32, pBytes + uSize - 4U - MIDDLE_OFFSET, sizeof(u32_z));
+            uB |= uRead32;
+        }
+        else if(uSize > 0)
+        {
+            uA = (scast_z(pBytes[0], u64_z) << 16U) | (scast_z(pBytes[uSize >> 1U], u64_z) << 8U) | pBytes[uSize - 1U];
+        }
+    }
+    else
+    {
+        puint_z uRemainingSize = uSize;
+
+        if(uRemainingSize > 48U)
+        {
+            // Three independent lanes are mixed at the same time so the multiplications do not wait for each other
+            u64_z uSeedLane1 = uSeed;
+            u64_z uSeedLane2 = uSeed;
+
+            do
+            {
+                memcpy(&uRead64, pBytes, sizeof(u64_z));
+                memcpy(&uRead64B, pBytes + 8U, sizeof(u64_z));
+                uSeed = StringUnicode::_MultiplyAndMix(uRead64 ^ SECRET[1], uRead64B ^ uSeed);
+                memcpy(&uRead64, pBytes + 16U, sizeof(u64_z));
+                memcpy(&uRead64B, pBytes + 24U, sizeof(u64_z));
+                uSeedLane1 = StringUnicode::_MultiplyAndMix(uRead64 ^ SECRET[2], uRead64B ^ uSeedLane1);
+                memcpy(&uRead64, pBytes + 32U, sizeof(u64_z));
+                memcpy(&uRead64B, pBytes + 40U, sizeof(u64_z));
+                uSeedLane2 = StringUnicode::_MultiplyAndMix(uRead64 ^ SECRET[3], uRead64B ^ uSeedLane2);
+                pBytes += 48U;
+                uRemainingSize -= 48U;
+            }
+            while(uRemainingSize > 48U);
+
+            uSeed ^= uSeedLane1 ^ uSeedLane2;
+        }
+
+        while(uRemainingSize > 16U)
+        {
+            memcpy(&uRead64, pBytes, sizeof(u64_z));
+            memcpy(&uRead64B, pBytes + 8U, sizeof(u64_z));
+            uSeed = StringUnicode::_MultiplyAndMix(uRead64 ^ SECRET[1], uRead64B ^ uSeed);
+            pBytes += 16U;
+            uRemainingSize -= 16U;
+        }
+
+        // The last 16 bytes are always read, overlapping the previous block if necessary
+        memcpy(&uA, pBytes + uRemainingSize - 16U, sizeof(u64_z));
+        memcpy(&uB, pBytes + uRemainingSize - 8U, sizeof(u64_z));
+    }
+
+    uA ^= SECRET[1];
+    uB ^= uSeed;
+    StringUnicode::_Multiply(uA, uB);
+
+    return StringUnicode::_MultiplyAndMix(uA ^ SECRET[0] ^ scast_z(uSize, u64_z), uB ^ SECRET[1]);
+}
+
+void StringUnicode::_Multiply(u64_z &uA, u64_z &uB)
+{
+#if defined(Z_COMPILER_GCC) && defined(Z_ARCH_64BITS)
+    const unsigned __int128 PRODUCT = scast_z(uA, unsigned __int128) * uB;
+    uA = scast_z(PRODUCT, u64_z);
+    uB = scast_z(PRODUCT >> 64U, u64_z);
+#elif defined(Z_COMPILER_MSVC) && defined(Z_ARCH_64BITS)
+    uA = _umul128(uA, uB, &uB);
+#else
+    // The product is composed of the partial products of the 32-bits halves
+    const u64_z HIGH_A = uA >> 32U;
+    const u64_z HIGH_B = uB >> 32U;
+    const u64_z LOW_A = scast_z(uA, u32_z);
+    const u64_z LOW_B = scast_z(uB, u32_z);
+    const u64_z HIGH_HIGH = HIGH_A * HIGH_B;
+    const u64_z HIGH_LOW = HIGH_A * LOW_B;
+    const u64_z LOW_HIGH = LOW_A * HIGH_B;
+    const u64_z LOW_LOW = LOW_A * LOW_B;
+
+    const u64_z PARTIAL_SUM = LOW_LOW + (HIGH_LOW << 32U);
+    u64_z uCarry = PARTIAL_SUM < LOW_LOW ? 1U : 0;
+    const u64_z LOWER_HALF = PARTIAL_SUM + (LOW_HIGH << 32U);
+    uCarry += LOWER_HALF < PARTIAL_SUM ? 1U : 0;
+
+    uA = LOWER_HALF;
+    uB = HIGH_HIGH + (HIGH_LOW >> 32U) + (LOW_HIGH >> 32U) + uCarry;
+#endif
+}
+
+u64_z StringUnicode::_MultiplyAndMix(u64_z uA, u64_z uB)
+{
+    StringUnicode::_Multiply(uA, uB);
+    return uA ^ uB;
+}
+
 int StringUnicode::IndexOf(const StringUnicode &strPattern, const EComparisonType::EnumType &eComparisonType) const
 {
     int32_t nPosition = StringUnicode::PATTERN_NOT_FOUND;
@@ -1034,6 +1201,7 @@ void StringUnicode::Replace(const StringUnicode &strSearchedPattern, const Strin
             this->_ReplaceCanonical(strSearchedPattern, strReplacement, eComparisonType);
 
         m_uLength = scast_z(m_strString.countChar32(), unsigned int);;
+        this->_InvalidateHashCode();
     }
 }
 
@@ -1098,6 +1266,7 @@ void StringUnicode::Append(const StringUnicode &strStringToAppend)
 {
     m_strString.append(strStringToAppend.m_strString);
     m_uLength += strStringToAppend.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const char* szStringToAppend)
@@ -1110,6 +1279,7 @@ void StringUnicode::Append(const u8_z uInteger)
     StringUnicode strInteger = StringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const i8_z nInteger)
@@ -1117,6 +1287,7 @@ void StringUnicode::Append(const i8_z nInteger)
     StringUnicode strInteger = StringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const u16_z uInteger)
@@ -1124,6 +1295,7 @@ void StringUnicode::Append(const u16_z uInteger)
     StringUnicode strInteger = StringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const i16_z nInteger)
@@ -1131,6 +1303,7 @@ void StringUnicode::Append(const i16_z nInteger)
     StringUnicode strInteger = StringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const u32_z uInteger)
@@ -1138,6 +1311,7 @@ void StringUnicode::Append(const u32_z uInteger)
     StringUnicode strInteger = StringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const i32_z nInteger)
@@ -1145,6 +1319,7 @@ void StringUnicode::Append(const i32_z nInteger)
     StringUnicode strInteger = StringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const u64_z uInteger)
@@ -1152,6 +1327,7 @@ void StringUnicode::Append(const u64_z uInteger)
     StringUnicode strInteger = StringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const i64_z nInteger)
@@ -1159,6 +1335,7 @@ void StringUnicode::Append(const i64_z nInteger)
     StringUnicode strInteger = StringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const bool bBoolean)
@@ -1166,6 +1343,7 @@ void StringUnicode::Append(const bool bBoolean)
     StringUnicode strBoolean = StringUnicode::FromBoolean(bBoolean);
     m_strString.append(strBoolean.m_strString);
     m_uLength += strBoolean.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const f32_z fFloat)
@@ -1173,6 +1351,7 @@ void StringUnicode::Append(const f32_z fFloat)
     StringUnicode strFloat = StringUnicode::FromFloat(fFloat);
     m_strString.append(strFloat.m_strString);
     m_uLength += strFloat.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const f64_z fFloat)
@@ -1180,6 +1359,7 @@ void StringUnicode::Append(const f64_z fFloat)
     StringUnicode strFloat = StringUnicode::FromFloat(fFloat);
     m_strString.append(strFloat.m_strString);
     m_uLength += strFloat.GetLength();
+    this->_InvalidateHashCode();
 }
 
 void StringUnicode::Append(const vf32_z vfVector)
@@ -1187,6 +1367,7 @@ void StringUnicode::Append(const vf32_z vfVector)
     StringUnicode strVectorFloat = StringUnicode::FromVF32(vfVector);
     m_strString.append(strVectorFloat.m_strString);
     m_uLength += strVectorFloat.GetLength();
+    this->_InvalidateHashCode();
 }
 
 ArrayResult<StringUnicode> StringUnicode::Split(const StringUnicode &strSeparator) const
@@ -0,0 +1,63 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZContainers/SStringEqualityComparator.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+i8_z SStringEqualityComparator::Compare(const string_z &strLeftOperand, const string_z &strRightOperand)
+{
+    static const i8_z ARE_NOT_EQUAL = 1;
+    static const i8_z ARE_EQUAL = 0;
+
+    i8_z nResult = ARE_NOT_EQUAL;
+
+    // Cheap checks first: lengths are stored and, if the cache is enabled, hash codes are calculated only once per string
+    bool bMayBeEqual = strLeftOperand.GetLength() == strRightOperand.GetLength();
+
+#if Z_CONFIG_STRINGHASHCACHE_DEFAULT == Z_CONFIG_STRINGHASHCACHE_ENABLED
+    bMayBeEqual = bMayBeEqual && strLeftOperand.GetHashCode() == strRightOperand.GetHashCode();
+#endif
+
+    if(bMayBeEqual && strLeftOperand == strRightOperand)
+        nResult = ARE_EQUAL;
+
+    return nResult;
+}
+
+
+} // namespace z
@@ -43,27 +43,9 @@ namespace z
 
 puint_z SStringHashProvider::GenerateHashKey(const string_z &strInput, const puint_z uBucketsInTable)
 {
-    // See: http://www.burtleburtle.net/bob/hash/doobs.html
-
     Z_ASSERT_ERROR(uBucketsInTable > 0, "The input number of buckets must be greater than zero.");
 
-    u32_z uHashKey = 0;
-
-    const u16_z* arCharacters = strInput.GetInternalBuffer();
-    const puint_z LENGTH = strInput.GetLength();
-
-    for(puint_z i = 0; i < LENGTH; ++i)
-    {
-        uHashKey += arCharacters[i];
-        uHashKey += (uHashKey << 10U);
-        uHashKey ^= (uHashKey >> 6U);
-    }
-
-    uHashKey += (uHashKey << 3U);
-    uHashKey ^= (uHashKey >> 11U);
-    uHashKey += (uHashKey << 15U);
-
-    return uHashKey % scast_z(uBucketsInTable, u32_z);
+    return scast_z(strInput.GetHashCode() % scast_z(uBucketsInTable, u64_z), puint_z);
 }
 
 
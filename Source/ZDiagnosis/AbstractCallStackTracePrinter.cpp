@@ -97,6 +97,27 @@ void AbstractCallStackTracePrinter::PrintCallStackTrace(const CallStackTrace &ca
     this->PrintString(strTextToPrint);
 }
 
+void AbstractCallStackTracePrinter::PrintCallProfile(const CallProfile &profile, const ICallProfileFormatter &formatter)
+{
+    string_z strTextToPrint;
+    formatter.FormatCallProfilesHeader(strTextToPrint);
+    formatter.FormatCallProfile(profile, 0, strTextToPrint);
+    formatter.FormatCallProfilesFooter(strTextToPrint);
+    this->PrintString(strTextToPrint);
+}
+
+void AbstractCallStackTracePrinter::PrintCallProfiles(const ArrayDynamic<CallProfile> &arProfiles, const ICallProfileFormatter &formatter)
+{
+    string_z strTextToPrint;
+    formatter.FormatCallProfilesHeader(strTextToPrint);
+
+    for(puint_z i = 0; i < arProfiles.GetCount(); ++i)
+        formatter.FormatCallProfile(arProfiles[i], i, strTextToPrint);
+
+    formatter.FormatCallProfilesFooter(strTextToPrint);
+    this->PrintString(strTextToPrint);
+}
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
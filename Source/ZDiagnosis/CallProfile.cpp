@@ -0,0 +1,152 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZDiagnosis/CallProfile.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const puint_z CallProfile::NO_PARENT = -1;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallProfile::CallProfile(const string_z &strThreadId) : m_strThreadId(strThreadId)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+puint_z CallProfile::AddCallSite(const puint_z uParentIndex, const CallSiteProfile &callSite)
+{
+    Z_ASSERT_ERROR(uParentIndex == CallProfile::NO_PARENT || uParentIndex < m_arCallSites.GetCount(), "The index of the parent call site is out of bounds.");
+
+    const unsigned int DEPTH = uParentIndex == CallProfile::NO_PARENT ? 0 : 
+                                                                        m_arCallSites[uParentIndex].GetDepth() + 1U;
+    const puint_z FIRST_CALLEE = uParentIndex == CallProfile::NO_PARENT ? 0 : 
+                                                                          uParentIndex + 1U;
+    const puint_z CALL_SITE_COUNT = m_arCallSites.GetCount();
+
+    // Searches for a callee of the same function until the end of the parent's subtree
+    puint_z uPosition = FIRST_CALLEE;
+
+    while(uPosition < CALL_SITE_COUNT && m_arCallSites[uPosition].GetDepth() >= DEPTH)
+    {
+        if(m_arCallSites[uPosition].GetDepth() == DEPTH && m_arCallSites[uPosition].IsSameFunction(callSite))
+        {
+            m_arCallSites[uPosition].Merge(callSite);
+            return uPosition;
+        }
+
+        ++uPosition;
+    }
+
+    // Not found, it is added as the last callee of the parent
+    CallSiteProfile newCallSite(callSite);
+    newCallSite.SetDepth(DEPTH);
+
+    if(uPosition == CALL_SITE_COUNT)
+        m_arCallSites.Add(newCallSite);
+    else
+        m_arCallSites.Insert(newCallSite, uPosition);
+
+    return uPosition;
+}
+
+void CallProfile::Merge(const CallProfile &profile)
+{
+    // Position index, in this profile, of the last merged call site of every depth
+    ArrayDynamic<puint_z> arAncestors;
+
+    for(puint_z i = 0; i < profile.GetCount(); ++i)
+    {
+        const CallSiteProfile& CALL_SITE = profile.GetCallSite(i);
+        const unsigned int DEPTH = CALL_SITE.GetDepth();
+        const puint_z PARENT_INDEX = DEPTH == 0 ? CallProfile::NO_PARENT : 
+                                                  arAncestors[DEPTH - 1U];
+
+        const puint_z MERGED_INDEX = this->AddCallSite(PARENT_INDEX, CALL_SITE);
+
+        if(DEPTH < arAncestors.GetCount())
+            arAncestors[DEPTH] = MERGED_INDEX;
+        else
+            arAncestors.Add(MERGED_INDEX);
+    }
+}
+
+const CallSiteProfile& CallProfile::GetCallSite(const puint_z uIndex) const
+{
+    Z_ASSERT_ERROR(uIndex < m_arCallSites.GetCount(), "The index is out of bounds.");
+
+    return m_arCallSites[uIndex];
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+puint_z CallProfile::GetCount() const
+{
+    return m_arCallSites.GetCount();
+}
+
+string_z CallProfile::GetThreadId() const
+{
+    return m_strThreadId;
+}
+
+} // namespace z
@@ -0,0 +1,196 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZDiagnosis/CallProfileChromeTraceFormatter.h"
+
+#include "ZContainers/ArrayDynamic.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+Z_RTTI_SUPPORT_TYPE_DEFINITION(CallProfileChromeTraceFormatter);
+    
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallProfileChromeTraceFormatter::~CallProfileChromeTraceFormatter()
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void CallProfileChromeTraceFormatter::FormatCallProfilesFooter(string_z &strFormattedProfile) const
+{
+    static const string_z FOOTER("],\"displayTimeUnit\":\"ns\"}\n");
+    strFormattedProfile.Append(FOOTER);
+}
+
+void CallProfileChromeTraceFormatter::FormatCallProfilesHeader(string_z &strFormattedProfile) const
+{
+    static const string_z HEADER("{\"traceEvents\":[");
+    strFormattedProfile.Append(HEADER);
+}
+
+void CallProfileChromeTraceFormatter::FormatCallProfile(const CallProfile &profile, const puint_z uProfileIndex, string_z &strFormattedProfile) const
+{
+    static const string_z EVENT_SEPARATOR(",\n");
+    static const string_z THREAD_NAME_EVENT_START("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+    static const string_z THREAD_NAME_EVENT_ARGUMENTS(",\"args\":{\"name\":");
+    static const string_z THREAD_NAME_EVENT_END("}}");
+    static const string_z EVENT_NAME("{\"name\":");
+    static const string_z EVENT_CATEGORY(",\"cat\":");
+    static const string_z EVENT_THREAD(",\"ph\":\"X\",\"pid\":1,\"tid\":");
+    static const string_z EVENT_TIMESTAMP(",\"ts\":");
+    static const string_z EVENT_DURATION(",\"dur\":");
+    static const string_z EVENT_CALLS(",\"args\":{\"calls\":");
+    static const string_z EVENT_EXCLUSIVE_TIME(",\"exclusive_ns\":");
+    static const string_z EVENT_MINIMUM_TIME(",\"min_ns\":");
+    static const string_z EVENT_MAXIMUM_TIME(",\"max_ns\":");
+    static const string_z EVENT_END("}}");
+    static const string_z NO_CLASS("function");
+
+    const string_z THREAD_ID = string_z::FromInteger(uProfileIndex);
+
+    if(uProfileIndex > 0)
+        strFormattedProfile.Append(EVENT_SEPARATOR);
+
+    // The thread is named after the profile
+    strFormattedProfile.Append(THREAD_NAME_EVENT_START);
+    strFormattedProfile.Append(THREAD_ID);
+    strFormattedProfile.Append(THREAD_NAME_EVENT_ARGUMENTS);
+    CallProfileChromeTraceFormatter::_AppendJsonString(profile.GetThreadId(), strFormattedProfile);
+    strFormattedProfile.Append(THREAD_NAME_EVENT_END);
+
+    // The start time of the next call site of every depth
+    ArrayDynamic<u64_z> arNextStartTimes;
+    const u64_z ZERO = 0;
+    arNextStartTimes.Add(ZERO);
+
+    for(puint_z i = 0; i < profile.GetCount(); ++i)
+    {
+        const CallSiteProfile& CALL_SITE = profile.GetCallSite(i);
+        const unsigned int DEPTH = CALL_SITE.GetDepth();
+        const u64_z START_TIME = arNextStartTimes[DEPTH];
+
+        arNextStartTimes[DEPTH] += CALL_SITE.GetInclusiveTime();
+
+        // Callees start at the same time as the caller
+        if(DEPTH + 1U < arNextStartTimes.GetCount())
+            arNextStartTimes[DEPTH + 1U] = START_TIME;
+        else
+            arNextStartTimes.Add(START_TIME);
+
+        strFormattedProfile.Append(EVENT_SEPARATOR);
+        strFormattedProfile.Append(EVENT_NAME);
+        CallProfileChromeTraceFormatter::_AppendJsonString(CALL_SITE.GetFunctionSignature(), strFormattedProfile);
+        strFormattedProfile.Append(EVENT_CATEGORY);
+        CallProfileChromeTraceFormatter::_AppendJsonString(CALL_SITE.GetClassName() == null_z ? NO_CLASS : string_z(CALL_SITE.GetClassName()), strFormattedProfile);
+        strFormattedProfile.Append(EVENT_THREAD);
+        strFormattedProfile.Append(THREAD_ID);
+        strFormattedProfile.Append(EVENT_TIMESTAMP);
+        CallProfileChromeTraceFormatter::_AppendMicroseconds(START_TIME, strFormattedProfile);
+        strFormattedProfile.Append(EVENT_DURATION);
+        CallProfileChromeTraceFormatter::_AppendMicroseconds(CALL_SITE.GetInclusiveTime(), strFormattedProfile);
+        strFormattedProfile.Append(EVENT_CALLS);
+        strFormattedProfile.Append(CALL_SITE.GetCallCount());
+        strFormattedProfile.Append(EVENT_EXCLUSIVE_TIME);
+        strFormattedProfile.Append(CALL_SITE.GetExclusiveTime());
+        strFormattedProfile.Append(EVENT_MINIMUM_TIME);
+        strFormattedProfile.Append(CALL_SITE.GetMinimumTime());
+        strFormattedProfile.Append(EVENT_MAXIMUM_TIME);
+        strFormattedProfile.Append(CALL_SITE.GetMaximumTime());
+        strFormattedProfile.Append(EVENT_END);
+    }
+}
+
+string_z CallProfileChromeTraceFormatter::ToString() const
+{
+    static const string_z CLASS_NAME("CallProfileChromeTraceFormatter");
+    return CLASS_NAME;
+}
+
+void CallProfileChromeTraceFormatter::_AppendJsonString(const string_z &strText, string_z &strFormattedProfile)
+{
+    static const string_z QUOTATION_MARK("\"");
+    static const string_z BACKSLASH("\\");
+    static const string_z ESCAPED_QUOTATION_MARK("\\\"");
+    static const string_z ESCAPED_BACKSLASH("\\\\");
+
+    string_z strEscapedText(strText);
+    strEscapedText.Replace(BACKSLASH, ESCAPED_BACKSLASH);
+    strEscapedText.Replace(QUOTATION_MARK, ESCAPED_QUOTATION_MARK);
+
+    strFormattedProfile.Append(QUOTATION_MARK);
+    strFormattedProfile.Append(strEscapedText);
+    strFormattedProfile.Append(QUOTATION_MARK);
+}
+
+void CallProfileChromeTraceFormatter::_AppendMicroseconds(const u64_z uNanoseconds, string_z &strFormattedProfile)
+{
+    static const u64_z NANOSECONDS_IN_MICROSECOND = 1000ULL;
+    static const string_z DECIMAL_SEPARATOR(".");
+    static const string_z ZERO("0");
+
+    const u64_z DECIMALS = uNanoseconds % NANOSECONDS_IN_MICROSECOND;
+
+    strFormattedProfile.Append(uNanoseconds / NANOSECONDS_IN_MICROSECOND);
+    strFormattedProfile.Append(DECIMAL_SEPARATOR);
+
+    if(DECIMALS < 100ULL)
+        strFormattedProfile.Append(ZERO);
+
+    if(DECIMALS < 10ULL)
+        strFormattedProfile.Append(ZERO);
+
+    strFormattedProfile.Append(DECIMALS);
+}
+
+} // namespace z
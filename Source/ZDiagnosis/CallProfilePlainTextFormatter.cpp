@@ -0,0 +1,187 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZDiagnosis/CallProfilePlainTextFormatter.h"
+
+#include "ZContainers/ArrayDynamic.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+Z_RTTI_SUPPORT_TYPE_DEFINITION(CallProfilePlainTextFormatter);
+    
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallProfilePlainTextFormatter::~CallProfilePlainTextFormatter()
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void CallProfilePlainTextFormatter::FormatCallProfilesFooter(string_z &strFormattedProfile) const
+{
+    static const string_z FOOTER("End of call profile information.\n");
+    strFormattedProfile.Append(FOOTER);
+}
+
+void CallProfilePlainTextFormatter::FormatCallProfilesHeader(string_z &strFormattedProfile) const
+{
+    // Nothing
+}
+
+void CallProfilePlainTextFormatter::FormatCallProfile(const CallProfile &profile, const puint_z uProfileIndex, string_z &strFormattedProfile) const
+{
+    static const string_z HEADER("Call profile for ");
+    static const string_z NEW_LINE("\n");
+    static const string_z COLUMN_SEPARATOR("  ");
+    static const string_z CALLS_COLUMN("Calls");
+    static const string_z INCLUSIVE_COLUMN("Inclusive(ns)");
+    static const string_z EXCLUSIVE_COLUMN("Exclusive(ns)");
+    static const string_z MINIMUM_COLUMN("Minimum(ns)");
+    static const string_z MAXIMUM_COLUMN("Maximum(ns)");
+    static const string_z FUNCTION_COLUMN("Function");
+    static const unsigned int COLUMN_WIDTH = 14U;
+
+    strFormattedProfile.Append(HEADER);
+    strFormattedProfile.Append(profile.GetThreadId());
+    strFormattedProfile.Append(NEW_LINE);
+
+    // Call sites of the same function are combined
+    ArrayDynamic<CallSiteProfile> arFunctions;
+    ArrayDynamic<puint_z> arAncestors;
+
+    for(puint_z i = 0; i < profile.GetCount(); ++i)
+    {
+        const CallSiteProfile& CALL_SITE = profile.GetCallSite(i);
+        const unsigned int DEPTH = CALL_SITE.GetDepth();
+
+        // Recursive calls are already included in the inclusive time of an ancestor
+        bool bIsRecursive = false;
+
+        for(unsigned int j = 0; j < DEPTH && !bIsRecursive; ++j)
+            bIsRecursive = profile.GetCallSite(arAncestors[j]).IsSameFunction(CALL_SITE);
+
+        if(DEPTH < arAncestors.GetCount())
+            arAncestors[DEPTH] = i;
+        else
+            arAncestors.Add(i);
+
+        const CallSiteProfile FUNCTION(CALL_SITE.GetFunctionSignature(),
+                                       CALL_SITE.GetClassName(),
+                                       0,
+                                       CALL_SITE.GetCallCount(),
+                                       bIsRecursive ? 0 : CALL_SITE.GetInclusiveTime(),
+                                       CALL_SITE.GetExclusiveTime(),
+                                       CALL_SITE.GetMinimumTime(),
+                                       CALL_SITE.GetMaximumTime());
+        puint_z uFunction = 0;
+
+        while(uFunction < arFunctions.GetCount() && !arFunctions[uFunction].IsSameFunction(FUNCTION))
+            ++uFunction;
+
+        if(uFunction == arFunctions.GetCount())
+            arFunctions.Add(FUNCTION);
+        else
+            arFunctions[uFunction].Merge(FUNCTION);
+    }
+
+    // Insertion sort by exclusive time, from the highest to the lowest
+    for(puint_z i = 1U; i < arFunctions.GetCount(); ++i)
+    {
+        puint_z j = i;
+
+        while(j > 0 && arFunctions[j - 1U].GetExclusiveTime() < arFunctions[j].GetExclusiveTime())
+        {
+            arFunctions.Swap(j - 1U, j);
+            --j;
+        }
+    }
+
+    CallProfilePlainTextFormatter::_AppendRightAligned(CALLS_COLUMN, COLUMN_WIDTH, strFormattedProfile);
+    CallProfilePlainTextFormatter::_AppendRightAligned(INCLUSIVE_COLUMN, COLUMN_WIDTH, strFormattedProfile);
+    CallProfilePlainTextFormatter::_AppendRightAligned(EXCLUSIVE_COLUMN, COLUMN_WIDTH, strFormattedProfile);
+    CallProfilePlainTextFormatter::_AppendRightAligned(MINIMUM_COLUMN, COLUMN_WIDTH, strFormattedProfile);
+    CallProfilePlainTextFormatter::_AppendRightAligned(MAXIMUM_COLUMN, COLUMN_WIDTH, strFormattedProfile);
+    strFormattedProfile.Append(COLUMN_SEPARATOR);
+    strFormattedProfile.Append(FUNCTION_COLUMN);
+    strFormattedProfile.Append(NEW_LINE);
+
+    for(puint_z i = 0; i < arFunctions.GetCount(); ++i)
+    {
+        CallProfilePlainTextFormatter::_AppendRightAligned(string_z::FromInteger(arFunctions[i].GetCallCount()), COLUMN_WIDTH, strFormattedProfile);
+        CallProfilePlainTextFormatter::_AppendRightAligned(string_z::FromInteger(arFunctions[i].GetInclusiveTime()), COLUMN_WIDTH, strFormattedProfile);
+        CallProfilePlainTextFormatter::_AppendRightAligned(string_z::FromInteger(arFunctions[i].GetExclusiveTime()), COLUMN_WIDTH, strFormattedProfile);
+        CallProfilePlainTextFormatter::_AppendRightAligned(string_z::FromInteger(arFunctions[i].GetMinimumTime()), COLUMN_WIDTH, strFormattedProfile);
+        CallProfilePlainTextFormatter::_AppendRightAligned(string_z::FromInteger(arFunctions[i].GetMaximumTime()), COLUMN_WIDTH, strFormattedProfile);
+        strFormattedProfile.Append(COLUMN_SEPARATOR);
+        strFormattedProfile.Append(arFunctions[i].GetFunctionSignature());
+        strFormattedProfile.Append(NEW_LINE);
+    }
+}
+
+string_z CallProfilePlainTextFormatter::ToString() const
+{
+    static const string_z CLASS_NAME("CallProfilePlainTextFormatter");
+    return CLASS_NAME;
+}
+
+void CallProfilePlainTextFormatter::_AppendRightAligned(const string_z &strText, const unsigned int uWidth, string_z &strFormattedProfile)
+{
+    static const string_z SPACE(" ");
+
+    for(unsigned int i = strText.GetLength(); i < uWidth; ++i)
+        strFormattedProfile.Append(SPACE);
+
+    strFormattedProfile.Append(strText);
+}
+
+} // namespace z
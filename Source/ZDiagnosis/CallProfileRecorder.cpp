@@ -0,0 +1,320 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZDiagnosis/CallProfileRecorder.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const puint_z CallProfileRecorder::NO_NODE = -1;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallProfileRecorder::CallProfileRecorder(const string_z &strThreadId) : m_uNodeCount(0),
+                                                                        m_uFirstRootNode(CallProfileRecorder::NO_NODE),
+                                                                        m_stopwatch(EClockSource::E_TimestampCounter),
+                                                                        m_strThreadId(strThreadId)
+{
+    for(puint_z i = 0; i < CallProfileRecorder::MAXIMUM_CHUNKS; ++i)
+        m_arChunks[i] = null_z;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallProfileRecorder::~CallProfileRecorder()
+{
+    for(puint_z i = 0; i < CallProfileRecorder::MAXIMUM_CHUNKS && m_arChunks[i] != null_z; ++i)
+        delete[] m_arChunks[i];
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void CallProfileRecorder::BeginCall(const CallTrace &trace)
+{
+    const puint_z PARENT_NODE = m_arCallFrames.IsEmpty() ? CallProfileRecorder::NO_NODE : 
+                                                           m_arCallFrames[m_arCallFrames.GetCount() - 1U].m_uNode;
+
+    // If the parent is not being profiled, neither are its callees
+    const puint_z NODE = m_arCallFrames.IsEmpty() || PARENT_NODE != CallProfileRecorder::NO_NODE ? this->_FindOrAddNode(PARENT_NODE, trace) : 
+                                                                                                   CallProfileRecorder::NO_NODE;
+
+    // The stopwatch is set at the end so the search is not measured
+    m_arCallFrames.Add(CallFrame(NODE, m_stopwatch));
+    m_arCallFrames[m_arCallFrames.GetCount() - 1U].m_stopwatch.Set();
+}
+
+void CallProfileRecorder::EndCall()
+{
+    Z_ASSERT_ERROR(!m_arCallFrames.IsEmpty(), "There are no calls to end.");
+
+    const puint_z LAST_FRAME = m_arCallFrames.GetCount() - 1U;
+    const CallFrame& FRAME = m_arCallFrames[LAST_FRAME];
+    const u64_z ELAPSED_TIME = FRAME.m_stopwatch.GetElapsedTimeAsInteger();
+
+    if(FRAME.m_uNode != CallProfileRecorder::NO_NODE)
+    {
+        CallNode& node = this->_GetNode(FRAME.m_uNode);
+
+        // Only this thread writes the statistics, so there is no need for read-modify-write operations
+        const u64_z CALL_COUNT = node.m_uCallCount.load(boost::memory_order_relaxed);
+        const u64_z MINIMUM_TIME = node.m_uMinimumTime.load(boost::memory_order_relaxed);
+        const u64_z MAXIMUM_TIME = node.m_uMaximumTime.load(boost::memory_order_relaxed);
+        const u64_z EXCLUSIVE_TIME = ELAPSED_TIME > FRAME.m_uCalleesTime ? ELAPSED_TIME - FRAME.m_uCalleesTime : 
+                                                                           0;
+
+        node.m_uInclusiveTime.store(node.m_uInclusiveTime.load(boost::memory_order_relaxed) + ELAPSED_TIME, boost::memory_order_relaxed);
+        node.m_uExclusiveTime.store(node.m_uExclusiveTime.load(boost::memory_order_relaxed) + EXCLUSIVE_TIME, boost::memory_order_relaxed);
+
+        if(CALL_COUNT == 0 || ELAPSED_TIME < MINIMUM_TIME)
+            node.m_uMinimumTime.store(ELAPSED_TIME, boost::memory_order_relaxed);
+
+        if(ELAPSED_TIME > MAXIMUM_TIME)
+            node.m_uMaximumTime.store(ELAPSED_TIME, boost::memory_order_relaxed);
+
+        node.m_uCallCount.store(CALL_COUNT + 1U, boost::memory_order_relaxed);
+    }
+
+    m_arCallFrames.Remove(LAST_FRAME);
+
+    if(!m_arCallFrames.IsEmpty())
+        m_arCallFrames[LAST_FRAME - 1U].m_uCalleesTime += ELAPSED_TIME;
+}
+
+CallProfile CallProfileRecorder::GetProfile() const
+{
+    CallProfile profile(m_strThreadId);
+
+    // Nodes below this number are fully initialized and visible
+    const puint_z NODE_COUNT = m_uNodeCount.load(boost::memory_order_acquire);
+
+    if(NODE_COUNT > 0)
+    {
+        // The links between nodes are only accessed by the owner thread, so they are rebuilt from the parents, which never change.
+        // Children are always created after their parents
+        ArrayDynamic<puint_z> arFirstChildren(NODE_COUNT);
+        ArrayDynamic<puint_z> arLastChildren(NODE_COUNT);
+        ArrayDynamic<puint_z> arNextSiblings(NODE_COUNT);
+        puint_z uFirstRoot = CallProfileRecorder::NO_NODE;
+        puint_z uLastRoot = CallProfileRecorder::NO_NODE;
+
+        for(puint_z i = 0; i < NODE_COUNT; ++i)
+        {
+            arFirstChildren.Add(CallProfileRecorder::NO_NODE);
+            arLastChildren.Add(CallProfileRecorder::NO_NODE);
+            arNextSiblings.Add(CallProfileRecorder::NO_NODE);
+
+            const puint_z PARENT = this->_GetNode(i).m_uParent;
+
+            if(PARENT == CallProfileRecorder::NO_NODE)
+            {
+                if(uFirstRoot == CallProfileRecorder::NO_NODE)
+                    uFirstRoot = i;
+                else
+                    arNextSiblings[uLastRoot] = i;
+
+                uLastRoot = i;
+            }
+            else
+            {
+                if(arFirstChildren[PARENT] == CallProfileRecorder::NO_NODE)
+                    arFirstChildren[PARENT] = i;
+                else
+                    arNextSiblings[arLastChildren[PARENT]] = i;
+
+                arLastChildren[PARENT] = i;
+            }
+        }
+
+        // Depth-first traversal; every pending node is stored along with the position of its parent in the profile
+        ArrayDynamic<puint_z> arPendingNodes;
+        ArrayDynamic<puint_z> arPendingParents;
+        arPendingNodes.Add(uFirstRoot);
+        arPendingParents.Add(CallProfile::NO_PARENT);
+
+        while(!arPendingNodes.IsEmpty())
+        {
+            const puint_z LAST_PENDING = arPendingNodes.GetCount() - 1U;
+            const puint_z NODE_INDEX = arPendingNodes[LAST_PENDING];
+            const puint_z PARENT_POSITION = arPendingParents[LAST_PENDING];
+            arPendingNodes.Remove(LAST_PENDING);
+            arPendingParents.Remove(LAST_PENDING);
+
+            const CallNode& NODE = this->_GetNode(NODE_INDEX);
+            const u64_z CALL_COUNT = NODE.m_uCallCount.load(boost::memory_order_relaxed);
+            const CallSiteProfile CALL_SITE(NODE.m_szFunctionSignature,
+                                            NODE.m_szClassName,
+                                            0,
+                                            CALL_COUNT,
+                                            NODE.m_uInclusiveTime.load(boost::memory_order_relaxed),
+                                            NODE.m_uExclusiveTime.load(boost::memory_order_relaxed),
+                                            CALL_COUNT == 0 ? 0 : NODE.m_uMinimumTime.load(boost::memory_order_relaxed),
+                                            NODE.m_uMaximumTime.load(boost::memory_order_relaxed));
+        
+            const puint_z POSITION = profile.AddCallSite(PARENT_POSITION, CALL_SITE);
+
+            // The next sibling is pushed before the first child so the subtree is visited first
+            if(arNextSiblings[NODE_INDEX] != CallProfileRecorder::NO_NODE)
+            {
+                arPendingNodes.Add(arNextSiblings[NODE_INDEX]);
+                arPendingParents.Add(PARENT_POSITION);
+            }
+
+            if(arFirstChildren[NODE_INDEX] != CallProfileRecorder::NO_NODE)
+            {
+                arPendingNodes.Add(arFirstChildren[NODE_INDEX]);
+                arPendingParents.Add(POSITION);
+            }
+        }
+    }
+
+    return profile;
+}
+
+puint_z CallProfileRecorder::_FindOrAddNode(const puint_z uParent, const CallTrace &trace)
+{
+    const char* szFunctionSignature = trace.GetFunctionSignature();
+    const char* szClassName = trace.GetClassName();
+
+    // Call sites are identified by the address of the strings, which is enough when they are string literals
+    puint_z uNode = uParent == CallProfileRecorder::NO_NODE ? m_uFirstRootNode : 
+                                                              this->_GetNode(uParent).m_uFirstChild;
+    puint_z uLastSibling = CallProfileRecorder::NO_NODE;
+    bool bFound = false;
+
+    while(!bFound && uNode != CallProfileRecorder::NO_NODE)
+    {
+        const CallNode& NODE = this->_GetNode(uNode);
+
+        if(NODE.m_szFunctionSignature == szFunctionSignature && NODE.m_szClassName == szClassName)
+        {
+            bFound = true;
+        }
+        else
+        {
+            uLastSibling = uNode;
+            uNode = NODE.m_uNextSibling;
+        }
+    }
+
+    // If not found, a new node is created
+    if(!bFound)
+    {
+        const puint_z NEW_NODE = m_uNodeCount.load(boost::memory_order_relaxed);
+        const puint_z CHUNK = NEW_NODE / CallProfileRecorder::NODES_PER_CHUNK;
+
+        if(CHUNK == CallProfileRecorder::MAXIMUM_CHUNKS)
+        {
+            Z_ASSERT_WARNING(false, "The maximum number of call sites has been reached, new calls will not be profiled.");
+        }
+        else
+        {
+            if(m_arChunks[CHUNK] == null_z)
+                m_arChunks[CHUNK] = new CallNode[CallProfileRecorder::NODES_PER_CHUNK];
+
+            CallNode& newNode = m_arChunks[CHUNK][NEW_NODE % CallProfileRecorder::NODES_PER_CHUNK];
+            newNode.m_szFunctionSignature = szFunctionSignature;
+            newNode.m_szClassName = szClassName;
+            newNode.m_uParent = uParent;
+            newNode.m_uFirstChild = CallProfileRecorder::NO_NODE;
+            newNode.m_uNextSibling = CallProfileRecorder::NO_NODE;
+            newNode.m_uCallCount.store(0, boost::memory_order_relaxed);
+            newNode.m_uInclusiveTime.store(0, boost::memory_order_relaxed);
+            newNode.m_uExclusiveTime.store(0, boost::memory_order_relaxed);
+            newNode.m_uMinimumTime.store(0, boost::memory_order_relaxed);
+            newNode.m_uMaximumTime.store(0, boost::memory_order_relaxed);
+
+            if(uLastSibling != CallProfileRecorder::NO_NODE)
+                this->_GetNode(uLastSibling).m_uNextSibling = NEW_NODE;
+            else if(uParent != CallProfileRecorder::NO_NODE)
+                this->_GetNode(uParent).m_uFirstChild = NEW_NODE;
+            else
+                m_uFirstRootNode = NEW_NODE;
+
+            // Publishes the node to the threads that read the statistics
+            m_uNodeCount.store(NEW_NODE + 1U, boost::memory_order_release);
+
+            uNode = NEW_NODE;
+        }
+    }
+
+    return uNode;
+}
+
+CallProfileRecorder::CallNode& CallProfileRecorder::_GetNode(const puint_z uIndex) const
+{
+    return m_arChunks[uIndex / CallProfileRecorder::NODES_PER_CHUNK][uIndex % CallProfileRecorder::NODES_PER_CHUNK];
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+string_z CallProfileRecorder::GetThreadId() const
+{
+    return m_strThreadId;
+}
+
+} // namespace z
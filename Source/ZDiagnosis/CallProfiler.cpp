@@ -0,0 +1,187 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZDiagnosis/CallProfiler.h"
+
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZThreading/ScopedSharedLock.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallProfiler::CallProfiler() : m_pThreadRecorder(&CallProfiler::_KeepRecorder),
+                               m_bIsEnabled(false)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallProfiler::~CallProfiler()
+{
+    for(puint_z i = 0; i < m_arRecorders.GetCount(); ++i)
+        delete m_arRecorders[i];
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallProfiler* CallProfiler::Get()
+{
+    static CallProfiler callProfilerInstance;
+
+    return &callProfilerInstance;
+}
+
+void CallProfiler::BeginCall(const CallTrace &trace)
+{
+    this->_GetOrCreateRecorder()->BeginCall(trace);
+}
+
+void CallProfiler::EndCall()
+{
+    CallProfileRecorder* pRecorder = m_pThreadRecorder.get();
+
+    Z_ASSERT_ERROR(pRecorder != null_z, "The current thread has not begun any call.");
+
+    pRecorder->EndCall();
+}
+
+CallProfile CallProfiler::GetProfile() const
+{
+    const CallProfileRecorder* pRecorder = m_pThreadRecorder.get();
+
+    return pRecorder == null_z ? CallProfile(SThisThread::ToString()) : 
+                                 pRecorder->GetProfile();
+}
+
+ArrayDynamic<CallProfile> CallProfiler::GetThreadProfiles() const
+{
+    ArrayDynamic<CallProfile> arProfiles;
+
+    // ---------- Critical section -----------
+    {
+        ScopedSharedLock<SharedMutex> sharedLock(m_recordersMutex);
+
+        for(puint_z i = 0; i < m_arRecorders.GetCount(); ++i)
+            arProfiles.Add(m_arRecorders[i]->GetProfile());
+
+    } // --------- Critical section ----------
+
+    return arProfiles;
+}
+
+CallProfile CallProfiler::GetMergedProfile() const
+{
+    static const string_z MERGED_PROFILE_ID("All threads");
+
+    CallProfile mergedProfile(MERGED_PROFILE_ID);
+
+    // ---------- Critical section -----------
+    {
+        ScopedSharedLock<SharedMutex> sharedLock(m_recordersMutex);
+
+        for(puint_z i = 0; i < m_arRecorders.GetCount(); ++i)
+            mergedProfile.Merge(m_arRecorders[i]->GetProfile());
+
+    } // --------- Critical section ----------
+
+    return mergedProfile;
+}
+
+CallProfileRecorder* CallProfiler::_GetOrCreateRecorder()
+{
+    CallProfileRecorder* pRecorder = m_pThreadRecorder.get();
+
+    if(pRecorder == null_z)
+    {
+        pRecorder = new CallProfileRecorder(SThisThread::ToString());
+        m_pThreadRecorder.reset(pRecorder);
+
+        // ---------- Critical section -----------
+        {
+            ScopedExclusiveLock<SharedMutex> exclusiveLock(m_recordersMutex);
+
+            m_arRecorders.Add(pRecorder);
+
+        } // --------- Critical section ----------
+    }
+
+    return pRecorder;
+}
+
+void CallProfiler::_KeepRecorder(CallProfileRecorder* pRecorder)
+{
+    // Nothing, the recorder is deleted by the profiler
+    (void)pRecorder;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+bool CallProfiler::IsEnabled() const
+{
+    return m_bIsEnabled.load(boost::memory_order_relaxed);
+}
+
+void CallProfiler::SetEnabled(const bool bIsEnabled)
+{
+    m_bIsEnabled.store(bIsEnabled, boost::memory_order_relaxed);
+}
+
+} // namespace z
@@ -0,0 +1,159 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZDiagnosis/CallSiteProfile.h"
+
+#include <cstring>
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/DataTypes/StringsDefinitions.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CallSiteProfile::CallSiteProfile(const char* szFunctionSignature, 
+                                 const char* szClassName, 
+                                 const unsigned int uDepth, 
+                                 const u64_z uCallCount, 
+                                 const u64_z uInclusiveTime, 
+                                 const u64_z uExclusiveTime, 
+                                 const u64_z uMinimumTime, 
+                                 const u64_z uMaximumTime) :
+                                                m_szFunctionSignature(szFunctionSignature),
+                                                m_szClassName(szClassName),
+                                                m_uDepth(uDepth),
+                                                m_uCallCount(uCallCount),
+                                                m_uInclusiveTime(uInclusiveTime),
+                                                m_uExclusiveTime(uExclusiveTime),
+                                                m_uMinimumTime(uMinimumTime),
+                                                m_uMaximumTime(uMaximumTime)
+{
+    Z_ASSERT_ERROR(szFunctionSignature != null_z, "The function signature must not be null.");
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+bool CallSiteProfile::IsSameFunction(const CallSiteProfile &callSite) const
+{
+    // Pointers are compared first since the signatures usually come from the same string literal
+    const bool SAME_SIGNATURE = m_szFunctionSignature == callSite.m_szFunctionSignature ||
+                                strcmp(m_szFunctionSignature, callSite.m_szFunctionSignature) == 0;
+
+    const bool SAME_CLASS = m_szClassName == callSite.m_szClassName ||
+                            (m_szClassName != null_z && callSite.m_szClassName != null_z && strcmp(m_szClassName, callSite.m_szClassName) == 0);
+
+    return SAME_SIGNATURE && SAME_CLASS;
+}
+
+void CallSiteProfile::Merge(const CallSiteProfile &callSite)
+{
+    if(callSite.m_uCallCount > 0)
+    {
+        m_uMinimumTime = m_uCallCount == 0 || callSite.m_uMinimumTime < m_uMinimumTime ? callSite.m_uMinimumTime : 
+                                                                                         m_uMinimumTime;
+        m_uMaximumTime = callSite.m_uMaximumTime > m_uMaximumTime ? callSite.m_uMaximumTime : 
+                                                                    m_uMaximumTime;
+    }
+
+    m_uCallCount += callSite.m_uCallCount;
+    m_uInclusiveTime += callSite.m_uInclusiveTime;
+    m_uExclusiveTime += callSite.m_uExclusiveTime;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const char* CallSiteProfile::GetFunctionSignature() const
+{
+    return m_szFunctionSignature;
+}
+
+const char* CallSiteProfile::GetClassName() const
+{
+    return m_szClassName;
+}
+
+unsigned int CallSiteProfile::GetDepth() const
+{
+    return m_uDepth;
+}
+
+void CallSiteProfile::SetDepth(const unsigned int uDepth)
+{
+    m_uDepth = uDepth;
+}
+
+u64_z CallSiteProfile::GetCallCount() const
+{
+    return m_uCallCount;
+}
+
+u64_z CallSiteProfile::GetInclusiveTime() const
+{
+    return m_uInclusiveTime;
+}
+
+u64_z CallSiteProfile::GetExclusiveTime() const
+{
+    return m_uExclusiveTime;
+}
+
+u64_z CallSiteProfile::GetMinimumTime() const
+{
+    return m_uMinimumTime;
+}
+
+u64_z CallSiteProfile::GetMaximumTime() const
+{
+    return m_uMaximumTime;
+}
+
+} // namespace z
@@ -49,7 +49,8 @@ namespace z
 //##################                                                       ##################
 //##################=======================================================##################
 
-CallStackTracer::CallStackTracer() : m_pPrinter((AbstractCallStackTracePrinter*)null_z)
+CallStackTracer::CallStackTracer() : m_callStackTracePool(1U),
+                                     m_pPrinter((AbstractCallStackTracePrinter*)null_z)
 {
 }
 
@@ -85,7 +86,7 @@ void CallStackTracer::AddTrace(const CallTrace &trace)
         if(CALLSTACKTRACE_DOES_NOT_EXIST)
         {
             // Creates a new call stack trace
-            CallStackTrace* pNewCallStackTrace = new CallStackTrace(SThisThread::ToString());
+            CallStackTrace* pNewCallStackTrace = m_callStackTracePool.Borrow(SThisThread::ToString());
             itCallStackTrace = m_callStackTraces.Add(threadId, pNewCallStackTrace);
         }
 
@@ -106,7 +107,10 @@ void CallStackTracer::RemoveLastTrace()
 
         // If there are no more traces in the call stack of the current thread, the stack is completely removed
         if(itCallStackTrace->GetValue()->GetCount() == 0)
+        {
+            m_callStackTracePool.Return(itCallStackTrace->GetValue());
             m_callStackTraces.Remove(itCallStackTrace);
+        }
 
     } // --------- Critical section ----------
 }
@@ -27,6 +27,7 @@
 #include "ZDiagnosis/ScopedCallTraceNotifier.h"
 
 #include "ZDiagnosis/CallStackTracer.h"
+#include "ZDiagnosis/CallProfiler.h"
 
 
 namespace z
@@ -41,9 +42,16 @@ namespace z
 //##################                                                       ##################
 //##################=======================================================##################
 
-ScopedCallTraceNotifier::ScopedCallTraceNotifier(const CallTrace &trace)
+ScopedCallTraceNotifier::ScopedCallTraceNotifier(const CallTrace &trace) : m_bIsProfiled(false)
 {
     CallStackTracer::Get()->AddTrace(trace);
+
+    // The profiler begins last so the tracer is not measured
+    if(CallProfiler::Get()->IsEnabled())
+    {
+        CallProfiler::Get()->BeginCall(trace);
+        m_bIsProfiled = true;
+    }
 }
     
     
@@ -58,6 +66,9 @@ ScopedCallTraceNotifier::ScopedCallTraceNotifier(const CallTrace &trace)
 
 ScopedCallTraceNotifier::~ScopedCallTraceNotifier()
 {
+    if(m_bIsProfiled)
+        CallProfiler::Get()->EndCall();
+
     CallStackTracer::Get()->RemoveLastTrace();
 }
 
@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZFileSystem/AsyncFileRead.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZFileSystem/FileStream.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+AsyncFileRead::AsyncFileRead(FileStream &stream, void* pOutput, const puint_z uOutputOffset, const puint_z uOutputSize) : AsyncTask(true),
+                                                                                                                          m_pStream(&stream),
+                                                                                                                          m_pOutput(pOutput),
+                                                                                                                          m_uOutputOffset(uOutputOffset),
+                                                                                                                          m_uOutputSize(uOutputSize)
+{
+    Z_ASSERT_ERROR(pOutput != null_z, "The output buffer cannot be null.");
+    Z_ASSERT_ERROR(uOutputSize > 0, "The number of bytes to read must be greater than zero.");
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+bool AsyncFileRead::Resume()
+{
+    m_pStream->Read(m_pOutput, m_uOutputOffset, m_uOutputSize);
+
+    return true;
+}
+
+} // namespace z
@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZFileSystem/AsyncFileWrite.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZFileSystem/FileStream.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+AsyncFileWrite::AsyncFileWrite(FileStream &stream, const void* pInput, const puint_z uInputOffset, const puint_z uInputSize) : AsyncTask(true),
+                                                                                                                              m_pStream(&stream),
+                                                                                                                              m_pInput(pInput),
+                                                                                                                              m_uInputOffset(uInputOffset),
+                                                                                                                              m_uInputSize(uInputSize)
+{
+    Z_ASSERT_ERROR(pInput != null_z, "The input buffer cannot be null.");
+    Z_ASSERT_ERROR(uInputSize > 0, "The number of bytes to write must be greater than zero.");
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+bool AsyncFileWrite::Resume()
+{
+    m_pStream->Write(m_pInput, m_uInputOffset, m_uInputSize);
+    m_pStream->Flush();
+
+    return true;
+}
+
+} // namespace z
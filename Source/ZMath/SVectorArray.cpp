@@ -361,6 +361,16 @@ void SVectorArray::Transform(const TransformationMatrix4x4 &transformation, Vect
     }
 }
 
+void SVectorArray::Transform(const TransformationMatrix4x3 &transformation, float_z* arX, float_z* arY, float_z* arZ, const unsigned int uElements)
+{
+    SVectorArray::TransformImp(transformation, arX, arY, arZ, uElements);
+}
+
+void SVectorArray::Transform(const TransformationMatrix4x4 &transformation, float_z* arX, float_z* arY, float_z* arZ, const unsigned int uElements)
+{
+    SVectorArray::TransformImp(transformation, arX, arY, arZ, uElements);
+}
+
 void SVectorArray::Transform(const SpaceConversionMatrix &spaceConversion, Vector3* arPoints, const unsigned int uElements)
 {
     // Checks that the point array is not null
@@ -668,4 +678,56 @@ void SVectorArray::TransformWithPivot(const TransformationMatrix4x4 &transformat
     }
 }
 
+template <class MatrixT>
+void SVectorArray::TransformImp(const Internals::TransformationMatrix<MatrixT> &transformation, float_z* arX, float_z* arY, float_z* arZ,
+                                const unsigned int uElements)
+{
+    // Checks that the point arrays are not null
+    Z_ASSERT_ERROR( arX != null_z && arY != null_z && arZ != null_z, "Input arrays must not be null" );
+
+    unsigned int i = 0;
+
+#if Z_FLOAT_SIZE == 4
+    // Every component of the result is a linear combination of the same component of 4 consecutive points, so 4 points are
+    // transformed at once with packed operations
+    const __m128 M00 = _mm_set1_ps(transformation.ij[0][0]);
+    const __m128 M01 = _mm_set1_ps(transformation.ij[0][1]);
+    const __m128 M02 = _mm_set1_ps(transformation.ij[0][2]);
+    const __m128 M10 = _mm_set1_ps(transformation.ij[1][0]);
+    const __m128 M11 = _mm_set1_ps(transformation.ij[1][1]);
+    const __m128 M12 = _mm_set1_ps(transformation.ij[1][2]);
+    const __m128 M20 = _mm_set1_ps(transformation.ij[2][0]);
+    const __m128 M21 = _mm_set1_ps(transformation.ij[2][1]);
+    const __m128 M22 = _mm_set1_ps(transformation.ij[2][2]);
+    const __m128 M30 = _mm_set1_ps(transformation.ij[3][0]);
+    const __m128 M31 = _mm_set1_ps(transformation.ij[3][1]);
+    const __m128 M32 = _mm_set1_ps(transformation.ij[3][2]);
+
+    static const unsigned int PACK_SIZE = 4U;
+    const unsigned int PACKED_ELEMENTS = uElements - uElements % PACK_SIZE;
+
+    for(; i < PACKED_ELEMENTS; i += PACK_SIZE)
+    {
+        const __m128 X = _mm_loadu_ps(arX + i);
+        const __m128 Y = _mm_loadu_ps(arY + i);
+        const __m128 Z = _mm_loadu_ps(arZ + i);
+
+        _mm_storeu_ps(arX + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M00), _mm_mul_ps(Y, M10)), _mm_add_ps(_mm_mul_ps(Z, M20), M30)));
+        _mm_storeu_ps(arY + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M01), _mm_mul_ps(Y, M11)), _mm_add_ps(_mm_mul_ps(Z, M21), M31)));
+        _mm_storeu_ps(arZ + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(X, M02), _mm_mul_ps(Y, M12)), _mm_add_ps(_mm_mul_ps(Z, M22), M32)));
+    }
+#endif
+
+    for(; i < uElements; ++i)
+    {
+        const float_z fX = arX[i];
+        const float_z fY = arY[i];
+        const float_z fZ = arZ[i];
+
+        arX[i] = fX * transformation.ij[0][0] + fY * transformation.ij[1][0] + fZ * transformation.ij[2][0] + transformation.ij[3][0];
+        arY[i] = fX * transformation.ij[0][1] + fY * transformation.ij[1][1] + fZ * transformation.ij[2][1] + transformation.ij[3][1];
+        arZ[i] = fX * transformation.ij[0][2] + fY * transformation.ij[1][2] + fZ * transformation.ij[2][2] + transformation.ij[3][2];
+    }
+}
+
 } // namespace z
@@ -0,0 +1,160 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZMemory/ContiguousAllocator.h"
+#include "ZCommon/AllocationOperators.h"
+// To use memcpy
+#include <cstring>
+
+#include "ZCommon/Assertions.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+ContiguousAllocator::ContiguousAllocator(const puint_z uSize, const puint_z uBlockSize, const Alignment &alignment) :
+            m_pBuffer(null_z),
+            m_uPoolSize(uSize),
+            m_uAllocatedBytes(0),
+            m_uBlockSize(uBlockSize),
+            m_uAlignment(alignment)
+{
+    Z_ASSERT_ERROR( 0 != uSize, "Size cannot be zero" );
+    Z_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
+
+    m_pBuffer = aligned_alloc_z(m_uPoolSize, m_uAlignment);
+    Z_ASSERT_ERROR( null_z != m_pBuffer, "Pointer to allocated memory is null" );
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+ContiguousAllocator::~ContiguousAllocator()
+{
+    aligned_free_z(m_pBuffer);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void* ContiguousAllocator::Allocate()
+{
+    if(m_uAllocatedBytes + m_uBlockSize > m_uPoolSize)
+        return null_z;
+
+    void* pBlock = scast_z(m_pBuffer, u8_z*) + m_uAllocatedBytes;
+    m_uAllocatedBytes += m_uBlockSize;
+
+    return pBlock;
+}
+
+void ContiguousAllocator::Deallocate(const void* pBlock)
+{
+    Z_ASSERT_ERROR( null_z != pBlock, "Pointer to block to deallocate cannot be null" );
+    Z_ASSERT_ERROR( (puint_z)pBlock >= (puint_z)m_pBuffer && (puint_z)pBlock < (puint_z)m_pBuffer + m_uPoolSize, "Pointer to block to deallocate must be an address provided by this allocator" );
+    Z_ASSERT_ERROR( m_uAllocatedBytes > 0, "There are no allocated blocks" );
+
+    m_uAllocatedBytes -= m_uBlockSize;
+}
+
+void ContiguousAllocator::Clear()
+{
+    m_uAllocatedBytes = 0;
+}
+
+void ContiguousAllocator::CopyTo(ContiguousAllocator &allocator) const
+{
+    Z_ASSERT_ERROR(m_uAllocatedBytes <= allocator.m_uPoolSize, "The size of the buffer of the destination allocator must be greater than or equal to the allocated bytes of the source allocator" );
+    Z_ASSERT_ERROR(m_uBlockSize == allocator.m_uBlockSize, "Block sizes of origin and destination allocators must be equal");
+    Z_ASSERT_WARNING(allocator.m_uAlignment == m_uAlignment, "The alignment of the input allocator is different from the resident allocator's.");
+
+    memcpy(allocator.m_pBuffer, m_pBuffer, m_uAllocatedBytes);
+    allocator.m_uAllocatedBytes = m_uAllocatedBytes;
+}
+
+void ContiguousAllocator::Reallocate(const puint_z uNewSize)
+{
+    Z_ASSERT_WARNING(uNewSize > m_uPoolSize, "The new size must be greater than the current size of the buffer.");
+
+    if(uNewSize > m_uPoolSize)
+    {
+        void* pNewBuffer = aligned_realloc_z(m_pBuffer, m_uPoolSize, uNewSize, m_uAlignment);
+        Z_ASSERT_ERROR( null_z != pNewBuffer, "Pointer to allocated memory is null" );
+
+        m_pBuffer = pNewBuffer;
+        m_uPoolSize = uNewSize;
+    }
+}
+
+void ContiguousAllocator::Swap(ContiguousAllocator &allocator)
+{
+    void* pBuffer = m_pBuffer;
+    m_pBuffer = allocator.m_pBuffer;
+    allocator.m_pBuffer = pBuffer;
+
+    const puint_z uPoolSize = m_uPoolSize;
+    m_uPoolSize = allocator.m_uPoolSize;
+    allocator.m_uPoolSize = uPoolSize;
+
+    const puint_z uAllocatedBytes = m_uAllocatedBytes;
+    m_uAllocatedBytes = allocator.m_uAllocatedBytes;
+    allocator.m_uAllocatedBytes = uAllocatedBytes;
+
+    const puint_z uBlockSize = m_uBlockSize;
+    m_uBlockSize = allocator.m_uBlockSize;
+    allocator.m_uBlockSize = uBlockSize;
+
+    const Alignment alignment = m_uAlignment;
+    m_uAlignment = allocator.m_uAlignment;
+    allocator.m_uAlignment = alignment;
+}
+
+
+} // namespace z
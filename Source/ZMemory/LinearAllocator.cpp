@@ -28,6 +28,7 @@
 
 #include "ZCommon/Assertions.h"
 #include "ZCommon/AllocationOperators.h"
+#include "ZMemory/SNumaMemory.h"
 #include <cstring>
 
 namespace z
@@ -56,11 +57,12 @@ namespace z
 LinearAllocator::LinearAllocator(const puint_z uSize, const Alignment &alignment) : 
                                                                  m_uSize(uSize),
                                                                  m_bUsesExternalBuffer(false),
-                                                                 m_uAlignment(alignment)
+                                                                 m_uAlignment(alignment),
+                                                                 m_eMemoryPlacement(EMemoryPlacement::E_Default)
 {
     Z_ASSERT_ERROR(uSize > 0, "The size of the buffer cannot be zero.");
 
-    m_pBase = ::operator new(uSize, alignment);
+    m_pBase = this->_AllocateBuffer(uSize);
     m_pTop = m_pBase;
 }
 
@@ -68,7 +70,8 @@ LinearAllocator::LinearAllocator(const puint_z uSize, void* pBuffer) : m_pBase(p
                                                                        m_pTop(pBuffer),
                                                                        m_uSize(uSize),
                                                                        m_bUsesExternalBuffer(true),
-                                                                       m_uAlignment(1U)
+                                                                       m_uAlignment(1U),
+                                                                       m_eMemoryPlacement(EMemoryPlacement::E_Default)
 {
     Z_ASSERT_ERROR(uSize > 0, "The size of the buffer cannot be zero.");
     Z_ASSERT_ERROR(pBuffer != null_z, "The pointer to the external buffer cannot be null.");
@@ -79,7 +82,8 @@ LinearAllocator::LinearAllocator(const puint_z uSize, void* pBuffer, const Align
                                                                                 m_pTop(pBuffer),
                                                                                 m_uSize(uSize),
                                                                                 m_bUsesExternalBuffer(true),
-                                                                                m_uAlignment(alignment)
+                                                                                m_uAlignment(alignment),
+                                                                                m_eMemoryPlacement(EMemoryPlacement::E_Default)
 {
     Z_ASSERT_ERROR(uSize > 0, "The size of the buffer cannot be zero.");
     Z_ASSERT_ERROR(pBuffer != null_z, "The pointer to the external buffer cannot be null.");
@@ -94,6 +98,18 @@ LinearAllocator::LinearAllocator(const puint_z uSize, void* pBuffer, const Align
         m_uSize -= uAdjustment; // Some free space is lost
     }
 }
+
+LinearAllocator::LinearAllocator(const puint_z uSize, const Alignment &alignment, const EMemoryPlacement &eMemoryPlacement) : 
+                                                                 m_uSize(uSize),
+                                                                 m_bUsesExternalBuffer(false),
+                                                                 m_uAlignment(alignment),
+                                                                 m_eMemoryPlacement(eMemoryPlacement)
+{
+    Z_ASSERT_ERROR(uSize > 0, "The size of the buffer cannot be zero.");
+
+    m_pBase = this->_AllocateBuffer(uSize);
+    m_pTop = m_pBase;
+}
     
 //##################=======================================================##################
 //##################             ____________________________              ##################
@@ -107,7 +123,7 @@ LinearAllocator::LinearAllocator(const puint_z uSize, void* pBuffer, const Align
 LinearAllocator::~LinearAllocator()
 {
     if(!m_bUsesExternalBuffer)
-        ::operator delete(m_pBase, Alignment(m_uAlignment));
+        this->_FreeBuffer(m_pBase);
 }
 
 
@@ -139,17 +155,21 @@ void* LinearAllocator::Allocate(const puint_z uSize)
 void* LinearAllocator::Allocate(const puint_z uSize, const Alignment &alignment)
 {
     Z_ASSERT_ERROR(uSize > 0, "The size of the memory block to be allocated cannot be zero.");
-    Z_ASSERT_WARNING(this->CanAllocate(uSize, alignment), "The size of the memory block to be allocated (plus the alignment adjustment) does not fit in the available free space.");
 
     void* pAllocatedMemory = null_z;
 
-    if(this->CanAllocate(uSize, alignment))
-    {
-        puint_z uAdjustment = alignment - ((puint_z)m_pTop & (alignment - 1U));
+    // The adjustment and the free space are calculated only once, this method is in the hot path of scratch allocations
+    puint_z uAdjustment = alignment - ((puint_z)m_pTop & (alignment - 1U));
 
-        if(uAdjustment == alignment)
-            uAdjustment = 0;
+    if(uAdjustment == alignment)
+        uAdjustment = 0;
+
+    const bool CAN_ALLOCATE = (puint_z)m_pBase + m_uSize - (puint_z)m_pTop >= uSize + uAdjustment;
+
+    Z_ASSERT_WARNING(CAN_ALLOCATE, "The size of the memory block to be allocated (plus the alignment adjustment) does not fit in the available free space.");
 
+    if(CAN_ALLOCATE)
+    {
         pAllocatedMemory = (void*)((puint_z)m_pTop + uAdjustment);
         m_pTop = (void*)((puint_z)m_pTop + uSize + uAdjustment);
     }
@@ -157,6 +177,14 @@ void* LinearAllocator::Allocate(const puint_z uSize, const Alignment &alignment)
     return pAllocatedMemory;
 }
 
+void LinearAllocator::Deallocate(const Mark &mark)
+{
+    Z_ASSERT_ERROR((puint_z)mark.GetMemoryAddress() >= (puint_z)m_pBase && (puint_z)mark.GetMemoryAddress() <= (puint_z)m_pTop, 
+                   "The mark does not point to an allocated position of the buffer.");
+
+    m_pTop = mark.GetMemoryAddress();
+}
+
 void LinearAllocator::Clear()
 {
     m_pTop = m_pBase;
@@ -183,9 +211,9 @@ void LinearAllocator::Reallocate(const puint_z uNewSize)
     {
         const puint_z BYTES_TO_COPY = this->GetAllocatedBytes();
 
-        void* pNewBuffer = ::operator new(uNewSize, Alignment(m_uAlignment));
+        void* pNewBuffer = this->_AllocateBuffer(uNewSize);
         memcpy(pNewBuffer, m_pBase, BYTES_TO_COPY);
-        ::operator delete(m_pBase, Alignment(m_uAlignment));
+        this->_FreeBuffer(m_pBase);
         m_pBase = pNewBuffer;
         m_pTop = (void*)((puint_z)m_pBase + BYTES_TO_COPY);
         m_uSize = uNewSize;
@@ -241,6 +269,20 @@ bool LinearAllocator::CanAllocate(const puint_z uSize, const Alignment &alignmen
     return m_uSize - this->GetAllocatedBytes() >= uSize + uAdjustment;
 }
 
+void* LinearAllocator::_AllocateBuffer(const puint_z uSize) const
+{
+    return m_eMemoryPlacement == EMemoryPlacement::E_LocalNumaNode ? SNumaMemory::AllocateLocal(uSize, Alignment(m_uAlignment)) :
+                                                                     ::operator new(uSize, Alignment(m_uAlignment));
+}
+
+void LinearAllocator::_FreeBuffer(void* pBuffer) const
+{
+    if(m_eMemoryPlacement == EMemoryPlacement::E_LocalNumaNode)
+        SNumaMemory::Deallocate(pBuffer);
+    else
+        ::operator delete(pBuffer, Alignment(m_uAlignment));
+}
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
@@ -266,5 +308,10 @@ void* LinearAllocator::GetPointer() const
     return m_pBase;
 }
 
+LinearAllocator::Mark LinearAllocator::GetMark() const
+{
+    return Mark(m_pTop);
+}
+
 
 } // namespace z
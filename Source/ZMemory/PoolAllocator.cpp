@@ -30,6 +30,7 @@
 #include <cstring>
 
 #include "ZCommon/Assertions.h"
+#include "ZMemory/SNumaMemory.h"
 
 
 namespace z
@@ -59,12 +60,13 @@ PoolAllocator::PoolAllocator(const puint_z uSize, const puint_z uBlockSize, cons
             m_uPoolSize(uSize),
             m_uAllocatedBytes(0),
             m_uAlignment(alignment),
-            m_bNeedDestroyMemoryChunk(true)
+            m_bNeedDestroyMemoryChunk(true),
+            m_eMemoryPlacement(EMemoryPlacement::E_Default)
 {
     Z_ASSERT_ERROR( 0 != uSize, "Size cannot be zero"  );
     Z_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
 
-    m_pAllocatedMemory = operator new(m_uPoolSize, alignment);
+    m_pAllocatedMemory = this->AllocateMemoryChunk(m_uPoolSize);
     Z_ASSERT_ERROR( null_z != m_pAllocatedMemory, "Pointer to allocated memory is null" );
 
     m_pFirst = m_pAllocatedMemory;
@@ -79,7 +81,8 @@ PoolAllocator::PoolAllocator(const puint_z uSize, const puint_z uBlockSize, cons
             m_uPoolSize(uSize),
             m_uAllocatedBytes(0),
             m_uAlignment(Alignment(sizeof(void**))),
-            m_bNeedDestroyMemoryChunk(false)
+            m_bNeedDestroyMemoryChunk(false),
+            m_eMemoryPlacement(EMemoryPlacement::E_Default)
 {
     Z_ASSERT_ERROR( 0 != uSize, "Size cannot be zero" );
     Z_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
@@ -99,7 +102,8 @@ PoolAllocator::PoolAllocator(const puint_z uSize, const puint_z uBlockSize, cons
             m_uPoolSize(uSize),
             m_uAllocatedBytes(0),
             m_uAlignment(alignment),
-            m_bNeedDestroyMemoryChunk(false)
+            m_bNeedDestroyMemoryChunk(false),
+            m_eMemoryPlacement(EMemoryPlacement::E_Default)
 {
     Z_ASSERT_ERROR( 0 != uSize, "Size cannot be zero" );
     Z_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
@@ -116,6 +120,27 @@ PoolAllocator::PoolAllocator(const puint_z uSize, const puint_z uBlockSize, cons
     this->AllocateFreeBlocksList();
 }
 
+PoolAllocator::PoolAllocator(const puint_z uSize, const puint_z uBlockSize, const Alignment &alignment, const EMemoryPlacement &eMemoryPlacement) :
+            m_uBlockSize(uBlockSize),
+            m_uPoolSize(uSize),
+            m_uAllocatedBytes(0),
+            m_uAlignment(alignment),
+            m_bNeedDestroyMemoryChunk(true),
+            m_eMemoryPlacement(eMemoryPlacement)
+{
+    Z_ASSERT_ERROR( 0 != uSize, "Size cannot be zero"  );
+    Z_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
+
+    m_pAllocatedMemory = this->AllocateMemoryChunk(m_uPoolSize);
+    Z_ASSERT_ERROR( null_z != m_pAllocatedMemory, "Pointer to allocated memory is null" );
+
+    m_pFirst = m_pAllocatedMemory;
+
+    m_uBlocksCount = m_uPoolSize / uBlockSize;
+
+    this->AllocateFreeBlocksList();
+}
+
 //##################=======================================================##################
 //##################             ____________________________              ##################
 //##################            |                            |             ##################
@@ -128,7 +153,7 @@ PoolAllocator::PoolAllocator(const puint_z uSize, const puint_z uBlockSize, cons
 PoolAllocator::~PoolAllocator()
 {
     if(m_bNeedDestroyMemoryChunk)
-        operator delete(m_pAllocatedMemory, m_uAlignment);
+        this->FreeMemoryChunk(m_pAllocatedMemory);
 
     operator delete(m_ppFreeBlocks);
 }
@@ -270,7 +295,7 @@ void PoolAllocator::Reallocate(const puint_z uNewSize)
 
     if(uNewSize > m_uPoolSize)
     {
-        void* pNewLocation = operator new(uNewSize, m_uAlignment);
+        void* pNewLocation = this->AllocateMemoryChunk(uNewSize);
 
         this->InternalReallocate(uNewSize, pNewLocation);
 
@@ -294,6 +319,57 @@ void PoolAllocator::Reallocate(const puint_z uNewSize, const void* pNewLocation)
     }
 }
 
+void PoolAllocator::Swap(PoolAllocator &poolAllocator)
+{
+    void** ppFreeBlocks = m_ppFreeBlocks;
+    m_ppFreeBlocks = poolAllocator.m_ppFreeBlocks;
+    poolAllocator.m_ppFreeBlocks = ppFreeBlocks;
+
+    void** ppNextFreeBlock = m_ppNextFreeBlock;
+    m_ppNextFreeBlock = poolAllocator.m_ppNextFreeBlock;
+    poolAllocator.m_ppNextFreeBlock = ppNextFreeBlock;
+
+    void* pFirst = m_pFirst;
+    m_pFirst = poolAllocator.m_pFirst;
+    poolAllocator.m_pFirst = pFirst;
+
+    const puint_z uBlockSize = m_uBlockSize;
+    m_uBlockSize = poolAllocator.m_uBlockSize;
+    poolAllocator.m_uBlockSize = uBlockSize;
+
+    const puint_z uPoolSize = m_uPoolSize;
+    m_uPoolSize = poolAllocator.m_uPoolSize;
+    poolAllocator.m_uPoolSize = uPoolSize;
+
+    const puint_z uSize = m_uSize;
+    m_uSize = poolAllocator.m_uSize;
+    poolAllocator.m_uSize = uSize;
+
+    const puint_z uAllocatedBytes = m_uAllocatedBytes;
+    m_uAllocatedBytes = poolAllocator.m_uAllocatedBytes;
+    poolAllocator.m_uAllocatedBytes = uAllocatedBytes;
+
+    const Alignment alignment = m_uAlignment;
+    m_uAlignment = poolAllocator.m_uAlignment;
+    poolAllocator.m_uAlignment = alignment;
+
+    void* pAllocatedMemory = m_pAllocatedMemory;
+    m_pAllocatedMemory = poolAllocator.m_pAllocatedMemory;
+    poolAllocator.m_pAllocatedMemory = pAllocatedMemory;
+
+    const puint_z uBlocksCount = m_uBlocksCount;
+    m_uBlocksCount = poolAllocator.m_uBlocksCount;
+    poolAllocator.m_uBlocksCount = uBlocksCount;
+
+    const bool bNeedDestroyMemoryChunk = m_bNeedDestroyMemoryChunk;
+    m_bNeedDestroyMemoryChunk = poolAllocator.m_bNeedDestroyMemoryChunk;
+    poolAllocator.m_bNeedDestroyMemoryChunk = bNeedDestroyMemoryChunk;
+
+    const EMemoryPlacement eMemoryPlacement = m_eMemoryPlacement;
+    m_eMemoryPlacement = poolAllocator.m_eMemoryPlacement;
+    poolAllocator.m_eMemoryPlacement = eMemoryPlacement;
+}
+
 void PoolAllocator::AllocateFreeBlocksList()
 {
     m_ppFreeBlocks = (void**) operator new(m_uBlocksCount * sizeof(void**));
@@ -400,7 +476,7 @@ void PoolAllocator::InternalReallocate(const puint_z uNewSize, void* pNewLocatio
     // Frees the old buffers
     // -------------------------
     if(m_bNeedDestroyMemoryChunk)
-        operator delete(m_pAllocatedMemory, m_uAlignment);
+        this->FreeMemoryChunk(m_pAllocatedMemory);
     
     m_pAllocatedMemory = pNewLocation;
     m_pFirst = m_pAllocatedMemory;
@@ -409,6 +485,20 @@ void PoolAllocator::InternalReallocate(const puint_z uNewSize, void* pNewLocatio
     m_ppFreeBlocks = ppNewFreeBlockList;
 }
 
+void* PoolAllocator::AllocateMemoryChunk(const puint_z uSize) const
+{
+    return m_eMemoryPlacement == EMemoryPlacement::E_LocalNumaNode ? SNumaMemory::AllocateLocal(uSize, m_uAlignment) :
+                                                                     operator new(uSize, m_uAlignment);
+}
+
+void PoolAllocator::FreeMemoryChunk(void* pMemoryChunk) const
+{
+    if(m_eMemoryPlacement == EMemoryPlacement::E_LocalNumaNode)
+        SNumaMemory::Deallocate(pMemoryChunk);
+    else
+        operator delete(pMemoryChunk, m_uAlignment);
+}
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
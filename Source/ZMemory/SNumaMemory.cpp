@@ -0,0 +1,244 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZMemory/SNumaMemory.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/DataTypes/StringsDefinitions.h"
+
+#if defined(Z_OS_WINDOWS)
+    #include <Windows.h>
+#elif defined(Z_OS_LINUX)
+    #include <cstdio>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <linux/mempolicy.h>
+#elif defined(Z_OS_MAC)
+    #include <cstdlib>
+#endif
+
+
+namespace z
+{
+
+/// <summary>
+/// Data stored right before every buffer returned by SNumaMemory, needed to free it.
+/// </summary>
+struct NumaBufferHeader
+{
+    /// <summary>
+    /// The address returned by the operating system.
+    /// </summary>
+    void* m_pBase;
+
+    /// <summary>
+    /// The size of the memory returned by the operating system.
+    /// </summary>
+    puint_z m_uSize;
+};
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+void* SNumaMemory::Allocate(const puint_z uSize, const Alignment &alignment, const u32_z uNode)
+{
+    Z_ASSERT_ERROR(uSize > 0, "The size of the buffer cannot be zero.");
+
+    // The header is stored before the aligned address
+    const puint_z TOTAL_SIZE = uSize + sizeof(NumaBufferHeader) + alignment;
+    void* pBase = null_z;
+
+#if defined(Z_OS_WINDOWS)
+
+    if(uNode < SNumaMemory::GetNodeCount())
+        pBase = ::VirtualAllocExNuma(::GetCurrentProcess(), NULL, TOTAL_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, uNode);
+    else
+        pBase = ::VirtualAlloc(NULL, TOTAL_SIZE, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+#elif defined(Z_OS_LINUX)
+
+    pBase = ::mmap(NULL, TOTAL_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if(pBase == MAP_FAILED)
+    {
+        pBase = null_z;
+    }
+    else if(uNode < SNumaMemory::GetNodeCount())
+    {
+        static const u32_z MAXIMUM_NODES = 1024U;
+        static const u32_z NODES_PER_MASK = sizeof(unsigned long) * 8U;
+
+        unsigned long arNodeMasks[MAXIMUM_NODES / NODES_PER_MASK] = {0};
+
+        if(uNode < MAXIMUM_NODES)
+        {
+            arNodeMasks[uNode / NODES_PER_MASK] = 1UL << (uNode % NODES_PER_MASK);
+
+            // No page has been touched yet so they will be placed in the preferred node when they are first written
+            // If it fails, the memory is placed anywhere, which is acceptable since the node is only a hint
+            ::syscall(SYS_mbind, pBase, TOTAL_SIZE, MPOL_PREFERRED, arNodeMasks, MAXIMUM_NODES, 0);
+        }
+    }
+
+#elif defined(Z_OS_MAC)
+
+    // Note: uNode is ignored, there is no NUMA support
+    pBase = std::malloc(TOTAL_SIZE);
+
+#endif
+
+    void* pBuffer = null_z;
+
+    if(pBase != null_z)
+    {
+        pBuffer = align_z((puint_z)pBase + sizeof(NumaBufferHeader), alignment);
+
+        NumaBufferHeader* pHeader = rcast_z(pBuffer, NumaBufferHeader*) - 1;
+        pHeader->m_pBase = pBase;
+        pHeader->m_uSize = TOTAL_SIZE;
+    }
+
+    return pBuffer;
+}
+
+void* SNumaMemory::AllocateLocal(const puint_z uSize, const Alignment &alignment)
+{
+    return SNumaMemory::Allocate(uSize, alignment, SNumaMemory::GetCurrentNode());
+}
+
+void SNumaMemory::Deallocate(void* pBuffer)
+{
+    if(pBuffer != null_z)
+    {
+        NumaBufferHeader* pHeader = rcast_z(pBuffer, NumaBufferHeader*) - 1;
+
+#if defined(Z_OS_WINDOWS)
+
+        ::VirtualFree(pHeader->m_pBase, 0, MEM_RELEASE);
+
+#elif defined(Z_OS_LINUX)
+
+        ::munmap(pHeader->m_pBase, pHeader->m_uSize);
+
+#elif defined(Z_OS_MAC)
+
+        std::free(pHeader->m_pBase);
+
+#endif
+    }
+}
+
+
+#if defined(Z_OS_LINUX)
+
+u32_z SNumaMemory::_ReadNodeCount()
+{
+    u32_z uNodeCount = 1U;
+
+    // The file contains a list of ranges, like "0" or "0-3", the last number being the highest node index
+    FILE* pFile = std::fopen("/sys/devices/system/node/possible", "r");
+
+    if(pFile != null_z)
+    {
+        u32_z uNode = 0;
+        char cSeparator = 0;
+        bool bMoreNodes = true;
+
+        while(bMoreNodes && std::fscanf(pFile, "%u", &uNode) == 1)
+        {
+            if(uNode + 1U > uNodeCount)
+                uNodeCount = uNode + 1U;
+
+            bMoreNodes = std::fscanf(pFile, "%c", &cSeparator) == 1;
+        }
+
+        std::fclose(pFile);
+    }
+
+    return uNodeCount;
+}
+
+#endif
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+u32_z SNumaMemory::GetNodeCount()
+{
+#if defined(Z_OS_WINDOWS)
+
+    ULONG uHighestNode = 0;
+    return ::GetNumaHighestNodeNumber(&uHighestNode) ? scast_z(uHighestNode, u32_z) + 1U : 1U;
+
+#elif defined(Z_OS_LINUX)
+
+    static const u32_z NODE_COUNT = SNumaMemory::_ReadNodeCount();
+    return NODE_COUNT;
+
+#elif defined(Z_OS_MAC)
+
+    return 1U;
+
+#endif
+}
+
+u32_z SNumaMemory::GetCurrentNode()
+{
+#if defined(Z_OS_WINDOWS)
+
+    PROCESSOR_NUMBER processorNumber;
+    ::GetCurrentProcessorNumberEx(&processorNumber);
+
+    USHORT uNode = 0;
+    return ::GetNumaProcessorNodeEx(&processorNumber, &uNode) ? scast_z(uNode, u32_z) : 0;
+
+#elif defined(Z_OS_LINUX)
+
+    unsigned int uProcessor = 0;
+    unsigned int uNode = 0;
+    return ::syscall(SYS_getcpu, &uProcessor, &uNode, NULL) == 0 ? scast_z(uNode, u32_z) : 0;
+
+#elif defined(Z_OS_MAC)
+
+    return 0;
+
+#endif
+}
+
+} // namespace z
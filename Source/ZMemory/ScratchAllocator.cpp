@@ -0,0 +1,179 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZMemory/ScratchAllocator.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/AllocationOperators.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const puint_z ScratchAllocator::DEFAULT_SIZE = 65536U;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+ScratchAllocator::ScratchAllocator(const puint_z uSize) : m_buffer(uSize, Alignment(sizeof(void*))),
+                                                          m_pLastOverflowBlock(null_z),
+                                                          m_uOverflowCount(0)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+ScratchAllocator::~ScratchAllocator()
+{
+    this->_FreeOverflowBlocks(null_z);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void* ScratchAllocator::Allocate(const puint_z uSize)
+{
+    return this->Allocate(uSize, Alignment(sizeof(void*)));
+}
+
+void* ScratchAllocator::Allocate(const puint_z uSize, const Alignment &alignment)
+{
+    Z_ASSERT_ERROR(uSize > 0, "The size of the memory block to be allocated cannot be zero.");
+
+    void* pAllocatedMemory = null_z;
+
+    if(m_buffer.CanAllocate(uSize, alignment))
+    {
+        pAllocatedMemory = m_buffer.Allocate(uSize, alignment);
+    }
+    else
+    {
+        // The block is preceded by a header that points to the previous block and stores the alignment it was allocated with, so it is freed 
+        // with the same alignment; the offset keeps both the header and the block aligned (alignments are powers of two)
+        static const puint_z HEADER_SIZE = sizeof(void*) + sizeof(puint_z);
+        const puint_z BLOCK_ALIGNMENT = alignment < sizeof(void*) ? sizeof(void*) : scast_z(alignment, puint_z);
+        const puint_z BLOCK_OFFSET = BLOCK_ALIGNMENT < HEADER_SIZE ? HEADER_SIZE : BLOCK_ALIGNMENT;
+
+        void* pOverflowBlock = ::operator new(BLOCK_OFFSET + uSize, Alignment(BLOCK_ALIGNMENT));
+        *scast_z(pOverflowBlock, void**) = m_pLastOverflowBlock;
+        *(puint_z*)((puint_z)pOverflowBlock + sizeof(void*)) = BLOCK_ALIGNMENT;
+        m_pLastOverflowBlock = pOverflowBlock;
+        ++m_uOverflowCount;
+
+        pAllocatedMemory = (void*)((puint_z)pOverflowBlock + BLOCK_OFFSET);
+    }
+
+    return pAllocatedMemory;
+}
+
+void ScratchAllocator::Deallocate(const ScratchAllocator::Mark &mark)
+{
+    this->_FreeOverflowBlocks(mark.GetLastOverflowBlock());
+    m_buffer.Deallocate(mark.GetBufferMark());
+}
+
+void ScratchAllocator::Clear()
+{
+    this->_FreeOverflowBlocks(null_z);
+    m_buffer.Clear();
+}
+
+void ScratchAllocator::_FreeOverflowBlocks(void* pLastBlockToKeep)
+{
+    while(m_pLastOverflowBlock != pLastBlockToKeep)
+    {
+        Z_ASSERT_ERROR(m_pLastOverflowBlock != null_z, "The mark does not belong to this allocator or it was invalidated.");
+
+        void* pPreviousBlock = *scast_z(m_pLastOverflowBlock, void**);
+        const puint_z BLOCK_ALIGNMENT = *(puint_z*)((puint_z)m_pLastOverflowBlock + sizeof(void*));
+        ::operator delete(m_pLastOverflowBlock, Alignment(BLOCK_ALIGNMENT));
+        m_pLastOverflowBlock = pPreviousBlock;
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+ScratchAllocator::Mark ScratchAllocator::GetMark() const
+{
+    return ScratchAllocator::Mark(m_buffer.GetMark(), m_pLastOverflowBlock);
+}
+
+puint_z ScratchAllocator::GetSize() const
+{
+    return m_buffer.GetSize();
+}
+
+puint_z ScratchAllocator::GetAllocatedBytes() const
+{
+    return m_buffer.GetAllocatedBytes();
+}
+
+puint_z ScratchAllocator::GetOverflowCount() const
+{
+    return m_uOverflowCount;
+}
+
+} // namespace z
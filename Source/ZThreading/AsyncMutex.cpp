@@ -0,0 +1,160 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/AsyncMutex.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZThreading/AsyncTask.h"
+#include "ZThreading/AsyncTaskExecutor.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+AsyncMutex::AsyncMutex() : m_bIsLocked(false),
+                           m_pFirstWaiter(null_z),
+                           m_pLastWaiter(null_z)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+AsyncMutex::~AsyncMutex()
+{
+    Z_ASSERT_WARNING(m_pFirstWaiter == null_z, "The mutex is being destroyed while there are tasks waiting for it.");
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+bool AsyncMutex::TryLock()
+{
+    m_mutex.Lock();
+
+    const bool IS_ACQUIRED = !m_bIsLocked;
+    m_bIsLocked = true;
+
+    m_mutex.Unlock();
+
+    return IS_ACQUIRED;
+}
+
+void AsyncMutex::Unlock()
+{
+    Z_ASSERT_ERROR(this->IsLocked(), "The mutex is not owned.");
+
+    m_mutex.Lock();
+
+    // The mutex remains locked when it is passed to a waiting task
+    AsyncTask* pNextOwner = m_pFirstWaiter;
+
+    if(pNextOwner == null_z)
+    {
+        m_bIsLocked = false;
+    }
+    else
+    {
+        m_pFirstWaiter = pNextOwner->m_pNext;
+        pNextOwner->m_pNext = null_z;
+
+        if(m_pFirstWaiter == null_z)
+            m_pLastWaiter = null_z;
+    }
+
+    m_mutex.Unlock();
+
+    if(pNextOwner != null_z)
+        pNextOwner->m_pExecutor->_Schedule(pNextOwner);
+}
+
+bool AsyncMutex::_LockOrWait(AsyncTask* pTask)
+{
+    Z_ASSERT_ERROR(pTask != null_z, "The task cannot be null.");
+
+    m_mutex.Lock();
+
+    const bool IS_ACQUIRED = !m_bIsLocked;
+
+    if(IS_ACQUIRED)
+    {
+        m_bIsLocked = true;
+    }
+    else
+    {
+        if(m_pLastWaiter == null_z)
+            m_pFirstWaiter = pTask;
+        else
+            m_pLastWaiter->m_pNext = pTask;
+
+        m_pLastWaiter = pTask;
+    }
+
+    m_mutex.Unlock();
+
+    return IS_ACQUIRED;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+bool AsyncMutex::IsLocked() const
+{
+    m_mutex.Lock();
+    const bool IS_LOCKED = m_bIsLocked;
+    m_mutex.Unlock();
+
+    return IS_LOCKED;
+}
+
+} // namespace z
@@ -0,0 +1,157 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/AsyncTask.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZThreading/SFutex.h"
+#include "ZThreading/SMonotonicClock.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+AsyncTask::AsyncTask() : m_bIsBlocking(false),
+                         m_uState(STATE_NOT_STARTED),
+                         m_pExecutor(null_z),
+                         m_pContinuation(null_z),
+                         m_pNext(null_z),
+                         m_uAwaiting(AWAITING_NOTHING),
+                         m_uResumeInstant(0),
+                         m_pAwaitedMutex(null_z),
+                         m_pAwaitedTask(null_z)
+{
+}
+
+AsyncTask::AsyncTask(const bool bIsBlocking) : m_bIsBlocking(bIsBlocking),
+                                               m_uState(STATE_NOT_STARTED),
+                                               m_pExecutor(null_z),
+                                               m_pContinuation(null_z),
+                                               m_pNext(null_z),
+                                               m_uAwaiting(AWAITING_NOTHING),
+                                               m_uResumeInstant(0),
+                                               m_pAwaitedMutex(null_z),
+                                               m_pAwaitedTask(null_z)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+AsyncTask::~AsyncTask()
+{
+    Z_ASSERT_WARNING(m_uState.load() != STATE_RUNNING && m_uState.load() != STATE_RUNNING_WITH_WAITERS, "The task is being destroyed while it is running.");
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+void AsyncTask::Wait()
+{
+    u32_z uState = m_uState.load();
+
+    Z_ASSERT_ERROR(uState != STATE_NOT_STARTED, "The task has never been submitted to an executor.");
+
+    // The state is changed so the executor knows that it has to wake the waiting threads up when the task completes
+    while(uState != STATE_COMPLETED && uState != STATE_NOT_STARTED)
+    {
+        if(uState == STATE_RUNNING_WITH_WAITERS || m_uState.compare_exchange_weak(uState, STATE_RUNNING_WITH_WAITERS))
+        {
+            SFutex::Wait(m_uState, STATE_RUNNING_WITH_WAITERS);
+            uState = m_uState.load();
+        }
+    }
+}
+
+void AsyncTask::AwaitSleep(const TimeSpan &duration)
+{
+    static const u64_z NANOSECONDS_IN_HUNDRED = 100ULL;
+
+    Z_ASSERT_ERROR(m_uAwaiting == AWAITING_NOTHING, "The task already awaits something.");
+
+    m_uAwaiting = AWAITING_TIME;
+    m_uResumeInstant = SMonotonicClock::GetNanoseconds() + duration.GetHundredsOfNanoseconds() * NANOSECONDS_IN_HUNDRED;
+}
+
+void AsyncTask::AwaitLock(AsyncMutex &mutex)
+{
+    Z_ASSERT_ERROR(m_uAwaiting == AWAITING_NOTHING, "The task already awaits something.");
+
+    m_uAwaiting = AWAITING_LOCK;
+    m_pAwaitedMutex = &mutex;
+}
+
+void AsyncTask::AwaitTask(AsyncTask &task)
+{
+    Z_ASSERT_ERROR(m_uAwaiting == AWAITING_NOTHING, "The task already awaits something.");
+    Z_ASSERT_ERROR(&task != this, "A task cannot await itself.");
+    Z_ASSERT_ERROR(task.m_uState.load() == STATE_NOT_STARTED || task.m_uState.load() == STATE_COMPLETED, "The awaited task is already running.");
+
+    m_uAwaiting = AWAITING_TASK;
+    m_pAwaitedTask = &task;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+bool AsyncTask::IsCompleted() const
+{
+    return m_uState.load() == STATE_COMPLETED;
+}
+
+bool AsyncTask::IsBlocking() const
+{
+    return m_bIsBlocking;
+}
+
+} // namespace z
@@ -0,0 +1,384 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/AsyncTaskExecutor.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZThreading/AsyncMutex.h"
+#include "ZThreading/SFutex.h"
+#include "ZThreading/SMonotonicClock.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZThreading/Thread.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+AsyncTaskExecutor::AsyncTaskExecutor(const u32_z uWorkerCount, const u32_z uBlockingWorkerCount) : m_uWorkerCount(uWorkerCount),
+                                                                                                   m_uBlockingWorkerCount(uBlockingWorkerCount),
+                                                                                                   m_arThreads(null_z),
+                                                                                                   m_arSleepingTasks(null_z),
+                                                                                                   m_uSleepingTaskCount(0),
+                                                                                                   m_uSleepingTaskCapacity(0),
+                                                                                                   m_bStop(false)
+{
+    static const puint_z INITIAL_SLEEPING_TASK_CAPACITY = 64U;
+
+    Z_ASSERT_ERROR(uWorkerCount > 0, "The number of worker threads must be greater than zero.");
+    Z_ASSERT_ERROR(uBlockingWorkerCount > 0, "The number of worker threads for blocking tasks must be greater than zero.");
+
+    m_uSleepingTaskCapacity = INITIAL_SLEEPING_TASK_CAPACITY;
+    m_arSleepingTasks = new AsyncTask*[m_uSleepingTaskCapacity];
+    m_arThreads = new Thread*[uWorkerCount + uBlockingWorkerCount + 1U];
+
+    for(u32_z i = 0; i < uWorkerCount; ++i)
+        m_arThreads[i] = new Thread(Delegate<void(AsyncTaskExecutor*, TaskQueue*)>(&AsyncTaskExecutor::_ExecuteWorker), this, &m_queue);
+
+    for(u32_z i = 0; i < uBlockingWorkerCount; ++i)
+        m_arThreads[uWorkerCount + i] = new Thread(Delegate<void(AsyncTaskExecutor*, TaskQueue*)>(&AsyncTaskExecutor::_ExecuteWorker), this, &m_blockingQueue);
+
+    m_arThreads[uWorkerCount + uBlockingWorkerCount] = new Thread(Delegate<void(AsyncTaskExecutor*)>(&AsyncTaskExecutor::_ExecuteTimer), this);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+AsyncTaskExecutor::~AsyncTaskExecutor()
+{
+    // The flag is changed while the mutex is locked so the thread that resumes sleeping tasks cannot miss the notification
+    m_sleepingTasksMutex.Lock();
+    m_bStop.store(true);
+    m_sleepingTasksMutex.Unlock();
+
+    m_sleepingTasksChanged.NotifyAll();
+    m_queue.m_taskAdded.NotifyAll();
+    m_blockingQueue.m_taskAdded.NotifyAll();
+
+    const u32_z THREAD_COUNT = m_uWorkerCount + m_uBlockingWorkerCount + 1U;
+
+    for(u32_z i = 0; i < THREAD_COUNT; ++i)
+    {
+        m_arThreads[i]->Join();
+        delete m_arThreads[i];
+    }
+
+    delete[] m_arThreads;
+    delete[] m_arSleepingTasks;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+void AsyncTaskExecutor::Submit(AsyncTask &task)
+{
+    Z_ASSERT_ERROR(task.m_uState.load() == AsyncTask::STATE_NOT_STARTED || task.m_uState.load() == AsyncTask::STATE_COMPLETED, "The task is already running.");
+
+    task.m_pExecutor = this;
+    task.m_pContinuation = null_z;
+    task.m_uState.store(AsyncTask::STATE_RUNNING);
+    this->_Schedule(&task);
+}
+
+void AsyncTaskExecutor::_ExecuteWorker(AsyncTaskExecutor* pExecutor, AsyncTaskExecutor::TaskQueue* pQueue)
+{
+    pExecutor->_ExtractAndExecuteTasks(*pQueue);
+}
+
+void AsyncTaskExecutor::_ExecuteTimer(AsyncTaskExecutor* pExecutor)
+{
+    pExecutor->_ResumeSleepingTasks();
+}
+
+void AsyncTaskExecutor::_ExtractAndExecuteTasks(AsyncTaskExecutor::TaskQueue &queue)
+{
+    const bool IS_BLOCKING_WORKER = &queue == &m_blockingQueue;
+    bool bFinished = false;
+
+    while(!bFinished)
+    {
+        AsyncTask* pTask = AsyncTaskExecutor::_Dequeue(queue);
+
+        if(pTask == null_z)
+        {
+            // The queue is checked again after announcing the wait, so a task added in between is not missed
+            const u32_z KEY = queue.m_taskAdded.PrepareWait();
+            pTask = AsyncTaskExecutor::_Dequeue(queue);
+
+            if(pTask != null_z || m_bStop.load())
+                queue.m_taskAdded.CancelWait();
+            else
+                queue.m_taskAdded.Wait(KEY);
+        }
+
+        if(pTask != null_z)
+            this->_Execute(pTask, IS_BLOCKING_WORKER);
+        else
+            bFinished = m_bStop.load();
+    }
+}
+
+void AsyncTaskExecutor::_ResumeSleepingTasks()
+{
+    static const u64_z NANOSECONDS_IN_HUNDRED = 100ULL;
+
+    ScopedExclusiveLock<> lock(m_sleepingTasksMutex);
+
+    while(!m_bStop.load())
+    {
+        if(m_uSleepingTaskCount == 0)
+        {
+            m_sleepingTasksChanged.Wait(lock);
+        }
+        else
+        {
+            const u64_z CURRENT_INSTANT = SMonotonicClock::GetNanoseconds();
+            const u64_z RESUME_INSTANT = m_arSleepingTasks[0]->m_uResumeInstant;
+
+            if(RESUME_INSTANT <= CURRENT_INSTANT)
+                this->_Schedule(this->_RemoveFirstSleepingTask());
+            else // The wait is rounded up so the thread does not wake up before the instant
+                m_sleepingTasksChanged.WaitFor(lock, TimeSpan((RESUME_INSTANT - CURRENT_INSTANT + NANOSECONDS_IN_HUNDRED - 1U) / NANOSECONDS_IN_HUNDRED));
+        }
+    }
+}
+
+void AsyncTaskExecutor::_Execute(AsyncTask* pTask, const bool bIsBlockingWorker)
+{
+    Z_ASSERT_ERROR(pTask != null_z, "The task cannot be null.");
+
+    // Once a task has been passed to a queue, a list of waiters or the set of sleeping tasks, another thread may resume it, so it must not be used anymore
+    AsyncTask* pCurrentTask = pTask;
+
+    while(pCurrentTask != null_z)
+    {
+        pCurrentTask->m_uAwaiting = AsyncTask::AWAITING_NOTHING;
+        const bool IS_COMPLETED = pCurrentTask->Resume();
+        AsyncTask* pNextTask = null_z;
+
+        if(IS_COMPLETED)
+        {
+            Z_ASSERT_ERROR(pCurrentTask->m_uAwaiting == AsyncTask::AWAITING_NOTHING, "A task that has completed cannot await anything.");
+
+            pNextTask = this->_Complete(pCurrentTask);
+        }
+        else if(pCurrentTask->m_uAwaiting == AsyncTask::AWAITING_NOTHING)
+        {
+            this->_Schedule(pCurrentTask);
+        }
+        else if(pCurrentTask->m_uAwaiting == AsyncTask::AWAITING_TIME)
+        {
+            this->_AddSleepingTask(pCurrentTask);
+        }
+        else if(pCurrentTask->m_uAwaiting == AsyncTask::AWAITING_LOCK)
+        {
+            if(pCurrentTask->m_pAwaitedMutex->_LockOrWait(pCurrentTask))
+                pNextTask = pCurrentTask;
+        }
+        else
+        {
+            AsyncTask* pAwaitedTask = pCurrentTask->m_pAwaitedTask;
+            pAwaitedTask->m_pExecutor = this;
+            pAwaitedTask->m_pContinuation = pCurrentTask;
+            pAwaitedTask->m_uState.store(AsyncTask::STATE_RUNNING);
+            pNextTask = pAwaitedTask;
+        }
+
+        // Tasks of the other group of threads must not be executed by this one
+        if(pNextTask != null_z && pNextTask->m_bIsBlocking != bIsBlockingWorker)
+        {
+            this->_Schedule(pNextTask);
+            pNextTask = null_z;
+        }
+
+        pCurrentTask = pNextTask;
+    }
+}
+
+AsyncTask* AsyncTaskExecutor::_Complete(AsyncTask* pTask)
+{
+    Z_ASSERT_ERROR(pTask != null_z, "The task cannot be null.");
+
+    // The continuation is read first since a waiting thread may destroy the task as soon as it is marked as completed
+    AsyncTask* pContinuation = pTask->m_pContinuation;
+    pTask->m_pContinuation = null_z;
+
+    if(pTask->m_uState.exchange(AsyncTask::STATE_COMPLETED) == AsyncTask::STATE_RUNNING_WITH_WAITERS)
+        SFutex::WakeAll(pTask->m_uState);
+
+    return pContinuation;
+}
+
+void AsyncTaskExecutor::_Schedule(AsyncTask* pTask)
+{
+    Z_ASSERT_ERROR(pTask != null_z, "The task cannot be null.");
+
+    TaskQueue &queue = pTask->m_bIsBlocking ? m_blockingQueue : m_queue;
+
+    queue.m_mutex.Lock();
+
+    if(queue.m_pLast == null_z)
+        queue.m_pFirst = pTask;
+    else
+        queue.m_pLast->m_pNext = pTask;
+
+    queue.m_pLast = pTask;
+
+    queue.m_mutex.Unlock();
+
+    queue.m_taskAdded.NotifyOne();
+}
+
+AsyncTask* AsyncTaskExecutor::_Dequeue(AsyncTaskExecutor::TaskQueue &queue)
+{
+    queue.m_mutex.Lock();
+
+    AsyncTask* pTask = queue.m_pFirst;
+
+    if(pTask != null_z)
+    {
+        queue.m_pFirst = pTask->m_pNext;
+        pTask->m_pNext = null_z;
+
+        if(queue.m_pFirst == null_z)
+            queue.m_pLast = null_z;
+    }
+
+    queue.m_mutex.Unlock();
+
+    return pTask;
+}
+
+void AsyncTaskExecutor::_AddSleepingTask(AsyncTask* pTask)
+{
+    Z_ASSERT_ERROR(pTask != null_z, "The task cannot be null.");
+
+    m_sleepingTasksMutex.Lock();
+
+    if(m_uSleepingTaskCount == m_uSleepingTaskCapacity)
+    {
+        AsyncTask** arSleepingTasks = new AsyncTask*[m_uSleepingTaskCapacity * 2U];
+
+        for(puint_z i = 0; i < m_uSleepingTaskCount; ++i)
+            arSleepingTasks[i] = m_arSleepingTasks[i];
+
+        delete[] m_arSleepingTasks;
+        m_arSleepingTasks = arSleepingTasks;
+        m_uSleepingTaskCapacity *= 2U;
+    }
+
+    // The task goes up in the heap while its parent has to be resumed later
+    puint_z uPosition = m_uSleepingTaskCount;
+    ++m_uSleepingTaskCount;
+
+    while(uPosition > 0 && m_arSleepingTasks[(uPosition - 1U) / 2U]->m_uResumeInstant > pTask->m_uResumeInstant)
+    {
+        m_arSleepingTasks[uPosition] = m_arSleepingTasks[(uPosition - 1U) / 2U];
+        uPosition = (uPosition - 1U) / 2U;
+    }
+
+    m_arSleepingTasks[uPosition] = pTask;
+
+    m_sleepingTasksMutex.Unlock();
+
+    // The thread that resumes sleeping tasks only needs to wake up when the task has to be resumed before the rest
+    if(uPosition == 0)
+        m_sleepingTasksChanged.NotifyOne();
+}
+
+AsyncTask* AsyncTaskExecutor::_RemoveFirstSleepingTask()
+{
+    AsyncTask* pFirstTask = m_arSleepingTasks[0];
+    --m_uSleepingTaskCount;
+
+    // The last task goes down in the heap from the root while any of its children has to be resumed earlier
+    AsyncTask* pLastTask = m_arSleepingTasks[m_uSleepingTaskCount];
+    puint_z uPosition = 0;
+    bool bIsPlaced = false;
+
+    while(!bIsPlaced)
+    {
+        puint_z uChild = uPosition * 2U + 1U;
+
+        if(uChild + 1U < m_uSleepingTaskCount && m_arSleepingTasks[uChild + 1U]->m_uResumeInstant < m_arSleepingTasks[uChild]->m_uResumeInstant)
+            ++uChild;
+
+        if(uChild < m_uSleepingTaskCount && m_arSleepingTasks[uChild]->m_uResumeInstant < pLastTask->m_uResumeInstant)
+        {
+            m_arSleepingTasks[uPosition] = m_arSleepingTasks[uChild];
+            uPosition = uChild;
+        }
+        else
+        {
+            bIsPlaced = true;
+        }
+    }
+
+    m_arSleepingTasks[uPosition] = pLastTask;
+
+    return pFirstTask;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+u32_z AsyncTaskExecutor::GetWorkerCount() const
+{
+    return m_uWorkerCount;
+}
+
+u32_z AsyncTaskExecutor::GetBlockingWorkerCount() const
+{
+    return m_uBlockingWorkerCount;
+}
+
+} // namespace z
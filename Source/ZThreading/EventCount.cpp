@@ -0,0 +1,118 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/EventCount.h"
+
+#include "ZThreading/SFutex.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+EventCount::EventCount() : m_uEpoch(0),
+                           m_uWaiterCount(0)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_z EventCount::PrepareWait()
+{
+    m_uWaiterCount.fetch_add(1U);
+
+    // The full fence guarantees that either the notifying thread sees the waiter or the waiting thread sees the change in the data structure
+    boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+    return m_uEpoch.load(boost::memory_order_relaxed);
+}
+
+void EventCount::CancelWait()
+{
+    m_uWaiterCount.fetch_sub(1U, boost::memory_order_relaxed);
+}
+
+void EventCount::Wait(const u32_z uKey)
+{
+    SFutex::Wait(m_uEpoch, uKey);
+    m_uWaiterCount.fetch_sub(1U, boost::memory_order_relaxed);
+}
+
+void EventCount::NotifyOne()
+{
+    boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+    if(m_uWaiterCount.load(boost::memory_order_relaxed) > 0)
+    {
+        m_uEpoch.fetch_add(1U);
+        SFutex::WakeOne(m_uEpoch);
+    }
+}
+
+void EventCount::NotifyAll()
+{
+    boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+    if(m_uWaiterCount.load(boost::memory_order_relaxed) > 0)
+    {
+        m_uEpoch.fetch_add(1U);
+        SFutex::WakeAll(m_uEpoch);
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_z EventCount::GetWaiterCount() const
+{
+    return m_uWaiterCount.load(boost::memory_order_relaxed);
+}
+
+} // namespace z
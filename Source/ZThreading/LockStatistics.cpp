@@ -0,0 +1,206 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/LockStatistics.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/DataTypes/SFloat.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+LockStatistics::LockStatistics(const string_z &strName, 
+                               const u64_z uAcquisitionCount, 
+                               const u64_z uContendedAcquisitionCount, 
+                               const u64_z uWaitNanoseconds, 
+                               const u64_z uHoldCount, 
+                               const u64_z uHoldNanoseconds, 
+                               const u64_z* arWaitTimeHistogram, 
+                               const u64_z* arHoldTimeHistogram) : m_strName(strName),
+                                                                   m_uAcquisitionCount(uAcquisitionCount),
+                                                                   m_uContendedAcquisitionCount(uContendedAcquisitionCount),
+                                                                   m_uWaitNanoseconds(uWaitNanoseconds),
+                                                                   m_uHoldCount(uHoldCount),
+                                                                   m_uHoldNanoseconds(uHoldNanoseconds)
+{
+    Z_ASSERT_ERROR(uContendedAcquisitionCount <= uAcquisitionCount, "The number of contended acquisitions cannot be greater than the number of acquisitions.");
+    Z_ASSERT_ERROR(arWaitTimeHistogram != null_z && arHoldTimeHistogram != null_z, "The input histograms cannot be null.");
+
+    for(u32_z i = 0; i < LockStatistics::HISTOGRAM_BUCKET_COUNT; ++i)
+    {
+        m_arWaitTimeHistogram[i] = arWaitTimeHistogram[i];
+        m_arHoldTimeHistogram[i] = arHoldTimeHistogram[i];
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_z LockStatistics::GetHistogramBucket(const u64_z uNanoseconds)
+{
+    // The bucket is the position of the most significant bit, found by halving the range in every step
+    u64_z uValue = uNanoseconds;
+    u32_z uBucket = 0;
+
+    for(u32_z uShift = 32U; uShift > 0; uShift >>= 1U)
+    {
+        if(uValue >> uShift != 0)
+        {
+            uValue >>= uShift;
+            uBucket += uShift;
+        }
+    }
+
+    return uBucket < LockStatistics::HISTOGRAM_BUCKET_COUNT ? uBucket : LockStatistics::HISTOGRAM_BUCKET_COUNT - 1U;
+}
+
+string_z LockStatistics::ToString() const
+{
+    static const char* HISTOGRAM_PAIR_SEPARATOR = ",";
+    static const char* HISTOGRAM_VALUE_SEPARATOR = ":";
+
+    string_z strResult("lock=");
+    strResult.Append(m_strName);
+    strResult.Append(" acquisitions=");
+    strResult.Append(m_uAcquisitionCount);
+    strResult.Append(" contended=");
+    strResult.Append(m_uContendedAcquisitionCount);
+    strResult.Append(" wait_ns=");
+    strResult.Append(m_uWaitNanoseconds);
+    strResult.Append(" holds=");
+    strResult.Append(m_uHoldCount);
+    strResult.Append(" hold_ns=");
+    strResult.Append(m_uHoldNanoseconds);
+
+    const u64_z* HISTOGRAMS[] = { m_arWaitTimeHistogram, m_arHoldTimeHistogram };
+    const char* HISTOGRAM_KEYS[] = { " wait_histogram=", " hold_histogram=" };
+
+    for(u32_z uHistogram = 0; uHistogram < sizeof(HISTOGRAMS) / sizeof(HISTOGRAMS[0]); ++uHistogram)
+    {
+        strResult.Append(HISTOGRAM_KEYS[uHistogram]);
+        bool bIsFirstPair = true;
+
+        for(u32_z i = 0; i < LockStatistics::HISTOGRAM_BUCKET_COUNT; ++i)
+        {
+            if(HISTOGRAMS[uHistogram][i] != 0)
+            {
+                if(!bIsFirstPair)
+                    strResult.Append(HISTOGRAM_PAIR_SEPARATOR);
+
+                strResult.Append(i);
+                strResult.Append(HISTOGRAM_VALUE_SEPARATOR);
+                strResult.Append(HISTOGRAMS[uHistogram][i]);
+                bIsFirstPair = false;
+            }
+        }
+    }
+
+    return strResult;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+string_z LockStatistics::GetName() const
+{
+    return m_strName;
+}
+
+u64_z LockStatistics::GetAcquisitionCount() const
+{
+    return m_uAcquisitionCount;
+}
+
+u64_z LockStatistics::GetContendedAcquisitionCount() const
+{
+    return m_uContendedAcquisitionCount;
+}
+
+float_z LockStatistics::GetContentionRate() const
+{
+    return m_uAcquisitionCount == 0 ? SFloat::_0 : 
+                                      scast_z(m_uContendedAcquisitionCount, float_z) / scast_z(m_uAcquisitionCount, float_z);
+}
+
+TimeSpan LockStatistics::GetWaitTime() const
+{
+    static const u64_z NANOSECONDS_IN_HUNDRED = 100ULL;
+
+    return TimeSpan(m_uWaitNanoseconds / NANOSECONDS_IN_HUNDRED);
+}
+
+u64_z LockStatistics::GetHoldCount() const
+{
+    return m_uHoldCount;
+}
+
+TimeSpan LockStatistics::GetHoldTime() const
+{
+    static const u64_z NANOSECONDS_IN_HUNDRED = 100ULL;
+
+    return TimeSpan(m_uHoldNanoseconds / NANOSECONDS_IN_HUNDRED);
+}
+
+u64_z LockStatistics::GetWaitTimeHistogram(const u32_z uBucket) const
+{
+    Z_ASSERT_ERROR(uBucket < LockStatistics::HISTOGRAM_BUCKET_COUNT, "The index of the bucket must be lower than the number of buckets.");
+
+    return m_arWaitTimeHistogram[uBucket];
+}
+
+u64_z LockStatistics::GetHoldTimeHistogram(const u32_z uBucket) const
+{
+    Z_ASSERT_ERROR(uBucket < LockStatistics::HISTOGRAM_BUCKET_COUNT, "The index of the bucket must be lower than the number of buckets.");
+
+    return m_arHoldTimeHistogram[uBucket];
+}
+
+} // namespace z
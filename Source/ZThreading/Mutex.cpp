@@ -26,10 +26,56 @@
 
 #include "ZThreading/Mutex.h"
 
+#include "ZThreading/SFutex.h"
+#include "ZThreading/SThisThread.h"
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    #include "ZThreading/SLockStatistics.h"
+    #include "ZThreading/SMonotonicClock.h"
+#endif
+
 
 namespace z
 {
         
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+Mutex::FutexMutex::FutexMutex() : m_uState(0),
+                                  m_uSpinCount(0)
+{
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    m_uLockIndex = SLockStatistics::UNTRACKED_LOCK;
+    m_uAcquisitionInstant = 0;
+#endif
+}
+
+Mutex::FutexMutex::FutexMutex(const char* szName) : m_uState(0),
+                                                    m_uSpinCount(0)
+{
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    m_uLockIndex = SLockStatistics::_RegisterLock(szName);
+    m_uAcquisitionInstant = 0;
+#else
+    (void)szName;
+#endif
+}
+
+Mutex::Mutex() : m_mutex("Mutex")
+{
+}
+
+Mutex::Mutex(const char* szName) : m_mutex(szName)
+{
+}
+
+
 //##################=======================================================##################
 //##################             ____________________________              ##################
 //##################            |                            |             ##################
@@ -53,6 +99,97 @@ Mutex::~Mutex()
 //##################                                                       ##################
 //##################=======================================================##################
 
+void Mutex::FutexMutex::lock()
+{
+    u32_z uExpectedState = 0;
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    const bool IS_CONTENDED = !m_uState.compare_exchange_strong(uExpectedState, 1U, boost::memory_order_acquire, boost::memory_order_relaxed);
+    const u64_z WAIT_START_INSTANT = IS_CONTENDED ? SMonotonicClock::GetNanoseconds() : 0;
+
+    if(IS_CONTENDED)
+        this->_LockContended();
+
+    this->_RecordAcquisition(IS_CONTENDED, WAIT_START_INSTANT);
+#else
+    if(!m_uState.compare_exchange_strong(uExpectedState, 1U, boost::memory_order_acquire, boost::memory_order_relaxed))
+        this->_LockContended();
+#endif
+}
+
+void Mutex::FutexMutex::unlock()
+{
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    // The hold time is recorded while the mutex is still owned, since the acquisition instant is protected by it
+    if(m_uLockIndex != SLockStatistics::UNTRACKED_LOCK)
+        SLockStatistics::_RecordHold(m_uLockIndex, SMonotonicClock::GetNanoseconds() - m_uAcquisitionInstant);
+#endif
+
+    if(m_uState.exchange(0, boost::memory_order_release) == 2U)
+        SFutex::WakeOne(m_uState);
+}
+
+bool Mutex::FutexMutex::try_lock()
+{
+    u32_z uExpectedState = 0;
+    const bool IS_LOCKED = m_uState.compare_exchange_strong(uExpectedState, 1U, boost::memory_order_acquire, boost::memory_order_relaxed);
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    if(IS_LOCKED)
+        this->_RecordAcquisition(false, 0);
+#endif
+
+    return IS_LOCKED;
+}
+
+void Mutex::FutexMutex::_LockContended()
+{
+    // The spin limit depends on the number of spins that were needed in previous contended locks, like adaptive mutexes of glibc
+    const u32_z MAXIMUM_SPIN_COUNT = SFutex::GetSpinCount();
+    const u32_z AVERAGE_SPIN_COUNT = m_uSpinCount.load(boost::memory_order_relaxed);
+    const u32_z SPIN_LIMIT = AVERAGE_SPIN_COUNT * 2U + 10U < MAXIMUM_SPIN_COUNT ? AVERAGE_SPIN_COUNT * 2U + 10U : MAXIMUM_SPIN_COUNT;
+
+    u32_z uSpins = 0;
+    bool bLocked = false;
+
+    while(!bLocked && uSpins < SPIN_LIMIT)
+    {
+        SThisThread::Pause();
+        ++uSpins;
+
+        u32_z uExpectedState = 0;
+        bLocked = m_uState.load(boost::memory_order_relaxed) == 0 && 
+                  m_uState.compare_exchange_weak(uExpectedState, 1U, boost::memory_order_acquire, boost::memory_order_relaxed);
+    }
+
+    if(SPIN_LIMIT > 0)
+    {
+        // The average moves an eighth of the way towards the last number of spins
+        const i32_z DIFFERENCE = scast_z(uSpins, i32_z) - scast_z(AVERAGE_SPIN_COUNT, i32_z);
+        m_uSpinCount.store(scast_z(scast_z(AVERAGE_SPIN_COUNT, i32_z) + DIFFERENCE / 8, u32_z), boost::memory_order_relaxed);
+    }
+
+    if(!bLocked)
+    {
+        // The state is set to 2 so the owner knows it has to wake up a sleeping thread when it unlocks the mutex
+        while(m_uState.exchange(2U, boost::memory_order_acquire) != 0)
+            SFutex::Wait(m_uState, 2U);
+    }
+}
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+
+void Mutex::FutexMutex::_RecordAcquisition(const bool bIsContended, const u64_z uWaitStartInstant)
+{
+    if(m_uLockIndex != SLockStatistics::UNTRACKED_LOCK)
+    {
+        m_uAcquisitionInstant = SMonotonicClock::GetNanoseconds();
+        SLockStatistics::_RecordAcquisition(m_uLockIndex, bIsContended, bIsContended ? m_uAcquisitionInstant - uWaitStartInstant : 0);
+    }
+}
+
+#endif
+
 void Mutex::Lock()
 {
     m_mutex.lock();
@@ -78,12 +215,12 @@ bool Mutex::TryLock()
 //##################                                                       ##################
 //##################=======================================================##################
 
-boost::mutex& Mutex::GetWrappedObject()
+Mutex::WrappedType& Mutex::GetWrappedObject()
 {
     return m_mutex;
 }
 
-const boost::mutex& Mutex::GetWrappedObject() const
+const Mutex::WrappedType& Mutex::GetWrappedObject() const
 {
     return m_mutex;
 }
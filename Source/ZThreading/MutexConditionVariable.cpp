@@ -0,0 +1,105 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/MutexConditionVariable.h"
+
+#include "ZThreading/SFutex.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+MutexConditionVariable::MutexConditionVariable() : m_uSequence(0),
+                                                   m_uWaiterCount(0)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void MutexConditionVariable::Wait(ScopedExclusiveLock<> &lock)
+{
+    Z_ASSERT_ERROR(lock.IsOwner(), "The lock does not own the mutex. Locks can only unlock mutexes they already own.");
+
+    // The sequence number is read before unlocking, so a notification sent after that makes the wait return immediately
+    const u32_z SEQUENCE = m_uSequence.load();
+    m_uWaiterCount.fetch_add(1U);
+
+    lock.Unlock();
+    SFutex::Wait(m_uSequence, SEQUENCE);
+    m_uWaiterCount.fetch_sub(1U, boost::memory_order_relaxed);
+    lock.Lock();
+}
+
+bool MutexConditionVariable::WaitFor(ScopedExclusiveLock<> &lock, const TimeSpan &timeout)
+{
+    Z_ASSERT_ERROR(lock.IsOwner(), "The lock does not own the mutex. Locks can only unlock mutexes they already own.");
+
+    const u32_z SEQUENCE = m_uSequence.load();
+    m_uWaiterCount.fetch_add(1U);
+
+    lock.Unlock();
+    const bool bNotified = SFutex::Wait(m_uSequence, SEQUENCE, timeout);
+    m_uWaiterCount.fetch_sub(1U, boost::memory_order_relaxed);
+    lock.Lock();
+
+    return bNotified;
+}
+
+void MutexConditionVariable::NotifyOne()
+{
+    m_uSequence.fetch_add(1U);
+
+    if(m_uWaiterCount.load() > 0)
+        SFutex::WakeOne(m_uSequence);
+}
+
+void MutexConditionVariable::NotifyAll()
+{
+    m_uSequence.fetch_add(1U);
+
+    if(m_uWaiterCount.load() > 0)
+        SFutex::WakeAll(m_uSequence);
+}
+
+} // namespace z
@@ -0,0 +1,354 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/Pipeline.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SMonotonicClock.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+Pipeline::Pipeline() : m_arStages(null_z),
+                       m_uStageCount(0),
+                       m_uTokenLimit(0),
+                       m_uTokensInFlight(0)
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+Pipeline::~Pipeline()
+{
+    for(puint_z i = 0; i < m_uStageCount; ++i)
+        delete m_arStages[i];
+
+    delete[] m_arStages;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void Pipeline::AddStage(const Pipeline::StageFunction &function, const EPipelineStageMode &eMode, const u32_z uConcurrency)
+{
+    Z_ASSERT_ERROR(!function.IsNull(), "The function of the stage cannot be null.");
+    Z_ASSERT_ERROR(uConcurrency > 0, "The concurrency of the stage must be greater than zero.");
+    Z_ASSERT_ERROR(eMode == EPipelineStageMode::E_Parallel || uConcurrency == 1U, "The concurrency of serial stages must be 1.");
+    Z_ASSERT_ERROR(m_uStageCount > 0 || eMode != EPipelineStageMode::E_Parallel, "The first stage must be serial.");
+
+    Stage** arStages = new Stage*[m_uStageCount + 1U];
+
+    for(puint_z i = 0; i < m_uStageCount; ++i)
+        arStages[i] = m_arStages[i];
+
+    arStages[m_uStageCount] = new Stage(function, eMode, uConcurrency);
+
+    delete[] m_arStages;
+    m_arStages = arStages;
+    ++m_uStageCount;
+}
+
+void Pipeline::Run(const puint_z uTokenLimit)
+{
+    Z_ASSERT_ERROR(m_uStageCount > 0, "The pipeline has no stages.");
+    Z_ASSERT_ERROR(uTokenLimit > 0, "The token limit must be greater than zero.");
+
+    m_uTokenLimit = uTokenLimit;
+    m_uTokensInFlight.store(0);
+
+    u32_z uThreadCount = 0;
+
+    for(puint_z i = 0; i < m_uStageCount; ++i)
+    {
+        Stage* pStage = m_arStages[i];
+        pStage->m_uNextSequence = 0;
+        pStage->m_uProcessedCount.store(0);
+        pStage->m_uFilteredCount.store(0);
+        pStage->m_uBusyNanoseconds.store(0);
+        pStage->m_uQueueDepthSum.store(0);
+        pStage->m_uQueueDepthSampleCount.store(0);
+        pStage->m_uQueueDepthMaximum.store(0);
+        uThreadCount += pStage->m_uWorkerCount;
+
+        if(i > 0)
+        {
+            // Enqueuing never blocks: there cannot be more tokens than the limit and the signals to finish are sent when all the tokens have been released
+            const puint_z QUEUE_CAPACITY = uTokenLimit > pStage->m_uWorkerCount ? uTokenLimit : pStage->m_uWorkerCount;
+            pStage->m_pInputQueue = new TokenQueue(QUEUE_CAPACITY);
+
+            // Tokens in flight have consecutive sequences, so they never share a position of the buffer
+            if(pStage->m_eMode == EPipelineStageMode::E_SerialInOrder)
+                pStage->m_arReorderBuffer = new Token[uTokenLimit];
+        }
+    }
+
+    Thread** arThreads = new Thread*[uThreadCount];
+    u32_z uThread = 0;
+
+    for(puint_z i = 0; i < m_uStageCount; ++i)
+    {
+        for(u32_z j = 0; j < m_arStages[i]->m_uWorkerCount; ++j)
+        {
+            arThreads[uThread] = new Thread(Delegate<void(Pipeline*, puint_z)>(&Pipeline::_ExecuteStage), this, i);
+            ++uThread;
+        }
+    }
+
+    // The first thread executes the first stage, which finishes when there are no more tokens
+    arThreads[0]->Join();
+    delete arThreads[0];
+
+    while(m_uTokensInFlight.load() > 0)
+    {
+        const u32_z KEY = m_tokenReleased.PrepareWait();
+
+        if(m_uTokensInFlight.load() == 0)
+            m_tokenReleased.CancelWait();
+        else
+            m_tokenReleased.Wait(KEY);
+    }
+
+    for(puint_z i = 1U; i < m_uStageCount; ++i)
+        for(u32_z j = 0; j < m_arStages[i]->m_uWorkerCount; ++j)
+            m_arStages[i]->m_pInputQueue->Enqueue(Token(null_z, NO_SEQUENCE, true));
+
+    // The first thread was already joined
+    for(u32_z i = 1U; i < uThreadCount; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    delete[] arThreads;
+
+    for(puint_z i = 1U; i < m_uStageCount; ++i)
+    {
+        delete m_arStages[i]->m_pInputQueue;
+        m_arStages[i]->m_pInputQueue = null_z;
+        delete[] m_arStages[i]->m_arReorderBuffer;
+        m_arStages[i]->m_arReorderBuffer = null_z;
+    }
+}
+
+void Pipeline::_ExecuteStage(Pipeline* pPipeline, const puint_z uStageIndex)
+{
+    if(uStageIndex == 0)
+        pPipeline->_ProduceTokens();
+    else
+        pPipeline->_ConsumeTokens(uStageIndex);
+}
+
+void Pipeline::_ProduceTokens()
+{
+    Stage* pStage = m_arStages[0];
+    u64_z uProcessedCount = 0;
+    u64_z uBusyNanoseconds = 0;
+    bool bFinished = false;
+
+    while(!bFinished)
+    {
+        // Only this thread adds tokens, so the limit cannot be exceeded between the check and the addition
+        while(m_uTokensInFlight.load() >= m_uTokenLimit)
+        {
+            const u32_z KEY = m_tokenReleased.PrepareWait();
+
+            if(m_uTokensInFlight.load() < m_uTokenLimit)
+                m_tokenReleased.CancelWait();
+            else
+                m_tokenReleased.Wait(KEY);
+        }
+
+        const u64_z START_INSTANT = SMonotonicClock::GetNanoseconds();
+        void* pData = pStage->m_function(null_z);
+        uBusyNanoseconds += SMonotonicClock::GetNanoseconds() - START_INSTANT;
+
+        if(pData == null_z)
+        {
+            bFinished = true;
+        }
+        else
+        {
+            ++uProcessedCount;
+            m_uTokensInFlight.fetch_add(1U);
+            this->_ForwardToken(0, Token(pData, pStage->m_uNextSequence, false));
+            ++pStage->m_uNextSequence;
+        }
+    }
+
+    pStage->m_uProcessedCount.fetch_add(uProcessedCount);
+    pStage->m_uBusyNanoseconds.fetch_add(uBusyNanoseconds);
+}
+
+void Pipeline::_ConsumeTokens(const puint_z uStageIndex)
+{
+    Stage* pStage = m_arStages[uStageIndex];
+    u64_z uProcessedCount = 0;
+    u64_z uFilteredCount = 0;
+    u64_z uBusyNanoseconds = 0;
+    u64_z uQueueDepthSum = 0;
+    u64_z uQueueDepthSampleCount = 0;
+    puint_z uQueueDepthMaximum = 0;
+    Token token;
+    bool bFinished = false;
+
+    while(!bFinished)
+    {
+        const puint_z QUEUE_DEPTH = pStage->m_pInputQueue->GetCount();
+        pStage->m_pInputQueue->Dequeue(token);
+
+        if(token.m_bStop)
+        {
+            bFinished = true;
+        }
+        else
+        {
+            uQueueDepthSum += QUEUE_DEPTH;
+            ++uQueueDepthSampleCount;
+
+            if(QUEUE_DEPTH > uQueueDepthMaximum)
+                uQueueDepthMaximum = QUEUE_DEPTH;
+
+            if(pStage->m_eMode == EPipelineStageMode::E_SerialInOrder)
+            {
+                // The token waits in the buffer until all the previous tokens have been processed
+                pStage->m_arReorderBuffer[token.m_uSequence % m_uTokenLimit] = token;
+                const Token* pNextToken = &pStage->m_arReorderBuffer[pStage->m_uNextSequence % m_uTokenLimit];
+
+                while(pNextToken->m_uSequence == pStage->m_uNextSequence)
+                {
+                    this->_ProcessToken(uStageIndex, *pNextToken, uProcessedCount, uFilteredCount, uBusyNanoseconds);
+                    ++pStage->m_uNextSequence;
+                    pNextToken = &pStage->m_arReorderBuffer[pStage->m_uNextSequence % m_uTokenLimit];
+                }
+            }
+            else
+            {
+                this->_ProcessToken(uStageIndex, token, uProcessedCount, uFilteredCount, uBusyNanoseconds);
+            }
+        }
+    }
+
+    pStage->m_uProcessedCount.fetch_add(uProcessedCount);
+    pStage->m_uFilteredCount.fetch_add(uFilteredCount);
+    pStage->m_uBusyNanoseconds.fetch_add(uBusyNanoseconds);
+    pStage->m_uQueueDepthSum.fetch_add(uQueueDepthSum);
+    pStage->m_uQueueDepthSampleCount.fetch_add(uQueueDepthSampleCount);
+
+    // When the exchange fails, the current maximum is updated with the value stored by another worker thread
+    puint_z uCurrentMaximum = pStage->m_uQueueDepthMaximum.load();
+    bool bIsStored = uQueueDepthMaximum <= uCurrentMaximum;
+
+    while(!bIsStored)
+        bIsStored = pStage->m_uQueueDepthMaximum.compare_exchange_weak(uCurrentMaximum, uQueueDepthMaximum) || uQueueDepthMaximum <= uCurrentMaximum;
+}
+
+void Pipeline::_ProcessToken(const puint_z uStageIndex, Pipeline::Token token, u64_z &uProcessedCount, u64_z &uFilteredCount, u64_z &uBusyNanoseconds)
+{
+    if(token.m_pData != null_z)
+    {
+        const u64_z START_INSTANT = SMonotonicClock::GetNanoseconds();
+        token.m_pData = m_arStages[uStageIndex]->m_function(token.m_pData);
+        uBusyNanoseconds += SMonotonicClock::GetNanoseconds() - START_INSTANT;
+        ++uProcessedCount;
+
+        if(token.m_pData == null_z)
+            ++uFilteredCount;
+    }
+
+    this->_ForwardToken(uStageIndex, token);
+}
+
+void Pipeline::_ForwardToken(const puint_z uStageIndex, const Pipeline::Token &token)
+{
+    if(uStageIndex + 1U < m_uStageCount)
+    {
+        m_arStages[uStageIndex + 1U]->m_pInputQueue->Enqueue(token);
+    }
+    else
+    {
+        m_uTokensInFlight.fetch_sub(1U);
+        m_tokenReleased.NotifyAll();
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+puint_z Pipeline::GetStageCount() const
+{
+    return m_uStageCount;
+}
+
+PipelineStageStatistics Pipeline::GetStageStatistics(const puint_z uStageIndex) const
+{
+    Z_ASSERT_ERROR(uStageIndex < m_uStageCount, "The index of the stage is out of bounds.");
+
+    const Stage* pStage = m_arStages[uStageIndex];
+
+    return PipelineStageStatistics(pStage->m_uProcessedCount.load(), 
+                                   pStage->m_uFilteredCount.load(), 
+                                   pStage->m_uWorkerCount, 
+                                   pStage->m_uBusyNanoseconds.load(), 
+                                   pStage->m_uQueueDepthSum.load(), 
+                                   pStage->m_uQueueDepthSampleCount.load(), 
+                                   pStage->m_uQueueDepthMaximum.load());
+}
+
+} // namespace z
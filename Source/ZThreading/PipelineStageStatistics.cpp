@@ -0,0 +1,114 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/PipelineStageStatistics.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/DataTypes/SFloat.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+PipelineStageStatistics::PipelineStageStatistics(const u64_z uProcessedCount, 
+                                                 const u64_z uFilteredCount, 
+                                                 const u32_z uWorkerCount, 
+                                                 const u64_z uBusyNanoseconds, 
+                                                 const u64_z uQueueDepthSum, 
+                                                 const u64_z uQueueDepthSampleCount, 
+                                                 const puint_z uQueueDepthMaximum) : m_uProcessedCount(uProcessedCount),
+                                                                                     m_uFilteredCount(uFilteredCount),
+                                                                                     m_uWorkerCount(uWorkerCount),
+                                                                                     m_uBusyNanoseconds(uBusyNanoseconds),
+                                                                                     m_uQueueDepthSum(uQueueDepthSum),
+                                                                                     m_uQueueDepthSampleCount(uQueueDepthSampleCount),
+                                                                                     m_uQueueDepthMaximum(uQueueDepthMaximum)
+{
+    Z_ASSERT_ERROR(uWorkerCount > 0, "The number of worker threads must be greater than zero.");
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u64_z PipelineStageStatistics::GetProcessedCount() const
+{
+    return m_uProcessedCount;
+}
+
+u64_z PipelineStageStatistics::GetFilteredCount() const
+{
+    return m_uFilteredCount;
+}
+
+u32_z PipelineStageStatistics::GetWorkerCount() const
+{
+    return m_uWorkerCount;
+}
+
+TimeSpan PipelineStageStatistics::GetBusyTime() const
+{
+    static const u64_z NANOSECONDS_IN_HUNDRED = 100ULL;
+
+    return TimeSpan(m_uBusyNanoseconds / NANOSECONDS_IN_HUNDRED);
+}
+
+float_z PipelineStageStatistics::GetThroughput() const
+{
+    static const float_z NANOSECONDS_IN_SECOND = scast_z(1000000000.0, float_z);
+
+    return m_uBusyNanoseconds == 0 ? SFloat::_0 : 
+                                     scast_z(m_uProcessedCount, float_z) * scast_z(m_uWorkerCount, float_z) * NANOSECONDS_IN_SECOND / scast_z(m_uBusyNanoseconds, float_z);
+}
+
+float_z PipelineStageStatistics::GetAverageQueueDepth() const
+{
+    return m_uQueueDepthSampleCount == 0 ? SFloat::_0 : 
+                                           scast_z(m_uQueueDepthSum, float_z) / scast_z(m_uQueueDepthSampleCount, float_z);
+}
+
+puint_z PipelineStageStatistics::GetMaximumQueueDepth() const
+{
+    return m_uQueueDepthMaximum;
+}
+
+} // namespace z
@@ -0,0 +1,199 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZThreading/ProcessorSet.h"
+
+#include "ZCommon/Assertions.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+ProcessorSet::ProcessorSet()
+{
+    this->Clear();
+}
+
+ProcessorSet::ProcessorSet(const u32_z uProcessor)
+{
+    this->Clear();
+    this->Add(uProcessor);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+bool ProcessorSet::operator==(const ProcessorSet &processorSet) const
+{
+    bool bAreEqual = true;
+
+    for(u32_z i = 0; i < MASKS_COUNT && bAreEqual; ++i)
+        bAreEqual = m_arMasks[i] == processorSet.m_arMasks[i];
+
+    return bAreEqual;
+}
+
+bool ProcessorSet::operator!=(const ProcessorSet &processorSet) const
+{
+    return !(*this == processorSet);
+}
+
+void ProcessorSet::Add(const u32_z uProcessor)
+{
+    Z_ASSERT_ERROR(uProcessor < MAXIMUM_PROCESSORS, "The index of the processor must be lower than the maximum number of processors.");
+
+    if(uProcessor < MAXIMUM_PROCESSORS)
+        m_arMasks[uProcessor / PROCESSORS_PER_MASK] |= 1ULL << (uProcessor % PROCESSORS_PER_MASK);
+}
+
+void ProcessorSet::Add(const ProcessorSet &processorSet)
+{
+    for(u32_z i = 0; i < MASKS_COUNT; ++i)
+        m_arMasks[i] |= processorSet.m_arMasks[i];
+}
+
+void ProcessorSet::Remove(const u32_z uProcessor)
+{
+    Z_ASSERT_ERROR(uProcessor < MAXIMUM_PROCESSORS, "The index of the processor must be lower than the maximum number of processors.");
+
+    if(uProcessor < MAXIMUM_PROCESSORS)
+        m_arMasks[uProcessor / PROCESSORS_PER_MASK] &= ~(1ULL << (uProcessor % PROCESSORS_PER_MASK));
+}
+
+void ProcessorSet::Clear()
+{
+    for(u32_z i = 0; i < MASKS_COUNT; ++i)
+        m_arMasks[i] = 0;
+}
+
+bool ProcessorSet::Contains(const u32_z uProcessor) const
+{
+    Z_ASSERT_ERROR(uProcessor < MAXIMUM_PROCESSORS, "The index of the processor must be lower than the maximum number of processors.");
+
+    return uProcessor < MAXIMUM_PROCESSORS && 
+           (m_arMasks[uProcessor / PROCESSORS_PER_MASK] & (1ULL << (uProcessor % PROCESSORS_PER_MASK))) != 0;
+}
+
+u32_z ProcessorSet::GetNext(const u32_z uProcessor) const
+{
+    u32_z uFoundProcessor = ProcessorSet::NO_PROCESSOR;
+
+    for(u32_z i = uProcessor; i < MAXIMUM_PROCESSORS && uFoundProcessor == ProcessorSet::NO_PROCESSOR; ++i)
+    {
+        // Skips empty masks
+        if(i % PROCESSORS_PER_MASK == 0 && m_arMasks[i / PROCESSORS_PER_MASK] == 0)
+            i += PROCESSORS_PER_MASK - 1U;
+        else if((m_arMasks[i / PROCESSORS_PER_MASK] & (1ULL << (i % PROCESSORS_PER_MASK))) != 0)
+            uFoundProcessor = i;
+    }
+
+    return uFoundProcessor;
+}
+
+string_z ProcessorSet::ToString() const
+{
+    static const char* RANGE_SEPARATOR = "-";
+    static const char* LIST_SEPARATOR = ",";
+
+    string_z strResult;
+    u32_z uFirst = this->GetNext(0);
+
+    while(uFirst != ProcessorSet::NO_PROCESSOR)
+    {
+        // Finds the end of the range of contiguous processors
+        u32_z uLast = uFirst;
+
+        while(uLast + 1U < MAXIMUM_PROCESSORS && this->Contains(uLast + 1U))
+            ++uLast;
+
+        if(!strResult.IsEmpty())
+            strResult.Append(LIST_SEPARATOR);
+
+        strResult.Append(uFirst);
+
+        if(uLast != uFirst)
+        {
+            strResult.Append(RANGE_SEPARATOR);
+            strResult.Append(uLast);
+        }
+
+        uFirst = uLast + 1U < MAXIMUM_PROCESSORS ? this->GetNext(uLast + 1U) : ProcessorSet::NO_PROCESSOR;
+    }
+
+    return strResult;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_z ProcessorSet::GetCount() const
+{
+    u32_z uCount = 0;
+
+    for(u32_z i = 0; i < MASKS_COUNT; ++i)
+    {
+        // Counts the bits set to 1 by clearing the lowest one every iteration
+        for(u64_z uMask = m_arMasks[i]; uMask != 0; uMask &= uMask - 1ULL)
+            ++uCount;
+    }
+
+    return uCount;
+}
+
+bool ProcessorSet::IsEmpty() const
+{
+    bool bIsEmpty = true;
+
+    for(u32_z i = 0; i < MASKS_COUNT && bIsEmpty; ++i)
+        bIsEmpty = m_arMasks[i] == 0;
+
+    return bIsEmpty;
+}
+
+} // namespace z
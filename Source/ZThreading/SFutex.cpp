@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/SFutex.h"
+
+#include "ZThreading/SProcessorTopology.h"
+#include "ZThreading/SThisThread.h"
+
+#if defined(Z_OS_WINDOWS)
+    #include <Windows.h>
+    #include <synchapi.h>
+#elif defined(Z_OS_LINUX)
+    #include <climits>
+    #include <unistd.h>
+    #include <cerrno>
+    #include <ctime>
+    #include <linux/futex.h>
+    #include <sys/syscall.h>
+#endif
+
+
+namespace z
+{
+    
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+#if defined(Z_OS_WINDOWS)
+
+void SFutex::Wait(const boost::atomic<u32_z> &uValue, const u32_z uExpectedValue)
+{
+    u32_z uComparand = uExpectedValue;
+    ::WaitOnAddress(SFutex::_GetAddress(uValue), &uComparand, sizeof(u32_z), INFINITE);
+}
+
+bool SFutex::Wait(const boost::atomic<u32_z> &uValue, const u32_z uExpectedValue, const TimeSpan &timeout)
+{
+    // INFINITE is the maximum value of a DWORD, so longer timeouts are shortened; the caller will see a spurious wake-up
+    static const u64_z MAXIMUM_MILLISECONDS = INFINITE - 1U;
+
+    const u64_z TIMEOUT_MILLISECONDS = timeout.GetMilliseconds() < MAXIMUM_MILLISECONDS ? timeout.GetMilliseconds() : MAXIMUM_MILLISECONDS;
+    u32_z uComparand = uExpectedValue;
+
+    return ::WaitOnAddress(SFutex::_GetAddress(uValue), &uComparand, sizeof(u32_z), scast_z(TIMEOUT_MILLISECONDS, DWORD)) == TRUE || 
+           ::GetLastError() != ERROR_TIMEOUT;
+}
+
+void SFutex::WakeOne(boost::atomic<u32_z> &uValue)
+{
+    ::WakeByAddressSingle(SFutex::_GetAddress(uValue));
+}
+
+void SFutex::WakeAll(boost::atomic<u32_z> &uValue)
+{
+    ::WakeByAddressAll(SFutex::_GetAddress(uValue));
+}
+
+#elif defined(Z_OS_LINUX)
+
+void SFutex::Wait(const boost::atomic<u32_z> &uValue, const u32_z uExpectedValue)
+{
+    ::syscall(SYS_futex, SFutex::_GetAddress(uValue), FUTEX_WAIT_PRIVATE, uExpectedValue, null_z, null_z, 0);
+}
+
+bool SFutex::Wait(const boost::atomic<u32_z> &uValue, const u32_z uExpectedValue, const TimeSpan &timeout)
+{
+    static const u64_z HUNDREDS_OF_NANOSECONDS_IN_SECOND = 10000000ULL;
+    static const u64_z NANOSECONDS_IN_HUNDRED = 100ULL;
+
+    const u64_z TIMEOUT = timeout.GetHundredsOfNanoseconds();
+
+    timespec timeSpecData;
+    timeSpecData.tv_sec = scast_z(TIMEOUT / HUNDREDS_OF_NANOSECONDS_IN_SECOND, time_t);
+    timeSpecData.tv_nsec = scast_z(TIMEOUT % HUNDREDS_OF_NANOSECONDS_IN_SECOND * NANOSECONDS_IN_HUNDRED, long);
+
+    return ::syscall(SYS_futex, SFutex::_GetAddress(uValue), FUTEX_WAIT_PRIVATE, uExpectedValue, &timeSpecData, null_z, 0) == 0 || 
+           errno != ETIMEDOUT;
+}
+
+void SFutex::WakeOne(boost::atomic<u32_z> &uValue)
+{
+    ::syscall(SYS_futex, SFutex::_GetAddress(uValue), FUTEX_WAKE_PRIVATE, 1, null_z, null_z, 0);
+}
+
+void SFutex::WakeAll(boost::atomic<u32_z> &uValue)
+{
+    ::syscall(SYS_futex, SFutex::_GetAddress(uValue), FUTEX_WAKE_PRIVATE, INT_MAX, null_z, null_z, 0);
+}
+
+#elif defined(Z_OS_MAC)
+
+void SFutex::Wait(const boost::atomic<u32_z> &uValue, const u32_z uExpectedValue)
+{
+    if(uValue.load(boost::memory_order_relaxed) == uExpectedValue)
+        SThisThread::Yield();
+}
+
+bool SFutex::Wait(const boost::atomic<u32_z> &uValue, const u32_z uExpectedValue, const TimeSpan &timeout)
+{
+    SFutex::Wait(uValue, uExpectedValue);
+    return true;
+}
+
+void SFutex::WakeOne(boost::atomic<u32_z> &uValue)
+{
+}
+
+void SFutex::WakeAll(boost::atomic<u32_z> &uValue)
+{
+}
+
+#endif
+
+u32_z* SFutex::_GetAddress(const boost::atomic<u32_z> &uValue)
+{
+    // Lock-free atomic integers have the same size and representation as the integer they contain
+    return ccast_z(rcast_z(&uValue, const u32_z*), u32_z*);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_z SFutex::GetSpinCount()
+{
+    static const u32_z SPIN_COUNT = SProcessorTopology::GetLogicalProcessorCount() > 1U ? SFutex::MAXIMUM_SPIN_COUNT : 0;
+    return SPIN_COUNT;
+}
+
+} // namespace z
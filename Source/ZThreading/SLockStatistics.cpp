@@ -0,0 +1,317 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/SLockStatistics.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/SInternalLogger.h"
+#include <cstring>
+
+
+namespace z
+{
+
+/// <summary>
+/// Adds an amount to a counter that is only modified by the calling thread, so it does not need an atomic read-modify-write operation.
+/// </summary>
+/// <param name="counter">[IN/OUT] The counter.</param>
+/// <param name="uAmount">[IN] The amount to add.</param>
+static void AddToCounter(boost::atomic<u64_z> &counter, const u64_z uAmount)
+{
+    counter.store(counter.load(boost::memory_order_relaxed) + uAmount, boost::memory_order_relaxed);
+}
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const char* SLockStatistics::sm_arLockNames[SLockStatistics::MAXIMUM_LOCK_NAMES];
+u32_z SLockStatistics::sm_uLockNameCount = 0;
+SLockStatistics::ThreadCounters* SLockStatistics::sm_pFirstThreadCounters = null_z;
+SLockStatistics::ThreadCounters* SLockStatistics::sm_pFirstFreeThreadCounters = null_z;
+Mutex::FutexMutex SLockStatistics::sm_mutex;
+boost::thread_specific_ptr<SLockStatistics::ThreadCounters> SLockStatistics::sm_pThreadCounters(&SLockStatistics::_ReleaseThreadCounters);
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+SLockStatistics::LockCounters::LockCounters() : m_uAcquisitionCount(0),
+                                                m_uContendedAcquisitionCount(0),
+                                                m_uWaitNanoseconds(0),
+                                                m_uHoldCount(0),
+                                                m_uHoldNanoseconds(0)
+{
+    for(u32_z i = 0; i < LockStatistics::HISTOGRAM_BUCKET_COUNT; ++i)
+    {
+        m_arWaitTimeHistogram[i].store(0, boost::memory_order_relaxed);
+        m_arHoldTimeHistogram[i].store(0, boost::memory_order_relaxed);
+    }
+}
+
+SLockStatistics::ThreadCounters::ThreadCounters() : m_pNext(null_z),
+                                                    m_pNextFree(null_z)
+{
+    for(u32_z i = 0; i < SLockStatistics::MAXIMUM_LOCK_NAMES; ++i)
+        m_arLockCounters[i].store(null_z, boost::memory_order_relaxed);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void SLockStatistics::Dump()
+{
+    const u32_z LOCK_NAME_COUNT = SLockStatistics::GetLockNameCount();
+
+    for(u32_z i = 0; i < LOCK_NAME_COUNT; ++i)
+        SInternalLogger::Log(SLockStatistics::GetStatistics(i).ToString());
+}
+
+void SLockStatistics::Dump(const Delegate<void (const LockStatistics&)> &exporter)
+{
+    const u32_z LOCK_NAME_COUNT = SLockStatistics::GetLockNameCount();
+
+    for(u32_z i = 0; i < LOCK_NAME_COUNT; ++i)
+        exporter(SLockStatistics::GetStatistics(i));
+}
+
+u32_z SLockStatistics::_RegisterLock(const char* szName)
+{
+    u32_z uLockIndex = SLockStatistics::UNTRACKED_LOCK;
+
+    if(szName != null_z)
+    {
+        sm_mutex.lock();
+
+        u32_z i = 0;
+
+        while(i < sm_uLockNameCount && strcmp(sm_arLockNames[i], szName) != 0)
+            ++i;
+
+        if(i < sm_uLockNameCount)
+        {
+            uLockIndex = i + 1U;
+        }
+        else if(sm_uLockNameCount < SLockStatistics::MAXIMUM_LOCK_NAMES)
+        {
+            sm_arLockNames[sm_uLockNameCount] = szName;
+            ++sm_uLockNameCount;
+            uLockIndex = sm_uLockNameCount;
+        }
+
+        sm_mutex.unlock();
+    }
+
+    return uLockIndex;
+}
+
+void SLockStatistics::_RecordAcquisition(const u32_z uLockIndex, const bool bIsContended, const u64_z uWaitNanoseconds)
+{
+    LockCounters &counters = SLockStatistics::_GetLockCounters(uLockIndex);
+
+    AddToCounter(counters.m_uAcquisitionCount, 1U);
+
+    if(bIsContended)
+    {
+        AddToCounter(counters.m_uContendedAcquisitionCount, 1U);
+        AddToCounter(counters.m_uWaitNanoseconds, uWaitNanoseconds);
+        AddToCounter(counters.m_arWaitTimeHistogram[LockStatistics::GetHistogramBucket(uWaitNanoseconds)], 1U);
+    }
+}
+
+void SLockStatistics::_RecordHold(const u32_z uLockIndex, const u64_z uHoldNanoseconds)
+{
+    LockCounters &counters = SLockStatistics::_GetLockCounters(uLockIndex);
+
+    AddToCounter(counters.m_uHoldCount, 1U);
+    AddToCounter(counters.m_uHoldNanoseconds, uHoldNanoseconds);
+    AddToCounter(counters.m_arHoldTimeHistogram[LockStatistics::GetHistogramBucket(uHoldNanoseconds)], 1U);
+}
+
+void SLockStatistics::_ReleaseThreadCounters(ThreadCounters* pThreadCounters)
+{
+    // The counters are never deleted, they keep the values recorded by the thread
+    sm_mutex.lock();
+    pThreadCounters->m_pNextFree = sm_pFirstFreeThreadCounters;
+    sm_pFirstFreeThreadCounters = pThreadCounters;
+    sm_mutex.unlock();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+bool SLockStatistics::IsEnabled()
+{
+    return Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED;
+}
+
+u32_z SLockStatistics::GetLockNameCount()
+{
+    sm_mutex.lock();
+    const u32_z LOCK_NAME_COUNT = sm_uLockNameCount;
+    sm_mutex.unlock();
+
+    return LOCK_NAME_COUNT;
+}
+
+LockStatistics SLockStatistics::GetStatistics(const u32_z uLockName)
+{
+    Z_ASSERT_ERROR(uLockName < SLockStatistics::GetLockNameCount(), "The index of the lock name must be lower than the number of lock names.");
+
+    u64_z uAcquisitionCount = 0;
+    u64_z uContendedAcquisitionCount = 0;
+    u64_z uWaitNanoseconds = 0;
+    u64_z uHoldCount = 0;
+    u64_z uHoldNanoseconds = 0;
+    u64_z arWaitTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    u64_z arHoldTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+
+    sm_mutex.lock();
+
+    for(ThreadCounters* pThreadCounters = sm_pFirstThreadCounters; pThreadCounters != null_z; pThreadCounters = pThreadCounters->m_pNext)
+    {
+        // The owner thread publishes the counters after initializing them
+        const LockCounters* pCounters = pThreadCounters->m_arLockCounters[uLockName].load(boost::memory_order_acquire);
+
+        if(pCounters != null_z)
+        {
+            uAcquisitionCount += pCounters->m_uAcquisitionCount.load(boost::memory_order_relaxed);
+            uContendedAcquisitionCount += pCounters->m_uContendedAcquisitionCount.load(boost::memory_order_relaxed);
+            uWaitNanoseconds += pCounters->m_uWaitNanoseconds.load(boost::memory_order_relaxed);
+            uHoldCount += pCounters->m_uHoldCount.load(boost::memory_order_relaxed);
+            uHoldNanoseconds += pCounters->m_uHoldNanoseconds.load(boost::memory_order_relaxed);
+
+            for(u32_z i = 0; i < LockStatistics::HISTOGRAM_BUCKET_COUNT; ++i)
+            {
+                arWaitTimeHistogram[i] += pCounters->m_arWaitTimeHistogram[i].load(boost::memory_order_relaxed);
+                arHoldTimeHistogram[i] += pCounters->m_arHoldTimeHistogram[i].load(boost::memory_order_relaxed);
+            }
+        }
+    }
+
+    sm_mutex.unlock();
+
+    // Values recorded meanwhile by other threads may have been read partially
+    if(uContendedAcquisitionCount > uAcquisitionCount)
+        uContendedAcquisitionCount = uAcquisitionCount;
+
+    return LockStatistics(string_z(sm_arLockNames[uLockName]), 
+                          uAcquisitionCount, 
+                          uContendedAcquisitionCount, 
+                          uWaitNanoseconds, 
+                          uHoldCount, 
+                          uHoldNanoseconds, 
+                          arWaitTimeHistogram, 
+                          arHoldTimeHistogram);
+}
+
+LockStatistics SLockStatistics::GetStatistics(const char* szName)
+{
+    Z_ASSERT_ERROR(szName != null_z, "The name of the lock cannot be null.");
+
+    static const u64_z EMPTY_HISTOGRAM[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+
+    const u32_z LOCK_NAME_COUNT = SLockStatistics::GetLockNameCount();
+    u32_z uLockName = 0;
+
+    // Names are never removed, so the ones read before unlocking are still valid
+    while(uLockName < LOCK_NAME_COUNT && strcmp(sm_arLockNames[uLockName], szName) != 0)
+        ++uLockName;
+
+    return uLockName < LOCK_NAME_COUNT ? SLockStatistics::GetStatistics(uLockName) : 
+                                         LockStatistics(string_z(szName), 0, 0, 0, 0, 0, EMPTY_HISTOGRAM, EMPTY_HISTOGRAM);
+}
+
+SLockStatistics::LockCounters& SLockStatistics::_GetLockCounters(const u32_z uLockIndex)
+{
+    ThreadCounters* pThreadCounters = sm_pThreadCounters.get();
+
+    if(pThreadCounters == null_z)
+    {
+        // The counters of threads that ended are reused before creating new ones
+        sm_mutex.lock();
+        pThreadCounters = sm_pFirstFreeThreadCounters;
+
+        if(pThreadCounters != null_z)
+        {
+            sm_pFirstFreeThreadCounters = pThreadCounters->m_pNextFree;
+            pThreadCounters->m_pNextFree = null_z;
+        }
+
+        sm_mutex.unlock();
+
+        if(pThreadCounters == null_z)
+        {
+            pThreadCounters = new ThreadCounters();
+
+            sm_mutex.lock();
+            pThreadCounters->m_pNext = sm_pFirstThreadCounters;
+            sm_pFirstThreadCounters = pThreadCounters;
+            sm_mutex.unlock();
+        }
+
+        sm_pThreadCounters.reset(pThreadCounters);
+    }
+
+    const u32_z LOCK_NAME = uLockIndex - 1U;
+    LockCounters* pLockCounters = pThreadCounters->m_arLockCounters[LOCK_NAME].load(boost::memory_order_relaxed);
+
+    if(pLockCounters == null_z)
+    {
+        pLockCounters = new LockCounters();
+        pThreadCounters->m_arLockCounters[LOCK_NAME].store(pLockCounters, boost::memory_order_release);
+    }
+
+    return *pLockCounters;
+}
+
+} // namespace z
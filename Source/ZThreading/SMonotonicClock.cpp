@@ -0,0 +1,87 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZThreading/SMonotonicClock.h"
+
+#if defined(Z_OS_WINDOWS)
+    #include <Windows.h>
+#elif defined(Z_OS_LINUX)
+    #include <ctime>
+#elif defined(Z_OS_MAC)
+    #include <mach/mach_time.h>
+#endif
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u64_z SMonotonicClock::GetNanoseconds()
+{
+    static const u64_z NANOSECONDS_IN_SECOND = 1000000000ULL;
+
+#if defined(Z_OS_WINDOWS)
+
+    static LARGE_INTEGER frequency = { 0 };
+
+    if(frequency.QuadPart == 0)
+        ::QueryPerformanceFrequency(&frequency);
+
+    LARGE_INTEGER ticks;
+    ::QueryPerformanceCounter(&ticks);
+
+    return ticks.QuadPart / frequency.QuadPart * NANOSECONDS_IN_SECOND + 
+           ticks.QuadPart % frequency.QuadPart * NANOSECONDS_IN_SECOND / frequency.QuadPart;
+
+#elif defined(Z_OS_LINUX)
+
+    timespec timeSpecData;
+    ::clock_gettime(CLOCK_MONOTONIC, &timeSpecData);
+
+    return timeSpecData.tv_sec * NANOSECONDS_IN_SECOND + timeSpecData.tv_nsec;
+
+#elif defined(Z_OS_MAC)
+
+    static mach_timebase_info_data_t timebaseInfo = { 0, 0 };
+
+    if(timebaseInfo.denom == 0)
+        ::mach_timebase_info(&timebaseInfo);
+
+    return ::mach_absolute_time() * timebaseInfo.numer / timebaseInfo.denom;
+
+#endif
+}
+
+} // namespace z
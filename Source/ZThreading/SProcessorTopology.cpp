@@ -0,0 +1,515 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZThreading/SProcessorTopology.h"
+
+#include "ZCommon/Assertions.h"
+
+#if defined(Z_OS_WINDOWS)
+    #include <Windows.h>
+#elif defined(Z_OS_LINUX)
+    #include <cstdio>
+    #include <unistd.h>
+#elif defined(Z_OS_MAC)
+    #include <sys/types.h>
+    #include <sys/sysctl.h>
+#endif
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+SProcessorTopology::ProcessorInfo SProcessorTopology::sm_arProcessors[ProcessorSet::MAXIMUM_PROCESSORS];
+u32_z SProcessorTopology::sm_uProcessorCount = 0;
+u32_z SProcessorTopology::sm_uCoreCount = 0;
+u32_z SProcessorTopology::sm_uPackageCount = 0;
+u32_z SProcessorTopology::sm_uNumaNodeCount = 0;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_z SProcessorTopology::GetCore(const u32_z uProcessor)
+{
+    const ProcessorInfo* arProcessors = SProcessorTopology::_GetProcessors();
+
+    Z_ASSERT_ERROR(uProcessor < sm_uProcessorCount, "The index of the processor must be lower than the number of logical processors.");
+
+    return arProcessors[uProcessor].m_uCore;
+}
+
+u32_z SProcessorTopology::GetPackage(const u32_z uProcessor)
+{
+    const ProcessorInfo* arProcessors = SProcessorTopology::_GetProcessors();
+
+    Z_ASSERT_ERROR(uProcessor < sm_uProcessorCount, "The index of the processor must be lower than the number of logical processors.");
+
+    return arProcessors[uProcessor].m_uPackage;
+}
+
+u32_z SProcessorTopology::GetNumaNode(const u32_z uProcessor)
+{
+    const ProcessorInfo* arProcessors = SProcessorTopology::_GetProcessors();
+
+    Z_ASSERT_ERROR(uProcessor < sm_uProcessorCount, "The index of the processor must be lower than the number of logical processors.");
+
+    return arProcessors[uProcessor].m_uNumaNode;
+}
+
+ProcessorSet SProcessorTopology::GetSmtSiblings(const u32_z uProcessor)
+{
+    const ProcessorInfo* arProcessors = SProcessorTopology::_GetProcessors();
+
+    Z_ASSERT_ERROR(uProcessor < sm_uProcessorCount, "The index of the processor must be lower than the number of logical processors.");
+
+    ProcessorSet siblings;
+
+    for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+        if(arProcessors[i].m_uCore == arProcessors[uProcessor].m_uCore)
+            siblings.Add(i);
+
+    return siblings;
+}
+
+ProcessorSet SProcessorTopology::GetProcessorsSharingCache(const u32_z uProcessor, const u32_z uCacheLevel)
+{
+    const ProcessorInfo* arProcessors = SProcessorTopology::_GetProcessors();
+
+    Z_ASSERT_ERROR(uProcessor < sm_uProcessorCount, "The index of the processor must be lower than the number of logical processors.");
+    Z_ASSERT_ERROR(uCacheLevel == 2U || uCacheLevel == 3U, "The level of the cache must be 2 or 3.");
+
+    ProcessorSet processors(uProcessor);
+    const u32_z CACHE = uCacheLevel == 2U ? arProcessors[uProcessor].m_uL2Cache : arProcessors[uProcessor].m_uL3Cache;
+
+    if(CACHE != SProcessorTopology::NO_CACHE)
+    {
+        for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+            if((uCacheLevel == 2U ? arProcessors[i].m_uL2Cache : arProcessors[i].m_uL3Cache) == CACHE)
+                processors.Add(i);
+    }
+
+    return processors;
+}
+
+ProcessorSet SProcessorTopology::GetPackageProcessors(const u32_z uPackage)
+{
+    const ProcessorInfo* arProcessors = SProcessorTopology::_GetProcessors();
+
+    ProcessorSet processors;
+
+    for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+        if(arProcessors[i].m_uPackage == uPackage)
+            processors.Add(i);
+
+    return processors;
+}
+
+ProcessorSet SProcessorTopology::GetNumaNodeProcessors(const u32_z uNumaNode)
+{
+    const ProcessorInfo* arProcessors = SProcessorTopology::_GetProcessors();
+
+    ProcessorSet processors;
+
+    for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+        if(arProcessors[i].m_uNumaNode == uNumaNode)
+            processors.Add(i);
+
+    return processors;
+}
+
+ProcessorSet SProcessorTopology::GetAllProcessors()
+{
+    SProcessorTopology::_GetProcessors();
+
+    ProcessorSet processors;
+
+    for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+        processors.Add(i);
+
+    return processors;
+}
+
+const SProcessorTopology::ProcessorInfo* SProcessorTopology::_GetProcessors()
+{
+    // The initialization of local static variables is thread-safe
+    static const bool TOPOLOGY_DISCOVERED = SProcessorTopology::_DiscoverTopology();
+    (void)TOPOLOGY_DISCOVERED; // Only the side effect of the initialization is needed
+
+    return sm_arProcessors;
+}
+
+#if defined(Z_OS_WINDOWS)
+
+bool SProcessorTopology::_DiscoverTopology()
+{
+    // Only the first processor group is used
+    static const WORD PROCESSOR_GROUP = 0;
+
+    sm_uProcessorCount = ::GetActiveProcessorCount(PROCESSOR_GROUP);
+    sm_uProcessorCount = sm_uProcessorCount == 0 ? 1U : sm_uProcessorCount;
+
+    for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+    {
+        sm_arProcessors[i].m_uCore = i;
+        sm_arProcessors[i].m_uPackage = 0;
+        sm_arProcessors[i].m_uNumaNode = 0;
+        sm_arProcessors[i].m_uL2Cache = SProcessorTopology::NO_CACHE;
+        sm_arProcessors[i].m_uL3Cache = SProcessorTopology::NO_CACHE;
+    }
+
+    DWORD uBufferLength = 0;
+    ::GetLogicalProcessorInformationEx(RelationAll, null_z, &uBufferLength);
+    char* pBuffer = new char[uBufferLength];
+
+    if(::GetLogicalProcessorInformationEx(RelationAll, rcast_z(pBuffer, PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX), &uBufferLength) != FALSE)
+    {
+        for(DWORD uOffset = 0; uOffset < uBufferLength; )
+        {
+            const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* pInfo = rcast_z(pBuffer + uOffset, const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*);
+            KAFFINITY uMask = 0;
+
+            switch(pInfo->Relationship)
+            {
+            case RelationProcessorCore:
+                uMask = pInfo->Processor.GroupMask[0].Group == PROCESSOR_GROUP ? pInfo->Processor.GroupMask[0].Mask : 0;
+
+                for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+                    if((uMask >> i) & 1U)
+                        sm_arProcessors[i].m_uCore = sm_uCoreCount;
+
+                sm_uCoreCount += uMask != 0 ? 1U : 0;
+                break;
+            case RelationProcessorPackage:
+                for(WORD uGroup = 0; uGroup < pInfo->Processor.GroupCount; ++uGroup)
+                    uMask |= pInfo->Processor.GroupMask[uGroup].Group == PROCESSOR_GROUP ? pInfo->Processor.GroupMask[uGroup].Mask : 0;
+
+                for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+                    if((uMask >> i) & 1U)
+                        sm_arProcessors[i].m_uPackage = sm_uPackageCount;
+
+                sm_uPackageCount += uMask != 0 ? 1U : 0;
+                break;
+            case RelationNumaNode:
+                uMask = pInfo->NumaNode.GroupMask.Group == PROCESSOR_GROUP ? pInfo->NumaNode.GroupMask.Mask : 0;
+
+                for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+                    if((uMask >> i) & 1U)
+                        sm_arProcessors[i].m_uNumaNode = pInfo->NumaNode.NodeNumber;
+
+                sm_uNumaNodeCount = pInfo->NumaNode.NodeNumber >= sm_uNumaNodeCount ? pInfo->NumaNode.NodeNumber + 1U : sm_uNumaNodeCount;
+                break;
+            case RelationCache:
+                if((pInfo->Cache.Level == 2U || pInfo->Cache.Level == 3U) && pInfo->Cache.Type != CacheInstruction)
+                {
+                    uMask = pInfo->Cache.GroupMask.Group == PROCESSOR_GROUP ? pInfo->Cache.GroupMask.Mask : 0;
+                    u32_z uCache = SProcessorTopology::NO_CACHE;
+
+                    for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+                    {
+                        if((uMask >> i) & 1U)
+                        {
+                            // The identifier of the cache is the index of its first processor
+                            uCache = uCache == SProcessorTopology::NO_CACHE ? i : uCache;
+
+                            if(pInfo->Cache.Level == 2U)
+                                sm_arProcessors[i].m_uL2Cache = uCache;
+                            else
+                                sm_arProcessors[i].m_uL3Cache = uCache;
+                        }
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+
+            uOffset += pInfo->Size;
+        }
+    }
+
+    delete[] pBuffer;
+
+    sm_uCoreCount = sm_uCoreCount == 0 ? sm_uProcessorCount : sm_uCoreCount;
+    sm_uPackageCount = sm_uPackageCount == 0 ? 1U : sm_uPackageCount;
+    sm_uNumaNodeCount = sm_uNumaNodeCount == 0 ? 1U : sm_uNumaNodeCount;
+
+    return true;
+}
+
+#elif defined(Z_OS_LINUX)
+
+bool SProcessorTopology::_DiscoverTopology()
+{
+    static const u32_z MAXIMUM_CACHE_INDICES = 16U;
+    static const u32_z PATH_LENGTH = 128U;
+
+    const long nConfiguredProcessors = ::sysconf(_SC_NPROCESSORS_CONF);
+    sm_uProcessorCount = nConfiguredProcessors < 1 ? 1U : 
+                                                     nConfiguredProcessors > scast_z(ProcessorSet::MAXIMUM_PROCESSORS, long) ? ProcessorSet::MAXIMUM_PROCESSORS : 
+                                                                                                                              scast_z(nConfiguredProcessors, u32_z);
+    // Package and core identifiers given by the system, which are not contiguous; the index of each element is the index used in this class
+    u32_z arSystemPackages[ProcessorSet::MAXIMUM_PROCESSORS];
+    u32_z arSystemCores[ProcessorSet::MAXIMUM_PROCESSORS];
+    u32_z arSystemCorePackages[ProcessorSet::MAXIMUM_PROCESSORS];
+    char szPath[PATH_LENGTH];
+
+    for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+    {
+        ProcessorInfo &processor = sm_arProcessors[i];
+
+        // Package
+        std::snprintf(szPath, PATH_LENGTH, "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", i);
+        const u32_z SYSTEM_PACKAGE = SProcessorTopology::_ReadNumber(szPath, 0);
+
+        processor.m_uPackage = 0;
+
+        while(processor.m_uPackage < sm_uPackageCount && arSystemPackages[processor.m_uPackage] != SYSTEM_PACKAGE)
+            ++processor.m_uPackage;
+
+        if(processor.m_uPackage == sm_uPackageCount)
+            arSystemPackages[sm_uPackageCount++] = SYSTEM_PACKAGE;
+
+        // Core (core identifiers are only unique inside the same package)
+        std::snprintf(szPath, PATH_LENGTH, "/sys/devices/system/cpu/cpu%u/topology/core_id", i);
+        const u32_z SYSTEM_CORE = SProcessorTopology::_ReadNumber(szPath, i);
+
+        processor.m_uCore = 0;
+
+        while(processor.m_uCore < sm_uCoreCount && (arSystemCores[processor.m_uCore] != SYSTEM_CORE || arSystemCorePackages[processor.m_uCore] != SYSTEM_PACKAGE))
+            ++processor.m_uCore;
+
+        if(processor.m_uCore == sm_uCoreCount)
+        {
+            arSystemCores[sm_uCoreCount] = SYSTEM_CORE;
+            arSystemCorePackages[sm_uCoreCount] = SYSTEM_PACKAGE;
+            ++sm_uCoreCount;
+        }
+
+        // Caches
+        processor.m_uL2Cache = SProcessorTopology::NO_CACHE;
+        processor.m_uL3Cache = SProcessorTopology::NO_CACHE;
+
+        bool bMoreCaches = true;
+
+        for(u32_z uIndex = 0; uIndex < MAXIMUM_CACHE_INDICES && bMoreCaches; ++uIndex)
+        {
+            std::snprintf(szPath, PATH_LENGTH, "/sys/devices/system/cpu/cpu%u/cache/index%u/level", i, uIndex);
+            const u32_z LEVEL = SProcessorTopology::_ReadNumber(szPath, 0);
+
+            // Instruction caches are ignored; Data caches at levels 2 and 3 do not exist in practice, they are unified
+            std::snprintf(szPath, PATH_LENGTH, "/sys/devices/system/cpu/cpu%u/cache/index%u/type", i, uIndex);
+            FILE* pTypeFile = std::fopen(szPath, "r");
+            const bool IS_INSTRUCTION_CACHE = pTypeFile != null_z && std::fgetc(pTypeFile) == 'I';
+
+            if(pTypeFile != null_z)
+                std::fclose(pTypeFile);
+
+            // Cache indices are consecutive, the first one that does not exist ends the list
+            bMoreCaches = LEVEL != 0;
+
+            if((LEVEL == 2U || LEVEL == 3U) && !IS_INSTRUCTION_CACHE)
+            {
+                std::snprintf(szPath, PATH_LENGTH, "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", i, uIndex);
+                ProcessorSet sharingProcessors;
+
+                // The identifier of the cache is the index of its first processor
+                const u32_z CACHE = SProcessorTopology::_ReadProcessorList(szPath, sharingProcessors) && !sharingProcessors.IsEmpty() ? sharingProcessors.GetNext(0) : 
+                                                                                                                                         i;
+                if(LEVEL == 2U)
+                    processor.m_uL2Cache = CACHE;
+                else
+                    processor.m_uL3Cache = CACHE;
+            }
+        }
+
+        processor.m_uNumaNode = 0;
+    }
+
+    // NUMA nodes
+    ProcessorSet nodes;
+
+    if(SProcessorTopology::_ReadProcessorList("/sys/devices/system/node/possible", nodes) && !nodes.IsEmpty())
+    {
+        for(u32_z uNode = nodes.GetNext(0); uNode != ProcessorSet::NO_PROCESSOR; uNode = nodes.GetNext(uNode + 1U))
+        {
+            std::snprintf(szPath, PATH_LENGTH, "/sys/devices/system/node/node%u/cpulist", uNode);
+            ProcessorSet nodeProcessors;
+            SProcessorTopology::_ReadProcessorList(szPath, nodeProcessors);
+
+            for(u32_z i = nodeProcessors.GetNext(0); i != ProcessorSet::NO_PROCESSOR && i < sm_uProcessorCount; i = nodeProcessors.GetNext(i + 1U))
+                sm_arProcessors[i].m_uNumaNode = uNode;
+
+            sm_uNumaNodeCount = uNode + 1U;
+        }
+    }
+    else
+    {
+        sm_uNumaNodeCount = 1U;
+    }
+
+    return true;
+}
+
+u32_z SProcessorTopology::_ReadNumber(const char* szPath, const u32_z uDefaultValue)
+{
+    u32_z uResult = uDefaultValue;
+    FILE* pFile = std::fopen(szPath, "r");
+
+    if(pFile != null_z)
+    {
+        // Negative values (like -1, used for unknown packages) are not valid
+        long nValue = -1;
+
+        if(std::fscanf(pFile, "%ld", &nValue) == 1 && nValue >= 0)
+            uResult = scast_z(nValue, u32_z);
+
+        std::fclose(pFile);
+    }
+
+    return uResult;
+}
+
+bool SProcessorTopology::_ReadProcessorList(const char* szPath, ProcessorSet &processors)
+{
+    FILE* pFile = std::fopen(szPath, "r");
+
+    if(pFile != null_z)
+    {
+        unsigned int uFirst = 0;
+        unsigned int uLast = 0;
+        int nSeparator = 0;
+        bool bMoreElements = true;
+
+        // Every element of the list is either a number or a range "first-last", followed by a comma or the end of the line
+        while(bMoreElements && std::fscanf(pFile, "%u", &uFirst) == 1)
+        {
+            uLast = uFirst;
+            nSeparator = std::fgetc(pFile);
+
+            if(nSeparator == '-')
+            {
+                if(std::fscanf(pFile, "%u", &uLast) != 1)
+                    uLast = uFirst;
+
+                nSeparator = std::fgetc(pFile);
+            }
+
+            for(u32_z i = uFirst; i <= uLast && i < ProcessorSet::MAXIMUM_PROCESSORS; ++i)
+                processors.Add(i);
+
+            bMoreElements = nSeparator == ',';
+        }
+
+        std::fclose(pFile);
+    }
+
+    return pFile != null_z;
+}
+
+#elif defined(Z_OS_MAC)
+
+bool SProcessorTopology::_DiscoverTopology()
+{
+    int nLogicalProcessors = 1;
+    int nPhysicalCores = 1;
+    size_t uValueSize = sizeof(int);
+    ::sysctlbyname("hw.logicalcpu", &nLogicalProcessors, &uValueSize, null_z, 0);
+    uValueSize = sizeof(int);
+    ::sysctlbyname("hw.physicalcpu", &nPhysicalCores, &uValueSize, null_z, 0);
+
+    sm_uProcessorCount = nLogicalProcessors < 1 ? 1U : 
+                                                  nLogicalProcessors > scast_z(ProcessorSet::MAXIMUM_PROCESSORS, int) ? ProcessorSet::MAXIMUM_PROCESSORS : 
+                                                                                                                        scast_z(nLogicalProcessors, u32_z);
+    sm_uCoreCount = nPhysicalCores < 1 || scast_z(nPhysicalCores, u32_z) > sm_uProcessorCount ? sm_uProcessorCount : 
+                                                                                               scast_z(nPhysicalCores, u32_z);
+    sm_uPackageCount = 1U;
+    sm_uNumaNodeCount = 1U;
+
+    // Sibling logical processors are assumed to be contiguous
+    for(u32_z i = 0; i < sm_uProcessorCount; ++i)
+    {
+        sm_arProcessors[i].m_uCore = i * sm_uCoreCount / sm_uProcessorCount;
+        sm_arProcessors[i].m_uPackage = 0;
+        sm_arProcessors[i].m_uNumaNode = 0;
+        sm_arProcessors[i].m_uL2Cache = 0;
+        sm_arProcessors[i].m_uL3Cache = 0;
+    }
+
+    return true;
+}
+
+#endif
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_z SProcessorTopology::GetLogicalProcessorCount()
+{
+    SProcessorTopology::_GetProcessors();
+    return sm_uProcessorCount;
+}
+
+u32_z SProcessorTopology::GetCoreCount()
+{
+    SProcessorTopology::_GetProcessors();
+    return sm_uCoreCount;
+}
+
+u32_z SProcessorTopology::GetPackageCount()
+{
+    SProcessorTopology::_GetProcessors();
+    return sm_uPackageCount;
+}
+
+u32_z SProcessorTopology::GetNumaNodeCount()
+{
+    SProcessorTopology::_GetProcessors();
+    return sm_uNumaNodeCount;
+}
+
+} // namespace z
@@ -33,6 +33,11 @@
     #include <Windows.h>
 #elif defined(Z_OS_LINUX) || defined(Z_OS_MAC)
     #include <pthread.h>
+    #include <sched.h>
+#endif
+
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    #include <emmintrin.h>
 #endif
 
 
@@ -40,6 +45,17 @@
 namespace z
 {
 
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+boost::thread_specific_ptr<ScratchAllocator> SThisThread::sm_pScratchAllocator;
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
@@ -55,6 +71,15 @@ void SThisThread::Yield()
     boost::this_thread::yield();
 }
 
+void SThisThread::Pause()
+{
+#if defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__)
+    _mm_pause();
+#elif defined(Z_COMPILER_GCC) && (defined(__aarch64__) || defined(__arm__))
+    __asm__ __volatile__("yield");
+#endif
+}
+
 void SThisThread::Sleep(const TimeSpan &duration)
 {
     boost::this_thread::sleep_for(boost::chrono::milliseconds(duration.GetMilliseconds()));
@@ -373,4 +398,52 @@ void SThisThread::SetPriority(const EThreadPriority &ePriority)
 
 #endif
 
+ProcessorSet SThisThread::GetAffinity()
+{
+    return Thread::_GetAffinity(SThisThread::GetNativeHandle());
+}
+
+bool SThisThread::SetAffinity(const ProcessorSet &processors)
+{
+    return Thread::_SetAffinity(SThisThread::GetNativeHandle(), processors);
+}
+
+#if defined(Z_OS_WINDOWS)
+
+u32_z SThisThread::GetCurrentProcessor()
+{
+    return ::GetCurrentProcessorNumber();
+}
+
+#elif defined(Z_OS_LINUX)
+
+u32_z SThisThread::GetCurrentProcessor()
+{
+    const int nProcessor = sched_getcpu();
+    return nProcessor < 0 ? 0 : scast_z(nProcessor, u32_z);
+}
+
+#elif defined(Z_OS_MAC)
+
+u32_z SThisThread::GetCurrentProcessor()
+{
+    // There is no public function to know the current processor
+    return 0;
+}
+
+#endif
+
+ScratchAllocator& SThisThread::GetScratchAllocator()
+{
+    ScratchAllocator* pScratchAllocator = sm_pScratchAllocator.get();
+
+    if(pScratchAllocator == null_z)
+    {
+        pScratchAllocator = new ScratchAllocator(ScratchAllocator::DEFAULT_SIZE);
+        sm_pScratchAllocator.reset(pScratchAllocator);
+    }
+
+    return *pScratchAllocator;
+}
+
 } // namespace z
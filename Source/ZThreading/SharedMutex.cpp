@@ -26,10 +26,67 @@
 
 #include "ZThreading/SharedMutex.h"
 
+#include "ZThreading/SFutex.h"
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/SProcessorTopology.h"
+#include "ZCommon/Alignment.h"
+#include "ZCommon/AllocationOperators.h"
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    #include "ZThreading/SLockStatistics.h"
+    #include "ZThreading/SMonotonicClock.h"
+#endif
+
 
 namespace z
 {
 
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+SharedMutex::FutexSharedMutex::FutexSharedMutex() : m_arReaderCounters(null_z),
+                                                    m_uReaderCounterMask(0),
+                                                    m_uWriterState(0),
+                                                    m_uReaderExitSequence(0)
+{
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    m_uLockIndex = SLockStatistics::UNTRACKED_LOCK;
+    m_uAcquisitionInstant = 0;
+#endif
+
+    this->_CreateReaderCounters();
+}
+
+SharedMutex::FutexSharedMutex::FutexSharedMutex(const char* szName) : m_arReaderCounters(null_z),
+                                                                      m_uReaderCounterMask(0),
+                                                                      m_uWriterState(0),
+                                                                      m_uReaderExitSequence(0)
+{
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    m_uLockIndex = SLockStatistics::_RegisterLock(szName);
+    m_uAcquisitionInstant = 0;
+#else
+    (void)szName;
+#endif
+
+    this->_CreateReaderCounters();
+}
+
+SharedMutex::SharedMutex() : m_sharedMutex("SharedMutex")
+{
+}
+
+SharedMutex::SharedMutex(const char* szName) : m_sharedMutex(szName)
+{
+}
+
+
 //##################=======================================================##################
 //##################             ____________________________              ##################
 //##################            |                            |             ##################
@@ -39,6 +96,16 @@ namespace z
 //##################                                                       ##################
 //##################=======================================================##################
 
+SharedMutex::FutexSharedMutex::~FutexSharedMutex()
+{
+    typedef boost::atomic<u32_z> AtomicCounter;
+
+    for(u32_z i = 0; i <= m_uReaderCounterMask; ++i)
+        m_arReaderCounters[i].m_uCount.~AtomicCounter();
+
+    operator delete(m_arReaderCounters, Alignment(Z_CACHE_LINE_SIZE));
+}
+
 SharedMutex::~SharedMutex()
 {
 }
@@ -53,6 +120,220 @@ SharedMutex::~SharedMutex()
 //##################                                                       ##################
 //##################=======================================================##################
 
+void SharedMutex::FutexSharedMutex::lock()
+{
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    // The acquisition is contended if there is another writer or there are readers
+    u64_z uWaitStartInstant = 0;
+    bool bIsContended = !m_writerMutex.try_lock();
+
+    if(bIsContended)
+    {
+        uWaitStartInstant = SMonotonicClock::GetNanoseconds();
+        m_writerMutex.lock();
+    }
+#else
+    m_writerMutex.lock();
+#endif
+
+    // From now on, new readers will not own the mutex
+    m_uWriterState.store(1U, boost::memory_order_seq_cst);
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    if(!bIsContended && this->_GetReaderCount() != 0)
+    {
+        bIsContended = true;
+        uWaitStartInstant = SMonotonicClock::GetNanoseconds();
+    }
+#endif
+
+    this->_WaitForReaders();
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    this->_RecordExclusiveAcquisition(bIsContended, uWaitStartInstant);
+#endif
+}
+
+void SharedMutex::FutexSharedMutex::unlock()
+{
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    if(m_uLockIndex != SLockStatistics::UNTRACKED_LOCK)
+        SLockStatistics::_RecordHold(m_uLockIndex, SMonotonicClock::GetNanoseconds() - m_uAcquisitionInstant);
+#endif
+
+    if(m_uWriterState.exchange(0, boost::memory_order_seq_cst) == 2U)
+        SFutex::WakeAll(m_uWriterState);
+
+    m_writerMutex.unlock();
+}
+
+bool SharedMutex::FutexSharedMutex::try_lock()
+{
+    bool bLocked = m_writerMutex.try_lock();
+
+    if(bLocked)
+    {
+        m_uWriterState.store(1U, boost::memory_order_seq_cst);
+
+        if(this->_GetReaderCount() != 0)
+        {
+            // It is released without recording the hold
+            if(m_uWriterState.exchange(0, boost::memory_order_seq_cst) == 2U)
+                SFutex::WakeAll(m_uWriterState);
+
+            m_writerMutex.unlock();
+            bLocked = false;
+        }
+    }
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    if(bLocked)
+        this->_RecordExclusiveAcquisition(false, 0);
+#endif
+
+    return bLocked;
+}
+
+void SharedMutex::FutexSharedMutex::lock_shared()
+{
+    bool bLocked = false;
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    bool bIsContended = false;
+    u64_z uWaitStartInstant = 0;
+#endif
+
+    while(!bLocked)
+    {
+        ReaderCounter &counter = this->_GetReaderCounter();
+
+        // Both the counter and the writer state are sequentially consistent so either the reader sees the writer or the writer sees the reader
+        counter.m_uCount.fetch_add(1U, boost::memory_order_seq_cst);
+        bLocked = m_uWriterState.load(boost::memory_order_seq_cst) == 0;
+
+        if(!bLocked)
+        {
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+            if(!bIsContended)
+            {
+                bIsContended = true;
+                uWaitStartInstant = SMonotonicClock::GetNanoseconds();
+            }
+#endif
+
+            this->_RemoveReader(counter);
+            this->_WaitForWriter();
+        }
+    }
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    // Readers share the mutex, so they do not store the acquisition instant and hold times are not measured
+    if(m_uLockIndex != SLockStatistics::UNTRACKED_LOCK)
+        SLockStatistics::_RecordAcquisition(m_uLockIndex, bIsContended, bIsContended ? SMonotonicClock::GetNanoseconds() - uWaitStartInstant : 0);
+#endif
+}
+
+void SharedMutex::FutexSharedMutex::unlock_shared()
+{
+    // The thread may be running on a different processor now, it does not matter which counter is decremented
+    this->_RemoveReader(this->_GetReaderCounter());
+}
+
+bool SharedMutex::FutexSharedMutex::try_lock_shared()
+{
+    ReaderCounter &counter = this->_GetReaderCounter();
+
+    counter.m_uCount.fetch_add(1U, boost::memory_order_seq_cst);
+    const bool LOCKED = m_uWriterState.load(boost::memory_order_seq_cst) == 0;
+
+    if(!LOCKED)
+        this->_RemoveReader(counter);
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+    if(LOCKED && m_uLockIndex != SLockStatistics::UNTRACKED_LOCK)
+        SLockStatistics::_RecordAcquisition(m_uLockIndex, false, 0);
+#endif
+
+    return LOCKED;
+}
+
+void SharedMutex::FutexSharedMutex::_RemoveReader(ReaderCounter &counter)
+{
+    counter.m_uCount.fetch_sub(1U, boost::memory_order_seq_cst);
+
+    if(m_uWriterState.load(boost::memory_order_seq_cst) != 0)
+    {
+        // Only one writer can be waiting for readers at a time
+        m_uReaderExitSequence.fetch_add(1U, boost::memory_order_seq_cst);
+        SFutex::WakeOne(m_uReaderExitSequence);
+    }
+}
+
+void SharedMutex::FutexSharedMutex::_WaitForWriter()
+{
+    const u32_z SPIN_COUNT = SFutex::GetSpinCount();
+
+    for(u32_z i = 0; i < SPIN_COUNT && m_uWriterState.load(boost::memory_order_relaxed) != 0; ++i)
+        SThisThread::Pause();
+
+    u32_z uState = m_uWriterState.load(boost::memory_order_acquire);
+
+    while(uState != 0)
+    {
+        // The state is set to 2 so the writer knows it has to wake up sleeping readers when it unlocks the mutex
+        if(uState == 2U || m_uWriterState.compare_exchange_weak(uState, 2U, boost::memory_order_acquire, boost::memory_order_acquire))
+        {
+            SFutex::Wait(m_uWriterState, 2U);
+            uState = m_uWriterState.load(boost::memory_order_acquire);
+        }
+    }
+}
+
+void SharedMutex::FutexSharedMutex::_WaitForReaders()
+{
+    const u32_z SPIN_COUNT = SFutex::GetSpinCount();
+
+    for(u32_z i = 0; i < SPIN_COUNT && this->_GetReaderCount() != 0; ++i)
+        SThisThread::Pause();
+
+    // The sequence is read before the counters so a reader that leaves afterwards changes it and the wait does not sleep
+    u32_z uSequence = m_uReaderExitSequence.load(boost::memory_order_seq_cst);
+
+    while(this->_GetReaderCount() != 0)
+    {
+        SFutex::Wait(m_uReaderExitSequence, uSequence);
+        uSequence = m_uReaderExitSequence.load(boost::memory_order_seq_cst);
+    }
+}
+
+void SharedMutex::FutexSharedMutex::_CreateReaderCounters()
+{
+    const u32_z PROCESSOR_COUNT = SProcessorTopology::GetLogicalProcessorCount();
+    u32_z uCounterCount = 1U;
+
+    while(uCounterCount < PROCESSOR_COUNT && uCounterCount < FutexSharedMutex::MAXIMUM_READER_COUNTERS)
+        uCounterCount <<= 1U;
+
+    m_uReaderCounterMask = uCounterCount - 1U;
+    m_arReaderCounters = scast_z(operator new(uCounterCount * sizeof(ReaderCounter), Alignment(Z_CACHE_LINE_SIZE)), ReaderCounter*);
+
+    for(u32_z i = 0; i < uCounterCount; ++i)
+        new(&m_arReaderCounters[i].m_uCount) boost::atomic<u32_z>(0);
+}
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+
+void SharedMutex::FutexSharedMutex::_RecordExclusiveAcquisition(const bool bIsContended, const u64_z uWaitStartInstant)
+{
+    if(m_uLockIndex != SLockStatistics::UNTRACKED_LOCK)
+    {
+        m_uAcquisitionInstant = SMonotonicClock::GetNanoseconds();
+        SLockStatistics::_RecordAcquisition(m_uLockIndex, bIsContended, bIsContended ? m_uAcquisitionInstant - uWaitStartInstant : 0);
+    }
+}
+
+#endif
+
 void SharedMutex::Lock()
 {
     m_sharedMutex.lock();
@@ -93,12 +374,29 @@ bool SharedMutex::TryLockShared()
 //##################                                                       ##################
 //##################=======================================================##################
 
-boost::shared_mutex& SharedMutex::GetWrappedObject()
+SharedMutex::ReaderCounter& SharedMutex::FutexSharedMutex::_GetReaderCounter()
+{
+    return m_uReaderCounterMask == 0 ? m_arReaderCounters[0] :
+                                       m_arReaderCounters[SThisThread::GetCurrentProcessor() & m_uReaderCounterMask];
+}
+
+u32_z SharedMutex::FutexSharedMutex::_GetReaderCount() const
+{
+    u32_z uCount = 0;
+
+    // Counters may overflow individually but the sum is always correct
+    for(u32_z i = 0; i <= m_uReaderCounterMask; ++i)
+        uCount += m_arReaderCounters[i].m_uCount.load(boost::memory_order_seq_cst);
+
+    return uCount;
+}
+
+SharedMutex::WrappedType& SharedMutex::GetWrappedObject()
 {
     return m_sharedMutex;
 }
 
-const boost::shared_mutex& SharedMutex::GetWrappedObject() const
+const SharedMutex::WrappedType& SharedMutex::GetWrappedObject() const
 {
     return m_sharedMutex;
 }
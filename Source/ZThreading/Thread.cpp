@@ -27,6 +27,7 @@
 #include "ZThreading/Thread.h"
 
 #include "ZThreading/SThisThread.h"
+#include "ZThreading/SProcessorTopology.h"
 
 #if defined(Z_OS_WINDOWS)
     #include <Windows.h>
@@ -308,6 +309,97 @@ int Thread::_ConvertToNativePriority(const EThreadPriority &ePriority)
 
 #endif
 
+#if defined(Z_OS_WINDOWS)
+
+ProcessorSet Thread::_GetAffinity(const Thread::NativeThreadHandle &handle)
+{
+    // Only the first processor group is used
+    static const u32_z PROCESSORS_PER_MASK = sizeof(DWORD_PTR) * 8U;
+
+    // There is no function to get the affinity of a thread, so it is replaced with the affinity of the process and then restored
+    DWORD_PTR uProcessMask = 0;
+    DWORD_PTR uSystemMask = 0;
+    ::GetProcessAffinityMask(::GetCurrentProcess(), &uProcessMask, &uSystemMask);
+    DWORD_PTR uThreadMask = ::SetThreadAffinityMask(handle, uProcessMask);
+
+    if(uThreadMask != 0)
+        ::SetThreadAffinityMask(handle, uThreadMask);
+
+    ProcessorSet processors;
+
+    for(u32_z i = 0; i < PROCESSORS_PER_MASK; ++i)
+        if((uThreadMask >> i) & 1U)
+            processors.Add(i);
+
+    return processors;
+}
+
+bool Thread::_SetAffinity(const Thread::NativeThreadHandle &handle, const ProcessorSet &processors)
+{
+    Z_ASSERT_ERROR(!processors.IsEmpty(), "The set of processors cannot be empty.");
+
+    // Only the first processor group is used
+    static const u32_z PROCESSORS_PER_MASK = sizeof(DWORD_PTR) * 8U;
+
+    DWORD_PTR uMask = 0;
+
+    for(u32_z i = processors.GetNext(0); i != ProcessorSet::NO_PROCESSOR && i < PROCESSORS_PER_MASK; i = processors.GetNext(i + 1U))
+        uMask |= scast_z(1U, DWORD_PTR) << i;
+
+    return uMask != 0 && ::SetThreadAffinityMask(handle, uMask) != 0;
+}
+
+#elif defined(Z_OS_LINUX)
+
+ProcessorSet Thread::_GetAffinity(const Thread::NativeThreadHandle &handle)
+{
+    cpu_set_t nativeSet;
+    CPU_ZERO(&nativeSet);
+
+    int nResult = pthread_getaffinity_np(handle, sizeof(cpu_set_t), &nativeSet);
+
+    Z_ASSERT_WARNING(nResult == 0, string_z("An unexpected error ocurred when attempting to get the affinity of a thread. The error code is:") + string_z::FromInteger(nResult) + ".");
+
+    ProcessorSet processors;
+
+    for(u32_z i = 0; i < ProcessorSet::MAXIMUM_PROCESSORS && i < CPU_SETSIZE; ++i)
+        if(CPU_ISSET(i, &nativeSet))
+            processors.Add(i);
+
+    return processors;
+}
+
+bool Thread::_SetAffinity(const Thread::NativeThreadHandle &handle, const ProcessorSet &processors)
+{
+    Z_ASSERT_ERROR(!processors.IsEmpty(), "The set of processors cannot be empty.");
+
+    cpu_set_t nativeSet;
+    CPU_ZERO(&nativeSet);
+
+    for(u32_z i = processors.GetNext(0); i != ProcessorSet::NO_PROCESSOR && i < CPU_SETSIZE; i = processors.GetNext(i + 1U))
+        CPU_SET(i, &nativeSet);
+
+    return CPU_COUNT(&nativeSet) > 0 && pthread_setaffinity_np(handle, sizeof(cpu_set_t), &nativeSet) == 0;
+}
+
+#elif defined(Z_OS_MAC)
+
+ProcessorSet Thread::_GetAffinity(const Thread::NativeThreadHandle &handle)
+{
+    // Thread affinity is not supported, threads can run on any processor
+    return SProcessorTopology::GetAllProcessors();
+}
+
+bool Thread::_SetAffinity(const Thread::NativeThreadHandle &handle, const ProcessorSet &processors)
+{
+    Z_ASSERT_ERROR(!processors.IsEmpty(), "The set of processors cannot be empty.");
+
+    // Thread affinity is not supported (thread_policy_set with THREAD_AFFINITY_POLICY is only a hint for sharing caches, ignored on most systems)
+    return false;
+}
+
+#endif
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
@@ -428,5 +520,19 @@ void Thread::SetPriority(const EThreadPriority &ePriority)
 
 #endif
 
+ProcessorSet Thread::GetAffinity() const
+{
+    Z_ASSERT_ERROR(this->IsAlive(), "It is not possible to get the affinity of a not-running thread.");
+
+    return Thread::_GetAffinity(this->GetNativeHandle());
+}
+
+bool Thread::SetAffinity(const ProcessorSet &processors)
+{
+    Z_ASSERT_ERROR(this->IsAlive(), "It is not possible to set the affinity of a not-running thread.");
+
+    return Thread::_SetAffinity(this->GetNativeHandle(), processors);
+}
+
 
 } // namespace z
@@ -0,0 +1,431 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZTime/STimeBatch.h"
+
+#include "ZCommon/Assertions.h"
+#include "ZCommon/DataTypes/StringsDefinitions.h"
+#include "ZTime/DateTime.h"
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+
+    #include <immintrin.h>
+
+    #if defined(Z_COMPILER_MSVC)
+        #include <intrin.h>
+
+        // MSVC does not need any special option to generate AVX2 instructions
+        #define Z_TIME_AVX2_FUNCTION
+    #elif defined(Z_COMPILER_GCC)
+        #include <cpuid.h>
+
+        // Only these functions are compiled for AVX2, the rest of the library can run on any x86 CPU
+        #define Z_TIME_AVX2_FUNCTION __attribute__((target("avx2")))
+    #endif
+
+#endif
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void STimeBatch::Add(const u64_z* arInstants, const puint_z uCount, const TimeSpan &timeSpan, u64_z* arResults)
+{
+    Z_ASSERT_ERROR(uCount == 0 || (arInstants != null_z && arResults != null_z), "The input and output arrays cannot be null.");
+
+    static const u64_z MAXIMUM_TIME_SPAN = -1;
+
+    const u64_z TIME_SPAN = timeSpan.GetHundredsOfNanoseconds();
+    puint_z uFirst = 0;
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+    if(STimeBatch::IsVectorized())
+        uFirst = STimeBatch::_AddAvx2(arInstants, uCount, TIME_SPAN, arResults);
+#endif
+
+    for(puint_z i = uFirst; i < uCount; ++i)
+        arResults[i] = MAXIMUM_TIME_SPAN - arInstants[i] < TIME_SPAN ? MAXIMUM_TIME_SPAN : 
+                                                                       arInstants[i] + TIME_SPAN;
+}
+
+void STimeBatch::Subtract(const u64_z* arInstants, const puint_z uCount, const TimeSpan &timeSpan, u64_z* arResults)
+{
+    Z_ASSERT_ERROR(uCount == 0 || (arInstants != null_z && arResults != null_z), "The input and output arrays cannot be null.");
+
+    const u64_z TIME_SPAN = timeSpan.GetHundredsOfNanoseconds();
+    puint_z uFirst = 0;
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+    if(STimeBatch::IsVectorized())
+        uFirst = STimeBatch::_SubtractAvx2(arInstants, uCount, TIME_SPAN, arResults);
+#endif
+
+    for(puint_z i = uFirst; i < uCount; ++i)
+        arResults[i] = arInstants[i] < TIME_SPAN ? 0 : 
+                                                   arInstants[i] - TIME_SPAN;
+}
+
+void STimeBatch::Difference(const u64_z* arInstantsA, const u64_z* arInstantsB, const puint_z uCount, u64_z* arDifferences)
+{
+    Z_ASSERT_ERROR(uCount == 0 || (arInstantsA != null_z && arInstantsB != null_z && arDifferences != null_z), "The input and output arrays cannot be null.");
+
+    puint_z uFirst = 0;
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+    if(STimeBatch::IsVectorized())
+        uFirst = STimeBatch::_DifferenceAvx2(arInstantsA, arInstantsB, uCount, arDifferences);
+#endif
+
+    for(puint_z i = uFirst; i < uCount; ++i)
+        arDifferences[i] = arInstantsA[i] < arInstantsB[i] ? arInstantsB[i] - arInstantsA[i] : 
+                                                             arInstantsA[i] - arInstantsB[i];
+}
+
+void STimeBatch::Bin(const u64_z* arInstants, const puint_z uCount, const u64_z uOrigin, const TimeSpan &windowLength, u64_z* arWindowIndices)
+{
+    Z_ASSERT_ERROR(uCount == 0 || (arInstants != null_z && arWindowIndices != null_z), "The input and output arrays cannot be null.");
+    Z_ASSERT_ERROR(windowLength > TimeSpan(), "The length of the windows must be greater than zero.");
+
+    static const u64_z MAXIMUM_EXACT_DOUBLE = 1ULL << 52U;
+
+    const u64_z WINDOW_LENGTH = windowLength.GetHundredsOfNanoseconds();
+    puint_z uFirst = 0;
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+    if(STimeBatch::IsVectorized() && WINDOW_LENGTH < MAXIMUM_EXACT_DOUBLE)
+        uFirst = STimeBatch::_BinAvx2(arInstants, uCount, uOrigin, WINDOW_LENGTH, arWindowIndices);
+#endif
+
+    for(puint_z i = uFirst; i < uCount; ++i)
+        arWindowIndices[i] = arInstants[i] < uOrigin ? 0 : 
+                                                       (arInstants[i] - uOrigin) / WINDOW_LENGTH;
+}
+
+u64_z STimeBatch::GetMinimum(const u64_z* arInstants, const puint_z uCount)
+{
+    Z_ASSERT_ERROR(arInstants != null_z, "The input array cannot be null.");
+    Z_ASSERT_ERROR(uCount > 0, "The input array cannot be empty.");
+
+    static const u64_z MAXIMUM_TIME_SPAN = -1;
+
+    u64_z uMinimum = MAXIMUM_TIME_SPAN;
+    puint_z uFirst = 0;
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+    if(STimeBatch::IsVectorized())
+        uFirst = STimeBatch::_GetMinimumAvx2(arInstants, uCount, uMinimum);
+#endif
+
+    for(puint_z i = uFirst; i < uCount; ++i)
+        uMinimum = arInstants[i] < uMinimum ? arInstants[i] : uMinimum;
+
+    return uMinimum;
+}
+
+u64_z STimeBatch::GetMaximum(const u64_z* arInstants, const puint_z uCount)
+{
+    Z_ASSERT_ERROR(arInstants != null_z, "The input array cannot be null.");
+    Z_ASSERT_ERROR(uCount > 0, "The input array cannot be empty.");
+
+    u64_z uMaximum = 0;
+    puint_z uFirst = 0;
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+    if(STimeBatch::IsVectorized())
+        uFirst = STimeBatch::_GetMaximumAvx2(arInstants, uCount, uMaximum);
+#endif
+
+    for(puint_z i = uFirst; i < uCount; ++i)
+        uMaximum = arInstants[i] > uMaximum ? arInstants[i] : uMaximum;
+
+    return uMaximum;
+}
+
+void STimeBatch::GetInstants(const DateTime* arDateTimes, const puint_z uCount, u64_z* arInstants)
+{
+    Z_ASSERT_ERROR(uCount == 0 || (arDateTimes != null_z && arInstants != null_z), "The input and output arrays cannot be null.");
+
+    for(puint_z i = 0; i < uCount; ++i)
+        arInstants[i] = arDateTimes[i].m_instant.GetHundredsOfNanoseconds();
+}
+
+void STimeBatch::SetInstants(const u64_z* arInstants, const puint_z uCount, DateTime* arDateTimes)
+{
+    Z_ASSERT_ERROR(uCount == 0 || (arInstants != null_z && arDateTimes != null_z), "The input and output arrays cannot be null.");
+
+    for(puint_z i = 0; i < uCount; ++i)
+        arDateTimes[i].m_instant = TimeSpan(arInstants[i]);
+}
+
+bool STimeBatch::_IsAvx2SupportedByProcessor()
+{
+    bool bIsSupported = false;
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+
+    static const unsigned int FEATURES_LEAF = 1U;
+    static const unsigned int EXTENDED_FEATURES_LEAF = 7U;
+    static const unsigned int OSXSAVE_BIT = 1U << 27U;
+    static const unsigned int AVX_BIT = 1U << 28U;
+    static const unsigned int AVX2_BIT = 1U << 5U;
+    static const u64_z XMM_YMM_STATE_MASK = 6ULL;
+
+    // Registers EAX, EBX, ECX and EDX
+    unsigned int arRegisters[4] = {0, 0, 0, 0};
+
+    #if defined(Z_COMPILER_MSVC)
+        __cpuid(rcast_z(arRegisters, int*), 0);
+    #elif defined(Z_COMPILER_GCC)
+        __get_cpuid(0, &arRegisters[0], &arRegisters[1], &arRegisters[2], &arRegisters[3]);
+    #endif
+
+    const unsigned int MAX_LEAF = arRegisters[0];
+
+    if(MAX_LEAF >= EXTENDED_FEATURES_LEAF)
+    {
+    #if defined(Z_COMPILER_MSVC)
+        __cpuid(rcast_z(arRegisters, int*), FEATURES_LEAF);
+    #elif defined(Z_COMPILER_GCC)
+        __get_cpuid(FEATURES_LEAF, &arRegisters[0], &arRegisters[1], &arRegisters[2], &arRegisters[3]);
+    #endif
+
+        // The operating system must save the state of the YMM registers when switching threads
+        const bool bHasAvx = (arRegisters[2] & OSXSAVE_BIT) != 0 && (arRegisters[2] & AVX_BIT) != 0;
+        u64_z uEnabledStates = 0;
+
+        if(bHasAvx)
+        {
+    #if defined(Z_COMPILER_MSVC)
+            uEnabledStates = _xgetbv(0);
+    #elif defined(Z_COMPILER_GCC)
+            unsigned int uLowPart = 0;
+            unsigned int uHighPart = 0;
+            __asm__ __volatile__("xgetbv" : "=a"(uLowPart), "=d"(uHighPart) : "c"(0));
+            uEnabledStates = (scast_z(uHighPart, u64_z) << 32U) | uLowPart;
+    #endif
+        }
+
+    #if defined(Z_COMPILER_MSVC)
+        __cpuidex(rcast_z(arRegisters, int*), EXTENDED_FEATURES_LEAF, 0);
+    #elif defined(Z_COMPILER_GCC)
+        __cpuid_count(EXTENDED_FEATURES_LEAF, 0, arRegisters[0], arRegisters[1], arRegisters[2], arRegisters[3]);
+    #endif
+
+        bIsSupported = bHasAvx && 
+                       (uEnabledStates & XMM_YMM_STATE_MASK) == XMM_YMM_STATE_MASK && 
+                       (arRegisters[1] & AVX2_BIT) != 0;
+    }
+
+#endif
+
+    return bIsSupported;
+}
+
+#if defined(Z_TIME_AVX2_SUPPORTED)
+
+// AVX2 only compares signed 64-bits integers; flipping the sign bit of both operands turns it into an unsigned comparison
+#define Z_TIME_AVX2_UNSIGNED_GREATER(a, b) _mm256_cmpgt_epi64(_mm256_xor_si256(a, SIGN_BIT), _mm256_xor_si256(b, SIGN_BIT))
+
+Z_TIME_AVX2_FUNCTION puint_z STimeBatch::_AddAvx2(const u64_z* arInstants, const puint_z uCount, const u64_z uTimeSpan, u64_z* arResults)
+{
+    const __m256i SIGN_BIT = _mm256_set1_epi64x(0x8000000000000000LL);
+    const __m256i TIME_SPAN = _mm256_set1_epi64x(scast_z(uTimeSpan, i64_z));
+    const puint_z VECTORIZED_COUNT = uCount & ~scast_z(3U, puint_z);
+
+    for(puint_z i = 0; i < VECTORIZED_COUNT; i += 4U)
+    {
+        const __m256i INSTANTS = _mm256_loadu_si256(rcast_z(arInstants + i, const __m256i*));
+        const __m256i SUM = _mm256_add_epi64(INSTANTS, TIME_SPAN);
+
+        // If the addition overflowed, the sum is lower than the instant and the result is saturated (all bits set)
+        const __m256i OVERFLOWED = Z_TIME_AVX2_UNSIGNED_GREATER(INSTANTS, SUM);
+        _mm256_storeu_si256(rcast_z(arResults + i, __m256i*), _mm256_or_si256(SUM, OVERFLOWED));
+    }
+
+    return VECTORIZED_COUNT;
+}
+
+Z_TIME_AVX2_FUNCTION puint_z STimeBatch::_SubtractAvx2(const u64_z* arInstants, const puint_z uCount, const u64_z uTimeSpan, u64_z* arResults)
+{
+    const __m256i SIGN_BIT = _mm256_set1_epi64x(0x8000000000000000LL);
+    const __m256i TIME_SPAN = _mm256_set1_epi64x(scast_z(uTimeSpan, i64_z));
+    const puint_z VECTORIZED_COUNT = uCount & ~scast_z(3U, puint_z);
+
+    for(puint_z i = 0; i < VECTORIZED_COUNT; i += 4U)
+    {
+        const __m256i INSTANTS = _mm256_loadu_si256(rcast_z(arInstants + i, const __m256i*));
+        const __m256i DIFFERENCE = _mm256_sub_epi64(INSTANTS, TIME_SPAN);
+
+        // Results lower than zero are cleared
+        const __m256i UNDERFLOWED = Z_TIME_AVX2_UNSIGNED_GREATER(TIME_SPAN, INSTANTS);
+        _mm256_storeu_si256(rcast_z(arResults + i, __m256i*), _mm256_andnot_si256(UNDERFLOWED, DIFFERENCE));
+    }
+
+    return VECTORIZED_COUNT;
+}
+
+Z_TIME_AVX2_FUNCTION puint_z STimeBatch::_DifferenceAvx2(const u64_z* arInstantsA, const u64_z* arInstantsB, const puint_z uCount, u64_z* arDifferences)
+{
+    const __m256i SIGN_BIT = _mm256_set1_epi64x(0x8000000000000000LL);
+    const puint_z VECTORIZED_COUNT = uCount & ~scast_z(3U, puint_z);
+
+    for(puint_z i = 0; i < VECTORIZED_COUNT; i += 4U)
+    {
+        const __m256i INSTANTS_A = _mm256_loadu_si256(rcast_z(arInstantsA + i, const __m256i*));
+        const __m256i INSTANTS_B = _mm256_loadu_si256(rcast_z(arInstantsB + i, const __m256i*));
+        const __m256i B_IS_GREATER = Z_TIME_AVX2_UNSIGNED_GREATER(INSTANTS_B, INSTANTS_A);
+        const __m256i DIFFERENCE = _mm256_blendv_epi8(_mm256_sub_epi64(INSTANTS_A, INSTANTS_B), 
+                                                      _mm256_sub_epi64(INSTANTS_B, INSTANTS_A), 
+                                                      B_IS_GREATER);
+        _mm256_storeu_si256(rcast_z(arDifferences + i, __m256i*), DIFFERENCE);
+    }
+
+    return VECTORIZED_COUNT;
+}
+
+Z_TIME_AVX2_FUNCTION puint_z STimeBatch::_BinAvx2(const u64_z* arInstants, const puint_z uCount, const u64_z uOrigin, const u64_z uWindowLength, u64_z* arWindowIndices)
+{
+    // Integers lower than 2^52 are converted to doubles and back by adding or subtracting 2^52 to the bits of the double 2^52, whose mantissa is zero
+    static const i64_z TWO_POW_52_BITS = 0x4330000000000000LL;
+    static const double TWO_POW_52 = 4503599627370496.0;
+
+    const __m256i SIGN_BIT = _mm256_set1_epi64x(0x8000000000000000LL);
+    const __m256i ORIGIN = _mm256_set1_epi64x(scast_z(uOrigin, i64_z));
+    const __m256i EXACT_LIMIT = _mm256_set1_epi64x(1LL << 52U);
+    const __m256i MAGIC_BITS = _mm256_set1_epi64x(TWO_POW_52_BITS);
+    const __m256d MAGIC = _mm256_set1_pd(TWO_POW_52);
+    const __m256d WINDOW_LENGTH = _mm256_set1_pd(scast_z(uWindowLength, double));
+    const __m256d INVERSE_WINDOW_LENGTH = _mm256_set1_pd(1.0 / scast_z(uWindowLength, double));
+    const __m256d ONE = _mm256_set1_pd(1.0);
+    const __m256d ZERO = _mm256_setzero_pd();
+    const puint_z VECTORIZED_COUNT = uCount & ~scast_z(3U, puint_z);
+
+    for(puint_z i = 0; i < VECTORIZED_COUNT; i += 4U)
+    {
+        const __m256i INSTANTS = _mm256_loadu_si256(rcast_z(arInstants + i, const __m256i*));
+        const __m256i BEFORE_ORIGIN = Z_TIME_AVX2_UNSIGNED_GREATER(ORIGIN, INSTANTS);
+        const __m256i DISTANCE = _mm256_andnot_si256(BEFORE_ORIGIN, _mm256_sub_epi64(INSTANTS, ORIGIN));
+
+        if(_mm256_movemask_epi8(Z_TIME_AVX2_UNSIGNED_GREATER(EXACT_LIMIT, DISTANCE)) != -1)
+        {
+            // Some distance cannot be represented exactly by a double
+            for(puint_z j = i; j < i + 4U; ++j)
+                arWindowIndices[j] = arInstants[j] < uOrigin ? 0 : 
+                                                               (arInstants[j] - uOrigin) / uWindowLength;
+        }
+        else
+        {
+            const __m256d DISTANCE_AS_DOUBLE = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(DISTANCE, MAGIC_BITS)), MAGIC);
+            __m256d quotient = _mm256_floor_pd(_mm256_mul_pd(DISTANCE_AS_DOUBLE, INVERSE_WINDOW_LENGTH));
+
+            // The quotient may be wrong by one due to the rounding of the inverse; the remainder is exact and tells how to fix it
+            const __m256d REMAINDER = _mm256_sub_pd(DISTANCE_AS_DOUBLE, _mm256_mul_pd(quotient, WINDOW_LENGTH));
+            quotient = _mm256_sub_pd(quotient, _mm256_and_pd(_mm256_cmp_pd(REMAINDER, ZERO, _CMP_LT_OQ), ONE));
+            quotient = _mm256_add_pd(quotient, _mm256_and_pd(_mm256_cmp_pd(REMAINDER, WINDOW_LENGTH, _CMP_GE_OQ), ONE));
+
+            const __m256i WINDOW_INDICES = _mm256_xor_si256(_mm256_castpd_si256(_mm256_add_pd(quotient, MAGIC)), MAGIC_BITS);
+            _mm256_storeu_si256(rcast_z(arWindowIndices + i, __m256i*), WINDOW_INDICES);
+        }
+    }
+
+    return VECTORIZED_COUNT;
+}
+
+Z_TIME_AVX2_FUNCTION puint_z STimeBatch::_GetMinimumAvx2(const u64_z* arInstants, const puint_z uCount, u64_z &uMinimum)
+{
+    const __m256i SIGN_BIT = _mm256_set1_epi64x(0x8000000000000000LL);
+    const puint_z VECTORIZED_COUNT = uCount & ~scast_z(3U, puint_z);
+
+    __m256i minimum = _mm256_set1_epi64x(scast_z(uMinimum, i64_z));
+
+    for(puint_z i = 0; i < VECTORIZED_COUNT; i += 4U)
+    {
+        const __m256i INSTANTS = _mm256_loadu_si256(rcast_z(arInstants + i, const __m256i*));
+        minimum = _mm256_blendv_epi8(minimum, INSTANTS, Z_TIME_AVX2_UNSIGNED_GREATER(minimum, INSTANTS));
+    }
+
+    u64_z arMinimums[4];
+    _mm256_storeu_si256(rcast_z(arMinimums, __m256i*), minimum);
+
+    for(unsigned int i = 0; i < 4U; ++i)
+        uMinimum = arMinimums[i] < uMinimum ? arMinimums[i] : uMinimum;
+
+    return VECTORIZED_COUNT;
+}
+
+Z_TIME_AVX2_FUNCTION puint_z STimeBatch::_GetMaximumAvx2(const u64_z* arInstants, const puint_z uCount, u64_z &uMaximum)
+{
+    const __m256i SIGN_BIT = _mm256_set1_epi64x(0x8000000000000000LL);
+    const puint_z VECTORIZED_COUNT = uCount & ~scast_z(3U, puint_z);
+
+    __m256i maximum = _mm256_set1_epi64x(scast_z(uMaximum, i64_z));
+
+    for(puint_z i = 0; i < VECTORIZED_COUNT; i += 4U)
+    {
+        const __m256i INSTANTS = _mm256_loadu_si256(rcast_z(arInstants + i, const __m256i*));
+        maximum = _mm256_blendv_epi8(maximum, INSTANTS, Z_TIME_AVX2_UNSIGNED_GREATER(INSTANTS, maximum));
+    }
+
+    u64_z arMaximums[4];
+    _mm256_storeu_si256(rcast_z(arMaximums, __m256i*), maximum);
+
+    for(unsigned int i = 0; i < 4U; ++i)
+        uMaximum = arMaximums[i] > uMaximum ? arMaximums[i] : uMaximum;
+
+    return VECTORIZED_COUNT;
+}
+
+#undef Z_TIME_AVX2_UNSIGNED_GREATER
+
+#endif
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+bool STimeBatch::IsVectorized()
+{
+    static const bool IS_AVX2_SUPPORTED = STimeBatch::_IsAvx2SupportedByProcessor();
+    return IS_AVX2_SUPPORTED;
+}
+
+} // namespace z
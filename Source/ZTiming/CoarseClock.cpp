@@ -0,0 +1,259 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "ZTiming/CoarseClock.h"
+
+#include "ZTime/STimeBatch.h"
+#include "ZTime/TimeZone.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+
+#if defined(Z_OS_WINDOWS)
+    #include <Windows.h>
+#elif defined(Z_OS_MAC)
+    #include <sys/time.h>
+#endif
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CoarseClock::CoarseClock() : m_uInstant(0),
+                             m_eMode(ECoarseClockMode::E_PublishedByThread),
+                             m_uUpdatePeriod(TimeSpan(0, 0, 0, 0, 1, 0, 0).GetHundredsOfNanoseconds()),
+                             m_pThread(null_z),
+                             m_bStopRequested(false)
+{
+    this->Update();
+}
+
+CoarseClock::CoarseClock(const ECoarseClockMode &eMode, const TimeSpan &updatePeriod) : m_uInstant(0),
+                                                                                        m_eMode(eMode),
+                                                                                        m_uUpdatePeriod(updatePeriod.GetHundredsOfNanoseconds()),
+                                                                                        m_pThread(null_z),
+                                                                                        m_bStopRequested(false)
+{
+    Z_ASSERT_ERROR(eMode == ECoarseClockMode::E_OperatingSystemCoarse || updatePeriod > TimeSpan(), "The update period must be greater than zero.");
+
+    this->Update();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CoarseClock::~CoarseClock()
+{
+    this->Stop();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void CoarseClock::Update()
+{
+    if(m_eMode == ECoarseClockMode::E_PublishedByThread)
+    {
+        // The system clock may be set back (for example, by NTP) and several threads may update the clock at the same time, so the published 
+        // instant is only replaced with later instants
+        const u64_z NEW_INSTANT = CoarseClock::_GetSystemUtcInstant(false);
+        u64_z uPublishedInstant = m_uInstant.load(boost::memory_order_relaxed);
+        bool bPublished = false;
+
+        while(NEW_INSTANT > uPublishedInstant && !bPublished)
+        {
+            // If it fails, uPublishedInstant receives the instant published by another thread
+            bPublished = m_uInstant.compare_exchange_weak(uPublishedInstant, NEW_INSTANT, boost::memory_order_release, boost::memory_order_relaxed);
+        }
+    }
+}
+
+void CoarseClock::Start()
+{
+    Z_ASSERT_ERROR(m_pThread == null_z, "The thread of the clock is already running.");
+
+    if(m_pThread == null_z && m_eMode == ECoarseClockMode::E_PublishedByThread)
+    {
+        m_bStopRequested.store(false, boost::memory_order_release);
+        m_pThread = new Thread(Delegate<void()>(this, &CoarseClock::_RunThread));
+    }
+}
+
+void CoarseClock::Stop()
+{
+    if(m_pThread != null_z)
+    {
+        m_bStopRequested.store(true, boost::memory_order_release);
+        m_pThread->Join();
+        delete m_pThread;
+        m_pThread = null_z;
+    }
+}
+
+u64_z CoarseClock::_GetSystemEpochInstant()
+{
+#if defined(Z_OS_WINDOWS)
+    // GetSystemTimeAsFileTime returns the number of hundreds of nanosecond since January 1, 1601 (UTC)
+    static const DateTime SYSTEM_EPOCH(1601, 1, 1, TimeZone::UTC);
+#else
+    // clock_gettime and gettimeofday get the number of seconds passed since January 1, 1970 (UTC)
+    static const DateTime SYSTEM_EPOCH(1970, 1, 1, TimeZone::UTC);
+#endif
+
+    u64_z uInstant = 0;
+    STimeBatch::GetInstants(&SYSTEM_EPOCH, 1U, &uInstant);
+    return uInstant;
+}
+
+#if defined(Z_OS_WINDOWS)
+
+u64_z CoarseClock::_GetSystemUtcInstant(const bool bCoarse)
+{
+    static const u64_z SYSTEM_EPOCH_INSTANT = CoarseClock::_GetSystemEpochInstant();
+
+    // Note: bCoarse is ignored, GetSystemTimeAsFileTime is already updated only once per system tick
+    FILETIME fileTime;
+    GetSystemTimeAsFileTime(&fileTime);
+
+    // Uses an intermediate structure to extract the number of hundreds of nanoseconds
+    ULARGE_INTEGER uTimePassedSinceEpochInHundredsOfNanoseconds;
+    uTimePassedSinceEpochInHundredsOfNanoseconds.LowPart = fileTime.dwLowDateTime;
+    uTimePassedSinceEpochInHundredsOfNanoseconds.HighPart = fileTime.dwHighDateTime;
+
+    return SYSTEM_EPOCH_INSTANT + uTimePassedSinceEpochInHundredsOfNanoseconds.QuadPart;
+}
+
+#elif defined(Z_OS_LINUX)
+
+u64_z CoarseClock::_GetSystemUtcInstant(const bool bCoarse)
+{
+    static const u64_z SYSTEM_EPOCH_INSTANT = CoarseClock::_GetSystemEpochInstant();
+    static const u64_z HUNDREDS_OF_NANOSECOND_PER_SECOND = 10000000ULL;
+
+    // CLOCK_REALTIME_COARSE is served by the vDSO without reading the hardware counter, it is updated once per kernel tick
+    timespec timeData;
+    clock_gettime(bCoarse ? CLOCK_REALTIME_COARSE : CLOCK_REALTIME, &timeData);
+
+    return SYSTEM_EPOCH_INSTANT + scast_z(timeData.tv_sec, u64_z) * HUNDREDS_OF_NANOSECOND_PER_SECOND + 
+                                  scast_z(timeData.tv_nsec, u64_z) / 100ULL; // The resolution of DateTime is 100 ns
+}
+
+#elif defined(Z_OS_MAC)
+
+u64_z CoarseClock::_GetSystemUtcInstant(const bool bCoarse)
+{
+    static const u64_z SYSTEM_EPOCH_INSTANT = CoarseClock::_GetSystemEpochInstant();
+    static const u64_z HUNDREDS_OF_NANOSECOND_PER_SECOND = 10000000ULL;
+
+    // Note: bCoarse is ignored, there is no coarse real-time clock
+    timeval timeData;
+    gettimeofday(&timeData, null_z);
+
+    return SYSTEM_EPOCH_INSTANT + scast_z(timeData.tv_sec, u64_z) * HUNDREDS_OF_NANOSECOND_PER_SECOND + 
+                                  scast_z(timeData.tv_usec, u64_z) * 10ULL; // The resolution of DateTime is 100 ns and timeData's is 1000 ns
+}
+
+#endif
+
+void CoarseClock::_RunThread()
+{
+    const TimeSpan UPDATE_PERIOD(m_uUpdatePeriod);
+
+    while(!m_bStopRequested.load(boost::memory_order_acquire))
+    {
+        SThisThread::Sleep(UPDATE_PERIOD);
+        this->Update();
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+DateTime CoarseClock::GetUtcDateTime() const
+{
+    const u64_z INSTANT = this->GetUtcInstant();
+
+    DateTime utcDateTime;
+    STimeBatch::SetInstants(&INSTANT, 1U, &utcDateTime);
+    return utcDateTime;
+}
+
+DateTime CoarseClock::GetDateTime(const TimeZone* pTimeZone) const
+{
+    return DateTime(this->GetUtcDateTime(), pTimeZone);
+}
+
+u64_z CoarseClock::GetUtcInstant() const
+{
+    return m_eMode == ECoarseClockMode::E_PublishedByThread ? m_uInstant.load(boost::memory_order_acquire) : 
+                                                              CoarseClock::_GetSystemUtcInstant(true);
+}
+
+ECoarseClockMode CoarseClock::GetMode() const
+{
+    return m_eMode;
+}
+
+TimeSpan CoarseClock::GetUpdatePeriod() const
+{
+    return TimeSpan(m_uUpdatePeriod);
+}
+
+bool CoarseClock::IsRunning() const
+{
+    return m_pThread != null_z;
+}
+
+} // namespace z
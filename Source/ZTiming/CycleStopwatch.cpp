@@ -0,0 +1,120 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZTiming/CycleStopwatch.h"
+
+#include "ZTiming/Stopwatch.h"
+#include "ZTiming/STimestampCounter.h"
+#include "ZCommon/Assertions.h"
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+CycleStopwatch::CycleStopwatch() : m_uReferenceCycles(0)
+{
+    // Forces the calibration now so it does not happen while measuring
+    CycleStopwatch::GetCyclesPerSecond();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u64_z CycleStopwatch::_GetCurrentCycles()
+{
+    return STimestampCounter::IsAvailable() ? STimestampCounter::GetCycles() : 
+                                              Stopwatch::_GetCurrentInstant();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u64_z CycleStopwatch::GetElapsedCycles() const
+{
+    Z_ASSERT_WARNING(m_uReferenceCycles > 0, "The stopwatch has not been set.");
+
+    return CycleStopwatch::_GetCurrentCycles() - m_uReferenceCycles;
+}
+
+u64_z CycleStopwatch::GetElapsedTimeAsInteger() const
+{
+    Z_ASSERT_WARNING(m_uReferenceCycles > 0, "The stopwatch has not been set.");
+
+    const u64_z ELAPSED_CYCLES = CycleStopwatch::_GetCurrentCycles() - m_uReferenceCycles;
+
+    return STimestampCounter::IsAvailable() ? STimestampCounter::ConvertToNanoseconds(ELAPSED_CYCLES) : 
+                                              ELAPSED_CYCLES;
+}
+
+TimeSpan CycleStopwatch::GetElapsedTimeAsTimeSpan() const
+{
+    static const u64_z HUNDRED_OF_NANOSECONDS = 100ULL;
+    return TimeSpan(this->GetElapsedTimeAsInteger() / HUNDRED_OF_NANOSECONDS);
+}
+
+void CycleStopwatch::Set()
+{
+    m_uReferenceCycles = CycleStopwatch::_GetCurrentCycles();
+}
+
+bool CycleStopwatch::IsCycleAccurate()
+{
+    return STimestampCounter::IsAvailable();
+}
+
+u64_z CycleStopwatch::GetCyclesPerSecond()
+{
+    static const u64_z NANOSECONDS_IN_SECOND = 1000000000ULL;
+
+    return STimestampCounter::IsAvailable() ? STimestampCounter::GetFrequency() : 
+                                              NANOSECONDS_IN_SECOND;
+}
+
+} // namespace z
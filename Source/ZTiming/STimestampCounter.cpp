@@ -0,0 +1,157 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZTiming/STimestampCounter.h"
+
+#include "ZTiming/Stopwatch.h"
+
+#if defined(Z_TIMING_TIMESTAMPCOUNTER_SUPPORTED) && defined(Z_COMPILER_GCC)
+    #include <cpuid.h>
+#endif
+
+
+namespace z
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u64_z STimestampCounter::ConvertToNanoseconds(const u64_z uCycles)
+{
+    static const u64_z NANOSECONDS_IN_SECOND = 1000000000ULL;
+
+    const u64_z FREQUENCY = STimestampCounter::GetFrequency();
+
+    u64_z uNanoseconds = 0;
+
+    if(FREQUENCY != 0)
+    {
+        // The amount of cycles is split into whole seconds and a remainder to prevent the multiplication from overflowing
+        uNanoseconds = (uCycles / FREQUENCY) * NANOSECONDS_IN_SECOND + 
+                       (uCycles % FREQUENCY) * NANOSECONDS_IN_SECOND / FREQUENCY;
+    }
+
+    return uNanoseconds;
+}
+
+bool STimestampCounter::_IsSupportedByProcessor()
+{
+    bool bIsSupported = false;
+
+#if defined(Z_TIMING_TIMESTAMPCOUNTER_SUPPORTED)
+
+    static const unsigned int EXTENDED_FUNCTIONS_LEAF = 0x80000000U;
+    static const unsigned int EXTENDED_FEATURES_LEAF = 0x80000001U;
+    static const unsigned int ADVANCED_POWER_MANAGEMENT_LEAF = 0x80000007U;
+    static const unsigned int RDTSCP_BIT = 1U << 27U;
+    static const unsigned int INVARIANT_TSC_BIT = 1U << 8U;
+
+    // Registers EAX, EBX, ECX and EDX
+    unsigned int arRegisters[4] = {0, 0, 0, 0};
+
+    #if defined(Z_COMPILER_MSVC)
+        __cpuid(rcast_z(arRegisters, int*), EXTENDED_FUNCTIONS_LEAF);
+    #elif defined(Z_COMPILER_GCC)
+        __get_cpuid(EXTENDED_FUNCTIONS_LEAF, &arRegisters[0], &arRegisters[1], &arRegisters[2], &arRegisters[3]);
+    #endif
+
+    const unsigned int MAX_EXTENDED_LEAF = arRegisters[0];
+
+    if(MAX_EXTENDED_LEAF >= ADVANCED_POWER_MANAGEMENT_LEAF)
+    {
+    #if defined(Z_COMPILER_MSVC)
+        __cpuid(rcast_z(arRegisters, int*), EXTENDED_FEATURES_LEAF);
+    #elif defined(Z_COMPILER_GCC)
+        __get_cpuid(EXTENDED_FEATURES_LEAF, &arRegisters[0], &arRegisters[1], &arRegisters[2], &arRegisters[3]);
+    #endif
+
+        const bool bHasRdtscp = (arRegisters[3] & RDTSCP_BIT) != 0;
+
+    #if defined(Z_COMPILER_MSVC)
+        __cpuid(rcast_z(arRegisters, int*), ADVANCED_POWER_MANAGEMENT_LEAF);
+    #elif defined(Z_COMPILER_GCC)
+        __get_cpuid(ADVANCED_POWER_MANAGEMENT_LEAF, &arRegisters[0], &arRegisters[1], &arRegisters[2], &arRegisters[3]);
+    #endif
+
+        const bool bHasInvariantTsc = (arRegisters[3] & INVARIANT_TSC_BIT) != 0;
+
+        bIsSupported = bHasRdtscp && bHasInvariantTsc;
+    }
+
+#endif
+
+    return bIsSupported;
+}
+
+u64_z STimestampCounter::_CalibrateFrequency()
+{
+    static const u64_z NANOSECONDS_IN_SECOND = 1000000000ULL;
+    static const u64_z CALIBRATION_PERIOD = 20000000ULL; // Nanoseconds
+
+    // Both counters are read as close as possible at the beginning and at the end of the calibration period
+    const u64_z START_INSTANT = Stopwatch::_GetCurrentInstant();
+    const u64_z START_CYCLES = STimestampCounter::GetCycles();
+
+    u64_z uEndInstant = START_INSTANT;
+
+    while(uEndInstant - START_INSTANT < CALIBRATION_PERIOD)
+        uEndInstant = Stopwatch::_GetCurrentInstant();
+
+    const u64_z END_CYCLES = STimestampCounter::GetCycles();
+
+    return (END_CYCLES - START_CYCLES) * NANOSECONDS_IN_SECOND / (uEndInstant - START_INSTANT);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+bool STimestampCounter::IsAvailable()
+{
+    static const bool IS_AVAILABLE = STimestampCounter::_IsSupportedByProcessor();
+    return IS_AVAILABLE;
+}
+
+u64_z STimestampCounter::GetFrequency()
+{
+    static const u64_z FREQUENCY = STimestampCounter::IsAvailable() ? STimestampCounter::_CalibrateFrequency() : 0;
+    return FREQUENCY;
+}
+
+} // namespace z
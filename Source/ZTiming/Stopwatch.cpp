@@ -27,6 +27,7 @@
 #include "ZTiming/Stopwatch.h"
 
 #include "ZTiming/TimingModuleDefinitions.h"
+#include "ZTiming/STimestampCounter.h"
 
 
 namespace z
@@ -61,7 +62,36 @@ namespace z
 //##################                                                       ##################
 //##################=======================================================##################
 
-Stopwatch::Stopwatch() : m_uReferenceTime(0)
+Stopwatch::Stopwatch() : m_uReferenceTime(0),
+                         m_eClockSource(EClockSource::E_OperatingSystem)
+{
+    Stopwatch::_InitializeAuxiliarData();
+}
+
+Stopwatch::Stopwatch(const EClockSource &eClockSource) : m_uReferenceTime(0),
+                                                         m_eClockSource(EClockSource::E_OperatingSystem)
+{
+    Stopwatch::_InitializeAuxiliarData();
+
+    if(eClockSource == EClockSource::E_TimestampCounter && STimestampCounter::IsAvailable())
+    {
+        // Forces the calibration now so it does not happen while measuring time
+        STimestampCounter::GetFrequency();
+        m_eClockSource = EClockSource::E_TimestampCounter;
+    }
+}
+
+
+//##################=======================================================##################
+//##################			 ____________________________			   ##################
+//##################			|							 |			   ##################
+//##################		    |		    METHODS			 |			   ##################
+//##################		   /|							 |\			   ##################
+//##################			 \/\/\/\/\/\/\/\/\/\/\/\/\/\/			   ##################
+//##################													   ##################
+//##################=======================================================##################
+
+void Stopwatch::_InitializeAuxiliarData()
 {
     static bool bInitialized = false;
 
@@ -82,16 +112,6 @@ Stopwatch::Stopwatch() : m_uReferenceTime(0)
         bInitialized = true;
     }
 }
-    
-    
-//##################=======================================================##################
-//##################			 ____________________________			   ##################
-//##################			|							 |			   ##################
-//##################		    |		    METHODS			 |			   ##################
-//##################		   /|							 |\			   ##################
-//##################			 \/\/\/\/\/\/\/\/\/\/\/\/\/\/			   ##################
-//##################													   ##################
-//##################=======================================================##################
 
 u64_z Stopwatch::_GetCurrentInstant()
 {
@@ -109,8 +129,9 @@ u64_z Stopwatch::_GetCurrentInstant()
 
     static const u64_z NANOSECONDS_IN_SECOND = 1000000000ULL;
     
+    // CLOCK_MONOTONIC is served by the vDSO, unlike CLOCK_MONOTONIC_RAW which implies a system call on many kernels
     timespec timeSpecData;
-    ::clock_gettime(CLOCK_MONOTONIC_RAW, &timeSpecData);
+    ::clock_gettime(CLOCK_MONOTONIC, &timeSpecData);
 
     return timeSpecData.tv_sec * NANOSECONDS_IN_SECOND + timeSpecData.tv_nsec;
 
@@ -124,6 +145,20 @@ u64_z Stopwatch::_GetCurrentInstant()
 
 }
 
+u64_z Stopwatch::_GetCurrentSample() const
+{
+    return m_eClockSource == EClockSource::E_TimestampCounter ? STimestampCounter::GetCycles() : 
+                                                                Stopwatch::_GetCurrentInstant();
+}
+
+u64_z Stopwatch::_GetElapsedNanoseconds() const
+{
+    const u64_z ELAPSED_TIME = this->_GetCurrentSample() - m_uReferenceTime;
+
+    return m_eClockSource == EClockSource::E_TimestampCounter ? STimestampCounter::ConvertToNanoseconds(ELAPSED_TIME) : 
+                                                                ELAPSED_TIME;
+}
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
@@ -140,10 +175,10 @@ float_z Stopwatch::GetElapsedTimeAsFloat() const
 
 #if Z_CONFIG_PRECISION_DEFAULT == Z_CONFIG_PRECISION_SIMPLE
     static const u64_z NANOSECONDS_IN_MILLISECOND = 1000000ULL;
-    return scast_z((Stopwatch::_GetCurrentInstant() - m_uReferenceTime) / NANOSECONDS_IN_MILLISECOND, float_z);
+    return scast_z(this->_GetElapsedNanoseconds() / NANOSECONDS_IN_MILLISECOND, float_z);
 #elif Z_CONFIG_PRECISION_DEFAULT == Z_CONFIG_PRECISION_DOUBLE
     static const float_z NANOSECONDS_IN_MILLISECOND = 1000000.0;
-    return scast_z(Stopwatch::_GetCurrentInstant() - m_uReferenceTime, float_z) / NANOSECONDS_IN_MILLISECOND;
+    return scast_z(this->_GetElapsedNanoseconds(), float_z) / NANOSECONDS_IN_MILLISECOND;
 #endif
 }
 
@@ -151,7 +186,7 @@ u64_z Stopwatch::GetElapsedTimeAsInteger() const
 {
     Z_ASSERT_WARNING(m_uReferenceTime > 0, "The stopwatch has not been set.");
 
-    return Stopwatch::_GetCurrentInstant() - m_uReferenceTime;
+    return this->_GetElapsedNanoseconds();
 }
 
 TimeSpan Stopwatch::GetElapsedTimeAsTimeSpan() const
@@ -159,12 +194,17 @@ TimeSpan Stopwatch::GetElapsedTimeAsTimeSpan() const
     Z_ASSERT_WARNING(m_uReferenceTime > 0, "The stopwatch has not been set.");
 
     static const u64_z HUNDRED_OF_NANOSECONDS = 100ULL;
-    return TimeSpan((Stopwatch::_GetCurrentInstant() - m_uReferenceTime) / HUNDRED_OF_NANOSECONDS);
+    return TimeSpan(this->_GetElapsedNanoseconds() / HUNDRED_OF_NANOSECONDS);
 }
 
 void Stopwatch::Set()
 {
-    m_uReferenceTime = Stopwatch::_GetCurrentInstant();
+    m_uReferenceTime = this->_GetCurrentSample();
+}
+
+EClockSource Stopwatch::GetClockSource() const
+{
+    return m_eClockSource;
 }
 
 } // namespace z
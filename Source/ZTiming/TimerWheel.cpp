@@ -0,0 +1,438 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include "ZTiming/TimerWheel.h"
+
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+
+
+namespace z
+{
+    
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+TimerWheel::TimerWheel() : m_uTickDuration(TimeSpan(0, 0, 0, 0, 1, 0, 0).GetHundredsOfNanoseconds()),
+                           m_uCurrentTick(0),
+                           m_uPendingTimersCount(0),
+                           m_uFirstFreeNode(TimerWheel::NO_NODE),
+                           m_pThread(null_z),
+                           m_bStopRequested(false)
+{
+    for(puint_z i = 0; i < LEVELS_COUNT * SLOTS_PER_LEVEL; ++i)
+        m_arSlots[i] = TimerWheel::NO_NODE;
+
+    m_clock.Set();
+}
+
+TimerWheel::TimerWheel(const TimeSpan &tickDuration) : m_uTickDuration(tickDuration.GetHundredsOfNanoseconds()),
+                                                       m_uCurrentTick(0),
+                                                       m_uPendingTimersCount(0),
+                                                       m_uFirstFreeNode(TimerWheel::NO_NODE),
+                                                       m_pThread(null_z),
+                                                       m_bStopRequested(false)
+{
+    Z_ASSERT_ERROR(tickDuration > TimeSpan(), "The duration of the ticks must be greater than zero.");
+
+    for(puint_z i = 0; i < LEVELS_COUNT * SLOTS_PER_LEVEL; ++i)
+        m_arSlots[i] = TimerWheel::NO_NODE;
+
+    m_clock.Set();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+TimerWheel::~TimerWheel()
+{
+    this->Stop();
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+TimerWheel::TimerId TimerWheel::AddTimer(const TimeSpan &delay, const TimerCallback &callback)
+{
+    Z_ASSERT_ERROR(!callback.IsNull(), "The callback of the timer cannot be null.");
+
+    static const u64_z ONE_SHOT = 0;
+
+    ScopedExclusiveLock<> lock(m_mutex);
+
+    return this->_AddTimer(this->_ConvertToTicks(delay), ONE_SHOT, callback);
+}
+
+TimerWheel::TimerId TimerWheel::AddPeriodicTimer(const TimeSpan &period, const TimerCallback &callback)
+{
+    Z_ASSERT_ERROR(!callback.IsNull(), "The callback of the timer cannot be null.");
+
+    const u64_z PERIOD_TICKS = this->_ConvertToTicks(period);
+
+    ScopedExclusiveLock<> lock(m_mutex);
+
+    return this->_AddTimer(PERIOD_TICKS, PERIOD_TICKS, callback);
+}
+
+bool TimerWheel::CancelTimer(const TimerId timerId)
+{
+    static const u64_z INDEX_MASK = 0xFFFFFFFFULL;
+    static const u32_z GENERATION_SHIFT = 32U;
+
+    const puint_z NODE_INDEX = scast_z(timerId & INDEX_MASK, puint_z);
+    const u32_z GENERATION = scast_z(timerId >> GENERATION_SHIFT, u32_z);
+
+    ScopedExclusiveLock<> lock(m_mutex);
+
+    bool bCancelled = false;
+
+    if(NODE_INDEX < m_arNodes.GetCount() && 
+       m_arNodes[NODE_INDEX].m_uGeneration == GENERATION && 
+       m_arNodes[NODE_INDEX].m_uSlot != TimerWheel::NO_SLOT)
+    {
+        this->_ReleaseNode(NODE_INDEX);
+        bCancelled = true;
+    }
+
+    return bCancelled;
+}
+
+puint_z TimerWheel::Tick()
+{
+    const u64_z CLOCK_TICK = this->_GetClockTick();
+    u64_z uCurrentTick = 0;
+
+    {
+        ScopedExclusiveLock<> lock(m_mutex);
+        uCurrentTick = m_uCurrentTick;
+    }
+
+    return CLOCK_TICK > uCurrentTick ? this->Advance(CLOCK_TICK - uCurrentTick) : 
+                                       0;
+}
+
+puint_z TimerWheel::Advance(const u64_z uTicks)
+{
+    puint_z uCallsCount = 0;
+    ArrayDynamic<TimerCallback> arExpiredCallbacks;
+    bool bHasPendingTimers = true;
+
+    for(u64_z uTick = 0; uTick < uTicks && bHasPendingTimers; ++uTick)
+    {
+        {
+            ScopedExclusiveLock<> lock(m_mutex);
+
+            bHasPendingTimers = m_uPendingTimersCount > 0;
+
+            if(bHasPendingTimers)
+                this->_AdvanceOneTick(arExpiredCallbacks);
+            else
+                m_uCurrentTick += uTicks - uTick; // There is nothing to process in the remaining ticks
+        }
+
+        // Callbacks are called without the lock so they can add or cancel timers
+        for(puint_z i = 0; i < arExpiredCallbacks.GetCount(); ++i)
+            arExpiredCallbacks[i]();
+
+        uCallsCount += arExpiredCallbacks.GetCount();
+        arExpiredCallbacks.Clear();
+    }
+
+    return uCallsCount;
+}
+
+void TimerWheel::Start()
+{
+    Z_ASSERT_ERROR(m_pThread == null_z, "The thread of the timer wheel is already running.");
+
+    if(m_pThread == null_z)
+    {
+        m_bStopRequested.store(false, boost::memory_order_release);
+        m_pThread = new Thread(Delegate<void()>(this, &TimerWheel::_RunThread));
+    }
+}
+
+void TimerWheel::Stop()
+{
+    if(m_pThread != null_z)
+    {
+        m_bStopRequested.store(true, boost::memory_order_release);
+        m_pThread->Join();
+        delete m_pThread;
+        m_pThread = null_z;
+    }
+}
+
+TimerWheel::TimerId TimerWheel::_AddTimer(const u64_z uDelayTicks, const u64_z uPeriod, const TimerCallback &callback)
+{
+    static const u32_z GENERATION_SHIFT = 32U;
+
+    puint_z uNode = m_uFirstFreeNode;
+
+    if(uNode == TimerWheel::NO_NODE)
+    {
+        TimerNode newNode;
+        newNode.m_uGeneration = 1U;
+        m_arNodes.Add(newNode);
+        uNode = m_arNodes.GetCount() - 1U;
+    }
+    else
+    {
+        m_uFirstFreeNode = m_arNodes[uNode].m_uNext;
+    }
+
+    TimerNode &node = m_arNodes[uNode];
+    node.m_callback = callback;
+    node.m_uExpirationTick = m_uCurrentTick + uDelayTicks;
+    node.m_uPeriod = uPeriod;
+    this->_InsertNode(uNode);
+    ++m_uPendingTimersCount;
+
+    return (scast_z(node.m_uGeneration, u64_z) << GENERATION_SHIFT) | scast_z(uNode, u64_z);
+}
+
+void TimerWheel::_InsertNode(const puint_z uNode)
+{
+    static const u64_z MAXIMUM_DELAY = (1ULL << (LEVELS_COUNT * BITS_PER_LEVEL)) - 1ULL;
+    static const u64_z SLOT_MASK = SLOTS_PER_LEVEL - 1U;
+
+    TimerNode &node = m_arNodes[uNode];
+
+    // Timers beyond the range of the wheel are placed in the farthest slot and placed again when it is cascaded
+    u64_z uExpirationTick = node.m_uExpirationTick < m_uCurrentTick ? m_uCurrentTick : node.m_uExpirationTick;
+
+    if(uExpirationTick - m_uCurrentTick > MAXIMUM_DELAY)
+        uExpirationTick = m_uCurrentTick + MAXIMUM_DELAY;
+
+    // The level is the first one whose range contains the delay
+    const u64_z DELAY = uExpirationTick - m_uCurrentTick;
+    u32_z uLevel = 0;
+
+    while(uLevel < LEVELS_COUNT - 1U && (DELAY >> (BITS_PER_LEVEL * (uLevel + 1U))) != 0)
+        ++uLevel;
+
+    const u32_z SLOT = uLevel * SLOTS_PER_LEVEL + scast_z((uExpirationTick >> (BITS_PER_LEVEL * uLevel)) & SLOT_MASK, u32_z);
+
+    // Inserts the node at the beginning of the list
+    node.m_uSlot = SLOT;
+    node.m_uPrevious = TimerWheel::NO_NODE;
+    node.m_uNext = m_arSlots[SLOT];
+
+    if(node.m_uNext != TimerWheel::NO_NODE)
+        m_arNodes[node.m_uNext].m_uPrevious = uNode;
+
+    m_arSlots[SLOT] = uNode;
+}
+
+void TimerWheel::_RemoveNode(const puint_z uNode)
+{
+    TimerNode &node = m_arNodes[uNode];
+
+    if(node.m_uPrevious == TimerWheel::NO_NODE)
+        m_arSlots[node.m_uSlot] = node.m_uNext;
+    else
+        m_arNodes[node.m_uPrevious].m_uNext = node.m_uNext;
+
+    if(node.m_uNext != TimerWheel::NO_NODE)
+        m_arNodes[node.m_uNext].m_uPrevious = node.m_uPrevious;
+
+    node.m_uSlot = TimerWheel::NO_SLOT;
+}
+
+void TimerWheel::_ReleaseNode(const puint_z uNode)
+{
+    this->_RemoveNode(uNode);
+
+    TimerNode &node = m_arNodes[uNode];
+    node.m_callback = TimerCallback();
+
+    // Zero is skipped so identifiers are never zero
+    ++node.m_uGeneration;
+
+    if(node.m_uGeneration == 0)
+        node.m_uGeneration = 1U;
+
+    node.m_uNext = m_uFirstFreeNode;
+    m_uFirstFreeNode = uNode;
+    --m_uPendingTimersCount;
+}
+
+bool TimerWheel::_CascadeSlot(const u32_z uLevel)
+{
+    static const u64_z SLOT_MASK = SLOTS_PER_LEVEL - 1U;
+
+    const u32_z SLOT_INDEX = scast_z((m_uCurrentTick >> (BITS_PER_LEVEL * uLevel)) & SLOT_MASK, u32_z);
+    const u32_z SLOT = uLevel * SLOTS_PER_LEVEL + SLOT_INDEX;
+
+    // The list is detached before placing its nodes again, in other slots
+    puint_z uNode = m_arSlots[SLOT];
+    m_arSlots[SLOT] = TimerWheel::NO_NODE;
+
+    while(uNode != TimerWheel::NO_NODE)
+    {
+        const puint_z NEXT_NODE = m_arNodes[uNode].m_uNext;
+        this->_InsertNode(uNode);
+        uNode = NEXT_NODE;
+    }
+
+    return SLOT_INDEX == 0;
+}
+
+void TimerWheel::_AdvanceOneTick(ArrayDynamic<TimerCallback> &arExpiredCallbacks)
+{
+    static const u64_z SLOT_MASK = SLOTS_PER_LEVEL - 1U;
+
+    ++m_uCurrentTick;
+
+    // When a level completes a turn, the current slot of the level above is distributed among the levels below
+    if((m_uCurrentTick & SLOT_MASK) == 0)
+    {
+        u32_z uLevel = 1U;
+
+        while(uLevel < LEVELS_COUNT && this->_CascadeSlot(uLevel))
+            ++uLevel;
+    }
+
+    const u32_z SLOT = scast_z(m_uCurrentTick & SLOT_MASK, u32_z);
+
+    puint_z uNode = m_arSlots[SLOT];
+    m_arSlots[SLOT] = TimerWheel::NO_NODE;
+
+    while(uNode != TimerWheel::NO_NODE)
+    {
+        TimerNode &node = m_arNodes[uNode];
+        const puint_z NEXT_NODE = node.m_uNext;
+        node.m_uPrevious = TimerWheel::NO_NODE;
+        node.m_uNext = TimerWheel::NO_NODE;
+
+        if(node.m_uExpirationTick > m_uCurrentTick)
+        {
+            this->_InsertNode(uNode);
+        }
+        else
+        {
+            arExpiredCallbacks.Add(node.m_callback);
+
+            if(node.m_uPeriod == 0)
+            {
+                this->_ReleaseNode(uNode);
+            }
+            else
+            {
+                node.m_uExpirationTick += node.m_uPeriod;
+                this->_InsertNode(uNode);
+            }
+        }
+
+        uNode = NEXT_NODE;
+    }
+}
+
+u64_z TimerWheel::_ConvertToTicks(const TimeSpan &timeSpan) const
+{
+    const u64_z TICKS = (timeSpan.GetHundredsOfNanoseconds() + m_uTickDuration - 1U) / m_uTickDuration;
+    return TICKS == 0 ? 1U : TICKS;
+}
+
+u64_z TimerWheel::_GetClockTick() const
+{
+    static const u64_z NANOSECONDS_PER_HUNDRED_OF_NANOSECONDS = 100ULL;
+
+    return m_clock.GetElapsedTimeAsInteger() / (m_uTickDuration * NANOSECONDS_PER_HUNDRED_OF_NANOSECONDS);
+}
+
+void TimerWheel::_RunThread()
+{
+    static const u64_z NANOSECONDS_PER_HUNDRED_OF_NANOSECONDS = 100ULL;
+
+    const u64_z TICK_NANOSECONDS = m_uTickDuration * NANOSECONDS_PER_HUNDRED_OF_NANOSECONDS;
+
+    while(!m_bStopRequested.load(boost::memory_order_acquire))
+    {
+        this->Tick();
+
+        // Sleeps until the next tick begins
+        const u64_z ELAPSED_NANOSECONDS = m_clock.GetElapsedTimeAsInteger();
+        const u64_z NEXT_TICK_NANOSECONDS = (ELAPSED_NANOSECONDS / TICK_NANOSECONDS + 1ULL) * TICK_NANOSECONDS;
+        SThisThread::Sleep(TimeSpan((NEXT_TICK_NANOSECONDS - ELAPSED_NANOSECONDS + NANOSECONDS_PER_HUNDRED_OF_NANOSECONDS - 1ULL) / NANOSECONDS_PER_HUNDRED_OF_NANOSECONDS));
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+TimeSpan TimerWheel::GetTickDuration() const
+{
+    return TimeSpan(m_uTickDuration);
+}
+
+u64_z TimerWheel::GetCurrentTick() const
+{
+    ScopedExclusiveLock<> lock(m_mutex);
+    return m_uCurrentTick;
+}
+
+puint_z TimerWheel::GetPendingTimersCount() const
+{
+    ScopedExclusiveLock<> lock(m_mutex);
+    return m_uPendingTimersCount;
+}
+
+bool TimerWheel::IsRunning() const
+{
+    return m_pThread != null_z;
+}
+
+} // namespace z
@@ -32,11 +32,8 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/unit_test_log.hpp>
 
-#include "../common/CommonConfigDefinitions.h"
-#include "../common/CommonTestConfig.h"
-
-using Test::CommonTestConfig;
-using Test::ETestType;
+#include "../testsystem/CommonConfigDefinitions.h"
+#include "../testsystem/CommonTestConfig.h"
 
 namespace z
 {
@@ -46,7 +43,7 @@ namespace Test
 /// <summary>
 /// Base class for performance test modules. Always inherit from this class to define a new performance test module.
 /// </summary>
-class DllExport QPerformanceTestModuleBase
+class PerformanceTestModuleBase
 {
 	// CONSTRUCTORS
 	// ---------------
@@ -56,7 +53,7 @@ public:
 	/// Constructor that receives the name of the module.
 	/// </summary>
     /// <param name="strModuleName">The name of the module.</param>
-	QPerformanceTestModuleBase(const std::string &strModuleName)
+	PerformanceTestModuleBase(const std::string &strModuleName)
     {
         CommonTestConfig config(strModuleName, ETestType::E_PerformanceTest);
     }
@@ -69,7 +66,7 @@ public:
 	/// <summary>
 	/// Destructor.
 	/// </summary>		
-	virtual ~QPerformanceTestModuleBase()
+	virtual ~PerformanceTestModuleBase()
     {
     }
 
@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/ArrayDynamic.h"
+#include "ZMemory/ContiguousAllocator.h"
+
+#include "ZMemory/PoolAllocator.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( ArrayAllocators_PerformanceTestSuite )
+
+/// <summary>
+/// Number of elements added to the arrays in every measurement.
+/// </summary>
+static const puint_z ELEMENTS_COUNT = 1000000U;
+
+/// <summary>
+/// Number of times the arrays are traversed in every measurement.
+/// </summary>
+static const puint_z ITERATIONS_COUNT = 20U;
+
+// An element of the size of a cache line
+struct LargeElement
+{
+    explicit LargeElement(const u64_z uValue)
+    {
+        for(unsigned int i = 0; i < sizeof(m_arValues) / sizeof(u64_z); ++i)
+            m_arValues[i] = uValue + i;
+    }
+
+    operator u64_z() const
+    {
+        return m_arValues[0];
+    }
+
+    u64_z m_arValues[8];
+};
+
+/// <summary>
+/// Gets the number of bytes allocated in the heap by an allocator; PoolAllocator also stores the list of free blocks.
+/// </summary>
+puint_z GetHeapBytes_TestMethod(const PoolAllocator* pAllocator)
+{
+    return pAllocator->GetTotalSize();
+}
+
+/// <summary>
+/// Gets the number of bytes allocated in the heap by an allocator.
+/// </summary>
+puint_z GetHeapBytes_TestMethod(const ContiguousAllocator* pAllocator)
+{
+    return pAllocator->GetPoolSize();
+}
+
+/// <summary>
+/// Adds elements to an array, one by one, and traverses it both by index and by iterator; then prints the average time per element, in 
+/// nanoseconds, of every operation, and the memory used by the array.
+/// </summary>
+template<class T, class AllocatorT>
+void MeasureArray_TestMethod(const char* szDescription)
+{
+    typedef ArrayDynamic<T, AllocatorT> ArrayT;
+
+    ArrayT arElements;
+    u64_z uSum = 0;
+
+    // Add
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+        arElements.Add(T(scast_z(i, u64_z)));
+
+    const double ADD_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / ELEMENTS_COUNT;
+
+    // Iteration by index
+    measurer.Set();
+
+    for(puint_z uIteration = 0; uIteration < ITERATIONS_COUNT; ++uIteration)
+        for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+            uSum += scast_z(arElements[i], u64_z);
+
+    const double INDEX_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / (ELEMENTS_COUNT * ITERATIONS_COUNT);
+
+    // Iteration by iterator
+    measurer.Set();
+
+    for(puint_z uIteration = 0; uIteration < ITERATIONS_COUNT; ++uIteration)
+        for(typename ArrayT::ConstArrayIterator it = arElements.GetFirst(); !it.IsEnd(); ++it)
+            uSum += scast_z(*it, u64_z);
+
+    const double ITERATOR_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / (ELEMENTS_COUNT * ITERATIONS_COUNT);
+
+    const puint_z HEAP_BYTES = GetHeapBytes_TestMethod(arElements.GetAllocator());
+    const double BYTES_PER_ELEMENT = scast_z(HEAP_BYTES, double) / ELEMENTS_COUNT;
+
+    BOOST_TEST_MESSAGE(szDescription << ", " << sizeof(T) << "-byte elements: Add " << ADD_TIME << " ns, index " << INDEX_TIME << 
+                       " ns, iterator " << ITERATOR_TIME << " ns per element; " << HEAP_BYTES << " bytes in the heap (" << BYTES_PER_ELEMENT << 
+                       " per element), " << sizeof(AllocatorT) << " bytes per allocator (" << uSum << ")");
+}
+
+/// <summary>
+/// Measures arrays of integers stored in a PoolAllocator, for comparison.
+/// </summary>
+ZTEST_CASE ( PoolAllocator_MeasuresArraysOfIntegers_Test )
+{
+    MeasureArray_TestMethod<u64_z, PoolAllocator>("PoolAllocator");
+}
+
+/// <summary>
+/// Measures arrays of integers stored in a ContiguousAllocator.
+/// </summary>
+ZTEST_CASE ( ContiguousAllocator_MeasuresArraysOfIntegers_Test )
+{
+    MeasureArray_TestMethod<u64_z, ContiguousAllocator>("ContiguousAllocator");
+}
+
+/// <summary>
+/// Measures arrays of large elements stored in a PoolAllocator, for comparison.
+/// </summary>
+ZTEST_CASE ( PoolAllocator_MeasuresArraysOfLargeElements_Test )
+{
+    MeasureArray_TestMethod<LargeElement, PoolAllocator>("PoolAllocator");
+}
+
+/// <summary>
+/// Measures arrays of large elements stored in a ContiguousAllocator.
+/// </summary>
+ZTEST_CASE ( ContiguousAllocator_MeasuresArraysOfLargeElements_Test )
+{
+    MeasureArray_TestMethod<LargeElement, ContiguousAllocator>("ContiguousAllocator");
+}
+
+// End - Test Suite: ArrayAllocators
+ZTEST_SUITE_END()
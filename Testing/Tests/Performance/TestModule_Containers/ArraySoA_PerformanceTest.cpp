@@ -0,0 +1,121 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/ArraySoA.h"
+#include "ZContainers/ArrayDynamic.h"
+
+#include "ZMath/SVectorArray.h"
+#include "ZMath/TransformationMatrix.h"
+#include "ZMath/TranslationMatrix.h"
+#include "ZMath/RotationMatrix3x3.h"
+#include "ZMath/ScalingMatrix3x3.h"
+#include "ZMath/SAngle.h"
+#include "ZTiming/CycleStopwatch.h"
+using namespace z::Internals;
+
+
+ZTEST_SUITE_BEGIN( ArraySoA_PerformanceTestSuite )
+
+/// <summary>
+/// Number of points transformed in every measurement.
+/// </summary>
+static const puint_z POINTS_COUNT = 10000000U;
+
+/// <summary>
+/// Number of times the points are transformed; the average time is printed.
+/// </summary>
+static const unsigned int REPETITIONS = 5U;
+
+/// <summary>
+/// Transforms the same points stored as an array of Vector3 (array of structures) and as the columns of an ArraySoA (structure of arrays), 
+/// and prints the average time per point, in nanoseconds, of both layouts and of the conversion between them.
+/// </summary>
+ZTEST_CASE ( Transform_AoSVersusSoA_Test )
+{
+    const TranslationMatrix<Matrix4x3> TRANSLATION(SFloat::_2, SFloat::_4, -SFloat::_6);
+#if Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_DEGREES
+    const RotationMatrix3x3 ROTATION(SAngle::_90, SAngle::_180, SAngle::_45);
+#elif Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_RADIANS
+    const RotationMatrix3x3 ROTATION(SAngle::_HalfPi, SAngle::_Pi, SAngle::_QuarterPi);
+#endif
+    const ScalingMatrix3x3 SCALE(SFloat::_0_25, SFloat::_3, -SFloat::_1);
+    const TransformationMatrix<Matrix4x3> TRANSFORMATION(TRANSLATION, ROTATION, SCALE);
+
+    ArrayDynamic<Vector3> arPoints(POINTS_COUNT);
+
+    for(puint_z i = 0; i < POINTS_COUNT; ++i)
+        arPoints.Add(Vector3(scast_z(i % 1000U, float_z), scast_z(i % 7U, float_z), scast_z(i % 13U, float_z)));
+
+    CycleStopwatch measurer;
+
+    // Conversion
+    measurer.Set();
+    ArraySoA<float_z, 3U> soaPoints(arPoints);
+    const u64_z CONVERSION_TIME = measurer.GetElapsedTimeAsInteger();
+
+    // Array of structures
+    measurer.Set();
+
+    for(unsigned int i = 0; i < REPETITIONS; ++i)
+        SVectorArray::Transform(TRANSFORMATION, &arPoints[0], scast_z(POINTS_COUNT, unsigned int));
+
+    const u64_z AOS_TIME = measurer.GetElapsedTimeAsInteger();
+
+    // Structure of arrays
+    float_z* arX = soaPoints.GetColumn(0).GetData();
+    float_z* arY = soaPoints.GetColumn(1U).GetData();
+    float_z* arZ = soaPoints.GetColumn(2U).GetData();
+
+    measurer.Set();
+
+    for(unsigned int i = 0; i < REPETITIONS; ++i)
+        SVectorArray::Transform(TRANSFORMATION, arX, arY, arZ, scast_z(POINTS_COUNT, unsigned int));
+
+    const u64_z SOA_TIME = measurer.GetElapsedTimeAsInteger();
+
+    // Both layouts must contain the same points, except for rounding differences (in percentage)
+    const puint_z LAST = POINTS_COUNT - 1U;
+    BOOST_CHECK_CLOSE(arPoints[LAST].x, arX[LAST], 0.01f);
+    BOOST_CHECK_CLOSE(arPoints[LAST].y, arY[LAST], 0.01f);
+    BOOST_CHECK_CLOSE(arPoints[LAST].z, arZ[LAST], 0.01f);
+
+    BOOST_TEST_MESSAGE("ArrayDynamic<Vector3> to ArraySoA<float_z, 3>, " << POINTS_COUNT << " points: " << 
+                       scast_z(CONVERSION_TIME, double) / POINTS_COUNT << " ns per point");
+    BOOST_TEST_MESSAGE("Transform, array of structures, " << POINTS_COUNT << " points: " << 
+                       scast_z(AOS_TIME, double) / (POINTS_COUNT * REPETITIONS) << " ns per point");
+    BOOST_TEST_MESSAGE("Transform, structure of arrays, " << POINTS_COUNT << " points: " << 
+                       scast_z(SOA_TIME, double) / (POINTS_COUNT * REPETITIONS) << " ns per point");
+}
+
+// End - Test Suite: ArraySoA
+ZTEST_SUITE_END()
@@ -0,0 +1,170 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/Dictionary.h"
+#include "ZContainers/BTree.h"
+
+#include "ZContainers/BinarySearchTree.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( BTreeDictionary_PerformanceTestSuite )
+
+/// <summary>
+/// Number of key-value pairs added to the dictionaries in every measurement.
+/// </summary>
+static const puint_z ELEMENTS_COUNT = 1000000U;
+
+/// <summary>
+/// Number of key-value pairs added to the dictionaries when keys are added in ascending order, which is the worst case for binary search trees.
+/// </summary>
+static const puint_z SORTED_ELEMENTS_COUNT = 20000U;
+
+/// <summary>
+/// Number of key-value pairs removed from the dictionaries in every measurement, which is lower than the number of pairs since every removal from 
+/// a binary search tree takes a time that grows with the number of pairs.
+/// </summary>
+static const puint_z REMOVALS_COUNT = 10000U;
+
+/// <summary>
+/// Number of times the dictionaries are traversed in every measurement.
+/// </summary>
+static const puint_z ITERATIONS_COUNT = 10U;
+
+/// <summary>
+/// Generates the keys, which are either random or sorted.
+/// </summary>
+void GenerateKeys_TestMethod(u64_z* arKeys, const puint_z uCount, const bool bRandom)
+{
+    u64_z uRandom = 0x9E3779B97F4A7C15ULL;
+
+    for(puint_z i = 0; i < uCount; ++i)
+    {
+        uRandom ^= uRandom << 13U;
+        uRandom ^= uRandom >> 7U;
+        uRandom ^= uRandom << 17U;
+        arKeys[i] = bRandom ? uRandom : scast_z(i, u64_z);
+    }
+}
+
+/// <summary>
+/// Adds key-value pairs to a dictionary, searches for every key, traverses it in ascending order and removes some keys; then prints the average time per 
+/// key-value pair, in nanoseconds, of every operation.
+/// </summary>
+template<template<class, class, class> class TreeT>
+void MeasureDictionary_TestMethod(const puint_z uCount, const bool bRandomKeys, const char* szDescription)
+{
+    typedef Dictionary<u64_z, u64_z, PoolAllocator, SComparatorDefault<u64_z>, SComparatorDefault<u64_z>, TreeT> DictionaryT;
+
+    u64_z* arKeys = new u64_z[uCount];
+    GenerateKeys_TestMethod(arKeys, uCount, bRandomKeys);
+
+    DictionaryT dictionary;
+    u64_z uSum = 0;
+
+    // Add
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < uCount; ++i)
+        dictionary.Add(arKeys[i], arKeys[i]);
+
+    const double ADD_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / uCount;
+
+    // Lookup
+    measurer.Set();
+
+    for(puint_z i = 0; i < uCount; ++i)
+        uSum += dictionary.GetValue(arKeys[i]);
+
+    const double LOOKUP_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / uCount;
+
+    // In-order scan
+    measurer.Set();
+
+    for(puint_z uIteration = 0; uIteration < ITERATIONS_COUNT; ++uIteration)
+        for(typename DictionaryT::ConstDictionaryIterator it = dictionary.GetFirst(); !it.IsEnd(); ++it)
+            uSum += it->GetValue();
+
+    const double SCAN_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / (uCount * ITERATIONS_COUNT);
+
+    // Remove
+    measurer.Set();
+
+    const puint_z REMOVALS = uCount < REMOVALS_COUNT ? uCount : REMOVALS_COUNT;
+
+    for(puint_z i = 0; i < REMOVALS; ++i)
+        dictionary.Remove(arKeys[i]);
+
+    const double REMOVE_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / REMOVALS;
+
+    delete[] arKeys;
+
+    BOOST_TEST_MESSAGE(szDescription << ", " << uCount << (bRandomKeys ? " random" : " sorted") << " keys: Add " << ADD_TIME << " ns, lookup " << 
+                       LOOKUP_TIME << " ns, scan " << SCAN_TIME << " ns, remove " << REMOVE_TIME << " ns per key-value pair (" << uSum << ")");
+}
+
+/// <summary>
+/// Measures dictionaries that store random keys in a binary search tree, for comparison.
+/// </summary>
+ZTEST_CASE ( BinarySearchTree_MeasuresRandomKeys_Test )
+{
+    MeasureDictionary_TestMethod<BinarySearchTree>(ELEMENTS_COUNT, true, "BinarySearchTree");
+}
+
+/// <summary>
+/// Measures dictionaries that store random keys in a B-tree.
+/// </summary>
+ZTEST_CASE ( BTree_MeasuresRandomKeys_Test )
+{
+    MeasureDictionary_TestMethod<BTree>(ELEMENTS_COUNT, true, "BTree");
+}
+
+/// <summary>
+/// Measures dictionaries that store sorted keys in a binary search tree, for comparison.
+/// </summary>
+ZTEST_CASE ( BinarySearchTree_MeasuresSortedKeys_Test )
+{
+    MeasureDictionary_TestMethod<BinarySearchTree>(SORTED_ELEMENTS_COUNT, false, "BinarySearchTree");
+}
+
+/// <summary>
+/// Measures dictionaries that store sorted keys in a B-tree.
+/// </summary>
+ZTEST_CASE ( BTree_MeasuresSortedKeys_Test )
+{
+    MeasureDictionary_TestMethod<BTree>(SORTED_ELEMENTS_COUNT, false, "BTree");
+}
+
+// End - Test Suite: BTreeDictionary
+ZTEST_SUITE_END()
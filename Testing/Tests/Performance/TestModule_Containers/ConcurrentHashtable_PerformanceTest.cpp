@@ -0,0 +1,233 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/ConcurrentHashtable.h"
+
+#include "ZContainers/Hashtable.h"
+#include "ZThreading/SharedMutex.h"
+#include "ZThreading/ScopedSharedLock.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZThreading/Thread.h"
+#include "ZTiming/CycleStopwatch.h"
+#include <boost/atomic.hpp>
+
+
+ZTEST_SUITE_BEGIN( ConcurrentHashtable_PerformanceTestSuite )
+
+/// <summary>
+/// Number of operations every thread performs in every measurement.
+/// </summary>
+static const u64_z OPERATIONS_PER_THREAD = 100000U;
+
+/// <summary>
+/// Numbers of threads that use the hash table at the same time.
+/// </summary>
+static const unsigned int THREAD_COUNTS[] = { 1U, 2U, 4U, 8U, 16U, 32U };
+
+/// <summary>
+/// Number of different keys used in the measurements, all of them added before the threads start.
+/// </summary>
+static const u64_z KEY_COUNT = 65536U;
+
+/// <summary>
+/// Number of segments of the concurrent hash table.
+/// </summary>
+static const puint_z SEGMENT_COUNT = 64U;
+
+/// <summary>
+/// Number of buckets of the hash tables, distributed among the segments in the concurrent hash table.
+/// </summary>
+static const puint_z BUCKET_COUNT = 65536U;
+
+// A Hashtable protected by a SharedMutex, for comparison
+class LockedHashtable
+{
+public:
+
+    LockedHashtable() : m_table(BUCKET_COUNT, 1U)
+    {
+    }
+
+    bool TryGetValue(const u64_z uKey, u64_z &uValue) const
+    {
+        ScopedSharedLock<SharedMutex> sharedLock(m_mutex);
+        Hashtable<u64_z, u64_z>::ConstIterator itPair = m_table.PositionOfKey(uKey);
+        const bool bExists = !itPair.IsEnd();
+
+        if(bExists)
+            uValue = itPair->GetValue();
+
+        return bExists;
+    }
+
+    bool AddOrUpdate(const u64_z uKey, const u64_z uValue)
+    {
+        ScopedExclusiveLock<SharedMutex> exclusiveLock(m_mutex);
+        Hashtable<u64_z, u64_z>::ConstIterator itPair = m_table.PositionOfKey(uKey);
+        const bool bAdded = itPair.IsEnd();
+
+        if(bAdded)
+            m_table.Add(uKey, uValue);
+        else
+            ccast_z(itPair->GetValue(), u64_z&) = uValue;
+
+        return bAdded;
+    }
+
+private:
+
+    mutable SharedMutex m_mutex;
+    Hashtable<u64_z, u64_z> m_table;
+};
+
+typedef ConcurrentHashtable<u64_z, u64_z> ConcurrentHashtableType;
+
+// Class whose methods are executed by the threads
+class ConcurrentHashtablePerformanceTestClass
+{
+public:
+
+    static boost::atomic<u64_z> sm_uNextThread;
+    static u64_z sm_uWritesPerHundred;
+    static boost::atomic<u64_z> sm_uSink;
+
+    // Reads or replaces the values of random keys, writing the configured proportion of times
+    template<class HashtableT>
+    static void ReadOrWrite(HashtableT* pHashtable)
+    {
+        u64_z uRandom = (sm_uNextThread.fetch_add(1U) + 1U) * 0x9E3779B97F4A7C15ULL;
+        u64_z uSum = 0;
+
+        for(u64_z i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            // Xorshift
+            uRandom ^= uRandom << 13U;
+            uRandom ^= uRandom >> 7U;
+            uRandom ^= uRandom << 17U;
+
+            const u64_z KEY = uRandom % KEY_COUNT;
+            u64_z uValue = 0;
+
+            if((uRandom >> 32U) % 100U < sm_uWritesPerHundred)
+                pHashtable->AddOrUpdate(KEY, i);
+            else if(pHashtable->TryGetValue(KEY, uValue))
+                uSum += uValue;
+        }
+
+        sm_uSink.fetch_add(uSum);
+    }
+};
+
+boost::atomic<u64_z> ConcurrentHashtablePerformanceTestClass::sm_uNextThread(0);
+u64_z ConcurrentHashtablePerformanceTestClass::sm_uWritesPerHundred = 0;
+boost::atomic<u64_z> ConcurrentHashtablePerformanceTestClass::sm_uSink(0);
+
+/// <summary>
+/// Executes random reads and writes in several numbers of threads at the same time, using a new hash table every time, and prints the number 
+/// of operations per microsecond.
+/// </summary>
+template<class HashtableT>
+void MeasureThreads_TestMethod(HashtableT &hashtable, const u64_z uWritesPerHundred, const char* szDescription)
+{
+    Thread* arThreads[32];
+
+    for(u64_z uKey = 0; uKey < KEY_COUNT; ++uKey)
+        hashtable.AddOrUpdate(uKey, uKey);
+
+    ConcurrentHashtablePerformanceTestClass::sm_uWritesPerHundred = uWritesPerHundred;
+    Delegate<void(HashtableT*)> readOrWrite(&ConcurrentHashtablePerformanceTestClass::ReadOrWrite<HashtableT>);
+
+    for(unsigned int uThreads = 0; uThreads < sizeof(THREAD_COUNTS) / sizeof(unsigned int); ++uThreads)
+    {
+        const unsigned int THREAD_COUNT = THREAD_COUNTS[uThreads];
+        ConcurrentHashtablePerformanceTestClass::sm_uNextThread = 0;
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            arThreads[i] = new Thread(readOrWrite, &hashtable);
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            arThreads[i]->Join();
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            delete arThreads[i];
+
+        const double OPERATIONS_PER_MICROSECOND = scast_z(OPERATIONS_PER_THREAD * THREAD_COUNT, double) * 1000.0 / uElapsedNanoseconds;
+
+        BOOST_TEST_MESSAGE(szDescription << ", " << uWritesPerHundred << "% writes, " << THREAD_COUNT << " threads: " << 
+                           OPERATIONS_PER_MICROSECOND << " operations per microsecond");
+    }
+}
+
+/// <summary>
+/// Measures a read-heavy workload on a Hashtable protected by a SharedMutex, for comparison.
+/// </summary>
+ZTEST_CASE ( LockedHashtable_MeasuresReadHeavyWorkload_Test )
+{
+    LockedHashtable hashtable;
+    MeasureThreads_TestMethod(hashtable, 5U, "Hashtable + SharedMutex");
+}
+
+/// <summary>
+/// Measures a read-heavy workload on a ConcurrentHashtable.
+/// </summary>
+ZTEST_CASE ( ConcurrentHashtable_MeasuresReadHeavyWorkload_Test )
+{
+    ConcurrentHashtableType hashtable(SEGMENT_COUNT, BUCKET_COUNT / SEGMENT_COUNT, 1U);
+    MeasureThreads_TestMethod(hashtable, 5U, "ConcurrentHashtable");
+}
+
+/// <summary>
+/// Measures a write-heavy workload on a Hashtable protected by a SharedMutex, for comparison.
+/// </summary>
+ZTEST_CASE ( LockedHashtable_MeasuresWriteHeavyWorkload_Test )
+{
+    LockedHashtable hashtable;
+    MeasureThreads_TestMethod(hashtable, 50U, "Hashtable + SharedMutex");
+}
+
+/// <summary>
+/// Measures a write-heavy workload on a ConcurrentHashtable.
+/// </summary>
+ZTEST_CASE ( ConcurrentHashtable_MeasuresWriteHeavyWorkload_Test )
+{
+    ConcurrentHashtableType hashtable(SEGMENT_COUNT, BUCKET_COUNT / SEGMENT_COUNT, 1U);
+    MeasureThreads_TestMethod(hashtable, 50U, "ConcurrentHashtable");
+}
+
+// End - Test Suite: ConcurrentHashtable
+ZTEST_SUITE_END()
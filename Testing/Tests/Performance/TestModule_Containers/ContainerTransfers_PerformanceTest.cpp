@@ -0,0 +1,238 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/ArrayDynamic.h"
+#include "ZContainers/List.h"
+
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( ContainerTransfers_PerformanceTestSuite )
+
+/// <summary>
+/// Number of strings added to a container in every measurement.
+/// </summary>
+static const puint_z STRINGS_COUNT = 100000U;
+
+/// <summary>
+/// Number of strings stored in every array that is transferred to another container.
+/// </summary>
+static const puint_z STRINGS_PER_ARRAY = 1000U;
+
+/// <summary>
+/// Number of arrays transferred to another container in every measurement.
+/// </summary>
+static const puint_z ARRAYS_COUNT = 100U;
+
+/// <summary>
+/// Text of every string, long enough to not fit any small-string buffer.
+/// </summary>
+static const char* STRING_TEXT = "A string that is long enough to be stored in a buffer allocated in the heap";
+
+/// <summary>
+/// Prints the average time per operation, in nanoseconds.
+/// </summary>
+void PrintTimePerOperation_TestMethod(const CycleStopwatch &measurer, const puint_z uOperations, const char* szDescription)
+{
+    const double TIME_PER_OPERATION = scast_z(measurer.GetElapsedTimeAsInteger(), double) / uOperations;
+    BOOST_TEST_MESSAGE(szDescription << ": " << TIME_PER_OPERATION << " ns per operation");
+}
+
+/// <summary>
+/// Fills an array with copies of the same string.
+/// </summary>
+void FillStringArray_TestMethod(ArrayDynamic<string_z> &arStrings)
+{
+    for(puint_z i = 0; i < STRINGS_PER_ARRAY; ++i)
+        arStrings.Emplace(STRING_TEXT);
+}
+
+/// <summary>
+/// Measures adding strings created from a literal to an array, where a temporary string is constructed and then copied.
+/// </summary>
+ZTEST_CASE ( ArrayDynamicAdd_MeasuresAddingStringsFromLiterals_Test )
+{
+    ArrayDynamic<string_z> arStrings;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < STRINGS_COUNT; ++i)
+        arStrings.Add(string_z(STRING_TEXT));
+
+    PrintTimePerOperation_TestMethod(measurer, STRINGS_COUNT, "ArrayDynamic<string_z>::Add");
+}
+
+/// <summary>
+/// Measures constructing strings from a literal directly in an array.
+/// </summary>
+ZTEST_CASE ( ArrayDynamicEmplace_MeasuresAddingStringsFromLiterals_Test )
+{
+    ArrayDynamic<string_z> arStrings;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < STRINGS_COUNT; ++i)
+        arStrings.Emplace(STRING_TEXT);
+
+    PrintTimePerOperation_TestMethod(measurer, STRINGS_COUNT, "ArrayDynamic<string_z>::Emplace");
+}
+
+/// <summary>
+/// Measures adding strings created from a literal to a list, where a temporary string is constructed and then copied.
+/// </summary>
+ZTEST_CASE ( ListAdd_MeasuresAddingStringsFromLiterals_Test )
+{
+    List<string_z> strings;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < STRINGS_COUNT; ++i)
+        strings.Add(string_z(STRING_TEXT));
+
+    PrintTimePerOperation_TestMethod(measurer, STRINGS_COUNT, "List<string_z>::Add");
+}
+
+/// <summary>
+/// Measures constructing strings from a literal directly in a list.
+/// </summary>
+ZTEST_CASE ( ListEmplace_MeasuresAddingStringsFromLiterals_Test )
+{
+    List<string_z> strings;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < STRINGS_COUNT; ++i)
+        strings.Emplace(STRING_TEXT);
+
+    PrintTimePerOperation_TestMethod(measurer, STRINGS_COUNT, "List<string_z>::Emplace");
+}
+
+/// <summary>
+/// Measures adding arrays of strings to an array of arrays, which copies every string.
+/// </summary>
+ZTEST_CASE ( ArrayOfArraysAdd_MeasuresTransferringArraysOfStrings_Test )
+{
+    ArrayDynamic< ArrayDynamic<string_z> > arArrays;
+    CycleStopwatch measurer;
+    u64_z uElapsedNanoseconds = 0;
+
+    for(puint_z i = 0; i < ARRAYS_COUNT; ++i)
+    {
+        ArrayDynamic<string_z> arStrings;
+        FillStringArray_TestMethod(arStrings);
+
+        measurer.Set();
+        arArrays.Add(arStrings);
+        uElapsedNanoseconds += measurer.GetElapsedTimeAsInteger();
+    }
+
+    BOOST_TEST_MESSAGE("ArrayDynamic<ArrayDynamic<string_z> >::Add, arrays of " << STRINGS_PER_ARRAY << " strings: " << 
+                       scast_z(uElapsedNanoseconds, double) / ARRAYS_COUNT << " ns per operation");
+}
+
+/// <summary>
+/// Measures transferring arrays of strings to an array of arrays by constructing an empty array in place and swapping it, which copies no string.
+/// </summary>
+ZTEST_CASE ( ArrayOfArraysEmplaceAndSwap_MeasuresTransferringArraysOfStrings_Test )
+{
+    ArrayDynamic< ArrayDynamic<string_z> > arArrays;
+    CycleStopwatch measurer;
+    u64_z uElapsedNanoseconds = 0;
+
+    for(puint_z i = 0; i < ARRAYS_COUNT; ++i)
+    {
+        ArrayDynamic<string_z> arStrings;
+        FillStringArray_TestMethod(arStrings);
+
+        measurer.Set();
+        arArrays.Emplace();
+        arArrays[arArrays.GetCount() - 1U].Swap(arStrings);
+        uElapsedNanoseconds += measurer.GetElapsedTimeAsInteger();
+    }
+
+    BOOST_TEST_MESSAGE("ArrayDynamic<ArrayDynamic<string_z> >::Emplace + Swap, arrays of " << STRINGS_PER_ARRAY << " strings: " << 
+                       scast_z(uElapsedNanoseconds, double) / ARRAYS_COUNT << " ns per operation");
+}
+
+/// <summary>
+/// Measures replacing the content of an array of strings with the content of another through the assignment operator.
+/// </summary>
+ZTEST_CASE ( ArrayDynamicAssignment_MeasuresReplacingArraysOfStrings_Test )
+{
+    ArrayDynamic<string_z> arDestination;
+    CycleStopwatch measurer;
+    u64_z uElapsedNanoseconds = 0;
+
+    for(puint_z i = 0; i < ARRAYS_COUNT; ++i)
+    {
+        ArrayDynamic<string_z> arSource;
+        FillStringArray_TestMethod(arSource);
+
+        measurer.Set();
+        arDestination = arSource;
+        uElapsedNanoseconds += measurer.GetElapsedTimeAsInteger();
+    }
+
+    BOOST_TEST_MESSAGE("ArrayDynamic<string_z>::operator=, arrays of " << STRINGS_PER_ARRAY << " strings: " << 
+                       scast_z(uElapsedNanoseconds, double) / ARRAYS_COUNT << " ns per operation");
+}
+
+/// <summary>
+/// Measures replacing the content of an array of strings with the content of another through Swap.
+/// </summary>
+ZTEST_CASE ( ArrayDynamicSwap_MeasuresReplacingArraysOfStrings_Test )
+{
+    ArrayDynamic<string_z> arDestination;
+    CycleStopwatch measurer;
+    u64_z uElapsedNanoseconds = 0;
+
+    for(puint_z i = 0; i < ARRAYS_COUNT; ++i)
+    {
+        ArrayDynamic<string_z> arSource;
+        FillStringArray_TestMethod(arSource);
+
+        measurer.Set();
+        arDestination.Swap(arSource);
+        uElapsedNanoseconds += measurer.GetElapsedTimeAsInteger();
+    }
+
+    BOOST_TEST_MESSAGE("ArrayDynamic<string_z>::Swap, arrays of " << STRINGS_PER_ARRAY << " strings: " << 
+                       scast_z(uElapsedNanoseconds, double) / ARRAYS_COUNT << " ns per operation");
+}
+
+// End - Test Suite: ContainerTransfers
+ZTEST_SUITE_END()
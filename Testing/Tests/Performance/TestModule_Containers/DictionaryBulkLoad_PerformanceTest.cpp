@@ -0,0 +1,203 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/Dictionary.h"
+#include "ZContainers/BTree.h"
+
+#include "ZContainers/BinarySearchTree.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( DictionaryBulkLoad_PerformanceTestSuite )
+
+/// <summary>
+/// Number of key-value pairs loaded into the dictionaries in every measurement.
+/// </summary>
+static const puint_z ELEMENTS_COUNT = 1000000U;
+
+/// <summary>
+/// Number of threads that sort the keys when they are loaded in parallel.
+/// </summary>
+static const puint_z THREADS_COUNT = 4U;
+
+/// <summary>
+/// Generates random keys.
+/// </summary>
+void GenerateRandomKeys_TestMethod(u64_z* arKeys, const puint_z uCount, const u64_z uSeed)
+{
+    u64_z uRandom = uSeed;
+
+    for(puint_z i = 0; i < uCount; ++i)
+    {
+        uRandom ^= uRandom << 13U;
+        uRandom ^= uRandom >> 7U;
+        uRandom ^= uRandom << 17U;
+        arKeys[i] = uRandom;
+    }
+}
+
+/// <summary>
+/// Loads the same key-value pairs into dictionaries by adding them one by one, by building them from unsorted keys in one and several threads 
+/// and by building them from sorted keys; then prints the average time per key-value pair, in nanoseconds, of every method.
+/// </summary>
+template<template<class, class, class> class TreeT>
+void MeasureLoad_TestMethod(const char* szDescription)
+{
+    typedef Dictionary<u64_z, u64_z, PoolAllocator, SComparatorDefault<u64_z>, SComparatorDefault<u64_z>, TreeT> DictionaryT;
+
+    u64_z* arKeys = new u64_z[ELEMENTS_COUNT];
+    GenerateRandomKeys_TestMethod(arKeys, ELEMENTS_COUNT, 0x9E3779B97F4A7C15ULL);
+    u64_z uSum = 0;
+
+    // Add, random order
+    CycleStopwatch measurer;
+    measurer.Set();
+    {
+        DictionaryT dictionary;
+
+        for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+            dictionary.Add(arKeys[i], arKeys[i]);
+
+        uSum += dictionary.GetCount();
+    }
+    const double ADD_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / ELEMENTS_COUNT;
+
+    // FromUnsorted, 1 thread
+    measurer.Set();
+    {
+        DictionaryT dictionary = DictionaryT::FromUnsorted(arKeys, arKeys, ELEMENTS_COUNT, 1U);
+        uSum += dictionary.GetCount();
+    }
+    const double UNSORTED_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / ELEMENTS_COUNT;
+
+    // FromUnsorted, several threads
+    measurer.Set();
+    {
+        DictionaryT dictionary = DictionaryT::FromUnsorted(arKeys, arKeys, ELEMENTS_COUNT, THREADS_COUNT);
+        uSum += dictionary.GetCount();
+    }
+    const double PARALLEL_UNSORTED_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / ELEMENTS_COUNT;
+
+    // FromSorted
+    for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+        arKeys[i] = scast_z(i, u64_z);
+
+    measurer.Set();
+    {
+        DictionaryT dictionary = DictionaryT::FromSorted(arKeys, arKeys, ELEMENTS_COUNT);
+        uSum += dictionary.GetCount();
+    }
+    const double SORTED_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / ELEMENTS_COUNT;
+
+    delete[] arKeys;
+
+    BOOST_TEST_MESSAGE(szDescription << ", " << ELEMENTS_COUNT << " keys: Add (random order) " << ADD_TIME << " ns, FromUnsorted (1 thread) " << 
+                       UNSORTED_TIME << " ns, FromUnsorted (" << THREADS_COUNT << " threads) " << PARALLEL_UNSORTED_TIME << " ns, FromSorted " << 
+                       SORTED_TIME << " ns per key-value pair (" << uSum << ")");
+}
+
+/// <summary>
+/// Adds the key-value pairs of a dictionary to another of the same size, one by one and merging them; then prints the average time per 
+/// key-value pair of the result, in nanoseconds, of every method.
+/// </summary>
+template<template<class, class, class> class TreeT>
+void MeasureMerge_TestMethod(const char* szDescription)
+{
+    typedef Dictionary<u64_z, u64_z, PoolAllocator, SComparatorDefault<u64_z>, SComparatorDefault<u64_z>, TreeT> DictionaryT;
+
+    const puint_z HALF_COUNT = ELEMENTS_COUNT / 2U;
+    u64_z* arKeys = new u64_z[ELEMENTS_COUNT];
+    GenerateRandomKeys_TestMethod(arKeys, ELEMENTS_COUNT, 0x2545F4914F6CDD1DULL);
+
+    const DictionaryT DICTIONARY1 = DictionaryT::FromUnsorted(arKeys, arKeys, HALF_COUNT, 1U);
+    const DictionaryT DICTIONARY2 = DictionaryT::FromUnsorted(arKeys + HALF_COUNT, arKeys + HALF_COUNT, ELEMENTS_COUNT - HALF_COUNT, 1U);
+    delete[] arKeys;
+
+    // Add
+    DictionaryT dictionary = DICTIONARY1;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(typename DictionaryT::ConstDictionaryIterator it = DICTIONARY2.GetFirst(); !it.IsEnd(); ++it)
+        dictionary.Add(it->GetKey(), it->GetValue());
+
+    const double ADD_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / dictionary.GetCount();
+
+    // MergeFrom
+    DictionaryT mergedDictionary = DICTIONARY1;
+
+    measurer.Set();
+
+    mergedDictionary.MergeFrom(DICTIONARY2);
+
+    const double MERGE_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / mergedDictionary.GetCount();
+
+    BOOST_TEST_MESSAGE(szDescription << ", 2 x " << HALF_COUNT << " keys: Add " << ADD_TIME << " ns, MergeFrom " << MERGE_TIME << 
+                       " ns per key-value pair (" << (dictionary == mergedDictionary) << ")");
+}
+
+/// <summary>
+/// Measures the loading of dictionaries that use a binary search tree.
+/// </summary>
+ZTEST_CASE ( BinarySearchTree_MeasuresLoad_Test )
+{
+    MeasureLoad_TestMethod<BinarySearchTree>("BinarySearchTree");
+}
+
+/// <summary>
+/// Measures the loading of dictionaries that use a B-tree.
+/// </summary>
+ZTEST_CASE ( BTree_MeasuresLoad_Test )
+{
+    MeasureLoad_TestMethod<BTree>("BTree");
+}
+
+/// <summary>
+/// Measures the merging of dictionaries that use a binary search tree.
+/// </summary>
+ZTEST_CASE ( BinarySearchTree_MeasuresMerge_Test )
+{
+    MeasureMerge_TestMethod<BinarySearchTree>("BinarySearchTree");
+}
+
+/// <summary>
+/// Measures the merging of dictionaries that use a B-tree.
+/// </summary>
+ZTEST_CASE ( BTree_MeasuresMerge_Test )
+{
+    MeasureMerge_TestMethod<BTree>("BTree");
+}
+
+// End - Test Suite: DictionaryBulkLoad
+ZTEST_SUITE_END()
@@ -0,0 +1,316 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/EventConcurrent.h"
+#include "ZContainers/EventAsync.h"
+
+#include "ZContainers/Event.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZTiming/CycleStopwatch.h"
+#include <boost/atomic.hpp>
+
+
+ZTEST_SUITE_BEGIN( Event_PerformanceTestSuite )
+
+/// <summary>
+/// Number of times every raising thread raises the event in every measurement.
+/// </summary>
+static const unsigned int RAISES_PER_THREAD = 100000U;
+
+/// <summary>
+/// Numbers of threads that raise the event at the same time.
+/// </summary>
+static const unsigned int THREAD_COUNTS[] = { 1U, 2U, 4U };
+
+// Adapts an event protected by a mutex, which is the alternative to EventConcurrent, to the interface of EventConcurrent
+class EventWithMutex
+{
+public:
+
+    typedef Event<void(int)>::Subscriber Subscriber;
+
+    void Raise(int p1)
+    {
+        ScopedExclusiveLock<> lock(m_mutex);
+        m_event.Raise(p1);
+    }
+
+    void operator+=(const Subscriber &subscriber)
+    {
+        ScopedExclusiveLock<> lock(m_mutex);
+        m_event += subscriber;
+    }
+
+    void operator-=(const Subscriber &subscriber)
+    {
+        ScopedExclusiveLock<> lock(m_mutex);
+        m_event -= subscriber;
+    }
+
+private:
+
+    Event<void(int)> m_event;
+    Mutex m_mutex;
+};
+
+// Class whose methods are executed by the threads and subscribed to the events
+template<class EventT>
+class EventTestClass
+{
+public:
+
+    static EventT* sm_pEvent;
+    static boost::atomic<bool> sm_bStop;
+    static volatile int sm_nSharedResource;
+
+    static void Subscriber1(int p1) { sm_nSharedResource = p1; }
+    static void Subscriber2(int p1) { sm_nSharedResource = p1 + 1; }
+    static void Subscriber3(int p1) { sm_nSharedResource = p1 + 2; }
+    static void TransientSubscriber(int p1) { sm_nSharedResource = p1 + 3; }
+
+    static void RaiseMany()
+    {
+        for(unsigned int i = 0; i < RAISES_PER_THREAD; ++i)
+            sm_pEvent->Raise(scast_z(i, int));
+    }
+
+    // Subscribes and unsubscribes a function until it is told to stop
+    static void SubscribeAndUnsubscribe()
+    {
+        while(!sm_bStop.load())
+        {
+            *sm_pEvent += &EventTestClass::TransientSubscriber;
+            *sm_pEvent -= &EventTestClass::TransientSubscriber;
+        }
+    }
+};
+
+template<class EventT>
+EventT* EventTestClass<EventT>::sm_pEvent = null_z;
+
+template<class EventT>
+boost::atomic<bool> EventTestClass<EventT>::sm_bStop(false);
+
+template<class EventT>
+volatile int EventTestClass<EventT>::sm_nSharedResource = 0;
+
+/// <summary>
+/// Measures the average time per raise for every number of raising threads, optionally with a thread that subscribes and unsubscribes a function continuously.
+/// </summary>
+template<class EventT>
+void MeasureRaise_TestMethod(const char* szDescription, const bool bChangeSubscribers)
+{
+    typedef EventTestClass<EventT> TestClass;
+
+    EventT event;
+    event += &TestClass::Subscriber1;
+    event += &TestClass::Subscriber2;
+    event += &TestClass::Subscriber3;
+    TestClass::sm_pEvent = &event;
+
+    for(unsigned int uThreads = 0; uThreads < sizeof(THREAD_COUNTS) / sizeof(unsigned int); ++uThreads)
+    {
+        Thread* arThreads[4];
+        Thread* pChangingThread = null_z;
+        TestClass::sm_bStop = false;
+
+        if(bChangeSubscribers)
+            pChangingThread = new Thread(Delegate<void()>(&TestClass::SubscribeAndUnsubscribe));
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        for(unsigned int i = 0; i < THREAD_COUNTS[uThreads]; ++i)
+            arThreads[i] = new Thread(Delegate<void()>(&TestClass::RaiseMany));
+
+        for(unsigned int i = 0; i < THREAD_COUNTS[uThreads]; ++i)
+            arThreads[i]->Join();
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+        TestClass::sm_bStop = true;
+
+        if(bChangeSubscribers)
+        {
+            pChangingThread->Join();
+            delete pChangingThread;
+        }
+
+        for(unsigned int i = 0; i < THREAD_COUNTS[uThreads]; ++i)
+            delete arThreads[i];
+
+        BOOST_TEST_MESSAGE(szDescription << (bChangeSubscribers ? ", changing subscribers, " : ", ") << THREAD_COUNTS[uThreads] << " threads: " << 
+                           scast_z(uElapsedNanoseconds, double) / (RAISES_PER_THREAD * THREAD_COUNTS[uThreads]) << " ns per raise");
+    }
+}
+
+/// <summary>
+/// Measures the thread-safe event.
+/// </summary>
+ZTEST_CASE ( EventConcurrent_MeasuresRaiseWithoutChangesInSubscribers_Test )
+{
+    MeasureRaise_TestMethod< EventConcurrent<void(int)> >("EventConcurrent", false);
+}
+
+/// <summary>
+/// Measures an event protected by a mutex, for comparison.
+/// </summary>
+ZTEST_CASE ( EventWithMutex_MeasuresRaiseWithoutChangesInSubscribers_Test )
+{
+    MeasureRaise_TestMethod<EventWithMutex>("Event with mutex", false);
+}
+
+/// <summary>
+/// Measures the thread-safe event while another thread subscribes and unsubscribes functions.
+/// </summary>
+ZTEST_CASE ( EventConcurrent_MeasuresRaiseWhileSubscribersChange_Test )
+{
+    MeasureRaise_TestMethod< EventConcurrent<void(int)> >("EventConcurrent", true);
+}
+
+/// <summary>
+/// Measures an event protected by a mutex while another thread subscribes and unsubscribes functions, for comparison.
+/// </summary>
+ZTEST_CASE ( EventWithMutex_MeasuresRaiseWhileSubscribersChange_Test )
+{
+    MeasureRaise_TestMethod<EventWithMutex>("Event with mutex", true);
+}
+
+/// <summary>
+/// Number of raises in every measurement of asynchronous events.
+/// </summary>
+static const unsigned int ASYNC_RAISE_COUNT = 200000U;
+
+/// <summary>
+/// Capacity of the queue of asynchronous events.
+/// </summary>
+static const puint_z ASYNC_QUEUE_CAPACITY = 1024U;
+
+/// <summary>
+/// Number of iterations of the work done by the subscriber of asynchronous events.
+/// </summary>
+static const unsigned int SUBSCRIBER_WORK_LENGTH = 50U;
+
+// Subscriber that simulates some work
+void DoSubscriberWork(int p1)
+{
+    static volatile int nSharedResource = 0;
+
+    for(unsigned int i = 0; i < SUBSCRIBER_WORK_LENGTH; ++i)
+        nSharedResource = nSharedResource * 31 + p1;
+}
+
+/// <summary>
+/// Measures the time the raising thread spends per raise and the total time per raise until all of them have been dispatched.
+/// </summary>
+template<class EventT>
+void MeasureAsyncRaise_TestMethod(const char* szDescription, EventT &event)
+{
+    event += &DoSubscriberWork;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(unsigned int i = 0; i < ASYNC_RAISE_COUNT; ++i)
+        event.Raise(scast_z(i, int));
+
+    u64_z uProducerNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    event.Flush();
+
+    u64_z uTotalNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    BOOST_TEST_MESSAGE(szDescription << ": " << scast_z(uProducerNanoseconds, double) / ASYNC_RAISE_COUNT << " ns per raise in the raising thread, " << 
+                       scast_z(uTotalNanoseconds, double) / ASYNC_RAISE_COUNT << " ns per raise until dispatched, " << 
+                       event.GetDiscardedCount() << " discarded");
+}
+
+/// <summary>
+/// Measures a synchronous event with the same subscriber, for comparison.
+/// </summary>
+ZTEST_CASE ( Event_MeasuresSynchronousRaiseWithSlowSubscriber_Test )
+{
+    Event<void(int)> event;
+    event += &DoSubscriberWork;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(unsigned int i = 0; i < ASYNC_RAISE_COUNT; ++i)
+        event.Raise(scast_z(i, int));
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    BOOST_TEST_MESSAGE("Event: " << scast_z(uElapsedNanoseconds, double) / ASYNC_RAISE_COUNT << " ns per raise");
+}
+
+/// <summary>
+/// Measures the asynchronous event without batches.
+/// </summary>
+ZTEST_CASE ( EventAsync_MeasuresRaiseWithoutBatches_Test )
+{
+    EventAsync<void(int)> event(ASYNC_QUEUE_CAPACITY, EQueueFullPolicy::E_Block, 1U);
+    MeasureAsyncRaise_TestMethod("EventAsync, batches of 1", event);
+}
+
+/// <summary>
+/// Measures the asynchronous event with batches.
+/// </summary>
+ZTEST_CASE ( EventAsync_MeasuresRaiseWithBatches_Test )
+{
+    EventAsync<void(int)> event(ASYNC_QUEUE_CAPACITY, EQueueFullPolicy::E_Block, 32U);
+    MeasureAsyncRaise_TestMethod("EventAsync, batches of 32", event);
+}
+
+/// <summary>
+/// Measures the asynchronous event when pending raises are coalesced.
+/// </summary>
+ZTEST_CASE ( EventAsync_MeasuresRaiseWithCoalescing_Test )
+{
+    EventAsync<void(int)> event(ASYNC_QUEUE_CAPACITY, EQueueFullPolicy::E_Block, 32U, true);
+    MeasureAsyncRaise_TestMethod("EventAsync, coalescing", event);
+}
+
+/// <summary>
+/// Measures the asynchronous event when new raises are discarded if the queue is full.
+/// </summary>
+ZTEST_CASE ( EventAsync_MeasuresRaiseWhenNewestRaisesAreDiscarded_Test )
+{
+    EventAsync<void(int)> event(ASYNC_QUEUE_CAPACITY, EQueueFullPolicy::E_DiscardNewest, 32U);
+    MeasureAsyncRaise_TestMethod("EventAsync, discarding newest", event);
+}
+
+// End - Test Suite: Event
+ZTEST_SUITE_END()
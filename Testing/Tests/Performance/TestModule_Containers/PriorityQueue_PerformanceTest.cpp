@@ -0,0 +1,252 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/PriorityQueue.h"
+#include "ZContainers/IndexedPriorityQueue.h"
+#include "ZContainers/ArrayDynamic.h"
+
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( PriorityQueue_PerformanceTestSuite )
+
+/// <summary>
+/// Number of elements stored in every queue.
+/// </summary>
+static const puint_z ELEMENTS_COUNT = 1000000U;
+
+/// <summary>
+/// Number of elements added to and removed from the sorted array, which is smaller because every insertion moves half the array on average.
+/// </summary>
+static const puint_z SORTED_ARRAY_OPERATIONS_COUNT = 10000U;
+
+/// <summary>
+/// Generates a sequence of pseudo-random keys.
+/// </summary>
+void GenerateRandomKeys_TestMethod(u64_z* arKeys, const puint_z uCount)
+{
+    u64_z uRandom = 0x9E3779B97F4A7C15ULL;
+
+    for(puint_z i = 0; i < uCount; ++i)
+    {
+        uRandom ^= uRandom << 13U;
+        uRandom ^= uRandom >> 7U;
+        uRandom ^= uRandom << 17U;
+        arKeys[i] = uRandom;
+    }
+}
+
+/// <summary>
+/// Prints the average time per operation, in nanoseconds.
+/// </summary>
+void PrintResults_TestMethod(const char* szDescription, const u64_z uPushTime, const u64_z uPopTime, const puint_z uOperations, const u64_z uSum)
+{
+    BOOST_TEST_MESSAGE(szDescription << ", " << ELEMENTS_COUNT << " elements: Push " << scast_z(uPushTime, double) / uOperations << 
+                       " ns, pop " << scast_z(uPopTime, double) / uOperations << " ns per element (" << uSum << ")");
+}
+
+/// <summary>
+/// Measures a heap whose nodes have the given number of children, adding the elements one by one and then extracting all of them.
+/// </summary>
+template<unsigned int ARITY>
+void MeasurePushAndPop_TestMethod(const char* szDescription)
+{
+    u64_z* arKeys = new u64_z[ELEMENTS_COUNT];
+    GenerateRandomKeys_TestMethod(arKeys, ELEMENTS_COUNT);
+    PriorityQueue<u64_z, ContiguousAllocator, SComparatorDefault<u64_z>, ARITY> queue;
+    u64_z uSum = 0;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+        queue.Push(arKeys[i]);
+
+    const u64_z PUSH_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    while(!queue.IsEmpty())
+    {
+        uSum += queue.GetTop() >> 32U;
+        queue.Pop();
+    }
+
+    const u64_z POP_TIME = measurer.GetElapsedTimeAsInteger();
+
+    PrintResults_TestMethod(szDescription, PUSH_TIME, POP_TIME, ELEMENTS_COUNT, uSum);
+
+    delete[] arKeys;
+}
+
+/// <summary>
+/// Measures a 4-ary heap.
+/// </summary>
+ZTEST_CASE ( PriorityQueue_MeasuresPushAndPop_Test )
+{
+    MeasurePushAndPop_TestMethod<4U>("PriorityQueue, 4-ary heap");
+}
+
+/// <summary>
+/// Measures a binary heap, for comparison.
+/// </summary>
+ZTEST_CASE ( PriorityQueueBinary_MeasuresPushAndPop_Test )
+{
+    MeasurePushAndPop_TestMethod<2U>("PriorityQueue, binary heap");
+}
+
+/// <summary>
+/// Measures building a heap from a sequence at once, which takes linear time, compared to adding the elements one by one.
+/// </summary>
+ZTEST_CASE ( PriorityQueue_MeasuresBulkConstruction_Test )
+{
+    u64_z* arKeys = new u64_z[ELEMENTS_COUNT];
+    GenerateRandomKeys_TestMethod(arKeys, ELEMENTS_COUNT);
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    PriorityQueue<u64_z> heapifiedQueue(arKeys, ELEMENTS_COUNT);
+
+    const u64_z HEAPIFY_TIME = measurer.GetElapsedTimeAsInteger();
+    PriorityQueue<u64_z> pushedQueue(ELEMENTS_COUNT);
+    measurer.Set();
+
+    for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+        pushedQueue.Push(arKeys[i]);
+
+    const u64_z PUSH_TIME = measurer.GetElapsedTimeAsInteger();
+
+    BOOST_TEST_MESSAGE("PriorityQueue, " << ELEMENTS_COUNT << " elements: Construction from sequence " << scast_z(HEAPIFY_TIME, double) / ELEMENTS_COUNT << 
+                       " ns, Push one by one " << scast_z(PUSH_TIME, double) / ELEMENTS_COUNT << " ns per element (" << 
+                       heapifiedQueue.GetTop() + pushedQueue.GetTop() << ")");
+
+    delete[] arKeys;
+}
+
+/// <summary>
+/// Measures an indexed queue, adding the elements one by one, decreasing all of them through their handles and then extracting all of them.
+/// </summary>
+ZTEST_CASE ( IndexedPriorityQueue_MeasuresPushUpdateAndPop_Test )
+{
+    u64_z* arKeys = new u64_z[ELEMENTS_COUNT];
+    GenerateRandomKeys_TestMethod(arKeys, ELEMENTS_COUNT);
+    IndexedPriorityQueue<u64_z>::Handle* arHandles = new IndexedPriorityQueue<u64_z>::Handle[ELEMENTS_COUNT];
+    IndexedPriorityQueue<u64_z> queue;
+    u64_z uSum = 0;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+        arHandles[i] = queue.Push(arKeys[i]);
+
+    const u64_z PUSH_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+        queue.Update(arHandles[i], arKeys[i] >> 1U);
+
+    const u64_z UPDATE_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    while(!queue.IsEmpty())
+    {
+        uSum += queue.GetTop() >> 32U;
+        queue.Pop();
+    }
+
+    const u64_z POP_TIME = measurer.GetElapsedTimeAsInteger();
+
+    BOOST_TEST_MESSAGE("IndexedPriorityQueue, " << ELEMENTS_COUNT << " elements: Update " << scast_z(UPDATE_TIME, double) / ELEMENTS_COUNT << " ns per element");
+    PrintResults_TestMethod("IndexedPriorityQueue, 4-ary heap", PUSH_TIME, POP_TIME, ELEMENTS_COUNT, uSum);
+
+    delete[] arHandles;
+    delete[] arKeys;
+}
+
+/// <summary>
+/// Measures an array kept sorted in descending order, so the lowest element is the last one, for comparison. Elements are added at the position 
+/// found by a binary search and the array contains about the same number of elements as the queues.
+/// </summary>
+ZTEST_CASE ( SortedArrayDynamic_MeasuresPushAndPop_Test )
+{
+    static const u64_z KEY_INTERVAL = 0xFFFFFFFFFFFFFFFFULL / ELEMENTS_COUNT;
+
+    u64_z* arKeys = new u64_z[SORTED_ARRAY_OPERATIONS_COUNT];
+    GenerateRandomKeys_TestMethod(arKeys, SORTED_ARRAY_OPERATIONS_COUNT);
+    ArrayDynamic<u64_z> arSortedKeys(ELEMENTS_COUNT + SORTED_ARRAY_OPERATIONS_COUNT);
+    u64_z uSum = 0;
+
+    for(puint_z i = 0; i < ELEMENTS_COUNT; ++i)
+        arSortedKeys.Add((ELEMENTS_COUNT - i) * KEY_INTERVAL);
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < SORTED_ARRAY_OPERATIONS_COUNT; ++i)
+    {
+        puint_z uFirst = 0;
+        puint_z uLast = arSortedKeys.GetCount();
+
+        while(uFirst < uLast)
+        {
+            const puint_z MIDDLE = uFirst + (uLast - uFirst) / 2U;
+
+            if(arSortedKeys[MIDDLE] > arKeys[i])
+                uFirst = MIDDLE + 1U;
+            else
+                uLast = MIDDLE;
+        }
+
+        arSortedKeys.Insert(arKeys[i], uFirst);
+    }
+
+    const u64_z PUSH_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(puint_z i = 0; i < SORTED_ARRAY_OPERATIONS_COUNT; ++i)
+    {
+        const puint_z LAST_POSITION = arSortedKeys.GetCount() - 1U;
+        uSum += arSortedKeys[LAST_POSITION] >> 32U;
+        arSortedKeys.Remove(LAST_POSITION);
+    }
+
+    const u64_z POP_TIME = measurer.GetElapsedTimeAsInteger();
+
+    PrintResults_TestMethod("Sorted ArrayDynamic", PUSH_TIME, POP_TIME, SORTED_ARRAY_OPERATIONS_COUNT, uSum);
+
+    delete[] arKeys;
+}
+
+// End - Test Suite: PriorityQueue
+ZTEST_SUITE_END()
@@ -0,0 +1,363 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/QueueMpmc.h"
+#include "ZContainers/QueueSpsc.h"
+#include "ZContainers/QueueBlocking.h"
+
+#include "ZContainers/ArrayDynamic.h"
+#include "ZContainers/List.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/ConditionVariable.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZTiming/CycleStopwatch.h"
+#include <boost/atomic.hpp>
+
+
+ZTEST_SUITE_BEGIN( Queue_PerformanceTestSuite )
+
+/// <summary>
+/// Number of elements that pass through the queue in every measurement, distributed among the producers.
+/// </summary>
+static const u64_z ELEMENTS_COUNT = 192000U;
+
+/// <summary>
+/// Capacity of every queue.
+/// </summary>
+static const puint_z QUEUE_CAPACITY = 1024U;
+
+/// <summary>
+/// Number of elements added or extracted at once in the tests of batch operations.
+/// </summary>
+static const puint_z BATCH_SIZE = 16U;
+
+/// <summary>
+/// Numbers of producers (and of consumers) used in the tests with several threads.
+/// </summary>
+static const puint_z THREAD_COUNTS[] = { 1U, 2U, 4U, 8U, 16U, 32U };
+
+// Bounded queue implemented the way cross-thread hand-offs were written before lock-free queues existed: a List protected by a mutex 
+// and two condition variables
+class MutexListQueue
+{
+public:
+
+    explicit MutexListQueue(const puint_z uCapacity) : m_list(uCapacity),
+                                                       m_uCapacity(uCapacity)
+    {
+    }
+
+    void Enqueue(const u64_z &uElement)
+    {
+        {
+            ScopedExclusiveLock<> lock(m_mutex);
+
+            while(m_list.GetCount() == m_uCapacity)
+                m_notFull.Wait(lock);
+
+            m_list.Add(uElement);
+        }
+
+        m_notEmpty.NotifyOne();
+    }
+
+    void Dequeue(u64_z &uElement)
+    {
+        {
+            ScopedExclusiveLock<> lock(m_mutex);
+
+            while(m_list.IsEmpty())
+                m_notEmpty.Wait(lock);
+
+            uElement = m_list[0];
+            m_list.Remove(0U);
+        }
+
+        m_notFull.NotifyOne();
+    }
+
+private:
+
+    List<u64_z> m_list;
+    const puint_z m_uCapacity;
+    Mutex m_mutex;
+    ConditionVariable m_notFull;
+    ConditionVariable m_notEmpty;
+};
+
+// Class whose methods are executed by the producers and consumers
+template<class QueueT>
+class QueueTestClass
+{
+public:
+
+    static u64_z sm_uElementsPerThread;
+    static boost::atomic<u64_z> sm_uSum;
+
+    static void ProduceSpinning(QueueT* pQueue)
+    {
+        for(u64_z uValue = 1U; uValue <= sm_uElementsPerThread; ++uValue)
+        {
+            while(!pQueue->TryEnqueue(uValue))
+                SThisThread::Yield();
+        }
+    }
+
+    static void ConsumeSpinning(QueueT* pQueue)
+    {
+        u64_z uSum = 0;
+        u64_z uValue = 0;
+
+        for(u64_z i = 0; i < sm_uElementsPerThread; ++i)
+        {
+            while(!pQueue->TryDequeue(uValue))
+                SThisThread::Yield();
+
+            uSum += uValue;
+        }
+
+        sm_uSum.fetch_add(uSum);
+    }
+
+    static void ProduceBatchSpinning(QueueT* pQueue)
+    {
+        u64_z arBatch[BATCH_SIZE];
+        u64_z uValue = 1U;
+
+        while(uValue <= sm_uElementsPerThread)
+        {
+            puint_z uCount = 0;
+
+            for(; uCount < BATCH_SIZE && uValue + uCount <= sm_uElementsPerThread; ++uCount)
+                arBatch[uCount] = uValue + uCount;
+
+            for(puint_z uAdded = 0; uAdded < uCount; )
+            {
+                const puint_z ADDED_NOW = pQueue->TryEnqueue(arBatch + uAdded, uCount - uAdded);
+
+                if(ADDED_NOW == 0)
+                    SThisThread::Yield();
+
+                uAdded += ADDED_NOW;
+            }
+
+            uValue += uCount;
+        }
+    }
+
+    static void ConsumeBatchSpinning(QueueT* pQueue)
+    {
+        u64_z arBatch[BATCH_SIZE];
+        u64_z uSum = 0;
+        u64_z uExtracted = 0;
+
+        while(uExtracted < sm_uElementsPerThread)
+        {
+            const u64_z PENDING = sm_uElementsPerThread - uExtracted;
+            const puint_z EXTRACTED_NOW = pQueue->TryDequeue(arBatch, PENDING < BATCH_SIZE ? scast_z(PENDING, puint_z) : BATCH_SIZE);
+
+            if(EXTRACTED_NOW == 0)
+                SThisThread::Yield();
+
+            for(puint_z i = 0; i < EXTRACTED_NOW; ++i)
+                uSum += arBatch[i];
+
+            uExtracted += EXTRACTED_NOW;
+        }
+
+        sm_uSum.fetch_add(uSum);
+    }
+
+    static void ProduceBlocking(QueueT* pQueue)
+    {
+        for(u64_z uValue = 1U; uValue <= sm_uElementsPerThread; ++uValue)
+            pQueue->Enqueue(uValue);
+    }
+
+    static void ConsumeBlocking(QueueT* pQueue)
+    {
+        u64_z uSum = 0;
+        u64_z uValue = 0;
+
+        for(u64_z i = 0; i < sm_uElementsPerThread; ++i)
+        {
+            pQueue->Dequeue(uValue);
+            uSum += uValue;
+        }
+
+        sm_uSum.fetch_add(uSum);
+    }
+};
+
+template<class QueueT>
+u64_z QueueTestClass<QueueT>::sm_uElementsPerThread = 0;
+
+template<class QueueT>
+boost::atomic<u64_z> QueueTestClass<QueueT>::sm_uSum(0);
+
+/// <summary>
+/// Passes ELEMENTS_COUNT elements through a queue using a number of producers and the same number of consumers, and writes the average time per element.
+/// </summary>
+template<class QueueT>
+void MeasureThroughput_TestMethod(const char* szDescription, 
+                                  QueueT &queue, 
+                                  const Delegate<void(QueueT*)> &produce, 
+                                  const Delegate<void(QueueT*)> &consume, 
+                                  const puint_z uThreadCount)
+{
+    typedef QueueTestClass<QueueT> TestClass;
+
+    TestClass::sm_uElementsPerThread = ELEMENTS_COUNT / uThreadCount;
+    TestClass::sm_uSum = 0;
+
+    ArrayDynamic<Thread*> arThreads(uThreadCount * 2U);
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < uThreadCount; ++i)
+    {
+        arThreads.Add(new Thread(consume, &queue));
+        arThreads.Add(new Thread(produce, &queue));
+    }
+
+    for(puint_z i = 0; i < arThreads.GetCount(); ++i)
+        arThreads[i]->Join();
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    for(puint_z i = 0; i < arThreads.GetCount(); ++i)
+        delete arThreads[i];
+
+    const u64_z EXPECTED_SUM = uThreadCount * (TestClass::sm_uElementsPerThread * (TestClass::sm_uElementsPerThread + 1U) / 2U);
+
+    BOOST_TEST_MESSAGE(szDescription << ", " << uThreadCount << " producers and " << uThreadCount << " consumers: " <<
+                       scast_z(uElapsedNanoseconds, double) / (TestClass::sm_uElementsPerThread * uThreadCount) << " ns per element");
+    BOOST_CHECK_EQUAL(TestClass::sm_uSum.load(), EXPECTED_SUM);
+}
+
+/// <summary>
+/// Measures the lock-free multi-producer multi-consumer queue when threads yield while it is full or empty.
+/// </summary>
+ZTEST_CASE ( QueueMpmc_MeasuresThroughputFrom1To32ProducersAndConsumers_Test )
+{
+    typedef QueueMpmc<u64_z> QueueType;
+    QueueType queue(QUEUE_CAPACITY);
+
+    for(puint_z i = 0; i < sizeof(THREAD_COUNTS) / sizeof(puint_z); ++i)
+        MeasureThroughput_TestMethod("QueueMpmc", 
+                                     queue, 
+                                     Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ProduceSpinning), 
+                                     Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ConsumeSpinning), 
+                                     THREAD_COUNTS[i]);
+}
+
+/// <summary>
+/// Measures the lock-free multi-producer multi-consumer queue when elements are added and extracted in batches.
+/// </summary>
+ZTEST_CASE ( QueueMpmc_MeasuresBatchThroughputFrom1To32ProducersAndConsumers_Test )
+{
+    typedef QueueMpmc<u64_z> QueueType;
+    QueueType queue(QUEUE_CAPACITY);
+
+    for(puint_z i = 0; i < sizeof(THREAD_COUNTS) / sizeof(puint_z); ++i)
+        MeasureThroughput_TestMethod("QueueMpmc, batches of 16", 
+                                     queue, 
+                                     Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ProduceBatchSpinning), 
+                                     Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ConsumeBatchSpinning), 
+                                     THREAD_COUNTS[i]);
+}
+
+/// <summary>
+/// Measures the blocking wrapper of the lock-free multi-producer multi-consumer queue.
+/// </summary>
+ZTEST_CASE ( QueueBlocking_MeasuresThroughputFrom1To32ProducersAndConsumers_Test )
+{
+    typedef QueueBlocking<u64_z> QueueType;
+    QueueType queue(QUEUE_CAPACITY);
+
+    for(puint_z i = 0; i < sizeof(THREAD_COUNTS) / sizeof(puint_z); ++i)
+        MeasureThroughput_TestMethod("QueueBlocking", 
+                                     queue, 
+                                     Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ProduceBlocking), 
+                                     Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ConsumeBlocking), 
+                                     THREAD_COUNTS[i]);
+}
+
+/// <summary>
+/// Measures a List protected by a mutex and condition variables, for comparison.
+/// </summary>
+ZTEST_CASE ( MutexList_MeasuresThroughputFrom1To32ProducersAndConsumers_Test )
+{
+    typedef MutexListQueue QueueType;
+    QueueType queue(QUEUE_CAPACITY);
+
+    for(puint_z i = 0; i < sizeof(THREAD_COUNTS) / sizeof(puint_z); ++i)
+        MeasureThroughput_TestMethod("List with Mutex", 
+                                     queue, 
+                                     Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ProduceBlocking), 
+                                     Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ConsumeBlocking), 
+                                     THREAD_COUNTS[i]);
+}
+
+/// <summary>
+/// Measures the lock-free single-producer single-consumer queue, adding and extracting elements one by one and in batches, and its blocking wrapper.
+/// </summary>
+ZTEST_CASE ( QueueSpsc_MeasuresThroughputWithOneProducerAndOneConsumer_Test )
+{
+    typedef QueueSpsc<u64_z> QueueType;
+    typedef QueueBlocking<u64_z, QueueSpsc<u64_z> > BlockingQueueType;
+    QueueType queue(QUEUE_CAPACITY);
+    BlockingQueueType blockingQueue(QUEUE_CAPACITY);
+
+    MeasureThroughput_TestMethod("QueueSpsc", 
+                                 queue, 
+                                 Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ProduceSpinning), 
+                                 Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ConsumeSpinning), 
+                                 1U);
+    MeasureThroughput_TestMethod("QueueSpsc, batches of 16", 
+                                 queue, 
+                                 Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ProduceBatchSpinning), 
+                                 Delegate<void(QueueType*)>(&QueueTestClass<QueueType>::ConsumeBatchSpinning), 
+                                 1U);
+    MeasureThroughput_TestMethod("QueueBlocking over QueueSpsc", 
+                                 blockingQueue, 
+                                 Delegate<void(BlockingQueueType*)>(&QueueTestClass<BlockingQueueType>::ProduceBlocking), 
+                                 Delegate<void(BlockingQueueType*)>(&QueueTestClass<BlockingQueueType>::ConsumeBlocking), 
+                                 1U);
+}
+
+// End - Test Suite: Queue
+ZTEST_SUITE_END()
@@ -0,0 +1,240 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/SlotMap.h"
+#include "ZContainers/Hashtable.h"
+#include "ZContainers/List.h"
+
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( SlotMap_PerformanceTestSuite )
+
+/// <summary>
+/// Number of entities stored in every container.
+/// </summary>
+static const puint_z ENTITIES_COUNT = 1000000U;
+
+// An entity of a typical entity table
+struct Entity
+{
+    Entity() : m_uId(0)
+    {
+        m_arData[0] = m_arData[1] = m_arData[2] = 0;
+    }
+
+    explicit Entity(const u64_z uId) : m_uId(uId)
+    {
+        m_arData[0] = uId;
+        m_arData[1] = uId * 2U;
+        m_arData[2] = uId * 3U;
+    }
+
+    bool operator==(const Entity &entity) const
+    {
+        return m_uId == entity.m_uId;
+    }
+
+    bool operator<(const Entity &entity) const
+    {
+        return m_uId < entity.m_uId;
+    }
+
+    u64_z m_uId;
+    u64_z m_arData[3];
+};
+
+/// <summary>
+/// Generates a random permutation of the positions of the entities, which is the order in which they are accessed and removed.
+/// </summary>
+void GenerateRandomOrder_TestMethod(puint_z* arPositions, const puint_z uCount)
+{
+    u64_z uRandom = 0x9E3779B97F4A7C15ULL;
+
+    for(puint_z i = 0; i < uCount; ++i)
+        arPositions[i] = i;
+
+    for(puint_z i = uCount - 1U; i > 0; --i)
+    {
+        uRandom ^= uRandom << 13U;
+        uRandom ^= uRandom >> 7U;
+        uRandom ^= uRandom << 17U;
+        const puint_z OTHER = scast_z(uRandom % (i + 1U), puint_z);
+        const puint_z POSITION = arPositions[i];
+        arPositions[i] = arPositions[OTHER];
+        arPositions[OTHER] = POSITION;
+    }
+}
+
+/// <summary>
+/// Prints the average time per entity, in nanoseconds, of every operation.
+/// </summary>
+void PrintResults_TestMethod(const char* szDescription, const u64_z uAddTime, const u64_z uLookupTime, const u64_z uTraversalTime, 
+                             const u64_z uRemoveTime, const u64_z uSum)
+{
+    BOOST_TEST_MESSAGE(szDescription << ", " << ENTITIES_COUNT << " entities: Add " << scast_z(uAddTime, double) / ENTITIES_COUNT << 
+                       " ns, lookup " << scast_z(uLookupTime, double) / ENTITIES_COUNT << 
+                       " ns, traversal " << scast_z(uTraversalTime, double) / ENTITIES_COUNT << 
+                       " ns, remove " << scast_z(uRemoveTime, double) / ENTITIES_COUNT << " ns per entity (" << uSum << ")");
+}
+
+/// <summary>
+/// Measures a slot map that identifies entities by handle.
+/// </summary>
+ZTEST_CASE ( SlotMap_MeasuresEntityTable_Test )
+{
+    puint_z* arOrder = new puint_z[ENTITIES_COUNT];
+    GenerateRandomOrder_TestMethod(arOrder, ENTITIES_COUNT);
+    SlotMap<Entity>::Handle* arHandles = new SlotMap<Entity>::Handle[ENTITIES_COUNT];
+    SlotMap<Entity> entities;
+    u64_z uSum = 0;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+        arHandles[i] = entities.Add(Entity(i));
+
+    const u64_z ADD_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+        uSum += entities[arHandles[arOrder[i]]].m_arData[1];
+
+    const u64_z LOOKUP_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    Span<Entity> values = entities.GetValues();
+
+    for(puint_z i = 0; i < values.GetCount(); ++i)
+        uSum += values[i].m_arData[2];
+
+    const u64_z TRAVERSAL_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+        entities.Remove(arHandles[arOrder[i]]);
+
+    const u64_z REMOVE_TIME = measurer.GetElapsedTimeAsInteger();
+
+    PrintResults_TestMethod("SlotMap", ADD_TIME, LOOKUP_TIME, TRAVERSAL_TIME, REMOVE_TIME, uSum);
+    delete[] arHandles;
+    delete[] arOrder;
+}
+
+/// <summary>
+/// Measures a hashtable that identifies entities by integer identifier, for comparison.
+/// </summary>
+ZTEST_CASE ( Hashtable_MeasuresEntityTable_Test )
+{
+    puint_z* arOrder = new puint_z[ENTITIES_COUNT];
+    GenerateRandomOrder_TestMethod(arOrder, ENTITIES_COUNT);
+    Hashtable<u64_z, Entity> entities(ENTITIES_COUNT, 1U);
+    u64_z uSum = 0;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+        entities.Add(i, Entity(i));
+
+    const u64_z ADD_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+        uSum += entities.GetValue(arOrder[i]).m_arData[1];
+
+    const u64_z LOOKUP_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(Hashtable<u64_z, Entity>::ConstIterator it = entities.GetFirst(); !it.IsEnd(); ++it)
+        uSum += it->GetValue().m_arData[2];
+
+    const u64_z TRAVERSAL_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+        entities.Remove(arOrder[i]);
+
+    const u64_z REMOVE_TIME = measurer.GetElapsedTimeAsInteger();
+
+    PrintResults_TestMethod("Hashtable", ADD_TIME, LOOKUP_TIME, TRAVERSAL_TIME, REMOVE_TIME, uSum);
+    delete[] arOrder;
+}
+
+/// <summary>
+/// Measures a list that identifies entities by the iterator obtained when they were added, for comparison.
+/// </summary>
+ZTEST_CASE ( List_MeasuresEntityTable_Test )
+{
+    puint_z* arOrder = new puint_z[ENTITIES_COUNT];
+    GenerateRandomOrder_TestMethod(arOrder, ENTITIES_COUNT);
+    List<Entity> entities;
+    ArrayDynamic<List<Entity>::Iterator> arIterators(ENTITIES_COUNT);
+    u64_z uSum = 0;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+    {
+        entities.Add(Entity(i));
+        arIterators.Add(entities.GetLast());
+    }
+
+    const u64_z ADD_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+        uSum += arIterators[arOrder[i]]->m_arData[1];
+
+    const u64_z LOOKUP_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(List<Entity>::ConstIterator it = entities.GetFirst(); !it.IsEnd(); ++it)
+        uSum += it->m_arData[2];
+
+    const u64_z TRAVERSAL_TIME = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(puint_z i = 0; i < ENTITIES_COUNT; ++i)
+        entities.Remove(arIterators[arOrder[i]]);
+
+    const u64_z REMOVE_TIME = measurer.GetElapsedTimeAsInteger();
+
+    PrintResults_TestMethod("List", ADD_TIME, LOOKUP_TIME, TRAVERSAL_TIME, REMOVE_TIME, uSum);
+    delete[] arOrder;
+}
+
+// End - Test Suite: SlotMap
+ZTEST_SUITE_END()
@@ -0,0 +1,245 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/ArrayDynamic.h"
+#include "ZMemory/InlineAllocator.h"
+
+#include "ZCommon/Delegate.h"
+#include "ZContainers/SEqualityComparator.h"
+#include "ZMemory/PoolAllocator.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( SmallArrays_PerformanceTestSuite )
+
+/// <summary>
+/// Number of arrays created and destroyed in every measurement.
+/// </summary>
+static const puint_z ARRAYS_COUNT = 200000U;
+
+/// <summary>
+/// Numbers of elements added to every array, like the usual numbers of subscribers of an event or segments of a path.
+/// </summary>
+static const puint_z ELEMENT_COUNTS[] = { 1U, 2U, 4U, 8U };
+
+/// <summary>
+/// The segments of the paths built in the measurements of path segments, like those stored by Uri.
+/// </summary>
+static const char* PATH_SEGMENTS[] = { "home", "user", "projects", "zunderbolt", "Source", "ZIO", "Uri", "cpp" };
+
+// A subscriber function, whose result is accumulated so calls are not optimized away
+static u64_z sm_uSubscriberSink = 0;
+
+void Subscriber_TestMethod(int nValue)
+{
+    sm_uSubscriberSink += scast_z(nValue, u64_z);
+}
+
+typedef Delegate<void(int)> Subscriber;
+
+/// <summary>
+/// Indicates whether the blocks of an allocator are stored in the heap, which is always the case of PoolAllocator.
+/// </summary>
+bool IsInHeap_TestMethod(const PoolAllocator*)
+{
+    return true;
+}
+
+/// <summary>
+/// Indicates whether the blocks of an allocator are stored in the heap.
+/// </summary>
+template<class T, puint_z INLINE_COUNT>
+bool IsInHeap_TestMethod(const InlineAllocator<T, INLINE_COUNT>* pAllocator)
+{
+    return !pAllocator->IsInline();
+}
+
+/// <summary>
+/// Gets the number of memory blocks allocated in the heap every time the buffer of an allocator is allocated; PoolAllocator allocates the buffer 
+/// and the list of free blocks.
+/// </summary>
+puint_z AllocationsPerBuffer_TestMethod(const PoolAllocator*)
+{
+    return 2U;
+}
+
+/// <summary>
+/// Gets the number of memory blocks allocated in the heap every time the buffer of an allocator is allocated.
+/// </summary>
+template<class T, puint_z INLINE_COUNT>
+puint_z AllocationsPerBuffer_TestMethod(const InlineAllocator<T, INLINE_COUNT>*)
+{
+    return 1U;
+}
+
+/// <summary>
+/// Counts the memory blocks allocated in the heap by the last allocation of the buffer of an array, either when it was constructed or when its 
+/// capacity changed. It is zero when the buffer is stored inside the allocator.
+/// </summary>
+template<class ArrayT>
+puint_z CountBufferAllocations_TestMethod(const ArrayT &arArray)
+{
+    return IsInHeap_TestMethod(arArray.GetAllocator()) ? AllocationsPerBuffer_TestMethod(arArray.GetAllocator()) : 0;
+}
+
+/// <summary>
+/// Creates arrays of subscribers, like the lists of subscribers of events, calls every subscriber and destroys the arrays; then prints the average 
+/// time per array, in nanoseconds, and the average number of memory blocks allocated in the heap per array.
+/// </summary>
+template<class AllocatorT>
+void MeasureSubscriberArrays_TestMethod(const char* szDescription)
+{
+    typedef ArrayDynamic<Subscriber, AllocatorT, SEqualityComparator<Subscriber> > SubscriberArray;
+
+    const Subscriber SUBSCRIBER(&Subscriber_TestMethod);
+
+    for(puint_z uCountIndex = 0; uCountIndex < sizeof(ELEMENT_COUNTS) / sizeof(puint_z); ++uCountIndex)
+    {
+        const puint_z SUBSCRIBERS_COUNT = ELEMENT_COUNTS[uCountIndex];
+        puint_z uHeapAllocations = 0;
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        for(puint_z i = 0; i < ARRAYS_COUNT; ++i)
+        {
+            SubscriberArray arSubscribers;
+            uHeapAllocations += CountBufferAllocations_TestMethod(arSubscribers);
+
+            for(puint_z j = 0; j < SUBSCRIBERS_COUNT; ++j)
+            {
+                const puint_z CAPACITY = arSubscribers.GetCapacity();
+                arSubscribers.Add(SUBSCRIBER);
+
+                if(arSubscribers.GetCapacity() != CAPACITY)
+                    uHeapAllocations += CountBufferAllocations_TestMethod(arSubscribers);
+            }
+
+            for(puint_z j = 0; j < SUBSCRIBERS_COUNT; ++j)
+                arSubscribers[j](scast_z(j, int));
+        }
+
+        const double TIME_PER_ARRAY = scast_z(measurer.GetElapsedTimeAsInteger(), double) / ARRAYS_COUNT;
+        const double ALLOCATIONS_PER_ARRAY = scast_z(uHeapAllocations, double) / ARRAYS_COUNT;
+
+        BOOST_TEST_MESSAGE(szDescription << ", " << SUBSCRIBERS_COUNT << " subscribers: " << TIME_PER_ARRAY << " ns per array, " << 
+                           ALLOCATIONS_PER_ARRAY << " heap allocations per array");
+    }
+}
+
+/// <summary>
+/// Creates arrays of path segments, like those stored by Uri, traverses them and destroys the arrays; then prints the average time per array, 
+/// in nanoseconds, and the average number of memory blocks allocated in the heap per array.
+/// </summary>
+/// <remarks>
+/// The segments are short enough to be stored inside the strings, so the measured allocations are only those of the arrays.
+/// </remarks>
+template<class AllocatorT>
+void MeasurePathSegmentArrays_TestMethod(const char* szDescription)
+{
+    typedef ArrayDynamic<string_z, AllocatorT> SegmentArray;
+
+    ArrayDynamic<string_z> arSegments;
+
+    for(puint_z i = 0; i < sizeof(PATH_SEGMENTS) / sizeof(const char*); ++i)
+        arSegments.Add(string_z(PATH_SEGMENTS[i]));
+
+    for(puint_z uCountIndex = 0; uCountIndex < sizeof(ELEMENT_COUNTS) / sizeof(puint_z); ++uCountIndex)
+    {
+        const puint_z SEGMENTS_COUNT = ELEMENT_COUNTS[uCountIndex];
+        puint_z uHeapAllocations = 0;
+        puint_z uTotalLength = 0;
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        for(puint_z i = 0; i < ARRAYS_COUNT; ++i)
+        {
+            SegmentArray arPathSegments;
+            uHeapAllocations += CountBufferAllocations_TestMethod(arPathSegments);
+
+            for(puint_z j = 0; j < SEGMENTS_COUNT; ++j)
+            {
+                const puint_z CAPACITY = arPathSegments.GetCapacity();
+                arPathSegments.Add(arSegments[j]);
+
+                if(arPathSegments.GetCapacity() != CAPACITY)
+                    uHeapAllocations += CountBufferAllocations_TestMethod(arPathSegments);
+            }
+
+            for(typename SegmentArray::ConstArrayIterator it = arPathSegments.GetFirst(); !it.IsEnd(); ++it)
+                uTotalLength += it->GetLength();
+        }
+
+        const double TIME_PER_ARRAY = scast_z(measurer.GetElapsedTimeAsInteger(), double) / ARRAYS_COUNT;
+        const double ALLOCATIONS_PER_ARRAY = scast_z(uHeapAllocations, double) / ARRAYS_COUNT;
+
+        BOOST_TEST_MESSAGE(szDescription << ", " << SEGMENTS_COUNT << " segments: " << TIME_PER_ARRAY << " ns per array, " << 
+                           ALLOCATIONS_PER_ARRAY << " heap allocations per array (" << uTotalLength << " characters)");
+    }
+}
+
+/// <summary>
+/// Measures lists of subscribers stored in a PoolAllocator, for comparison.
+/// </summary>
+ZTEST_CASE ( PoolAllocator_MeasuresSubscriberArrays_Test )
+{
+    MeasureSubscriberArrays_TestMethod<PoolAllocator>("PoolAllocator");
+}
+
+/// <summary>
+/// Measures lists of subscribers stored in an InlineAllocator with room for 4 subscribers, as events do.
+/// </summary>
+ZTEST_CASE ( InlineAllocator_MeasuresSubscriberArrays_Test )
+{
+    MeasureSubscriberArrays_TestMethod< InlineAllocator<Subscriber, 4U> >("InlineAllocator<Subscriber, 4>");
+}
+
+/// <summary>
+/// Measures arrays of path segments stored in a PoolAllocator, for comparison.
+/// </summary>
+ZTEST_CASE ( PoolAllocator_MeasuresPathSegmentArrays_Test )
+{
+    MeasurePathSegmentArrays_TestMethod<PoolAllocator>("PoolAllocator");
+}
+
+/// <summary>
+/// Measures arrays of path segments stored in an InlineAllocator with room for 4 segments.
+/// </summary>
+ZTEST_CASE ( InlineAllocator_MeasuresPathSegmentArrays_Test )
+{
+    MeasurePathSegmentArrays_TestMethod< InlineAllocator<string_z, 4U> >("InlineAllocator<string_z, 4>");
+}
+
+// End - Test Suite: SmallArrays
+ZTEST_SUITE_END()
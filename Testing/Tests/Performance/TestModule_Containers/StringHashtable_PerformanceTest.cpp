@@ -0,0 +1,164 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/Hashtable.h"
+#include "ZContainers/SStringHashProvider.h"
+#include "ZContainers/SStringEqualityComparator.h"
+#include "ZContainers/ArrayDynamic.h"
+
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( StringHashtable_PerformanceTestSuite )
+
+/// <summary>
+/// Number of keys added to the hashtable and looked up in every measurement.
+/// </summary>
+static const puint_z KEYS_COUNT = 1000000U;
+
+/// <summary>
+/// Number of key-value pairs stored in every bucket when the hashtable is full, so lookups have to compare several keys.
+/// </summary>
+static const puint_z SLOTS_PER_BUCKET = 4U;
+
+/// <summary>
+/// Text that precedes the number of every key, like the common parts of paths or identifiers.
+/// </summary>
+static const char* KEY_PREFIX = "Resources/Textures/Environment/Terrain_";
+
+// Hash provider that implements the Jenkins' one-at-a-time hash function over the code points of the string, for comparison
+class JenkinsStringHashProvider
+{
+public:
+
+    static puint_z GenerateHashKey(const string_z &strInput, const puint_z uBucketsInTable)
+    {
+        u32_z uHashKey = 0;
+
+        const u16_z* arCharacters = strInput.GetInternalBuffer();
+        const puint_z LENGTH = strInput.GetLength();
+
+        for(puint_z i = 0; i < LENGTH; ++i)
+        {
+            uHashKey += arCharacters[i];
+            uHashKey += (uHashKey << 10U);
+            uHashKey ^= (uHashKey >> 6U);
+        }
+
+        uHashKey += (uHashKey << 3U);
+        uHashKey ^= (uHashKey >> 11U);
+        uHashKey += (uHashKey << 15U);
+
+        return uHashKey % scast_z(uBucketsInTable, u32_z);
+    }
+};
+
+/// <summary>
+/// Fills an array with different keys that share the same prefix.
+/// </summary>
+void CreateKeys_TestMethod(ArrayDynamic<string_z> &arKeys)
+{
+    arKeys.Reserve(KEYS_COUNT);
+
+    for(puint_z i = 0; i < KEYS_COUNT; ++i)
+        arKeys.Add(string_z(KEY_PREFIX) + scast_z(i, u64_z));
+}
+
+/// <summary>
+/// Adds all the keys to a hashtable, looks up copies of them and prints the average time per operation, in nanoseconds.
+/// </summary>
+/// <remarks>
+/// The looked up keys are copied before the measurement, so their hash codes are calculated during the lookups, as it happens with keys that 
+/// come from outside the hashtable.
+/// </remarks>
+template<class HashtableT>
+void MeasureAddAndLookUp_TestMethod(const char* szDescription)
+{
+    ArrayDynamic<string_z> arKeys;
+    CreateKeys_TestMethod(arKeys);
+    ArrayDynamic<string_z> arLookedUpKeys;
+    CreateKeys_TestMethod(arLookedUpKeys);
+
+    HashtableT hashtable(KEYS_COUNT / SLOTS_PER_BUCKET, SLOTS_PER_BUCKET);
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(puint_z i = 0; i < KEYS_COUNT; ++i)
+        hashtable.Add(arKeys[i], scast_z(i, int));
+
+    const double ADD_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / KEYS_COUNT;
+
+    puint_z uFoundKeys = 0;
+    measurer.Set();
+
+    for(puint_z i = 0; i < KEYS_COUNT; ++i)
+    {
+        if(hashtable.ContainsKey(arLookedUpKeys[i]))
+            ++uFoundKeys;
+    }
+
+    const double LOOKUP_TIME = scast_z(measurer.GetElapsedTimeAsInteger(), double) / KEYS_COUNT;
+
+    BOOST_TEST_MESSAGE(szDescription << ", " << KEYS_COUNT << " keys: " << ADD_TIME << " ns per addition, " << LOOKUP_TIME << " ns per lookup (" << 
+                       uFoundKeys << " found)");
+}
+
+/// <summary>
+/// Measures a hashtable whose keys are hashed with the Jenkins' one-at-a-time function and compared with the equality operator, for comparison.
+/// </summary>
+ZTEST_CASE ( JenkinsHashAndDefaultComparator_MeasuresAddingAndLookingUpKeys_Test )
+{
+    MeasureAddAndLookUp_TestMethod< Hashtable<string_z, int, JenkinsStringHashProvider> >("Jenkins one-at-a-time, SComparatorDefault");
+}
+
+/// <summary>
+/// Measures a hashtable whose keys are hashed with SStringHashProvider and compared with the equality operator.
+/// </summary>
+ZTEST_CASE ( SStringHashProviderAndDefaultComparator_MeasuresAddingAndLookingUpKeys_Test )
+{
+    MeasureAddAndLookUp_TestMethod< Hashtable<string_z, int, SStringHashProvider> >("SStringHashProvider, SComparatorDefault");
+}
+
+/// <summary>
+/// Measures a hashtable whose keys are hashed with SStringHashProvider and compared with SStringEqualityComparator, which rejects different keys 
+/// using their hash codes.
+/// </summary>
+ZTEST_CASE ( SStringHashProviderAndSStringEqualityComparator_MeasuresAddingAndLookingUpKeys_Test )
+{
+    MeasureAddAndLookUp_TestMethod< Hashtable<string_z, int, SStringHashProvider, PoolAllocator, SStringEqualityComparator> >(
+                                                                                                  "SStringHashProvider, SStringEqualityComparator");
+}
+
+// End - Test Suite: StringHashtable
+ZTEST_SUITE_END()
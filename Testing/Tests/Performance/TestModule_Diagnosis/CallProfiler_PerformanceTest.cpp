@@ -0,0 +1,140 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZDiagnosis/CallProfiler.h"
+
+#include "ZDiagnosis/CallProfileRecorder.h"
+#include "ZDiagnosis/ScopedCallTraceNotifier.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( CallProfiler_PerformanceTestSuite )
+
+/// <summary>
+/// Number of calls measured in every test.
+/// </summary>
+static const unsigned int CALLS_COUNT = 1000000U;
+
+/// <summary>
+/// Number of calls measured in the tests that use the call stack tracer, which is much slower than the profiler.
+/// </summary>
+static const unsigned int TRACED_CALLS_COUNT = 100000U;
+
+/// <summary>
+/// Measures the average time spent beginning and ending a call with a recorder, which is the cost of the hot path without the thread-local lookup.
+/// </summary>
+ZTEST_CASE ( CallProfileRecorder_MeasuresOverheadPerCall_Test )
+{
+    // [Preparation]
+    CallProfileRecorder recorder("ThreadId");
+    const CallTrace PARENT_TRACE("void Parent()", null_z, 0);
+    const CallTrace CHILD_TRACE("void Child()", null_z, 0);
+    CycleStopwatch measurer;
+
+    // [Execution]
+    recorder.BeginCall(PARENT_TRACE);
+    measurer.Set();
+
+    for(unsigned int i = 0; i < CALLS_COUNT; ++i)
+    {
+        recorder.BeginCall(CHILD_TRACE);
+        recorder.EndCall();
+    }
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    recorder.EndCall();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("CallProfileRecorder::BeginCall + EndCall: " << scast_z(uElapsedNanoseconds, double) / CALLS_COUNT << " ns per call");
+}
+
+/// <summary>
+/// Measures the average time spent beginning and ending a call with the profiler.
+/// </summary>
+ZTEST_CASE ( BeginCallEndCall_MeasuresOverheadPerCall_Test )
+{
+    // [Preparation]
+    const CallTrace TRACE("void Function()", null_z, 0);
+    CycleStopwatch measurer;
+
+    // [Execution]
+    measurer.Set();
+
+    for(unsigned int i = 0; i < CALLS_COUNT; ++i)
+    {
+        CallProfiler::Get()->BeginCall(TRACE);
+        CallProfiler::Get()->EndCall();
+    }
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("CallProfiler::BeginCall + EndCall: " << scast_z(uElapsedNanoseconds, double) / CALLS_COUNT << " ns per call");
+}
+
+/// <summary>
+/// Measures the average time spent by the call stack tracing macros with the profiler disabled and enabled.
+/// </summary>
+ZTEST_CASE ( ScopedCallTraceNotifier_MeasuresOverheadPerCallWithAndWithoutProfiling_Test )
+{
+    // [Preparation]
+    const CallTrace TRACE("void Function()", null_z, 0);
+    CycleStopwatch measurer;
+    const bool ORIGINAL_VALUE = CallProfiler::Get()->IsEnabled();
+
+    // [Execution]
+    CallProfiler::Get()->SetEnabled(false);
+    measurer.Set();
+
+    for(unsigned int i = 0; i < TRACED_CALLS_COUNT; ++i)
+        ScopedCallTraceNotifier notifier(TRACE);
+
+    u64_z uElapsedNanosecondsWithoutProfiling = measurer.GetElapsedTimeAsInteger();
+
+    CallProfiler::Get()->SetEnabled(true);
+    measurer.Set();
+
+    for(unsigned int i = 0; i < TRACED_CALLS_COUNT; ++i)
+        ScopedCallTraceNotifier notifier(TRACE);
+
+    u64_z uElapsedNanosecondsWithProfiling = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("ScopedCallTraceNotifier (profiler disabled): " << scast_z(uElapsedNanosecondsWithoutProfiling, double) / TRACED_CALLS_COUNT << " ns per call");
+    BOOST_TEST_MESSAGE("ScopedCallTraceNotifier (profiler enabled): " << scast_z(uElapsedNanosecondsWithProfiling, double) / TRACED_CALLS_COUNT << " ns per call");
+
+    // [Cleaning]
+    CallProfiler::Get()->SetEnabled(ORIGINAL_VALUE);
+}
+
+// End - Test Suite: CallProfiler
+ZTEST_SUITE_END()
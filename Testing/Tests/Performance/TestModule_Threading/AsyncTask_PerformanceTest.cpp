@@ -0,0 +1,331 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/AsyncTaskExecutor.h"
+
+#include "ZFileSystem/AsyncFileRead.h"
+#include "ZFileSystem/FileStream.h"
+#include "ZFileSystem/SFile.h"
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/Thread.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( AsyncTask_PerformanceTestSuite )
+
+/// <summary>
+/// Numbers of jobs that run at the same time in every measurement of jobs that sleep.
+/// </summary>
+static const u32_z SLEEPING_JOB_COUNTS[] = { 100U, 1000U };
+
+/// <summary>
+/// Number of jobs that run at the same time in every measurement of jobs that read a file.
+/// </summary>
+static const u32_z READING_JOB_COUNT = 200U;
+
+/// <summary>
+/// Number of times every job waits.
+/// </summary>
+static const u32_z STEPS_PER_JOB = 10U;
+
+/// <summary>
+/// Time every job sleeps in every step.
+/// </summary>
+static const TimeSpan SLEEP_DURATION(0, 0, 0, 0, 2, 0, 0);
+
+/// <summary>
+/// Size, in bytes, of the block read by a job in every step.
+/// </summary>
+static const puint_z BLOCK_SIZE = 4096U;
+
+/// <summary>
+/// Number of threads that execute non-blocking tasks.
+/// </summary>
+static const u32_z WORKER_COUNT = 2U;
+
+/// <summary>
+/// Number of threads that execute blocking tasks.
+/// </summary>
+static const u32_z BLOCKING_WORKER_COUNT = 4U;
+
+/// <summary>
+/// Path to the file read by the jobs, where every job reads its own part.
+/// </summary>
+static const char* FILE_PATH = "./AsyncTaskPerformanceTest.bin";
+
+// A job that sleeps in every step, as a task
+class SleepingJobTask : public AsyncTask
+{
+public:
+
+    SleepingJobTask() : m_uStep(0)
+    {
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        const bool IS_COMPLETED = m_uStep == STEPS_PER_JOB;
+
+        if(!IS_COMPLETED)
+            this->AwaitSleep(SLEEP_DURATION);
+
+        ++m_uStep;
+        return IS_COMPLETED;
+    }
+
+public:
+
+    u32_z m_uStep;
+};
+
+// A job that reads a block of its part of the file in every step, as a task that awaits the read operation
+class ReadingJobTask : public AsyncTask
+{
+public:
+
+    explicit ReadingJobTask(const u32_z uJobIndex) : m_eErrorInfo(EFileSystemError::E_Unknown),
+                                                     m_stream(Path(FILE_PATH), EFileOpenMode::E_Open, BLOCK_SIZE, m_eErrorInfo),
+                                                     m_read(m_stream, m_arBlock, 0, BLOCK_SIZE),
+                                                     m_uStep(0),
+                                                     m_uChecksum(0)
+    {
+        m_stream.SetPosition(uJobIndex * STEPS_PER_JOB * BLOCK_SIZE);
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        if(m_uStep > 0)
+            m_uChecksum += m_arBlock[0] + m_arBlock[BLOCK_SIZE - 1U];
+
+        const bool IS_COMPLETED = m_uStep == STEPS_PER_JOB;
+
+        if(!IS_COMPLETED)
+            this->AwaitTask(m_read);
+
+        ++m_uStep;
+        return IS_COMPLETED;
+    }
+
+public:
+
+    EFileSystemError m_eErrorInfo;
+    FileStream m_stream;
+    u8_z m_arBlock[BLOCK_SIZE];
+    AsyncFileRead m_read;
+    u32_z m_uStep;
+    u64_z m_uChecksum;
+};
+
+// Class whose methods are the same jobs, executed by a dedicated thread each
+class AsyncTaskPerformanceTestClass
+{
+public:
+
+    static void SleepingJob()
+    {
+        for(u32_z i = 0; i < STEPS_PER_JOB; ++i)
+            SThisThread::Sleep(SLEEP_DURATION);
+    }
+
+    static void ReadingJob(const u32_z uJobIndex)
+    {
+        EFileSystemError eErrorInfo = EFileSystemError::E_Unknown;
+        FileStream stream(Path(FILE_PATH), EFileOpenMode::E_Open, BLOCK_SIZE, eErrorInfo);
+        stream.SetPosition(uJobIndex * STEPS_PER_JOB * BLOCK_SIZE);
+        u8_z arBlock[BLOCK_SIZE];
+        u64_z uChecksum = 0;
+
+        for(u32_z i = 0; i < STEPS_PER_JOB; ++i)
+        {
+            stream.Read(arBlock, 0, BLOCK_SIZE);
+            uChecksum += arBlock[0] + arBlock[BLOCK_SIZE - 1U];
+        }
+
+        sm_uChecksum = uChecksum;
+    }
+
+    static volatile u64_z sm_uChecksum;
+};
+
+volatile u64_z AsyncTaskPerformanceTestClass::sm_uChecksum = 0;
+
+/// <summary>
+/// Writes the file read by the jobs, if it does not exist.
+/// </summary>
+void CreateAsyncTaskFile_TestMethod()
+{
+    EFileSystemError eErrorInfo = EFileSystemError::E_Unknown;
+
+    if(!SFile::Exists(Path(FILE_PATH), eErrorInfo))
+    {
+        FileStream stream(Path(FILE_PATH), EFileOpenMode::E_Create, 65536U, eErrorInfo);
+        u8_z arBlock[BLOCK_SIZE];
+
+        for(u32_z i = 0; i < READING_JOB_COUNT * STEPS_PER_JOB; ++i)
+        {
+            for(puint_z j = 0; j < BLOCK_SIZE; ++j)
+                arBlock[j] = scast_z(i + j, u8_z);
+
+            stream.Write(arBlock, 0, BLOCK_SIZE);
+        }
+
+        stream.Flush();
+    }
+}
+
+/// <summary>
+/// Measures jobs that sleep in every step, executed by a dedicated thread each, for comparison.
+/// </summary>
+ZTEST_CASE ( ThreadPerJob_MeasuresSleepingJobs_Test )
+{
+    for(u32_z uJobs = 0; uJobs < sizeof(SLEEPING_JOB_COUNTS) / sizeof(u32_z); ++uJobs)
+    {
+        const u32_z JOB_COUNT = SLEEPING_JOB_COUNTS[uJobs];
+        Thread** arThreads = new Thread*[JOB_COUNT];
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        for(u32_z i = 0; i < JOB_COUNT; ++i)
+            arThreads[i] = new Thread(Delegate<void()>(&AsyncTaskPerformanceTestClass::SleepingJob));
+
+        for(u32_z i = 0; i < JOB_COUNT; ++i)
+            arThreads[i]->Join();
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+        for(u32_z i = 0; i < JOB_COUNT; ++i)
+            delete arThreads[i];
+
+        delete[] arThreads;
+
+        BOOST_TEST_MESSAGE("Thread per job, " << JOB_COUNT << " jobs sleeping " << STEPS_PER_JOB << " times: " << 
+                           scast_z(uElapsedNanoseconds, double) / 1000000.0 << " ms, " << JOB_COUNT << " threads");
+    }
+}
+
+/// <summary>
+/// Measures jobs that sleep in every step, executed as tasks.
+/// </summary>
+ZTEST_CASE ( AsyncTask_MeasuresSleepingJobs_Test )
+{
+    for(u32_z uJobs = 0; uJobs < sizeof(SLEEPING_JOB_COUNTS) / sizeof(u32_z); ++uJobs)
+    {
+        const u32_z JOB_COUNT = SLEEPING_JOB_COUNTS[uJobs];
+        AsyncTaskExecutor executor(WORKER_COUNT, BLOCKING_WORKER_COUNT);
+        SleepingJobTask* arTasks = new SleepingJobTask[JOB_COUNT];
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        for(u32_z i = 0; i < JOB_COUNT; ++i)
+            executor.Submit(arTasks[i]);
+
+        for(u32_z i = 0; i < JOB_COUNT; ++i)
+            arTasks[i].Wait();
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+        delete[] arTasks;
+
+        BOOST_TEST_MESSAGE("AsyncTask, " << JOB_COUNT << " jobs sleeping " << STEPS_PER_JOB << " times: " << 
+                           scast_z(uElapsedNanoseconds, double) / 1000000.0 << " ms, " << WORKER_COUNT + BLOCKING_WORKER_COUNT + 1U << " threads");
+    }
+}
+
+/// <summary>
+/// Measures jobs that read a block of a file in every step, executed by a dedicated thread each, for comparison.
+/// </summary>
+ZTEST_CASE ( ThreadPerJob_MeasuresReadingJobs_Test )
+{
+    CreateAsyncTaskFile_TestMethod();
+
+    Thread** arThreads = new Thread*[READING_JOB_COUNT];
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(u32_z i = 0; i < READING_JOB_COUNT; ++i)
+        arThreads[i] = new Thread(Delegate<void(u32_z)>(&AsyncTaskPerformanceTestClass::ReadingJob), i);
+
+    for(u32_z i = 0; i < READING_JOB_COUNT; ++i)
+        arThreads[i]->Join();
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    for(u32_z i = 0; i < READING_JOB_COUNT; ++i)
+        delete arThreads[i];
+
+    delete[] arThreads;
+
+    BOOST_TEST_MESSAGE("Thread per job, " << READING_JOB_COUNT << " jobs reading " << STEPS_PER_JOB << " blocks of " << BLOCK_SIZE << " bytes: " << 
+                       scast_z(uElapsedNanoseconds, double) / 1000000.0 << " ms, " << READING_JOB_COUNT << " threads");
+}
+
+/// <summary>
+/// Measures jobs that read a block of a file in every step, executed as tasks that await blocking read tasks.
+/// </summary>
+ZTEST_CASE ( AsyncTask_MeasuresReadingJobs_Test )
+{
+    CreateAsyncTaskFile_TestMethod();
+
+    AsyncTaskExecutor executor(WORKER_COUNT, BLOCKING_WORKER_COUNT);
+    ReadingJobTask* arTasks[READING_JOB_COUNT];
+
+    for(u32_z i = 0; i < READING_JOB_COUNT; ++i)
+        arTasks[i] = new ReadingJobTask(i);
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(u32_z i = 0; i < READING_JOB_COUNT; ++i)
+        executor.Submit(*arTasks[i]);
+
+    for(u32_z i = 0; i < READING_JOB_COUNT; ++i)
+        arTasks[i]->Wait();
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    for(u32_z i = 0; i < READING_JOB_COUNT; ++i)
+        delete arTasks[i];
+
+    BOOST_TEST_MESSAGE("AsyncTask, " << READING_JOB_COUNT << " jobs reading " << STEPS_PER_JOB << " blocks of " << BLOCK_SIZE << " bytes: " << 
+                       scast_z(uElapsedNanoseconds, double) / 1000000.0 << " ms, " << WORKER_COUNT + BLOCKING_WORKER_COUNT + 1U << " threads");
+}
+
+// End - Test Suite: AsyncTask
+ZTEST_SUITE_END()
@@ -0,0 +1,238 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/ConditionVariable.h"
+#include "ZThreading/MutexConditionVariable.h"
+#include "ZThreading/EventCount.h"
+
+#include "ZThreading/Thread.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( ConditionVariable_PerformanceTestSuite )
+
+/// <summary>
+/// Number of times the turn goes from one thread to the other and back in every measurement.
+/// </summary>
+static const unsigned int ROUND_TRIPS = 20000U;
+
+/// <summary>
+/// Number of notifications sent when nobody waits.
+/// </summary>
+static const unsigned int NOTIFICATIONS = 1000000U;
+
+// Passes the turn between threads using a condition variable that protects the turn with a mutex
+template<class ConditionVariableT>
+class ConditionVariableSignal
+{
+public:
+
+    ConditionVariableSignal() : m_uTurn(0)
+    {
+    }
+
+    void WaitForTurn(const unsigned int uTurn)
+    {
+        ScopedExclusiveLock<> lock(m_mutex);
+
+        while(m_uTurn != uTurn)
+            m_conditionVariable.Wait(lock);
+    }
+
+    void PassTurn(const unsigned int uTurn)
+    {
+        {
+            ScopedExclusiveLock<> lock(m_mutex);
+            m_uTurn = uTurn;
+        }
+
+        m_conditionVariable.NotifyOne();
+    }
+
+    void Notify()
+    {
+        m_conditionVariable.NotifyOne();
+    }
+
+private:
+
+    Mutex m_mutex;
+    ConditionVariableT m_conditionVariable;
+    unsigned int m_uTurn;
+};
+
+// Passes the turn between threads using an atomic integer and an event count, without mutex
+class EventCountSignal
+{
+public:
+
+    EventCountSignal() : m_uTurn(0)
+    {
+    }
+
+    void WaitForTurn(const unsigned int uTurn)
+    {
+        while(m_uTurn.load() != uTurn)
+        {
+            const u32_z KEY = m_eventCount.PrepareWait();
+
+            if(m_uTurn.load() != uTurn)
+                m_eventCount.Wait(KEY);
+            else
+                m_eventCount.CancelWait();
+        }
+    }
+
+    void PassTurn(const unsigned int uTurn)
+    {
+        m_uTurn.store(uTurn);
+        m_eventCount.NotifyOne();
+    }
+
+    void Notify()
+    {
+        m_eventCount.NotifyOne();
+    }
+
+private:
+
+    EventCount m_eventCount;
+    boost::atomic<unsigned int> m_uTurn;
+};
+
+// Class whose methods are executed by the thread that answers in the ping-pong tests
+template<class SignalT>
+class SignalTestClass
+{
+public:
+
+    static SignalT* sm_pSignal;
+
+    static void Answer()
+    {
+        for(unsigned int i = 0; i < ROUND_TRIPS; ++i)
+        {
+            sm_pSignal->WaitForTurn(1U);
+            sm_pSignal->PassTurn(0);
+        }
+    }
+};
+
+template<class SignalT>
+SignalT* SignalTestClass<SignalT>::sm_pSignal = null_z;
+
+/// <summary>
+/// Passes the turn to another thread and waits for it to be given back, and returns the average time per wake-up, in nanoseconds.
+/// </summary>
+template<class SignalT>
+double MeasurePingPong_TestMethod()
+{
+    typedef SignalTestClass<SignalT> TestClass;
+
+    SignalT signal;
+    TestClass::sm_pSignal = &signal;
+    Thread thread(Delegate<void()>(&TestClass::Answer));
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(unsigned int i = 0; i < ROUND_TRIPS; ++i)
+    {
+        signal.PassTurn(1U);
+        signal.WaitForTurn(0);
+    }
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    thread.Join();
+
+    // Every round trip implies 2 wake-ups
+    return scast_z(uElapsedNanoseconds, double) / (ROUND_TRIPS * 2U);
+}
+
+/// <summary>
+/// Sends notifications when no thread waits and returns the average time per notification, in nanoseconds.
+/// </summary>
+template<class SignalT>
+double MeasureNotificationWithoutWaiters_TestMethod()
+{
+    SignalT signal;
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(unsigned int i = 0; i < NOTIFICATIONS; ++i)
+        signal.Notify();
+
+    return scast_z(measurer.GetElapsedTimeAsInteger(), double) / NOTIFICATIONS;
+}
+
+/// <summary>
+/// Measures the wake-up latency of the generic condition variable along with a mutex.
+/// </summary>
+ZTEST_CASE ( ConditionVariable_MeasuresWakeUpLatency_Test )
+{
+    const double TIME_PER_WAKEUP = MeasurePingPong_TestMethod< ConditionVariableSignal<ConditionVariable> >();
+    BOOST_TEST_MESSAGE("ConditionVariable + Mutex, ping-pong: " << TIME_PER_WAKEUP << " ns per wake-up");
+
+    const double TIME_PER_NOTIFICATION = MeasureNotificationWithoutWaiters_TestMethod< ConditionVariableSignal<ConditionVariable> >();
+    BOOST_TEST_MESSAGE("ConditionVariable + Mutex, no waiters: " << TIME_PER_NOTIFICATION << " ns per notification");
+}
+
+/// <summary>
+/// Measures the wake-up latency of the condition variable specialized for Mutex.
+/// </summary>
+ZTEST_CASE ( MutexConditionVariable_MeasuresWakeUpLatency_Test )
+{
+    const double TIME_PER_WAKEUP = MeasurePingPong_TestMethod< ConditionVariableSignal<MutexConditionVariable> >();
+    BOOST_TEST_MESSAGE("MutexConditionVariable + Mutex, ping-pong: " << TIME_PER_WAKEUP << " ns per wake-up");
+
+    const double TIME_PER_NOTIFICATION = MeasureNotificationWithoutWaiters_TestMethod< ConditionVariableSignal<MutexConditionVariable> >();
+    BOOST_TEST_MESSAGE("MutexConditionVariable + Mutex, no waiters: " << TIME_PER_NOTIFICATION << " ns per notification");
+}
+
+/// <summary>
+/// Measures the wake-up latency of the event count along with an atomic integer, without mutex.
+/// </summary>
+ZTEST_CASE ( EventCount_MeasuresWakeUpLatency_Test )
+{
+    const double TIME_PER_WAKEUP = MeasurePingPong_TestMethod<EventCountSignal>();
+    BOOST_TEST_MESSAGE("EventCount + atomic, ping-pong: " << TIME_PER_WAKEUP << " ns per wake-up");
+
+    const double TIME_PER_NOTIFICATION = MeasureNotificationWithoutWaiters_TestMethod<EventCountSignal>();
+    BOOST_TEST_MESSAGE("EventCount + atomic, no waiters: " << TIME_PER_NOTIFICATION << " ns per notification");
+}
+
+// End - Test Suite: ConditionVariable
+ZTEST_SUITE_END()
@@ -0,0 +1,178 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/SLockStatistics.h"
+
+#include "ZThreading/Mutex.h"
+#include "ZThreading/SharedMutex.h"
+#include "ZThreading/Thread.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( LockStatistics_PerformanceTestSuite )
+
+/// <summary>
+/// Number of times every thread locks and unlocks the mutex in every measurement.
+/// </summary>
+static const unsigned int LOCKS_PER_THREAD = 200000U;
+
+/// <summary>
+/// Numbers of threads that compete for the mutex.
+/// </summary>
+static const unsigned int STATISTICS_THREAD_COUNTS[] = { 1U, 4U };
+
+// Class whose methods are executed by the threads, which lock the mutex in one of the modes
+class LockStatisticsTestClass
+{
+public:
+
+    static Mutex* sm_pMutex;
+    static SharedMutex* sm_pSharedMutex;
+    static volatile u64_z sm_uSharedResource;
+
+    static void LockMutex()
+    {
+        for(unsigned int i = 0; i < LOCKS_PER_THREAD; ++i)
+        {
+            sm_pMutex->Lock();
+            sm_uSharedResource = sm_uSharedResource + 1U;
+            sm_pMutex->Unlock();
+        }
+    }
+
+    static void LockSharedMutexExclusively()
+    {
+        for(unsigned int i = 0; i < LOCKS_PER_THREAD; ++i)
+        {
+            sm_pSharedMutex->Lock();
+            sm_uSharedResource = sm_uSharedResource + 1U;
+            sm_pSharedMutex->Unlock();
+        }
+    }
+
+    static void LockSharedMutexShared()
+    {
+        for(unsigned int i = 0; i < LOCKS_PER_THREAD; ++i)
+        {
+            sm_pSharedMutex->LockShared();
+            const u64_z VALUE = sm_uSharedResource;
+            sm_pSharedMutex->UnlockShared();
+            (void)VALUE;
+        }
+    }
+};
+
+Mutex* LockStatisticsTestClass::sm_pMutex = null_z;
+SharedMutex* LockStatisticsTestClass::sm_pSharedMutex = null_z;
+volatile u64_z LockStatisticsTestClass::sm_uSharedResource = 0;
+
+/// <summary>
+/// Executes a function in several numbers of threads at the same time and prints the average time per lock, in nanoseconds.
+/// </summary>
+void MeasureLockStatistics_TestMethod(const Delegate<void()> &function, const char* szDescription)
+{
+    Thread* arThreads[4];
+
+    for(unsigned int uThreads = 0; uThreads < sizeof(STATISTICS_THREAD_COUNTS) / sizeof(unsigned int); ++uThreads)
+    {
+        const unsigned int THREAD_COUNT = STATISTICS_THREAD_COUNTS[uThreads];
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            arThreads[i] = new Thread(function);
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            arThreads[i]->Join();
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            delete arThreads[i];
+
+        const double TIME_PER_LOCK = scast_z(uElapsedNanoseconds, double) / (LOCKS_PER_THREAD * THREAD_COUNT);
+
+        BOOST_TEST_MESSAGE(szDescription << (SLockStatistics::IsEnabled() ? " (statistics enabled), " : " (statistics disabled), ") << 
+                           THREAD_COUNT << " threads: " << TIME_PER_LOCK << " ns per lock");
+    }
+}
+
+/// <summary>
+/// Measures a mutex whose statistics are recorded under its name, when they are enabled.
+/// </summary>
+ZTEST_CASE ( NamedMutex_MeasuresLockOverhead_Test )
+{
+    Mutex mutex("LockStatisticsPerformanceTest.Mutex");
+    LockStatisticsTestClass::sm_pMutex = &mutex;
+
+    MeasureLockStatistics_TestMethod(Delegate<void()>(&LockStatisticsTestClass::LockMutex), "Mutex");
+}
+
+/// <summary>
+/// Measures a mutex whose statistics are never recorded, which only pays for checking whether it is tracked.
+/// </summary>
+ZTEST_CASE ( UntrackedMutex_MeasuresLockOverhead_Test )
+{
+    Mutex mutex(null_z);
+    LockStatisticsTestClass::sm_pMutex = &mutex;
+
+    MeasureLockStatistics_TestMethod(Delegate<void()>(&LockStatisticsTestClass::LockMutex), "Mutex without name");
+}
+
+/// <summary>
+/// Measures a shared mutex locked in exclusive mode.
+/// </summary>
+ZTEST_CASE ( SharedMutexExclusive_MeasuresLockOverhead_Test )
+{
+    SharedMutex mutex("LockStatisticsPerformanceTest.SharedMutex");
+    LockStatisticsTestClass::sm_pSharedMutex = &mutex;
+
+    MeasureLockStatistics_TestMethod(Delegate<void()>(&LockStatisticsTestClass::LockSharedMutexExclusively), "SharedMutex, exclusive mode");
+}
+
+/// <summary>
+/// Measures a shared mutex locked in shared mode.
+/// </summary>
+ZTEST_CASE ( SharedMutexShared_MeasuresLockOverhead_Test )
+{
+    SharedMutex mutex("LockStatisticsPerformanceTest.SharedMutex");
+    LockStatisticsTestClass::sm_pSharedMutex = &mutex;
+
+    MeasureLockStatistics_TestMethod(Delegate<void()>(&LockStatisticsTestClass::LockSharedMutexShared), "SharedMutex, shared mode");
+
+    SLockStatistics::Dump();
+}
+
+// End - Test Suite: LockStatistics
+ZTEST_SUITE_END()
@@ -0,0 +1,263 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/Mutex.h"
+#include "ZThreading/SharedMutex.h"
+
+#include "ZThreading/Thread.h"
+#include "ZTiming/CycleStopwatch.h"
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/shared_mutex.hpp>
+
+
+ZTEST_SUITE_BEGIN( Mutex_PerformanceTestSuite )
+
+/// <summary>
+/// Number of times every thread locks and unlocks the mutex in every measurement.
+/// </summary>
+static const unsigned int OPERATIONS_PER_THREAD = 50000U;
+
+/// <summary>
+/// Numbers of threads that compete for the mutex.
+/// </summary>
+static const unsigned int THREAD_COUNTS[] = { 1U, 2U, 4U, 8U };
+
+/// <summary>
+/// Numbers of iterations of the work done inside the critical section, from an empty one to a long one.
+/// </summary>
+static const unsigned int CRITICAL_SECTION_LENGTHS[] = { 0, 20U, 200U };
+
+/// <summary>
+/// Proportions of exclusive locks (1 out of N operations) in the tests of shared mutexes; zero means that there are only shared locks.
+/// </summary>
+static const unsigned int WRITE_PERIODS[] = { 0, 100U, 10U };
+
+// Adapts the mutexes of Boost, used by the library before, to the interface of the mutexes of the library
+class BoostMutex
+{
+public:
+
+    void Lock() { m_mutex.lock(); }
+    void Unlock() { m_mutex.unlock(); }
+
+private:
+
+    boost::mutex m_mutex;
+};
+
+class BoostSharedMutex
+{
+public:
+
+    void Lock() { m_mutex.lock(); }
+    void Unlock() { m_mutex.unlock(); }
+    void LockShared() { m_mutex.lock_shared(); }
+    void UnlockShared() { m_mutex.unlock_shared(); }
+
+private:
+
+    boost::shared_mutex m_mutex;
+};
+
+// Class whose methods are executed by the competing threads
+template<class MutexT>
+class MutexTestClass
+{
+public:
+
+    static MutexT* sm_pMutex;
+    static unsigned int sm_uCriticalSectionLength;
+    static unsigned int sm_uWritePeriod;
+    static volatile u64_z sm_uSharedResource;
+
+    static void Work(const unsigned int uLength)
+    {
+        for(unsigned int i = 0; i < uLength; ++i)
+            sm_uSharedResource = sm_uSharedResource * 31U + i;
+    }
+
+    static void LockExclusively()
+    {
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            sm_pMutex->Lock();
+            MutexTestClass::Work(sm_uCriticalSectionLength);
+            sm_pMutex->Unlock();
+        }
+    }
+
+    static void ReadOrWrite()
+    {
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            if(sm_uWritePeriod != 0 && i % sm_uWritePeriod == 0)
+            {
+                sm_pMutex->Lock();
+                MutexTestClass::Work(sm_uCriticalSectionLength);
+                sm_pMutex->Unlock();
+            }
+            else
+            {
+                sm_pMutex->LockShared();
+                const u64_z VALUE = sm_uSharedResource;
+                sm_pMutex->UnlockShared();
+                (void)VALUE;
+            }
+        }
+    }
+};
+
+template<class MutexT>
+MutexT* MutexTestClass<MutexT>::sm_pMutex = null_z;
+
+template<class MutexT>
+unsigned int MutexTestClass<MutexT>::sm_uCriticalSectionLength = 0;
+
+template<class MutexT>
+unsigned int MutexTestClass<MutexT>::sm_uWritePeriod = 0;
+
+template<class MutexT>
+volatile u64_z MutexTestClass<MutexT>::sm_uSharedResource = 0;
+
+/// <summary>
+/// Executes a function in a number of threads at the same time and returns the average time per operation, in nanoseconds.
+/// </summary>
+double MeasureThreads_TestMethod(const Delegate<void()> &function, const unsigned int uThreadCount)
+{
+    Thread* arThreads[8];
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(unsigned int i = 0; i < uThreadCount; ++i)
+        arThreads[i] = new Thread(function);
+
+    for(unsigned int i = 0; i < uThreadCount; ++i)
+        arThreads[i]->Join();
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    for(unsigned int i = 0; i < uThreadCount; ++i)
+        delete arThreads[i];
+
+    return scast_z(uElapsedNanoseconds, double) / (OPERATIONS_PER_THREAD * uThreadCount);
+}
+
+/// <summary>
+/// Measures a mutex for every combination of number of threads and length of the critical section.
+/// </summary>
+template<class MutexT>
+void MeasureExclusiveContention_TestMethod(const char* szDescription)
+{
+    typedef MutexTestClass<MutexT> TestClass;
+
+    MutexT mutex;
+    TestClass::sm_pMutex = &mutex;
+
+    for(unsigned int uLength = 0; uLength < sizeof(CRITICAL_SECTION_LENGTHS) / sizeof(unsigned int); ++uLength)
+    {
+        TestClass::sm_uCriticalSectionLength = CRITICAL_SECTION_LENGTHS[uLength];
+
+        for(unsigned int uThreads = 0; uThreads < sizeof(THREAD_COUNTS) / sizeof(unsigned int); ++uThreads)
+        {
+            const double TIME_PER_OPERATION = MeasureThreads_TestMethod(Delegate<void()>(&TestClass::LockExclusively), THREAD_COUNTS[uThreads]);
+
+            BOOST_TEST_MESSAGE(szDescription << ", critical section of " << CRITICAL_SECTION_LENGTHS[uLength] << " iterations, " << 
+                               THREAD_COUNTS[uThreads] << " threads: " << TIME_PER_OPERATION << " ns per lock");
+        }
+    }
+}
+
+/// <summary>
+/// Measures a shared mutex for every combination of number of threads and proportion of exclusive locks.
+/// </summary>
+template<class MutexT>
+void MeasureSharedContention_TestMethod(const char* szDescription)
+{
+    typedef MutexTestClass<MutexT> TestClass;
+
+    MutexT mutex;
+    TestClass::sm_pMutex = &mutex;
+    TestClass::sm_uCriticalSectionLength = CRITICAL_SECTION_LENGTHS[1];
+
+    for(unsigned int uPeriod = 0; uPeriod < sizeof(WRITE_PERIODS) / sizeof(unsigned int); ++uPeriod)
+    {
+        TestClass::sm_uWritePeriod = WRITE_PERIODS[uPeriod];
+
+        for(unsigned int uThreads = 0; uThreads < sizeof(THREAD_COUNTS) / sizeof(unsigned int); ++uThreads)
+        {
+            const double TIME_PER_OPERATION = MeasureThreads_TestMethod(Delegate<void()>(&TestClass::ReadOrWrite), THREAD_COUNTS[uThreads]);
+
+            if(WRITE_PERIODS[uPeriod] == 0)
+                BOOST_TEST_MESSAGE(szDescription << ", only readers, " << THREAD_COUNTS[uThreads] << " threads: " << TIME_PER_OPERATION << " ns per lock");
+            else
+                BOOST_TEST_MESSAGE(szDescription << ", 1 writer out of " << WRITE_PERIODS[uPeriod] << ", " << 
+                                   THREAD_COUNTS[uThreads] << " threads: " << TIME_PER_OPERATION << " ns per lock");
+        }
+    }
+}
+
+/// <summary>
+/// Measures the mutex of the library.
+/// </summary>
+ZTEST_CASE ( Mutex_MeasuresContentionMatrix_Test )
+{
+    MeasureExclusiveContention_TestMethod<Mutex>("Mutex");
+}
+
+/// <summary>
+/// Measures the mutex of Boost libraries, for comparison.
+/// </summary>
+ZTEST_CASE ( BoostMutex_MeasuresContentionMatrix_Test )
+{
+    MeasureExclusiveContention_TestMethod<BoostMutex>("boost::mutex");
+}
+
+/// <summary>
+/// Measures the shared mutex of the library.
+/// </summary>
+ZTEST_CASE ( SharedMutex_MeasuresContentionMatrix_Test )
+{
+    MeasureSharedContention_TestMethod<SharedMutex>("SharedMutex");
+}
+
+/// <summary>
+/// Measures the shared mutex of Boost libraries, for comparison.
+/// </summary>
+ZTEST_CASE ( BoostSharedMutex_MeasuresContentionMatrix_Test )
+{
+    MeasureSharedContention_TestMethod<BoostSharedMutex>("boost::shared_mutex");
+}
+
+// End - Test Suite: Mutex
+ZTEST_SUITE_END()
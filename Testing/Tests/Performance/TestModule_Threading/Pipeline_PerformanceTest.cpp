@@ -0,0 +1,255 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/Pipeline.h"
+
+#include "ZFileSystem/FileStream.h"
+#include "ZFileSystem/SFile.h"
+#include "ZIO/TextStreamReader.h"
+#include "ZIO/TextStreamWriter.h"
+#include "ZContainers/QueueMpmc.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( Pipeline_PerformanceTestSuite )
+
+/// <summary>
+/// Number of lines of the text file read in every measurement.
+/// </summary>
+static const u32_z LINE_COUNT = 20000U;
+
+/// <summary>
+/// Number of times the characters of every line are traversed when processing it, which determines the cost of the processing stage.
+/// </summary>
+static const u32_z PROCESSING_ROUNDS = 20U;
+
+/// <summary>
+/// Maximum number of lines in flight in the pipeline.
+/// </summary>
+static const puint_z TOKEN_LIMIT = 16U;
+
+/// <summary>
+/// Numbers of threads that process lines at the same time.
+/// </summary>
+static const u32_z PROCESSING_CONCURRENCIES[] = { 1U, 4U };
+
+/// <summary>
+/// Path to the text file read in every measurement.
+/// </summary>
+static const char* FILE_PATH = "./PipelinePerformanceTest.txt";
+
+// A line read from the file, which is the token that flows through the pipeline
+class LineToken
+{
+public:
+
+    string_z m_strLine;
+    u64_z m_uChecksum;
+};
+
+// Class whose methods are the stages of the pipeline: read a line, process it, accumulate the result
+class PipelinePerformanceTestClass
+{
+public:
+
+    static FileStream* sm_pStream;
+    static TextStreamReader<FileStream>* sm_pReader;
+    static LineToken sm_arTokens[TOKEN_LIMIT];
+    static QueueMpmc<LineToken*>* sm_pFreeTokens;
+    static u64_z sm_uTotal;
+
+    // Opens the file and fills the list of free tokens
+    static void Open()
+    {
+        EFileSystemError eErrorInfo = EFileSystemError::E_Unknown;
+        sm_pStream = new FileStream(Path(FILE_PATH), EFileOpenMode::E_Open, 65536U, eErrorInfo);
+        sm_pReader = new TextStreamReader<FileStream>(*sm_pStream, ETextEncoding::E_ASCII);
+        sm_pFreeTokens = new QueueMpmc<LineToken*>(TOKEN_LIMIT);
+        sm_uTotal = 0;
+
+        for(puint_z i = 0; i < TOKEN_LIMIT; ++i)
+            sm_pFreeTokens->TryEnqueue(&sm_arTokens[i]);
+    }
+
+    static void Close()
+    {
+        delete sm_pFreeTokens;
+        delete sm_pReader;
+        delete sm_pStream;
+    }
+
+    // Reads the next line into a free token; there is always one because there cannot be more tokens in flight than the limit
+    static void* ReadLine(void*)
+    {
+        LineToken* pToken = null_z;
+
+        if(sm_pStream->GetPosition() != sm_pStream->GetLength())
+        {
+            sm_pFreeTokens->TryDequeue(pToken);
+            pToken->m_strLine = string_z::GetEmpty();
+            sm_pReader->ReadLine(pToken->m_strLine);
+        }
+
+        return pToken;
+    }
+
+    // Calculates a checksum of every word of the line
+    static void* ProcessLine(void* pData)
+    {
+        LineToken* pToken = scast_z(pData, LineToken*);
+        ArrayResult<string_z> arWords = pToken->m_strLine.Split(" ");
+        u64_z uChecksum = 14695981039346656037ULL;
+
+        for(u32_z uRound = 0; uRound < PROCESSING_ROUNDS; ++uRound)
+        {
+            for(puint_z i = 0; i < arWords.GetCount(); ++i)
+            {
+                const string_z &strWord = arWords.Get()[i];
+
+                for(unsigned int j = 0; j < strWord.GetLength(); ++j)
+                    uChecksum = (uChecksum ^ strWord[j].GetCodePoint()) * 1099511628211ULL;
+            }
+        }
+
+        pToken->m_uChecksum = uChecksum;
+        return pToken;
+    }
+
+    // Accumulates the checksum and releases the token
+    static void* Accumulate(void* pData)
+    {
+        LineToken* pToken = scast_z(pData, LineToken*);
+        sm_uTotal += pToken->m_uChecksum;
+        sm_pFreeTokens->TryEnqueue(pToken);
+        return pToken;
+    }
+};
+
+FileStream* PipelinePerformanceTestClass::sm_pStream = null_z;
+TextStreamReader<FileStream>* PipelinePerformanceTestClass::sm_pReader = null_z;
+LineToken PipelinePerformanceTestClass::sm_arTokens[TOKEN_LIMIT];
+QueueMpmc<LineToken*>* PipelinePerformanceTestClass::sm_pFreeTokens = null_z;
+u64_z PipelinePerformanceTestClass::sm_uTotal = 0;
+
+/// <summary>
+/// Writes the text file read by the tests, if it does not exist.
+/// </summary>
+void CreateFile_TestMethod()
+{
+    EFileSystemError eErrorInfo = EFileSystemError::E_Unknown;
+
+    if(!SFile::Exists(Path(FILE_PATH), eErrorInfo))
+    {
+        FileStream stream(Path(FILE_PATH), EFileOpenMode::E_Create, 65536U, eErrorInfo);
+        TextStreamWriter<FileStream> writer(stream, ETextEncoding::E_ASCII);
+
+        for(u32_z i = 0; i < LINE_COUNT; ++i)
+            writer.WriteLine(string_z("record ") + string_z::FromInteger(i) + " alpha beta gamma delta epsilon " + string_z::FromInteger(i * 7U));
+
+        stream.Flush();
+    }
+}
+
+/// <summary>
+/// Prints the statistics of every stage of a pipeline.
+/// </summary>
+void PrintStatistics_TestMethod(const Pipeline &pipeline)
+{
+    static const char* STAGE_NAMES[] = { "read", "process", "accumulate" };
+
+    for(puint_z i = 0; i < pipeline.GetStageCount(); ++i)
+    {
+        const PipelineStageStatistics STATISTICS = pipeline.GetStageStatistics(i);
+
+        BOOST_TEST_MESSAGE("    " << STAGE_NAMES[i] << ": " << STATISTICS.GetProcessedCount() << " lines, " << STATISTICS.GetWorkerCount() << " threads, " << 
+                           STATISTICS.GetThroughput() << " lines per second, average queue depth " << STATISTICS.GetAverageQueueDepth() << 
+                           ", maximum queue depth " << STATISTICS.GetMaximumQueueDepth());
+    }
+}
+
+/// <summary>
+/// Measures reading, processing and accumulating the lines one after another in the calling thread, for comparison.
+/// </summary>
+ZTEST_CASE ( Serial_MeasuresReadProcessAccumulate_Test )
+{
+    CreateFile_TestMethod();
+    PipelinePerformanceTestClass::Open();
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    void* pToken = PipelinePerformanceTestClass::ReadLine(null_z);
+
+    while(pToken != null_z)
+    {
+        PipelinePerformanceTestClass::Accumulate(PipelinePerformanceTestClass::ProcessLine(pToken));
+        pToken = PipelinePerformanceTestClass::ReadLine(null_z);
+    }
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    PipelinePerformanceTestClass::Close();
+
+    BOOST_TEST_MESSAGE("Serial loop: " << scast_z(uElapsedNanoseconds, double) / LINE_COUNT << " ns per line");
+}
+
+/// <summary>
+/// Measures reading, processing and accumulating the lines in a pipeline, with several numbers of processing threads.
+/// </summary>
+ZTEST_CASE ( Pipeline_MeasuresReadProcessAccumulate_Test )
+{
+    CreateFile_TestMethod();
+
+    for(u32_z i = 0; i < sizeof(PROCESSING_CONCURRENCIES) / sizeof(u32_z); ++i)
+    {
+        Pipeline pipeline;
+        pipeline.AddStage(Pipeline::StageFunction(&PipelinePerformanceTestClass::ReadLine), EPipelineStageMode::E_SerialInOrder, 1U);
+        pipeline.AddStage(Pipeline::StageFunction(&PipelinePerformanceTestClass::ProcessLine), EPipelineStageMode::E_Parallel, PROCESSING_CONCURRENCIES[i]);
+        pipeline.AddStage(Pipeline::StageFunction(&PipelinePerformanceTestClass::Accumulate), EPipelineStageMode::E_SerialInOrder, 1U);
+        PipelinePerformanceTestClass::Open();
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        pipeline.Run(TOKEN_LIMIT);
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+        PipelinePerformanceTestClass::Close();
+
+        BOOST_TEST_MESSAGE("Pipeline, " << PROCESSING_CONCURRENCIES[i] << " processing threads, " << TOKEN_LIMIT << " tokens: " << 
+                           scast_z(uElapsedNanoseconds, double) / LINE_COUNT << " ns per line");
+        PrintStatistics_TestMethod(pipeline);
+    }
+}
+
+// End - Test Suite: Pipeline
+ZTEST_SUITE_END()
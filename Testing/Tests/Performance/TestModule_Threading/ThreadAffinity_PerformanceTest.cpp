@@ -0,0 +1,215 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/SProcessorTopology.h"
+
+#include "ZTiming/CycleStopwatch.h"
+#include <boost/atomic.hpp>
+
+
+ZTEST_SUITE_BEGIN( ThreadAffinity_PerformanceTestSuite )
+
+/// <summary>
+/// Number of round trips measured in every test.
+/// </summary>
+static const unsigned int ROUND_TRIPS_COUNT = 100000U;
+
+/// <summary>
+/// Number of failed checks of the shared flag after which the waiting thread yields, so the test does not get stuck when both threads share a processor.
+/// </summary>
+static const unsigned int SPINS_BEFORE_YIELDING = 1000U;
+
+// Class whose methods are used in the ping-pong tests
+class PingPongTestClass
+{
+public:
+
+    /// <summary>
+    /// The flag both threads write in turns; it stores the number of the last round trip.
+    /// </summary>
+    static boost::atomic<unsigned int> sm_uBall;
+
+    static void WaitForValue(const unsigned int uValue)
+    {
+        unsigned int uSpins = 0;
+
+        while(sm_uBall.load(boost::memory_order_acquire) != uValue)
+        {
+            if(++uSpins == SPINS_BEFORE_YIELDING)
+            {
+                SThisThread::Yield();
+                uSpins = 0;
+            }
+        }
+    }
+
+    static void Pong(const u32_z uProcessor)
+    {
+        if(uProcessor != ProcessorSet::NO_PROCESSOR)
+            SThisThread::SetAffinity(ProcessorSet(uProcessor));
+
+        for(unsigned int i = 0; i < ROUND_TRIPS_COUNT; ++i)
+        {
+            PingPongTestClass::WaitForValue(2U * i + 1U);
+            sm_uBall.store(2U * i + 2U, boost::memory_order_release);
+        }
+    }
+};
+
+boost::atomic<unsigned int> PingPongTestClass::sm_uBall(0);
+
+/// <summary>
+/// Bounces a value between the calling thread and another thread, each one bound to a processor, and writes the average round trip latency.
+/// </summary>
+void MeasurePingPong_TestMethod(const char* szDescription, const u32_z uPingProcessor, const u32_z uPongProcessor)
+{
+    const ProcessorSet ORIGINAL_AFFINITY = SThisThread::GetAffinity();
+
+    if(uPingProcessor != ProcessorSet::NO_PROCESSOR)
+        SThisThread::SetAffinity(ProcessorSet(uPingProcessor));
+
+    PingPongTestClass::sm_uBall.store(0);
+    Thread pongThread(Delegate<void(const u32_z)>(&PingPongTestClass::Pong), uPongProcessor);
+
+    CycleStopwatch measurer;
+    measurer.Set();
+
+    for(unsigned int i = 0; i < ROUND_TRIPS_COUNT; ++i)
+    {
+        PingPongTestClass::sm_uBall.store(2U * i + 1U, boost::memory_order_release);
+        PingPongTestClass::WaitForValue(2U * i + 2U);
+    }
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    pongThread.Join();
+    SThisThread::SetAffinity(ORIGINAL_AFFINITY);
+
+    if(uPingProcessor != ProcessorSet::NO_PROCESSOR)
+        BOOST_TEST_MESSAGE(szDescription << ": processors " << uPingProcessor << " and " << uPongProcessor);
+
+    BOOST_TEST_MESSAGE(szDescription << ": " << 
+                       scast_z(uElapsedNanoseconds, double) / ROUND_TRIPS_COUNT << " ns per round trip");
+    BOOST_CHECK_EQUAL(PingPongTestClass::sm_uBall.load(), 2U * ROUND_TRIPS_COUNT);
+}
+
+/// <summary>
+/// Finds a processor, among those the calling thread can run on, that fulfills a condition with respect to a given processor.
+/// </summary>
+u32_z FindPartner_TestMethod(const u32_z uProcessor, const ProcessorSet &candidates)
+{
+    const ProcessorSet ALLOWED_PROCESSORS = SThisThread::GetAffinity();
+    u32_z uPartner = ProcessorSet::NO_PROCESSOR;
+
+    for(u32_z i = candidates.GetNext(0); i != ProcessorSet::NO_PROCESSOR && uPartner == ProcessorSet::NO_PROCESSOR; i = candidates.GetNext(i + 1U))
+        if(i != uProcessor && ALLOWED_PROCESSORS.Contains(i))
+            uPartner = i;
+
+    return uPartner;
+}
+
+/// <summary>
+/// Measures the round trip latency when the operating system decides where both threads run.
+/// </summary>
+ZTEST_CASE ( PingPong_MeasuresLatencyWhenThreadsAreNotPinned_Test )
+{
+    MeasurePingPong_TestMethod("Not pinned", ProcessorSet::NO_PROCESSOR, ProcessorSet::NO_PROCESSOR);
+}
+
+/// <summary>
+/// Measures the round trip latency when both threads are pinned to the same processor.
+/// </summary>
+ZTEST_CASE ( PingPong_MeasuresLatencyWhenThreadsArePinnedToSameProcessor_Test )
+{
+    const u32_z PROCESSOR = SThisThread::GetAffinity().GetNext(0);
+
+    MeasurePingPong_TestMethod("Same processor", PROCESSOR, PROCESSOR);
+}
+
+/// <summary>
+/// Measures the round trip latency when threads are pinned to two SMT siblings, which share the same physical core.
+/// </summary>
+ZTEST_CASE ( PingPong_MeasuresLatencyWhenThreadsArePinnedToSmtSiblings_Test )
+{
+    const u32_z PROCESSOR = SThisThread::GetAffinity().GetNext(0);
+    const u32_z PARTNER = FindPartner_TestMethod(PROCESSOR, SProcessorTopology::GetSmtSiblings(PROCESSOR));
+
+    if(PARTNER != ProcessorSet::NO_PROCESSOR)
+        MeasurePingPong_TestMethod("SMT siblings", PROCESSOR, PARTNER);
+    else
+        BOOST_TEST_MESSAGE("SMT siblings: Not available in this machine");
+}
+
+/// <summary>
+/// Measures the round trip latency when threads are pinned to different cores that share the L3 cache.
+/// </summary>
+ZTEST_CASE ( PingPong_MeasuresLatencyWhenThreadsArePinnedToCoresSharingL3Cache_Test )
+{
+    const u32_z PROCESSOR = SThisThread::GetAffinity().GetNext(0);
+    ProcessorSet candidates = SProcessorTopology::GetProcessorsSharingCache(PROCESSOR, 3U);
+    const ProcessorSet SIBLINGS = SProcessorTopology::GetSmtSiblings(PROCESSOR);
+
+    for(u32_z i = SIBLINGS.GetNext(0); i != ProcessorSet::NO_PROCESSOR; i = SIBLINGS.GetNext(i + 1U))
+        candidates.Remove(i);
+
+    const u32_z PARTNER = FindPartner_TestMethod(PROCESSOR, candidates);
+
+    if(PARTNER != ProcessorSet::NO_PROCESSOR)
+        MeasurePingPong_TestMethod("Different cores, same L3", PROCESSOR, PARTNER);
+    else
+        BOOST_TEST_MESSAGE("Different cores, same L3: Not available in this machine");
+}
+
+/// <summary>
+/// Measures the round trip latency when threads are pinned to processors in different packages (sockets).
+/// </summary>
+ZTEST_CASE ( PingPong_MeasuresLatencyWhenThreadsArePinnedToDifferentPackages_Test )
+{
+    const u32_z PROCESSOR = SThisThread::GetAffinity().GetNext(0);
+    const u32_z PACKAGE = SProcessorTopology::GetPackage(PROCESSOR);
+    u32_z uPartner = ProcessorSet::NO_PROCESSOR;
+
+    for(u32_z i = 0; i < SProcessorTopology::GetPackageCount() && uPartner == ProcessorSet::NO_PROCESSOR; ++i)
+        if(i != PACKAGE)
+            uPartner = FindPartner_TestMethod(PROCESSOR, SProcessorTopology::GetPackageProcessors(i));
+
+    if(uPartner != ProcessorSet::NO_PROCESSOR)
+        MeasurePingPong_TestMethod("Different packages", PROCESSOR, uPartner);
+    else
+        BOOST_TEST_MESSAGE("Different packages: Not available in this machine");
+}
+
+// End - Test Suite: ThreadAffinity
+ZTEST_SUITE_END()
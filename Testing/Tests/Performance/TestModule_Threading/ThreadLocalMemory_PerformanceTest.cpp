@@ -0,0 +1,237 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/ThreadLocalObjectPool.h"
+#include "ZMemory/ScopedScratchMark.h"
+
+#include "ZThreading/Thread.h"
+#include "ZTiming/CycleStopwatch.h"
+#include <boost/atomic.hpp>
+
+
+ZTEST_SUITE_BEGIN( ThreadLocalMemory_PerformanceTestSuite )
+
+/// <summary>
+/// Number of times every thread allocates and frees temporary memory in every measurement.
+/// </summary>
+static const unsigned int OPERATIONS_PER_THREAD = 200000U;
+
+/// <summary>
+/// Numbers of threads that allocate memory at the same time.
+/// </summary>
+static const unsigned int THREAD_COUNTS[] = { 1U, 4U };
+
+/// <summary>
+/// Number of temporary buffers used in every operation.
+/// </summary>
+static const unsigned int BUFFERS_PER_OPERATION = 3U;
+
+/// <summary>
+/// Size, in bytes, of every temporary buffer.
+/// </summary>
+static const puint_z BUFFER_SIZE = 256U;
+
+// An object of the size of a typical short-lived temporary
+struct TemporaryObject
+{
+    explicit TemporaryObject(const u64_z uValue)
+    {
+        for(unsigned int i = 0; i < sizeof(m_arValues) / sizeof(u64_z); ++i)
+            m_arValues[i] = uValue + i;
+    }
+
+    u64_z m_arValues[8];
+};
+
+// Class whose methods are executed by the threads, and that counts the memory blocks allocated in the heap
+class ThreadLocalMemoryTestClass
+{
+public:
+
+    static boost::atomic<u64_z> sm_uHeapAllocations;
+    static ThreadLocalObjectPool<TemporaryObject>* sm_pPool;
+    static volatile u64_z sm_uSink;
+
+    static void UseHeapBuffers()
+    {
+        u64_z uSum = 0;
+
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            u8_z* arBuffers[BUFFERS_PER_OPERATION];
+
+            for(unsigned int j = 0; j < BUFFERS_PER_OPERATION; ++j)
+            {
+                arBuffers[j] = new u8_z[BUFFER_SIZE];
+                arBuffers[j][0] = scast_z(i + j, u8_z);
+                uSum += arBuffers[j][0];
+            }
+
+            for(unsigned int j = 0; j < BUFFERS_PER_OPERATION; ++j)
+                delete[] arBuffers[j];
+        }
+
+        sm_uHeapAllocations.fetch_add(OPERATIONS_PER_THREAD * BUFFERS_PER_OPERATION);
+        sm_uSink = uSum;
+    }
+
+    static void UseScratchBuffers()
+    {
+        ScratchAllocator &scratchAllocator = SThisThread::GetScratchAllocator();
+        const puint_z OVERFLOW_COUNT_BEFORE = scratchAllocator.GetOverflowCount();
+        u64_z uSum = 0;
+
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            ScopedScratchMark scratchMark(scratchAllocator);
+
+            for(unsigned int j = 0; j < BUFFERS_PER_OPERATION; ++j)
+            {
+                u8_z* arBuffer = scast_z(scratchAllocator.Allocate(BUFFER_SIZE), u8_z*);
+                arBuffer[0] = scast_z(i + j, u8_z);
+                uSum += arBuffer[0];
+            }
+        }
+
+        sm_uHeapAllocations.fetch_add(scratchAllocator.GetOverflowCount() - OVERFLOW_COUNT_BEFORE);
+        sm_uSink = uSum;
+    }
+
+    static void UseHeapObjects()
+    {
+        u64_z uSum = 0;
+
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            TemporaryObject* pObject = new TemporaryObject(i);
+            uSum += pObject->m_arValues[7];
+            delete pObject;
+        }
+
+        sm_uHeapAllocations.fetch_add(OPERATIONS_PER_THREAD);
+        sm_uSink = uSum;
+    }
+
+    static void UsePooledObjects()
+    {
+        const puint_z OVERFLOW_COUNT_BEFORE = sm_pPool->GetThreadPool().GetOverflowCount();
+        u64_z uSum = 0;
+
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            TemporaryObject* pObject = sm_pPool->Borrow(scast_z(i, u64_z));
+            uSum += pObject->m_arValues[7];
+            sm_pPool->Return(pObject);
+        }
+
+        sm_uHeapAllocations.fetch_add(sm_pPool->GetThreadPool().GetOverflowCount() - OVERFLOW_COUNT_BEFORE);
+        sm_uSink = uSum;
+    }
+};
+
+boost::atomic<u64_z> ThreadLocalMemoryTestClass::sm_uHeapAllocations(0);
+ThreadLocalObjectPool<TemporaryObject>* ThreadLocalMemoryTestClass::sm_pPool = null_z;
+volatile u64_z ThreadLocalMemoryTestClass::sm_uSink = 0;
+
+/// <summary>
+/// Executes a function in several numbers of threads at the same time and prints the average time per operation, in nanoseconds, and 
+/// the number of memory blocks allocated in the heap.
+/// </summary>
+void MeasureThreads_TestMethod(const Delegate<void()> &function, const char* szDescription)
+{
+    Thread* arThreads[4];
+
+    for(unsigned int uThreads = 0; uThreads < sizeof(THREAD_COUNTS) / sizeof(unsigned int); ++uThreads)
+    {
+        const unsigned int THREAD_COUNT = THREAD_COUNTS[uThreads];
+        ThreadLocalMemoryTestClass::sm_uHeapAllocations = 0;
+
+        CycleStopwatch measurer;
+        measurer.Set();
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            arThreads[i] = new Thread(function);
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            arThreads[i]->Join();
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+        for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+            delete arThreads[i];
+
+        const double TIME_PER_OPERATION = scast_z(uElapsedNanoseconds, double) / (OPERATIONS_PER_THREAD * THREAD_COUNT);
+
+        BOOST_TEST_MESSAGE(szDescription << ", " << THREAD_COUNT << " threads: " << TIME_PER_OPERATION << " ns per operation, " << 
+                           ThreadLocalMemoryTestClass::sm_uHeapAllocations.load() << " heap allocations");
+    }
+}
+
+/// <summary>
+/// Measures temporary buffers allocated in the heap, for comparison.
+/// </summary>
+ZTEST_CASE ( HeapBuffers_MeasuresTemporaryBuffers_Test )
+{
+    MeasureThreads_TestMethod(Delegate<void()>(&ThreadLocalMemoryTestClass::UseHeapBuffers), "new[]/delete[], 3 buffers of 256 bytes");
+}
+
+/// <summary>
+/// Measures temporary buffers allocated in the scratch allocator of every thread.
+/// </summary>
+ZTEST_CASE ( ScratchAllocator_MeasuresTemporaryBuffers_Test )
+{
+    MeasureThreads_TestMethod(Delegate<void()>(&ThreadLocalMemoryTestClass::UseScratchBuffers), "ScratchAllocator, 3 buffers of 256 bytes");
+}
+
+/// <summary>
+/// Measures temporary objects allocated in the heap, for comparison.
+/// </summary>
+ZTEST_CASE ( HeapObjects_MeasuresTemporaryObjects_Test )
+{
+    MeasureThreads_TestMethod(Delegate<void()>(&ThreadLocalMemoryTestClass::UseHeapObjects), "new/delete, objects of 64 bytes");
+}
+
+/// <summary>
+/// Measures temporary objects borrowed from the object pool of every thread.
+/// </summary>
+ZTEST_CASE ( ThreadLocalObjectPool_MeasuresTemporaryObjects_Test )
+{
+    ThreadLocalObjectPool<TemporaryObject> pool(16U);
+    ThreadLocalMemoryTestClass::sm_pPool = &pool;
+
+    MeasureThreads_TestMethod(Delegate<void()>(&ThreadLocalMemoryTestClass::UsePooledObjects), "ThreadLocalObjectPool, objects of 64 bytes");
+}
+
+// End - Test Suite: ThreadLocalMemory
+ZTEST_SUITE_END()
@@ -0,0 +1,277 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTime/STimeBatch.h"
+
+#include "ZTime/DateTime.h"
+#include "ZTime/TimeSpan.h"
+#include "ZTime/TimeZone.h"
+#include "ZTiming/CycleStopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( STimeBatch_PerformanceTestSuite )
+
+/// <summary>
+/// Number of instants processed in every test.
+/// </summary>
+static const puint_z INSTANTS_COUNT = 4000000U;
+
+/// <summary>
+/// Generates pseudo-random numbers quickly, so the generation does not affect the measurements.
+/// </summary>
+u64_z GetNextRandom_TestMethod(u64_z &uSeed)
+{
+    uSeed = uSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return uSeed >> 24U;
+}
+
+/// <summary>
+/// Fills an array of instants and an array of dates with the same random values, all of them around the year 2000.
+/// </summary>
+void FillInstants_TestMethod(u64_z* arInstants, DateTime* arDateTimes, u64_z &uSeed)
+{
+    const DateTime BASE_DATE_TIME(2000, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC);
+    u64_z uBaseInstant = 0;
+    STimeBatch::GetInstants(&BASE_DATE_TIME, 1U, &uBaseInstant);
+
+    for(puint_z i = 0; i < INSTANTS_COUNT; ++i)
+        arInstants[i] = uBaseInstant + GetNextRandom_TestMethod(uSeed);
+
+    STimeBatch::SetInstants(arInstants, INSTANTS_COUNT, arDateTimes);
+}
+
+/// <summary>
+/// Writes the time spent per element by the batch operation and by the equivalent loop over DateTime instances.
+/// </summary>
+void ReportResults_TestMethod(const char* szOperation, const u64_z uBatchNanoseconds, const u64_z uLoopNanoseconds)
+{
+    BOOST_TEST_MESSAGE("STimeBatch::" << szOperation << (STimeBatch::IsVectorized() ? " (AVX2): " : " (scalar): ") << 
+                       scast_z(uBatchNanoseconds, double) / INSTANTS_COUNT << " ns per instant; loop over DateTime: " << 
+                       scast_z(uLoopNanoseconds, double) / INSTANTS_COUNT << " ns per instant (x" << 
+                       scast_z(uLoopNanoseconds, double) / scast_z(uBatchNanoseconds, double) << ")");
+}
+
+/// <summary>
+/// Measures the time spent adding a time span to every instant, compared to adding it to every DateTime.
+/// </summary>
+ZTEST_CASE ( Add_MeasuresTimePerInstantComparedToDateTimeLoop_Test )
+{
+    // [Preparation]
+    const TimeSpan TIME_SPAN(0, 1, 30, 0, 0, 0, 0);
+    u64_z* arInstants = new u64_z[INSTANTS_COUNT];
+    u64_z* arResults = new u64_z[INSTANTS_COUNT](); // Initialized so memory pages are not mapped while measuring
+    DateTime* arDateTimes = new DateTime[INSTANTS_COUNT];
+    DateTime* arResultDateTimes = new DateTime[INSTANTS_COUNT];
+    u64_z uSeed = 0;
+    FillInstants_TestMethod(arInstants, arDateTimes, uSeed);
+    CycleStopwatch measurer;
+
+    // [Execution]
+    measurer.Set();
+    STimeBatch::Add(arInstants, INSTANTS_COUNT, TIME_SPAN, arResults);
+    u64_z uBatchNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    measurer.Set();
+
+    for(puint_z i = 0; i < INSTANTS_COUNT; ++i)
+        arResultDateTimes[i] = arDateTimes[i] + TIME_SPAN;
+
+    u64_z uLoopNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    ReportResults_TestMethod("Add", uBatchNanoseconds, uLoopNanoseconds);
+
+    delete[] arInstants;
+    delete[] arResults;
+    delete[] arDateTimes;
+    delete[] arResultDateTimes;
+}
+
+/// <summary>
+/// Measures the time spent subtracting a time span from every instant, compared to subtracting it from every DateTime.
+/// </summary>
+ZTEST_CASE ( Subtract_MeasuresTimePerInstantComparedToDateTimeLoop_Test )
+{
+    // [Preparation]
+    const TimeSpan TIME_SPAN(0, 1, 30, 0, 0, 0, 0);
+    u64_z* arInstants = new u64_z[INSTANTS_COUNT];
+    u64_z* arResults = new u64_z[INSTANTS_COUNT](); // Initialized so memory pages are not mapped while measuring
+    DateTime* arDateTimes = new DateTime[INSTANTS_COUNT];
+    DateTime* arResultDateTimes = new DateTime[INSTANTS_COUNT];
+    u64_z uSeed = 0;
+    FillInstants_TestMethod(arInstants, arDateTimes, uSeed);
+    CycleStopwatch measurer;
+
+    // [Execution]
+    measurer.Set();
+    STimeBatch::Subtract(arInstants, INSTANTS_COUNT, TIME_SPAN, arResults);
+    u64_z uBatchNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    measurer.Set();
+
+    for(puint_z i = 0; i < INSTANTS_COUNT; ++i)
+        arResultDateTimes[i] = arDateTimes[i] - TIME_SPAN;
+
+    u64_z uLoopNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    ReportResults_TestMethod("Subtract", uBatchNanoseconds, uLoopNanoseconds);
+
+    delete[] arInstants;
+    delete[] arResults;
+    delete[] arDateTimes;
+    delete[] arResultDateTimes;
+}
+
+/// <summary>
+/// Measures the time spent calculating the difference between pairs of instants, compared to subtracting pairs of DateTimes.
+/// </summary>
+ZTEST_CASE ( Difference_MeasuresTimePerInstantComparedToDateTimeLoop_Test )
+{
+    // [Preparation]
+    u64_z* arInstantsA = new u64_z[INSTANTS_COUNT];
+    u64_z* arInstantsB = new u64_z[INSTANTS_COUNT];
+    u64_z* arResults = new u64_z[INSTANTS_COUNT](); // Initialized so memory pages are not mapped while measuring
+    DateTime* arDateTimesA = new DateTime[INSTANTS_COUNT];
+    DateTime* arDateTimesB = new DateTime[INSTANTS_COUNT];
+    TimeSpan* arResultTimeSpans = new TimeSpan[INSTANTS_COUNT];
+    u64_z uSeed = 0;
+    FillInstants_TestMethod(arInstantsA, arDateTimesA, uSeed);
+    FillInstants_TestMethod(arInstantsB, arDateTimesB, uSeed);
+    CycleStopwatch measurer;
+
+    // [Execution]
+    measurer.Set();
+    STimeBatch::Difference(arInstantsA, arInstantsB, INSTANTS_COUNT, arResults);
+    u64_z uBatchNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    measurer.Set();
+
+    for(puint_z i = 0; i < INSTANTS_COUNT; ++i)
+        arResultTimeSpans[i] = arDateTimesA[i] - arDateTimesB[i];
+
+    u64_z uLoopNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    ReportResults_TestMethod("Difference", uBatchNanoseconds, uLoopNanoseconds);
+
+    delete[] arInstantsA;
+    delete[] arInstantsB;
+    delete[] arResults;
+    delete[] arDateTimesA;
+    delete[] arDateTimesB;
+    delete[] arResultTimeSpans;
+}
+
+/// <summary>
+/// Measures the time spent assigning every instant to a one-minute window, compared to dividing the distance between every DateTime and the origin.
+/// </summary>
+ZTEST_CASE ( Bin_MeasuresTimePerInstantComparedToDateTimeLoop_Test )
+{
+    // [Preparation]
+    const TimeSpan WINDOW_LENGTH(0, 0, 1, 0, 0, 0, 0);
+    u64_z* arInstants = new u64_z[INSTANTS_COUNT];
+    u64_z* arResults = new u64_z[INSTANTS_COUNT](); // Initialized so memory pages are not mapped while measuring
+    DateTime* arDateTimes = new DateTime[INSTANTS_COUNT];
+    u64_z uSeed = 0;
+    FillInstants_TestMethod(arInstants, arDateTimes, uSeed);
+    const DateTime ORIGIN(2000, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC);
+    u64_z uOrigin = 0;
+    STimeBatch::GetInstants(&ORIGIN, 1U, &uOrigin);
+    const u64_z WINDOW_HUNDREDS_OF_NANOSECONDS = WINDOW_LENGTH.GetHundredsOfNanoseconds();
+    CycleStopwatch measurer;
+
+    // [Execution]
+    measurer.Set();
+    STimeBatch::Bin(arInstants, INSTANTS_COUNT, uOrigin, WINDOW_LENGTH, arResults);
+    u64_z uBatchNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    measurer.Set();
+
+    for(puint_z i = 0; i < INSTANTS_COUNT; ++i)
+        arResults[i] = (arDateTimes[i] - ORIGIN).GetHundredsOfNanoseconds() / WINDOW_HUNDREDS_OF_NANOSECONDS;
+
+    u64_z uLoopNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    ReportResults_TestMethod("Bin", uBatchNanoseconds, uLoopNanoseconds);
+
+    delete[] arInstants;
+    delete[] arResults;
+    delete[] arDateTimes;
+}
+
+/// <summary>
+/// Measures the time spent searching for the minimum and the maximum instants, compared to comparing every DateTime.
+/// </summary>
+ZTEST_CASE ( GetMinimumGetMaximum_MeasuresTimePerInstantComparedToDateTimeLoop_Test )
+{
+    // [Preparation]
+    u64_z* arInstants = new u64_z[INSTANTS_COUNT];
+    DateTime* arDateTimes = new DateTime[INSTANTS_COUNT];
+    u64_z uSeed = 0;
+    FillInstants_TestMethod(arInstants, arDateTimes, uSeed);
+    CycleStopwatch measurer;
+
+    // [Execution]
+    measurer.Set();
+    u64_z uMinimum = STimeBatch::GetMinimum(arInstants, INSTANTS_COUNT);
+    u64_z uMaximum = STimeBatch::GetMaximum(arInstants, INSTANTS_COUNT);
+    u64_z uBatchNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    measurer.Set();
+    const DateTime* pMinimum = &arDateTimes[0];
+    const DateTime* pMaximum = &arDateTimes[0];
+
+    for(puint_z i = 1U; i < INSTANTS_COUNT; ++i)
+    {
+        pMinimum = arDateTimes[i] < *pMinimum ? &arDateTimes[i] : pMinimum;
+        pMaximum = arDateTimes[i] > *pMaximum ? &arDateTimes[i] : pMaximum;
+    }
+
+    u64_z uLoopNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    ReportResults_TestMethod("GetMinimum + GetMaximum", uBatchNanoseconds, uLoopNanoseconds);
+    u64_z uLoopMinimum = 0;
+    u64_z uLoopMaximum = 0;
+    STimeBatch::GetInstants(pMinimum, 1U, &uLoopMinimum);
+    STimeBatch::GetInstants(pMaximum, 1U, &uLoopMaximum);
+    BOOST_CHECK_EQUAL(uMinimum, uLoopMinimum);
+    BOOST_CHECK_EQUAL(uMaximum, uLoopMaximum);
+
+    delete[] arInstants;
+    delete[] arDateTimes;
+}
+
+// End - Test Suite: STimeBatch
+ZTEST_SUITE_END()
@@ -0,0 +1,140 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTiming/CoarseClock.h"
+
+#include "ZTiming/CycleStopwatch.h"
+#include "ZTiming/DateTimeNow.h"
+#include "ZTime/TimeSpan.h"
+
+
+ZTEST_SUITE_BEGIN( CoarseClock_PerformanceTestSuite )
+
+/// <summary>
+/// Number of timestamps obtained in every test.
+/// </summary>
+static const unsigned int TIMESTAMPS_COUNT = 10000000U;
+
+/// <summary>
+/// Obtains many timestamps from a clock and writes the time spent per timestamp and the number of different values observed.
+/// </summary>
+void MeasureClock_TestMethod(const char* szDescription, const CoarseClock &clock)
+{
+    CycleStopwatch measurer;
+    u64_z uPreviousInstant = 0;
+    unsigned int uChangesCount = 0;
+
+    measurer.Set();
+
+    for(unsigned int i = 0; i < TIMESTAMPS_COUNT; ++i)
+    {
+        const u64_z INSTANT = clock.GetUtcInstant();
+        uChangesCount += INSTANT != uPreviousInstant ? 1U : 0;
+        uPreviousInstant = INSTANT;
+    }
+
+    u64_z uInstantNanoseconds = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(unsigned int i = 0; i < TIMESTAMPS_COUNT; ++i)
+    {
+        const DateTime NOW = clock.GetUtcDateTime();
+        uChangesCount += NOW.IsUndefined() ? 1U : 0;
+    }
+
+    u64_z uDateTimeNanoseconds = measurer.GetElapsedTimeAsInteger();
+
+    BOOST_TEST_MESSAGE(szDescription << ": GetUtcInstant " << scast_z(uInstantNanoseconds, double) / TIMESTAMPS_COUNT << " ns, GetUtcDateTime " << 
+                       scast_z(uDateTimeNanoseconds, double) / TIMESTAMPS_COUNT << " ns per timestamp (" << uChangesCount << " different values in " << 
+                       scast_z(uInstantNanoseconds, double) / 1000000.0 << " ms)");
+}
+
+/// <summary>
+/// Measures the time spent creating a DateTimeNow, which reads the precise clock of the operating system, as a reference.
+/// </summary>
+ZTEST_CASE ( DateTimeNow_MeasuresTimePerTimestamp_Test )
+{
+    // [Preparation]
+    CycleStopwatch measurer;
+    unsigned int uUndefinedCount = 0;
+
+    // [Execution]
+    measurer.Set();
+
+    for(unsigned int i = 0; i < TIMESTAMPS_COUNT; ++i)
+    {
+        const DateTimeNow NOW(null_z);
+        uUndefinedCount += NOW.IsUndefined() ? 1U : 0;
+    }
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("DateTimeNow: " << scast_z(uElapsedNanoseconds, double) / TIMESTAMPS_COUNT << " ns per timestamp");
+    BOOST_CHECK_EQUAL(uUndefinedCount, 0U);
+}
+
+/// <summary>
+/// Measures the time spent obtaining a timestamp from a clock updated by its dedicated thread, using several update periods.
+/// </summary>
+ZTEST_CASE ( GetUtcInstant_MeasuresTimePerTimestampWithDedicatedThreadAndSeveralPeriods_Test )
+{
+    // [Preparation]
+    static const u64_z PERIODS_MICROSECONDS[] = { 100U, 1000U, 10000U };
+    static const unsigned int PERIODS_COUNT = sizeof(PERIODS_MICROSECONDS) / sizeof(u64_z);
+
+    for(unsigned int i = 0; i < PERIODS_COUNT; ++i)
+    {
+        CoarseClock clock(ECoarseClockMode::E_PublishedByThread, TimeSpan(0, 0, 0, 0, 0, PERIODS_MICROSECONDS[i], 0));
+        string_z strDescription = string_z("CoarseClock (dedicated thread, ") + string_z::FromInteger(PERIODS_MICROSECONDS[i]) + " us)";
+
+        // [Execution]
+        clock.Start();
+        MeasureClock_TestMethod(strDescription.ToBytes(ETextEncoding::E_ASCII).Get(), clock);
+        clock.Stop();
+    }
+}
+
+/// <summary>
+/// Measures the time spent obtaining a timestamp from the coarse clock of the operating system.
+/// </summary>
+ZTEST_CASE ( GetUtcInstant_MeasuresTimePerTimestampWithOperatingSystemCoarseClock_Test )
+{
+    // [Preparation]
+    CoarseClock clock(ECoarseClockMode::E_OperatingSystemCoarse, TimeSpan());
+
+    // [Execution]
+    MeasureClock_TestMethod("CoarseClock (operating system coarse clock)", clock);
+}
+
+// End - Test Suite: CoarseClock
+ZTEST_SUITE_END()
@@ -0,0 +1,180 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTiming/Stopwatch.h"
+
+#include "ZTiming/CycleStopwatch.h"
+#include "ZTiming/STimestampCounter.h"
+
+
+ZTEST_SUITE_BEGIN( Stopwatch_PerformanceTestSuite )
+
+/// <summary>
+/// Number of samples taken in every test.
+/// </summary>
+static const unsigned int SAMPLES_COUNT = 10000000U;
+
+/// <summary>
+/// Measures the average time spent reading the monotonic clock of the operating system.
+/// </summary>
+ZTEST_CASE ( _GetCurrentInstant_MeasuresOverheadPerSample_Test )
+{
+    // [Preparation]
+    CycleStopwatch measurer;
+    u64_z uAccumulator = 0;
+
+    // [Execution]
+    measurer.Set();
+
+    for(unsigned int i = 0; i < SAMPLES_COUNT; ++i)
+        uAccumulator += Stopwatch::_GetCurrentInstant();
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("Stopwatch::_GetCurrentInstant: " << scast_z(uElapsedNanoseconds, double) / SAMPLES_COUNT << " ns per sample (" << uAccumulator % 2 << ")");
+}
+
+#if defined(Z_OS_LINUX)
+
+/// <summary>
+/// Measures the average time spent reading the raw monotonic clock of Linux, which was used by previous versions of the Stopwatch.
+/// </summary>
+ZTEST_CASE ( ClockGetTime_MeasuresOverheadPerSampleOfRawMonotonicClock_Test )
+{
+    // [Preparation]
+    CycleStopwatch measurer;
+    u64_z uAccumulator = 0;
+    timespec timeSpecData;
+
+    // [Execution]
+    measurer.Set();
+
+    for(unsigned int i = 0; i < SAMPLES_COUNT; ++i)
+    {
+        ::clock_gettime(CLOCK_MONOTONIC_RAW, &timeSpecData);
+        uAccumulator += timeSpecData.tv_nsec;
+    }
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("clock_gettime(CLOCK_MONOTONIC_RAW): " << scast_z(uElapsedNanoseconds, double) / SAMPLES_COUNT << " ns per sample (" << uAccumulator % 2 << ")");
+}
+
+#endif
+
+/// <summary>
+/// Measures the average time spent reading the timestamp counter.
+/// </summary>
+ZTEST_CASE ( GetCycles_MeasuresOverheadPerSample_Test )
+{
+    if(STimestampCounter::IsAvailable())
+    {
+        // [Preparation]
+        CycleStopwatch measurer;
+        u64_z uAccumulator = 0;
+
+        // [Execution]
+        measurer.Set();
+
+        for(unsigned int i = 0; i < SAMPLES_COUNT; ++i)
+            uAccumulator += STimestampCounter::GetCycles();
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+        // [Verification]
+        BOOST_TEST_MESSAGE("STimestampCounter::GetCycles: " << scast_z(uElapsedNanoseconds, double) / SAMPLES_COUNT << " ns per sample (" << uAccumulator % 2 << ")");
+    }
+    else
+    {
+        BOOST_TEST_MESSAGE("The timestamp counter is not available on this machine.");
+    }
+}
+
+/// <summary>
+/// Measures the average time spent getting the elapsed time of a stopwatch, for every clock source.
+/// </summary>
+ZTEST_CASE ( GetElapsedTimeAsInteger_MeasuresOverheadPerSampleForEveryClockSource_Test )
+{
+    const ArrayBasic<const EClockSource::EnumType> CLOCK_SOURCES = EClockSource::GetValues();
+
+    for(unsigned int iSource = 0; iSource < CLOCK_SOURCES.GetCount(); ++iSource)
+    {
+        // [Preparation]
+        const EClockSource SOURCE = CLOCK_SOURCES[iSource];
+        Stopwatch stopwatch(SOURCE);
+        stopwatch.Set();
+        CycleStopwatch measurer;
+        u64_z uAccumulator = 0;
+
+        // [Execution]
+        measurer.Set();
+
+        for(unsigned int i = 0; i < SAMPLES_COUNT; ++i)
+            uAccumulator += stopwatch.GetElapsedTimeAsInteger();
+
+        u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+        // [Verification]
+        BOOST_TEST_MESSAGE("Stopwatch::GetElapsedTimeAsInteger (requested " << SOURCE.ToString() << ", used " << stopwatch.GetClockSource().ToString() << "): " << 
+                           scast_z(uElapsedNanoseconds, double) / SAMPLES_COUNT << " ns per sample (" << uAccumulator % 2 << ")");
+    }
+}
+
+/// <summary>
+/// Measures the average time spent getting the elapsed cycles of a cycle stopwatch.
+/// </summary>
+ZTEST_CASE ( GetElapsedCycles_MeasuresOverheadPerSample_Test )
+{
+    // [Preparation]
+    CycleStopwatch stopwatch;
+    stopwatch.Set();
+    CycleStopwatch measurer;
+    u64_z uAccumulator = 0;
+
+    // [Execution]
+    measurer.Set();
+
+    for(unsigned int i = 0; i < SAMPLES_COUNT; ++i)
+        uAccumulator += stopwatch.GetElapsedCycles();
+
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("CycleStopwatch::GetElapsedCycles (cycle accurate: " << CycleStopwatch::IsCycleAccurate() << "): " << 
+                       scast_z(uElapsedNanoseconds, double) / SAMPLES_COUNT << " ns per sample (" << uAccumulator % 2 << ")");
+}
+
+// End - Test Suite: Stopwatch
+ZTEST_SUITE_END()
@@ -0,0 +1,240 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTiming/TimerWheel.h"
+
+#include "ZTiming/CycleStopwatch.h"
+#include "ZTiming/Stopwatch.h"
+#include "ZThreading/SThisThread.h"
+
+
+ZTEST_SUITE_BEGIN( TimerWheel_PerformanceTestSuite )
+
+/// <summary>
+/// Number of timers pending in the wheel in every throughput test.
+/// </summary>
+static const unsigned int TIMERS_COUNT = 1000000U;
+
+/// <summary>
+/// Number of expirations measured in every jitter test.
+/// </summary>
+static const unsigned int JITTER_SAMPLES_COUNT = 200U;
+
+/// <summary>
+/// Period of the timer used in the jitter tests, in milliseconds.
+/// </summary>
+static const u64_z JITTER_PERIOD_MILLISECONDS = 5U;
+
+/// <summary>
+/// Number of times a timer has been called.
+/// </summary>
+static unsigned int s_uCallsCount = 0;
+
+/// <summary>
+/// Measures the time passed since the wheel used in the jitter tests was created.
+/// </summary>
+static Stopwatch* s_pJitterClock = null_z;
+
+/// <summary>
+/// The instants at which the timer of the jitter tests was called, in nanoseconds.
+/// </summary>
+static u64_z s_arCallInstants[JITTER_SAMPLES_COUNT];
+
+/// <summary>
+/// Generates pseudo-random numbers quickly, so the generation does not affect the measurements.
+/// </summary>
+u64_z GetNextRandom_TestMethod(u64_z &uSeed)
+{
+    uSeed = uSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return uSeed >> 33U;
+}
+
+/// <summary>
+/// Counts the calls to a timer.
+/// </summary>
+void CountCall_TestMethod()
+{
+    ++s_uCallsCount;
+}
+
+/// <summary>
+/// Stores the instant at which the timer is called.
+/// </summary>
+void StoreCallInstant_TestMethod()
+{
+    if(s_uCallsCount < JITTER_SAMPLES_COUNT)
+        s_arCallInstants[s_uCallsCount] = s_pJitterClock->GetElapsedTimeAsInteger();
+
+    ++s_uCallsCount;
+}
+
+/// <summary>
+/// Writes the difference between the instants at which the timer was called and the instants at which it was expected to expire.
+/// </summary>
+void ReportJitter_TestMethod(const char* szDescription)
+{
+    static const u64_z NANOSECONDS_PER_MILLISECOND = 1000000ULL;
+
+    u64_z uMinimumJitter = -1;
+    u64_z uMaximumJitter = 0;
+    u64_z uTotalJitter = 0;
+
+    for(unsigned int i = 0; i < JITTER_SAMPLES_COUNT; ++i)
+    {
+        const u64_z EXPECTED_INSTANT = (i + 1U) * JITTER_PERIOD_MILLISECONDS * NANOSECONDS_PER_MILLISECOND;
+        const u64_z JITTER = s_arCallInstants[i] > EXPECTED_INSTANT ? s_arCallInstants[i] - EXPECTED_INSTANT : 0;
+
+        uMinimumJitter = JITTER < uMinimumJitter ? JITTER : uMinimumJitter;
+        uMaximumJitter = JITTER > uMaximumJitter ? JITTER : uMaximumJitter;
+        uTotalJitter += JITTER;
+    }
+
+    BOOST_TEST_MESSAGE(szDescription << " firing jitter: " << scast_z(uTotalJitter, double) / JITTER_SAMPLES_COUNT << " ns on average (minimum " << 
+                       uMinimumJitter << " ns, maximum " << uMaximumJitter << " ns)");
+}
+
+/// <summary>
+/// Measures the average time spent adding and cancelling a timer when one million timers are pending, with delays of up to one hour.
+/// </summary>
+ZTEST_CASE ( AddTimerCancelTimer_MeasuresTimePerTimerWithOneMillionPendingTimers_Test )
+{
+    // [Preparation]
+    static const u64_z MAXIMUM_DELAY_MILLISECONDS = 3600000U;
+    TimerWheel wheel;
+    TimerWheel::TimerId* arTimerIds = new TimerWheel::TimerId[TIMERS_COUNT];
+    u64_z uSeed = 0;
+    CycleStopwatch measurer;
+
+    // [Execution]
+    measurer.Set();
+
+    for(unsigned int i = 0; i < TIMERS_COUNT; ++i)
+        arTimerIds[i] = wheel.AddTimer(TimeSpan(0, 0, 0, 0, GetNextRandom_TestMethod(uSeed) % MAXIMUM_DELAY_MILLISECONDS, 0, 0), &CountCall_TestMethod);
+
+    u64_z uAddNanoseconds = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(unsigned int i = 0; i < TIMERS_COUNT; ++i)
+        wheel.CancelTimer(arTimerIds[i]);
+
+    u64_z uCancelNanoseconds = measurer.GetElapsedTimeAsInteger();
+    measurer.Set();
+
+    for(unsigned int i = 0; i < TIMERS_COUNT; ++i)
+        arTimerIds[i] = wheel.AddTimer(TimeSpan(0, 0, 0, 0, GetNextRandom_TestMethod(uSeed) % MAXIMUM_DELAY_MILLISECONDS, 0, 0), &CountCall_TestMethod);
+
+    u64_z uReuseNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("TimerWheel::AddTimer: " << scast_z(uAddNanoseconds, double) / TIMERS_COUNT << " ns per timer");
+    BOOST_TEST_MESSAGE("TimerWheel::CancelTimer: " << scast_z(uCancelNanoseconds, double) / TIMERS_COUNT << " ns per timer");
+    BOOST_TEST_MESSAGE("TimerWheel::AddTimer (reusing cancelled timers): " << scast_z(uReuseNanoseconds, double) / TIMERS_COUNT << " ns per timer");
+
+    delete[] arTimerIds;
+}
+
+/// <summary>
+/// Measures the average time spent moving the wheel forward while one million timers expire, one per tick on average.
+/// </summary>
+ZTEST_CASE ( Advance_MeasuresTimePerTickWithOneMillionPendingTimers_Test )
+{
+    // [Preparation]
+    TimerWheel wheel;
+    u64_z uSeed = 0;
+    s_uCallsCount = 0;
+
+    for(unsigned int i = 0; i < TIMERS_COUNT; ++i)
+        wheel.AddTimer(TimeSpan(0, 0, 0, 0, GetNextRandom_TestMethod(uSeed) % TIMERS_COUNT, 0, 0), &CountCall_TestMethod);
+
+    CycleStopwatch measurer;
+
+    // [Execution]
+    measurer.Set();
+    wheel.Advance(TIMERS_COUNT);
+    u64_z uElapsedNanoseconds = measurer.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_TEST_MESSAGE("TimerWheel::Advance: " << scast_z(uElapsedNanoseconds, double) / TIMERS_COUNT << " ns per tick, " << 
+                       scast_z(uElapsedNanoseconds, double) / s_uCallsCount << " ns per expired timer (" << s_uCallsCount << " timers called)");
+}
+
+/// <summary>
+/// Measures the difference between the instant at which a periodic timer is expected to expire and the instant its function is called, when the wheel 
+/// is driven by its dedicated thread.
+/// </summary>
+ZTEST_CASE ( Start_MeasuresFiringJitterOfDedicatedThread_Test )
+{
+    // [Preparation]
+    Stopwatch clock;
+    clock.Set();
+    TimerWheel wheel;
+    s_pJitterClock = &clock;
+    s_uCallsCount = 0;
+    wheel.AddPeriodicTimer(TimeSpan(0, 0, 0, 0, JITTER_PERIOD_MILLISECONDS, 0, 0), &StoreCallInstant_TestMethod);
+
+    // [Execution]
+    wheel.Start();
+
+    while(s_uCallsCount < JITTER_SAMPLES_COUNT)
+        SThisThread::Sleep(TimeSpan(0, 0, 0, 0, JITTER_PERIOD_MILLISECONDS, 0, 0));
+
+    wheel.Stop();
+    
+    // [Verification]
+    ReportJitter_TestMethod("TimerWheel (dedicated thread)");
+}
+
+/// <summary>
+/// Measures the difference between the instant at which a periodic timer is expected to expire and the instant its function is called, when the wheel 
+/// is driven by calling Tick continuously.
+/// </summary>
+ZTEST_CASE ( Tick_MeasuresFiringJitterWhenCalledContinuously_Test )
+{
+    // [Preparation]
+    Stopwatch clock;
+    clock.Set();
+    TimerWheel wheel;
+    s_pJitterClock = &clock;
+    s_uCallsCount = 0;
+    wheel.AddPeriodicTimer(TimeSpan(0, 0, 0, 0, JITTER_PERIOD_MILLISECONDS, 0, 0), &StoreCallInstant_TestMethod);
+
+    // [Execution]
+    while(s_uCallsCount < JITTER_SAMPLES_COUNT)
+        wheel.Tick();
+    
+    // [Verification]
+    ReportJitter_TestMethod("TimerWheel (Tick called continuously)");
+}
+
+// End - Test Suite: TimerWheel
+ZTEST_SUITE_END()
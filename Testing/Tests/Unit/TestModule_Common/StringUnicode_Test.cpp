@@ -3738,6 +3738,137 @@ ZTEST_CASE ( CompareTo_NormalizationDoesNotAffectTheResultWhenUsingCanonicalComp
     BOOST_CHECK_EQUAL(nResultNormalized, nResultNormalized2);
 }
 
+/// <summary>
+/// Checks that it returns the expected value when the string is empty.
+/// </summary>
+ZTEST_CASE ( GetHashCode_ReturnsExpectedValueWhenStringIsEmpty_Test )
+{
+    // [Preparation]
+    const StringUnicode EMPTY_STRING;
+    const u64_z EXPECTED_RESULT = 10602188539874428322ULL;
+
+    // [Execution]
+    u64_z uResult = EMPTY_STRING.GetHashCode();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that equal strings produce the same hash code, no matter how they were built.
+/// </summary>
+ZTEST_CASE ( GetHashCode_EqualStringsProduceSameHashCode_Test )
+{
+    // [Preparation]
+    const StringUnicode STRING1("A text long enough to be processed in blocks of 48 bytes by the hash function");
+    StringUnicode STRING2("A text long enough to be processed ");
+    STRING2.Append("in blocks of 48 bytes by the hash function");
+
+    // [Execution]
+    u64_z uResult1 = STRING1.GetHashCode();
+    u64_z uResult2 = STRING2.GetHashCode();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uResult1, uResult2);
+}
+
+/// <summary>
+/// Checks that strings that only differ in one character produce different hash codes, for several lengths.
+/// </summary>
+ZTEST_CASE ( GetHashCode_StringsThatDifferInOneCharacterProduceDifferentHashCodes_Test )
+{
+    // [Preparation]
+    const StringUnicode STRING1_SHORT("ab");
+    const StringUnicode STRING2_SHORT("ac");
+    const StringUnicode STRING1_MEDIUM("abcdefghij");
+    const StringUnicode STRING2_MEDIUM("abcdefghik");
+    const StringUnicode STRING1_LONG("A text long enough to be processed in blocks of 48 bytes by the hash function");
+    const StringUnicode STRING2_LONG("A text long enough to be processed in blocks of 48 bytes by the hash functioN");
+
+    // [Execution]
+    u64_z uResult1Short = STRING1_SHORT.GetHashCode();
+    u64_z uResult2Short = STRING2_SHORT.GetHashCode();
+    u64_z uResult1Medium = STRING1_MEDIUM.GetHashCode();
+    u64_z uResult2Medium = STRING2_MEDIUM.GetHashCode();
+    u64_z uResult1Long = STRING1_LONG.GetHashCode();
+    u64_z uResult2Long = STRING2_LONG.GetHashCode();
+
+    // [Verification]
+    BOOST_CHECK_NE(uResult1Short, uResult2Short);
+    BOOST_CHECK_NE(uResult1Medium, uResult2Medium);
+    BOOST_CHECK_NE(uResult1Long, uResult2Long);
+}
+
+/// <summary>
+/// Checks that all the code units are used, even when the string contains characters encoded with surrogate pairs.
+/// </summary>
+ZTEST_CASE ( GetHashCode_AllCodeUnitsAreUsedWhenStringContainsSurrogatePairs_Test )
+{
+    // [Preparation]
+    //                         a       b       U+1F600
+    u16_z SEQUENCE1[] = { 0x0061, 0x0062, 0xD83D, 0xDE00 };
+    //                         a       b       U+1F601
+    u16_z SEQUENCE2[] = { 0x0061, 0x0062, 0xD83D, 0xDE01 };
+    const StringUnicode STRING1((char*)SEQUENCE1, sizeof(SEQUENCE1), string_z::GetLocalEncodingUTF16());
+    const StringUnicode STRING2((char*)SEQUENCE2, sizeof(SEQUENCE2), string_z::GetLocalEncodingUTF16());
+
+    // [Execution]
+    u64_z uResult1 = STRING1.GetHashCode();
+    u64_z uResult2 = STRING2.GetHashCode();
+
+    // [Verification]
+    BOOST_CHECK_NE(uResult1, uResult2);
+}
+
+/// <summary>
+/// Checks that the hash code changes when the string is modified after it was calculated.
+/// </summary>
+ZTEST_CASE ( GetHashCode_HashCodeIsUpdatedWhenStringIsModified_Test )
+{
+    // [Preparation]
+    StringUnicode strAppended("ABC");
+    StringUnicode strReplaced("ABC");
+    StringUnicode strCharSet("ABC");
+    StringUnicode strAssigned("ABC");
+    const u64_z ORIGINAL_HASH_CODE = strAppended.GetHashCode();
+    strReplaced.GetHashCode();
+    strCharSet.GetHashCode();
+    strAssigned.GetHashCode();
+
+    // [Execution]
+    strAppended.Append("D");
+    strReplaced.Replace("C", "D");
+    strCharSet.GetCharIterator().SetChar(CharUnicode('D'));
+    strAssigned = StringUnicode("ABD");
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(strAppended.GetHashCode(), StringUnicode("ABCD").GetHashCode());
+    BOOST_CHECK_EQUAL(strReplaced.GetHashCode(), StringUnicode("ABD").GetHashCode());
+    BOOST_CHECK_EQUAL(strCharSet.GetHashCode(), StringUnicode("DBC").GetHashCode());
+    BOOST_CHECK_EQUAL(strAssigned.GetHashCode(), StringUnicode("ABD").GetHashCode());
+    BOOST_CHECK_NE(strAppended.GetHashCode(), ORIGINAL_HASH_CODE);
+}
+
+/// <summary>
+/// Checks that the strings returned by case conversion methods do not keep the hash code of the original string.
+/// </summary>
+ZTEST_CASE ( GetHashCode_CaseConversionsDoNotKeepHashCodeOfOriginalString_Test )
+{
+    // [Preparation]
+    const StringUnicode ORIGINAL_STRING("aBc");
+    ORIGINAL_STRING.GetHashCode();
+
+    // [Execution]
+    StringUnicode strLowerCase = ORIGINAL_STRING.ToLowerCase();
+    StringUnicode strUpperCase = ORIGINAL_STRING.ToUpperCase();
+    StringUnicode strCaseFolded = ORIGINAL_STRING.ToCaseFolded();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(strLowerCase.GetHashCode(), StringUnicode("abc").GetHashCode());
+    BOOST_CHECK_EQUAL(strUpperCase.GetHashCode(), StringUnicode("ABC").GetHashCode());
+    BOOST_CHECK_EQUAL(strCaseFolded.GetHashCode(), StringUnicode("abc").GetHashCode());
+}
+
 /// <summary>
 /// Checks that it returns "not found" when the pattern is empty.
 /// </summary>
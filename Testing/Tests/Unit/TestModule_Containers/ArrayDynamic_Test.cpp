@@ -31,6 +31,8 @@ using namespace boost::unit_test;
 #include "../../testsystem/TestingExternalDefinitions.h"
 
 #include "ZContainers/ArrayDynamic.h"
+#include "ZContainers/KeyValuePair.h"
+#include "ZMemory/InlineAllocator.h"
 
 #include "CallCounter.h"
 #include "ZCommon/Exceptions/AssertException.h"
@@ -996,6 +998,111 @@ ZTEST_CASE ( Add_CopyConstructorIsCalledForAddedElements_Test )
     BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
 }
 
+/// <summary>
+/// Checks that elements are stored inside the allocator until its capacity is exceeded, and that they keep their values when they are moved to the heap.
+/// </summary>
+ZTEST_CASE ( Add_ElementsAreStoredInsideTheAllocatorUntilItsCapacityIsExceeded_Test )
+{
+    // [Preparation]
+    const puint_z INLINE_COUNT = 4U;
+    ArrayDynamic<int, InlineAllocator<int, INLINE_COUNT> > arCommonArray;
+    const bool IS_INLINE_BEFORE_EXCEEDING = true;
+    const bool IS_INLINE_AFTER_EXCEEDING = false;
+
+    // [Execution]
+    for(puint_z i = 0; i < INLINE_COUNT; ++i)
+        arCommonArray.Add(scast_z(i, int));
+
+    bool bIsInlineBeforeExceeding = arCommonArray.GetAllocator()->IsInline();
+    arCommonArray.Add(scast_z(INLINE_COUNT, int));
+    bool bIsInlineAfterExceeding = arCommonArray.GetAllocator()->IsInline();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bIsInlineBeforeExceeding, IS_INLINE_BEFORE_EXCEEDING);
+    BOOST_CHECK_EQUAL(bIsInlineAfterExceeding, IS_INLINE_AFTER_EXCEEDING);
+    BOOST_CHECK_EQUAL(arCommonArray.GetCount(), INLINE_COUNT + 1U);
+
+    for(puint_z i = 0; i < INLINE_COUNT + 1U; ++i)
+        BOOST_CHECK_EQUAL(arCommonArray[i], scast_z(i, int));
+}
+
+/// <summary>
+/// Checks that the element is constructed at the end of the array using its default constructor, without copies.
+/// </summary>
+ZTEST_CASE ( Emplace1_ElementIsDefaultConstructedAtTheEndWithoutCopies_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 2U;
+    const unsigned int EXPECTED_CONSTRUCTOR_CALLS = 1U;
+    const unsigned int EXPECTED_COPY_CONSTRUCTOR_CALLS = 0;
+    ArrayDynamic<CallCounter> arCommonArray(3U);
+    arCommonArray.Add(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    arCommonArray.Emplace();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arCommonArray.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(CallCounter::GetConstructorCallsCount(), EXPECTED_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_COPY_CONSTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that the element is constructed at the end of the array from the input argument.
+/// </summary>
+ZTEST_CASE ( Emplace2_ElementIsConstructedFromArgumentAtTheEnd_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_FIRST_ELEMENT("First");
+    const string_z EXPECTED_LAST_ELEMENT("Last");
+    ArrayDynamic<string_z> arCommonArray;
+    arCommonArray.Add(EXPECTED_FIRST_ELEMENT);
+
+    // [Execution]
+    arCommonArray.Emplace("Last");
+
+    // [Verification]
+    BOOST_CHECK(arCommonArray[0] == EXPECTED_FIRST_ELEMENT);
+    BOOST_CHECK(arCommonArray[1] == EXPECTED_LAST_ELEMENT);
+}
+
+/// <summary>
+/// Checks that the element is constructed at the end of the array from the two input arguments.
+/// </summary>
+ZTEST_CASE ( Emplace3_ElementIsConstructedFromArgumentsAtTheEnd_Test )
+{
+    // [Preparation]
+    const int EXPECTED_KEY = 1;
+    const int EXPECTED_VALUE = 2;
+    ArrayDynamic< KeyValuePair<int, int> > arCommonArray;
+
+    // [Execution]
+    arCommonArray.Emplace(EXPECTED_KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arCommonArray[0].GetKey(), EXPECTED_KEY);
+    BOOST_CHECK_EQUAL(arCommonArray[0].GetValue(), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the capacity is increased when emplacing elements in a full array.
+/// </summary>
+ZTEST_CASE ( Emplace2_CapacityIsIncreasedWhenArrayIsFull_Test )
+{
+    // [Preparation]
+    const puint_z INITIAL_CAPACITY = 1U;
+    ArrayDynamic<int> arCommonArray(INITIAL_CAPACITY);
+    arCommonArray.Add(0);
+
+    // [Execution]
+    arCommonArray.Emplace(1);
+
+    // [Verification]
+    BOOST_CHECK(arCommonArray.GetCapacity() > INITIAL_CAPACITY);
+    BOOST_CHECK_EQUAL(arCommonArray[1], 1);
+}
+
 /// <summary>
 /// Checks that elements can be inserted at the first position.
 /// </summary>
@@ -1200,6 +1307,31 @@ ZTEST_CASE ( Insert1_ElementIsInsertedAtTheEndWhenIteratorSVectorArraysToForward
 
 #endif
 
+/// <summary>
+/// Checks that arrays whose elements are stored inside their allocator remain valid when they are moved by the array that contains them.
+/// </summary>
+ZTEST_CASE ( Insert2_ArraysThatStoreElementsInsideTheAllocatorCanBeMoved_Test )
+{
+    // [Preparation]
+    typedef ArrayDynamic<int, InlineAllocator<int, 2U> > InlineArray;
+    InlineArray arFirst;
+    arFirst.Add(1);
+    arFirst.Add(2);
+    InlineArray arSecond;
+    arSecond.Add(3);
+    ArrayDynamic<InlineArray> arCommonArray;
+    arCommonArray.Add(arSecond);
+
+    // [Execution]
+    arCommonArray.Insert(arFirst, 0);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arCommonArray[0][0], 1);
+    BOOST_CHECK_EQUAL(arCommonArray[0][1], 2);
+    BOOST_CHECK_EQUAL(arCommonArray[1][0], 3);
+    BOOST_CHECK_EQUAL(*arCommonArray[1].GetFirst(), 3);
+}
+
 /// <summary>
 /// Checks that elements can be inserted at the first position.
 /// </summary>
@@ -1987,6 +2119,110 @@ ZTEST_CASE ( Clone_NeitherDestructorNorConstructorsAreCalledWhenCloning_Test )
     BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
 }
 
+/// <summary>
+/// Checks that the elements and the capacity of both arrays are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap3_ElementsAndCapacityAreExchanged_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY_A = 4U;
+    const puint_z CAPACITY_B = 8U;
+    ArrayDynamic<string_z> arArrayA(CAPACITY_A);
+    arArrayA.Add("A0");
+    arArrayA.Add("A1");
+    ArrayDynamic<string_z> arArrayB(CAPACITY_B);
+    arArrayB.Add("B0");
+    const string_z* ELEMENT_ADDRESS_A = &arArrayA[0];
+    const puint_z EXPECTED_COUNT_A = 1U;
+    const puint_z EXPECTED_COUNT_B = 2U;
+
+    // [Execution]
+    arArrayA.Swap(arArrayB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arArrayA.GetCount(), EXPECTED_COUNT_A);
+    BOOST_CHECK_EQUAL(arArrayB.GetCount(), EXPECTED_COUNT_B);
+    BOOST_CHECK_EQUAL(arArrayA.GetCapacity(), CAPACITY_B);
+    BOOST_CHECK_EQUAL(arArrayB.GetCapacity(), CAPACITY_A);
+    BOOST_CHECK(arArrayA[0] == string_z("B0"));
+    BOOST_CHECK(arArrayB[0] == string_z("A0"));
+    BOOST_CHECK(arArrayB[1] == string_z("A1"));
+    BOOST_CHECK_EQUAL(&arArrayB[0], ELEMENT_ADDRESS_A);
+}
+
+/// <summary>
+/// Checks that an empty array can be exchanged with a non-empty array and that elements can be added afterwards.
+/// </summary>
+ZTEST_CASE ( Swap3_EmptyArrayIsCorrectlyExchanged_Test )
+{
+    // [Preparation]
+    ArrayDynamic<int> arArrayA;
+    ArrayDynamic<int> arArrayB;
+    arArrayB.Add(1);
+    arArrayB.Add(2);
+    const puint_z EXPECTED_COUNT_A = 3U;
+
+    // [Execution]
+    arArrayA.Swap(arArrayB);
+
+    // [Verification]
+    arArrayA.Add(3);
+    arArrayB.Add(4);
+    BOOST_CHECK_EQUAL(arArrayA.GetCount(), EXPECTED_COUNT_A);
+    BOOST_CHECK_EQUAL(arArrayA[2], 3);
+    BOOST_CHECK_EQUAL(arArrayB[0], 4);
+    BOOST_CHECK_EQUAL(arArrayB.GetCount(), 1U);
+}
+
+/// <summary>
+/// Checks that elements stored inside the allocators of both arrays are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap3_ElementsStoredInsideTheAllocatorsAreExchanged_Test )
+{
+    // [Preparation]
+    ArrayDynamic<string_z, InlineAllocator<string_z, 4U> > arArrayA;
+    arArrayA.Add("A0");
+    ArrayDynamic<string_z, InlineAllocator<string_z, 4U> > arArrayB;
+    arArrayB.Add("B0");
+    arArrayB.Add("B1");
+    const puint_z EXPECTED_COUNT_A = 2U;
+    const puint_z EXPECTED_COUNT_B = 1U;
+
+    // [Execution]
+    arArrayA.Swap(arArrayB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arArrayA.GetCount(), EXPECTED_COUNT_A);
+    BOOST_CHECK_EQUAL(arArrayB.GetCount(), EXPECTED_COUNT_B);
+    BOOST_CHECK(arArrayA[0] == string_z("B0"));
+    BOOST_CHECK(arArrayA[1] == string_z("B1"));
+    BOOST_CHECK(arArrayB[0] == string_z("A0"));
+    BOOST_CHECK(*arArrayA.GetLast() == string_z("B1"));
+}
+
+/// <summary>
+/// Checks that neither constructors, nor assignment operators nor destructors of the elements are called.
+/// </summary>
+ZTEST_CASE ( Swap3_NeitherConstructorsNorAssignmentOperatorsNorDestructorsAreCalled_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 0;
+    ArrayDynamic<CallCounter> arArrayA;
+    ArrayDynamic<CallCounter> arArrayB;
+    for(int i = 0; i < 5; ++i)
+        arArrayA.Emplace();
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    arArrayA.Swap(arArrayB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetConstructorCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetAssignmentCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetDestructorCallsCount(), EXPECTED_CALLS);
+}
+
 /// <sumary>
 /// Checks that it returns False when the array is empty.
 /// </sumary>
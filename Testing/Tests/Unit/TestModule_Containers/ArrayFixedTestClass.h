@@ -28,7 +28,7 @@
 #define __FIXEDARRAYTESTCLASS__
 
 #include "ZContainers/ArrayFixed.h"
-#include "ZMemory/PoolAllocator.h"
+#include "ZMemory/ContiguousAllocator.h"
 
 
 namespace z
@@ -39,7 +39,7 @@ namespace Test
 /// <summary>
 /// Class intended to be used to expose protected methods of ArrayFixed for testing purposes.
 /// </summary>
-template <class T, class Allocator = PoolAllocator>
+template <class T, class Allocator = ContiguousAllocator>
 class ArrayFixedTestClass : public ArrayFixed<T>
 {
     using ArrayFixed<T>::m_allocator;
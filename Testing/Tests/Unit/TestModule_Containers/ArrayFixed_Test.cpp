@@ -1497,6 +1497,51 @@ ZTEST_CASE( Swap2_NothingHappensWhenSwappingTheSameElement_Test )
 
 #endif
 
+/// <sumary>
+/// Checks that the elements of both arrays are exchanged.
+/// </sumary>
+ZTEST_CASE( Swap3_ElementsAreExchanged_Test )
+{
+    // [Preparation]
+    u32_z arValuesA[] = {0, 1U, 2U};
+    u32_z arValuesB[] = {3U, 4U};
+    ArrayFixed<u32_z> arFixedArrayA(arValuesA, sizeof(arValuesA) / sizeof(u32_z));
+    ArrayFixed<u32_z> arFixedArrayB(arValuesB, sizeof(arValuesB) / sizeof(u32_z));
+    const ArrayFixed<u32_z> EXPECTED_ARRAY_A(arValuesB, sizeof(arValuesB) / sizeof(u32_z));
+    const ArrayFixed<u32_z> EXPECTED_ARRAY_B(arValuesA, sizeof(arValuesA) / sizeof(u32_z));
+
+    // [Execution]
+    arFixedArrayA.Swap(arFixedArrayB);
+
+    // [Verification]
+    BOOST_CHECK(arFixedArrayA == EXPECTED_ARRAY_A);
+    BOOST_CHECK(arFixedArrayB == EXPECTED_ARRAY_B);
+    BOOST_CHECK_EQUAL(arFixedArrayA.GetCapacity(), EXPECTED_ARRAY_A.GetCapacity());
+    BOOST_CHECK_EQUAL(arFixedArrayB.GetCapacity(), EXPECTED_ARRAY_B.GetCapacity());
+}
+
+/// <sumary>
+/// Checks that neither constructors, nor assignment operators nor destructors of the elements are called.
+/// </sumary>
+ZTEST_CASE( Swap3_NeitherConstructorsNorAssignmentOperatorsNorDestructorsAreCalled_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 0;
+    CallCounter arValues[3];
+    ArrayFixed<CallCounter> arFixedArrayA(arValues, 3U);
+    ArrayFixed<CallCounter> arFixedArrayB(arValues, 2U);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    arFixedArrayA.Swap(arFixedArrayB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetConstructorCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetAssignmentCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetDestructorCallsCount(), EXPECTED_CALLS);
+}
+
 /// <sumary>
 /// Checks that it returns True when arrays have the same number of elements and those elements are equal.
 /// </sumary>
@@ -0,0 +1,490 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/ArraySoA.h"
+#include "ZContainers/ArrayDynamic.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( ArraySoA_TestSuite )
+
+/// <summary>
+/// Checks that the array is empty and has no capacity after default construction.
+/// </summary>
+ZTEST_CASE ( Constructor1_ArrayIsEmptyAndHasNoCapacity_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 0;
+    const puint_z EXPECTED_CAPACITY = 0;
+
+    // [Execution]
+    ArraySoA<float, 3U> array;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(array.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(array.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK(array.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the capacity is rounded up so every column fills whole cache lines.
+/// </summary>
+ZTEST_CASE ( Constructor2_CapacityIsRoundedUpToCacheLineSize_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 5U;
+    const puint_z EXPECTED_CAPACITY = Z_CACHE_LINE_SIZE / sizeof(float);
+
+    // [Execution]
+    ArraySoA<float, 3U> array(INPUT_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(array.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK(array.IsEmpty());
+}
+
+/// <summary>
+/// Checks that all the rows are copied.
+/// </summary>
+ZTEST_CASE ( Constructor3_RowsAreCopied_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array;
+    const int ROW1[] = { 1, 2 };
+    const int ROW2[] = { 3, 4 };
+    array.Add(ROW1);
+    array.Add(ROW2);
+
+    // [Execution]
+    ArraySoA<int, 2U> copiedArray(array);
+
+    // [Verification]
+    int arRow[2];
+    BOOST_CHECK_EQUAL(copiedArray.GetCount(), array.GetCount());
+    copiedArray.GetRow(0, arRow);
+    BOOST_CHECK(arRow[0] == ROW1[0] && arRow[1] == ROW1[1]);
+    copiedArray.GetRow(1U, arRow);
+    BOOST_CHECK(arRow[0] == ROW2[0] && arRow[1] == ROW2[1]);
+    BOOST_CHECK(copiedArray.GetColumn(0).GetData() != array.GetColumn(0).GetData());
+}
+
+/// <summary>
+/// Checks that the components of 3D vectors are copied to the corresponding columns.
+/// </summary>
+ZTEST_CASE ( Constructor4_ComponentsOfVectorsAreCopiedToColumns_Test )
+{
+    // [Preparation]
+    ArrayDynamic<Vector3> arVectors;
+    arVectors.Add(Vector3(1.0f, 2.0f, 3.0f));
+    arVectors.Add(Vector3(4.0f, 5.0f, 6.0f));
+
+    // [Execution]
+    ArraySoA<float_z, 3U> array(arVectors);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(array.GetCount(), arVectors.GetCount());
+
+    for(puint_z i = 0; i < arVectors.GetCount(); ++i)
+    {
+        BOOST_CHECK_EQUAL(array.GetColumn(0)[i], arVectors[i].x);
+        BOOST_CHECK_EQUAL(array.GetColumn(1U)[i], arVectors[i].y);
+        BOOST_CHECK_EQUAL(array.GetColumn(2U)[i], arVectors[i].z);
+    }
+}
+
+/// <summary>
+/// Checks that the components of 4D vectors are copied to the corresponding columns.
+/// </summary>
+ZTEST_CASE ( Constructor5_ComponentsOfVectorsAreCopiedToColumns_Test )
+{
+    // [Preparation]
+    ArrayDynamic<Vector4> arVectors;
+    arVectors.Add(Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+    arVectors.Add(Vector4(5.0f, 6.0f, 7.0f, 8.0f));
+
+    // [Execution]
+    ArraySoA<float_z, 4U> array(arVectors);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(array.GetCount(), arVectors.GetCount());
+
+    for(puint_z i = 0; i < arVectors.GetCount(); ++i)
+    {
+        BOOST_CHECK_EQUAL(array.GetColumn(0)[i], arVectors[i].x);
+        BOOST_CHECK_EQUAL(array.GetColumn(1U)[i], arVectors[i].y);
+        BOOST_CHECK_EQUAL(array.GetColumn(2U)[i], arVectors[i].z);
+        BOOST_CHECK_EQUAL(array.GetColumn(3U)[i], arVectors[i].w);
+    }
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of columns does not match the number of components of the vectors.
+/// </summary>
+ZTEST_CASE ( Constructor4_AssertionFailsWhenColumnCountIsNotThree_Test )
+{
+    // [Preparation]
+    ArrayDynamic<Vector3> arVectors;
+    arVectors.Add(Vector3(1.0f, 2.0f, 3.0f));
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        ArraySoA<float_z, 4U> array(arVectors);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the values of the row are added to the end of every column.
+/// </summary>
+ZTEST_CASE ( Add_ValuesAreAddedToTheEndOfEveryColumn_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 3U> array;
+    const int ROW1[] = { 1, 2, 3 };
+    const int ROW2[] = { 4, 5, 6 };
+    const puint_z EXPECTED_COUNT = 2U;
+
+    // [Execution]
+    array.Add(ROW1);
+    array.Add(ROW2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(array.GetCount(), EXPECTED_COUNT);
+
+    for(unsigned int uColumn = 0; uColumn < 3U; ++uColumn)
+    {
+        BOOST_CHECK_EQUAL(array.GetColumn(uColumn)[0], ROW1[uColumn]);
+        BOOST_CHECK_EQUAL(array.GetColumn(uColumn)[1], ROW2[uColumn]);
+    }
+}
+
+/// <summary>
+/// Checks that existing rows are kept when the array has to grow.
+/// </summary>
+ZTEST_CASE ( Add_RowsAreKeptWhenArrayGrows_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array(1U);
+    const puint_z INITIAL_CAPACITY = array.GetCapacity();
+    const puint_z ROW_COUNT = INITIAL_CAPACITY * 3U + 1U;
+
+    // [Execution]
+    for(puint_z i = 0; i < ROW_COUNT; ++i)
+    {
+        const int ROW[] = { scast_z(i, int), -scast_z(i, int) };
+        array.Add(ROW);
+    }
+
+    // [Verification]
+    BOOST_CHECK(array.GetCapacity() > INITIAL_CAPACITY);
+    BOOST_CHECK_EQUAL(array.GetCount(), ROW_COUNT);
+
+    for(puint_z i = 0; i < ROW_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(array.GetColumn(0)[i], scast_z(i, int));
+        BOOST_CHECK_EQUAL(array.GetColumn(1U)[i], -scast_z(i, int));
+    }
+}
+
+/// <summary>
+/// Checks that the last row is moved to the position of the removed row.
+/// </summary>
+ZTEST_CASE ( Remove_LastRowIsMovedToRemovedPosition_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array;
+    const int ROW1[] = { 1, 2 };
+    const int ROW2[] = { 3, 4 };
+    const int ROW3[] = { 5, 6 };
+    array.Add(ROW1);
+    array.Add(ROW2);
+    array.Add(ROW3);
+    const puint_z EXPECTED_COUNT = 2U;
+
+    // [Execution]
+    array.Remove(0);
+
+    // [Verification]
+    int arRow[2];
+    BOOST_CHECK_EQUAL(array.GetCount(), EXPECTED_COUNT);
+    array.GetRow(0, arRow);
+    BOOST_CHECK(arRow[0] == ROW3[0] && arRow[1] == ROW3[1]);
+    array.GetRow(1U, arRow);
+    BOOST_CHECK(arRow[0] == ROW2[0] && arRow[1] == ROW2[1]);
+}
+
+/// <summary>
+/// Checks that the position that is released is reset to zero.
+/// </summary>
+ZTEST_CASE ( Remove_ReleasedPositionIsSetToZero_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 1U> array;
+    const int ROW1[] = { 1 };
+    const int ROW2[] = { 2 };
+    array.Add(ROW1);
+    array.Add(ROW2);
+    const int EXPECTED_VALUE = 0;
+
+    // [Execution]
+    array.Remove(1U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(array.GetColumn(0).GetData()[1], EXPECTED_VALUE);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the index is out of bounds.
+/// </summary>
+ZTEST_CASE ( Remove_AssertionFailsWhenIndexIsOutOfBounds_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array;
+    const int ROW[] = { 1, 2 };
+    array.Add(ROW);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        array.Remove(1U);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the values of the row are replaced.
+/// </summary>
+ZTEST_CASE ( SetRow_ValuesAreReplaced_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array;
+    const int ROW[] = { 1, 2 };
+    const int NEW_ROW[] = { 7, 8 };
+    array.Add(ROW);
+    array.Add(ROW);
+
+    // [Execution]
+    array.SetRow(1U, NEW_ROW);
+
+    // [Verification]
+    int arRow[2];
+    array.GetRow(1U, arRow);
+    BOOST_CHECK(arRow[0] == NEW_ROW[0] && arRow[1] == NEW_ROW[1]);
+    array.GetRow(0, arRow);
+    BOOST_CHECK(arRow[0] == ROW[0] && arRow[1] == ROW[1]);
+}
+
+/// <summary>
+/// Checks that every column starts at an address aligned to the size of a cache line.
+/// </summary>
+ZTEST_CASE ( GetColumn_ColumnsAreAlignedToCacheLineSize_Test )
+{
+    // [Preparation]
+    ArraySoA<float, 3U> array;
+    const float ROW[] = { 1.0f, 2.0f, 3.0f };
+
+    for(unsigned int i = 0; i < 37U; ++i)
+        array.Add(ROW);
+
+    const puint_z EXPECTED_REMAINDER = 0;
+
+    // [Execution]
+    for(unsigned int uColumn = 0; uColumn < 3U; ++uColumn)
+    {
+        Span<float> column = array.GetColumn(uColumn);
+
+        // [Verification]
+        BOOST_CHECK_EQUAL(rcast_z(column.GetData(), puint_z) % Z_CACHE_LINE_SIZE, EXPECTED_REMAINDER);
+        BOOST_CHECK_EQUAL(column.GetCount(), array.GetCount());
+    }
+}
+
+/// <summary>
+/// Checks that the values of the array are modified through the span, without copies.
+/// </summary>
+ZTEST_CASE ( GetColumn_ValuesAreModifiedThroughTheSpan_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array;
+    const int ROW[] = { 1, 2 };
+    array.Add(ROW);
+    const int EXPECTED_VALUE = 5;
+
+    // [Execution]
+    array.GetColumn(1U)[0] = EXPECTED_VALUE;
+
+    // [Verification]
+    int arRow[2];
+    array.GetRow(0, arRow);
+    BOOST_CHECK_EQUAL(arRow[1], EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the positions between the number of rows and the capacity are zero.
+/// </summary>
+ZTEST_CASE ( Reserve_PaddingIsZero_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array;
+    const int ROW[] = { 1, 2 };
+    array.Add(ROW);
+    const int EXPECTED_VALUE = 0;
+
+    // [Execution]
+    array.Reserve(100U);
+
+    // [Verification]
+    BOOST_CHECK(array.GetCapacity() >= 100U);
+
+    for(unsigned int uColumn = 0; uColumn < 2U; ++uColumn)
+    {
+        const int* arColumn = array.GetColumn(uColumn).GetData();
+        BOOST_CHECK_EQUAL(arColumn[0], ROW[uColumn]);
+
+        for(puint_z i = 1U; i < array.GetCapacity(); ++i)
+            BOOST_CHECK_EQUAL(arColumn[i], EXPECTED_VALUE);
+    }
+}
+
+/// <summary>
+/// Checks that the capacity does not change when it is already greater than the input number of rows.
+/// </summary>
+ZTEST_CASE ( Reserve_NothingHappensWhenCapacityIsEnough_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array(100U);
+    const puint_z EXPECTED_CAPACITY = array.GetCapacity();
+    const int* EXPECTED_DATA = array.GetColumn(0).GetData();
+
+    // [Execution]
+    array.Reserve(10U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(array.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(array.GetColumn(0).GetData(), EXPECTED_DATA);
+}
+
+/// <summary>
+/// Checks that the array is empty and keeps its capacity.
+/// </summary>
+ZTEST_CASE ( Clear_ArrayIsEmptyAndCapacityDoesNotChange_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array;
+    const int ROW[] = { 1, 2 };
+    array.Add(ROW);
+    const puint_z EXPECTED_CAPACITY = array.GetCapacity();
+
+    // [Execution]
+    array.Clear();
+
+    // [Verification]
+    BOOST_CHECK(array.IsEmpty());
+    BOOST_CHECK_EQUAL(array.GetCapacity(), EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the rows of both arrays are exchanged without copying them.
+/// </summary>
+ZTEST_CASE ( Swap_RowsAreExchanged_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array1;
+    ArraySoA<int, 2U> array2;
+    const int ROW[] = { 1, 2 };
+    array1.Add(ROW);
+    const int* EXPECTED_DATA = array1.GetColumn(0).GetData();
+
+    // [Execution]
+    array1.Swap(array2);
+
+    // [Verification]
+    BOOST_CHECK(array1.IsEmpty());
+    BOOST_CHECK_EQUAL(array2.GetCount(), 1U);
+    BOOST_CHECK_EQUAL(array2.GetColumn(0).GetData(), EXPECTED_DATA);
+}
+
+/// <summary>
+/// Checks that the rows of the other array are copied.
+/// </summary>
+ZTEST_CASE ( OperatorAssignment_RowsAreCopied_Test )
+{
+    // [Preparation]
+    ArraySoA<int, 2U> array1;
+    ArraySoA<int, 2U> array2;
+    const int ROW1[] = { 1, 2 };
+    const int ROW2[] = { 3, 4 };
+    array1.Add(ROW1);
+    array2.Add(ROW2);
+    array2.Add(ROW2);
+
+    // [Execution]
+    array2 = array1;
+
+    // [Verification]
+    int arRow[2];
+    BOOST_CHECK_EQUAL(array2.GetCount(), array1.GetCount());
+    array2.GetRow(0, arRow);
+    BOOST_CHECK(arRow[0] == ROW1[0] && arRow[1] == ROW1[1]);
+    BOOST_CHECK_EQUAL(array2.GetColumn(0).GetData()[1], 0);
+}
+
+// End - Test Suite: ArraySoA
+ZTEST_SUITE_END()
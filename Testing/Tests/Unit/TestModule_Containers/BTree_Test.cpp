@@ -0,0 +1,890 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/BTree.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+// Element that counts how many times it is copied and destroyed, and that is compared by value (unlike CallCounter) since the B-tree moves its elements
+class BTreeTestElement
+{
+public:
+
+    explicit BTreeTestElement(const int nValue) : m_nValue(nValue)
+    {
+    }
+
+    BTreeTestElement(const BTreeTestElement &element) : m_nValue(element.m_nValue)
+    {
+        ++sm_uCopyConstructorCalls;
+    }
+
+    ~BTreeTestElement()
+    {
+        ++sm_uDestructorCalls;
+    }
+
+    BTreeTestElement& operator=(const BTreeTestElement &element)
+    {
+        m_nValue = element.m_nValue;
+        return *this;
+    }
+
+    bool operator<(const BTreeTestElement &element) const
+    {
+        return m_nValue < element.m_nValue;
+    }
+
+    bool operator==(const BTreeTestElement &element) const
+    {
+        return m_nValue == element.m_nValue;
+    }
+
+    static void ResetCounters()
+    {
+        sm_uCopyConstructorCalls = 0;
+        sm_uDestructorCalls = 0;
+    }
+
+    static puint_z sm_uCopyConstructorCalls;
+    static puint_z sm_uDestructorCalls;
+
+    int m_nValue;
+};
+
+puint_z BTreeTestElement::sm_uCopyConstructorCalls = 0;
+puint_z BTreeTestElement::sm_uDestructorCalls = 0;
+
+/// <summary>
+/// Number of elements added in the tests that need several levels of nodes.
+/// </summary>
+static const int MANY_ELEMENTS = 2000;
+
+/// <summary>
+/// Adds the even numbers lower than twice a given number of elements, in an order that is neither ascending nor descending.
+/// </summary>
+void AddEvenNumbers_TestMethod(BTree<int> &tree, const int nNumberOfElements)
+{
+    // 7 and the number of elements must be coprime so all the numbers are visited
+    for(int i = 0; i < nNumberOfElements; ++i)
+        tree.Add(((i * 7) % nNumberOfElements) * 2, ETreeTraversalOrder::E_DepthFirstInOrder);
+}
+
+/// <summary>
+/// Checks that the elements of the tree are the even numbers lower than twice a given number, except one of them, in ascending order.
+/// </summary>
+bool ContainsEvenNumbersInOrder_TestMethod(const BTree<int> &tree, const int nNumberOfElements, const int nMissingElement)
+{
+    bool bResult = true;
+    BTree<int>::ConstIterator it = tree.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(int i = 0; i < nNumberOfElements && bResult; ++i)
+    {
+        if(i * 2 != nMissingElement)
+        {
+            bResult = !it.IsEnd() && *it == i * 2;
+            ++it;
+        }
+    }
+
+    return bResult && it.IsEnd();
+}
+
+
+ZTEST_SUITE_BEGIN( BTree_TestSuite )
+
+/// <summary>
+/// Checks that the tree is empty and can store elements after construction.
+/// </summary>
+ZTEST_CASE ( Constructor1_DefaultValuesHaveNotChanged_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 0;
+
+    // [Execution]
+    BTree<int> tree;
+
+    // [Verification]
+    BOOST_CHECK(tree.IsEmpty());
+    BOOST_CHECK_EQUAL(tree.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(tree.GetCapacity() > 0);
+}
+
+/// <summary>
+/// Checks that the capacity is enough to store the input number of elements.
+/// </summary>
+ZTEST_CASE ( Constructor2_CapacityIsNotLowerThanInputCapacity_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 1000U;
+
+    // [Execution]
+    BTree<int> tree(INPUT_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK(tree.GetCapacity() >= INPUT_CAPACITY);
+    BOOST_CHECK(tree.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the tree is correctly copied.
+/// </summary>
+ZTEST_CASE ( Constructor3_TreeIsCorrectlyCopiedWhenItHasElements_Test )
+{
+    // [Preparation]
+    BTree<int> TREE;
+    AddEvenNumbers_TestMethod(TREE, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int> copiedTree(TREE);
+
+    // [Verification]
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(copiedTree, MANY_ELEMENTS, -1));
+    BOOST_CHECK_EQUAL(copiedTree.GetCount(), TREE.GetCount());
+}
+
+/// <summary>
+/// Checks that the copy constructor of every element is called.
+/// </summary>
+ZTEST_CASE ( Constructor3_CopyConstructorsAreCalledForAllElements_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_CALLS = 300U;
+    BTree<BTreeTestElement> TREE;
+
+    for(puint_z i = 0; i < EXPECTED_CALLS; ++i)
+        TREE.Add(BTreeTestElement(scast_z(i, int)), ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    BTreeTestElement::ResetCounters();
+
+    // [Execution]
+    BTree<BTreeTestElement> copiedTree(TREE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(BTreeTestElement::sm_uCopyConstructorCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the destructor of every element is called.
+/// </summary>
+ZTEST_CASE ( Destructor_TheDestructorOfEveryElementIsCalled_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_CALLS = 300U;
+
+    {
+        BTree<BTreeTestElement> TREE;
+
+        for(puint_z i = 0; i < EXPECTED_CALLS; ++i)
+            TREE.Add(BTreeTestElement(scast_z(i, int)), ETreeTraversalOrder::E_DepthFirstInOrder);
+
+        BTreeTestElement::ResetCounters();
+
+    // [Execution]
+    } // Destructor called
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(BTreeTestElement::sm_uDestructorCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the elements of the source tree replace the elements of the destination tree.
+/// </summary>
+ZTEST_CASE ( OperatorAssignment_TreeIsCorrectlyCopied_Test )
+{
+    // [Preparation]
+    BTree<int> TREE;
+    AddEvenNumbers_TestMethod(TREE, MANY_ELEMENTS);
+    BTree<int> destinationTree;
+    destinationTree.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    destinationTree.Add(3, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    destinationTree = TREE;
+
+    // [Verification]
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(destinationTree, MANY_ELEMENTS, -1));
+}
+
+/// <summary>
+/// Checks that trees with the same elements are equal although they were added in a different order.
+/// </summary>
+ZTEST_CASE ( OperatorEquality_ReturnsTrueWhenTreesHaveSameElementsAddedInDifferentOrder_Test )
+{
+    // [Preparation]
+    BTree<int> TREE1;
+    AddEvenNumbers_TestMethod(TREE1, MANY_ELEMENTS);
+    BTree<int> TREE2;
+
+    for(int i = MANY_ELEMENTS - 1; i >= 0; --i)
+        TREE2.Add(i * 2, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    bool bResult = TREE1 == TREE2;
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+}
+
+/// <summary>
+/// Checks that trees with different elements are not equal.
+/// </summary>
+ZTEST_CASE ( OperatorEquality_ReturnsFalseWhenTreesHaveDifferentElements_Test )
+{
+    // [Preparation]
+    BTree<int> TREE1;
+    TREE1.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE1.Add(2, ETreeTraversalOrder::E_DepthFirstInOrder);
+    BTree<int> TREE2;
+    TREE2.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE2.Add(3, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    bool bResult = TREE1 == TREE2;
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+}
+
+/// <summary>
+/// Checks that the returned iterator points to the added element.
+/// </summary>
+ZTEST_CASE ( Add_ReturnedIteratorPointsToAddedElement_Test )
+{
+    // [Preparation]
+    const int EXPECTED_ELEMENT = 1001;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.Add(EXPECTED_ELEMENT, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itResult, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that elements are sorted regardless of the order in which they were added, even when nodes are split.
+/// </summary>
+ZTEST_CASE ( Add_ElementsAreSortedWhenNodesAreSplit_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+
+    // [Execution]
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(tree, MANY_ELEMENTS, -1));
+    BOOST_CHECK_EQUAL(tree.GetCount(), scast_z(MANY_ELEMENTS, puint_z));
+}
+
+/// <summary>
+/// Checks that the returned iterator points to the end position and the element is not added again when it already exists.
+/// </summary>
+ZTEST_CASE ( Add_ReturnsEndPositionWhenElementAlreadyExists_Test )
+{
+    // [Preparation]
+    const int EXISTING_ELEMENT = 100;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+    const puint_z EXPECTED_COUNT = tree.GetCount();
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.Add(EXISTING_ELEMENT, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK(itResult.IsEnd());
+    BOOST_CHECK_EQUAL(tree.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the capacity increases when the tree is full.
+/// </summary>
+ZTEST_CASE ( Add_CapacityIsIncrementedWhenNecessary_Test )
+{
+    // [Preparation]
+    BTree<int> tree(1U);
+    const puint_z INITIAL_CAPACITY = tree.GetCapacity();
+
+    // [Execution]
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK(tree.GetCapacity() > INITIAL_CAPACITY);
+    BOOST_CHECK(tree.GetCapacity() >= tree.GetCount());
+}
+
+/// <summary>
+/// Checks that the tree is empty when its only element is removed.
+/// </summary>
+ZTEST_CASE ( Remove_TreeIsEmptyWhenRemovingTheOnlyElementInTheTree_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    BTree<int>::ConstIterator itElement = tree.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.Remove(itElement);
+
+    // [Verification]
+    BOOST_CHECK(tree.IsEmpty());
+    BOOST_CHECK(itResult.IsEnd());
+}
+
+/// <summary>
+/// Checks that every element can be removed, in any order, while the others remain sorted.
+/// </summary>
+ZTEST_CASE ( Remove_ElementsAreCorrectlyRemovedWhenNodesAreMerged_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+    bool bElementsAreSorted = true;
+
+    // [Execution]
+    for(int i = 0; i < MANY_ELEMENTS; ++i)
+    {
+        const int ELEMENT = ((i * 11) % MANY_ELEMENTS) * 2;
+        tree.Remove(tree.PositionOf(ELEMENT, ETreeTraversalOrder::E_DepthFirstInOrder));
+
+        if(i == MANY_ELEMENTS / 2)
+            bElementsAreSorted = !tree.Contains(ELEMENT) && tree.GetCount() == scast_z(MANY_ELEMENTS - i - 1, puint_z);
+    }
+
+    // [Verification]
+    BOOST_CHECK(bElementsAreSorted);
+    BOOST_CHECK(tree.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the element is removed when it is stored in an internal node.
+/// </summary>
+ZTEST_CASE ( Remove_ElementIsCorrectlyRemovedWhenItIsInInternalNode_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // The element that follows the last element of the first leaf is stored in its parent
+    BTree<int>::ConstIterator itInternal = tree.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder);
+    puint_z uPreviousPosition = itInternal.GetInternalPosition();
+    ++itInternal;
+
+    while(itInternal.GetInternalPosition() == uPreviousPosition + 1U)
+    {
+        uPreviousPosition = itInternal.GetInternalPosition();
+        ++itInternal;
+    }
+
+    const int REMOVED_ELEMENT = *itInternal;
+
+    // [Execution]
+    tree.Remove(itInternal);
+
+    // [Verification]
+    BOOST_CHECK(!tree.Contains(REMOVED_ELEMENT));
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(tree, MANY_ELEMENTS, REMOVED_ELEMENT));
+}
+
+/// <summary>
+/// Checks that the returned iterator points to the element that followed the removed one.
+/// </summary>
+ZTEST_CASE ( Remove_ReturnedIteratorPointsToNextElement_Test )
+{
+    // [Preparation]
+    const int REMOVED_ELEMENT = 1000;
+    const int EXPECTED_ELEMENT = 1002;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.Remove(tree.PositionOf(REMOVED_ELEMENT, ETreeTraversalOrder::E_DepthFirstInOrder));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itResult, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that the returned iterator points to the end position when the greatest element is removed.
+/// </summary>
+ZTEST_CASE ( Remove_ReturnedIteratorPointsToEndPositionWhenThereIsNoNextElement_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.Remove(tree.GetLast(ETreeTraversalOrder::E_DepthFirstInOrder));
+
+    // [Verification]
+    BOOST_CHECK(itResult.IsEnd());
+}
+
+/// <summary>
+/// Checks that the destructor of the removed element is called.
+/// </summary>
+ZTEST_CASE ( Remove_DestructorOfElementIsCalled_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_CALLS = 1U;
+    BTree<BTreeTestElement> tree;
+
+    for(int i = 0; i < 300; ++i)
+        tree.Add(BTreeTestElement(i), ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    BTree<BTreeTestElement>::ConstIterator itElement = tree.PositionOf(BTreeTestElement(150), ETreeTraversalOrder::E_DepthFirstInOrder);
+    BTreeTestElement::ResetCounters();
+
+    // [Execution]
+    tree.Remove(itElement);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(BTreeTestElement::sm_uDestructorCalls, EXPECTED_CALLS);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input iterator points to end position.
+/// </summary>
+ZTEST_CASE ( Remove_AssertionFailsWhenTheInputIteratorPointsToEndPosition_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    BTree<int>::ConstIterator itEnd = tree.Add(0, ETreeTraversalOrder::E_DepthFirstInOrder);
+    ++itEnd;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        tree.Remove(itEnd);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the tree is emptied and can be used again.
+/// </summary>
+ZTEST_CASE ( Clear_TheTreeIsEmptied_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    tree.Clear();
+
+    // [Verification]
+    BOOST_CHECK(tree.IsEmpty());
+    BOOST_CHECK(tree.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder).IsEnd());
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(tree, MANY_ELEMENTS, -1));
+}
+
+/// <summary>
+/// Checks that it returns True when the tree contains the element.
+/// </summary>
+ZTEST_CASE ( Contains_ReturnsTrueWhenTreeContainsTheElement_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    bool bResult = tree.Contains(1234);
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+}
+
+/// <summary>
+/// Checks that it returns False when the tree does not contain the element.
+/// </summary>
+ZTEST_CASE ( Contains_ReturnsFalseWhenTreeDoesNotContainTheElement_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    bool bResult = tree.Contains(1235);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+}
+
+/// <summary>
+/// Checks that elements are visited in descending order when iterating backward.
+/// </summary>
+ZTEST_CASE ( GetLast_ElementsAreVisitedInDescendingOrderWhenIteratingBackward_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+    bool bElementsAreDescending = true;
+    int nExpectedElement = (MANY_ELEMENTS - 1) * 2;
+
+    // [Execution]
+    BTree<int>::ConstIterator it = tree.GetLast(ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(; !it.IsEnd() && bElementsAreDescending; --it, nExpectedElement -= 2)
+        bElementsAreDescending = *it == nExpectedElement;
+
+    // [Verification]
+    BOOST_CHECK(bElementsAreDescending);
+    BOOST_CHECK(it.IsEnd(EIterationDirection::E_Backward));
+    BOOST_CHECK_EQUAL(nExpectedElement, -2);
+}
+
+/// <summary>
+/// Checks that iterators compare as the elements they point to.
+/// </summary>
+ZTEST_CASE ( ConstIterator_OperatorLowerThanComparesElements_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+    BTree<int>::ConstIterator itLower = tree.PositionOf(10, ETreeTraversalOrder::E_DepthFirstInOrder);
+    BTree<int>::ConstIterator itGreater = tree.PositionOf(3000, ETreeTraversalOrder::E_DepthFirstInOrder);
+    BTree<int>::ConstIterator itEnd = tree.GetLast(ETreeTraversalOrder::E_DepthFirstInOrder);
+    ++itEnd;
+
+    // [Execution]
+    bool bLowerIsLower = itLower < itGreater;
+    bool bGreaterIsLower = itGreater < itLower;
+    bool bGreaterIsLowerThanEnd = itGreater < itEnd;
+
+    // [Verification]
+    BOOST_CHECK(bLowerIsLower);
+    BOOST_CHECK(!bGreaterIsLower);
+    BOOST_CHECK(bGreaterIsLowerThanEnd);
+}
+
+/// <summary>
+/// Checks that it returns the element that equals the value when the tree contains it.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsElementEqualToValueWhenTreeContainsIt_Test )
+{
+    // [Preparation]
+    const int EXPECTED_ELEMENT = 1500;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.LowerBound(EXPECTED_ELEMENT, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itResult, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that it returns the lowest element that is greater than the value when the tree does not contain it.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsNextElementWhenTreeDoesNotContainTheValue_Test )
+{
+    // [Preparation]
+    const int INPUT_VALUE = 1501;
+    const int EXPECTED_ELEMENT = 1502;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.LowerBound(INPUT_VALUE, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itResult, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that it returns an iterator that points to the end position when all the elements are lower than the value.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsEndPositionWhenAllElementsAreLowerThanValue_Test )
+{
+    // [Preparation]
+    const int INPUT_VALUE = MANY_ELEMENTS * 2;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.LowerBound(INPUT_VALUE, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK(itResult.IsEnd());
+}
+
+/// <summary>
+/// Checks that it returns the element that follows the value when the tree contains it.
+/// </summary>
+ZTEST_CASE ( UpperBound_ReturnsNextElementWhenTreeContainsTheValue_Test )
+{
+    // [Preparation]
+    const int INPUT_VALUE = 1500;
+    const int EXPECTED_ELEMENT = 1502;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.UpperBound(INPUT_VALUE, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itResult, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that it returns an iterator that points to the end position when no element is greater than the value.
+/// </summary>
+ZTEST_CASE ( UpperBound_ReturnsEndPositionWhenNoElementIsGreaterThanValue_Test )
+{
+    // [Preparation]
+    const int INPUT_VALUE = (MANY_ELEMENTS - 1) * 2;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int>::ConstIterator itResult = tree.UpperBound(INPUT_VALUE, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK(itResult.IsEnd());
+}
+
+/// <summary>
+/// Checks that the returned tree contains the elements in the range, including both ends.
+/// </summary>
+ZTEST_CASE ( GetRange_ReturnsElementsInTheRange_Test )
+{
+    // [Preparation]
+    const int INPUT_LOWER_VALUE = 99;
+    const int INPUT_UPPER_VALUE = 300;
+    const int EXPECTED_FIRST_ELEMENT = 100;
+    const int EXPECTED_LAST_ELEMENT = 300;
+    const puint_z EXPECTED_COUNT = 101U;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int> range = tree.GetRange(INPUT_LOWER_VALUE, INPUT_UPPER_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(range.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(*range.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder), EXPECTED_FIRST_ELEMENT);
+    BOOST_CHECK_EQUAL(*range.GetLast(ETreeTraversalOrder::E_DepthFirstInOrder), EXPECTED_LAST_ELEMENT);
+}
+
+/// <summary>
+/// Checks that the returned tree is empty when no element is in the range.
+/// </summary>
+ZTEST_CASE ( GetRange_ReturnsEmptyTreeWhenNoElementIsInTheRange_Test )
+{
+    // [Preparation]
+    const int INPUT_LOWER_VALUE = 101;
+    const int INPUT_UPPER_VALUE = 101;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, MANY_ELEMENTS);
+
+    // [Execution]
+    BTree<int> range = tree.GetRange(INPUT_LOWER_VALUE, INPUT_UPPER_VALUE);
+
+    // [Verification]
+    BOOST_CHECK(range.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the cloned tree has the same elements as the original tree.
+/// </summary>
+ZTEST_CASE ( Clone_ClonedTreeHasSameValuesThanTheOriginalTree_Test )
+{
+    // [Preparation]
+    BTree<int> TREE;
+    AddEvenNumbers_TestMethod(TREE, MANY_ELEMENTS);
+    BTree<int> clonedTree;
+
+    // [Execution]
+    TREE.Clone(clonedTree);
+
+    // [Verification]
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(clonedTree, MANY_ELEMENTS, -1));
+}
+
+/// <summary>
+/// Checks that the elements and the capacity of both trees are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap_ElementsAndCapacityAreExchanged_Test )
+{
+    // [Preparation]
+    BTree<int> tree1;
+    AddEvenNumbers_TestMethod(tree1, MANY_ELEMENTS);
+    BTree<int> tree2;
+    tree2.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    const puint_z EXPECTED_CAPACITY1 = tree2.GetCapacity();
+    const puint_z EXPECTED_CAPACITY2 = tree1.GetCapacity();
+    const puint_z EXPECTED_COUNT1 = 1U;
+
+    // [Execution]
+    tree1.Swap(tree2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(tree1.GetCapacity(), EXPECTED_CAPACITY1);
+    BOOST_CHECK_EQUAL(tree2.GetCapacity(), EXPECTED_CAPACITY2);
+    BOOST_CHECK_EQUAL(tree1.GetCount(), EXPECTED_COUNT1);
+    BOOST_CHECK_EQUAL(*tree1.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder), 1);
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(tree2, MANY_ELEMENTS, -1));
+}
+
+/// <summary>
+/// Checks that the capacity is enough to store the input number of elements.
+/// </summary>
+ZTEST_CASE ( Reserve_CapacityIsCorrectlyIncreased_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_NUMBER_OF_ELEMENTS = 5000U;
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, 100);
+
+    // [Execution]
+    tree.Reserve(INPUT_NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK(tree.GetCapacity() >= INPUT_NUMBER_OF_ELEMENTS);
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(tree, 100, -1));
+}
+
+/// <summary>
+/// Checks that the tree contains all the input elements, in the same order, when they need several levels of nodes.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_TreeContainsTheElementsInOrder_Test )
+{
+    // [Preparation]
+    int arInputElements[MANY_ELEMENTS];
+
+    for(int i = 0; i < MANY_ELEMENTS; ++i)
+        arInputElements[i] = i * 2;
+
+    BTree<int> tree;
+
+    // [Execution]
+    tree.BuildFromSorted(arInputElements, MANY_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(tree.GetCount(), scast_z(MANY_ELEMENTS, puint_z));
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(tree, MANY_ELEMENTS, -1));
+}
+
+/// <summary>
+/// Checks that the nodes keep the properties of the B-tree, so elements can be added and removed as usual after the tree is built.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_ElementsCanBeAddedAndRemovedAfterwards_Test )
+{
+    // [Preparation]
+    int arInputElements[MANY_ELEMENTS];
+
+    for(int i = 0; i < MANY_ELEMENTS; ++i)
+        arInputElements[i] = i * 2;
+
+    BTree<int> tree;
+    tree.BuildFromSorted(arInputElements, MANY_ELEMENTS);
+
+    // [Execution]
+    for(int i = 0; i < MANY_ELEMENTS; ++i)
+        tree.Add(i * 2 + 1, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(int i = 0; i < MANY_ELEMENTS; ++i)
+        tree.Remove(tree.PositionOf(((i * 7) % MANY_ELEMENTS) * 2 + 1, ETreeTraversalOrder::E_DepthFirstInOrder));
+
+    // [Verification]
+    BOOST_CHECK(ContainsEvenNumbersInOrder_TestMethod(tree, MANY_ELEMENTS, -1));
+}
+
+/// <summary>
+/// Checks that the copy constructor is called once per input element and the destructor once per element the tree had before.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_CopyConstructorIsCalledOncePerElement_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_COUNT = 100U;
+    const puint_z PREVIOUS_COUNT = 3U;
+    BTree<BTreeTestElement> tree;
+
+    for(puint_z i = 0; i < PREVIOUS_COUNT; ++i)
+        tree.Add(BTreeTestElement(-scast_z(i, int)), ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    BTreeTestElement* arInputElements = scast_z(operator new(INPUT_COUNT * sizeof(BTreeTestElement)), BTreeTestElement*);
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+        new(arInputElements + i) BTreeTestElement(scast_z(i, int));
+
+    BTreeTestElement::ResetCounters();
+
+    // [Execution]
+    tree.BuildFromSorted(arInputElements, INPUT_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(BTreeTestElement::sm_uCopyConstructorCalls, INPUT_COUNT);
+    BOOST_CHECK_EQUAL(BTreeTestElement::sm_uDestructorCalls, PREVIOUS_COUNT);
+    BOOST_CHECK_EQUAL(tree.GetCount(), INPUT_COUNT);
+
+    // [Cleaning]
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+        arInputElements[i].~BTreeTestElement();
+
+    operator delete(arInputElements);
+}
+
+/// <summary>
+/// Checks that the tree is empty when there are no input elements.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_TreeIsEmptyWhenThereAreNoElements_Test )
+{
+    // [Preparation]
+    BTree<int> tree;
+    AddEvenNumbers_TestMethod(tree, 100);
+
+    // [Execution]
+    tree.BuildFromSorted(null_z, 0);
+
+    // [Verification]
+    BOOST_CHECK(tree.IsEmpty());
+    BOOST_CHECK(tree.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder).IsEnd());
+}
+
+// End - Test Suite: BTree
+ZTEST_SUITE_END()
@@ -1803,6 +1803,108 @@ ZTEST_CASE ( PositionOf_ReturnsEndPositionWhenTreeIsEmptyAndUsingDepthFirstInOrd
     BOOST_CHECK(bIteratorIsEnd);
 }
 
+/// <summary>
+/// Checks that it returns the element that equals the value when the tree contains it.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsElementEqualToValueWhenTreeContainsIt_Test )
+{
+    // [Preparation]
+    const int EXPECTED_ELEMENT = 4;
+    BinarySearchTree<int> TREE(5);
+    TREE.Add(3, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(6, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(4, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    BinarySearchTree<int>::ConstBinarySearchTreeIterator itPosition = TREE.LowerBound(EXPECTED_ELEMENT, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itPosition, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that it returns the lowest element that is greater than the value when the tree does not contain it.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsNextElementWhenTreeDoesNotContainTheValue_Test )
+{
+    // [Preparation]
+    const int INPUT_VALUE = 5;
+    const int EXPECTED_ELEMENT = 6;
+    BinarySearchTree<int> TREE(5);
+    TREE.Add(3, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(6, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(4, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    BinarySearchTree<int>::ConstBinarySearchTreeIterator itPosition = TREE.LowerBound(INPUT_VALUE, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itPosition, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that it returns an iterator that points to the end position when all the elements are lower than the value.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsEndPositionWhenAllElementsAreLowerThanValue_Test )
+{
+    // [Preparation]
+    const int INPUT_VALUE = 7;
+    BinarySearchTree<int> TREE(5);
+    TREE.Add(3, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(6, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    BinarySearchTree<int>::ConstBinarySearchTreeIterator itPosition = TREE.LowerBound(INPUT_VALUE, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    bool bIteratorIsEnd = itPosition.IsEnd();
+    BOOST_CHECK(bIteratorIsEnd);
+}
+
+/// <summary>
+/// Checks that it returns the element that follows the value when the tree contains it.
+/// </summary>
+ZTEST_CASE ( UpperBound_ReturnsNextElementWhenTreeContainsTheValue_Test )
+{
+    // [Preparation]
+    const int INPUT_VALUE = 4;
+    const int EXPECTED_ELEMENT = 6;
+    BinarySearchTree<int> TREE(5);
+    TREE.Add(3, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(6, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(4, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    BinarySearchTree<int>::ConstBinarySearchTreeIterator itPosition = TREE.UpperBound(INPUT_VALUE, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itPosition, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that it returns an iterator that points to the end position when no element is greater than the value.
+/// </summary>
+ZTEST_CASE ( UpperBound_ReturnsEndPositionWhenNoElementIsGreaterThanValue_Test )
+{
+    // [Preparation]
+    const int INPUT_VALUE = 6;
+    BinarySearchTree<int> TREE(5);
+    TREE.Add(3, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(6, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    BinarySearchTree<int>::ConstBinarySearchTreeIterator itPosition = TREE.UpperBound(INPUT_VALUE, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    bool bIteratorIsEnd = itPosition.IsEnd();
+    BOOST_CHECK(bIteratorIsEnd);
+}
+
 /// <summary>
 /// Checks if it the clone method works properly.
 /// </summary>
@@ -1903,6 +2005,196 @@ ZTEST_CASE ( Clone_ClonedTreeHasSameValuesThanTheOriginalTreeWhenInputTreeHasLes
     BOOST_CHECK(bResultIsWhatEspected);
 }
 
+/// <summary>
+/// Checks that the elements and the capacity of both trees are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap_ElementsAndCapacityAreExchanged_Test )
+{
+    // [Preparation]
+    const int EXPECTED_VALUES_A[] = {4, 5};
+    const int EXPECTED_VALUES_B[] = {1, 2, 3};
+    const puint_z CAPACITY_A = 3U;
+    const puint_z CAPACITY_B = 6U;
+    BinarySearchTree<int> treeA(CAPACITY_A);
+    treeA.Add(2, ETreeTraversalOrder::E_DepthFirstInOrder);
+    treeA.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+    treeA.Add(3, ETreeTraversalOrder::E_DepthFirstInOrder);
+    BinarySearchTree<int> treeB(CAPACITY_B);
+    treeB.Add(5, ETreeTraversalOrder::E_DepthFirstInOrder);
+    treeB.Add(4, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    treeA.Swap(treeB);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+    int i = 0;
+
+    for(BinarySearchTree<int>::ConstBinarySearchTreeIterator it = treeA.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder); !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES_A[i];
+
+    i = 0;
+
+    for(BinarySearchTree<int>::ConstBinarySearchTreeIterator it = treeB.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder); !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES_B[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(treeA.GetCount(), 2U);
+    BOOST_CHECK_EQUAL(treeB.GetCount(), 3U);
+    BOOST_CHECK_EQUAL(treeA.GetCapacity(), CAPACITY_B);
+    BOOST_CHECK_EQUAL(treeB.GetCapacity(), CAPACITY_A);
+}
+
+/// <summary>
+/// Checks that the tree contains all the input elements, in the same order.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_TreeContainsTheElementsInOrder_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 1, 3, 5, 7, 9, 11, 13, 15, 17, 19 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    BinarySearchTree<int> tree;
+
+    // [Execution]
+    tree.BuildFromSorted(INPUT_ELEMENTS, INPUT_COUNT);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(tree.GetCount(), INPUT_COUNT);
+    BinarySearchTree<int>::ConstBinarySearchTreeIterator it = tree.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i, ++it)
+        BOOST_CHECK_EQUAL(*it, INPUT_ELEMENTS[i]);
+
+    BOOST_CHECK(it.IsEnd());
+}
+
+/// <summary>
+/// Checks that every subtree has the element in the middle of its range as root, so the tree is balanced.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_TreeIsBalanced_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 1, 2, 3, 4, 5, 6, 7 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    const int EXPECTED_ROOT = 4;
+    const int EXPECTED_LEFT_CHILD = 2;
+    const int EXPECTED_RIGHT_CHILD = 6;
+    BinarySearchTreeWhiteBox<int> tree;
+
+    // [Execution]
+    tree.BuildFromSorted(INPUT_ELEMENTS, INPUT_COUNT);
+
+    // [Verification]
+    typedef BinarySearchTreeWhiteBox<int>::BinaryNode BinaryNode;
+    const BinaryNode* arNodes = scast_z(tree.GetNodeAllocator().GetPointer(), const BinaryNode*);
+    const puint_z ROOT = tree.GetRootPosition();
+    const puint_z LEFT_CHILD = arNodes[ROOT].GetLeftChild();
+    const puint_z RIGHT_CHILD = arNodes[ROOT].GetRightChild();
+
+    BOOST_CHECK_EQUAL(*BinarySearchTree<int>::ConstBinarySearchTreeIterator(&tree, ROOT, ETreeTraversalOrder::E_DepthFirstInOrder), EXPECTED_ROOT);
+    BOOST_CHECK_EQUAL(*BinarySearchTree<int>::ConstBinarySearchTreeIterator(&tree, LEFT_CHILD, ETreeTraversalOrder::E_DepthFirstInOrder), EXPECTED_LEFT_CHILD);
+    BOOST_CHECK_EQUAL(*BinarySearchTree<int>::ConstBinarySearchTreeIterator(&tree, RIGHT_CHILD, ETreeTraversalOrder::E_DepthFirstInOrder), EXPECTED_RIGHT_CHILD);
+    BOOST_CHECK(arNodes[arNodes[LEFT_CHILD].GetLeftChild()].GetLeftChild() == BinarySearchTreeWhiteBox<int>::GetEndPositionForward());
+    BOOST_CHECK(arNodes[arNodes[RIGHT_CHILD].GetRightChild()].GetRightChild() == BinarySearchTreeWhiteBox<int>::GetEndPositionForward());
+}
+
+/// <summary>
+/// Checks that the elements the tree had before are removed.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_PreviousElementsAreRemoved_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 10, 20, 30 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    BinarySearchTree<int> tree;
+    tree.Add(5, ETreeTraversalOrder::E_DepthFirstInOrder);
+    tree.Add(25, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    tree.BuildFromSorted(INPUT_ELEMENTS, INPUT_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(tree.GetCount(), INPUT_COUNT);
+    BOOST_CHECK(!tree.Contains(5));
+    BOOST_CHECK(!tree.Contains(25));
+    BOOST_CHECK(tree.Contains(20));
+}
+
+/// <summary>
+/// Checks that elements can be added and removed as usual after the tree is built.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_ElementsCanBeAddedAndRemovedAfterwards_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 10, 20, 30, 40, 50 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    const int EXPECTED_ELEMENTS[] = { 10, 25, 40, 50, 60 };
+    BinarySearchTree<int> tree;
+    tree.BuildFromSorted(INPUT_ELEMENTS, INPUT_COUNT);
+
+    // [Execution]
+    tree.Add(60, ETreeTraversalOrder::E_DepthFirstInOrder);
+    tree.Add(25, ETreeTraversalOrder::E_DepthFirstInOrder);
+    tree.Remove(tree.PositionOf(30, ETreeTraversalOrder::E_DepthFirstInOrder));
+    tree.Remove(tree.PositionOf(20, ETreeTraversalOrder::E_DepthFirstInOrder));
+
+    // [Verification]
+    BinarySearchTree<int>::ConstBinarySearchTreeIterator it = tree.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(puint_z i = 0; i < sizeof(EXPECTED_ELEMENTS) / sizeof(int); ++i, ++it)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[i]);
+
+    BOOST_CHECK(it.IsEnd());
+}
+
+/// <summary>
+/// Checks that the tree is empty when there are no input elements.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_TreeIsEmptyWhenThereAreNoElements_Test )
+{
+    // [Preparation]
+    BinarySearchTree<int> tree;
+    tree.Add(1, ETreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    tree.BuildFromSorted(null_z, 0);
+
+    // [Verification]
+    BOOST_CHECK(tree.IsEmpty());
+    BOOST_CHECK(tree.GetFirst(ETreeTraversalOrder::E_DepthFirstInOrder).IsEnd());
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input elements are not sorted.
+/// </summary>
+ZTEST_CASE ( BuildFromSorted_AssertionFailsWhenElementsAreNotSorted_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 1, 3, 2 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    BinarySearchTree<int> tree;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        tree.BuildFromSorted(INPUT_ELEMENTS, INPUT_COUNT);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
 /// <summary>
 /// Checks that the capacity is correctly calculated.
 /// </summary>
@@ -0,0 +1,432 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/ConcurrentHashtable.h"
+
+#include "ZContainers/SStringHashProvider.h"
+#include "ZThreading/Thread.h"
+#include <boost/atomic.hpp>
+
+// Class whose methods are to be used by the threads in the tests of ConcurrentHashtable
+class ConcurrentHashtableTestClass
+{
+public:
+
+    static const u64_z KEYS_PER_THREAD = 2000U;
+
+    static boost::atomic<u64_z> sm_uNextThread;
+    static boost::atomic<u64_z> sm_uMismatches;
+
+    // Adds a different range of keys in every thread, whose values are the keys multiplied by 2
+    static void AddOrUpdateDifferentKeys(ConcurrentHashtable<u64_z, u64_z>* pHashtable)
+    {
+        const u64_z FIRST_KEY = sm_uNextThread.fetch_add(1U) * KEYS_PER_THREAD;
+
+        for(u64_z uKey = FIRST_KEY; uKey < FIRST_KEY + KEYS_PER_THREAD; ++uKey)
+            pHashtable->AddOrUpdate(uKey, uKey * 2U);
+    }
+
+    // Adds the same keys in every thread, using the thread number as value, and counts how many times the obtained value was not the one stored
+    static void GetOrAddSameKeys(ConcurrentHashtable<u64_z, u64_z>* pHashtable)
+    {
+        const u64_z THREAD_NUMBER = sm_uNextThread.fetch_add(1U);
+        u64_z uMismatches = 0;
+
+        for(u64_z uKey = 0; uKey < KEYS_PER_THREAD; ++uKey)
+        {
+            const u64_z VALUE = pHashtable->GetOrAdd(uKey, THREAD_NUMBER);
+            u64_z uStoredValue = 0;
+
+            if(!pHashtable->TryGetValue(uKey, uStoredValue) || uStoredValue != VALUE)
+                ++uMismatches;
+        }
+
+        sm_uMismatches.fetch_add(uMismatches);
+    }
+};
+
+boost::atomic<u64_z> ConcurrentHashtableTestClass::sm_uNextThread(0);
+boost::atomic<u64_z> ConcurrentHashtableTestClass::sm_uMismatches(0);
+
+
+ZTEST_SUITE_BEGIN( ConcurrentHashtable_TestSuite )
+
+/// <summary>
+/// Checks that the hash table is empty and has the expected number of segments after construction.
+/// </summary>
+ZTEST_CASE ( Constructor_HashtableIsEmptyAndHasExpectedSegments_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_SEGMENTS = 8U;
+    const puint_z EXPECTED_COUNT = 0;
+
+    // [Execution]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(EXPECTED_SEGMENTS, 4U, 2U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(hashtable.GetSegmentCount(), EXPECTED_SEGMENTS);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(hashtable.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the key-value pair is added when the key does not exist.
+/// </summary>
+ZTEST_CASE ( GetOrAdd_PairIsAddedWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(4U, 4U, 2U);
+    const u64_z KEY = 5U;
+    const u64_z EXPECTED_VALUE = 10U;
+
+    // [Execution]
+    u64_z uValue = hashtable.GetOrAdd(KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    u64_z uStoredValue = 0;
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+    BOOST_CHECK(hashtable.TryGetValue(KEY, uStoredValue));
+    BOOST_CHECK_EQUAL(uStoredValue, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), 1U);
+}
+
+/// <summary>
+/// Checks that the existing value is returned and not replaced when the key exists.
+/// </summary>
+ZTEST_CASE ( GetOrAdd_ExistingValueIsReturnedWhenKeyExists_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(4U, 4U, 2U);
+    const u64_z KEY = 5U;
+    const u64_z EXPECTED_VALUE = 10U;
+    hashtable.GetOrAdd(KEY, EXPECTED_VALUE);
+
+    // [Execution]
+    u64_z uValue = hashtable.GetOrAdd(KEY, 20U);
+
+    // [Verification]
+    u64_z uStoredValue = 0;
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+    BOOST_CHECK(hashtable.TryGetValue(KEY, uStoredValue));
+    BOOST_CHECK_EQUAL(uStoredValue, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), 1U);
+}
+
+/// <summary>
+/// Checks that the output value is not modified and it returns False when the key does not exist.
+/// </summary>
+ZTEST_CASE ( TryGetValue_ReturnsFalseAndDoesNotModifyValueWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(4U, 4U, 2U);
+    hashtable.GetOrAdd(1U, 10U);
+    const u64_z EXPECTED_VALUE = 123U;
+    u64_z uValue = EXPECTED_VALUE;
+
+    // [Execution]
+    bool bResult = hashtable.TryGetValue(2U, uValue);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the key-value pair is added and it returns True when the key does not exist.
+/// </summary>
+ZTEST_CASE ( AddOrUpdate_PairIsAddedWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(4U, 4U, 2U);
+    const u64_z KEY = 7U;
+    const u64_z EXPECTED_VALUE = 14U;
+
+    // [Execution]
+    bool bResult = hashtable.AddOrUpdate(KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    u64_z uStoredValue = 0;
+    BOOST_CHECK(bResult);
+    BOOST_CHECK(hashtable.TryGetValue(KEY, uStoredValue));
+    BOOST_CHECK_EQUAL(uStoredValue, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the value is replaced and it returns False when the key exists.
+/// </summary>
+ZTEST_CASE ( AddOrUpdate_ValueIsReplacedWhenKeyExists_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(4U, 4U, 2U);
+    const u64_z KEY = 7U;
+    const u64_z EXPECTED_VALUE = 21U;
+    hashtable.AddOrUpdate(KEY, 14U);
+
+    // [Execution]
+    bool bResult = hashtable.AddOrUpdate(KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    u64_z uStoredValue = 0;
+    BOOST_CHECK(!bResult);
+    BOOST_CHECK(hashtable.TryGetValue(KEY, uStoredValue));
+    BOOST_CHECK_EQUAL(uStoredValue, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), 1U);
+}
+
+/// <summary>
+/// Checks that the key-value pair is removed and it returns True when the key exists.
+/// </summary>
+ZTEST_CASE ( TryRemove_PairIsRemovedWhenKeyExists_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(4U, 4U, 2U);
+    const u64_z KEY = 3U;
+    hashtable.AddOrUpdate(KEY, 6U);
+    hashtable.AddOrUpdate(4U, 8U);
+
+    // [Execution]
+    bool bResult = hashtable.TryRemove(KEY);
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+    BOOST_CHECK(!hashtable.ContainsKey(KEY));
+    BOOST_CHECK(hashtable.ContainsKey(4U));
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), 1U);
+}
+
+/// <summary>
+/// Checks that it returns False when the key does not exist.
+/// </summary>
+ZTEST_CASE ( TryRemove_ReturnsFalseWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(4U, 4U, 2U);
+    hashtable.AddOrUpdate(4U, 8U);
+
+    // [Execution]
+    bool bResult = hashtable.TryRemove(3U);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), 1U);
+}
+
+/// <summary>
+/// Checks that keys are distributed among all the segments and all of them can be found.
+/// </summary>
+ZTEST_CASE ( ContainsKey_AllKeysAreFoundWhenTheyAreDistributedAmongSegments_Test )
+{
+    // [Preparation]
+    const u64_z KEY_COUNT = 1000U;
+    ConcurrentHashtable<u64_z, u64_z> hashtable(8U, 16U, 2U);
+
+    for(u64_z uKey = 0; uKey < KEY_COUNT; ++uKey)
+        hashtable.AddOrUpdate(uKey * 3U, uKey);
+
+    // [Execution]
+    bool bAllFound = true;
+    bool bNoneFound = false;
+
+    for(u64_z uKey = 0; uKey < KEY_COUNT; ++uKey)
+    {
+        bAllFound = bAllFound && hashtable.ContainsKey(uKey * 3U);
+        bNoneFound = bNoneFound || hashtable.ContainsKey(uKey * 3U + 1U);
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAllFound);
+    BOOST_CHECK(!bNoneFound);
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), KEY_COUNT);
+}
+
+/// <summary>
+/// Checks that string keys can be used with a string hash provider.
+/// </summary>
+ZTEST_CASE ( GetOrAdd_StringKeysCanBeUsed_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<string_z, u64_z, SStringHashProvider> hashtable(4U, 4U, 2U);
+    hashtable.GetOrAdd("First", 1U);
+    hashtable.GetOrAdd("Second", 2U);
+    const u64_z EXPECTED_VALUE = 2U;
+
+    // [Execution]
+    u64_z uValue = hashtable.GetOrAdd("Second", 3U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+    BOOST_CHECK(hashtable.ContainsKey("First"));
+    BOOST_CHECK(!hashtable.ContainsKey("Third"));
+}
+
+/// <summary>
+/// Checks that the iterator points to the end position when the hash table is empty.
+/// </summary>
+ZTEST_CASE ( GetFirst_IteratorPointsToEndPositionWhenHashtableIsEmpty_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(4U, 4U, 2U);
+
+    // [Execution]
+    ConcurrentHashtable<u64_z, u64_z>::ConstIterator it = hashtable.GetFirst();
+
+    // [Verification]
+    BOOST_CHECK(it.IsEnd());
+}
+
+/// <summary>
+/// Checks that the iterator visits every key-value pair once.
+/// </summary>
+ZTEST_CASE ( GetFirst_IteratorVisitsEveryPairOnce_Test )
+{
+    // [Preparation]
+    const u64_z KEY_COUNT = 100U;
+    const u64_z EXPECTED_KEY_SUM = KEY_COUNT * (KEY_COUNT - 1U) / 2U;
+    const u64_z EXPECTED_VALUE_SUM = EXPECTED_KEY_SUM * 2U;
+    ConcurrentHashtable<u64_z, u64_z> hashtable(8U, 4U, 2U);
+
+    for(u64_z uKey = 0; uKey < KEY_COUNT; ++uKey)
+        hashtable.AddOrUpdate(uKey, uKey * 2U);
+
+    // [Execution]
+    u64_z uKeySum = 0;
+    u64_z uValueSum = 0;
+    u64_z uVisitedPairs = 0;
+
+    for(ConcurrentHashtable<u64_z, u64_z>::ConstIterator it = hashtable.GetFirst(); !it.IsEnd(); ++it)
+    {
+        uKeySum += it->GetKey();
+        uValueSum += (*it).GetValue();
+        ++uVisitedPairs;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uVisitedPairs, KEY_COUNT);
+    BOOST_CHECK_EQUAL(uKeySum, EXPECTED_KEY_SUM);
+    BOOST_CHECK_EQUAL(uValueSum, EXPECTED_VALUE_SUM);
+}
+
+/// <summary>
+/// Checks that the pairs of the segment the iterator already copied are not affected when they are modified in the hash table.
+/// </summary>
+ZTEST_CASE ( GetFirst_CopiedPairsAreNotAffectedByLaterModifications_Test )
+{
+    // [Preparation]
+    ConcurrentHashtable<u64_z, u64_z> hashtable(1U, 4U, 2U);
+    const u64_z KEY = 1U;
+    const u64_z EXPECTED_VALUE = 10U;
+    hashtable.AddOrUpdate(KEY, EXPECTED_VALUE);
+    ConcurrentHashtable<u64_z, u64_z>::ConstIterator it = hashtable.GetFirst();
+
+    // [Execution]
+    hashtable.AddOrUpdate(KEY, 20U);
+    hashtable.TryRemove(KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(it->GetKey(), KEY);
+    BOOST_CHECK_EQUAL(it->GetValue(), EXPECTED_VALUE);
+    ++it;
+    BOOST_CHECK(it.IsEnd());
+}
+
+/// <summary>
+/// Checks that no key-value pair is lost when several threads add different keys at the same time.
+/// </summary>
+ZTEST_CASE ( AddOrUpdate_NoPairIsLostWhenSeveralThreadsAddKeysAtTheSameTime_Test )
+{
+    // [Preparation]
+    const puint_z THREAD_COUNT = 4U;
+    const puint_z EXPECTED_COUNT = THREAD_COUNT * ConcurrentHashtableTestClass::KEYS_PER_THREAD;
+    ConcurrentHashtable<u64_z, u64_z> hashtable(8U, 64U, 2U);
+    ConcurrentHashtableTestClass::sm_uNextThread = 0;
+    Delegate<void(ConcurrentHashtable<u64_z, u64_z>*)> addOrUpdate(&ConcurrentHashtableTestClass::AddOrUpdateDifferentKeys);
+
+    // [Execution]
+    Thread* arThreads[THREAD_COUNT];
+
+    for(puint_z i = 0; i < THREAD_COUNT; ++i)
+        arThreads[i] = new Thread(addOrUpdate, &hashtable);
+
+    for(puint_z i = 0; i < THREAD_COUNT; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    bool bAllValuesAreCorrect = true;
+
+    for(u64_z uKey = 0; uKey < EXPECTED_COUNT; ++uKey)
+    {
+        u64_z uValue = 0;
+        bAllValuesAreCorrect = bAllValuesAreCorrect && hashtable.TryGetValue(uKey, uValue) && uValue == uKey * 2U;
+    }
+
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(bAllValuesAreCorrect);
+}
+
+/// <summary>
+/// Checks that every key is added only once and all the threads obtain the same value when they add the same keys at the same time.
+/// </summary>
+ZTEST_CASE ( GetOrAdd_KeysAreAddedOnceWhenSeveralThreadsAddTheSameKeysAtTheSameTime_Test )
+{
+    // [Preparation]
+    const puint_z THREAD_COUNT = 4U;
+    const puint_z EXPECTED_COUNT = ConcurrentHashtableTestClass::KEYS_PER_THREAD;
+    const u64_z EXPECTED_MISMATCHES = 0;
+    ConcurrentHashtable<u64_z, u64_z> hashtable(8U, 64U, 2U);
+    ConcurrentHashtableTestClass::sm_uNextThread = 0;
+    ConcurrentHashtableTestClass::sm_uMismatches = 0;
+    Delegate<void(ConcurrentHashtable<u64_z, u64_z>*)> getOrAdd(&ConcurrentHashtableTestClass::GetOrAddSameKeys);
+
+    // [Execution]
+    Thread* arThreads[THREAD_COUNT];
+
+    for(puint_z i = 0; i < THREAD_COUNT; ++i)
+        arThreads[i] = new Thread(getOrAdd, &hashtable);
+
+    for(puint_z i = 0; i < THREAD_COUNT; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    u64_z uMismatches = ConcurrentHashtableTestClass::sm_uMismatches;
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(uMismatches, EXPECTED_MISMATCHES);
+}
+
+// End - Test Suite: ConcurrentHashtable
+ZTEST_SUITE_END()
@@ -67,9 +67,9 @@ ZTEST_CASE ( Constructor_IteratorPointsToGivenPositionWhenUsingCommonHashtable_T
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
     const puint_z POSITION = 1;
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator EXPECTED_ITERATOR = HASHTABLE.GetFirst();
     ++EXPECTED_ITERATOR;
@@ -90,9 +90,9 @@ ZTEST_CASE ( Constructor_AssertionFailsWhenInputPositionIsNotLowerThanCapacity_T
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     const puint_z CAPACITY = HASHTABLE.GetCapacity();
     const unsigned int INVALID_POSITION = CAPACITY;
@@ -123,9 +123,9 @@ ZTEST_CASE ( Constructor_IteratorPointsToForwardEndPositionWhenUsingInvalidPosit
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     const unsigned int INVALID_POSITION = 999;
     const bool IS_END = true;
@@ -164,11 +164,11 @@ ZTEST_CASE ( OperatorIndirection_ReturnsTheCorrespondingElement_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    const string_z EXPECTED_KEY("key1");
+    const string_z EXPECTED_KEY("key-1");
     const int EXPECTED_VALUE = 1;
     HASHTABLE.Add(EXPECTED_KEY, EXPECTED_VALUE);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
     
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveFirst();
@@ -190,8 +190,8 @@ ZTEST_CASE ( OperatorIndirection_AssertionFailsWhenIteratorPointsToForwardEndPos
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveLast();
@@ -221,8 +221,8 @@ ZTEST_CASE ( OperatorIndirection_AssertionFailsWhenIteratorPointsToBackwardEndPo
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveFirst();
@@ -254,11 +254,11 @@ ZTEST_CASE ( OperatorDereferencing_ReturnsTheCorrespondingElement_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(7, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
-    const string_z EXPECTED_KEY("key2");
+    const string_z EXPECTED_KEY("key-2");
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR = HASHTABLE.GetFirst();
     ++ITERATOR;
 
@@ -278,9 +278,9 @@ ZTEST_CASE ( OperatorDereferencing_AssertionFailsWhenIteratorPointsToForwardEndP
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveLast();
@@ -310,9 +310,9 @@ ZTEST_CASE ( OperatorDereferencing_AssertionFailsWhenIteratorPointsToBackwardEnd
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveFirst();
@@ -343,12 +343,12 @@ ZTEST_CASE ( OperatorDereferencing_AssertionFailsWhenIteratorPointsToBackwardEnd
 ZTEST_CASE ( OperatorPostIncrement_CommonIteratorStepsForwardProperlyAndReturnsPreviousState_Test )
 {
     // [Preparation]
-    const string_z SECOND_ELEMENT_KEY("key2");
+    const string_z SECOND_ELEMENT_KEY("key-2");
     const int SECOND_ELEMENT_VALUE = 2;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
+    HASHTABLE.Add("key-1", 1);
     HASHTABLE.Add(SECOND_ELEMENT_KEY, SECOND_ELEMENT_VALUE);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
     ORIGINAL_ITERATOR.MoveFirst();
@@ -369,12 +369,12 @@ ZTEST_CASE ( OperatorPostIncrement_CommonIteratorStepsForwardProperlyAndReturnsP
 ZTEST_CASE ( OperatorPostIncrement_IteratorPointsToFirstPositionAndReturnsPreviousStateWhenItWaSVectorArrayingToPositionBeforeFirst_Test )
 {
     // [Preparation]
-    const string_z FIRST_ELEMENT_KEY("key1");
+    const string_z FIRST_ELEMENT_KEY("key-1");
     const int FIRST_ELEMENT_VALUE = 1;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
     ORIGINAL_ITERATOR.MoveFirst();
@@ -401,9 +401,9 @@ ZTEST_CASE ( OperatorPostIncrement_AssertionFailsWhenIteratorAlreadyPointsToLast
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_END(&HASHTABLE, 0);
     ITERATOR_END.MoveLast();
@@ -436,9 +436,9 @@ ZTEST_CASE ( OperatorPostIncrement_IteratorDoesNotChangeWhenItAlreadyPointsToLas
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(3, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_END(&HASHTABLE, 0);
     ITERATOR_END.MoveLast();
@@ -460,12 +460,12 @@ ZTEST_CASE ( OperatorPostIncrement_IteratorDoesNotChangeWhenItAlreadyPointsToLas
 ZTEST_CASE ( OperatorPostDecrement_CommonIteratorStepsBackwardProperlyAndReturnsPreviousState_Test )
 {
     // [Preparation]
-    const string_z SECOND_ELEMENT_KEY("key2");
+    const string_z SECOND_ELEMENT_KEY("key-2");
     const int SECOND_ELEMENT_VALUE = 2;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
+    HASHTABLE.Add("key-1", 1);
     HASHTABLE.Add(SECOND_ELEMENT_KEY, SECOND_ELEMENT_VALUE);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
     ORIGINAL_ITERATOR.MoveLast();
@@ -486,12 +486,12 @@ ZTEST_CASE ( OperatorPostDecrement_CommonIteratorStepsBackwardProperlyAndReturns
 ZTEST_CASE ( OperatorPostDecrement_IteratorPointsToLastPositionAndReturnsPreviousStateWhenItWaSVectorArrayingToLastEndPositionUsingDepthFirstInOrder_Test )
 {
     // [Preparation]
-    const string_z LAST_ELEMENT_KEY("key3");
+    const string_z LAST_ELEMENT_KEY("key-3");
     const int LAST_ELEMENT_VALUE = 3;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
     ORIGINAL_ITERATOR.MoveLast();
@@ -518,9 +518,9 @@ ZTEST_CASE ( OperatorPostDecrement_AssertionFailsWhenIteratorAlreadyPointsToEndP
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_END(&HASHTABLE, 0);
     ITERATOR_END.MoveFirst();
@@ -553,9 +553,9 @@ ZTEST_CASE ( OperatorPostDecrement_IteratorDoesNotChangeWhenItAlreadyPointsToEnd
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(3, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_END(&HASHTABLE, 0);
     ITERATOR_END.MoveFirst();
@@ -577,12 +577,12 @@ ZTEST_CASE ( OperatorPostDecrement_IteratorDoesNotChangeWhenItAlreadyPointsToEnd
 ZTEST_CASE ( OperatorPreIncrement_CommonIteratorStepsForwardProperlyAndReturnsCurrentStateWhenUsingDepthFirstInOrder_Test )
 {
     // [Preparation]
-    const string_z SECOND_ELEMENT_KEY("key2");
+    const string_z SECOND_ELEMENT_KEY("key-2");
     const int SECOND_ELEMENT_VALUE = 2;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR = HASHTABLE.GetFirst();
 
@@ -603,12 +603,12 @@ ZTEST_CASE ( OperatorPreIncrement_CommonIteratorStepsForwardProperlyAndReturnsCu
 ZTEST_CASE ( OperatorPreIncrement_IteratorPointsToFirstPositionAndReturnsCurrentStateWhenItWaSVectorArrayingToPositionBeforeFirstU_Test )
 {
     // [Preparation]
-    const string_z FIRST_ELEMENT_KEY("key1");
+    const string_z FIRST_ELEMENT_KEY("key-1");
     const int FIRST_ELEMENT_VALUE = 1;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
     HASHTABLE.Add(FIRST_ELEMENT_KEY, FIRST_ELEMENT_VALUE);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
     ORIGINAL_ITERATOR.MoveFirst();
@@ -636,9 +636,9 @@ ZTEST_CASE ( OperatorPreIncrement_AssertionFailsWhenIteratorAlreadyPointsToLastE
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_END(&HASHTABLE, 0);
     ITERATOR_END.MoveLast();
@@ -671,9 +671,9 @@ ZTEST_CASE ( OperatorPreIncrement_IteratorDoesNotChangeWhenItAlreadyPointsToLast
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_END(&HASHTABLE, 0);
     ITERATOR_END.MoveLast();
@@ -695,12 +695,12 @@ ZTEST_CASE ( OperatorPreIncrement_IteratorDoesNotChangeWhenItAlreadyPointsToLast
 ZTEST_CASE ( OperatorPreDecrement_CommonIteratorStepsBackwardProperlyAndReturnsCurrentState_Test )
 {
     // [Preparation]
-    const string_z SECOND_ELEMENT_KEY("key2");
+    const string_z SECOND_ELEMENT_KEY("key-2");
     const int SECOND_ELEMENT_VALUE = 2;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
+    HASHTABLE.Add("key-1", 1);
     HASHTABLE.Add(SECOND_ELEMENT_KEY, SECOND_ELEMENT_VALUE);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR = HASHTABLE.GetLast();
 
@@ -720,12 +720,12 @@ ZTEST_CASE ( OperatorPreDecrement_CommonIteratorStepsBackwardProperlyAndReturnsC
 ZTEST_CASE ( OperatorPreDecrement_IteratorPointsToLastPositionAndReturnsCurrentStateWhenItWaSVectorArrayingToLastEndPosition_Test )
 {
     // [Preparation]
-    const string_z LAST_ELEMENT_KEY("key3");
+    const string_z LAST_ELEMENT_KEY("key-3");
     const int LAST_ELEMENT_VALUE = 3;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR = HASHTABLE.GetLast();
     ORIGINAL_ITERATOR++;
@@ -752,9 +752,9 @@ ZTEST_CASE ( OperatorPreDecrement_AssertionFailsWhenIteratorAlreadyPointsToEndPo
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_END(&HASHTABLE, 0);
     ITERATOR_END.MoveFirst();
@@ -787,9 +787,9 @@ ZTEST_CASE ( OperatorPreDecrement_IteratorDoesNotChangeWhenItAlreadyPointsToEndP
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_END(&HASHTABLE, 0);
     ITERATOR_END.MoveFirst();
@@ -812,9 +812,9 @@ ZTEST_CASE ( OperatorAssignment_CommonIteratorIsCorrectlyCopied_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -837,13 +837,13 @@ ZTEST_CASE ( OperatorAssignment_AssertionFailsWhenInputIteratorPointsToDifferent
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
 
@@ -874,13 +874,13 @@ ZTEST_CASE ( OperatorAssignment_AssertionFailsWhenInputIteratorPointsToDifferent
 ZTEST_CASE ( OperatorAssignment_IteratorDoesNotChangeIfInputIteratorPointsToDifferentHashtable_Test )
 {
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(3, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE_B, 0);
@@ -903,9 +903,9 @@ ZTEST_CASE ( OperatorEquality_ReturnsTrueWhenIteratorsAreEqual_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -925,9 +925,9 @@ ZTEST_CASE ( OperatorEquality_ReturnsFalseWhenIteratorsAreNotEqual_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -951,13 +951,13 @@ ZTEST_CASE ( OperatorEquality_AssertionFailsWhenIteratorSVectorArrayToDifferentD
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
 
@@ -989,13 +989,13 @@ ZTEST_CASE ( OperatorEquality_ReturnsFalseWhenIteratorSVectorArrayToDifferentDic
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(3, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE_B, 0);
@@ -1017,9 +1017,9 @@ ZTEST_CASE ( OperatorInequality_ReturnsFalseWhenIteratorsAreEqual_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1039,9 +1039,9 @@ ZTEST_CASE ( OperatorInequality_ReturnsTrueWhenIteratorsAreNotEqual_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1065,13 +1065,13 @@ ZTEST_CASE ( OperatorInequality_AssertionFailsWhenIteratorSVectorArrayToDifferen
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
 
@@ -1103,13 +1103,13 @@ ZTEST_CASE ( OperatorInequality_ReturnsTrueWhenIteratorSVectorArrayToDifferentDi
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(3, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE_B, 0);
@@ -1131,9 +1131,9 @@ ZTEST_CASE ( OperatorGreaterThan_ReturnsTrueWhenResidentIteratorIsGreaterThanInp
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1154,9 +1154,9 @@ ZTEST_CASE ( OperatorGreaterThan_ReturnsFalseWhenResidentIteratorIsNotGreaterTha
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1179,13 +1179,13 @@ ZTEST_CASE ( OperatorGreaterThan_AssertionFailsWhenIteratorSVectorArrayToDiffere
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
 
@@ -1217,13 +1217,13 @@ ZTEST_CASE ( OperatorGreaterThan_ReturnsFalseWhenIteratorSVectorArrayToDifferent
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
     ++ITERATOR_A;
@@ -1246,9 +1246,9 @@ ZTEST_CASE ( OperatorLowerThan_ReturnsTrueWhenResidentIteratorIsLowerThanInputIt
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1269,9 +1269,9 @@ ZTEST_CASE ( OperatorLowerThan_ReturnsFalseWhenResidentIteratorIsNotLowerThanInp
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1294,13 +1294,13 @@ ZTEST_CASE ( OperatorLowerThan_AssertionFailsWhenIteratorSVectorArrayToDifferent
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
     ++ITERATOR_A;
@@ -1333,13 +1333,13 @@ ZTEST_CASE ( OperatorLowerThan_ReturnsFalseWhenIteratorSVectorArrayToDifferentDi
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE_B, 0);
@@ -1362,9 +1362,9 @@ ZTEST_CASE ( OperatorGreaterThanOrEquals_ReturnsTrueWhenResidentIteratorIsGreate
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1385,9 +1385,9 @@ ZTEST_CASE ( OperatorGreaterThanOrEquals_ReturnsTrueWhenResidentIteratorEqualsIn
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1407,9 +1407,9 @@ ZTEST_CASE ( OperatorGreaterThanOrEquals_ReturnsFalseWhenResidentIteratorIsNotGr
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1432,13 +1432,13 @@ ZTEST_CASE ( OperatorGreaterThanOrEquals_AssertionFailsWhenIteratorSVectorArrayT
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
 
@@ -1470,13 +1470,13 @@ ZTEST_CASE ( OperatorGreaterThanOrEquals_ReturnsFalseWhenIteratorSVectorArrayToD
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE_B, 0);
@@ -1498,9 +1498,9 @@ ZTEST_CASE ( OperatorLowerThanOrEquals_ReturnsTrueWhenResidentIteratorIsLowerTha
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1521,9 +1521,9 @@ ZTEST_CASE ( OperatorLowerThanOrEquals_ReturnsTrueWhenResidentIteratorEqualsInpu
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1543,9 +1543,9 @@ ZTEST_CASE ( OperatorLowerThanOrEquals_ReturnsFalseWhenResidentIteratorIsNotLowe
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE, 0);
@@ -1568,13 +1568,13 @@ ZTEST_CASE ( OperatorLowerThanOrEquals_AssertionFailsWhenIteratorSVectorArrayToD
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
 
@@ -1606,13 +1606,13 @@ ZTEST_CASE ( OperatorLowerThanOrEquals_ReturnsFalseWhenIteratorSVectorArrayToDif
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_A(10, 2);
-    HASHTABLE_A.Add("key1", 1);
-    HASHTABLE_A.Add("key2", 2);
-    HASHTABLE_A.Add("key3", 3);
+    HASHTABLE_A.Add("key-1", 1);
+    HASHTABLE_A.Add("key-2", 2);
+    HASHTABLE_A.Add("key-3", 3);
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE_B(10, 2);
-    HASHTABLE_B.Add("key1", 1);
-    HASHTABLE_B.Add("key2", 2);
-    HASHTABLE_B.Add("key3", 3);
+    HASHTABLE_B.Add("key-1", 1);
+    HASHTABLE_B.Add("key-2", 2);
+    HASHTABLE_B.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_A(&HASHTABLE_A, 0);
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR_B(&HASHTABLE_B, 0);
@@ -1635,9 +1635,9 @@ ZTEST_CASE ( IsEnd1_ReturnsTrueWhenIteratorPointsToPositionBeforeFirst_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveFirst();
@@ -1659,9 +1659,9 @@ ZTEST_CASE ( IsEnd1_ReturnsTrueWhenIteratorPointsToPositionAfterLast_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveLast();
@@ -1683,9 +1683,9 @@ ZTEST_CASE ( IsEnd1_ReturnsFalseWhenIteratorDoesNotPointToEndPosition_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveLast();
@@ -1706,9 +1706,9 @@ ZTEST_CASE ( IsEnd2_ReturnsTrueWhenIteratorPointsToPositionBeforeFirst_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveFirst();
@@ -1730,9 +1730,9 @@ ZTEST_CASE ( IsEnd2_ReturnsTrueWhenIteratorPointsToPositionAfterLast_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveLast();
@@ -1754,9 +1754,9 @@ ZTEST_CASE ( IsEnd2_ReturnsFalseWhenIteratorDoesNotPointToEndPosition_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     ITERATOR.MoveLast();
@@ -1777,9 +1777,9 @@ ZTEST_CASE ( MoveFirst_IteratorPointsToFirstPositionWhenHashtableIsNotEmpty_Test
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
     ++ORIGINAL_ITERATOR;
@@ -1802,9 +1802,9 @@ ZTEST_CASE ( MoveFirst_IteratorPointsToFirstPositionWhenHashtableIsNotEmptyAndIt
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
     --ORIGINAL_ITERATOR;
@@ -1849,9 +1849,9 @@ ZTEST_CASE ( MoveLast_IteratorPointsToLastPositionWhenHashtableIsNotEmpty_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
 
@@ -1875,9 +1875,9 @@ ZTEST_CASE ( MoveLast_IteratorPointsToLastPositionWhenHashtableIsNotEmptyAndIter
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ORIGINAL_ITERATOR(&HASHTABLE, 0);
     --ORIGINAL_ITERATOR;
@@ -1927,9 +1927,9 @@ ZTEST_CASE ( IsValid_ReturnsTrueWhenIteratorPointsToCommonPosition_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(10, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator ITERATOR(&HASHTABLE, 0);
     const bool EXPECTED_RESULT = true;
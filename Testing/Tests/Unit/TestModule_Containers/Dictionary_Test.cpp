@@ -559,6 +559,28 @@ ZTEST_CASE ( Clone_ClonedDictionaryHasSameValuesThanTheOriginalDictionaryWhenInp
     BOOST_CHECK(bResultIsWhatEspected);
 }
 
+/// <summary>
+/// Checks that the key-value pairs of both dictionaries are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap_KeyValuePairsAreExchanged_Test )
+{
+    // [Preparation]
+    Dictionary<string_z, int> dictionaryA(5);
+    dictionaryA.Add("key1", 1);
+    dictionaryA.Add("key2", 3);
+    Dictionary<string_z, int> dictionaryB(3);
+    dictionaryB.Add("key3", 5);
+    const Dictionary<string_z, int> EXPECTED_DICTIONARY_A(dictionaryB);
+    const Dictionary<string_z, int> EXPECTED_DICTIONARY_B(dictionaryA);
+
+    // [Execution]
+    dictionaryA.Swap(dictionaryB);
+
+    // [Verification]
+    BOOST_CHECK(dictionaryA == EXPECTED_DICTIONARY_A);
+    BOOST_CHECK(dictionaryB == EXPECTED_DICTIONARY_B);
+}
+
 /// <summary>
 /// Checks that the dictionary is empty when removing the only element in it.
 /// </summary>
@@ -1802,6 +1824,391 @@ ZTEST_CASE ( PositionOfKey_ReturnsEndPositionWhenDictionaryIsEmpty_Test )
     BOOST_CHECK(bIteratorIsEnd);
 }
 
+/// <summary>
+/// Checks that it returns the pair whose key equals the input key when the dictionary contains it.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsPairWithEqualKeyWhenDictionaryContainsTheKey_Test )
+{
+    // [Preparation]
+    const int EXPECTED_KEY = 4;
+    const int EXPECTED_VALUE = 40;
+    Dictionary<int, int> DICTIONARY(5);
+    DICTIONARY.Add(6, 60);
+    DICTIONARY.Add(EXPECTED_KEY, EXPECTED_VALUE);
+    DICTIONARY.Add(2, 20);
+
+    // [Execution]
+    Dictionary<int, int>::ConstDictionaryIterator itPosition = DICTIONARY.LowerBound(EXPECTED_KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(itPosition->GetKey(), EXPECTED_KEY);
+    BOOST_CHECK_EQUAL(itPosition->GetValue(), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that it returns the pair with the lowest greater key when the dictionary does not contain the input key.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsPairWithNextKeyWhenDictionaryDoesNotContainTheKey_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 3;
+    const int EXPECTED_KEY = 4;
+    Dictionary<int, int> DICTIONARY(5);
+    DICTIONARY.Add(6, 60);
+    DICTIONARY.Add(EXPECTED_KEY, 40);
+    DICTIONARY.Add(2, 20);
+
+    // [Execution]
+    Dictionary<int, int>::ConstDictionaryIterator itPosition = DICTIONARY.LowerBound(INPUT_KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(itPosition->GetKey(), EXPECTED_KEY);
+}
+
+/// <summary>
+/// Checks that it returns an iterator that points to the end position when all the keys are lower than the input key.
+/// </summary>
+ZTEST_CASE ( LowerBound_ReturnsEndPositionWhenAllKeysAreLower_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 7;
+    Dictionary<int, int> DICTIONARY(5);
+    DICTIONARY.Add(6, 60);
+    DICTIONARY.Add(4, 40);
+
+    // [Execution]
+    Dictionary<int, int>::ConstDictionaryIterator itPosition = DICTIONARY.LowerBound(INPUT_KEY);
+
+    // [Verification]
+    bool bIteratorIsEnd = itPosition.IsEnd();
+    BOOST_CHECK(bIteratorIsEnd);
+}
+
+/// <summary>
+/// Checks that it returns the pair that follows the input key when the dictionary contains it.
+/// </summary>
+ZTEST_CASE ( UpperBound_ReturnsPairWithNextKeyWhenDictionaryContainsTheKey_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 4;
+    const int EXPECTED_KEY = 6;
+    Dictionary<int, int> DICTIONARY(5);
+    DICTIONARY.Add(EXPECTED_KEY, 60);
+    DICTIONARY.Add(INPUT_KEY, 40);
+    DICTIONARY.Add(2, 20);
+
+    // [Execution]
+    Dictionary<int, int>::ConstDictionaryIterator itPosition = DICTIONARY.UpperBound(INPUT_KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(itPosition->GetKey(), EXPECTED_KEY);
+}
+
+/// <summary>
+/// Checks that it returns an iterator that points to the end position when no key is greater than the input key.
+/// </summary>
+ZTEST_CASE ( UpperBound_ReturnsEndPositionWhenNoKeyIsGreater_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 6;
+    Dictionary<int, int> DICTIONARY(5);
+    DICTIONARY.Add(6, 60);
+    DICTIONARY.Add(4, 40);
+
+    // [Execution]
+    Dictionary<int, int>::ConstDictionaryIterator itPosition = DICTIONARY.UpperBound(INPUT_KEY);
+
+    // [Verification]
+    bool bIteratorIsEnd = itPosition.IsEnd();
+    BOOST_CHECK(bIteratorIsEnd);
+}
+
+/// <summary>
+/// Checks that the returned dictionary contains the pairs whose keys are in the range, including both ends.
+/// </summary>
+ZTEST_CASE ( GetRange_ReturnsPairsWhoseKeysAreInTheRange_Test )
+{
+    // [Preparation]
+    const int INPUT_LOWER_KEY = 2;
+    const int INPUT_UPPER_KEY = 6;
+    const int EXPECTED_KEYS[] = { 2, 4, 6 };
+    const puint_z EXPECTED_COUNT = sizeof(EXPECTED_KEYS) / sizeof(int);
+    Dictionary<int, int> DICTIONARY(5);
+    DICTIONARY.Add(6, 60);
+    DICTIONARY.Add(1, 10);
+    DICTIONARY.Add(4, 40);
+    DICTIONARY.Add(8, 80);
+    DICTIONARY.Add(2, 20);
+
+    // [Execution]
+    Dictionary<int, int> range = DICTIONARY.GetRange(INPUT_LOWER_KEY, INPUT_UPPER_KEY);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(range.GetCount(), EXPECTED_COUNT);
+    Dictionary<int, int>::ConstDictionaryIterator it = range.GetFirst();
+
+    for(puint_z i = 0; i < EXPECTED_COUNT; ++i, ++it)
+    {
+        BOOST_CHECK_EQUAL(it->GetKey(), EXPECTED_KEYS[i]);
+        BOOST_CHECK_EQUAL(it->GetValue(), EXPECTED_KEYS[i] * 10);
+    }
+}
+
+/// <summary>
+/// Checks that the returned dictionary is empty when no key is in the range.
+/// </summary>
+ZTEST_CASE ( GetRange_ReturnsEmptyDictionaryWhenNoKeyIsInTheRange_Test )
+{
+    // [Preparation]
+    const int INPUT_LOWER_KEY = 5;
+    const int INPUT_UPPER_KEY = 7;
+    Dictionary<int, int> DICTIONARY(5);
+    DICTIONARY.Add(8, 80);
+    DICTIONARY.Add(4, 40);
+
+    // [Execution]
+    Dictionary<int, int> range = DICTIONARY.GetRange(INPUT_LOWER_KEY, INPUT_UPPER_KEY);
+
+    // [Verification]
+    BOOST_CHECK(range.IsEmpty());
+}
+
+/// <summary>
+/// Checks that pairs are added, found, iterated in ascending order and removed when the dictionary uses a B-tree.
+/// </summary>
+ZTEST_CASE ( TreeT_DictionaryWorksWhenUsingBTree_Test )
+{
+    // [Preparation]
+    typedef Dictionary<int, string_z, PoolAllocator, SComparatorDefault<int>, SComparatorDefault<string_z>, BTree> BTreeDictionary;
+    const puint_z NUMBER_OF_PAIRS = 1000U;
+    const int REMOVED_KEY = 500;
+    const puint_z EXPECTED_COUNT = NUMBER_OF_PAIRS - 1U;
+    BTreeDictionary dictionary;
+
+    // [Execution]
+    for(puint_z i = 0; i < NUMBER_OF_PAIRS; ++i)
+    {
+        // Keys are added in an order that is neither ascending nor descending
+        const int KEY = scast_z((i * 7U) % NUMBER_OF_PAIRS, int);
+        dictionary.Add(KEY, string_z::FromInteger(KEY));
+    }
+
+    dictionary.Remove(REMOVED_KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(dictionary.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(!dictionary.ContainsKey(REMOVED_KEY));
+    BOOST_CHECK(dictionary[REMOVED_KEY + 1] == string_z::FromInteger(REMOVED_KEY + 1));
+    BOOST_CHECK_EQUAL(dictionary.LowerBound(REMOVED_KEY)->GetKey(), REMOVED_KEY + 1);
+
+    int nPreviousKey = -1;
+    bool bKeysAreAscending = true;
+
+    for(BTreeDictionary::ConstDictionaryIterator it = dictionary.GetFirst(); !it.IsEnd(); ++it)
+    {
+        bKeysAreAscending = bKeysAreAscending && it->GetKey() > nPreviousKey;
+        nPreviousKey = it->GetKey();
+    }
+
+    BOOST_CHECK(bKeysAreAscending);
+}
+
+/// <summary>
+/// Checks that the dictionary contains all the input pairs in order.
+/// </summary>
+ZTEST_CASE ( FromSorted_DictionaryContainsAllThePairs_Test )
+{
+    // [Preparation]
+    const int INPUT_KEYS[] = { 1, 2, 4, 8, 16, 32 };
+    const int INPUT_VALUES[] = { 10, 20, 40, 80, 160, 320 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_KEYS) / sizeof(int);
+
+    // [Execution]
+    Dictionary<int, int> dictionary = Dictionary<int, int>::FromSorted(INPUT_KEYS, INPUT_VALUES, INPUT_COUNT);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(dictionary.GetCount(), INPUT_COUNT);
+    Dictionary<int, int>::ConstDictionaryIterator it = dictionary.GetFirst();
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i, ++it)
+    {
+        BOOST_CHECK_EQUAL(it->GetKey(), INPUT_KEYS[i]);
+        BOOST_CHECK_EQUAL(it->GetValue(), INPUT_VALUES[i]);
+    }
+
+    BOOST_CHECK(it.IsEnd());
+}
+
+/// <summary>
+/// Checks that the dictionary contains all the input pairs, which can be found by key, when it uses a B-tree.
+/// </summary>
+ZTEST_CASE ( FromSorted_DictionaryContainsAllThePairsWhenUsingBTree_Test )
+{
+    // [Preparation]
+    typedef Dictionary<int, string_z, PoolAllocator, SComparatorDefault<int>, SComparatorDefault<string_z>, BTree> BTreeDictionary;
+    static const puint_z INPUT_COUNT = 1000U;
+    int arInputKeys[INPUT_COUNT];
+    string_z arInputValues[INPUT_COUNT];
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+    {
+        arInputKeys[i] = scast_z(i * 3U, int);
+        arInputValues[i] = string_z::FromInteger(arInputKeys[i]);
+    }
+
+    // [Execution]
+    BTreeDictionary dictionary = BTreeDictionary::FromSorted(arInputKeys, arInputValues, INPUT_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(dictionary.GetCount(), INPUT_COUNT);
+    bool bAllPairsAreFound = true;
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+        bAllPairsAreFound = bAllPairsAreFound && dictionary.ContainsKey(arInputKeys[i]) && dictionary[arInputKeys[i]] == arInputValues[i];
+
+    BOOST_CHECK(bAllPairsAreFound);
+    BOOST_CHECK(!dictionary.ContainsKey(1));
+}
+
+/// <summary>
+/// Checks that the pairs are sorted by key and every key keeps its value.
+/// </summary>
+ZTEST_CASE ( FromUnsorted_PairsAreSortedByKey_Test )
+{
+    // [Preparation]
+    const int INPUT_KEYS[] = { 8, 3, 5, 1, 9, 2 };
+    const int INPUT_VALUES[] = { 80, 30, 50, 10, 90, 20 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_KEYS) / sizeof(int);
+    const puint_z INPUT_THREADS = 1U;
+    const int EXPECTED_KEYS[] = { 1, 2, 3, 5, 8, 9 };
+
+    // [Execution]
+    Dictionary<int, int> dictionary = Dictionary<int, int>::FromUnsorted(INPUT_KEYS, INPUT_VALUES, INPUT_COUNT, INPUT_THREADS);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(dictionary.GetCount(), INPUT_COUNT);
+    Dictionary<int, int>::ConstDictionaryIterator it = dictionary.GetFirst();
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i, ++it)
+    {
+        BOOST_CHECK_EQUAL(it->GetKey(), EXPECTED_KEYS[i]);
+        BOOST_CHECK_EQUAL(it->GetValue(), EXPECTED_KEYS[i] * 10);
+    }
+}
+
+/// <summary>
+/// Checks that the pairs are sorted by key when the keys are sorted by several threads and the number of pairs is not a multiple of the number of threads.
+/// </summary>
+ZTEST_CASE ( FromUnsorted_PairsAreSortedByKeyWhenUsingSeveralThreads_Test )
+{
+    // [Preparation]
+    static const puint_z INPUT_COUNT = 1003U;
+    const puint_z INPUT_THREADS = 4U;
+    int arInputKeys[INPUT_COUNT];
+    int arInputValues[INPUT_COUNT];
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+    {
+        // 7 and the number of pairs are coprime so all the keys are different
+        arInputKeys[i] = scast_z((i * 7U) % INPUT_COUNT, int);
+        arInputValues[i] = -arInputKeys[i];
+    }
+
+    // [Execution]
+    Dictionary<int, int> dictionary = Dictionary<int, int>::FromUnsorted(arInputKeys, arInputValues, INPUT_COUNT, INPUT_THREADS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(dictionary.GetCount(), INPUT_COUNT);
+    bool bPairsAreSorted = true;
+    int nExpectedKey = 0;
+
+    for(Dictionary<int, int>::ConstDictionaryIterator it = dictionary.GetFirst(); !it.IsEnd(); ++it, ++nExpectedKey)
+        bPairsAreSorted = bPairsAreSorted && it->GetKey() == nExpectedKey && it->GetValue() == -nExpectedKey;
+
+    BOOST_CHECK(bPairsAreSorted);
+}
+
+/// <summary>
+/// Checks that the dictionary contains the pairs of both dictionaries, in order.
+/// </summary>
+ZTEST_CASE ( MergeFrom_DictionaryContainsThePairsOfBothDictionaries_Test )
+{
+    // [Preparation]
+    const int EXPECTED_KEYS[] = { 1, 2, 3, 4, 5, 6 };
+    const puint_z EXPECTED_COUNT = sizeof(EXPECTED_KEYS) / sizeof(int);
+    Dictionary<int, int> dictionary;
+    dictionary.Add(1, 10);
+    dictionary.Add(4, 40);
+    dictionary.Add(5, 50);
+    Dictionary<int, int> INPUT_DICTIONARY;
+    INPUT_DICTIONARY.Add(6, 60);
+    INPUT_DICTIONARY.Add(2, 20);
+    INPUT_DICTIONARY.Add(3, 30);
+
+    // [Execution]
+    dictionary.MergeFrom(INPUT_DICTIONARY);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(dictionary.GetCount(), EXPECTED_COUNT);
+    Dictionary<int, int>::ConstDictionaryIterator it = dictionary.GetFirst();
+
+    for(puint_z i = 0; i < EXPECTED_COUNT; ++i, ++it)
+    {
+        BOOST_CHECK_EQUAL(it->GetKey(), EXPECTED_KEYS[i]);
+        BOOST_CHECK_EQUAL(it->GetValue(), EXPECTED_KEYS[i] * 10);
+    }
+
+    BOOST_CHECK_EQUAL(INPUT_DICTIONARY.GetCount(), 3U);
+}
+
+/// <summary>
+/// Checks that the values of the input dictionary replace the resident ones when both dictionaries contain the same key.
+/// </summary>
+ZTEST_CASE ( MergeFrom_InputValuesReplaceResidentValuesWhenKeysAreRepeated_Test )
+{
+    // [Preparation]
+    typedef Dictionary<int, string_z, PoolAllocator, SComparatorDefault<int>, SComparatorDefault<string_z>, BTree> BTreeDictionary;
+    const string_z EXPECTED_VALUE_1("A");
+    const string_z EXPECTED_VALUE_2("y");
+    const string_z EXPECTED_VALUE_3("z");
+    const puint_z EXPECTED_COUNT = 3U;
+    BTreeDictionary dictionary;
+    dictionary.Add(1, string_z("A"));
+    dictionary.Add(2, string_z("B"));
+    BTreeDictionary INPUT_DICTIONARY;
+    INPUT_DICTIONARY.Add(2, string_z("y"));
+    INPUT_DICTIONARY.Add(3, string_z("z"));
+
+    // [Execution]
+    dictionary.MergeFrom(INPUT_DICTIONARY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(dictionary.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(dictionary[1] == EXPECTED_VALUE_1);
+    BOOST_CHECK(dictionary[2] == EXPECTED_VALUE_2);
+    BOOST_CHECK(dictionary[3] == EXPECTED_VALUE_3);
+}
+
+/// <summary>
+/// Checks that nothing happens when the input dictionary is the resident dictionary.
+/// </summary>
+ZTEST_CASE ( MergeFrom_NothingHappensWhenInputIsResidentDictionary_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 2U;
+    Dictionary<int, int> dictionary;
+    dictionary.Add(1, 10);
+    dictionary.Add(2, 20);
+
+    // [Execution]
+    dictionary.MergeFrom(dictionary);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(dictionary.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(dictionary[1], 10);
+    BOOST_CHECK_EQUAL(dictionary[2], 20);
+}
+
 /// <summary>
 /// Checks that the capacity is correctly calculated.
 /// </summary>
@@ -0,0 +1,406 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/EventAsync.h"
+
+#include "ZContainers/ArrayDynamic.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include "ZTime/TimeSpan.h"
+#include <boost/atomic.hpp>
+
+
+// Class whose methods are subscribed to the events in the tests of EventAsync
+class EventAsync_TestClass
+{
+public:
+
+    static void Reset()
+    {
+        sm_bFunction8ArgumentsAreCorrect = false;
+        sm_bCalledByOtherThread = false;
+        sm_arReceivedValues.Clear();
+        sm_bHasStarted = false;
+        sm_bRelease = false;
+        sm_uCallCount = 0;
+    }
+
+    static void Function8(int p1, int p2, int p3, int p4, int p5, int p6, int p7, int p8)
+    {
+        sm_bFunction8ArgumentsAreCorrect = p1 == 1 && p2 == 2 && p3 == 3 && p4 == 4 && p5 == 5 && p6 == 6 && p7 == 7 && p8 == 8;
+    }
+
+    static void StoreThreadId()
+    {
+        sm_bCalledByOtherThread = SThisThread::GetId() != sm_raisingThreadId;
+    }
+
+    static void StoreValue(const int &p1)
+    {
+        sm_arReceivedValues.Add(p1);
+    }
+
+    // Stores the value and waits until the test releases the dispatcher thread, if it is the first value
+    static void StoreValueAndWaitForRelease(int p1)
+    {
+        sm_arReceivedValues.Add(p1);
+
+        if(sm_arReceivedValues.GetCount() == 1U)
+        {
+            sm_bHasStarted = true;
+
+            while(!sm_bRelease)
+                SThisThread::Yield();
+        }
+    }
+
+    // Waits until the dispatcher thread is processing the first value
+    static void WaitForStart()
+    {
+        while(!sm_bHasStarted)
+            SThisThread::Yield();
+    }
+
+    static void CountCall(int p1)
+    {
+        sm_uCallCount.fetch_add(1U);
+    }
+
+    static void RaiseOnce(EventAsync<void(int)>* pEvent)
+    {
+        pEvent->Raise(4);
+    }
+
+    static bool sm_bFunction8ArgumentsAreCorrect;
+    static bool sm_bCalledByOtherThread;
+    static Thread::Id sm_raisingThreadId;
+    static ArrayDynamic<int> sm_arReceivedValues;
+    static boost::atomic<bool> sm_bHasStarted;
+    static boost::atomic<bool> sm_bRelease;
+    static boost::atomic<unsigned int> sm_uCallCount;
+};
+
+bool EventAsync_TestClass::sm_bFunction8ArgumentsAreCorrect = false;
+bool EventAsync_TestClass::sm_bCalledByOtherThread = false;
+Thread::Id EventAsync_TestClass::sm_raisingThreadId;
+ArrayDynamic<int> EventAsync_TestClass::sm_arReceivedValues;
+boost::atomic<bool> EventAsync_TestClass::sm_bHasStarted(false);
+boost::atomic<bool> EventAsync_TestClass::sm_bRelease(false);
+boost::atomic<unsigned int> EventAsync_TestClass::sm_uCallCount(0);
+
+
+
+ZTEST_SUITE_BEGIN( EventAsync_TestSuite )
+
+/// <summary>
+/// Checks that subscribers are called by a thread different from the one that raises the event.
+/// </summary>
+ZTEST_CASE ( Raise_SubscribersAreCalledByDispatcherThread_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 4U;
+    EventAsync_TestClass::Reset();
+    EventAsync_TestClass::sm_raisingThreadId = SThisThread::GetId();
+    EventAsync<void()> event(QUEUE_CAPACITY);
+    event += EventAsync_TestClass::StoreThreadId;
+
+    // [Execution]
+    event.Raise();
+    event.Flush();
+
+    // [Verification]
+    BOOST_CHECK(EventAsync_TestClass::sm_bCalledByOtherThread);
+}
+
+/// <summary>
+/// Checks that arguments are correctly passed when the function has 8 parameters.
+/// </summary>
+ZTEST_CASE ( Raise_ArgumentsAreCorrectlyPassedWhenFunctionHas8Parameters_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 4U;
+    EventAsync_TestClass::Reset();
+    EventAsync<void(int, int, int, int, int, int, int, int)> event(QUEUE_CAPACITY);
+    event += EventAsync_TestClass::Function8;
+
+    // [Execution]
+    event.Raise(1, 2, 3, 4, 5, 6, 7, 8);
+    event.Flush();
+
+    // [Verification]
+    BOOST_CHECK(EventAsync_TestClass::sm_bFunction8ArgumentsAreCorrect);
+}
+
+/// <summary>
+/// Checks that the subscribers receive a copy of the arguments, which is not affected by changes made to the original instance after raising the event.
+/// </summary>
+ZTEST_CASE ( Raise_SubscribersReceiveACopyOfTheArguments_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 4U;
+    const int EXPECTED_VALUE = 1;
+    EventAsync_TestClass::Reset();
+    EventAsync<void(const int&)> event(QUEUE_CAPACITY);
+    event += EventAsync_TestClass::StoreValue;
+    int nArgument = EXPECTED_VALUE;
+
+    // [Execution]
+    event.Raise(nArgument);
+    nArgument = 2;
+    event.Flush();
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(EventAsync_TestClass::sm_arReceivedValues.GetCount(), 1U);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[0], EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that raises are dispatched in the same order they were made when there is one dispatcher thread.
+/// </summary>
+ZTEST_CASE ( Raise_RaisesAreDispatchedInFifoOrder_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 8U;
+    const int RAISE_COUNT = 100;
+    EventAsync_TestClass::Reset();
+    EventAsync<void(const int&)> event(QUEUE_CAPACITY);
+    event += EventAsync_TestClass::StoreValue;
+
+    // [Execution]
+    for(int i = 0; i < RAISE_COUNT; ++i)
+        event.Raise(i);
+
+    event.Flush();
+
+    // [Verification]
+    bool bAreInOrder = EventAsync_TestClass::sm_arReceivedValues.GetCount() == scast_z(RAISE_COUNT, puint_z);
+
+    for(int i = 0; bAreInOrder && i < RAISE_COUNT; ++i)
+        bAreInOrder = EventAsync_TestClass::sm_arReceivedValues[i] == i;
+
+    BOOST_CHECK(bAreInOrder);
+}
+
+/// <summary>
+/// Checks that the raising thread waits until there is free space when the queue is full and the policy is E_Block.
+/// </summary>
+ZTEST_CASE ( Raise_WaitsUntilThereIsFreeSpaceWhenPolicyIsBlock_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 2U;
+    const puint_z EXPECTED_CALLS = 4U;
+    EventAsync_TestClass::Reset();
+    EventAsync<void(int)> event(QUEUE_CAPACITY, EQueueFullPolicy::E_Block);
+    event += EventAsync_TestClass::StoreValueAndWaitForRelease;
+    event.Raise(1);
+    EventAsync_TestClass::WaitForStart();
+    event.Raise(2);
+    event.Raise(3);
+    Delegate<void(EventAsync<void(int)>*)> raise(&EventAsync_TestClass::RaiseOnce);
+
+    // [Execution]
+    Thread producer(raise, &event);
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    bool bIsWaiting = producer.IsAlive();
+    EventAsync_TestClass::sm_bRelease = true;
+    producer.Join();
+    event.Flush();
+
+    // [Verification]
+    BOOST_CHECK(bIsWaiting);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues.GetCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(event.GetDiscardedCount(), 0U);
+}
+
+/// <summary>
+/// Checks that the new raise is discarded when the queue is full and the policy is E_DiscardNewest.
+/// </summary>
+ZTEST_CASE ( Raise_NewestRaiseIsDiscardedWhenPolicyIsDiscardNewest_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 2U;
+    const int EXPECTED_VALUES[] = { 1, 2, 3 };
+    const puint_z EXPECTED_DISCARDED = 1U;
+    EventAsync_TestClass::Reset();
+    EventAsync<void(int)> event(QUEUE_CAPACITY, EQueueFullPolicy::E_DiscardNewest);
+    event += EventAsync_TestClass::StoreValueAndWaitForRelease;
+    event.Raise(1);
+    EventAsync_TestClass::WaitForStart();
+    event.Raise(2);
+    event.Raise(3);
+
+    // [Execution]
+    bool bWasQueued = event.Raise(4);
+    EventAsync_TestClass::sm_bRelease = true;
+    event.Flush();
+
+    // [Verification]
+    BOOST_CHECK(!bWasQueued);
+    BOOST_CHECK_EQUAL(event.GetDiscardedCount(), EXPECTED_DISCARDED);
+    BOOST_REQUIRE_EQUAL(EventAsync_TestClass::sm_arReceivedValues.GetCount(), 3U);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[0], EXPECTED_VALUES[0]);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[1], EXPECTED_VALUES[1]);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[2], EXPECTED_VALUES[2]);
+}
+
+/// <summary>
+/// Checks that the oldest pending raise is discarded when the queue is full and the policy is E_DiscardOldest.
+/// </summary>
+ZTEST_CASE ( Raise_OldestRaiseIsDiscardedWhenPolicyIsDiscardOldest_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 2U;
+    const int EXPECTED_VALUES[] = { 1, 3, 4 };
+    const puint_z EXPECTED_DISCARDED = 1U;
+    EventAsync_TestClass::Reset();
+    EventAsync<void(int)> event(QUEUE_CAPACITY, EQueueFullPolicy::E_DiscardOldest);
+    event += EventAsync_TestClass::StoreValueAndWaitForRelease;
+    event.Raise(1);
+    EventAsync_TestClass::WaitForStart();
+    event.Raise(2);
+    event.Raise(3);
+
+    // [Execution]
+    bool bWasQueued = event.Raise(4);
+    EventAsync_TestClass::sm_bRelease = true;
+    event.Flush();
+
+    // [Verification]
+    BOOST_CHECK(bWasQueued);
+    BOOST_CHECK_EQUAL(event.GetDiscardedCount(), EXPECTED_DISCARDED);
+    BOOST_REQUIRE_EQUAL(EventAsync_TestClass::sm_arReceivedValues.GetCount(), 3U);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[0], EXPECTED_VALUES[0]);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[1], EXPECTED_VALUES[1]);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[2], EXPECTED_VALUES[2]);
+}
+
+/// <summary>
+/// Checks that only the last of the pending raises is dispatched when raises are coalesced.
+/// </summary>
+ZTEST_CASE ( Raise_OnlyLastPendingRaiseIsDispatchedWhenRaisesAreCoalesced_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 4U;
+    const puint_z BATCH_SIZE = 4U;
+    const int EXPECTED_VALUES[] = { 1, 4 };
+    const puint_z EXPECTED_DISCARDED = 2U;
+    EventAsync_TestClass::Reset();
+    EventAsync<void(int)> event(QUEUE_CAPACITY, EQueueFullPolicy::E_Block, BATCH_SIZE, true);
+    event += EventAsync_TestClass::StoreValueAndWaitForRelease;
+    event.Raise(1);
+    EventAsync_TestClass::WaitForStart();
+    event.Raise(2);
+    event.Raise(3);
+    event.Raise(4);
+
+    // [Execution]
+    EventAsync_TestClass::sm_bRelease = true;
+    event.Flush();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(event.GetDiscardedCount(), EXPECTED_DISCARDED);
+    BOOST_REQUIRE_EQUAL(EventAsync_TestClass::sm_arReceivedValues.GetCount(), 2U);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[0], EXPECTED_VALUES[0]);
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues[1], EXPECTED_VALUES[1]);
+}
+
+/// <summary>
+/// Checks that all the raises are dispatched when there are several dispatcher threads.
+/// </summary>
+ZTEST_CASE ( Raise_AllRaisesAreDispatchedWhenThereAreSeveralDispatcherThreads_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 8U;
+    const puint_z BATCH_SIZE = 2U;
+    const u32_z DISPATCHER_COUNT = 3U;
+    const int RAISE_COUNT = 100;
+    EventAsync_TestClass::Reset();
+    EventAsync<void(int)> event(QUEUE_CAPACITY, EQueueFullPolicy::E_Block, BATCH_SIZE, false, DISPATCHER_COUNT);
+    event += EventAsync_TestClass::CountCall;
+
+    // [Execution]
+    for(int i = 0; i < RAISE_COUNT; ++i)
+        event.Raise(i);
+
+    event.Flush();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_uCallCount.load(), scast_z(RAISE_COUNT, unsigned int));
+    BOOST_CHECK_EQUAL(event.GetPendingCount(), 0U);
+}
+
+/// <summary>
+/// Checks that the destructor waits for the pending raises to be dispatched.
+/// </summary>
+ZTEST_CASE ( Destructor_PendingRaisesAreDispatched_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 8U;
+    const int RAISE_COUNT = 5;
+    EventAsync_TestClass::Reset();
+
+    // [Execution]
+    {
+        EventAsync<void(const int&)> event(QUEUE_CAPACITY);
+        event += EventAsync_TestClass::StoreValue;
+
+        for(int i = 0; i < RAISE_COUNT; ++i)
+            event.Raise(i);
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(EventAsync_TestClass::sm_arReceivedValues.GetCount(), scast_z(RAISE_COUNT, puint_z));
+}
+
+/// <summary>
+/// Checks that subscribers are added and removed.
+/// </summary>
+ZTEST_CASE ( OperatorAdditionAssignment_SubscriberIsAddedAndRemoved_Test )
+{
+    // [Preparation]
+    const puint_z QUEUE_CAPACITY = 4U;
+    EventAsync<void()> event(QUEUE_CAPACITY);
+
+    // [Execution]
+    event += EventAsync_TestClass::StoreThreadId;
+    bool bSubscriberIsAdded = event.GetSubscribers().GetCount() == 1U;
+    event -= EventAsync_TestClass::StoreThreadId;
+    bool bSubscriberIsRemoved = event.GetSubscribers().GetCount() == 0;
+
+    // [Verification]
+    BOOST_CHECK(bSubscriberIsAdded);
+    BOOST_CHECK(bSubscriberIsRemoved);
+}
+
+// End - Test Suite: EventAsync
+ZTEST_SUITE_END()
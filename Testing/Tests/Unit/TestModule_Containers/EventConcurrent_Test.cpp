@@ -0,0 +1,515 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/EventConcurrent.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+#include "ZThreading/Thread.h"
+#include <boost/atomic.hpp>
+
+
+// Class whose methods are subscribed to the events in the tests of EventConcurrent
+class EventConcurrent_TestClass
+{
+public:
+
+    static const unsigned int OPERATIONS_PER_THREAD = 2000U;
+
+    static void Reset()
+    {
+        sm_bFunction0Called = false;
+        sm_bFunction1ArgumentsAreCorrect = false;
+        sm_bFunction8ArgumentsAreCorrect = false;
+        sm_bSubscriberAreCalledInFIFOOrder = false;
+        sm_uCallCounter = 0;
+        sm_pEvent = null_z;
+    }
+
+    static int Function0()
+    {
+        sm_bFunction0Called = true;
+        return 0;
+    }
+    
+    static int Function1(int p1)
+    {
+        sm_bFunction1ArgumentsAreCorrect = p1 == 1;
+        return 1;
+    }
+
+    static int Function8(int p1, int p2, int p3, int p4, int p5, int p6, int p7, int p8)
+    {
+        sm_bFunction8ArgumentsAreCorrect = p1 == 1 && p2 == 2 && p3 == 3 && p4 == 4 && p5 == 5 && p6 == 6 && p7 == 7 && p8 == 8;
+        return 8;
+    }
+
+    static int FunctionD()
+    {
+        sm_bSubscriberAreCalledInFIFOOrder = sm_uCallCounter == 0;
+        ++sm_uCallCounter;
+        return 1;
+    }
+
+    static int FunctionE()
+    {
+        sm_bSubscriberAreCalledInFIFOOrder = sm_bSubscriberAreCalledInFIFOOrder && sm_uCallCounter == 1;
+        ++sm_uCallCounter;
+        return 1;
+    }
+    
+    static int FunctionF()
+    {
+        sm_bSubscriberAreCalledInFIFOOrder = sm_bSubscriberAreCalledInFIFOOrder && sm_uCallCounter == 2;
+        ++sm_uCallCounter;
+        return 1;
+    }
+
+    // Subscribes Function0 to the event being raised
+    static int SubscribeFunction0()
+    {
+        *sm_pEvent += &EventConcurrent_TestClass::Function0;
+        return 0;
+    }
+
+    // Unsubscribes itself from the event being raised
+    static int UnsubscribeItself()
+    {
+        ++sm_uCallCounter;
+        *sm_pEvent -= &EventConcurrent_TestClass::UnsubscribeItself;
+        return 0;
+    }
+
+    static void CountPermanentCall(int p1)
+    {
+        sm_uPermanentCallCounter.fetch_add(p1);
+    }
+
+    static void CountTransientCall(int p1)
+    {
+        sm_uTransientCallCounter.fetch_add(p1);
+    }
+
+    // Raises the event many times
+    static void RaiseMany(EventConcurrent<void(int)>* pEvent)
+    {
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+            pEvent->Raise(1);
+    }
+
+    // Subscribes and unsubscribes a function many times
+    static void SubscribeAndUnsubscribeMany(EventConcurrent<void(int)>* pEvent)
+    {
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            *pEvent += &EventConcurrent_TestClass::CountTransientCall;
+            *pEvent -= &EventConcurrent_TestClass::CountTransientCall;
+        }
+    }
+
+    static bool sm_bFunction0Called;
+    static bool sm_bFunction1ArgumentsAreCorrect;
+    static bool sm_bFunction8ArgumentsAreCorrect;
+    static bool sm_bSubscriberAreCalledInFIFOOrder;
+    static unsigned int sm_uCallCounter;
+    static EventConcurrent<int()>* sm_pEvent;
+    static boost::atomic<unsigned int> sm_uPermanentCallCounter;
+    static boost::atomic<unsigned int> sm_uTransientCallCounter;
+};
+
+bool EventConcurrent_TestClass::sm_bFunction0Called = false;
+bool EventConcurrent_TestClass::sm_bFunction1ArgumentsAreCorrect = false;
+bool EventConcurrent_TestClass::sm_bFunction8ArgumentsAreCorrect = false;
+bool EventConcurrent_TestClass::sm_bSubscriberAreCalledInFIFOOrder = false;
+unsigned int EventConcurrent_TestClass::sm_uCallCounter = 0;
+EventConcurrent<int()>* EventConcurrent_TestClass::sm_pEvent = null_z;
+boost::atomic<unsigned int> EventConcurrent_TestClass::sm_uPermanentCallCounter(0);
+boost::atomic<unsigned int> EventConcurrent_TestClass::sm_uTransientCallCounter(0);
+
+
+
+ZTEST_SUITE_BEGIN( EventConcurrent_TestSuite )
+
+/// <summary>
+/// Checks that a single subscriber without parameters is called.
+/// </summary>
+ZTEST_CASE ( Raise_SingleSubscriberWithoutParametersIsCalled_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    event += EventConcurrent_TestClass::Function0;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise();
+
+    // [Verification]
+    BOOST_CHECK(EventConcurrent_TestClass::sm_bFunction0Called);
+}
+
+/// <summary>
+/// Checks that arguments are correctly passed when the function has 1 parameter.
+/// </summary>
+ZTEST_CASE ( Raise_ArgumentsAreCorrectlyPassedWhenFunctionHas1Parameter_Test )
+{
+    // [Preparation]
+    EventConcurrent<int(int)> event;
+    event += EventConcurrent_TestClass::Function1;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise(1);
+
+    // [Verification]
+    BOOST_CHECK(EventConcurrent_TestClass::sm_bFunction1ArgumentsAreCorrect);
+}
+
+/// <summary>
+/// Checks that arguments are correctly passed when the function has 8 parameters.
+/// </summary>
+ZTEST_CASE ( Raise_ArgumentsAreCorrectlyPassedWhenFunctionHas8Parameters_Test )
+{
+    // [Preparation]
+    EventConcurrent<int(int, int, int, int, int, int, int, int)> event;
+    event += EventConcurrent_TestClass::Function8;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise(1, 2, 3, 4, 5, 6, 7, 8);
+
+    // [Verification]
+    BOOST_CHECK(EventConcurrent_TestClass::sm_bFunction8ArgumentsAreCorrect);
+}
+
+/// <summary>
+/// Checks that nothing happens when there are no subscribers.
+/// </summary>
+ZTEST_CASE ( Raise_NothingHappensWhenThereAreNoSubscribers_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise();
+
+    // [Verification]
+    BOOST_CHECK(!EventConcurrent_TestClass::sm_bFunction0Called);
+}
+
+/// <summary>
+/// Checks that all the subscribers are called in FIFO order.
+/// </summary>
+ZTEST_CASE ( Raise_SubscribersAreCalledInFifoOrder_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    event += EventConcurrent_TestClass::FunctionD;
+    event += EventConcurrent_TestClass::FunctionE;
+    event += EventConcurrent_TestClass::FunctionF;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    event.Raise();
+
+    // [Verification]
+    BOOST_CHECK(EventConcurrent_TestClass::sm_bSubscriberAreCalledInFIFOOrder);
+}
+
+/// <summary>
+/// Checks that a function subscribed by a subscriber while the event is being raised is not called until the next time.
+/// </summary>
+ZTEST_CASE ( Raise_FunctionSubscribedWhileRaisingIsNotCalledUntilNextTime_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    event += EventConcurrent_TestClass::SubscribeFunction0;
+    EventConcurrent_TestClass::Reset();
+    EventConcurrent_TestClass::sm_pEvent = &event;
+
+    // [Execution]
+    event.Raise();
+    bool bCalledInFirstRaise = EventConcurrent_TestClass::sm_bFunction0Called;
+    event -= EventConcurrent_TestClass::SubscribeFunction0;
+    event.Raise();
+
+    // [Verification]
+    BOOST_CHECK(!bCalledInFirstRaise);
+    BOOST_CHECK(EventConcurrent_TestClass::sm_bFunction0Called);
+}
+
+/// <summary>
+/// Checks that a subscriber can unsubscribe itself while the event is being raised.
+/// </summary>
+ZTEST_CASE ( Raise_SubscriberCanUnsubscribeItselfWhileRaising_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 1U;
+    EventConcurrent<int()> event;
+    event += EventConcurrent_TestClass::UnsubscribeItself;
+    EventConcurrent_TestClass::Reset();
+    EventConcurrent_TestClass::sm_pEvent = &event;
+
+    // [Execution]
+    event.Raise();
+    event.Raise();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(EventConcurrent_TestClass::sm_uCallCounter, EXPECTED_CALLS);
+    BOOST_CHECK(event.GetSubscribers().IsEmpty());
+}
+
+/// <summary>
+/// Checks that every raise calls the subscribers that are present during the whole operation when other threads subscribe and unsubscribe functions
+/// at the same time.
+/// </summary>
+ZTEST_CASE ( Raise_PermanentSubscribersAreAlwaysCalledWhenOtherThreadsChangeSubscribersAtTheSameTime_Test )
+{
+    // [Preparation]
+    const unsigned int THREAD_COUNT = 4U;
+    const unsigned int OPERATIONS_PER_THREAD = EventConcurrent_TestClass::OPERATIONS_PER_THREAD;
+    const unsigned int EXPECTED_PERMANENT_CALLS = THREAD_COUNT / 2U * OPERATIONS_PER_THREAD;
+    const puint_z EXPECTED_SUBSCRIBERS = 1U;
+    EventConcurrent<void(int)> event;
+    event += EventConcurrent_TestClass::CountPermanentCall;
+    EventConcurrent_TestClass::sm_uPermanentCallCounter = 0;
+    EventConcurrent_TestClass::sm_uTransientCallCounter = 0;
+    Delegate<void(EventConcurrent<void(int)>*)> raise(&EventConcurrent_TestClass::RaiseMany);
+    Delegate<void(EventConcurrent<void(int)>*)> subscribeAndUnsubscribe(&EventConcurrent_TestClass::SubscribeAndUnsubscribeMany);
+    Thread* arThreads[THREAD_COUNT];
+
+    // [Execution]
+    for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+        arThreads[i] = new Thread(i % 2U == 0 ? raise : subscribeAndUnsubscribe, &event);
+
+    for(unsigned int i = 0; i < THREAD_COUNT; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    const unsigned int PERMANENT_CALLS = EventConcurrent_TestClass::sm_uPermanentCallCounter;
+    const unsigned int TRANSIENT_CALLS = EventConcurrent_TestClass::sm_uTransientCallCounter;
+    BOOST_CHECK_EQUAL(PERMANENT_CALLS, EXPECTED_PERMANENT_CALLS);
+    BOOST_CHECK(TRANSIENT_CALLS <= EXPECTED_PERMANENT_CALLS);
+    BOOST_CHECK_EQUAL(event.GetSubscribers().GetCount(), EXPECTED_SUBSCRIBERS);
+}
+
+/// <summary>
+/// Checks that subscribers are added.
+/// </summary>
+ZTEST_CASE ( OperatorAdditionAssignment_SubscriberIsAdded_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    event += &EventConcurrent_TestClass::Function0;
+
+    // [Verification]
+    bool bSubscriberIsAdded = event.GetSubscribers().GetCount() > 0;
+    BOOST_CHECK(bSubscriberIsAdded);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input is null.
+/// </summary>
+ZTEST_CASE ( OperatorAdditionAssignment_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        event += null_z;
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when subscriber was already there.
+/// </summary>
+ZTEST_CASE ( OperatorAdditionAssignment_AssertionFailsWhenSubscriberWasAlreadySubscribed_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    EventConcurrent_TestClass::Reset();
+    event += &EventConcurrent_TestClass::Function0;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        event += &EventConcurrent_TestClass::Function0;
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that subscribers are removed.
+/// </summary>
+ZTEST_CASE ( OperatorSubstractionAssignment_SubscriberIsRemoved_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    EventConcurrent_TestClass::Reset();
+    event += &EventConcurrent_TestClass::Function0;
+
+    // [Execution]
+    event -= &EventConcurrent_TestClass::Function0;
+
+    // [Verification]
+    bool bSubscriberIsRemoved = event.GetSubscribers().GetCount() == 0;
+    BOOST_CHECK(bSubscriberIsRemoved);
+}
+
+/// <summary>
+/// Checks that only the input subscriber is removed and the order of the others is kept.
+/// </summary>
+ZTEST_CASE ( OperatorSubstractionAssignment_OnlyInputSubscriberIsRemoved_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    event += EventConcurrent_TestClass::FunctionD;
+    event += EventConcurrent_TestClass::Function0;
+    event += EventConcurrent_TestClass::FunctionE;
+    event += EventConcurrent_TestClass::FunctionF;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    event -= EventConcurrent_TestClass::Function0;
+
+    // [Verification]
+    event.Raise();
+    BOOST_CHECK(!EventConcurrent_TestClass::sm_bFunction0Called);
+    BOOST_CHECK(EventConcurrent_TestClass::sm_bSubscriberAreCalledInFIFOOrder);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input is null.
+/// </summary>
+ZTEST_CASE ( OperatorSubstractionAssignment_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        event -= null_z;
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when subscriber was not subscribed.
+/// </summary>
+ZTEST_CASE ( OperatorSubstractionAssignment_AssertionFailsWhenSubscriberWasNotSubscribed_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    EventConcurrent_TestClass::Reset();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        event -= &EventConcurrent_TestClass::Function0;
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that subscribers are removed.
+/// </summary>
+ZTEST_CASE ( UnsubscribeAll_AllSubscribersAreUnsubscribed_Test )
+{
+    // [Preparation]
+    EventConcurrent<int()> event;
+    EventConcurrent_TestClass::Reset();
+    event += &EventConcurrent_TestClass::FunctionD;
+    event += &EventConcurrent_TestClass::FunctionE;
+    event += &EventConcurrent_TestClass::FunctionF;
+
+    // [Execution]
+    event.UnsubscribeAll();
+
+    // [Verification]
+    bool bSubscriberIsRemoved = event.GetSubscribers().GetCount() == 0;
+    BOOST_CHECK(bSubscriberIsRemoved);
+}
+
+// End - Test Suite: EventConcurrent
+ZTEST_SUITE_END()
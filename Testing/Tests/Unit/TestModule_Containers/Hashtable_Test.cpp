@@ -682,12 +682,12 @@ ZTEST_CASE( SetValue_AssertionFailsWhenKeyDoesNotExist_Test )
 ZTEST_CASE ( ContainsKey_ReturnsTrueWhenHashtableContainsTheKey_Test )
 {
     // [Preparation]
-    const string_z INPUT_KEY("key3");
+    const string_z INPUT_KEY("key-3");
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 4);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 4);
     HASHTABLE.Add(INPUT_KEY, 5);
-    HASHTABLE.Add("key4", 6);
+    HASHTABLE.Add("key-4", 6);
 
     const bool EXPECTED_RESULT = true;
 
@@ -705,11 +705,11 @@ ZTEST_CASE ( ContainsKey_ReturnsFalseWhenHashtableDoesNotContainTheKey_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 4);
-    HASHTABLE.Add("key3", 5);
-    HASHTABLE.Add("key4", 6);
-    const string_z INPUT_KEY("key5");
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 4);
+    HASHTABLE.Add("key-3", 5);
+    HASHTABLE.Add("key-4", 6);
+    const string_z INPUT_KEY("key-5");
     const bool EXPECTED_RESULT = false;
 
     // [Execution]
@@ -726,7 +726,7 @@ ZTEST_CASE ( ContainsKey_ReturnsFalseWhenHashtableIsEmpty_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(3, 2);
-    const string_z INPUT_KEY("key1");
+    const string_z INPUT_KEY("key-1");
     const bool EXPECTED_RESULT = false;
 
     // [Execution]
@@ -762,7 +762,7 @@ ZTEST_CASE ( ContainsKey_ReturnsTrueWhenThereIsMoreThanOneElementInBucket_Test )
 ZTEST_CASE ( Remove_HashtableIsEmptyWhenRemovingTheOnlyElementInTheHashtable_Test )
 {
     // [Preparation]
-    const string_z EXISTING_KEY("key1");
+    const string_z EXISTING_KEY("key-1");
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(3, 2);
     HASHTABLE.Add(EXISTING_KEY, 0);
 
@@ -780,14 +780,14 @@ ZTEST_CASE ( Remove_HashtableIsEmptyWhenRemovingTheOnlyElementInTheHashtable_Tes
 ZTEST_CASE ( Remove_PairIsCorrectlyRemovedWhenThereAreManyAndKeyExists_Test )
 {
     // [Preparation]
-    const string_z EXISTING_KEY("key2");
-    const string_z EXPECTED_KEYS[] = {"key1", "key3", "key4"};
+    const string_z EXISTING_KEY("key-2");
+    const string_z EXPECTED_KEYS[] = {"key-1", "key-3", "key-4"};
     const int EXPECTED_VALUES[] = {1, 3, 4};
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
+    HASHTABLE.Add("key-1", 1);
     HASHTABLE.Add(EXISTING_KEY, 2);
-    HASHTABLE.Add("key3", 3);
-    HASHTABLE.Add("key4", 4);
+    HASHTABLE.Add("key-3", 3);
+    HASHTABLE.Add("key-4", 4);
 
     // [Execution]
     HASHTABLE.Remove(EXISTING_KEY);
@@ -851,9 +851,9 @@ ZTEST_CASE ( Remove_AssertionFailsWhenTheInputKeyDoesNotExist_Test )
     using Common::Exceptions::AssertException;
 
     // [Preparation]
-    const string_z NON_EXISTING_KEY("key2");
+    const string_z NON_EXISTING_KEY("key-2");
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(2, 2);
-    HASHTABLE.Add("key1", 1);
+    HASHTABLE.Add("key-1", 1);
 
     // [Execution]
     bool bAssertionFailed = false;
@@ -977,12 +977,12 @@ Hashtable<QHashedString, int, SStringHashProvider> hash(5, 2);
 ZTEST_CASE( GetFirst_IteratorIsObtained_Test )
 {
     // [Preparation]
-    const string_z EXPECTED_ELEMENT_KEY("key1");
+    const string_z EXPECTED_ELEMENT_KEY("key-1");
     const int EXPECTED_ELEMENT_VALUE = 1;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
     HASHTABLE.Add(EXPECTED_ELEMENT_KEY, EXPECTED_ELEMENT_VALUE);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
 
     // [Execution]
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator itFirst = HASHTABLE.GetFirst();
@@ -1014,11 +1014,11 @@ ZTEST_CASE( GetFirst_ReturnedIteratorPointsToEndWhenHashtableIsEmpty_Test )
 ZTEST_CASE( GetLast_IteratorIsObtained_Test )
 {
     // [Preparation]
-    const string_z EXPECTED_ELEMENT_KEY("key3");
+    const string_z EXPECTED_ELEMENT_KEY("key-3");
     const int EXPECTED_ELEMENT_VALUE = 3;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
     HASHTABLE.Add(EXPECTED_ELEMENT_KEY, EXPECTED_ELEMENT_VALUE);
 
     // [Execution]
@@ -1051,13 +1051,13 @@ ZTEST_CASE( GetLast_ReturnedIteratorPointsToEndWhenHashtableIsEmpty_Test )
 ZTEST_CASE ( PositionOfKey_ReturnsExpectedPositionWhenHashtableContainsTheKey_Test )
 {
     // [Preparation]
-    const string_z EXPECTED_KEY("key2");
+    const string_z EXPECTED_KEY("key-2");
     const int EXPECTED_VALUE = 4;
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
+    HASHTABLE.Add("key-1", 1);
     HASHTABLE.Add(EXPECTED_KEY, EXPECTED_VALUE);
-    HASHTABLE.Add("key3", 5);
-    HASHTABLE.Add("key4", 6);
+    HASHTABLE.Add("key-3", 5);
+    HASHTABLE.Add("key-4", 6);
 
     // [Execution]
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator itPosition = HASHTABLE.PositionOfKey(EXPECTED_KEY);
@@ -1073,12 +1073,12 @@ ZTEST_CASE ( PositionOfKey_ReturnsExpectedPositionWhenHashtableContainsTheKey_Te
 ZTEST_CASE ( PositionOfKey_ReturnsEndPositionWhenHashtableDoesNotContainTheElement_Test )
 {
     // [Preparation]
-    const string_z EXPECTED_KEY("key5");
+    const string_z EXPECTED_KEY("key-5");
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 4);
-    HASHTABLE.Add("key3", 5);
-    HASHTABLE.Add("key4", 6);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 4);
+    HASHTABLE.Add("key-3", 5);
+    HASHTABLE.Add("key-4", 6);
 
     // [Execution]
     Hashtable<string_z, int, SStringHashProvider>::ConstHashtableIterator itPosition = HASHTABLE.PositionOfKey(EXPECTED_KEY);
@@ -1094,7 +1094,7 @@ ZTEST_CASE ( PositionOfKey_ReturnsEndPositionWhenHashtableDoesNotContainTheEleme
 ZTEST_CASE ( PositionOfKey_ReturnsEndPositionWhenHashtableIsEmpty_Test )
 {
     // [Preparation]
-    const string_z EXPECTED_KEY("key1");
+    const string_z EXPECTED_KEY("key-1");
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
 
     // [Execution]
@@ -1133,11 +1133,11 @@ ZTEST_CASE( OperatorEquality_ReturnsTrueWhenHashtablesAreExactlyEqual_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE1(5, 2);
-    HASHTABLE1.Add("key1", 1);
-    HASHTABLE1.Add("key2", 2);
-    HASHTABLE1.Add("key3", 3);
-    HASHTABLE1.Add("key4", 4);
-    HASHTABLE1.Add("key5", 5);
+    HASHTABLE1.Add("key-1", 1);
+    HASHTABLE1.Add("key-2", 2);
+    HASHTABLE1.Add("key-3", 3);
+    HASHTABLE1.Add("key-4", 4);
+    HASHTABLE1.Add("key-5", 5);
 
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE2 = HASHTABLE1;
 
@@ -1157,11 +1157,11 @@ ZTEST_CASE( OperatorEquality_ReturnsTrueWhenHashtablesAreTheSameInstance_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
-    HASHTABLE.Add("key4", 4);
-    HASHTABLE.Add("key5", 5);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
+    HASHTABLE.Add("key-4", 4);
+    HASHTABLE.Add("key-5", 5);
 
     const bool EXPECTED_RESULT = true;
 
@@ -1179,18 +1179,18 @@ ZTEST_CASE( OperatorEquality_AdditionOrderDoesNotMatter_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE1(5, 2);
-    HASHTABLE1.Add("key1", 1);
-    HASHTABLE1.Add("key2", 2);
-    HASHTABLE1.Add("key3", 3);
-    HASHTABLE1.Add("key4", 4);
-    HASHTABLE1.Add("key5", 5);
+    HASHTABLE1.Add("key-1", 1);
+    HASHTABLE1.Add("key-2", 2);
+    HASHTABLE1.Add("key-3", 3);
+    HASHTABLE1.Add("key-4", 4);
+    HASHTABLE1.Add("key-5", 5);
 
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE2(5, 2);
-    HASHTABLE2.Add("key3", 3);
-    HASHTABLE2.Add("key2", 2);
-    HASHTABLE2.Add("key4", 4);
-    HASHTABLE2.Add("key1", 1);
-    HASHTABLE2.Add("key5", 5);
+    HASHTABLE2.Add("key-3", 3);
+    HASHTABLE2.Add("key-2", 2);
+    HASHTABLE2.Add("key-4", 4);
+    HASHTABLE2.Add("key-1", 1);
+    HASHTABLE2.Add("key-5", 5);
 
     const bool EXPECTED_RESULT = true;
 
@@ -1226,17 +1226,17 @@ ZTEST_CASE( OperatorEquality_ReturnsFalseWhenHashtablesHaveDifferentNumberOfElem
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE1(5, 2);
-    HASHTABLE1.Add("key1", 1);
-    HASHTABLE1.Add("key2", 2);
-    HASHTABLE1.Add("key3", 3);
-    HASHTABLE1.Add("key4", 4);
-    HASHTABLE1.Add("key5", 5);
+    HASHTABLE1.Add("key-1", 1);
+    HASHTABLE1.Add("key-2", 2);
+    HASHTABLE1.Add("key-3", 3);
+    HASHTABLE1.Add("key-4", 4);
+    HASHTABLE1.Add("key-5", 5);
 
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE2(4, 2);
-    HASHTABLE2.Add("key1", 1);
-    HASHTABLE2.Add("key2", 2);
-    HASHTABLE2.Add("key3", 3);
-    HASHTABLE2.Add("key4", 4);
+    HASHTABLE2.Add("key-1", 1);
+    HASHTABLE2.Add("key-2", 2);
+    HASHTABLE2.Add("key-3", 3);
+    HASHTABLE2.Add("key-4", 4);
 
     const bool EXPECTED_RESULT = false;
 
@@ -1254,18 +1254,18 @@ ZTEST_CASE( OperatorEquality_ReturnsFalseWhenHashtablesHaveSameNumberOfElementsW
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE1(5, 2);
-    HASHTABLE1.Add("key1", 1);
+    HASHTABLE1.Add("key-1", 1);
     HASHTABLE1.Add("key2x", 2);
-    HASHTABLE1.Add("key3", 3);
-    HASHTABLE1.Add("key4", 4);
-    HASHTABLE1.Add("key5", 50);
+    HASHTABLE1.Add("key-3", 3);
+    HASHTABLE1.Add("key-4", 4);
+    HASHTABLE1.Add("key-5", 50);
 
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE2(5, 2);
-    HASHTABLE2.Add("key1", 1);
-    HASHTABLE2.Add("key2", 90);
+    HASHTABLE2.Add("key-1", 1);
+    HASHTABLE2.Add("key-2", 90);
     HASHTABLE2.Add("key3x", 3);
-    HASHTABLE2.Add("key4", 4);
-    HASHTABLE2.Add("key5", 5);
+    HASHTABLE2.Add("key-4", 4);
+    HASHTABLE2.Add("key-5", 5);
 
     const bool EXPECTED_RESULT = false;
 
@@ -1283,11 +1283,11 @@ ZTEST_CASE( OperatorInequality_ReturnsFalseWhenHashtablesAreExactlyEqual_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE1(5, 2);
-    HASHTABLE1.Add("key1", 1);
-    HASHTABLE1.Add("key2", 2);
-    HASHTABLE1.Add("key3", 3);
-    HASHTABLE1.Add("key4", 4);
-    HASHTABLE1.Add("key5", 5);
+    HASHTABLE1.Add("key-1", 1);
+    HASHTABLE1.Add("key-2", 2);
+    HASHTABLE1.Add("key-3", 3);
+    HASHTABLE1.Add("key-4", 4);
+    HASHTABLE1.Add("key-5", 5);
 
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE2 = HASHTABLE1;
 
@@ -1307,11 +1307,11 @@ ZTEST_CASE( OperatorInequality_ReturnsFalseWhenHashtablesAreTheSameInstance_Test
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 2);
-    HASHTABLE.Add("key3", 3);
-    HASHTABLE.Add("key4", 4);
-    HASHTABLE.Add("key5", 5);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 2);
+    HASHTABLE.Add("key-3", 3);
+    HASHTABLE.Add("key-4", 4);
+    HASHTABLE.Add("key-5", 5);
 
     const bool EXPECTED_RESULT = false;
 
@@ -1329,18 +1329,18 @@ ZTEST_CASE( OperatorInequality_AdditionOrderDoesNotMatter_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE1(5, 2);
-    HASHTABLE1.Add("key1", 1);
-    HASHTABLE1.Add("key2", 2);
-    HASHTABLE1.Add("key3", 3);
-    HASHTABLE1.Add("key4", 4);
-    HASHTABLE1.Add("key5", 5);
+    HASHTABLE1.Add("key-1", 1);
+    HASHTABLE1.Add("key-2", 2);
+    HASHTABLE1.Add("key-3", 3);
+    HASHTABLE1.Add("key-4", 4);
+    HASHTABLE1.Add("key-5", 5);
 
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE2(5, 2);
-    HASHTABLE2.Add("key3", 3);
-    HASHTABLE2.Add("key2", 2);
-    HASHTABLE2.Add("key4", 4);
-    HASHTABLE2.Add("key1", 1);
-    HASHTABLE2.Add("key5", 5);
+    HASHTABLE2.Add("key-3", 3);
+    HASHTABLE2.Add("key-2", 2);
+    HASHTABLE2.Add("key-4", 4);
+    HASHTABLE2.Add("key-1", 1);
+    HASHTABLE2.Add("key-5", 5);
 
     const bool EXPECTED_RESULT = false;
 
@@ -1376,17 +1376,17 @@ ZTEST_CASE( OperatorInequality_ReturnsTrueWhenHashtablesHaveDifferentNumberOfEle
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE1(5, 2);
-    HASHTABLE1.Add("key1", 1);
-    HASHTABLE1.Add("key2", 2);
-    HASHTABLE1.Add("key3", 3);
-    HASHTABLE1.Add("key4", 4);
-    HASHTABLE1.Add("key5", 5);
+    HASHTABLE1.Add("key-1", 1);
+    HASHTABLE1.Add("key-2", 2);
+    HASHTABLE1.Add("key-3", 3);
+    HASHTABLE1.Add("key-4", 4);
+    HASHTABLE1.Add("key-5", 5);
 
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE2(4, 2);
-    HASHTABLE2.Add("key1", 1);
-    HASHTABLE2.Add("key2", 2);
-    HASHTABLE2.Add("key3", 3);
-    HASHTABLE2.Add("key4", 4);
+    HASHTABLE2.Add("key-1", 1);
+    HASHTABLE2.Add("key-2", 2);
+    HASHTABLE2.Add("key-3", 3);
+    HASHTABLE2.Add("key-4", 4);
 
     const bool EXPECTED_RESULT = true;
 
@@ -1404,18 +1404,18 @@ ZTEST_CASE( OperatorInequality_ReturnsTrueWhenHashtablesHaveSameNumberOfElements
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE1(5, 2);
-    HASHTABLE1.Add("key1", 1);
+    HASHTABLE1.Add("key-1", 1);
     HASHTABLE1.Add("key2x", 2);
-    HASHTABLE1.Add("key3", 3);
-    HASHTABLE1.Add("key4", 4);
-    HASHTABLE1.Add("key5", 50);
+    HASHTABLE1.Add("key-3", 3);
+    HASHTABLE1.Add("key-4", 4);
+    HASHTABLE1.Add("key-5", 50);
 
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE2(5, 2);
-    HASHTABLE2.Add("key1", 1);
-    HASHTABLE2.Add("key2", 90);
+    HASHTABLE2.Add("key-1", 1);
+    HASHTABLE2.Add("key-2", 90);
     HASHTABLE2.Add("key3x", 3);
-    HASHTABLE2.Add("key4", 4);
-    HASHTABLE2.Add("key5", 5);
+    HASHTABLE2.Add("key-4", 4);
+    HASHTABLE2.Add("key-5", 5);
 
     const bool EXPECTED_RESULT = true;
 
@@ -1433,11 +1433,11 @@ ZTEST_CASE ( OperatorAssignment_HashtableIsCorrectlyCopiedWhenItHasElementsAndDe
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 3);
-    HASHTABLE.Add("key3", 5);
-    HASHTABLE.Add("key4", 6);
-    HASHTABLE.Add("key5", 8);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 3);
+    HASHTABLE.Add("key-3", 5);
+    HASHTABLE.Add("key-4", 6);
+    HASHTABLE.Add("key-5", 8);
 
     const puint_z EXPECTED_COUNT = HASHTABLE.GetCount();
     Hashtable<string_z, int, SStringHashProvider> copiedHashtable(8, 2);
@@ -1460,17 +1460,17 @@ ZTEST_CASE ( OperatorAssignment_HashtableIsCorrectlyCopiedWhenThereAreMoreElemen
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 3);
-    HASHTABLE.Add("key3", 5);
-    HASHTABLE.Add("key4", 6);
-    HASHTABLE.Add("key5", 8);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 3);
+    HASHTABLE.Add("key-3", 5);
+    HASHTABLE.Add("key-4", 6);
+    HASHTABLE.Add("key-5", 8);
     const puint_z EXPECTED_COUNT = HASHTABLE.GetCount();
 
     Hashtable<string_z, int, SStringHashProvider> copiedHashtable(3, 2);
-    copiedHashtable.Add("key5", 10);
-    copiedHashtable.Add("key6", 11);
-    copiedHashtable.Add("key7", 12);
+    copiedHashtable.Add("key-5", 10);
+    copiedHashtable.Add("key-6", 11);
+    copiedHashtable.Add("key-7", 12);
 
     // [Execution]
     copiedHashtable = HASHTABLE;
@@ -1490,14 +1490,14 @@ ZTEST_CASE ( OperatorAssignment_HashtableIsCorrectlyCopiedWhenThereAreLessElemen
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 3);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 3);
     const puint_z EXPECTED_COUNT = HASHTABLE.GetCount();
 
     Hashtable<string_z, int, SStringHashProvider> copiedHashtable(3, 2);
-    copiedHashtable.Add("key5", 10);
-    copiedHashtable.Add("key6", 11);
-    copiedHashtable.Add("key7", 12);
+    copiedHashtable.Add("key-5", 10);
+    copiedHashtable.Add("key-6", 11);
+    copiedHashtable.Add("key-7", 12);
 
     // [Execution]
     copiedHashtable = HASHTABLE;
@@ -1517,15 +1517,15 @@ ZTEST_CASE ( OperatorAssignment_HashtableIsCorrectlyCopiedWhenThereAreSameNumber
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(5, 2);
-    HASHTABLE.Add("key1", 1);
-    HASHTABLE.Add("key2", 3);
-    HASHTABLE.Add("key3", 5);
+    HASHTABLE.Add("key-1", 1);
+    HASHTABLE.Add("key-2", 3);
+    HASHTABLE.Add("key-3", 5);
     const puint_z EXPECTED_COUNT = HASHTABLE.GetCount();
 
     Hashtable<string_z, int, SStringHashProvider> copiedHashtable(3, 2);
-    copiedHashtable.Add("key5", 10);
-    copiedHashtable.Add("key6", 11);
-    copiedHashtable.Add("key7", 12);
+    copiedHashtable.Add("key-5", 10);
+    copiedHashtable.Add("key-6", 11);
+    copiedHashtable.Add("key-7", 12);
 
     // [Execution]
     copiedHashtable = HASHTABLE;
@@ -1546,9 +1546,9 @@ ZTEST_CASE ( OperatorAssignment_HashtableIsCorrectlyCopiedWhenItIsEmptyAndDestin
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> HASHTABLE(3, 2);
     Hashtable<string_z, int, SStringHashProvider> copiedHashtable(3, 2);
-    copiedHashtable.Add("key5", 10);
-    copiedHashtable.Add("key6", 11);
-    copiedHashtable.Add("key7", 12);
+    copiedHashtable.Add("key-5", 10);
+    copiedHashtable.Add("key-6", 11);
+    copiedHashtable.Add("key-7", 12);
 
     // [Execution]
     copiedHashtable = HASHTABLE;
@@ -1621,9 +1621,9 @@ ZTEST_CASE ( Clone_ClonedHashtableHasSameValuesThanTheOriginalHashtable_Test )
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> sourceHashtable(5, 2);
-    sourceHashtable.Add("key1", 1);
-    sourceHashtable.Add("key2", 3);
-    sourceHashtable.Add("key3", 5);
+    sourceHashtable.Add("key-1", 1);
+    sourceHashtable.Add("key-2", 3);
+    sourceHashtable.Add("key-3", 5);
 
     Hashtable<string_z, int, SStringHashProvider> destinationHashtable(3, 2);
 
@@ -1641,16 +1641,16 @@ ZTEST_CASE ( Clone_ClonedHashtableHasSameValuesThanTheOriginalHashtableWhenInput
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> sourceHashtable(3, 2);
-    sourceHashtable.Add("key1", 1);
-    sourceHashtable.Add("key2", 2);
-    sourceHashtable.Add("key3", 3);
+    sourceHashtable.Add("key-1", 1);
+    sourceHashtable.Add("key-2", 2);
+    sourceHashtable.Add("key-3", 3);
 
     Hashtable<string_z, int, SStringHashProvider> destinationHashtable(5, 2);
-    destinationHashtable.Add("key4", 4);
-    destinationHashtable.Add("key5", 5);
-    destinationHashtable.Add("key6", 6);
-    destinationHashtable.Add("key7", 7);
-    destinationHashtable.Add("key8", 8);
+    destinationHashtable.Add("key-4", 4);
+    destinationHashtable.Add("key-5", 5);
+    destinationHashtable.Add("key-6", 6);
+    destinationHashtable.Add("key-7", 7);
+    destinationHashtable.Add("key-8", 8);
 
     // [Execution]
     sourceHashtable.Clone(destinationHashtable);
@@ -1666,16 +1666,16 @@ ZTEST_CASE ( Clone_ClonedHashtableHasSameValuesThanTheOriginalHashtableWhenInput
 {
     // [Preparation]
     Hashtable<string_z, int, SStringHashProvider> sourceHashtable(5, 2);
-    sourceHashtable.Add("key1", 1);
-    sourceHashtable.Add("key2", 2);
-    sourceHashtable.Add("key3", 3);
-    sourceHashtable.Add("key4", 4);
-    sourceHashtable.Add("key5", 5);
+    sourceHashtable.Add("key-1", 1);
+    sourceHashtable.Add("key-2", 2);
+    sourceHashtable.Add("key-3", 3);
+    sourceHashtable.Add("key-4", 4);
+    sourceHashtable.Add("key-5", 5);
 
     Hashtable<string_z, int, SStringHashProvider> destinationHashtable(3, 2);
-    destinationHashtable.Add("key6", 6);
-    destinationHashtable.Add("key7", 7);
-    destinationHashtable.Add("key8", 8);
+    destinationHashtable.Add("key-6", 6);
+    destinationHashtable.Add("key-7", 7);
+    destinationHashtable.Add("key-8", 8);
 
     // [Execution]
     sourceHashtable.Clone(destinationHashtable);
@@ -1684,6 +1684,28 @@ ZTEST_CASE ( Clone_ClonedHashtableHasSameValuesThanTheOriginalHashtableWhenInput
     BOOST_CHECK(sourceHashtable == destinationHashtable);
 }
 
+/// <summary>
+/// Checks that the key-value pairs of both hashtables are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap_KeyValuePairsAreExchanged_Test )
+{
+    // [Preparation]
+    Hashtable<string_z, int, SStringHashProvider> hashtableA(5, 2);
+    hashtableA.Add("key-1", 1);
+    hashtableA.Add("key-2", 3);
+    Hashtable<string_z, int, SStringHashProvider> hashtableB(3, 2);
+    hashtableB.Add("key-3", 5);
+    const Hashtable<string_z, int, SStringHashProvider> EXPECTED_HASHTABLE_A(hashtableB);
+    const Hashtable<string_z, int, SStringHashProvider> EXPECTED_HASHTABLE_B(hashtableA);
+
+    // [Execution]
+    hashtableA.Swap(hashtableB);
+
+    // [Verification]
+    BOOST_CHECK(hashtableA == EXPECTED_HASHTABLE_A);
+    BOOST_CHECK(hashtableB == EXPECTED_HASHTABLE_B);
+}
+
 /// <summary>
 /// Checks if the result contains all existing keys.
 /// </summary>
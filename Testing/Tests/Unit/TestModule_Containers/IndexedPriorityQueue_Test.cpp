@@ -0,0 +1,440 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/IndexedPriorityQueue.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( IndexedPriorityQueue_TestSuite )
+
+/// <summary>
+/// Checks that the queue is empty after default construction.
+/// </summary>
+ZTEST_CASE ( Constructor1_QueueIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 0;
+
+    // [Execution]
+    IndexedPriorityQueue<int> queue;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that memory is reserved for the input number of elements.
+/// </summary>
+ZTEST_CASE ( Constructor2_CapacityIsReserved_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 8U;
+
+    // [Execution]
+    IndexedPriorityQueue<int> queue(INPUT_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK(queue.GetCapacity() >= INPUT_CAPACITY);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that a default handle does not identify any element.
+/// </summary>
+ZTEST_CASE ( HandleConstructor_DefaultHandleDoesNotIdentifyAnyElement_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    queue.Push(1);
+
+    // [Execution]
+    IndexedPriorityQueue<int>::Handle handle;
+
+    // [Verification]
+    BOOST_CHECK(!queue.Contains(handle));
+}
+
+/// <summary>
+/// Checks that the returned handles identify the added elements after the heap is rearranged.
+/// </summary>
+ZTEST_CASE ( Push_HandlesIdentifyTheElements_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    const int INPUT_ELEMENTS[] = { 5, 8, 3, 4, 1, 7 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    IndexedPriorityQueue<int>::Handle arHandles[INPUT_COUNT];
+    const int EXPECTED_TOP = 1;
+
+    // [Execution]
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+        arHandles[i] = queue.Push(INPUT_ELEMENTS[i]);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_TOP);
+    BOOST_CHECK(queue.GetTopHandle() == arHandles[4]);
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+        BOOST_CHECK_EQUAL(queue.GetValue(arHandles[i]), INPUT_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the returned handles identify the elements when the whole heap is rearranged.
+/// </summary>
+ZTEST_CASE ( PushRange_HandlesIdentifyTheElementsWhenRangeIsLargerThanQueue_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    IndexedPriorityQueue<int>::Handle existingHandle = queue.Push(4);
+    const int INPUT_ELEMENTS[] = { 7, 3, 9, 1, 8, 2, 6, 0, 5 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    IndexedPriorityQueue<int>::Handle arHandles[INPUT_COUNT];
+    const int EXISTING_ELEMENT = 4;
+
+    // [Execution]
+    queue.PushRange(INPUT_ELEMENTS, INPUT_COUNT, arHandles);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetValue(existingHandle), EXISTING_ELEMENT);
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+        BOOST_CHECK_EQUAL(queue.GetValue(arHandles[i]), INPUT_ELEMENTS[i]);
+
+    for(int i = 0; i < scast_z(INPUT_COUNT + 1U, int); ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), i);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that elements are extracted in order when fewer elements than the existing ones are added, and handles are not requested.
+/// </summary>
+ZTEST_CASE ( PushRange_ElementsAreExtractedInOrderWhenRangeIsSmallerThanQueue_Test )
+{
+    // [Preparation]
+    const int EXISTING_ELEMENTS[] = { 1, 3, 5, 7, 9 };
+    IndexedPriorityQueue<int> queue;
+    queue.PushRange(EXISTING_ELEMENTS, sizeof(EXISTING_ELEMENTS) / sizeof(int), null_z);
+    const int INPUT_ELEMENTS[] = { 6, 0, 2 };
+    const int EXPECTED_ELEMENTS[] = { 0, 1, 2, 3, 5, 6, 7, 9 };
+    const puint_z EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(int);
+
+    // [Execution]
+    queue.PushRange(INPUT_ELEMENTS, sizeof(INPUT_ELEMENTS) / sizeof(int), null_z);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+
+    for(puint_z i = 0; i < EXPECTED_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_ELEMENTS[i]);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that the handle of the extracted element becomes invalid while the others remain valid.
+/// </summary>
+ZTEST_CASE ( Pop_OnlyTheHandleOfTheTopElementBecomesInvalid_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    IndexedPriorityQueue<int>::Handle handle1 = queue.Push(4);
+    IndexedPriorityQueue<int>::Handle handle2 = queue.Push(2);
+    IndexedPriorityQueue<int>::Handle handle3 = queue.Push(6);
+    const int EXPECTED_TOP = 4;
+
+    // [Execution]
+    queue.Pop();
+
+    // [Verification]
+    BOOST_CHECK(queue.Contains(handle1));
+    BOOST_CHECK(!queue.Contains(handle2));
+    BOOST_CHECK(queue.Contains(handle3));
+    BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_TOP);
+    BOOST_CHECK(queue.GetTopHandle() == handle1);
+}
+
+/// <summary>
+/// Checks that an element whose priority increases is moved to the top.
+/// </summary>
+ZTEST_CASE ( Update_ElementMovesUpWhenItDecreases_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    queue.Push(3);
+    queue.Push(5);
+    IndexedPriorityQueue<int>::Handle handle = queue.Push(9);
+    queue.Push(7);
+    const int NEW_VALUE = 1;
+
+    // [Execution]
+    queue.Update(handle, NEW_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetTop(), NEW_VALUE);
+    BOOST_CHECK(queue.GetTopHandle() == handle);
+    BOOST_CHECK_EQUAL(queue.GetValue(handle), NEW_VALUE);
+}
+
+/// <summary>
+/// Checks that an element whose priority decreases is moved away from the top.
+/// </summary>
+ZTEST_CASE ( Update_ElementMovesDownWhenItIncreases_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    IndexedPriorityQueue<int>::Handle handle = queue.Push(1);
+    queue.Push(5);
+    queue.Push(3);
+    queue.Push(7);
+    const int NEW_VALUE = 6;
+    const int EXPECTED_ELEMENTS[] = { 3, 5, 6, 7 };
+
+    // [Execution]
+    queue.Update(handle, NEW_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetValue(handle), NEW_VALUE);
+
+    for(puint_z i = 0; i < sizeof(EXPECTED_ELEMENTS) / sizeof(int); ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_ELEMENTS[i]);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that only the removed element stops being extracted and its handle becomes invalid.
+/// </summary>
+ZTEST_CASE ( Remove_OnlyTheRemovedElementDisappears_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    const int INPUT_ELEMENTS[] = { 5, 8, 3, 4, 1, 7, 2 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    IndexedPriorityQueue<int>::Handle arHandles[INPUT_COUNT];
+    queue.PushRange(INPUT_ELEMENTS, INPUT_COUNT, arHandles);
+    const int EXPECTED_ELEMENTS[] = { 1, 2, 3, 5, 7, 8 };
+    const puint_z EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(int);
+
+    // [Execution]
+    queue.Remove(arHandles[3]);
+
+    // [Verification]
+    BOOST_CHECK(!queue.Contains(arHandles[3]));
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+    {
+        if(i != 3U)
+            BOOST_CHECK_EQUAL(queue.GetValue(arHandles[i]), INPUT_ELEMENTS[i]);
+    }
+
+    for(puint_z i = 0; i < EXPECTED_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_ELEMENTS[i]);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that a free slot is reused and the handle of the removed element does not identify the new one.
+/// </summary>
+ZTEST_CASE ( Push_FreeSlotIsReusedWithDifferentGeneration_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    IndexedPriorityQueue<int>::Handle removedHandle = queue.Push(1);
+    queue.Remove(removedHandle);
+
+    // [Execution]
+    IndexedPriorityQueue<int>::Handle newHandle = queue.Push(2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(newHandle.GetSlot(), removedHandle.GetSlot());
+    BOOST_CHECK(newHandle != removedHandle);
+    BOOST_CHECK(!queue.Contains(removedHandle));
+    BOOST_CHECK(queue.Contains(newHandle));
+}
+
+/// <summary>
+/// Checks that a handle to a free slot is not valid, even if its generation matches the current generation of the slot.
+/// </summary>
+ZTEST_CASE ( Contains_ReturnsFalseWhenSlotIsFree_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    queue.Push(1);
+    IndexedPriorityQueue<int>::Handle removedHandle = queue.Push(2);
+    queue.Remove(removedHandle);
+    IndexedPriorityQueue<int>::Handle handleToFreeSlot(removedHandle.GetSlot(), removedHandle.GetGeneration() + 1U);
+
+    // [Execution]
+    bool bContains = queue.Contains(handleToFreeSlot);
+
+    // [Verification]
+    BOOST_CHECK(!bContains);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the element was already removed.
+/// </summary>
+ZTEST_CASE ( Remove_AssertionFailsWhenHandleIsNotValid_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    IndexedPriorityQueue<int>::Handle handle = queue.Push(1);
+    queue.Remove(handle);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.Remove(handle);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when updating the element of an invalid handle.
+/// </summary>
+ZTEST_CASE ( Update_AssertionFailsWhenHandleIsNotValid_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    IndexedPriorityQueue<int>::Handle handle = queue.Push(1);
+    queue.Pop();
+    queue.Push(2);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.Update(handle, 0);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the queue is empty.
+/// </summary>
+ZTEST_CASE ( Pop_AssertionFailsWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.Pop();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that all the handles become invalid.
+/// </summary>
+ZTEST_CASE ( Clear_HandlesBecomeInvalid_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue;
+    IndexedPriorityQueue<int>::Handle handle1 = queue.Push(1);
+    IndexedPriorityQueue<int>::Handle handle2 = queue.Push(2);
+
+    // [Execution]
+    queue.Clear();
+
+    // [Verification]
+    BOOST_CHECK(queue.IsEmpty());
+    BOOST_CHECK(!queue.Contains(handle1));
+    BOOST_CHECK(!queue.Contains(handle2));
+}
+
+/// <summary>
+/// Checks that handles identify the same elements, which belong to the other queue.
+/// </summary>
+ZTEST_CASE ( Swap_HandlesIdentifyTheSameElementsInTheOtherQueue_Test )
+{
+    // [Preparation]
+    IndexedPriorityQueue<int> queue1;
+    IndexedPriorityQueue<int> queue2;
+    IndexedPriorityQueue<int>::Handle handle1 = queue1.Push(1);
+    queue1.Push(3);
+    IndexedPriorityQueue<int>::Handle handle2 = queue2.Push(2);
+    const int EXPECTED_ELEMENT1 = 1;
+    const int EXPECTED_ELEMENT2 = 2;
+
+    // [Execution]
+    queue1.Swap(queue2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue2.GetValue(handle1), EXPECTED_ELEMENT1);
+    BOOST_CHECK_EQUAL(queue1.GetValue(handle2), EXPECTED_ELEMENT2);
+    BOOST_CHECK_EQUAL(queue1.GetCount(), 1U);
+    BOOST_CHECK_EQUAL(queue2.GetCount(), 2U);
+}
+
+// End - Test Suite: IndexedPriorityQueue
+ZTEST_SUITE_END()
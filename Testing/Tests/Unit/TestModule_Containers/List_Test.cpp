@@ -1497,6 +1497,48 @@ ZTEST_CASE ( Add_CopyConstructorIsCalledForAddedElements_Test )
     BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
 }
 
+/// <summary>
+/// Checks that the element is constructed at the end of the list using its default constructor, without copies.
+/// </summary>
+ZTEST_CASE ( Emplace1_ElementIsDefaultConstructedAtTheEndWithoutCopies_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 2U;
+    const unsigned int EXPECTED_CONSTRUCTOR_CALLS = 1U;
+    const unsigned int EXPECTED_COPY_CONSTRUCTOR_CALLS = 0;
+    List<CallCounter> commonList(3U);
+    commonList.Add(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    commonList.Emplace();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(commonList.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(CallCounter::GetConstructorCallsCount(), EXPECTED_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_COPY_CONSTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that the element is constructed at the end of the list from the input argument, even when the list is full.
+/// </summary>
+ZTEST_CASE ( Emplace2_ElementIsConstructedFromArgumentAtTheEnd_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_FIRST_ELEMENT("First");
+    const string_z EXPECTED_LAST_ELEMENT("Last");
+    List<string_z> commonList(1U);
+    commonList.Add(EXPECTED_FIRST_ELEMENT);
+
+    // [Execution]
+    commonList.Emplace("Last");
+
+    // [Verification]
+    BOOST_CHECK(commonList[0] == EXPECTED_FIRST_ELEMENT);
+    BOOST_CHECK(commonList[1] == EXPECTED_LAST_ELEMENT);
+    BOOST_CHECK(*commonList.GetLast() == EXPECTED_LAST_ELEMENT);
+}
+
 /// <summary>
 /// Checks that elements can be inserted at the first position.
 /// </summary>
@@ -3055,6 +3097,61 @@ ZTEST_CASE( Swap2_NothingHappensWhenSwappingTheSameElement_Test )
 
 #endif
 
+/// <sumary>
+/// Checks that the elements and the capacity of both lists are exchanged.
+/// </sumary>
+ZTEST_CASE( Swap3_ElementsAndCapacityAreExchanged_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY_A = 4U;
+    const puint_z CAPACITY_B = 8U;
+    List<string_z> listA(CAPACITY_A);
+    listA.Add("A0");
+    listA.Add("A1");
+    List<string_z> listB(CAPACITY_B);
+    listB.Add("B0");
+    const puint_z EXPECTED_COUNT_A = 1U;
+    const puint_z EXPECTED_COUNT_B = 2U;
+
+    // [Execution]
+    listA.Swap(listB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(listA.GetCount(), EXPECTED_COUNT_A);
+    BOOST_CHECK_EQUAL(listB.GetCount(), EXPECTED_COUNT_B);
+    BOOST_CHECK_EQUAL(listA.GetCapacity(), CAPACITY_B);
+    BOOST_CHECK_EQUAL(listB.GetCapacity(), CAPACITY_A);
+    BOOST_CHECK(listA[0] == string_z("B0"));
+    BOOST_CHECK(listB[0] == string_z("A0"));
+    BOOST_CHECK(listB[1] == string_z("A1"));
+}
+
+/// <sumary>
+/// Checks that both lists can be modified after exchanging their elements.
+/// </sumary>
+ZTEST_CASE( Swap3_ListsCanBeModifiedAfterSwapping_Test )
+{
+    // [Preparation]
+    u32_z arValues[] = {0, 1U, 2U};
+    List<u32_z> listA(arValues, sizeof(arValues) / sizeof(u32_z));
+    List<u32_z> listB;
+    const puint_z EXPECTED_COUNT_A = 1U;
+    const puint_z EXPECTED_COUNT_B = 5U;
+
+    // [Execution]
+    listA.Swap(listB);
+
+    // [Verification]
+    listA.Add(5U);
+    listB.Insert(4U, 0);
+    listB.Add(6U);
+    BOOST_CHECK_EQUAL(listA.GetCount(), EXPECTED_COUNT_A);
+    BOOST_CHECK_EQUAL(listB.GetCount(), EXPECTED_COUNT_B);
+    BOOST_CHECK_EQUAL(listA[0], 5U);
+    BOOST_CHECK_EQUAL(listB[0], 4U);
+    BOOST_CHECK_EQUAL(listB[4], 6U);
+}
+
 /// <sumary>
 /// Checks that it returns True when the element appears the first.
 /// </sumary>
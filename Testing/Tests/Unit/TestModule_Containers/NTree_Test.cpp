@@ -3599,6 +3599,73 @@ ZTEST_CASE( Swap_NothingHappensWhenSwappingTheSameElement_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the elements and the capacity of both trees are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap2_ElementsAndCapacityAreExchanged_Test )
+{
+    // [Preparation]
+    const puint_z MAXIMUM_CHILDREN = 3U;
+    const puint_z CAPACITY_A = 4U;
+    const puint_z CAPACITY_B = 8U;
+    NTree<char> treeA(MAXIMUM_CHILDREN, CAPACITY_A);
+    treeA.SetRootValue('A');
+    NTree<char>::NTreeIterator itRootA = treeA.GetRoot(ETreeTraversalOrder::E_DepthFirstPreOrder);
+    treeA.AddChild(itRootA, 'B');
+    treeA.AddChild(itRootA, 'C');
+    NTree<char> treeB(MAXIMUM_CHILDREN, CAPACITY_B);
+    treeB.SetRootValue('X');
+    const puint_z EXPECTED_COUNT_A = 1U;
+    const puint_z EXPECTED_COUNT_B = 3U;
+
+    // [Execution]
+    treeA.Swap(treeB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(treeA.GetCount(), EXPECTED_COUNT_A);
+    BOOST_CHECK_EQUAL(treeB.GetCount(), EXPECTED_COUNT_B);
+    BOOST_CHECK_EQUAL(treeA.GetCapacity(), CAPACITY_B);
+    BOOST_CHECK_EQUAL(treeB.GetCapacity(), CAPACITY_A);
+    BOOST_CHECK_EQUAL(*treeA.GetRoot(ETreeTraversalOrder::E_DepthFirstPreOrder), 'X');
+
+    NTree<char>::NTreeIterator itB = treeB.GetRoot(ETreeTraversalOrder::E_DepthFirstPreOrder);
+    BOOST_CHECK_EQUAL(*itB, 'A');
+    ++itB;
+    BOOST_CHECK_EQUAL(*itB, 'B');
+    ++itB;
+    BOOST_CHECK_EQUAL(*itB, 'C');
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the maximum number of child nodes per node of the trees is different.
+/// </summary>
+ZTEST_CASE ( Swap2_AssertionFailsWhenMaximumChildrenAreDifferent_Test )
+{
+    // [Preparation]
+    NTree<char> treeA(2U);
+    NTree<char> treeB(3U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        treeA.Swap(treeB);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
 /// <summary>
 /// Checks that the capacity is correctly calculated.
 /// </summary>
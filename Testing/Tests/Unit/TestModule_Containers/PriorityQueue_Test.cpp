@@ -0,0 +1,359 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/PriorityQueue.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+
+// Comparator that gives the highest priority to the greatest integer
+class PriorityQueueDescendingComparator
+{
+public:
+
+    static i8_z Compare(const int &nLeftOperand, const int &nRightOperand)
+    {
+        return nLeftOperand > nRightOperand ? -1 : (nLeftOperand < nRightOperand ? 1 : 0);
+    }
+};
+
+
+ZTEST_SUITE_BEGIN( PriorityQueue_TestSuite )
+
+/// <summary>
+/// Checks that the queue is empty after default construction.
+/// </summary>
+ZTEST_CASE ( Constructor1_QueueIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 0;
+
+    // [Execution]
+    PriorityQueue<int> queue;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that memory is reserved for the input number of elements.
+/// </summary>
+ZTEST_CASE ( Constructor2_CapacityIsReserved_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 8U;
+
+    // [Execution]
+    PriorityQueue<int> queue(INPUT_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK(queue.GetCapacity() >= INPUT_CAPACITY);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the elements of the input sequence are extracted in ascending order.
+/// </summary>
+ZTEST_CASE ( Constructor3_ElementsAreExtractedInOrder_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 7, 3, 9, 1, 8, 2, 6, 4, 5, 0, 3 };
+    const int EXPECTED_ELEMENTS[] = { 0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+
+    // [Execution]
+    PriorityQueue<int> queue(INPUT_ELEMENTS, INPUT_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetCount(), INPUT_COUNT);
+
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_ELEMENTS[i]);
+        queue.Pop();
+    }
+
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the lowest element is always at the top.
+/// </summary>
+ZTEST_CASE ( Push_LowestElementIsAtTheTop_Test )
+{
+    // [Preparation]
+    PriorityQueue<int> queue;
+    const int INPUT_ELEMENTS[] = { 5, 8, 3, 4, 1 };
+    const int EXPECTED_TOPS[] = { 5, 5, 3, 3, 1 };
+
+    // [Execution]
+    for(puint_z i = 0; i < sizeof(INPUT_ELEMENTS) / sizeof(int); ++i)
+    {
+        queue.Push(INPUT_ELEMENTS[i]);
+
+        // [Verification]
+        BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_TOPS[i]);
+    }
+}
+
+/// <summary>
+/// Checks that elements are extracted in order when the queue grows beyond its initial capacity.
+/// </summary>
+ZTEST_CASE ( Push_ElementsAreExtractedInOrderWhenQueueGrows_Test )
+{
+    // [Preparation]
+    PriorityQueue<int> queue(2U);
+    const int ELEMENT_COUNT = 100;
+
+    // [Execution]
+    for(int i = 0; i < ELEMENT_COUNT; ++i)
+        queue.Push((i * 37) % ELEMENT_COUNT);
+
+    // [Verification]
+    for(int i = 0; i < ELEMENT_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), i);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that the comparator establishes the priority of the elements.
+/// </summary>
+ZTEST_CASE ( Push_ComparatorEstablishesThePriority_Test )
+{
+    // [Preparation]
+    PriorityQueue<int, ContiguousAllocator, PriorityQueueDescendingComparator> queue;
+    const int INPUT_ELEMENTS[] = { 5, 8, 3, 9, 1 };
+    const int EXPECTED_ELEMENTS[] = { 9, 8, 5, 3, 1 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+
+    // [Execution]
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+        queue.Push(INPUT_ELEMENTS[i]);
+
+    // [Verification]
+    for(puint_z i = 0; i < INPUT_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_ELEMENTS[i]);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that elements are extracted in order when the heap is binary.
+/// </summary>
+ZTEST_CASE ( Push_ElementsAreExtractedInOrderWhenArityIsTwo_Test )
+{
+    // [Preparation]
+    PriorityQueue<int, ContiguousAllocator, SComparatorDefault<int>, 2U> queue;
+    const int ELEMENT_COUNT = 50;
+
+    // [Execution]
+    for(int i = ELEMENT_COUNT - 1; i >= 0; --i)
+        queue.Push(i);
+
+    // [Verification]
+    for(int i = 0; i < ELEMENT_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), i);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that elements are extracted in order when more elements than the existing ones are added, which rearranges the whole heap.
+/// </summary>
+ZTEST_CASE ( PushRange_ElementsAreExtractedInOrderWhenRangeIsLargerThanQueue_Test )
+{
+    // [Preparation]
+    PriorityQueue<int> queue;
+    queue.Push(4);
+    queue.Push(10);
+    const int INPUT_ELEMENTS[] = { 7, 3, 9, 1, 8, 2, 6, 0, 5 };
+    const puint_z INPUT_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(int);
+    const puint_z EXPECTED_COUNT = INPUT_COUNT + 2U;
+
+    // [Execution]
+    queue.PushRange(INPUT_ELEMENTS, INPUT_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+
+    for(int i = 0; i < scast_z(EXPECTED_COUNT, int); ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), i);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that elements are extracted in order when fewer elements than the existing ones are added, one by one.
+/// </summary>
+ZTEST_CASE ( PushRange_ElementsAreExtractedInOrderWhenRangeIsSmallerThanQueue_Test )
+{
+    // [Preparation]
+    const int EXISTING_ELEMENTS[] = { 1, 3, 5, 7, 9 };
+    PriorityQueue<int> queue(EXISTING_ELEMENTS, sizeof(EXISTING_ELEMENTS) / sizeof(int));
+    const int INPUT_ELEMENTS[] = { 6, 0, 2 };
+    const int EXPECTED_ELEMENTS[] = { 0, 1, 2, 3, 5, 6, 7, 9 };
+    const puint_z EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(int);
+
+    // [Execution]
+    queue.PushRange(INPUT_ELEMENTS, sizeof(INPUT_ELEMENTS) / sizeof(int));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+
+    for(puint_z i = 0; i < EXPECTED_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_ELEMENTS[i]);
+        queue.Pop();
+    }
+}
+
+/// <summary>
+/// Checks that the top element is removed and the next lowest element takes its place.
+/// </summary>
+ZTEST_CASE ( Pop_NextLowestElementIsAtTheTop_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 4, 2, 6 };
+    PriorityQueue<int> queue(INPUT_ELEMENTS, sizeof(INPUT_ELEMENTS) / sizeof(int));
+    const int EXPECTED_TOP = 4;
+    const puint_z EXPECTED_COUNT = 2U;
+
+    // [Execution]
+    queue.Pop();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_TOP);
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the queue is empty.
+/// </summary>
+ZTEST_CASE ( Pop_AssertionFailsWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    PriorityQueue<int> queue;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.Pop();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the queue is empty.
+/// </summary>
+ZTEST_CASE ( GetTop_AssertionFailsWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    PriorityQueue<int> queue;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.GetTop();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that all the elements are removed and the capacity does not change.
+/// </summary>
+ZTEST_CASE ( Clear_QueueIsEmptyAndCapacityDoesNotChange_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 4, 2, 6 };
+    PriorityQueue<int> queue(INPUT_ELEMENTS, sizeof(INPUT_ELEMENTS) / sizeof(int));
+    const puint_z EXPECTED_CAPACITY = queue.GetCapacity();
+
+    // [Execution]
+    queue.Clear();
+
+    // [Verification]
+    BOOST_CHECK(queue.IsEmpty());
+    BOOST_CHECK_EQUAL(queue.GetCapacity(), EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the elements of both queues are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap_ElementsAreExchanged_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = { 4, 2, 6 };
+    PriorityQueue<int> queue1(INPUT_ELEMENTS, sizeof(INPUT_ELEMENTS) / sizeof(int));
+    PriorityQueue<int> queue2;
+    queue2.Push(8);
+    const int EXPECTED_TOP1 = 8;
+    const int EXPECTED_TOP2 = 2;
+
+    // [Execution]
+    queue1.Swap(queue2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue1.GetTop(), EXPECTED_TOP1);
+    BOOST_CHECK_EQUAL(queue2.GetTop(), EXPECTED_TOP2);
+    BOOST_CHECK_EQUAL(queue1.GetCount(), 1U);
+    BOOST_CHECK_EQUAL(queue2.GetCount(), 3U);
+}
+
+// End - Test Suite: PriorityQueue
+ZTEST_SUITE_END()
@@ -0,0 +1,366 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/QueueBlocking.h"
+
+#include "ZContainers/QueueSpsc.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include "ZTime/TimeSpan.h"
+#include <boost/atomic.hpp>
+
+// Class whose methods are to be used by the threads in the tests of QueueBlocking
+class QueueBlockingTestClass
+{
+public:
+
+    static const u64_z ELEMENTS_PER_THREAD = 10000U;
+    static const u64_z GROUP_SIZE = 3U;
+
+    static boost::atomic<u64_z> sm_uSum;
+
+    // Adds the numbers from 1 to ELEMENTS_PER_THREAD
+    template<class QueueT>
+    static void Produce(QueueT* pQueue)
+    {
+        for(u64_z uValue = 1U; uValue <= ELEMENTS_PER_THREAD; ++uValue)
+            pQueue->Enqueue(uValue);
+    }
+
+    // Extracts ELEMENTS_PER_THREAD numbers and accumulates them
+    template<class QueueT>
+    static void Consume(QueueT* pQueue)
+    {
+        u64_z uSum = 0;
+        u64_z uValue = 0;
+
+        for(u64_z i = 0; i < ELEMENTS_PER_THREAD; ++i)
+        {
+            pQueue->Dequeue(uValue);
+            uSum += uValue;
+        }
+
+        sm_uSum.fetch_add(uSum);
+    }
+
+    // Adds the numbers from 1 to ELEMENTS_PER_THREAD in groups
+    static void ProduceGroups(QueueBlocking<u64_z>* pQueue)
+    {
+        u64_z arGroup[GROUP_SIZE];
+
+        for(u64_z uValue = 1U; uValue <= ELEMENTS_PER_THREAD; uValue += GROUP_SIZE)
+        {
+            puint_z uCount = 0;
+
+            for(; uCount < GROUP_SIZE && uValue + uCount <= ELEMENTS_PER_THREAD; ++uCount)
+                arGroup[uCount] = uValue + uCount;
+
+            pQueue->Enqueue(arGroup, uCount);
+        }
+    }
+
+    // Extracts ELEMENTS_PER_THREAD numbers in groups and accumulates them
+    static void ConsumeGroups(QueueBlocking<u64_z>* pQueue)
+    {
+        u64_z arGroup[GROUP_SIZE];
+        u64_z uSum = 0;
+        u64_z uExtracted = 0;
+
+        while(uExtracted < ELEMENTS_PER_THREAD)
+        {
+            const u64_z PENDING = ELEMENTS_PER_THREAD - uExtracted;
+            const puint_z EXTRACTED_NOW = pQueue->Dequeue(arGroup, PENDING < GROUP_SIZE ? scast_z(PENDING, puint_z) : GROUP_SIZE);
+
+            for(puint_z i = 0; i < EXTRACTED_NOW; ++i)
+                uSum += arGroup[i];
+
+            uExtracted += EXTRACTED_NOW;
+        }
+
+        sm_uSum.fetch_add(uSum);
+    }
+
+    // Adds one element
+    static void EnqueueOne(QueueBlocking<u64_z>* pQueue)
+    {
+        const u64_z ELEMENT = ELEMENTS_PER_THREAD;
+        pQueue->Enqueue(ELEMENT);
+    }
+
+    // Extracts one element
+    static void DequeueOne(QueueBlocking<u64_z>* pQueue)
+    {
+        u64_z uValue = 0;
+        pQueue->Dequeue(uValue);
+        sm_uSum.fetch_add(uValue);
+    }
+};
+
+boost::atomic<u64_z> QueueBlockingTestClass::sm_uSum(0);
+
+
+ZTEST_SUITE_BEGIN( QueueBlocking_TestSuite )
+
+/// <summary>
+/// Checks that the capacity is that of the wrapped queue.
+/// </summary>
+ZTEST_CASE ( Constructor_CapacityIsThatOfWrappedQueue_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 5U;
+    const puint_z EXPECTED_CAPACITY = 8U;
+
+    // [Execution]
+    QueueBlocking<u64_z> queue(INPUT_CAPACITY);
+
+    // [Verification]
+    puint_z uCapacity = queue.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the thread waits until there is free space and then adds the element.
+/// </summary>
+ZTEST_CASE ( Enqueue1_WaitsUntilThereIsFreeSpace_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 2U;
+    const u64_z FIRST_ELEMENT = 1U;
+    const u64_z EXPECTED_LAST_ELEMENT = QueueBlockingTestClass::ELEMENTS_PER_THREAD;
+    QueueBlocking<u64_z> queue(CAPACITY);
+    queue.Enqueue(FIRST_ELEMENT);
+    queue.Enqueue(FIRST_ELEMENT);
+    Delegate<void(QueueBlocking<u64_z>*)> function(&QueueBlockingTestClass::EnqueueOne);
+
+    // [Execution]
+    Thread producer(function, &queue);
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    bool bIsWaiting = producer.IsAlive();
+    u64_z uOutput = 0;
+    queue.Dequeue(uOutput);
+    producer.Join();
+
+    // [Verification]
+    queue.Dequeue(uOutput);
+    queue.Dequeue(uOutput);
+    BOOST_CHECK(bIsWaiting);
+    BOOST_CHECK_EQUAL(uOutput, EXPECTED_LAST_ELEMENT);
+}
+
+/// <summary>
+/// Checks that all the elements are added, in order, although they do not fit in the queue.
+/// </summary>
+ZTEST_CASE ( Enqueue2_AllElementsAreAddedWhenTheyDoNotFit_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z EXPECTED_SUM = QueueBlockingTestClass::ELEMENTS_PER_THREAD * (QueueBlockingTestClass::ELEMENTS_PER_THREAD + 1U) / 2U;
+    QueueBlocking<u64_z> queue(CAPACITY);
+    QueueBlockingTestClass::sm_uSum = 0;
+    Delegate<void(QueueBlocking<u64_z>*)> produce(&QueueBlockingTestClass::ProduceGroups);
+
+    // [Execution]
+    Thread producer(produce, &queue);
+    bool bOrderIsCorrect = true;
+    u64_z uSum = 0;
+    u64_z uValue = 0;
+
+    for(u64_z uExpectedValue = 1U; uExpectedValue <= QueueBlockingTestClass::ELEMENTS_PER_THREAD; ++uExpectedValue)
+    {
+        queue.Dequeue(uValue);
+        bOrderIsCorrect = bOrderIsCorrect && uValue == uExpectedValue;
+        uSum += uValue;
+    }
+
+    producer.Join();
+
+    // [Verification]
+    BOOST_CHECK(bOrderIsCorrect);
+    BOOST_CHECK_EQUAL(uSum, EXPECTED_SUM);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the thread waits until there is an element and then extracts it.
+/// </summary>
+ZTEST_CASE ( Dequeue1_WaitsUntilThereAreElements_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 2U;
+    const u64_z ELEMENT = 5U;
+    const u64_z EXPECTED_SUM = ELEMENT;
+    QueueBlocking<u64_z> queue(CAPACITY);
+    QueueBlockingTestClass::sm_uSum = 0;
+    Delegate<void(QueueBlocking<u64_z>*)> function(&QueueBlockingTestClass::DequeueOne);
+
+    // [Execution]
+    Thread consumer(function, &queue);
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    bool bIsWaiting = consumer.IsAlive();
+    queue.Enqueue(ELEMENT);
+    consumer.Join();
+
+    // [Verification]
+    u64_z uSum = QueueBlockingTestClass::sm_uSum;
+    BOOST_CHECK(bIsWaiting);
+    BOOST_CHECK_EQUAL(uSum, EXPECTED_SUM);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that it extracts the available elements, up to the maximum, without waiting for more.
+/// </summary>
+ZTEST_CASE ( Dequeue2_ExtractsAvailableElementsUpToMaximum_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 8U;
+    const u64_z ELEMENTS[] = { 1U, 2U, 3U };
+    const puint_z ELEMENT_COUNT = sizeof(ELEMENTS) / sizeof(u64_z);
+    const puint_z MAXIMUM = 5U;
+    QueueBlocking<u64_z> queue(CAPACITY);
+    queue.Enqueue(ELEMENTS, ELEMENT_COUNT);
+
+    // [Execution]
+    u64_z arResult[MAXIMUM];
+    puint_z uExtracted = queue.Dequeue(arResult, MAXIMUM);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uExtracted, ELEMENT_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResult, arResult + ELEMENT_COUNT, ELEMENTS, ELEMENTS + ELEMENT_COUNT);
+}
+
+/// <summary>
+/// Checks that no element is lost or duplicated when several producers and consumers wait on the queue at the same time.
+/// </summary>
+ZTEST_CASE ( Dequeue1_NoElementIsLostWhenSeveralThreadsUseTheQueue_Test )
+{
+    // [Preparation]
+    const puint_z THREAD_COUNT = 4U;
+    const puint_z CAPACITY = 4U;
+    const u64_z EXPECTED_SUM = THREAD_COUNT * (QueueBlockingTestClass::ELEMENTS_PER_THREAD * (QueueBlockingTestClass::ELEMENTS_PER_THREAD + 1U) / 2U);
+    QueueBlocking<u64_z> queue(CAPACITY);
+    QueueBlockingTestClass::sm_uSum = 0;
+    Delegate<void(QueueBlocking<u64_z>*)> produce(&QueueBlockingTestClass::Produce< QueueBlocking<u64_z> >);
+    Delegate<void(QueueBlocking<u64_z>*)> consume(&QueueBlockingTestClass::Consume< QueueBlocking<u64_z> >);
+    Delegate<void(QueueBlocking<u64_z>*)> produceGroups(&QueueBlockingTestClass::ProduceGroups);
+    Delegate<void(QueueBlocking<u64_z>*)> consumeGroups(&QueueBlockingTestClass::ConsumeGroups);
+
+    // [Execution]
+    Thread* arProducers[THREAD_COUNT];
+    Thread* arConsumers[THREAD_COUNT];
+
+    for(puint_z i = 0; i < THREAD_COUNT; ++i)
+    {
+        arConsumers[i] = new Thread(i % 2U == 0 ? consume : consumeGroups, &queue);
+        arProducers[i] = new Thread(i % 2U == 0 ? produceGroups : produce, &queue);
+    }
+
+    for(puint_z i = 0; i < THREAD_COUNT; ++i)
+    {
+        arProducers[i]->Join();
+        arConsumers[i]->Join();
+        delete arProducers[i];
+        delete arConsumers[i];
+    }
+
+    // [Verification]
+    u64_z uSum = QueueBlockingTestClass::sm_uSum;
+    BOOST_CHECK_EQUAL(uSum, EXPECTED_SUM);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that no element is lost when the wrapped queue is a single-producer single-consumer queue.
+/// </summary>
+ZTEST_CASE ( Dequeue1_NoElementIsLostWhenWrappedQueueIsSingleProducerSingleConsumer_Test )
+{
+    // [Preparation]
+    typedef QueueBlocking<u64_z, QueueSpsc<u64_z> > QueueBlockingSpsc;
+    const puint_z CAPACITY = 4U;
+    const u64_z EXPECTED_SUM = QueueBlockingTestClass::ELEMENTS_PER_THREAD * (QueueBlockingTestClass::ELEMENTS_PER_THREAD + 1U) / 2U;
+    QueueBlockingSpsc queue(CAPACITY);
+    QueueBlockingTestClass::sm_uSum = 0;
+    Delegate<void(QueueBlockingSpsc*)> produce(&QueueBlockingTestClass::Produce<QueueBlockingSpsc>);
+    Delegate<void(QueueBlockingSpsc*)> consume(&QueueBlockingTestClass::Consume<QueueBlockingSpsc>);
+
+    // [Execution]
+    Thread consumer(consume, &queue);
+    Thread producer(produce, &queue);
+    producer.Join();
+    consumer.Join();
+
+    // [Verification]
+    u64_z uSum = QueueBlockingTestClass::sm_uSum;
+    BOOST_CHECK_EQUAL(uSum, EXPECTED_SUM);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that it returns False instead of waiting when the queue is full.
+/// </summary>
+ZTEST_CASE ( TryEnqueue1_ReturnsFalseWhenQueueIsFull_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 2U;
+    const u64_z ELEMENT = 1U;
+    QueueBlocking<u64_z> queue(CAPACITY);
+    queue.Enqueue(ELEMENT);
+    queue.Enqueue(ELEMENT);
+
+    // [Execution]
+    bool bResult = queue.TryEnqueue(ELEMENT);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+}
+
+/// <summary>
+/// Checks that it returns False instead of waiting when the queue is empty.
+/// </summary>
+ZTEST_CASE ( TryDequeue1_ReturnsFalseWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 2U;
+    QueueBlocking<u64_z> queue(CAPACITY);
+    u64_z uOutput = 0;
+
+    // [Execution]
+    bool bResult = queue.TryDequeue(uOutput);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+}
+
+// End - Test Suite: QueueBlocking
+ZTEST_SUITE_END()
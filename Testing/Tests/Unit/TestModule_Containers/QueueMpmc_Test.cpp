@@ -0,0 +1,528 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/QueueMpmc.h"
+
+#include "CallCounter.h"
+#include "ZCommon/Exceptions/AssertException.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include <boost/atomic.hpp>
+
+using z::Test::CallCounter;
+
+// Class whose methods are to be used by the threads in the tests of QueueMpmc
+class QueueMpmcTestClass
+{
+public:
+
+    static const u64_z ELEMENTS_PER_THREAD = 10000U;
+
+    static boost::atomic<u64_z> sm_uSum;
+
+    // Adds the numbers from 1 to ELEMENTS_PER_THREAD
+    static void Produce(QueueMpmc<u64_z>* pQueue)
+    {
+        for(u64_z uValue = 1U; uValue <= ELEMENTS_PER_THREAD; ++uValue)
+        {
+            while(!pQueue->TryEnqueue(uValue))
+                SThisThread::Yield();
+        }
+    }
+
+    // Extracts ELEMENTS_PER_THREAD numbers and accumulates them
+    static void Consume(QueueMpmc<u64_z>* pQueue)
+    {
+        u64_z uSum = 0;
+        u64_z uValue = 0;
+
+        for(u64_z i = 0; i < ELEMENTS_PER_THREAD; ++i)
+        {
+            while(!pQueue->TryDequeue(uValue))
+                SThisThread::Yield();
+
+            uSum += uValue;
+        }
+
+        sm_uSum.fetch_add(uSum);
+    }
+};
+
+boost::atomic<u64_z> QueueMpmcTestClass::sm_uSum(0);
+
+
+ZTEST_SUITE_BEGIN( QueueMpmc_TestSuite )
+
+/// <summary>
+/// Checks that the capacity is rounded up to the next power of two.
+/// </summary>
+ZTEST_CASE ( Constructor_CapacityIsRoundedUpToPowerOfTwo_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 5U;
+    const puint_z EXPECTED_CAPACITY = 8U;
+
+    // [Execution]
+    QueueMpmc<u64_z> queue(INPUT_CAPACITY);
+
+    // [Verification]
+    puint_z uCapacity = queue.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the capacity does not change when it is already a power of two.
+/// </summary>
+ZTEST_CASE ( Constructor_CapacityDoesNotChangeWhenItIsPowerOfTwo_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 16U;
+    const puint_z EXPECTED_CAPACITY = 16U;
+
+    // [Execution]
+    QueueMpmc<u64_z> queue(INPUT_CAPACITY);
+
+    // [Verification]
+    puint_z uCapacity = queue.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the capacity is 2 when 1 is requested.
+/// </summary>
+ZTEST_CASE ( Constructor_CapacityIsTwoWhenOneIsRequested_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 1U;
+    const puint_z EXPECTED_CAPACITY = 2U;
+
+    // [Execution]
+    QueueMpmc<u64_z> queue(INPUT_CAPACITY);
+
+    // [Verification]
+    puint_z uCapacity = queue.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the queue is empty after it is created.
+/// </summary>
+ZTEST_CASE ( Constructor_QueueIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+
+    // [Execution]
+    QueueMpmc<u64_z> queue(CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK(queue.IsEmpty());
+    BOOST_CHECK_EQUAL(queue.GetCount(), 0U);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the capacity is zero.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenCapacityIsZero_Test )
+{
+    // [Preparation]
+    const puint_z ZERO_CAPACITY = 0;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QueueMpmc<u64_z> queue(ZERO_CAPACITY);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the destructor of the elements that remain in the queue is called.
+/// </summary>
+ZTEST_CASE ( Destructor_RemainingElementsAreDestroyed_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 3U;
+
+    {
+        QueueMpmc<CallCounter> queue(CAPACITY);
+        CallCounter element;
+        queue.TryEnqueue(element);
+        queue.TryEnqueue(element);
+        queue.TryEnqueue(element);
+        queue.TryDequeue(element);
+        CallCounter::ResetCounters();
+
+    // [Execution]
+    }   // The element and the 2 elements of the queue are destroyed
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that the element is added when there is free space.
+/// </summary>
+ZTEST_CASE ( TryEnqueue1_ElementIsAddedWhenThereIsFreeSpace_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENT = 7U;
+    const puint_z EXPECTED_COUNT = 1U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+
+    // [Execution]
+    bool bResult = queue.TryEnqueue(ELEMENT);
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that it returns False when the queue is full.
+/// </summary>
+ZTEST_CASE ( TryEnqueue1_ReturnsFalseWhenQueueIsFull_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 2U;
+    const u64_z ELEMENT = 7U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENT);
+    queue.TryEnqueue(ELEMENT);
+
+    // [Execution]
+    bool bResult = queue.TryEnqueue(ELEMENT);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+    BOOST_CHECK_EQUAL(queue.GetCount(), CAPACITY);
+}
+
+/// <summary>
+/// Checks that all the elements are added when they fit.
+/// </summary>
+ZTEST_CASE ( TryEnqueue2_AllElementsAreAddedWhenTheyFit_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENTS[] = { 1U, 2U, 3U };
+    const puint_z ELEMENT_COUNT = sizeof(ELEMENTS) / sizeof(u64_z);
+    QueueMpmc<u64_z> queue(CAPACITY);
+
+    // [Execution]
+    puint_z uAdded = queue.TryEnqueue(ELEMENTS, ELEMENT_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uAdded, ELEMENT_COUNT);
+    BOOST_CHECK_EQUAL(queue.GetCount(), ELEMENT_COUNT);
+}
+
+/// <summary>
+/// Checks that only the first elements that fit in the free space are added.
+/// </summary>
+ZTEST_CASE ( TryEnqueue2_OnlyElementsThatFitAreAdded_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENTS[] = { 1U, 2U, 3U };
+    const puint_z ELEMENT_COUNT = sizeof(ELEMENTS) / sizeof(u64_z);
+    const puint_z EXPECTED_ADDED = 2U;
+    const u64_z EXPECTED_LAST_ELEMENT = 2U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENTS, 2U);
+
+    // [Execution]
+    puint_z uAdded = queue.TryEnqueue(ELEMENTS, ELEMENT_COUNT);
+
+    // [Verification]
+    u64_z uLastElement = 0;
+
+    for(puint_z i = 0; i < CAPACITY; ++i)
+        queue.TryDequeue(uLastElement);
+
+    BOOST_CHECK_EQUAL(uAdded, EXPECTED_ADDED);
+    BOOST_CHECK_EQUAL(uLastElement, EXPECTED_LAST_ELEMENT);
+}
+
+/// <summary>
+/// Checks that it returns zero when the queue is full.
+/// </summary>
+ZTEST_CASE ( TryEnqueue2_ReturnsZeroWhenQueueIsFull_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 2U;
+    const u64_z ELEMENTS[] = { 1U, 2U };
+    const puint_z EXPECTED_ADDED = 0;
+    QueueMpmc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENTS, 2U);
+
+    // [Execution]
+    puint_z uAdded = queue.TryEnqueue(ELEMENTS, 2U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uAdded, EXPECTED_ADDED);
+}
+
+/// <summary>
+/// Checks that elements are extracted in the same order they were added.
+/// </summary>
+ZTEST_CASE ( TryDequeue1_ElementsAreExtractedInSameOrderTheyWereAdded_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENTS[] = { 5U, 3U, 9U, 1U };
+    QueueMpmc<u64_z> queue(CAPACITY);
+
+    for(puint_z i = 0; i < CAPACITY; ++i)
+        queue.TryEnqueue(ELEMENTS[i]);
+
+    // [Execution]
+    u64_z arResult[CAPACITY];
+
+    for(puint_z i = 0; i < CAPACITY; ++i)
+        queue.TryDequeue(arResult[i]);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResult, arResult + CAPACITY, ELEMENTS, ELEMENTS + CAPACITY);
+}
+
+/// <summary>
+/// Checks that it returns False when the queue is empty.
+/// </summary>
+ZTEST_CASE ( TryDequeue1_ReturnsFalseWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENT = 7U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+    u64_z uOutput = 0;
+    queue.TryEnqueue(ELEMENT);
+    queue.TryDequeue(uOutput);
+
+    // [Execution]
+    bool bResult = queue.TryDequeue(uOutput);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+}
+
+/// <summary>
+/// Checks that positions are reused correctly when the queue has been filled and emptied many times.
+/// </summary>
+ZTEST_CASE ( TryDequeue1_ElementsAreCorrectAfterManyLaps_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENT_COUNT = 103U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+
+    // [Execution]
+    bool bElementsAreCorrect = true;
+    u64_z uOutput = 0;
+
+    for(u64_z i = 0; i < ELEMENT_COUNT; ++i)
+    {
+        queue.TryEnqueue(i);
+        queue.TryEnqueue(i);
+        queue.TryDequeue(uOutput);
+        bElementsAreCorrect = bElementsAreCorrect && uOutput == i;
+        queue.TryDequeue(uOutput);
+        bElementsAreCorrect = bElementsAreCorrect && uOutput == i;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bElementsAreCorrect);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the elements are extracted in order, up to the maximum.
+/// </summary>
+ZTEST_CASE ( TryDequeue2_ElementsAreExtractedInOrderUpToMaximum_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENTS[] = { 5U, 3U, 9U, 1U };
+    const puint_z MAXIMUM = 3U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENTS, CAPACITY);
+
+    // [Execution]
+    u64_z arResult[MAXIMUM];
+    puint_z uExtracted = queue.TryDequeue(arResult, MAXIMUM);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uExtracted, MAXIMUM);
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResult, arResult + MAXIMUM, ELEMENTS, ELEMENTS + MAXIMUM);
+    BOOST_CHECK_EQUAL(queue.GetCount(), 1U);
+}
+
+/// <summary>
+/// Checks that only the available elements are extracted when there are fewer than the maximum.
+/// </summary>
+ZTEST_CASE ( TryDequeue2_OnlyAvailableElementsAreExtracted_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 8U;
+    const u64_z ELEMENTS[] = { 5U, 3U };
+    const puint_z ELEMENT_COUNT = sizeof(ELEMENTS) / sizeof(u64_z);
+    const puint_z MAXIMUM = 6U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENTS, ELEMENT_COUNT);
+
+    // [Execution]
+    u64_z arResult[MAXIMUM];
+    puint_z uExtracted = queue.TryDequeue(arResult, MAXIMUM);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uExtracted, ELEMENT_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResult, arResult + ELEMENT_COUNT, ELEMENTS, ELEMENTS + ELEMENT_COUNT);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the destructor of the extracted elements is called.
+/// </summary>
+ZTEST_CASE ( TryDequeue2_DestructorOfExtractedElementsIsCalled_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 2U;
+    QueueMpmc<CallCounter> queue(CAPACITY);
+    CallCounter arElements[2];
+    queue.TryEnqueue(arElements, 2U);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    queue.TryDequeue(arElements, 2U);
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that no element is lost or duplicated when several producers and consumers use the queue at the same time.
+/// </summary>
+ZTEST_CASE ( TryDequeue1_NoElementIsLostWhenSeveralThreadsUseTheQueue_Test )
+{
+    // [Preparation]
+    const puint_z THREAD_COUNT = 4U;
+    const puint_z CAPACITY = 8U;
+    const u64_z EXPECTED_SUM = THREAD_COUNT * (QueueMpmcTestClass::ELEMENTS_PER_THREAD * (QueueMpmcTestClass::ELEMENTS_PER_THREAD + 1U) / 2U);
+    QueueMpmc<u64_z> queue(CAPACITY);
+    QueueMpmcTestClass::sm_uSum = 0;
+    Delegate<void(QueueMpmc<u64_z>*)> produce(&QueueMpmcTestClass::Produce);
+    Delegate<void(QueueMpmc<u64_z>*)> consume(&QueueMpmcTestClass::Consume);
+
+    // [Execution]
+    Thread* arProducers[THREAD_COUNT];
+    Thread* arConsumers[THREAD_COUNT];
+
+    for(puint_z i = 0; i < THREAD_COUNT; ++i)
+    {
+        arConsumers[i] = new Thread(consume, &queue);
+        arProducers[i] = new Thread(produce, &queue);
+    }
+
+    for(puint_z i = 0; i < THREAD_COUNT; ++i)
+    {
+        arProducers[i]->Join();
+        arConsumers[i]->Join();
+        delete arProducers[i];
+        delete arConsumers[i];
+    }
+
+    // [Verification]
+    u64_z uSum = QueueMpmcTestClass::sm_uSum;
+    BOOST_CHECK_EQUAL(uSum, EXPECTED_SUM);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that it returns the number of elements.
+/// </summary>
+ZTEST_CASE ( GetCount_ReturnsNumberOfElements_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 8U;
+    const u64_z ELEMENTS[] = { 1U, 2U, 3U, 4U, 5U };
+    const puint_z EXPECTED_COUNT = 3U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENTS, 5U);
+    u64_z arOutput[2];
+    queue.TryDequeue(arOutput, 2U);
+
+    // [Execution]
+    puint_z uCount = queue.GetCount();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that it returns False when the queue contains elements.
+/// </summary>
+ZTEST_CASE ( IsEmpty_ReturnsFalseWhenQueueContainsElements_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 8U;
+    const u64_z ELEMENT = 1U;
+    QueueMpmc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENT);
+
+    // [Execution]
+    bool bIsEmpty = queue.IsEmpty();
+
+    // [Verification]
+    BOOST_CHECK(!bIsEmpty);
+}
+
+// End - Test Suite: QueueMpmc
+ZTEST_SUITE_END()
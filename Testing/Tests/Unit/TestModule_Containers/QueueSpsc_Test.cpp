@@ -0,0 +1,381 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/QueueSpsc.h"
+
+#include "CallCounter.h"
+#include "ZCommon/Exceptions/AssertException.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+
+using z::Test::CallCounter;
+
+// Class whose methods are to be used by the threads in the tests of QueueSpsc
+class QueueSpscTestClass
+{
+public:
+
+    static const u64_z ELEMENT_COUNT = 100000U;
+
+    static u64_z sm_uSum;
+    static bool sm_bOrderIsCorrect;
+
+    // Adds the numbers from 1 to ELEMENT_COUNT, some of them in groups
+    static void Produce(QueueSpsc<u64_z>* pQueue)
+    {
+        u64_z arGroup[3];
+        u64_z uValue = 1U;
+
+        while(uValue <= ELEMENT_COUNT)
+        {
+            if(uValue % 2U == 0 && uValue + 2U <= ELEMENT_COUNT)
+            {
+                arGroup[0] = uValue;
+                arGroup[1] = uValue + 1U;
+                arGroup[2] = uValue + 2U;
+                uValue += pQueue->TryEnqueue(arGroup, 3U);
+            }
+            else if(pQueue->TryEnqueue(uValue))
+            {
+                ++uValue;
+            }
+            else
+            {
+                SThisThread::Yield();
+            }
+        }
+    }
+
+    // Extracts ELEMENT_COUNT numbers, checks their order and accumulates them
+    static void Consume(QueueSpsc<u64_z>* pQueue)
+    {
+        u64_z arGroup[5];
+        u64_z uExpectedValue = 1U;
+
+        sm_uSum = 0;
+        sm_bOrderIsCorrect = true;
+
+        while(uExpectedValue <= ELEMENT_COUNT)
+        {
+            const puint_z EXTRACTED_COUNT = pQueue->TryDequeue(arGroup, 5U);
+
+            if(EXTRACTED_COUNT == 0)
+                SThisThread::Yield();
+
+            for(puint_z i = 0; i < EXTRACTED_COUNT; ++i, ++uExpectedValue)
+            {
+                sm_bOrderIsCorrect = sm_bOrderIsCorrect && arGroup[i] == uExpectedValue;
+                sm_uSum += arGroup[i];
+            }
+        }
+    }
+};
+
+u64_z QueueSpscTestClass::sm_uSum = 0;
+bool QueueSpscTestClass::sm_bOrderIsCorrect = false;
+
+
+ZTEST_SUITE_BEGIN( QueueSpsc_TestSuite )
+
+/// <summary>
+/// Checks that the capacity is rounded up to the next power of two.
+/// </summary>
+ZTEST_CASE ( Constructor_CapacityIsRoundedUpToPowerOfTwo_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 9U;
+    const puint_z EXPECTED_CAPACITY = 16U;
+
+    // [Execution]
+    QueueSpsc<u64_z> queue(INPUT_CAPACITY);
+
+    // [Verification]
+    puint_z uCapacity = queue.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the queue is empty after it is created.
+/// </summary>
+ZTEST_CASE ( Constructor_QueueIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+
+    // [Execution]
+    QueueSpsc<u64_z> queue(CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK(queue.IsEmpty());
+    BOOST_CHECK_EQUAL(queue.GetCount(), 0U);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the capacity is zero.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenCapacityIsZero_Test )
+{
+    // [Preparation]
+    const puint_z ZERO_CAPACITY = 0;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QueueSpsc<u64_z> queue(ZERO_CAPACITY);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the destructor of the elements that remain in the queue is called.
+/// </summary>
+ZTEST_CASE ( Destructor_RemainingElementsAreDestroyed_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 3U;
+
+    {
+        QueueSpsc<CallCounter> queue(CAPACITY);
+        CallCounter element;
+        queue.TryEnqueue(element);
+        queue.TryEnqueue(element);
+        queue.TryEnqueue(element);
+        queue.TryDequeue(element);
+        CallCounter::ResetCounters();
+
+    // [Execution]
+    }   // The element and the 2 elements of the queue are destroyed
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that it returns False when the queue is full.
+/// </summary>
+ZTEST_CASE ( TryEnqueue1_ReturnsFalseWhenQueueIsFull_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 2U;
+    const u64_z ELEMENT = 7U;
+    QueueSpsc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENT);
+    queue.TryEnqueue(ELEMENT);
+
+    // [Execution]
+    bool bResult = queue.TryEnqueue(ELEMENT);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+    BOOST_CHECK_EQUAL(queue.GetCount(), CAPACITY);
+}
+
+/// <summary>
+/// Checks that it succeeds again when an element has been extracted from a full queue.
+/// </summary>
+ZTEST_CASE ( TryEnqueue1_ReturnsTrueWhenFullQueueHasBeenDequeued_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 2U;
+    const u64_z ELEMENT = 7U;
+    QueueSpsc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENT);
+    queue.TryEnqueue(ELEMENT);
+    queue.TryEnqueue(ELEMENT);
+    u64_z uOutput = 0;
+    queue.TryDequeue(uOutput);
+
+    // [Execution]
+    bool bResult = queue.TryEnqueue(ELEMENT);
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+}
+
+/// <summary>
+/// Checks that only the first elements that fit in the free space are added.
+/// </summary>
+ZTEST_CASE ( TryEnqueue2_OnlyElementsThatFitAreAdded_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENTS[] = { 1U, 2U, 3U };
+    const puint_z ELEMENT_COUNT = sizeof(ELEMENTS) / sizeof(u64_z);
+    const puint_z EXPECTED_ADDED = 2U;
+    const u64_z EXPECTED_LAST_ELEMENT = 2U;
+    QueueSpsc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENTS, 2U);
+
+    // [Execution]
+    puint_z uAdded = queue.TryEnqueue(ELEMENTS, ELEMENT_COUNT);
+
+    // [Verification]
+    u64_z uLastElement = 0;
+
+    for(puint_z i = 0; i < CAPACITY; ++i)
+        queue.TryDequeue(uLastElement);
+
+    BOOST_CHECK_EQUAL(uAdded, EXPECTED_ADDED);
+    BOOST_CHECK_EQUAL(uLastElement, EXPECTED_LAST_ELEMENT);
+}
+
+/// <summary>
+/// Checks that elements are extracted in the same order they were added, also when the positions wrap around.
+/// </summary>
+ZTEST_CASE ( TryDequeue1_ElementsAreExtractedInSameOrderTheyWereAdded_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    const u64_z ELEMENTS[] = { 5U, 3U, 9U, 1U };
+    QueueSpsc<u64_z> queue(CAPACITY);
+    u64_z uOutput = 0;
+    queue.TryEnqueue(ELEMENTS, 3U);
+    queue.TryDequeue(uOutput);
+    queue.TryDequeue(uOutput);
+    queue.TryDequeue(uOutput);
+
+    for(puint_z i = 0; i < CAPACITY; ++i)
+        queue.TryEnqueue(ELEMENTS[i]);
+
+    // [Execution]
+    u64_z arResult[CAPACITY];
+
+    for(puint_z i = 0; i < CAPACITY; ++i)
+        queue.TryDequeue(arResult[i]);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResult, arResult + CAPACITY, ELEMENTS, ELEMENTS + CAPACITY);
+}
+
+/// <summary>
+/// Checks that it returns False when the queue is empty.
+/// </summary>
+ZTEST_CASE ( TryDequeue1_ReturnsFalseWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 4U;
+    QueueSpsc<u64_z> queue(CAPACITY);
+    u64_z uOutput = 0;
+
+    // [Execution]
+    bool bResult = queue.TryDequeue(uOutput);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+}
+
+/// <summary>
+/// Checks that only the available elements are extracted when there are fewer than the maximum.
+/// </summary>
+ZTEST_CASE ( TryDequeue2_OnlyAvailableElementsAreExtracted_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 8U;
+    const u64_z ELEMENTS[] = { 5U, 3U };
+    const puint_z ELEMENT_COUNT = sizeof(ELEMENTS) / sizeof(u64_z);
+    const puint_z MAXIMUM = 6U;
+    QueueSpsc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENTS, ELEMENT_COUNT);
+
+    // [Execution]
+    u64_z arResult[MAXIMUM];
+    puint_z uExtracted = queue.TryDequeue(arResult, MAXIMUM);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uExtracted, ELEMENT_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResult, arResult + ELEMENT_COUNT, ELEMENTS, ELEMENTS + ELEMENT_COUNT);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that elements arrive in order and none is lost when a producer thread and a consumer thread use the queue at the same time.
+/// </summary>
+ZTEST_CASE ( TryDequeue2_ElementsArriveInOrderWhenProducerAndConsumerRunAtSameTime_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 16U;
+    const u64_z EXPECTED_SUM = QueueSpscTestClass::ELEMENT_COUNT * (QueueSpscTestClass::ELEMENT_COUNT + 1U) / 2U;
+    QueueSpsc<u64_z> queue(CAPACITY);
+    Delegate<void(QueueSpsc<u64_z>*)> produce(&QueueSpscTestClass::Produce);
+    Delegate<void(QueueSpsc<u64_z>*)> consume(&QueueSpscTestClass::Consume);
+
+    // [Execution]
+    Thread consumer(consume, &queue);
+    Thread producer(produce, &queue);
+    producer.Join();
+    consumer.Join();
+
+    // [Verification]
+    BOOST_CHECK(QueueSpscTestClass::sm_bOrderIsCorrect);
+    BOOST_CHECK_EQUAL(QueueSpscTestClass::sm_uSum, EXPECTED_SUM);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that it returns the number of elements.
+/// </summary>
+ZTEST_CASE ( GetCount_ReturnsNumberOfElements_Test )
+{
+    // [Preparation]
+    const puint_z CAPACITY = 8U;
+    const u64_z ELEMENTS[] = { 1U, 2U, 3U, 4U, 5U };
+    const puint_z EXPECTED_COUNT = 3U;
+    QueueSpsc<u64_z> queue(CAPACITY);
+    queue.TryEnqueue(ELEMENTS, 5U);
+    u64_z arOutput[2];
+    queue.TryDequeue(arOutput, 2U);
+
+    // [Execution]
+    puint_z uCount = queue.GetCount();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+// End - Test Suite: QueueSpsc
+ZTEST_SUITE_END()
@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/SStringEqualityComparator.h"
+
+
+ZTEST_SUITE_BEGIN( SStringEqualityComparator_TestSuite )
+
+/// <summary>
+/// Checks that it returns 0 when strings are equal.
+/// </summary>
+ZTEST_CASE ( Compare_ReturnsZeroWhenStringsAreEqual_Test )
+{
+    // [Preparation]
+    const string_z LEFT_OPERAND("A text to be compared");
+    string_z strRightOperand("A text to be ");
+    strRightOperand.Append("compared");
+    const i8_z EXPECTED_RESULT = 0;
+
+    // [Execution]
+    i8_z nResult = SStringEqualityComparator::Compare(LEFT_OPERAND, strRightOperand);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns 0 when both strings are empty.
+/// </summary>
+ZTEST_CASE ( Compare_ReturnsZeroWhenStringsAreEmpty_Test )
+{
+    // [Preparation]
+    const string_z LEFT_OPERAND;
+    const string_z RIGHT_OPERAND("");
+    const i8_z EXPECTED_RESULT = 0;
+
+    // [Execution]
+    i8_z nResult = SStringEqualityComparator::Compare(LEFT_OPERAND, RIGHT_OPERAND);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns 1 when strings have different lengths.
+/// </summary>
+ZTEST_CASE ( Compare_ReturnsOneWhenStringsHaveDifferentLengths_Test )
+{
+    // [Preparation]
+    const string_z LEFT_OPERAND("A text to be compared");
+    const string_z RIGHT_OPERAND("A text to be compared.");
+    const i8_z EXPECTED_RESULT = 1;
+
+    // [Execution]
+    i8_z nResult = SStringEqualityComparator::Compare(LEFT_OPERAND, RIGHT_OPERAND);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns 1 when strings have the same length but different characters.
+/// </summary>
+ZTEST_CASE ( Compare_ReturnsOneWhenStringsHaveSameLengthButDifferentCharacters_Test )
+{
+    // [Preparation]
+    const string_z LEFT_OPERAND("A text to be compared");
+    const string_z RIGHT_OPERAND("A text to be Compared");
+    const i8_z EXPECTED_RESULT = 1;
+
+    // [Execution]
+    i8_z nResult = SStringEqualityComparator::Compare(LEFT_OPERAND, RIGHT_OPERAND);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that the result is correct when one of the strings is modified after being compared.
+/// </summary>
+ZTEST_CASE ( Compare_ResultIsCorrectWhenStringIsModifiedAfterBeingCompared_Test )
+{
+    // [Preparation]
+    const string_z LEFT_OPERAND("A text to be compared");
+    string_z strRightOperand("A text to be Compared");
+    const i8_z RESULT_BEFORE_MODIFYING = SStringEqualityComparator::Compare(LEFT_OPERAND, strRightOperand);
+    const i8_z EXPECTED_RESULT_BEFORE_MODIFYING = 1;
+    const i8_z EXPECTED_RESULT = 0;
+
+    // [Execution]
+    strRightOperand.Replace("Compared", "compared");
+    i8_z nResult = SStringEqualityComparator::Compare(LEFT_OPERAND, strRightOperand);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(RESULT_BEFORE_MODIFYING, EXPECTED_RESULT_BEFORE_MODIFYING);
+    BOOST_CHECK_EQUAL(nResult, EXPECTED_RESULT);
+}
+
+// End - Test Suite: SStringEqualityComparator
+ZTEST_SUITE_END()
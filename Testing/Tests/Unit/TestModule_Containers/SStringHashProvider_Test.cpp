@@ -38,14 +38,14 @@ using namespace boost::unit_test;
 ZTEST_SUITE_BEGIN( SStringHashProvider_TestSuite )
 
 /// <summary>
-/// Checks that it returns zero when the input value is empty.
+/// Checks that it returns the expected result when the input value is empty.
 /// </summary>
-ZTEST_CASE ( GenerateHashKey_ItReturnsZeroWhenInputIsEmpty_Test )
+ZTEST_CASE ( GenerateHashKey_ItReturnsExpectedValueWhenInputIsEmpty_Test )
 {
     // [Preparation]
     const string_z INPUT_VALUE("");
     const puint_z NUMBER_OF_BUCKETS = 4;
-    const puint_z EXPECTED_VALUE = 0;
+    const puint_z EXPECTED_VALUE = 2;
 
     // [Execution]
     puint_z uHashKey = SStringHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
@@ -62,7 +62,7 @@ ZTEST_CASE ( GenerateHashKey_ItReturnsExpectedValueWhenUsingCommonInputValues_Te
     // [Preparation]
     const string_z INPUT_VALUE("A text to be used to generate a hash key");
     const puint_z NUMBER_OF_BUCKETS = 500;
-    const puint_z EXPECTED_VALUE = 229;
+    const puint_z EXPECTED_VALUE = 383;
 
     // [Execution]
     puint_z uHashKey = SStringHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
@@ -71,6 +71,26 @@ ZTEST_CASE ( GenerateHashKey_ItReturnsExpectedValueWhenUsingCommonInputValues_Te
     BOOST_CHECK_EQUAL(uHashKey, EXPECTED_VALUE);
 }
 
+/// <summary>
+/// Checks that the result does not change when the hash key of the same string is generated again or when it is generated for a copy of the string.
+/// </summary>
+ZTEST_CASE ( GenerateHashKey_ItReturnsSameValueForSameStringAndItsCopies_Test )
+{
+    // [Preparation]
+    const string_z INPUT_VALUE("A text to be used to generate a hash key");
+    const puint_z NUMBER_OF_BUCKETS = 500;
+    const puint_z EXPECTED_VALUE = SStringHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
+    const string_z COPIED_VALUE(INPUT_VALUE);
+
+    // [Execution]
+    puint_z uHashKey = SStringHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
+    puint_z uHashKeyOfCopy = SStringHashProvider::GenerateHashKey(COPIED_VALUE, NUMBER_OF_BUCKETS);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashKey, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(uHashKeyOfCopy, EXPECTED_VALUE);
+}
+
 #if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
@@ -0,0 +1,464 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/SlotMap.h"
+
+#include "CallCounter.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+using z::Test::CallCounter;
+
+
+ZTEST_SUITE_BEGIN( SlotMap_TestSuite )
+
+/// <summary>
+/// Checks that the slot map is empty after default construction.
+/// </summary>
+ZTEST_CASE ( Constructor1_SlotMapIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 0;
+
+    // [Execution]
+    SlotMap<int> slotMap;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(slotMap.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(slotMap.IsEmpty());
+}
+
+/// <summary>
+/// Checks that memory is reserved for the input number of elements.
+/// </summary>
+ZTEST_CASE ( Constructor2_CapacityIsReserved_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_CAPACITY = 8U;
+
+    // [Execution]
+    SlotMap<int> slotMap(INPUT_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK(slotMap.GetCapacity() >= INPUT_CAPACITY);
+    BOOST_CHECK(slotMap.IsEmpty());
+}
+
+/// <summary>
+/// Checks that a default handle does not identify any element.
+/// </summary>
+ZTEST_CASE ( HandleConstructor_DefaultHandleDoesNotIdentifyAnyElement_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    slotMap.Add(1);
+
+    // [Execution]
+    SlotMap<int>::Handle handle;
+
+    // [Verification]
+    BOOST_CHECK(!slotMap.Contains(handle));
+}
+
+/// <summary>
+/// Checks that the returned handle identifies the added element.
+/// </summary>
+ZTEST_CASE ( Add_ReturnedHandleIdentifiesTheElement_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    const int ELEMENT1 = 10;
+    const int ELEMENT2 = 20;
+    const puint_z EXPECTED_COUNT = 2U;
+
+    // [Execution]
+    SlotMap<int>::Handle handle1 = slotMap.Add(ELEMENT1);
+    SlotMap<int>::Handle handle2 = slotMap.Add(ELEMENT2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(slotMap.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(handle1 != handle2);
+    BOOST_CHECK_EQUAL(slotMap[handle1], ELEMENT1);
+    BOOST_CHECK_EQUAL(slotMap[handle2], ELEMENT2);
+}
+
+/// <summary>
+/// Checks that handles remain valid when the slot map grows.
+/// </summary>
+ZTEST_CASE ( Add_HandlesRemainValidWhenSlotMapGrows_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap(1U);
+    const int ELEMENT_COUNT = 100;
+    SlotMap<int>::Handle arHandles[ELEMENT_COUNT];
+
+    // [Execution]
+    for(int i = 0; i < ELEMENT_COUNT; ++i)
+        arHandles[i] = slotMap.Add(i);
+
+    // [Verification]
+    for(int i = 0; i < ELEMENT_COUNT; ++i)
+        BOOST_CHECK_EQUAL(slotMap[arHandles[i]], i);
+}
+
+/// <summary>
+/// Checks that a slot that was freed is reused, with a different generation.
+/// </summary>
+ZTEST_CASE ( Add_FreeSlotIsReusedWithDifferentGeneration_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle oldHandle = slotMap.Add(1);
+    slotMap.Remove(oldHandle);
+
+    // [Execution]
+    SlotMap<int>::Handle newHandle = slotMap.Add(2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(newHandle.GetSlot(), oldHandle.GetSlot());
+    BOOST_CHECK(newHandle.GetGeneration() != oldHandle.GetGeneration());
+    BOOST_CHECK(!slotMap.Contains(oldHandle));
+    BOOST_CHECK_EQUAL(slotMap[newHandle], 2);
+}
+
+/// <summary>
+/// Checks that the handle of the removed element is no longer valid while the others are.
+/// </summary>
+ZTEST_CASE ( Remove_OnlyTheHandleOfTheRemovedElementBecomesInvalid_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle handle1 = slotMap.Add(1);
+    SlotMap<int>::Handle handle2 = slotMap.Add(2);
+    SlotMap<int>::Handle handle3 = slotMap.Add(3);
+    const puint_z EXPECTED_COUNT = 2U;
+
+    // [Execution]
+    slotMap.Remove(handle1);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(slotMap.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(!slotMap.Contains(handle1));
+    BOOST_CHECK_EQUAL(slotMap[handle2], 2);
+    BOOST_CHECK_EQUAL(slotMap[handle3], 3);
+}
+
+/// <summary>
+/// Checks that the last element of the dense array is moved to the position of the removed element.
+/// </summary>
+ZTEST_CASE ( Remove_LastElementIsMovedToTheGap_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle handle1 = slotMap.Add(1);
+    slotMap.Add(2);
+    SlotMap<int>::Handle handle3 = slotMap.Add(3);
+
+    // [Execution]
+    slotMap.Remove(handle1);
+
+    // [Verification]
+    Span<int> values = slotMap.GetValues();
+    BOOST_CHECK_EQUAL(values[0], 3);
+    BOOST_CHECK_EQUAL(values[1], 2);
+    BOOST_CHECK(slotMap.GetHandle(0) == handle3);
+}
+
+/// <summary>
+/// Checks that the destructor of the element that was last in the dense array is called once.
+/// </summary>
+ZTEST_CASE ( Remove_DestructorIsCalledOnce_Test )
+{
+    // [Preparation]
+    SlotMap<CallCounter> slotMap;
+    SlotMap<CallCounter>::Handle handle = slotMap.Add(CallCounter());
+    slotMap.Add(CallCounter());
+    CallCounter::ResetCounters();
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 1U;
+
+    // [Execution]
+    slotMap.Remove(handle);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetDestructorCallsCount(), EXPECTED_DESTRUCTOR_CALLS);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the element was already removed.
+/// </summary>
+ZTEST_CASE ( Remove_AssertionFailsWhenHandleIsNotValid_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle handle = slotMap.Add(1);
+    slotMap.Remove(handle);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        slotMap.Remove(handle);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when getting the element of an invalid handle.
+/// </summary>
+ZTEST_CASE ( GetValue_AssertionFailsWhenHandleIsNotValid_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle handle = slotMap.Add(1);
+    slotMap.Remove(handle);
+    slotMap.Add(2);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        slotMap.GetValue(handle);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the element is replaced.
+/// </summary>
+ZTEST_CASE ( SetValue_ElementIsReplaced_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle handle = slotMap.Add(1);
+    const int EXPECTED_VALUE = 5;
+
+    // [Execution]
+    slotMap.SetValue(handle, EXPECTED_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(slotMap.GetValue(handle), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that handles of another slot map whose slots do not exist are not contained.
+/// </summary>
+ZTEST_CASE ( Contains_ReturnsFalseWhenSlotDoesNotExist_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap1;
+    SlotMap<int> slotMap2;
+    slotMap1.Add(1);
+    SlotMap<int>::Handle handle = slotMap1.Add(2);
+
+    // [Execution]
+    bool bContains = slotMap2.Contains(handle);
+
+    // [Verification]
+    BOOST_CHECK(!bContains);
+}
+
+/// <summary>
+/// Checks that a handle to a free slot is not valid, even if its generation matches the current generation of the slot.
+/// </summary>
+ZTEST_CASE ( Contains_ReturnsFalseWhenSlotIsFree_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    slotMap.Add(1);
+    SlotMap<int>::Handle removedHandle = slotMap.Add(2);
+    slotMap.Remove(removedHandle);
+    SlotMap<int>::Handle handleToFreeSlot(removedHandle.GetSlot(), removedHandle.GetGeneration() + 1U);
+
+    // [Execution]
+    bool bContains = slotMap.Contains(handleToFreeSlot);
+
+    // [Verification]
+    BOOST_CHECK(!bContains);
+}
+
+/// <summary>
+/// Checks that the span views all the elements in the dense array.
+/// </summary>
+ZTEST_CASE ( GetValues_SpanViewsAllTheElements_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    slotMap.Add(1);
+    slotMap.Add(2);
+    slotMap.Add(3);
+    const int EXPECTED_SUM = 6;
+
+    // [Execution]
+    Span<const int> values = scast_z(slotMap, const SlotMap<int>&).GetValues();
+
+    // [Verification]
+    int nSum = 0;
+
+    for(puint_z i = 0; i < values.GetCount(); ++i)
+        nSum += values[i];
+
+    BOOST_CHECK_EQUAL(values.GetCount(), slotMap.GetCount());
+    BOOST_CHECK_EQUAL(nSum, EXPECTED_SUM);
+}
+
+/// <summary>
+/// Checks that the span is empty when the slot map is empty.
+/// </summary>
+ZTEST_CASE ( GetValues_SpanIsEmptyWhenSlotMapIsEmpty_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+
+    // [Execution]
+    Span<int> values = slotMap.GetValues();
+
+    // [Verification]
+    BOOST_CHECK(values.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the handle of every position of the dense array identifies the element at that position.
+/// </summary>
+ZTEST_CASE ( GetHandle_HandleIdentifiesTheElementAtThePosition_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle handle1 = slotMap.Add(1);
+    slotMap.Add(2);
+    slotMap.Add(3);
+    slotMap.Remove(handle1);
+    slotMap.Add(4);
+
+    // [Execution]
+    for(puint_z i = 0; i < slotMap.GetCount(); ++i)
+    {
+        SlotMap<int>::Handle handle = slotMap.GetHandle(i);
+
+        // [Verification]
+        BOOST_CHECK_EQUAL(slotMap[handle], slotMap.GetValues()[i]);
+    }
+}
+
+/// <summary>
+/// Checks that no handle is valid after clearing the slot map.
+/// </summary>
+ZTEST_CASE ( Clear_HandlesBecomeInvalid_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle handle1 = slotMap.Add(1);
+    SlotMap<int>::Handle handle2 = slotMap.Add(2);
+
+    // [Execution]
+    slotMap.Clear();
+
+    // [Verification]
+    BOOST_CHECK(slotMap.IsEmpty());
+    BOOST_CHECK(!slotMap.Contains(handle1));
+    BOOST_CHECK(!slotMap.Contains(handle2));
+}
+
+/// <summary>
+/// Checks that slots are reused after clearing the slot map.
+/// </summary>
+ZTEST_CASE ( Clear_SlotsAreReused_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle oldHandle = slotMap.Add(1);
+    slotMap.Clear();
+
+    // [Execution]
+    SlotMap<int>::Handle newHandle = slotMap.Add(2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(newHandle.GetSlot(), oldHandle.GetSlot());
+    BOOST_CHECK(!slotMap.Contains(oldHandle));
+    BOOST_CHECK_EQUAL(slotMap[newHandle], 2);
+}
+
+/// <summary>
+/// Checks that handles of a slot map are valid for its copy.
+/// </summary>
+ZTEST_CASE ( CopyConstructor_HandlesAreValidForTheCopy_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap;
+    SlotMap<int>::Handle handle = slotMap.Add(1);
+
+    // [Execution]
+    SlotMap<int> copiedSlotMap(slotMap);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(copiedSlotMap[handle], 1);
+}
+
+/// <summary>
+/// Checks that handles identify the same elements in the other slot map.
+/// </summary>
+ZTEST_CASE ( Swap_HandlesIdentifyTheSameElementsInTheOtherSlotMap_Test )
+{
+    // [Preparation]
+    SlotMap<int> slotMap1;
+    SlotMap<int> slotMap2;
+    SlotMap<int>::Handle handle = slotMap1.Add(7);
+
+    // [Execution]
+    slotMap1.Swap(slotMap2);
+
+    // [Verification]
+    BOOST_CHECK(slotMap1.IsEmpty());
+    BOOST_CHECK(!slotMap1.Contains(handle));
+    BOOST_CHECK_EQUAL(slotMap2[handle], 7);
+}
+
+// End - Test Suite: SlotMap
+ZTEST_SUITE_END()
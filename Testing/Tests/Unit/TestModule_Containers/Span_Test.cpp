@@ -0,0 +1,219 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZContainers/Span.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( Span_TestSuite )
+
+/// <summary>
+/// Checks that a default span is empty and points to nothing.
+/// </summary>
+ZTEST_CASE ( Constructor1_SpanIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_COUNT = 0;
+    const int* EXPECTED_DATA = null_z;
+
+    // [Execution]
+    Span<int> span;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(span.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(span.GetData(), EXPECTED_DATA);
+    BOOST_CHECK(span.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the span views the input elements.
+/// </summary>
+ZTEST_CASE ( Constructor2_SpanViewsInputElements_Test )
+{
+    // [Preparation]
+    int arElements[] = { 1, 2, 3 };
+    const puint_z EXPECTED_COUNT = 3U;
+
+    // [Execution]
+    Span<int> span(arElements, EXPECTED_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(span.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(span.GetData(), arElements);
+    BOOST_CHECK(!span.IsEmpty());
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input pointer is null and the number of elements is not zero.
+/// </summary>
+ZTEST_CASE ( Constructor2_AssertionFailsWhenPointerIsNullAndCountIsNotZero_Test )
+{
+    // [Preparation]
+    int* pNullElements = null_z;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        Span<int> span(pNullElements, 1U);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that elements are modified through the span without copying them.
+/// </summary>
+ZTEST_CASE ( OperatorArraySubscript_ElementsAreModifiedInPlace_Test )
+{
+    // [Preparation]
+    int arElements[] = { 1, 2, 3 };
+    Span<int> span(arElements, 3U);
+    const int EXPECTED_VALUE = 7;
+
+    // [Execution]
+    span[1] = EXPECTED_VALUE;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arElements[1], EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(span[1], EXPECTED_VALUE);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the index is out of bounds.
+/// </summary>
+ZTEST_CASE ( OperatorArraySubscript_AssertionFailsWhenIndexIsOutOfBounds_Test )
+{
+    // [Preparation]
+    int arElements[] = { 1, 2, 3 };
+    Span<int> span(arElements, 3U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        span[3];
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the subspan views the expected range of elements.
+/// </summary>
+ZTEST_CASE ( GetSubspan_SubspanViewsExpectedElements_Test )
+{
+    // [Preparation]
+    int arElements[] = { 1, 2, 3, 4, 5 };
+    Span<int> span(arElements, 5U);
+    const puint_z EXPECTED_COUNT = 2U;
+    const int* EXPECTED_DATA = &arElements[2];
+
+    // [Execution]
+    Span<int> subspan = span.GetSubspan(2U, 2U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(subspan.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(subspan.GetData(), EXPECTED_DATA);
+}
+
+/// <summary>
+/// Checks that a subspan that starts at the end of the span is empty.
+/// </summary>
+ZTEST_CASE ( GetSubspan_SubspanIsEmptyWhenItStartsAtTheEnd_Test )
+{
+    // [Preparation]
+    int arElements[] = { 1, 2, 3 };
+    Span<int> span(arElements, 3U);
+
+    // [Execution]
+    Span<int> subspan = span.GetSubspan(3U, 0);
+
+    // [Verification]
+    BOOST_CHECK(subspan.IsEmpty());
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the subspan exceeds the end of the span.
+/// </summary>
+ZTEST_CASE ( GetSubspan_AssertionFailsWhenRangeIsOutOfBounds_Test )
+{
+    // [Preparation]
+    int arElements[] = { 1, 2, 3 };
+    Span<int> span(arElements, 3U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        span.GetSubspan(2U, 2U);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: Span
+ZTEST_SUITE_END()
@@ -32,6 +32,8 @@ using namespace boost::unit_test;
 
 #include "ZDiagnosis/AbstractCallStackTracePrinter.h"
 #include "ZDiagnosis/CallStackTracePlainTextFormatter.h"
+#include "ZDiagnosis/CallProfilePlainTextFormatter.h"
+#include "ZDiagnosis/CallProfileChromeTraceFormatter.h"
 #include "AbstractCallStackTracePrinterMock.h"
 
 using z::Test::AbstractCallStackTracePrinterMock;
@@ -71,6 +73,48 @@ End of call stack trace information.\n");
     BOOST_CHECK(printer.GetPrintedText() == EXPECTED_TEXT);
 }
 
+/// <summary>
+/// Checks that the header, the profile and the footer are printed.
+/// </summary>
+ZTEST_CASE ( PrintCallProfile_HeaderProfileAndFooterArePrinted_Test )
+{
+    // [Preparation]
+    AbstractCallStackTracePrinterMock printer;
+    CallProfilePlainTextFormatter formatter;
+    const string_z EXPECTED_TEXT("Call profile for ThreadId\n\
+         Calls Inclusive(ns) Exclusive(ns)   Minimum(ns)   Maximum(ns)  Function\n\
+             1           100           100           100           100  int function()\n\
+End of call profile information.\n");
+    CallProfile profile("ThreadId");
+    profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("int function()", null_z, 0, 1ULL, 100ULL, 100ULL, 100ULL, 100ULL));
+
+    // [Execution]
+    printer.PrintCallProfile(profile, formatter);
+    
+    // [Verification]
+    BOOST_CHECK(printer.GetPrintedText() == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that all the profiles are printed as a single document.
+/// </summary>
+ZTEST_CASE ( PrintCallProfiles_AllProfilesArePrintedAsSingleDocument_Test )
+{
+    // [Preparation]
+    AbstractCallStackTracePrinterMock printer;
+    CallProfileChromeTraceFormatter formatter;
+    const string_z EXPECTED_TEXT("{\"traceEvents\":[{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Thread1\"}},\n\
+{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Thread2\"}}],\"displayTimeUnit\":\"ns\"}\n");
+    ArrayDynamic<CallProfile> arProfiles;
+    arProfiles.Add(CallProfile("Thread1"));
+    arProfiles.Add(CallProfile("Thread2"));
+
+    // [Execution]
+    printer.PrintCallProfiles(arProfiles, formatter);
+    
+    // [Verification]
+    BOOST_CHECK(printer.GetPrintedText() == EXPECTED_TEXT);
+}
 
 // End - Test Suite: AbstractCallStackTracePrinter
 ZTEST_SUITE_END()
@@ -0,0 +1,152 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZDiagnosis/CallProfileChromeTraceFormatter.h"
+
+
+ZTEST_SUITE_BEGIN( CallProfileChromeTraceFormatter_TestSuite )
+
+/// <summary>
+/// Checks that the footer closes the list of events.
+/// </summary>
+ZTEST_CASE ( FormatCallProfilesFooter_FooterIsCorrectlyFormatted_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("],\"displayTimeUnit\":\"ns\"}\n");
+    CallProfileChromeTraceFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfilesFooter(strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that the header opens the list of events.
+/// </summary>
+ZTEST_CASE ( FormatCallProfilesHeader_HeaderIsCorrectlyFormatted_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("{\"traceEvents\":[");
+    CallProfileChromeTraceFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfilesHeader(strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that every call site produces a complete event and callees are placed one after another from the beginning of their caller.
+/// </summary>
+ZTEST_CASE ( FormatCallProfile_CalleesArePlacedOneAfterAnotherFromBeginningOfCaller_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"ThreadId\"}},\n\
+{\"name\":\"void Class::Parent()\",\"cat\":\"Class\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":0.000,\"dur\":1.500,\"args\":{\"calls\":1,\"exclusive_ns\":750,\"min_ns\":1500,\"max_ns\":1500}},\n\
+{\"name\":\"void Child1()\",\"cat\":\"function\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":0.000,\"dur\":0.500,\"args\":{\"calls\":2,\"exclusive_ns\":500,\"min_ns\":200,\"max_ns\":300}},\n\
+{\"name\":\"void Child2()\",\"cat\":\"function\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":0.500,\"dur\":0.250,\"args\":{\"calls\":1,\"exclusive_ns\":250,\"min_ns\":250,\"max_ns\":250}},\n\
+{\"name\":\"void Other()\",\"cat\":\"function\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":1.500,\"dur\":12.034,\"args\":{\"calls\":1,\"exclusive_ns\":12034,\"min_ns\":12034,\"max_ns\":12034}}");
+    CallProfile profile("ThreadId");
+    const puint_z PARENT = profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Class::Parent()", "Class", 0, 1ULL, 1500ULL, 750ULL, 1500ULL, 1500ULL));
+    profile.AddCallSite(PARENT, CallSiteProfile("void Child1()", null_z, 0, 2ULL, 500ULL, 500ULL, 200ULL, 300ULL));
+    profile.AddCallSite(PARENT, CallSiteProfile("void Child2()", null_z, 0, 1ULL, 250ULL, 250ULL, 250ULL, 250ULL));
+    profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Other()", null_z, 0, 1ULL, 12034ULL, 12034ULL, 12034ULL, 12034ULL));
+    CallProfileChromeTraceFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfile(profile, 0, strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that the profile index is used as thread Id and that events are separated from the ones of the previous profile.
+/// </summary>
+ZTEST_CASE ( FormatCallProfile_ProfileIndexIsUsedAsThreadId_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT(",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":3,\"args\":{\"name\":\"ThreadId\"}}");
+    const puint_z PROFILE_INDEX = 3U;
+    CallProfile profile("ThreadId");
+    CallProfileChromeTraceFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfile(profile, PROFILE_INDEX, strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that quotation marks and backslashes are escaped.
+/// </summary>
+ZTEST_CASE ( FormatCallProfile_QuotationMarksAndBackslashesAreEscaped_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"\\\\Thread\\\"\"}}");
+    CallProfile profile("\\Thread\"");
+    CallProfileChromeTraceFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfile(profile, 0, strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that the expected value is returned.
+/// </summary>
+ZTEST_CASE ( ToString_ExpectedValueIsReturned_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("CallProfileChromeTraceFormatter");
+    CallProfileChromeTraceFormatter formatter;
+
+    // [Execution]
+    string_z strResult = formatter.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+// End - Test Suite: CallProfileChromeTraceFormatter
+ZTEST_SUITE_END()
@@ -0,0 +1,135 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZDiagnosis/CallProfilePlainTextFormatter.h"
+
+
+ZTEST_SUITE_BEGIN( CallProfilePlainTextFormatter_TestSuite )
+
+/// <summary>
+/// Checks that the footer is correctly formatted.
+/// </summary>
+ZTEST_CASE ( FormatCallProfilesFooter_FooterIsCorrectlyFormatted_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("End of call profile information.\n");
+    CallProfilePlainTextFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfilesFooter(strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that the header is empty.
+/// </summary>
+ZTEST_CASE ( FormatCallProfilesHeader_HeaderIsEmpty_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("");
+    CallProfilePlainTextFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfilesHeader(strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that there is one row per function, sorted by exclusive time in descending order.
+/// </summary>
+ZTEST_CASE ( FormatCallProfile_OneRowPerFunctionSortedByExclusiveTime_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("Call profile for ThreadId\n\
+         Calls Inclusive(ns) Exclusive(ns)   Minimum(ns)   Maximum(ns)  Function\n\
+             1           100            60           100           100  void Parent()\n\
+             2            40            40            15            25  void Child()\n");
+    CallProfile profile("ThreadId");
+    profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Child()", null_z, 0, 1ULL, 15ULL, 15ULL, 15ULL, 15ULL));
+    const puint_z PARENT = profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Parent()", null_z, 0, 1ULL, 100ULL, 60ULL, 100ULL, 100ULL));
+    profile.AddCallSite(PARENT, CallSiteProfile("void Child()", null_z, 0, 1ULL, 25ULL, 25ULL, 25ULL, 25ULL));
+    CallProfilePlainTextFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfile(profile, 0, strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that the inclusive time of recursive calls is counted only once.
+/// </summary>
+ZTEST_CASE ( FormatCallProfile_InclusiveTimeOfRecursiveCallsIsCountedOnce_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("Call profile for ThreadId\n\
+         Calls Inclusive(ns) Exclusive(ns)   Minimum(ns)   Maximum(ns)  Function\n\
+             2           100           100            50           100  void Recursive()\n");
+    CallProfile profile("ThreadId");
+    const puint_z OUTERMOST = profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Recursive()", null_z, 0, 1ULL, 100ULL, 50ULL, 100ULL, 100ULL));
+    profile.AddCallSite(OUTERMOST, CallSiteProfile("void Recursive()", null_z, 0, 1ULL, 50ULL, 50ULL, 50ULL, 50ULL));
+    CallProfilePlainTextFormatter formatter;
+    string_z strResult;
+
+    // [Execution]
+    formatter.FormatCallProfile(profile, 0, strResult);
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that the expected value is returned.
+/// </summary>
+ZTEST_CASE ( ToString_ExpectedValueIsReturned_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_TEXT("CallProfilePlainTextFormatter");
+    CallProfilePlainTextFormatter formatter;
+
+    // [Execution]
+    string_z strResult = formatter.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_TEXT);
+}
+
+// End - Test Suite: CallProfilePlainTextFormatter
+ZTEST_SUITE_END()
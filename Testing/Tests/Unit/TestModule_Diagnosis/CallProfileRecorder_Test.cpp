@@ -0,0 +1,224 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZDiagnosis/CallProfileRecorder.h"
+#include "ZCommon/Exceptions/AssertException.h"
+#include "ZThreading/SThisThread.h"
+
+
+ZTEST_SUITE_BEGIN( CallProfileRecorder_TestSuite )
+
+/// <summary>
+/// Checks that the profile is empty when no call has begun.
+/// </summary>
+ZTEST_CASE ( GetProfile_ProfileIsEmptyWhenNoCallHasBegun_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_THREAD_ID("ThreadId");
+    const puint_z EXPECTED_COUNT = 0;
+    CallProfileRecorder recorder(EXPECTED_THREAD_ID);
+
+    // [Execution]
+    CallProfile profile = recorder.GetProfile();
+    
+    // [Verification]
+    BOOST_CHECK(profile.GetThreadId() == EXPECTED_THREAD_ID);
+    BOOST_CHECK_EQUAL(profile.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that nested calls produce a call tree.
+/// </summary>
+ZTEST_CASE ( EndCall_NestedCallsProduceCallTree_Test )
+{
+    // [Preparation]
+    CallProfileRecorder recorder("ThreadId");
+    const CallTrace PARENT_TRACE("void Parent()", null_z, 0);
+    const CallTrace CHILD1_TRACE("void Child1()", null_z, 0);
+    const CallTrace CHILD2_TRACE("void Child2()", null_z, 0);
+    const puint_z EXPECTED_COUNT = 3U;
+    const char* EXPECTED_SIGNATURES[] = { PARENT_TRACE.GetFunctionSignature(), CHILD1_TRACE.GetFunctionSignature(), CHILD2_TRACE.GetFunctionSignature() };
+    const unsigned int EXPECTED_DEPTHS[] = { 0, 1U, 1U };
+
+    // [Execution]
+    recorder.BeginCall(PARENT_TRACE);
+    recorder.BeginCall(CHILD1_TRACE);
+    recorder.EndCall();
+    recorder.BeginCall(CHILD2_TRACE);
+    recorder.EndCall();
+    recorder.EndCall();
+    
+    // [Verification]
+    CallProfile profile = recorder.GetProfile();
+    BOOST_CHECK_EQUAL(profile.GetCount(), EXPECTED_COUNT);
+
+    for(puint_z i = 0; i < profile.GetCount(); ++i)
+    {
+        BOOST_CHECK(profile.GetCallSite(i).GetFunctionSignature() == EXPECTED_SIGNATURES[i]);
+        BOOST_CHECK_EQUAL(profile.GetCallSite(i).GetDepth(), EXPECTED_DEPTHS[i]);
+    }
+}
+
+/// <summary>
+/// Checks that repeated calls from the same caller are accumulated in the same call site.
+/// </summary>
+ZTEST_CASE ( EndCall_RepeatedCallsAreAccumulated_Test )
+{
+    // [Preparation]
+    CallProfileRecorder recorder("ThreadId");
+    const CallTrace TRACE("void Function()", null_z, 0);
+    const puint_z EXPECTED_COUNT = 1U;
+    const u64_z EXPECTED_CALL_COUNT = 3ULL;
+
+    // [Execution]
+    for(u64_z i = 0; i < EXPECTED_CALL_COUNT; ++i)
+    {
+        recorder.BeginCall(TRACE);
+        recorder.EndCall();
+    }
+    
+    // [Verification]
+    CallProfile profile = recorder.GetProfile();
+    BOOST_CHECK_EQUAL(profile.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(profile.GetCallSite(0).GetCallCount(), EXPECTED_CALL_COUNT);
+    BOOST_CHECK(profile.GetCallSite(0).GetMinimumTime() <= profile.GetCallSite(0).GetMaximumTime());
+}
+
+/// <summary>
+/// Checks that the time spent in callees is included in the inclusive time of the caller but not in its exclusive time.
+/// </summary>
+ZTEST_CASE ( EndCall_CalleeTimeIsExcludedFromCallerExclusiveTime_Test )
+{
+    // [Preparation]
+    CallProfileRecorder recorder("ThreadId");
+    const CallTrace PARENT_TRACE("void Parent()", null_z, 0);
+    const CallTrace CHILD_TRACE("void Child()", null_z, 0);
+    const TimeSpan CHILD_DURATION(0, 0, 0, 0, 20, 0, 0);
+    const u64_z MINIMUM_CHILD_TIME = 20000000ULL; // 20 ms
+
+    // [Execution]
+    recorder.BeginCall(PARENT_TRACE);
+    recorder.BeginCall(CHILD_TRACE);
+    SThisThread::Sleep(CHILD_DURATION);
+    recorder.EndCall();
+    recorder.EndCall();
+    
+    // [Verification]
+    CallProfile profile = recorder.GetProfile();
+    const CallSiteProfile& PARENT = profile.GetCallSite(0);
+    const CallSiteProfile& CHILD = profile.GetCallSite(1);
+    BOOST_CHECK(CHILD.GetInclusiveTime() >= MINIMUM_CHILD_TIME);
+    BOOST_CHECK(PARENT.GetInclusiveTime() >= CHILD.GetInclusiveTime());
+    BOOST_CHECK_EQUAL(PARENT.GetExclusiveTime(), PARENT.GetInclusiveTime() - CHILD.GetInclusiveTime());
+}
+
+/// <summary>
+/// Checks that calls that have not ended are present in the profile but are not counted.
+/// </summary>
+ZTEST_CASE ( GetProfile_CallsThatHaveNotEndedAreNotCounted_Test )
+{
+    // [Preparation]
+    CallProfileRecorder recorder("ThreadId");
+    const CallTrace PARENT_TRACE("void Parent()", null_z, 0);
+    const CallTrace CHILD_TRACE("void Child()", null_z, 0);
+    recorder.BeginCall(PARENT_TRACE);
+    recorder.BeginCall(CHILD_TRACE);
+    recorder.EndCall();
+    const u64_z EXPECTED_PARENT_CALL_COUNT = 0;
+    const u64_z EXPECTED_CHILD_CALL_COUNT = 1ULL;
+
+    // [Execution]
+    CallProfile profile = recorder.GetProfile();
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(profile.GetCallSite(0).GetCallCount(), EXPECTED_PARENT_CALL_COUNT);
+    BOOST_CHECK_EQUAL(profile.GetCallSite(1).GetCallCount(), EXPECTED_CHILD_CALL_COUNT);
+    
+    // [Cleaning]
+    recorder.EndCall();
+}
+
+/// <summary>
+/// Checks that call sites with equal signatures stored in different strings are combined in the profile.
+/// </summary>
+ZTEST_CASE ( GetProfile_CallSitesWithEqualSignaturesAreCombined_Test )
+{
+    // [Preparation]
+    CallProfileRecorder recorder("ThreadId");
+    const char SIGNATURE1[] = "void Function()";
+    const char SIGNATURE2[] = "void Function()";
+    recorder.BeginCall(CallTrace(SIGNATURE1, null_z, 0));
+    recorder.EndCall();
+    recorder.BeginCall(CallTrace(SIGNATURE2, null_z, 0));
+    recorder.EndCall();
+    const puint_z EXPECTED_COUNT = 1U;
+    const u64_z EXPECTED_CALL_COUNT = 2ULL;
+
+    // [Execution]
+    CallProfile profile = recorder.GetProfile();
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(profile.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(profile.GetCallSite(0).GetCallCount(), EXPECTED_CALL_COUNT);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when there are no calls to end.
+/// </summary>
+ZTEST_CASE ( EndCall_AssertionFailsWhenThereAreNoCallsToEnd_Test )
+{
+    // [Preparation]
+    CallProfileRecorder recorder("ThreadId");
+    const bool ASSERTION_FAILED = true;
+
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        recorder.EndCall();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+// End - Test Suite: CallProfileRecorder
+ZTEST_SUITE_END()
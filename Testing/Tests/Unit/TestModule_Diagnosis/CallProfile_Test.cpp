@@ -0,0 +1,192 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZDiagnosis/CallProfile.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( CallProfile_TestSuite )
+
+/// <summary>
+/// Checks that input values are correctly stored.
+/// </summary>
+ZTEST_CASE ( Constructor_ValuesAreCorrectlyStored_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_THREAD_ID("ThreadId");
+    const puint_z EXPECTED_COUNT = 0;
+
+    // [Execution]
+    CallProfile profile(EXPECTED_THREAD_ID);
+    
+    // [Verification]
+    BOOST_CHECK(profile.GetThreadId() == EXPECTED_THREAD_ID);
+    BOOST_CHECK_EQUAL(profile.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that a call site without parent is added at depth zero.
+/// </summary>
+ZTEST_CASE ( AddCallSite_CallSiteWithoutParentIsAddedAtDepthZero_Test )
+{
+    // [Preparation]
+    CallProfile profile("ThreadId");
+    CallSiteProfile callSite("void Function()", null_z, 5U, 1ULL, 10ULL, 10ULL, 10ULL, 10ULL);
+    const puint_z EXPECTED_INDEX = 0;
+    const unsigned int EXPECTED_DEPTH = 0;
+
+    // [Execution]
+    puint_z uIndex = profile.AddCallSite(CallProfile::NO_PARENT, callSite);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIndex, EXPECTED_INDEX);
+    BOOST_CHECK_EQUAL(profile.GetCallSite(uIndex).GetDepth(), EXPECTED_DEPTH);
+}
+
+/// <summary>
+/// Checks that a call site is merged with an existing callee of the same parent that refers to the same function.
+/// </summary>
+ZTEST_CASE ( AddCallSite_CallSiteIsMergedWhenParentHasCalleeOfSameFunction_Test )
+{
+    // [Preparation]
+    CallProfile profile("ThreadId");
+    const puint_z PARENT = profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Parent()", null_z, 0, 1ULL, 50ULL, 30ULL, 50ULL, 50ULL));
+    profile.AddCallSite(PARENT, CallSiteProfile("void Child()", null_z, 0, 1ULL, 20ULL, 20ULL, 20ULL, 20ULL));
+    const puint_z EXPECTED_INDEX = 1U;
+    const puint_z EXPECTED_COUNT = 2U;
+    const u64_z EXPECTED_CALL_COUNT = 2ULL;
+    const u64_z EXPECTED_INCLUSIVE_TIME = 30ULL;
+
+    // [Execution]
+    puint_z uIndex = profile.AddCallSite(PARENT, CallSiteProfile("void Child()", null_z, 0, 1ULL, 10ULL, 10ULL, 10ULL, 10ULL));
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIndex, EXPECTED_INDEX);
+    BOOST_CHECK_EQUAL(profile.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(profile.GetCallSite(uIndex).GetCallCount(), EXPECTED_CALL_COUNT);
+    BOOST_CHECK_EQUAL(profile.GetCallSite(uIndex).GetInclusiveTime(), EXPECTED_INCLUSIVE_TIME);
+}
+
+/// <summary>
+/// Checks that a call site is inserted after the last descendant of its parent, moving forward the call sites that follow.
+/// </summary>
+ZTEST_CASE ( AddCallSite_CallSiteIsInsertedAfterLastDescendantOfParent_Test )
+{
+    // [Preparation]
+    CallProfile profile("ThreadId");
+    const puint_z PARENT1 = profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Parent1()", null_z, 0, 0, 0, 0, 0, 0));
+    const puint_z CHILD = profile.AddCallSite(PARENT1, CallSiteProfile("void Child()", null_z, 0, 0, 0, 0, 0, 0));
+    profile.AddCallSite(CHILD, CallSiteProfile("void GrandChild()", null_z, 0, 0, 0, 0, 0, 0));
+    profile.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Parent2()", null_z, 0, 0, 0, 0, 0, 0));
+    const puint_z EXPECTED_INDEX = 3U;
+    const unsigned int EXPECTED_DEPTH = 1U;
+    const string_z EXPECTED_SIGNATURE("void Child2()");
+    const string_z EXPECTED_LAST_SIGNATURE("void Parent2()");
+
+    // [Execution]
+    puint_z uIndex = profile.AddCallSite(PARENT1, CallSiteProfile("void Child2()", null_z, 0, 0, 0, 0, 0, 0));
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIndex, EXPECTED_INDEX);
+    BOOST_CHECK_EQUAL(profile.GetCallSite(uIndex).GetDepth(), EXPECTED_DEPTH);
+    BOOST_CHECK(string_z(profile.GetCallSite(uIndex).GetFunctionSignature()) == EXPECTED_SIGNATURE);
+    BOOST_CHECK(string_z(profile.GetCallSite(profile.GetCount() - 1U).GetFunctionSignature()) == EXPECTED_LAST_SIGNATURE);
+}
+
+/// <summary>
+/// Checks that call sites that appear in the same position of both trees are combined and the rest are added.
+/// </summary>
+ZTEST_CASE ( Merge_CommonCallSitesAreCombinedAndTheRestAreAdded_Test )
+{
+    // [Preparation]
+    CallProfile profile1("Thread1");
+    puint_z uParent = profile1.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Parent()", null_z, 0, 1ULL, 100ULL, 60ULL, 100ULL, 100ULL));
+    profile1.AddCallSite(uParent, CallSiteProfile("void Child1()", null_z, 0, 1ULL, 40ULL, 40ULL, 40ULL, 40ULL));
+
+    CallProfile profile2("Thread2");
+    uParent = profile2.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Parent()", null_z, 0, 2ULL, 300ULL, 100ULL, 100ULL, 200ULL));
+    profile2.AddCallSite(uParent, CallSiteProfile("void Child2()", null_z, 0, 1ULL, 200ULL, 200ULL, 200ULL, 200ULL));
+    profile2.AddCallSite(CallProfile::NO_PARENT, CallSiteProfile("void Other()", null_z, 0, 1ULL, 5ULL, 5ULL, 5ULL, 5ULL));
+
+    const puint_z EXPECTED_COUNT = 4U;
+    const u64_z EXPECTED_PARENT_CALL_COUNT = 3ULL;
+    const u64_z EXPECTED_PARENT_INCLUSIVE_TIME = 400ULL;
+    const string_z EXPECTED_SIGNATURES[] = { "void Parent()", "void Child1()", "void Child2()", "void Other()" };
+    const unsigned int EXPECTED_DEPTHS[] = { 0, 1U, 1U, 0 };
+
+    // [Execution]
+    profile1.Merge(profile2);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(profile1.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(profile1.GetCallSite(0).GetCallCount(), EXPECTED_PARENT_CALL_COUNT);
+    BOOST_CHECK_EQUAL(profile1.GetCallSite(0).GetInclusiveTime(), EXPECTED_PARENT_INCLUSIVE_TIME);
+
+    for(puint_z i = 0; i < profile1.GetCount(); ++i)
+    {
+        BOOST_CHECK(string_z(profile1.GetCallSite(i).GetFunctionSignature()) == EXPECTED_SIGNATURES[i]);
+        BOOST_CHECK_EQUAL(profile1.GetCallSite(i).GetDepth(), EXPECTED_DEPTHS[i]);
+    }
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the index of the parent is out of bounds.
+/// </summary>
+ZTEST_CASE ( AddCallSite_AssertionFailsWhenParentIndexIsOutOfBounds_Test )
+{
+    // [Preparation]
+    CallProfile profile("ThreadId");
+    const puint_z OUT_OF_BOUNDS_INDEX = 0;
+    const bool ASSERTION_FAILED = true;
+
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        profile.AddCallSite(OUT_OF_BOUNDS_INDEX, CallSiteProfile("void Function()", null_z, 0, 0, 0, 0, 0, 0));
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+// End - Test Suite: CallProfile
+ZTEST_SUITE_END()
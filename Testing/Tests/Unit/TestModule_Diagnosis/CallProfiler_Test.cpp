@@ -0,0 +1,177 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZDiagnosis/CallProfiler.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include "ZCommon/Delegate.h"
+
+
+ZTEST_SUITE_BEGIN( CallProfiler_TestSuite )
+
+// Signatures used by the secondary thread
+const char* THREAD_FUNCTION_SIGNATURE = "void CallProfiler_Test::ThreadFunction()";
+const char* MERGED_FUNCTION_SIGNATURE = "void CallProfiler_Test::MergedFunction()";
+
+void ThreadFunction_TestMethod()
+{
+    CallProfiler::Get()->BeginCall(CallTrace(THREAD_FUNCTION_SIGNATURE, null_z, 0));
+    CallProfiler::Get()->BeginCall(CallTrace(MERGED_FUNCTION_SIGNATURE, null_z, 0));
+    CallProfiler::Get()->EndCall();
+    CallProfiler::Get()->EndCall();
+}
+
+// Searches for the first call site of a function in a profile
+puint_z FindCallSite_TestMethod(const CallProfile &profile, const char* szFunctionSignature)
+{
+    puint_z uIndex = 0;
+
+    while(uIndex < profile.GetCount() && string_z(profile.GetCallSite(uIndex).GetFunctionSignature()) != string_z(szFunctionSignature))
+        ++uIndex;
+
+    return uIndex;
+}
+
+/// <summary>
+/// Checks that the same instance is always returned.
+/// </summary>
+ZTEST_CASE ( Get_SameInstanceIsAlwaysReturned_Test )
+{
+    // [Preparation]
+    CallProfiler* pExpectedInstance = CallProfiler::Get();
+
+    // [Execution]
+    CallProfiler* pInstance = CallProfiler::Get();
+    
+    // [Verification]
+    BOOST_CHECK(pInstance == pExpectedInstance);
+}
+
+/// <summary>
+/// Checks that the enabled state is correctly stored.
+/// </summary>
+ZTEST_CASE ( SetEnabled_ValueIsCorrectlyStored_Test )
+{
+    // [Preparation]
+    const bool ORIGINAL_VALUE = CallProfiler::Get()->IsEnabled();
+    const bool EXPECTED_VALUE = !ORIGINAL_VALUE;
+
+    // [Execution]
+    CallProfiler::Get()->SetEnabled(EXPECTED_VALUE);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallProfiler::Get()->IsEnabled(), EXPECTED_VALUE);
+
+    // [Cleaning]
+    CallProfiler::Get()->SetEnabled(ORIGINAL_VALUE);
+}
+
+/// <summary>
+/// Checks that finished calls appear in the profile of the current thread.
+/// </summary>
+ZTEST_CASE ( EndCall_CallAppearsInProfileOfCurrentThread_Test )
+{
+    // [Preparation]
+    const char* SIGNATURE = "void CallProfiler_Test::EndCall()";
+    const u64_z EXPECTED_CALL_COUNT = 1ULL;
+    const string_z EXPECTED_THREAD_ID = SThisThread::ToString();
+
+    // [Execution]
+    CallProfiler::Get()->BeginCall(CallTrace(SIGNATURE, null_z, 0));
+    CallProfiler::Get()->EndCall();
+    
+    // [Verification]
+    CallProfile profile = CallProfiler::Get()->GetProfile();
+    puint_z uCallSite = FindCallSite_TestMethod(profile, SIGNATURE);
+    BOOST_REQUIRE(uCallSite < profile.GetCount());
+    BOOST_CHECK_EQUAL(profile.GetCallSite(uCallSite).GetCallCount(), EXPECTED_CALL_COUNT);
+    BOOST_CHECK(profile.GetThreadId() == EXPECTED_THREAD_ID);
+}
+
+/// <summary>
+/// Checks that every thread gets its own profile, which is kept when the thread finishes.
+/// </summary>
+ZTEST_CASE ( GetThreadProfiles_EveryThreadHasItsOwnProfile_Test )
+{
+    // [Preparation]
+    Delegate<void()> function(&ThreadFunction_TestMethod);
+    Thread thread(function);
+    thread.Join();
+    const string_z CURRENT_THREAD_ID = SThisThread::ToString();
+
+    // [Execution]
+    ArrayDynamic<CallProfile> arProfiles = CallProfiler::Get()->GetThreadProfiles();
+    
+    // [Verification]
+    bool bThreadProfileFound = false;
+
+    for(puint_z i = 0; i < arProfiles.GetCount(); ++i)
+    {
+        if(FindCallSite_TestMethod(arProfiles[i], THREAD_FUNCTION_SIGNATURE) < arProfiles[i].GetCount())
+        {
+            bThreadProfileFound = true;
+            BOOST_CHECK(arProfiles[i].GetThreadId() != CURRENT_THREAD_ID);
+        }
+    }
+
+    BOOST_CHECK(bThreadProfileFound);
+}
+
+/// <summary>
+/// Checks that the calls of all the threads are combined when they were made from the same callers.
+/// </summary>
+ZTEST_CASE ( GetMergedProfile_CallsOfAllThreadsAreCombined_Test )
+{
+    // [Preparation]
+    CallProfile originalProfile = CallProfiler::Get()->GetMergedProfile();
+    puint_z uCallSite = FindCallSite_TestMethod(originalProfile, MERGED_FUNCTION_SIGNATURE);
+    const u64_z ORIGINAL_CALL_COUNT = uCallSite < originalProfile.GetCount() ? originalProfile.GetCallSite(uCallSite).GetCallCount() : 
+                                                                               0;
+    const u64_z EXPECTED_CALL_COUNT = ORIGINAL_CALL_COUNT + 2ULL;
+
+    Delegate<void()> function(&ThreadFunction_TestMethod);
+    Thread thread(function);
+    thread.Join();
+    ThreadFunction_TestMethod();
+
+    // [Execution]
+    CallProfile profile = CallProfiler::Get()->GetMergedProfile();
+    
+    // [Verification]
+    uCallSite = FindCallSite_TestMethod(profile, MERGED_FUNCTION_SIGNATURE);
+    BOOST_REQUIRE(uCallSite < profile.GetCount());
+    BOOST_CHECK_EQUAL(profile.GetCallSite(uCallSite).GetCallCount(), EXPECTED_CALL_COUNT);
+    BOOST_CHECK_EQUAL(profile.GetCallSite(uCallSite).GetDepth(), 1U);
+}
+
+// End - Test Suite: CallProfiler
+ZTEST_SUITE_END()
@@ -0,0 +1,178 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZDiagnosis/CallSiteProfile.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( CallSiteProfile_TestSuite )
+
+/// <summary>
+/// Checks that input values are correctly stored.
+/// </summary>
+ZTEST_CASE ( Constructor_ValuesAreCorrectlyStored_Test )
+{
+    // [Preparation]
+    const char* EXPECTED_SIGNATURE = "void Class::Function()";
+    const char* EXPECTED_CLASS = "Class";
+    const unsigned int EXPECTED_DEPTH = 2U;
+    const u64_z EXPECTED_CALL_COUNT = 3ULL;
+    const u64_z EXPECTED_INCLUSIVE_TIME = 300ULL;
+    const u64_z EXPECTED_EXCLUSIVE_TIME = 100ULL;
+    const u64_z EXPECTED_MINIMUM_TIME = 50ULL;
+    const u64_z EXPECTED_MAXIMUM_TIME = 200ULL;
+
+    // [Execution]
+    CallSiteProfile callSite(EXPECTED_SIGNATURE, EXPECTED_CLASS, EXPECTED_DEPTH, EXPECTED_CALL_COUNT, EXPECTED_INCLUSIVE_TIME, EXPECTED_EXCLUSIVE_TIME, EXPECTED_MINIMUM_TIME, EXPECTED_MAXIMUM_TIME);
+    
+    // [Verification]
+    BOOST_CHECK(callSite.GetFunctionSignature() == EXPECTED_SIGNATURE);
+    BOOST_CHECK(callSite.GetClassName() == EXPECTED_CLASS);
+    BOOST_CHECK_EQUAL(callSite.GetDepth(), EXPECTED_DEPTH);
+    BOOST_CHECK_EQUAL(callSite.GetCallCount(), EXPECTED_CALL_COUNT);
+    BOOST_CHECK_EQUAL(callSite.GetInclusiveTime(), EXPECTED_INCLUSIVE_TIME);
+    BOOST_CHECK_EQUAL(callSite.GetExclusiveTime(), EXPECTED_EXCLUSIVE_TIME);
+    BOOST_CHECK_EQUAL(callSite.GetMinimumTime(), EXPECTED_MINIMUM_TIME);
+    BOOST_CHECK_EQUAL(callSite.GetMaximumTime(), EXPECTED_MAXIMUM_TIME);
+}
+
+/// <summary>
+/// Checks that call sites whose signatures are equal are considered the same function even if they are stored in different strings.
+/// </summary>
+ZTEST_CASE ( IsSameFunction_ReturnsTrueWhenSignaturesAreEqualButStoredInDifferentStrings_Test )
+{
+    // [Preparation]
+    const char SIGNATURE1[] = "void Function()";
+    const char SIGNATURE2[] = "void Function()";
+    CallSiteProfile callSite1(SIGNATURE1, null_z, 0, 0, 0, 0, 0, 0);
+    CallSiteProfile callSite2(SIGNATURE2, null_z, 0, 0, 0, 0, 0, 0);
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    bool bResult = callSite1.IsSameFunction(callSite2);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that call sites whose signatures are equal are not considered the same function when class names are different.
+/// </summary>
+ZTEST_CASE ( IsSameFunction_ReturnsFalseWhenClassNamesAreDifferent_Test )
+{
+    // [Preparation]
+    const char* SIGNATURE = "void Function()";
+    CallSiteProfile callSite1(SIGNATURE, "Class1", 0, 0, 0, 0, 0, 0);
+    CallSiteProfile callSite2(SIGNATURE, null_z, 0, 0, 0, 0, 0, 0);
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bResult = callSite1.IsSameFunction(callSite2);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that call counts and times are added and minimum and maximum times are recalculated.
+/// </summary>
+ZTEST_CASE ( Merge_StatisticsAreCombined_Test )
+{
+    // [Preparation]
+    const char* SIGNATURE = "void Function()";
+    CallSiteProfile callSite1(SIGNATURE, null_z, 0, 2ULL, 300ULL, 100ULL, 100ULL, 200ULL);
+    CallSiteProfile callSite2(SIGNATURE, null_z, 0, 3ULL, 400ULL, 150ULL, 50ULL, 150ULL);
+    const u64_z EXPECTED_CALL_COUNT = 5ULL;
+    const u64_z EXPECTED_INCLUSIVE_TIME = 700ULL;
+    const u64_z EXPECTED_EXCLUSIVE_TIME = 250ULL;
+    const u64_z EXPECTED_MINIMUM_TIME = 50ULL;
+    const u64_z EXPECTED_MAXIMUM_TIME = 200ULL;
+
+    // [Execution]
+    callSite1.Merge(callSite2);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(callSite1.GetCallCount(), EXPECTED_CALL_COUNT);
+    BOOST_CHECK_EQUAL(callSite1.GetInclusiveTime(), EXPECTED_INCLUSIVE_TIME);
+    BOOST_CHECK_EQUAL(callSite1.GetExclusiveTime(), EXPECTED_EXCLUSIVE_TIME);
+    BOOST_CHECK_EQUAL(callSite1.GetMinimumTime(), EXPECTED_MINIMUM_TIME);
+    BOOST_CHECK_EQUAL(callSite1.GetMaximumTime(), EXPECTED_MAXIMUM_TIME);
+}
+
+/// <summary>
+/// Checks that the minimum time of a call site without calls is not taken into account.
+/// </summary>
+ZTEST_CASE ( Merge_MinimumTimeOfCallSiteWithoutCallsIsIgnored_Test )
+{
+    // [Preparation]
+    const char* SIGNATURE = "void Function()";
+    CallSiteProfile callSite1(SIGNATURE, null_z, 0, 0, 0, 0, 0, 0);
+    CallSiteProfile callSite2(SIGNATURE, null_z, 0, 1ULL, 80ULL, 80ULL, 80ULL, 80ULL);
+    const u64_z EXPECTED_MINIMUM_TIME = 80ULL;
+
+    // [Execution]
+    callSite1.Merge(callSite2);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(callSite1.GetMinimumTime(), EXPECTED_MINIMUM_TIME);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the function signature is null.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenSignatureIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        CallSiteProfile callSite(null_z, null_z, 0, 0, 0, 0, 0, 0);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+// End - Test Suite: CallSiteProfile
+ZTEST_SUITE_END()
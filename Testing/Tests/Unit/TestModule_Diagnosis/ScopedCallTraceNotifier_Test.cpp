@@ -33,6 +33,7 @@ using namespace boost::unit_test;
 #include "ZDiagnosis/ScopedCallTraceNotifier.h"
 
 #include "ZDiagnosis/CallStackTracer.h"
+#include "ZDiagnosis/CallProfiler.h"
 #include "AbstractCallStackTracePrinterMock.h"
 #include "ZDiagnosis/CallStackTracePlainTextFormatter.h"
 #include "ZCommon/DataTypes/EComparisonType.h"
@@ -112,5 +113,64 @@ ZTEST_CASE ( Destructor_TraceIsRemoved_Test )
     pPrinter->ClearPrintedText();
 }
 
+/// <summary>
+/// Checks that the call is measured by the call profiler when it is enabled.
+/// </summary>
+ZTEST_CASE ( Destructor_CallIsProfiledWhenProfilerIsEnabled_Test )
+{
+    InitializeCallStackTracer_TestMethod();
+
+    // [Preparation]
+    const char* SIGNATURE = "void ScopedCallTraceNotifier_Test::ProfiledFunction()";
+    const u64_z EXPECTED_CALL_COUNT = 1ULL;
+    CallTrace trace(SIGNATURE, null_z, 0);
+    CallProfiler::Get()->SetEnabled(true);
+
+    // [Execution]
+    {
+        ScopedCallTraceNotifier notifier(trace);
+    } // Destructor is called
+
+    // [Verification]
+    CallProfile profile = CallProfiler::Get()->GetProfile();
+    puint_z uCallSite = 0;
+
+    while(uCallSite < profile.GetCount() && profile.GetCallSite(uCallSite).GetFunctionSignature() != SIGNATURE)
+        ++uCallSite;
+
+    BOOST_REQUIRE(uCallSite < profile.GetCount());
+    BOOST_CHECK_EQUAL(profile.GetCallSite(uCallSite).GetCallCount(), EXPECTED_CALL_COUNT);
+
+    // [Cleaning]
+    CallProfiler::Get()->SetEnabled(false);
+}
+
+/// <summary>
+/// Checks that the call is not measured by the call profiler when it is disabled.
+/// </summary>
+ZTEST_CASE ( Destructor_CallIsNotProfiledWhenProfilerIsDisabled_Test )
+{
+    InitializeCallStackTracer_TestMethod();
+
+    // [Preparation]
+    const char* SIGNATURE = "void ScopedCallTraceNotifier_Test::NotProfiledFunction()";
+    CallTrace trace(SIGNATURE, null_z, 0);
+    CallProfiler::Get()->SetEnabled(false);
+
+    // [Execution]
+    {
+        ScopedCallTraceNotifier notifier(trace);
+    } // Destructor is called
+
+    // [Verification]
+    CallProfile profile = CallProfiler::Get()->GetProfile();
+    bool bCallSiteFound = false;
+
+    for(puint_z i = 0; i < profile.GetCount(); ++i)
+        bCallSiteFound = bCallSiteFound || profile.GetCallSite(i).GetFunctionSignature() == SIGNATURE;
+
+    BOOST_CHECK(!bCallSiteFound);
+}
+
 // End - Test Suite: ScopedCallTraceNotifier
 ZTEST_SUITE_END()
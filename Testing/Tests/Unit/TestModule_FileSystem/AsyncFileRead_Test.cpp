@@ -0,0 +1,226 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZFileSystem/AsyncFileRead.h"
+
+#include "ZFileSystem/FileStream.h"
+#include "ZFileSystem/Path.h"
+#include "ZThreading/AsyncTaskExecutor.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+// The base path to all the artifacts used by these tests
+static const string_z PATH_TO_ARTIFACTS("./artifacts/FileStream/");
+
+// Task that reads a file by awaiting the same read operation several times, and copies every block read to the end of a buffer
+class AsyncFileReadTestTask : public AsyncTask
+{
+public:
+
+    AsyncFileReadTestTask(AsyncFileRead &read, const char* arReadBlock, char* arContent, const puint_z uBlockSize, const puint_z uBlockCount) : 
+                                                                                                                    m_pRead(&read),
+                                                                                                                    m_arReadBlock(arReadBlock),
+                                                                                                                    m_arContent(arContent),
+                                                                                                                    m_uBlockSize(uBlockSize),
+                                                                                                                    m_uBlockCount(uBlockCount),
+                                                                                                                    m_uBlocksRead(0)
+    {
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        if(m_pRead->IsCompleted())
+        {
+            for(puint_z i = 0; i < m_uBlockSize; ++i)
+                m_arContent[m_uBlocksRead * m_uBlockSize + i] = m_arReadBlock[i];
+
+            ++m_uBlocksRead;
+        }
+
+        const bool IS_COMPLETED = m_uBlocksRead == m_uBlockCount;
+
+        if(!IS_COMPLETED)
+            this->AwaitTask(*m_pRead);
+
+        return IS_COMPLETED;
+    }
+
+public:
+
+    AsyncFileRead* m_pRead;
+    const char* m_arReadBlock;
+    char* m_arContent;
+    puint_z m_uBlockSize;
+    puint_z m_uBlockCount;
+    puint_z m_uBlocksRead;
+};
+
+
+ZTEST_SUITE_BEGIN( AsyncFileRead_TestSuite )
+
+/// <summary>
+/// Checks that the task is blocking.
+/// </summary>
+ZTEST_CASE ( Constructor_TaskIsBlocking_Test )
+{
+    // [Preparation]
+    FileStream stream(4U);
+    char arOutput[4];
+    const bool EXPECTED_IS_BLOCKING = true;
+
+    // [Execution]
+    AsyncFileRead read(stream, arOutput, 0, sizeof(arOutput));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(read.IsBlocking(), EXPECTED_IS_BLOCKING);
+    BOOST_CHECK(!read.IsCompleted());
+}
+
+/// <summary>
+/// Checks that the bytes are read from the current position of the stream and copied to the output buffer, at the offset.
+/// </summary>
+ZTEST_CASE ( Resume_BytesAreReadFromTheStream_Test )
+{
+    // [Preparation]
+    const Path FILE_PATH(PATH_TO_ARTIFACTS + "./AsyncFileRead.txt");
+    const char CONTENT[] = {'A', 'B', 'C', 'D', 'E', 'F'};
+    const char EXPECTED_OUTPUT[] = {0, 'C', 'D', 'E'};
+    const puint_z READ_POSITION = 2U;
+    const puint_z OUTPUT_OFFSET = 1U;
+    const puint_z READ_SIZE = 3U;
+    EFileSystemError errorInfo = EFileSystemError::E_Unknown;
+    FileStream stream(FILE_PATH, EFileOpenMode::E_CreateOrOverwrite, sizeof(CONTENT), errorInfo);
+    stream.Write(CONTENT, 0, sizeof(CONTENT));
+    stream.Flush();
+    stream.SetPosition(READ_POSITION);
+    char arOutput[] = {0, 0, 0, 0};
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncFileRead read(stream, arOutput, OUTPUT_OFFSET, READ_SIZE);
+
+    // [Execution]
+    executor.Submit(read);
+
+    // [Verification]
+    read.Wait();
+    BOOST_CHECK(read.IsCompleted());
+    BOOST_CHECK(memcmp(arOutput, EXPECTED_OUTPUT, sizeof(EXPECTED_OUTPUT)) == 0);
+    BOOST_CHECK_EQUAL(stream.GetPosition(), READ_POSITION + READ_SIZE);
+}
+
+/// <summary>
+/// Checks that every time the task is awaited, it reads the next block of bytes.
+/// </summary>
+ZTEST_CASE ( Resume_NextBlockIsReadEveryTimeTheTaskIsAwaited_Test )
+{
+    // [Preparation]
+    const Path FILE_PATH(PATH_TO_ARTIFACTS + "./AsyncFileRead2.txt");
+    const char CONTENT[] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H'};
+    const puint_z BLOCK_SIZE = 2U;
+    const puint_z BLOCK_COUNT = sizeof(CONTENT) / BLOCK_SIZE;
+    EFileSystemError errorInfo = EFileSystemError::E_Unknown;
+    FileStream stream(FILE_PATH, EFileOpenMode::E_CreateOrOverwrite, BLOCK_SIZE, errorInfo);
+    stream.Write(CONTENT, 0, sizeof(CONTENT));
+    stream.Flush();
+    stream.SetPosition(0);
+    char arReadBlock[BLOCK_SIZE];
+    char arContent[sizeof(CONTENT)];
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncFileRead read(stream, arReadBlock, 0, BLOCK_SIZE);
+    AsyncFileReadTestTask task(read, arReadBlock, arContent, BLOCK_SIZE, BLOCK_COUNT);
+
+    // [Execution]
+    executor.Submit(task);
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK(memcmp(arContent, CONTENT, sizeof(CONTENT)) == 0);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the output buffer is null.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenOutputBufferIsNull_Test )
+{
+    // [Preparation]
+    FileStream stream(4U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        AsyncFileRead read(stream, null_z, 0, 4U);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the number of bytes to read is zero.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenOutputSizeIsZero_Test )
+{
+    // [Preparation]
+    FileStream stream(4U);
+    char arOutput[4];
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        AsyncFileRead read(stream, arOutput, 0, 0);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: AsyncFileRead
+ZTEST_SUITE_END()
@@ -0,0 +1,152 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZFileSystem/AsyncFileWrite.h"
+
+#include "ZFileSystem/FileStream.h"
+#include "ZFileSystem/Path.h"
+#include "ZThreading/AsyncTaskExecutor.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+// The base path to all the artifacts used by these tests
+static const string_z PATH_TO_ARTIFACTS("./artifacts/FileStream/");
+
+
+ZTEST_SUITE_BEGIN( AsyncFileWrite_TestSuite )
+
+/// <summary>
+/// Checks that the task is blocking.
+/// </summary>
+ZTEST_CASE ( Constructor_TaskIsBlocking_Test )
+{
+    // [Preparation]
+    FileStream stream(4U);
+    const char INPUT[] = {'A', 'B', 'C', 'D'};
+    const bool EXPECTED_IS_BLOCKING = true;
+
+    // [Execution]
+    AsyncFileWrite write(stream, INPUT, 0, sizeof(INPUT));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(write.IsBlocking(), EXPECTED_IS_BLOCKING);
+    BOOST_CHECK(!write.IsCompleted());
+}
+
+/// <summary>
+/// Checks that the bytes of the input buffer, from the offset, are written to the file.
+/// </summary>
+ZTEST_CASE ( Resume_BytesAreWrittenToTheFile_Test )
+{
+    // [Preparation]
+    const Path FILE_PATH(PATH_TO_ARTIFACTS + "./AsyncFileWrite.txt");
+    const char INPUT[] = {'A', 'B', 'C', 'D'};
+    const char EXPECTED_CONTENT[] = {'B', 'C', 'D'};
+    const puint_z INPUT_OFFSET = 1U;
+    const puint_z WRITE_SIZE = 3U;
+    EFileSystemError errorInfo = EFileSystemError::E_Unknown;
+    FileStream stream(FILE_PATH, EFileOpenMode::E_CreateOrOverwrite, sizeof(INPUT), errorInfo);
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncFileWrite write(stream, INPUT, INPUT_OFFSET, WRITE_SIZE);
+
+    // [Execution]
+    executor.Submit(write);
+
+    // [Verification]
+    write.Wait();
+    BOOST_CHECK(write.IsCompleted());
+    stream.Close();
+
+    FileStream writtenStream(FILE_PATH, EFileOpenMode::E_Open, sizeof(INPUT), errorInfo);
+    char arContent[] = {0, 0, 0};
+    writtenStream.Read(arContent, 0, sizeof(arContent));
+    BOOST_CHECK_EQUAL(writtenStream.GetLength(), WRITE_SIZE);
+    BOOST_CHECK(memcmp(arContent, EXPECTED_CONTENT, sizeof(EXPECTED_CONTENT)) == 0);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input buffer is null.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenInputBufferIsNull_Test )
+{
+    // [Preparation]
+    FileStream stream(4U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        AsyncFileWrite write(stream, null_z, 0, 4U);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the number of bytes to write is zero.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenInputSizeIsZero_Test )
+{
+    // [Preparation]
+    FileStream stream(4U);
+    const char INPUT[] = {'A', 'B', 'C', 'D'};
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        AsyncFileWrite write(stream, INPUT, 0, 0);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: AsyncFileWrite
+ZTEST_SUITE_END()
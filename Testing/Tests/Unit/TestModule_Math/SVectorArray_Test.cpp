@@ -3779,6 +3779,264 @@ ZTEST_CASE ( Transform7_AssertionFailsWhenInputIsNull_Test )
 
 #endif // Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
+/// <summary>
+/// Checks that when using more than one point, they are all correctly transformed, including the points that do not fill a whole pack.
+/// </summary>
+ZTEST_CASE ( Transform8_MoreThanOnePointAreTransformedCorrectly_Test )
+{
+    // [Preparation]
+    const Vector3 EXPECTED_POINTS[] = {
+                                           Vector3((float_z)3.7677669529663689,  SFloat::_4,  (float_z)-8.4748737341529168),
+                                           Vector3((float_z)-8.6507958916223728, SFloat::_3,  (float_z)4.5624075439740519),
+                                           Vector3((float_z)10.662058069535208,  (float_z)4.5, (float_z)-14.308504678941933),
+                                           Vector3((float_z)3.7677669529663689,  SFloat::_4,  (float_z)-8.4748737341529168),
+                                           Vector3((float_z)-8.6507958916223728, SFloat::_3,  (float_z)4.5624075439740519),
+                                           Vector3((float_z)10.662058069535208,  (float_z)4.5, (float_z)-14.308504678941933)
+                                       };
+    const int POINTS_COUNT = sizeof(EXPECTED_POINTS) / sizeof(Vector3);
+
+    const TranslationMatrix<Matrix4x3> TRANSLATION = TranslationMatrix<Matrix4x3>(SFloat::_2, SFloat::_4, -SFloat::_6);
+#if Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_DEGREES
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_90, SAngle::_180, SAngle::_45);
+#elif Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_RADIANS
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_HalfPi, SAngle::_Pi, SAngle::_QuarterPi);
+#endif
+    const ScalingMatrix3x3 SCALE = ScalingMatrix3x3(SFloat::_0_25, SFloat::_3, -SFloat::_1);
+    const TransformationMatrix<Matrix4x3> TRANSFORMATION = TransformationMatrix<Matrix4x3>(TRANSLATION, ROTATION, SCALE);
+
+    float_z arInputX[] = { SFloat::_2, SFloat::_0_25, -SFloat::_1, SFloat::_2, SFloat::_0_25, -SFloat::_1 };
+    float_z arInputY[] = { SFloat::_1, -SFloat::_5,   SFloat::_4,  SFloat::_1, -SFloat::_5,   SFloat::_4 };
+    float_z arInputZ[] = { SFloat::_0, -SFloat::_1,   SFloat::_0_5, SFloat::_0, -SFloat::_1,   SFloat::_0_5 };
+
+	// [Execution]
+    SVectorArray::Transform(TRANSFORMATION, arInputX, arInputY, arInputZ, POINTS_COUNT);
+
+    // [Verification]
+    for(int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(Vector3(arInputX[i], arInputY[i], arInputZ[i]) == EXPECTED_POINTS[i]);
+    }
+}
+
+/// <summary>
+/// Checks that when using only one point, it's correctly transformed.
+/// </summary>
+ZTEST_CASE ( Transform8_OnlyOnePointIsTransformedCorrectly_Test )
+{
+    // [Preparation]
+    const Vector3 EXPECTED_POINT = Vector3((float_z)10.662058069535208, (float_z)4.5, (float_z)-14.308504678941933);
+    const int POINTS_COUNT = 1;
+    const TranslationMatrix<Matrix4x3> TRANSLATION = TranslationMatrix<Matrix4x3>(SFloat::_2, SFloat::_4, -SFloat::_6);
+#if Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_DEGREES
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_90, SAngle::_180, SAngle::_45);
+#elif Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_RADIANS
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_HalfPi, SAngle::_Pi, SAngle::_QuarterPi);
+#endif
+    const ScalingMatrix3x3 SCALE = ScalingMatrix3x3(SFloat::_0_25, SFloat::_3, -SFloat::_1);
+    const TransformationMatrix<Matrix4x3> TRANSFORMATION = TransformationMatrix<Matrix4x3>(TRANSLATION, ROTATION, SCALE);
+
+    float_z arInputX[] = { -SFloat::_1 };
+    float_z arInputY[] = { SFloat::_4 };
+    float_z arInputZ[] = { SFloat::_0_5 };
+
+	// [Execution]
+    SVectorArray::Transform(TRANSFORMATION, arInputX, arInputY, arInputZ, POINTS_COUNT);
+
+    // [Verification]
+    BOOST_CHECK(Vector3(arInputX[0], arInputY[0], arInputZ[0]) == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that when the number of points is zero, no work is done on input arrays.
+/// </summary>
+ZTEST_CASE ( Transform8_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const Vector3 ORIGINAL_POINT = Vector3(-SFloat::_1, SFloat::_4, SFloat::_0_5);
+    const int POINTS_COUNT = 0;
+    const TranslationMatrix<Matrix4x3> TRANSLATION = TranslationMatrix<Matrix4x3>(SFloat::_2, SFloat::_4, -SFloat::_6);
+#if Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_DEGREES
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_90, SAngle::_180, SAngle::_45);
+#elif Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_RADIANS
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_HalfPi, SAngle::_Pi, SAngle::_QuarterPi);
+#endif
+    const ScalingMatrix3x3 SCALE = ScalingMatrix3x3(SFloat::_0_25, SFloat::_3, -SFloat::_1);
+    const TransformationMatrix<Matrix4x3> TRANSFORMATION = TransformationMatrix<Matrix4x3>(TRANSLATION, ROTATION, SCALE);
+
+    float_z arInputX[] = { -SFloat::_1 };
+    float_z arInputY[] = { SFloat::_4 };
+    float_z arInputZ[] = { SFloat::_0_5 };
+
+	// [Execution]
+    SVectorArray::Transform(TRANSFORMATION, arInputX, arInputY, arInputZ, POINTS_COUNT);
+
+    // [Verification]
+    BOOST_CHECK(Vector3(arInputX[0], arInputY[0], arInputZ[0]) == ORIGINAL_POINT);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that when passing a null pointer as any of the component arrays an assertion fails.
+/// </summary>
+ZTEST_CASE ( Transform8_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const int POINTS_COUNT = 1;
+    const TransformationMatrix<Matrix4x3> TRANSFORMATION = TransformationMatrix<Matrix4x3>::GetIdentity();
+
+    float_z arInputX[] = { -SFloat::_1 };
+    float_z arInputY[] = { SFloat::_4 };
+    float_z* arNullInput = null_z;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SVectorArray::Transform(TRANSFORMATION, arInputX, arInputY, arNullInput, POINTS_COUNT);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that when using more than one point, they are all correctly transformed, including the points that do not fill a whole pack.
+/// </summary>
+ZTEST_CASE ( Transform9_MoreThanOnePointAreTransformedCorrectly_Test )
+{
+    // [Preparation]
+    const Vector3 EXPECTED_POINTS[] = {
+                                           Vector3((float_z)3.7677669529663689,  SFloat::_4,  (float_z)-8.4748737341529168),
+                                           Vector3((float_z)-8.6507958916223728, SFloat::_3,  (float_z)4.5624075439740519),
+                                           Vector3((float_z)10.662058069535208,  (float_z)4.5, (float_z)-14.308504678941933),
+                                           Vector3((float_z)3.7677669529663689,  SFloat::_4,  (float_z)-8.4748737341529168),
+                                           Vector3((float_z)-8.6507958916223728, SFloat::_3,  (float_z)4.5624075439740519),
+                                           Vector3((float_z)10.662058069535208,  (float_z)4.5, (float_z)-14.308504678941933)
+                                       };
+    const int POINTS_COUNT = sizeof(EXPECTED_POINTS) / sizeof(Vector3);
+
+    const TranslationMatrix<Matrix4x4> TRANSLATION = TranslationMatrix<Matrix4x4>(SFloat::_2, SFloat::_4, -SFloat::_6);
+#if Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_DEGREES
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_90, SAngle::_180, SAngle::_45);
+#elif Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_RADIANS
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_HalfPi, SAngle::_Pi, SAngle::_QuarterPi);
+#endif
+    const ScalingMatrix3x3 SCALE = ScalingMatrix3x3(SFloat::_0_25, SFloat::_3, -SFloat::_1);
+    const TransformationMatrix<Matrix4x4> TRANSFORMATION = TransformationMatrix<Matrix4x4>(TRANSLATION, ROTATION, SCALE);
+
+    float_z arInputX[] = { SFloat::_2, SFloat::_0_25, -SFloat::_1, SFloat::_2, SFloat::_0_25, -SFloat::_1 };
+    float_z arInputY[] = { SFloat::_1, -SFloat::_5,   SFloat::_4,  SFloat::_1, -SFloat::_5,   SFloat::_4 };
+    float_z arInputZ[] = { SFloat::_0, -SFloat::_1,   SFloat::_0_5, SFloat::_0, -SFloat::_1,   SFloat::_0_5 };
+
+	// [Execution]
+    SVectorArray::Transform(TRANSFORMATION, arInputX, arInputY, arInputZ, POINTS_COUNT);
+
+    // [Verification]
+    for(int i = 0; i < POINTS_COUNT; ++i)
+    {
+        BOOST_CHECK(Vector3(arInputX[i], arInputY[i], arInputZ[i]) == EXPECTED_POINTS[i]);
+    }
+}
+
+/// <summary>
+/// Checks that when using only one point, it's correctly transformed.
+/// </summary>
+ZTEST_CASE ( Transform9_OnlyOnePointIsTransformedCorrectly_Test )
+{
+    // [Preparation]
+    const Vector3 EXPECTED_POINT = Vector3((float_z)10.662058069535208, (float_z)4.5, (float_z)-14.308504678941933);
+    const int POINTS_COUNT = 1;
+    const TranslationMatrix<Matrix4x4> TRANSLATION = TranslationMatrix<Matrix4x4>(SFloat::_2, SFloat::_4, -SFloat::_6);
+#if Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_DEGREES
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_90, SAngle::_180, SAngle::_45);
+#elif Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_RADIANS
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_HalfPi, SAngle::_Pi, SAngle::_QuarterPi);
+#endif
+    const ScalingMatrix3x3 SCALE = ScalingMatrix3x3(SFloat::_0_25, SFloat::_3, -SFloat::_1);
+    const TransformationMatrix<Matrix4x4> TRANSFORMATION = TransformationMatrix<Matrix4x4>(TRANSLATION, ROTATION, SCALE);
+
+    float_z arInputX[] = { -SFloat::_1 };
+    float_z arInputY[] = { SFloat::_4 };
+    float_z arInputZ[] = { SFloat::_0_5 };
+
+	// [Execution]
+    SVectorArray::Transform(TRANSFORMATION, arInputX, arInputY, arInputZ, POINTS_COUNT);
+
+    // [Verification]
+    BOOST_CHECK(Vector3(arInputX[0], arInputY[0], arInputZ[0]) == EXPECTED_POINT);
+}
+
+/// <summary>
+/// Checks that when the number of points is zero, no work is done on input arrays.
+/// </summary>
+ZTEST_CASE ( Transform9_NoWorkIsDoneWhenInputNumberIsZero_Test )
+{
+    // [Preparation]
+    const Vector3 ORIGINAL_POINT = Vector3(-SFloat::_1, SFloat::_4, SFloat::_0_5);
+    const int POINTS_COUNT = 0;
+    const TranslationMatrix<Matrix4x4> TRANSLATION = TranslationMatrix<Matrix4x4>(SFloat::_2, SFloat::_4, -SFloat::_6);
+#if Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_DEGREES
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_90, SAngle::_180, SAngle::_45);
+#elif Z_CONFIG_ANGLENOTATION_DEFAULT == Z_CONFIG_ANGLENOTATION_RADIANS
+    const RotationMatrix3x3 ROTATION = RotationMatrix3x3(SAngle::_HalfPi, SAngle::_Pi, SAngle::_QuarterPi);
+#endif
+    const ScalingMatrix3x3 SCALE = ScalingMatrix3x3(SFloat::_0_25, SFloat::_3, -SFloat::_1);
+    const TransformationMatrix<Matrix4x4> TRANSFORMATION = TransformationMatrix<Matrix4x4>(TRANSLATION, ROTATION, SCALE);
+
+    float_z arInputX[] = { -SFloat::_1 };
+    float_z arInputY[] = { SFloat::_4 };
+    float_z arInputZ[] = { SFloat::_0_5 };
+
+	// [Execution]
+    SVectorArray::Transform(TRANSFORMATION, arInputX, arInputY, arInputZ, POINTS_COUNT);
+
+    // [Verification]
+    BOOST_CHECK(Vector3(arInputX[0], arInputY[0], arInputZ[0]) == ORIGINAL_POINT);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that when passing a null pointer as any of the component arrays an assertion fails.
+/// </summary>
+ZTEST_CASE ( Transform9_AssertionFailsWhenInputIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const int POINTS_COUNT = 1;
+    const TransformationMatrix<Matrix4x4> TRANSFORMATION = TransformationMatrix<Matrix4x4>::GetIdentity();
+
+    float_z arInputX[] = { -SFloat::_1 };
+    float_z arInputY[] = { SFloat::_4 };
+    float_z* arNullInput = null_z;
+
+	// [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SVectorArray::Transform(TRANSFORMATION, arInputX, arInputY, arNullInput, POINTS_COUNT);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
 /// <summary>
 /// Checks that when using more than one point, they are all correctly transformed.
 /// </summary>
@@ -0,0 +1,242 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZMemory/ContiguousAllocator.h"
+
+
+ZTEST_SUITE_BEGIN( ContiguousAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the buffer has the requested size and no blocks are allocated.
+/// </summary>
+ZTEST_CASE ( Constructor_BufferHasRequestedSizeAndIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_POOL_SIZE = sizeof(u32_z) * 4U;
+    const puint_z EXPECTED_ALLOCATED_BYTES = 0;
+
+    // [Execution]
+    ContiguousAllocator allocator(EXPECTED_POOL_SIZE, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(allocator.GetPointer() != null_z);
+    BOOST_CHECK(allocator.CanAllocate());
+}
+
+/// <summary>
+/// Checks that the buffer is aligned as requested.
+/// </summary>
+ZTEST_CASE ( Constructor_BufferIsAligned_Test )
+{
+    // [Preparation]
+    const puint_z ALIGNMENT = 64U;
+
+    // [Execution]
+    ContiguousAllocator allocator(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(ALIGNMENT));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(rcast_z(allocator.GetPointer(), puint_z) & (ALIGNMENT - 1U), 0U);
+    BOOST_CHECK_EQUAL(scast_z(allocator.GetAlignment(), puint_z), ALIGNMENT);
+}
+
+/// <summary>
+/// Checks that allocated blocks are consecutive, starting at the beginning of the buffer.
+/// </summary>
+ZTEST_CASE ( Allocate_ReturnsConsecutiveBlocks_Test )
+{
+    // [Preparation]
+    ContiguousAllocator allocator(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    u32_z* pFirst = scast_z(allocator.GetPointer(), u32_z*);
+    const puint_z EXPECTED_ALLOCATED_BYTES = sizeof(u32_z) * 2U;
+
+    // [Execution]
+    void* pBlock1 = allocator.Allocate();
+    void* pBlock2 = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pBlock1, pFirst);
+    BOOST_CHECK_EQUAL(pBlock2, pFirst + 1);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that it returns null when the buffer is full.
+/// </summary>
+ZTEST_CASE ( Allocate_ReturnsNullWhenBufferIsFull_Test )
+{
+    // [Preparation]
+    ContiguousAllocator allocator(sizeof(u32_z) * 2U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    allocator.Allocate();
+    allocator.Allocate();
+
+    // [Execution]
+    void* pBlock = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK(pBlock == null_z);
+    BOOST_CHECK(!allocator.CanAllocate());
+}
+
+/// <summary>
+/// Checks that the last block is released and allocated again by the next allocation.
+/// </summary>
+ZTEST_CASE ( Deallocate_LastBlockIsReleased_Test )
+{
+    // [Preparation]
+    ContiguousAllocator allocator(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    allocator.Allocate();
+    void* pLastBlock = allocator.Allocate();
+    const puint_z EXPECTED_ALLOCATED_BYTES = sizeof(u32_z);
+
+    // [Execution]
+    allocator.Deallocate(pLastBlock);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), pLastBlock);
+}
+
+/// <summary>
+/// Checks that all the blocks are released.
+/// </summary>
+ZTEST_CASE ( Clear_AllBlocksAreReleased_Test )
+{
+    // [Preparation]
+    ContiguousAllocator allocator(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    allocator.Allocate();
+    allocator.Allocate();
+    const puint_z EXPECTED_ALLOCATED_BYTES = 0;
+
+    // [Execution]
+    allocator.Clear();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), allocator.GetPointer());
+}
+
+/// <summary>
+/// Checks that the allocated blocks keep their content when the buffer grows.
+/// </summary>
+ZTEST_CASE ( Reallocate_BlocksKeepTheirContent_Test )
+{
+    // [Preparation]
+    ContiguousAllocator allocator(sizeof(u32_z) * 2U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    *scast_z(allocator.Allocate(), u32_z*) = 10U;
+    *scast_z(allocator.Allocate(), u32_z*) = 20U;
+    const puint_z EXPECTED_POOL_SIZE = sizeof(u32_z) * 4U;
+    const puint_z EXPECTED_ALLOCATED_BYTES = sizeof(u32_z) * 2U;
+
+    // [Execution]
+    allocator.Reallocate(EXPECTED_POOL_SIZE);
+
+    // [Verification]
+    u32_z* pFirst = scast_z(allocator.GetPointer(), u32_z*);
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(pFirst[0], 10U);
+    BOOST_CHECK_EQUAL(pFirst[1], 20U);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), pFirst + 2);
+}
+
+/// <summary>
+/// Checks that the buffer keeps its alignment when it grows, even when the alignment is greater than the default alignment of the heap.
+/// </summary>
+ZTEST_CASE ( Reallocate_BufferKeepsItsAlignment_Test )
+{
+    // [Preparation]
+    const puint_z ALIGNMENT = 64U;
+    const puint_z BIG_SIZE = 1024U * 1024U;
+    ContiguousAllocator allocator(ALIGNMENT, ALIGNMENT, Alignment(ALIGNMENT));
+    *scast_z(allocator.Allocate(), u32_z*) = 10U;
+
+    // [Execution]
+    allocator.Reallocate(BIG_SIZE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(rcast_z(allocator.GetPointer(), puint_z) & (ALIGNMENT - 1U), 0U);
+    BOOST_CHECK_EQUAL(*scast_z(allocator.GetPointer(), u32_z*), 10U);
+}
+
+/// <summary>
+/// Checks that the allocated blocks are copied to the other allocator.
+/// </summary>
+ZTEST_CASE ( CopyTo_BlocksAreCopied_Test )
+{
+    // [Preparation]
+    ContiguousAllocator source(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    *scast_z(source.Allocate(), u32_z*) = 10U;
+    *scast_z(source.Allocate(), u32_z*) = 20U;
+    ContiguousAllocator destination(sizeof(u32_z) * 8U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    destination.Allocate();
+
+    // [Execution]
+    source.CopyTo(destination);
+
+    // [Verification]
+    u32_z* pFirst = scast_z(destination.GetPointer(), u32_z*);
+    BOOST_CHECK_EQUAL(destination.GetAllocatedBytes(), source.GetAllocatedBytes());
+    BOOST_CHECK_EQUAL(pFirst[0], 10U);
+    BOOST_CHECK_EQUAL(pFirst[1], 20U);
+}
+
+/// <summary>
+/// Checks that the buffers and the allocated blocks of both allocators are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap_BuffersAreExchanged_Test )
+{
+    // [Preparation]
+    ContiguousAllocator allocatorA(sizeof(u32_z) * 2U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    allocatorA.Allocate();
+    ContiguousAllocator allocatorB(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    allocatorB.Allocate();
+    allocatorB.Allocate();
+    void* pBufferA = allocatorA.GetPointer();
+    void* pBufferB = allocatorB.GetPointer();
+
+    // [Execution]
+    allocatorA.Swap(allocatorB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocatorA.GetPointer(), pBufferB);
+    BOOST_CHECK_EQUAL(allocatorB.GetPointer(), pBufferA);
+    BOOST_CHECK_EQUAL(allocatorA.GetPoolSize(), sizeof(u32_z) * 4U);
+    BOOST_CHECK_EQUAL(allocatorB.GetPoolSize(), sizeof(u32_z) * 2U);
+    BOOST_CHECK_EQUAL(allocatorA.GetAllocatedBytes(), sizeof(u32_z) * 2U);
+    BOOST_CHECK_EQUAL(allocatorB.GetAllocatedBytes(), sizeof(u32_z));
+}
+
+// End - Test Suite: ContiguousAllocator
+ZTEST_SUITE_END()
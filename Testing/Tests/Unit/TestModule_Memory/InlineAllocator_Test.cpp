@@ -0,0 +1,292 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZMemory/InlineAllocator.h"
+
+
+ZTEST_SUITE_BEGIN( InlineAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the internal buffer is used when the requested size fits in it, and that the size of the buffer is the size of the internal buffer.
+/// </summary>
+ZTEST_CASE ( Constructor_UsesInternalBufferWhenSizeFits_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_POOL_SIZE = sizeof(u32_z) * 4U;
+    const puint_z EXPECTED_ALLOCATED_BYTES = 0;
+
+    // [Execution]
+    InlineAllocator<u32_z, 4U> allocator(sizeof(u32_z), sizeof(u32_z), Alignment(alignof_z(u32_z)));
+
+    // [Verification]
+    BOOST_CHECK(allocator.IsInline());
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(allocator.CanAllocate());
+}
+
+/// <summary>
+/// Checks that the buffer is allocated in the heap when the requested size does not fit in the internal buffer.
+/// </summary>
+ZTEST_CASE ( Constructor_UsesHeapWhenSizeDoesNotFit_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_POOL_SIZE = sizeof(u32_z) * 6U;
+
+    // [Execution]
+    InlineAllocator<u32_z, 4U> allocator(EXPECTED_POOL_SIZE, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+
+    // [Verification]
+    BOOST_CHECK(!allocator.IsInline());
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+}
+
+/// <summary>
+/// Checks that the buffer is allocated in the heap when the requested alignment is greater than the alignment of the internal buffer.
+/// </summary>
+ZTEST_CASE ( Constructor_UsesHeapWhenAlignmentIsGreaterThanElementAlignment_Test )
+{
+    // [Preparation]
+    const Alignment ALIGNMENT(64U);
+
+    // [Execution]
+    InlineAllocator<u32_z, 4U> allocator(sizeof(u32_z), sizeof(u32_z), ALIGNMENT);
+
+    // [Verification]
+    BOOST_CHECK(!allocator.IsInline());
+    BOOST_CHECK_EQUAL(rcast_z(allocator.GetPointer(), puint_z) & (64U - 1U), 0U);
+}
+
+/// <summary>
+/// Checks that allocated blocks are consecutive, starting at the beginning of the buffer.
+/// </summary>
+ZTEST_CASE ( Allocate_ReturnsConsecutiveBlocks_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 4U> allocator(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    u32_z* pFirst = scast_z(allocator.GetPointer(), u32_z*);
+    const puint_z EXPECTED_ALLOCATED_BYTES = sizeof(u32_z) * 2U;
+
+    // [Execution]
+    void* pBlock1 = allocator.Allocate();
+    void* pBlock2 = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pBlock1, pFirst);
+    BOOST_CHECK_EQUAL(pBlock2, pFirst + 1);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that it returns null when the buffer is full.
+/// </summary>
+ZTEST_CASE ( Allocate_ReturnsNullWhenBufferIsFull_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 2U> allocator(sizeof(u32_z) * 2U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    allocator.Allocate();
+    allocator.Allocate();
+
+    // [Execution]
+    void* pBlock = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK(pBlock == null_z);
+    BOOST_CHECK(!allocator.CanAllocate());
+}
+
+/// <summary>
+/// Checks that the last block is released and allocated again by the next allocation.
+/// </summary>
+ZTEST_CASE ( Deallocate_LastBlockIsReleased_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 4U> allocator(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    allocator.Allocate();
+    void* pLastBlock = allocator.Allocate();
+    const puint_z EXPECTED_ALLOCATED_BYTES = sizeof(u32_z);
+
+    // [Execution]
+    allocator.Deallocate(pLastBlock);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), pLastBlock);
+}
+
+/// <summary>
+/// Checks that all the blocks are released.
+/// </summary>
+ZTEST_CASE ( Clear_AllBlocksAreReleased_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 4U> allocator(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    allocator.Allocate();
+    allocator.Allocate();
+    const puint_z EXPECTED_ALLOCATED_BYTES = 0;
+
+    // [Execution]
+    allocator.Clear();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), allocator.GetPointer());
+}
+
+/// <summary>
+/// Checks that the blocks are moved to the heap, keeping their content, when the internal buffer is too small.
+/// </summary>
+ZTEST_CASE ( Reallocate_BlocksAreMovedToHeap_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 2U> allocator(sizeof(u32_z) * 2U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    *scast_z(allocator.Allocate(), u32_z*) = 10U;
+    *scast_z(allocator.Allocate(), u32_z*) = 20U;
+    const puint_z EXPECTED_POOL_SIZE = sizeof(u32_z) * 4U;
+    const puint_z EXPECTED_ALLOCATED_BYTES = sizeof(u32_z) * 2U;
+
+    // [Execution]
+    allocator.Reallocate(EXPECTED_POOL_SIZE);
+
+    // [Verification]
+    u32_z* pFirst = scast_z(allocator.GetPointer(), u32_z*);
+    BOOST_CHECK(!allocator.IsInline());
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(pFirst[0], 10U);
+    BOOST_CHECK_EQUAL(pFirst[1], 20U);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), pFirst + 2);
+}
+
+/// <summary>
+/// Checks that the blocks keep their content when the buffer was already in the heap.
+/// </summary>
+ZTEST_CASE ( Reallocate_BlocksAreCopiedWhenBufferIsInHeap_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 1U> allocator(sizeof(u32_z) * 2U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    *scast_z(allocator.Allocate(), u32_z*) = 10U;
+    *scast_z(allocator.Allocate(), u32_z*) = 20U;
+    const puint_z EXPECTED_POOL_SIZE = sizeof(u32_z) * 4U;
+
+    // [Execution]
+    allocator.Reallocate(EXPECTED_POOL_SIZE);
+
+    // [Verification]
+    u32_z* pFirst = scast_z(allocator.GetPointer(), u32_z*);
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(pFirst[0], 10U);
+    BOOST_CHECK_EQUAL(pFirst[1], 20U);
+}
+
+/// <summary>
+/// Checks that the allocated blocks are copied to the other allocator.
+/// </summary>
+ZTEST_CASE ( CopyTo_BlocksAreCopied_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 4U> source(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    *scast_z(source.Allocate(), u32_z*) = 10U;
+    *scast_z(source.Allocate(), u32_z*) = 20U;
+    InlineAllocator<u32_z, 4U> destination(sizeof(u32_z) * 8U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    destination.Allocate();
+
+    // [Execution]
+    source.CopyTo(destination);
+
+    // [Verification]
+    u32_z* pFirst = scast_z(destination.GetPointer(), u32_z*);
+    BOOST_CHECK_EQUAL(destination.GetAllocatedBytes(), source.GetAllocatedBytes());
+    BOOST_CHECK_EQUAL(pFirst[0], 10U);
+    BOOST_CHECK_EQUAL(pFirst[1], 20U);
+}
+
+/// <summary>
+/// Checks that the blocks stored in the internal buffers of two allocators are exchanged.
+/// </summary>
+ZTEST_CASE ( Swap_BlocksInInternalBuffersAreExchanged_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 4U> allocatorA(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    *scast_z(allocatorA.Allocate(), u32_z*) = 10U;
+    InlineAllocator<u32_z, 4U> allocatorB(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    *scast_z(allocatorB.Allocate(), u32_z*) = 20U;
+    *scast_z(allocatorB.Allocate(), u32_z*) = 30U;
+
+    // [Execution]
+    allocatorA.Swap(allocatorB);
+
+    // [Verification]
+    u32_z* pFirstA = scast_z(allocatorA.GetPointer(), u32_z*);
+    u32_z* pFirstB = scast_z(allocatorB.GetPointer(), u32_z*);
+    BOOST_CHECK(allocatorA.IsInline());
+    BOOST_CHECK(allocatorB.IsInline());
+    BOOST_CHECK_EQUAL(allocatorA.GetAllocatedBytes(), sizeof(u32_z) * 2U);
+    BOOST_CHECK_EQUAL(allocatorB.GetAllocatedBytes(), sizeof(u32_z));
+    BOOST_CHECK_EQUAL(pFirstA[0], 20U);
+    BOOST_CHECK_EQUAL(pFirstA[1], 30U);
+    BOOST_CHECK_EQUAL(pFirstB[0], 10U);
+}
+
+/// <summary>
+/// Checks that the blocks of an allocator that uses the internal buffer are exchanged with the blocks of an allocator that uses the heap.
+/// </summary>
+ZTEST_CASE ( Swap_BlocksInInternalBufferAndHeapAreExchanged_Test )
+{
+    // [Preparation]
+    InlineAllocator<u32_z, 2U> allocatorA(sizeof(u32_z) * 2U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    *scast_z(allocatorA.Allocate(), u32_z*) = 10U;
+    InlineAllocator<u32_z, 2U> allocatorB(sizeof(u32_z) * 4U, sizeof(u32_z), Alignment(alignof_z(u32_z)));
+    void* pHeapBufferB = allocatorB.GetPointer();
+    *scast_z(allocatorB.Allocate(), u32_z*) = 20U;
+    *scast_z(allocatorB.Allocate(), u32_z*) = 30U;
+    *scast_z(allocatorB.Allocate(), u32_z*) = 40U;
+
+    // [Execution]
+    allocatorA.Swap(allocatorB);
+
+    // [Verification]
+    u32_z* pFirstA = scast_z(allocatorA.GetPointer(), u32_z*);
+    u32_z* pFirstB = scast_z(allocatorB.GetPointer(), u32_z*);
+    BOOST_CHECK(!allocatorA.IsInline());
+    BOOST_CHECK(allocatorB.IsInline());
+    BOOST_CHECK_EQUAL(allocatorA.GetPointer(), pHeapBufferB);
+    BOOST_CHECK_EQUAL(allocatorA.GetPoolSize(), sizeof(u32_z) * 4U);
+    BOOST_CHECK_EQUAL(allocatorB.GetPoolSize(), sizeof(u32_z) * 2U);
+    BOOST_CHECK_EQUAL(pFirstA[0], 20U);
+    BOOST_CHECK_EQUAL(pFirstA[2], 40U);
+    BOOST_CHECK_EQUAL(pFirstB[0], 10U);
+}
+
+// End - Test Suite: InlineAllocator
+ZTEST_SUITE_END()
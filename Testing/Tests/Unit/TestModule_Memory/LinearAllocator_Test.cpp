@@ -396,6 +396,72 @@ ZTEST_CASE ( Constructor3_AssertionFailsWhenInputBufferIsNull_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the size of the constructed allocator equals the size that was used in the constructor when the memory is placed in the local NUMA node.
+/// </summary>
+ZTEST_CASE ( Constructor4_SizeOfAllocatorIsEqualToSizeUsedAsParameterWhenPlacementIsLocalNumaNode_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_SIZE = 4096U;
+    const Alignment INPUT_ALIGNMENT(64U);
+    const EMemoryPlacement INPUT_PLACEMENT = EMemoryPlacement::E_LocalNumaNode;
+
+    // [Execution]
+    LinearAllocator allocator(EXPECTED_SIZE, INPUT_ALIGNMENT, INPUT_PLACEMENT);
+
+    // [Verification]
+    puint_z uSize = allocator.GetSize();
+    BOOST_CHECK_EQUAL(uSize, EXPECTED_SIZE);
+}
+
+/// <summary>
+/// Checks that the buffer is aligned as intended when the memory is placed in the local NUMA node.
+/// </summary>
+ZTEST_CASE ( Constructor4_BufferIsAlignedWhenPlacementIsLocalNumaNode_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_SIZE = 4096U;
+    const Alignment INPUT_ALIGNMENT(128U);
+    const EMemoryPlacement INPUT_PLACEMENT = EMemoryPlacement::E_LocalNumaNode;
+    const puint_z EXPECTED_OFFSET = 0;
+
+    // [Execution]
+    LinearAllocator allocator(INPUT_SIZE, INPUT_ALIGNMENT, INPUT_PLACEMENT);
+
+    // [Verification]
+    void* pBuffer = allocator.GetPointer();
+    BOOST_CHECK(pBuffer != null_z);
+    BOOST_CHECK_EQUAL((puint_z)pBuffer & (INPUT_ALIGNMENT - 1U), EXPECTED_OFFSET);
+}
+
+/// <summary>
+/// Checks that contents are kept after a reallocation when the memory is placed in the local NUMA node.
+/// </summary>
+ZTEST_CASE ( Constructor4_ContentsAreTheSameAfterReallocationWhenPlacementIsLocalNumaNode_Test )
+{
+    // [Preparation]
+    const bool ARE_EQUAL = true;
+    LinearAllocator allocator(12U, Alignment(4U), EMemoryPlacement::E_LocalNumaNode);
+
+    for(int i = 1; i < 4; ++i)
+        *scast_z(allocator.Allocate(4U), i32_z*) = i;
+
+    const puint_z NEW_SIZE = 16U;
+
+    // [Execution]
+    allocator.Reallocate(NEW_SIZE);
+
+    // [Verification]
+    int* pBuffer = scast_z(allocator.GetPointer(), int*);
+
+    bool bAreEqual = true;
+
+    for(int i = 1; i < 4; ++i, ++pBuffer)
+        bAreEqual = bAreEqual && *pBuffer == i;
+
+    BOOST_CHECK_EQUAL(bAreEqual, ARE_EQUAL);
+}
+
 /// <summary>
 /// Checks that a valid memory address is returned when using a common input size and an empty allocator.
 /// </summary>
@@ -716,6 +782,100 @@ ZTEST_CASE ( Allocate2_ReturnsNullWhenTheAllocatorIsFull_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the memory blocks allocated after the mark are deallocated.
+/// </summary>
+ZTEST_CASE ( Deallocate_BlocksAllocatedAfterMarkAreDeallocated_Test )
+{
+    // [Preparation]
+    const Alignment INPUT_ALIGNMENT(4U);
+    LinearAllocator allocator(16U, INPUT_ALIGNMENT);
+    allocator.Allocate(4U);
+    const LinearAllocator::Mark MARK = allocator.GetMark();
+    allocator.Allocate(4U);
+    allocator.Allocate(4U);
+    const puint_z EXPECTED_ALLOCATED_BYTES = 4U;
+
+    // [Execution]
+    allocator.Deallocate(MARK);
+
+    // [Verification]
+    puint_z uAllocatedBytes = allocator.GetAllocatedBytes();
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that allocations start at the position of the mark after deallocating.
+/// </summary>
+ZTEST_CASE ( Deallocate_AllocationsStartAtMarkAfterDeallocating_Test )
+{
+    // [Preparation]
+    const Alignment INPUT_ALIGNMENT(4U);
+    LinearAllocator allocator(16U, INPUT_ALIGNMENT);
+    allocator.Allocate(4U);
+    const LinearAllocator::Mark MARK = allocator.GetMark();
+    void* pExpectedAddress = allocator.Allocate(8U);
+
+    // [Execution]
+    allocator.Deallocate(MARK);
+
+    // [Verification]
+    void* pAddress = allocator.Allocate(8U);
+    BOOST_CHECK_EQUAL(pAddress, pExpectedAddress);
+}
+
+/// <summary>
+/// Checks that nothing changes when the mark points to the current position.
+/// </summary>
+ZTEST_CASE ( Deallocate_NothingChangesWhenMarkPointsToCurrentPosition_Test )
+{
+    // [Preparation]
+    const Alignment INPUT_ALIGNMENT(4U);
+    LinearAllocator allocator(16U, INPUT_ALIGNMENT);
+    allocator.Allocate(4U);
+    const puint_z EXPECTED_ALLOCATED_BYTES = allocator.GetAllocatedBytes();
+
+    // [Execution]
+    allocator.Deallocate(allocator.GetMark());
+
+    // [Verification]
+    puint_z uAllocatedBytes = allocator.GetAllocatedBytes();
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the mark points to a position after the current one.
+/// </summary>
+ZTEST_CASE ( Deallocate_AssertionFailsWhenMarkPointsAfterCurrentPosition_Test )
+{
+    // [Preparation]
+    const Alignment INPUT_ALIGNMENT(4U);
+    LinearAllocator allocator(16U, INPUT_ALIGNMENT);
+    allocator.Allocate(8U);
+    const LinearAllocator::Mark MARK = allocator.GetMark();
+    allocator.Clear();
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Deallocate(MARK);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
 /// <summary>
 /// Checks that nothing changes when the allocator was already empty.
 /// </summary>
@@ -1647,5 +1807,40 @@ ZTEST_CASE ( GetSize_NotNecessaryToTest_Test )
     BOOST_TEST_MESSAGE("It is not necessary to test this method since it is just a getter");
 }
 
+/// <summary>
+/// Checks that the mark points to the beginning of the buffer when the allocator is empty.
+/// </summary>
+ZTEST_CASE ( GetMark_PointsToBeginningOfBufferWhenAllocatorIsEmpty_Test )
+{
+    // [Preparation]
+    const Alignment INPUT_ALIGNMENT(4U);
+    LinearAllocator allocator(16U, INPUT_ALIGNMENT);
+    void* pExpectedAddress = allocator.GetPointer();
+
+    // [Execution]
+    LinearAllocator::Mark mark = allocator.GetMark();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(mark.GetMemoryAddress(), pExpectedAddress);
+}
+
+/// <summary>
+/// Checks that the mark points to the position right after the last allocated block.
+/// </summary>
+ZTEST_CASE ( GetMark_PointsToPositionAfterLastAllocatedBlock_Test )
+{
+    // [Preparation]
+    const Alignment INPUT_ALIGNMENT(4U);
+    LinearAllocator allocator(16U, INPUT_ALIGNMENT);
+    void* pLastBlock = allocator.Allocate(4U);
+    void* pExpectedAddress = (void*)((puint_z)pLastBlock + 4U);
+
+    // [Execution]
+    LinearAllocator::Mark mark = allocator.GetMark();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(mark.GetMemoryAddress(), pExpectedAddress);
+}
+
 // End - Test Suite: LinearAllocator
 ZTEST_SUITE_END()
@@ -0,0 +1,255 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZMemory/ObjectPool.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+
+// Class whose instances count how many times they are constructed and destroyed
+class ObjectPoolTestClass
+{
+public:
+
+    ObjectPoolTestClass() : m_nFirst(0), m_nSecond(0)
+    {
+        ++sm_uConstructorCalls;
+    }
+
+    explicit ObjectPoolTestClass(const int nFirst) : m_nFirst(nFirst), m_nSecond(0)
+    {
+        ++sm_uConstructorCalls;
+    }
+
+    ObjectPoolTestClass(const int nFirst, const int nSecond) : m_nFirst(nFirst), m_nSecond(nSecond)
+    {
+        ++sm_uConstructorCalls;
+    }
+
+    ~ObjectPoolTestClass()
+    {
+        ++sm_uDestructorCalls;
+    }
+
+    static void Reset()
+    {
+        sm_uConstructorCalls = 0;
+        sm_uDestructorCalls = 0;
+    }
+
+    int m_nFirst;
+    int m_nSecond;
+
+    static unsigned int sm_uConstructorCalls;
+    static unsigned int sm_uDestructorCalls;
+};
+
+unsigned int ObjectPoolTestClass::sm_uConstructorCalls = 0;
+unsigned int ObjectPoolTestClass::sm_uDestructorCalls = 0;
+
+
+ZTEST_SUITE_BEGIN( ObjectPool_TestSuite )
+
+/// <summary>
+/// Checks that the capacity equals the capacity passed to the constructor and no objects are borrowed.
+/// </summary>
+ZTEST_CASE ( Constructor_CapacityIsCorrectAndPoolIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_CAPACITY = 4U;
+    const puint_z EXPECTED_BORROWED_COUNT = 0;
+
+    // [Execution]
+    ObjectPool<ObjectPoolTestClass> pool(EXPECTED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pool.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(pool.GetBorrowedCount(), EXPECTED_BORROWED_COUNT);
+}
+
+/// <summary>
+/// Checks that the borrowed object is constructed with the default constructor.
+/// </summary>
+ZTEST_CASE ( Borrow1_ObjectIsDefaultConstructed_Test )
+{
+    // [Preparation]
+    ObjectPoolTestClass::Reset();
+    ObjectPool<ObjectPoolTestClass> pool(2U);
+    const unsigned int EXPECTED_CONSTRUCTOR_CALLS = 1U;
+    const puint_z EXPECTED_BORROWED_COUNT = 1U;
+
+    // [Execution]
+    ObjectPoolTestClass* pObject = pool.Borrow();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(ObjectPoolTestClass::sm_uConstructorCalls, EXPECTED_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(pObject->m_nFirst, 0);
+    BOOST_CHECK_EQUAL(pool.GetBorrowedCount(), EXPECTED_BORROWED_COUNT);
+    pool.Return(pObject);
+}
+
+/// <summary>
+/// Checks that the borrowed object is constructed with the constructor that receives one parameter.
+/// </summary>
+ZTEST_CASE ( Borrow2_ObjectIsConstructedWithParameter_Test )
+{
+    // [Preparation]
+    ObjectPool<ObjectPoolTestClass> pool(2U);
+    const int EXPECTED_FIRST = 5;
+
+    // [Execution]
+    ObjectPoolTestClass* pObject = pool.Borrow(EXPECTED_FIRST);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pObject->m_nFirst, EXPECTED_FIRST);
+    pool.Return(pObject);
+}
+
+/// <summary>
+/// Checks that the borrowed object is constructed with the constructor that receives two parameters.
+/// </summary>
+ZTEST_CASE ( Borrow3_ObjectIsConstructedWithParameters_Test )
+{
+    // [Preparation]
+    ObjectPool<ObjectPoolTestClass> pool(2U);
+    const int EXPECTED_FIRST = 5;
+    const int EXPECTED_SECOND = 7;
+
+    // [Execution]
+    ObjectPoolTestClass* pObject = pool.Borrow(EXPECTED_FIRST, EXPECTED_SECOND);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pObject->m_nFirst, EXPECTED_FIRST);
+    BOOST_CHECK_EQUAL(pObject->m_nSecond, EXPECTED_SECOND);
+    pool.Return(pObject);
+}
+
+/// <summary>
+/// Checks that objects are allocated in the heap when the pool is full.
+/// </summary>
+ZTEST_CASE ( Borrow1_ObjectIsAllocatedInHeapWhenPoolIsFull_Test )
+{
+    // [Preparation]
+    ObjectPool<ObjectPoolTestClass> pool(2U);
+    ObjectPoolTestClass* pFirst = pool.Borrow();
+    ObjectPoolTestClass* pSecond = pool.Borrow();
+    const puint_z EXPECTED_BORROWED_COUNT = 2U;
+    const puint_z EXPECTED_OVERFLOW_COUNT = 1U;
+
+    // [Execution]
+    ObjectPoolTestClass* pThird = pool.Borrow();
+
+    // [Verification]
+    BOOST_CHECK(pThird != null_z);
+    BOOST_CHECK_EQUAL(pool.GetBorrowedCount(), EXPECTED_BORROWED_COUNT);
+    BOOST_CHECK_EQUAL(pool.GetOverflowCount(), EXPECTED_OVERFLOW_COUNT);
+    pool.Return(pThird);
+    pool.Return(pSecond);
+    pool.Return(pFirst);
+}
+
+/// <summary>
+/// Checks that returned objects are destroyed and their memory can be borrowed again.
+/// </summary>
+ZTEST_CASE ( Return_ObjectIsDestroyedAndMemoryIsReused_Test )
+{
+    // [Preparation]
+    ObjectPoolTestClass::Reset();
+    ObjectPool<ObjectPoolTestClass> pool(1U);
+    ObjectPoolTestClass* pObject = pool.Borrow();
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 1U;
+    const puint_z EXPECTED_OVERFLOW_COUNT = 0;
+
+    // [Execution]
+    pool.Return(pObject);
+
+    // [Verification]
+    ObjectPoolTestClass* pReusedObject = pool.Borrow();
+    BOOST_CHECK_EQUAL(ObjectPoolTestClass::sm_uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(pReusedObject, pObject);
+    BOOST_CHECK_EQUAL(pool.GetOverflowCount(), EXPECTED_OVERFLOW_COUNT);
+    pool.Return(pReusedObject);
+}
+
+/// <summary>
+/// Checks that objects allocated in the heap are destroyed when they are returned, without affecting the buffer.
+/// </summary>
+ZTEST_CASE ( Return_ObjectAllocatedInHeapIsDestroyed_Test )
+{
+    // [Preparation]
+    ObjectPoolTestClass::Reset();
+    ObjectPool<ObjectPoolTestClass> pool(1U);
+    ObjectPoolTestClass* pFirst = pool.Borrow();
+    ObjectPoolTestClass* pSecond = pool.Borrow();
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 1U;
+    const puint_z EXPECTED_BORROWED_COUNT = 1U;
+
+    // [Execution]
+    pool.Return(pSecond);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(ObjectPoolTestClass::sm_uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(pool.GetBorrowedCount(), EXPECTED_BORROWED_COUNT);
+    pool.Return(pFirst);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the object is null.
+/// </summary>
+ZTEST_CASE ( Return_AssertionFailsWhenObjectIsNull_Test )
+{
+    // [Preparation]
+    ObjectPool<ObjectPoolTestClass> pool(1U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        pool.Return(null_z);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: ObjectPool
+ZTEST_SUITE_END()
@@ -61,6 +61,12 @@ public:
     PoolAllocatorWhiteBox(puint_z uSize, puint_z uBlockSize, void *pBuffer, Alignment alignment) :
         PoolAllocator(uSize, uBlockSize, pBuffer, alignment )
     {
+    }
+
+    // Necessary for testing
+    PoolAllocatorWhiteBox(puint_z uSize, puint_z uBlockSize, Alignment alignment, EMemoryPlacement eMemoryPlacement) :
+        PoolAllocator(uSize, uBlockSize, alignment, eMemoryPlacement)
+    {
     }
 	// METHODS
 	// ---------------
@@ -287,6 +287,54 @@ ZTEST_CASE( Constructor3_PointerToFirstPreAllocatedBlockIsAsExpected_Test )
 }
 
 
+/// <summary>
+/// Checks if pre-allocated memory is correctly aligned when it is placed in the local NUMA node.
+/// </summary>
+ZTEST_CASE( Constructor4_PreAllocatedMemoryIsAlignedWhenPlacementIsLocalNumaNode_Test )
+{
+    // [Preparation]
+    const puint_z BLOCK_SIZE = sizeof(f64_z)*2;
+    const puint_z BLOCKS_COUNT = 4;
+    const puint_z POOL_SIZE = BLOCKS_COUNT*BLOCK_SIZE;
+    const Alignment ALIGNMENT(BLOCK_SIZE);
+    const puint_z ZERO_CORRECTION_ALIGNMENT = 0;
+
+    // [Execution]
+    PoolAllocatorWhiteBox pool(POOL_SIZE, BLOCK_SIZE, ALIGNMENT, EMemoryPlacement::E_LocalNumaNode);
+
+    // [Verification]
+    puint_z correctionAlignment = (puint_z)pool.GetpAllocatedMemory() & (ALIGNMENT - 1);
+    BOOST_CHECK_EQUAL( correctionAlignment, ZERO_CORRECTION_ALIGNMENT );
+}
+
+/// <summary>
+/// Checks that allocations can be done after reallocating a full pool whose memory is placed in the local NUMA node.
+/// </summary>
+ZTEST_CASE( Constructor4_AllocationsCanBeDoneAfterReallocatingWhenPlacementIsLocalNumaNode_Test )
+{
+    // [Preparation]
+    void* NULL_POINTER = null_z;
+    const puint_z BLOCK_SIZE = sizeof(int);
+    const puint_z BLOCKS_COUNT = 4;
+    const puint_z POOL_SIZE = BLOCKS_COUNT * BLOCK_SIZE;
+    PoolAllocator allocator(POOL_SIZE, BLOCK_SIZE, Alignment(alignof_z(int)), EMemoryPlacement::E_LocalNumaNode);
+    for(puint_z i = 0; i < BLOCKS_COUNT; ++i)
+        *(int*)allocator.Allocate() = scast_z(i, unsigned int);
+
+    // [Execution]
+    allocator.Reallocate(BLOCK_SIZE * (BLOCKS_COUNT + 1));
+
+    // [Verification]
+    void* pAllocation = allocator.Allocate();
+    bool bContentIsKept = true;
+
+    for(puint_z i = 0; i < BLOCKS_COUNT; ++i)
+        bContentIsKept = bContentIsKept && ((int*)allocator.GetPointer())[i] == scast_z(i, int);
+
+    BOOST_CHECK_NE(pAllocation, NULL_POINTER);
+    BOOST_CHECK(bContentIsKept);
+}
+
 /// <summary>
 /// Checks if pointer to first block of pre-allocated memory points to first aligned address on passed buffer.
 /// </summary>
@@ -1316,6 +1364,63 @@ ZTEST_CASE( Reallocate2_AssertionFailsWhenInputBufferIsNull_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the allocated blocks and the sizes of both allocators are exchanged.
+/// </summary>
+ZTEST_CASE( Swap_AllocatedBlocksAndSizesAreExchanged_Test )
+{
+    // [Preparation]
+    const puint_z BLOCK_SIZE_A = sizeof(int);
+    const puint_z BLOCK_SIZE_B = sizeof(u64_z);
+    const puint_z POOL_SIZE_A = BLOCK_SIZE_A * 4U;
+    const puint_z POOL_SIZE_B = BLOCK_SIZE_B * 2U;
+    PoolAllocator allocatorA(POOL_SIZE_A, BLOCK_SIZE_A, Alignment(alignof_z(int)));
+    PoolAllocator allocatorB(POOL_SIZE_B, BLOCK_SIZE_B, Alignment(alignof_z(u64_z)));
+    int* pBlockA = scast_z(allocatorA.Allocate(), int*);
+    *pBlockA = 7;
+    const void* POINTER_A = allocatorA.GetPointer();
+    const void* POINTER_B = allocatorB.GetPointer();
+    const puint_z EXPECTED_ALLOCATED_BYTES_A = 0;
+    const puint_z EXPECTED_ALLOCATED_BYTES_B = BLOCK_SIZE_A;
+    const int EXPECTED_VALUE = 7;
+
+    // [Execution]
+    allocatorA.Swap(allocatorB);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocatorA.GetPointer(), POINTER_B);
+    BOOST_CHECK_EQUAL(allocatorB.GetPointer(), POINTER_A);
+    BOOST_CHECK_EQUAL(allocatorA.GetPoolSize(), POOL_SIZE_B);
+    BOOST_CHECK_EQUAL(allocatorB.GetPoolSize(), POOL_SIZE_A);
+    BOOST_CHECK_EQUAL(allocatorA.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES_A);
+    BOOST_CHECK_EQUAL(allocatorB.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES_B);
+    BOOST_CHECK_EQUAL(*scast_z(allocatorB.GetPointer(), int*), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that both allocators keep working with the exchanged blocks.
+/// </summary>
+ZTEST_CASE( Swap_AllocationsCanBeDoneAfterSwapping_Test )
+{
+    // [Preparation]
+    void* NULL_POINTER = null_z;
+    const puint_z BLOCK_SIZE = sizeof(int);
+    const puint_z BLOCKS_COUNT = 2;
+    PoolAllocator allocatorA(BLOCK_SIZE * BLOCKS_COUNT, BLOCK_SIZE, Alignment(alignof_z(int)));
+    PoolAllocator allocatorB(BLOCK_SIZE * BLOCKS_COUNT, BLOCK_SIZE, Alignment(alignof_z(int)));
+    allocatorA.Allocate();
+    allocatorA.Allocate();
+
+    // [Execution]
+    allocatorA.Swap(allocatorB);
+
+    // [Verification]
+    void* pAllocationA = allocatorA.Allocate();
+    void* pAllocationB = allocatorB.Allocate();
+    BOOST_CHECK_NE(pAllocationA, NULL_POINTER);
+    BOOST_CHECK_EQUAL(pAllocationB, NULL_POINTER);
+}
+
 
 // End - Test Suite: PoolAllocator
 ZTEST_SUITE_END()
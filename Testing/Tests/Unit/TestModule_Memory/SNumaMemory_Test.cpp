@@ -0,0 +1,200 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZMemory/SNumaMemory.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+#include <cstring>
+
+
+ZTEST_SUITE_BEGIN( SNumaMemory_TestSuite )
+
+/// <summary>
+/// Checks that the returned buffer is aligned as intended and can be written.
+/// </summary>
+ZTEST_CASE ( Allocate_ReturnsAlignedWritableBuffer_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_SIZE = 10000U;
+    const Alignment INPUT_ALIGNMENT(64U);
+    const u32_z INPUT_NODE = 0;
+    const puint_z EXPECTED_OFFSET = 0;
+
+    // [Execution]
+    void* pBuffer = SNumaMemory::Allocate(INPUT_SIZE, INPUT_ALIGNMENT, INPUT_NODE);
+
+    // [Verification]
+    BOOST_REQUIRE(pBuffer != null_z);
+    BOOST_CHECK_EQUAL((puint_z)pBuffer & (INPUT_ALIGNMENT - 1U), EXPECTED_OFFSET);
+    memset(pBuffer, 0xFF, INPUT_SIZE);
+    BOOST_CHECK_EQUAL(scast_z(pBuffer, u8_z*)[INPUT_SIZE - 1U], 0xFF);
+
+    // [Cleaning]
+    SNumaMemory::Deallocate(pBuffer);
+}
+
+/// <summary>
+/// Checks that memory is returned when the node does not exist.
+/// </summary>
+ZTEST_CASE ( Allocate_ReturnsBufferWhenNodeDoesNotExist_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_SIZE = 100U;
+    const Alignment INPUT_ALIGNMENT(8U);
+    const u32_z INPUT_NODE = SNumaMemory::GetNodeCount();
+
+    // [Execution]
+    void* pBuffer = SNumaMemory::Allocate(INPUT_SIZE, INPUT_ALIGNMENT, INPUT_NODE);
+
+    // [Verification]
+    BOOST_CHECK(pBuffer != null_z);
+
+    // [Cleaning]
+    SNumaMemory::Deallocate(pBuffer);
+}
+
+/// <summary>
+/// Checks that alignments greater than the size of a memory page are fulfilled.
+/// </summary>
+ZTEST_CASE ( Allocate_BigAlignmentsAreFulfilled_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_SIZE = 16U;
+    const Alignment INPUT_ALIGNMENT(65536U);
+    const u32_z INPUT_NODE = 0;
+    const puint_z EXPECTED_OFFSET = 0;
+
+    // [Execution]
+    void* pBuffer = SNumaMemory::Allocate(INPUT_SIZE, INPUT_ALIGNMENT, INPUT_NODE);
+
+    // [Verification]
+    BOOST_REQUIRE(pBuffer != null_z);
+    BOOST_CHECK_EQUAL((puint_z)pBuffer & (INPUT_ALIGNMENT - 1U), EXPECTED_OFFSET);
+
+    // [Cleaning]
+    SNumaMemory::Deallocate(pBuffer);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the size is zero.
+/// </summary>
+ZTEST_CASE ( Allocate_AssertionFailsWhenSizeIsZero_Test )
+{
+    // [Preparation]
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        SNumaMemory::Allocate(0, Alignment(8U), 0);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the returned buffer is aligned as intended.
+/// </summary>
+ZTEST_CASE ( AllocateLocal_ReturnsAlignedBuffer_Test )
+{
+    // [Preparation]
+    const puint_z INPUT_SIZE = 4096U;
+    const Alignment INPUT_ALIGNMENT(32U);
+    const puint_z EXPECTED_OFFSET = 0;
+
+    // [Execution]
+    void* pBuffer = SNumaMemory::AllocateLocal(INPUT_SIZE, INPUT_ALIGNMENT);
+
+    // [Verification]
+    BOOST_REQUIRE(pBuffer != null_z);
+    BOOST_CHECK_EQUAL((puint_z)pBuffer & (INPUT_ALIGNMENT - 1U), EXPECTED_OFFSET);
+
+    // [Cleaning]
+    SNumaMemory::Deallocate(pBuffer);
+}
+
+/// <summary>
+/// Checks that nothing happens when the input buffer is null.
+/// </summary>
+ZTEST_CASE ( Deallocate_NothingHappensWhenBufferIsNull_Test )
+{
+    // [Preparation]
+
+    // [Execution]
+    SNumaMemory::Deallocate(null_z);
+
+    // [Verification]
+    BOOST_CHECK(true);
+}
+
+/// <summary>
+/// Checks that there is, at least, one node.
+/// </summary>
+ZTEST_CASE ( GetNodeCount_ThereIsAtLeastOneNode_Test )
+{
+    // [Preparation]
+    const u32_z MINIMUM_COUNT = 1U;
+
+    // [Execution]
+    u32_z uCount = SNumaMemory::GetNodeCount();
+
+    // [Verification]
+    BOOST_CHECK(uCount >= MINIMUM_COUNT);
+}
+
+/// <summary>
+/// Checks that the current node is lower than the number of nodes.
+/// </summary>
+ZTEST_CASE ( GetCurrentNode_NodeIsLowerThanNumberOfNodes_Test )
+{
+    // [Preparation]
+    const u32_z NODE_COUNT = SNumaMemory::GetNodeCount();
+
+    // [Execution]
+    u32_z uNode = SNumaMemory::GetCurrentNode();
+
+    // [Verification]
+    BOOST_CHECK(uNode < NODE_COUNT);
+}
+
+// End - Test Suite: SNumaMemory
+ZTEST_SUITE_END()
@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZMemory/ScopedScratchMark.h"
+
+
+ZTEST_SUITE_BEGIN( ScopedScratchMark_TestSuite )
+
+/// <summary>
+/// Checks that the blocks allocated during the lifetime of the instance are deallocated when it is destroyed.
+/// </summary>
+ZTEST_CASE ( Destructor_BlocksAllocatedDuringLifetimeAreDeallocated_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(16U);
+    allocator.Allocate(8U);
+    const puint_z EXPECTED_ALLOCATED_BYTES = allocator.GetAllocatedBytes();
+    void* pExpectedLastOverflowBlock = allocator.GetMark().GetLastOverflowBlock();
+
+    // [Execution]
+    {
+        ScopedScratchMark scratchMark(allocator);
+        allocator.Allocate(8U);
+        allocator.Allocate(32U);
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(allocator.GetMark().GetLastOverflowBlock() == pExpectedLastOverflowBlock);
+}
+
+/// <summary>
+/// Checks that nested instances rewind the allocator to their own marks.
+/// </summary>
+ZTEST_CASE ( Destructor_NestedInstancesRewindToTheirOwnMarks_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(64U);
+    puint_z uAllocatedBytesAfterInnerScope = 0;
+    const puint_z EXPECTED_ALLOCATED_BYTES_AFTER_INNER_SCOPE = 8U;
+    const puint_z EXPECTED_ALLOCATED_BYTES_AFTER_OUTER_SCOPE = 0;
+
+    // [Execution]
+    {
+        ScopedScratchMark outerMark(allocator);
+        allocator.Allocate(8U);
+
+        {
+            ScopedScratchMark innerMark(allocator);
+            allocator.Allocate(16U);
+        }
+
+        uAllocatedBytesAfterInnerScope = allocator.GetAllocatedBytes();
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uAllocatedBytesAfterInnerScope, EXPECTED_ALLOCATED_BYTES_AFTER_INNER_SCOPE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES_AFTER_OUTER_SCOPE);
+}
+
+// End - Test Suite: ScopedScratchMark
+ZTEST_SUITE_END()
@@ -0,0 +1,290 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZMemory/ScratchAllocator.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( ScratchAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the size of the buffer equals the size passed to the constructor and nothing is allocated.
+/// </summary>
+ZTEST_CASE ( Constructor_BufferHasExpectedSizeAndIsEmpty_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_SIZE = 64U;
+    const puint_z EXPECTED_ALLOCATED_BYTES = 0;
+    const puint_z EXPECTED_OVERFLOW_COUNT = 0;
+
+    // [Execution]
+    ScratchAllocator allocator(EXPECTED_SIZE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetSize(), EXPECTED_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.GetOverflowCount(), EXPECTED_OVERFLOW_COUNT);
+}
+
+/// <summary>
+/// Checks that blocks are allocated in the buffer when they fit.
+/// </summary>
+ZTEST_CASE ( Allocate1_BlockIsAllocatedInBufferWhenItFits_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(64U);
+    const puint_z EXPECTED_ALLOCATED_BYTES = 16U;
+    const puint_z EXPECTED_OVERFLOW_COUNT = 0;
+
+    // [Execution]
+    void* pBlock = allocator.Allocate(16U);
+
+    // [Verification]
+    BOOST_CHECK(pBlock != null_z);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.GetOverflowCount(), EXPECTED_OVERFLOW_COUNT);
+}
+
+/// <summary>
+/// Checks that blocks are allocated in the heap when they do not fit in the buffer.
+/// </summary>
+ZTEST_CASE ( Allocate1_BlockIsAllocatedInHeapWhenItDoesNotFit_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(64U);
+    allocator.Allocate(48U);
+    const puint_z EXPECTED_ALLOCATED_BYTES = 48U;
+    const puint_z EXPECTED_OVERFLOW_COUNT = 1U;
+
+    // [Execution]
+    void* pBlock = allocator.Allocate(32U);
+
+    // [Verification]
+    BOOST_CHECK(pBlock != null_z);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.GetOverflowCount(), EXPECTED_OVERFLOW_COUNT);
+}
+
+/// <summary>
+/// Checks that blocks allocated in the buffer are aligned as requested.
+/// </summary>
+ZTEST_CASE ( Allocate2_BlockInBufferIsAligned_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(128U);
+    allocator.Allocate(1U, Alignment(1U));
+    const puint_z INPUT_ALIGNMENT = 32U;
+
+    // [Execution]
+    void* pBlock = allocator.Allocate(8U, Alignment(INPUT_ALIGNMENT));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL((puint_z)pBlock % INPUT_ALIGNMENT, 0U);
+}
+
+/// <summary>
+/// Checks that blocks allocated in the heap are aligned as requested.
+/// </summary>
+ZTEST_CASE ( Allocate2_BlockInHeapIsAligned_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(16U);
+    const puint_z INPUT_ALIGNMENT = 64U;
+
+    // [Execution]
+    void* pBlock = allocator.Allocate(32U, Alignment(INPUT_ALIGNMENT));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL((puint_z)pBlock % INPUT_ALIGNMENT, 0U);
+    BOOST_CHECK_EQUAL(allocator.GetOverflowCount(), 1U);
+}
+
+/// <summary>
+/// Checks that the blocks allocated in the buffer after the mark are deallocated.
+/// </summary>
+ZTEST_CASE ( Deallocate_BlocksInBufferAllocatedAfterMarkAreDeallocated_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(64U);
+    allocator.Allocate(8U);
+    const puint_z EXPECTED_ALLOCATED_BYTES = allocator.GetAllocatedBytes();
+    ScratchAllocator::Mark mark = allocator.GetMark();
+    allocator.Allocate(8U);
+    allocator.Allocate(16U);
+
+    // [Execution]
+    allocator.Deallocate(mark);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that the blocks allocated in the heap after the mark are freed while the previous ones are kept.
+/// </summary>
+ZTEST_CASE ( Deallocate_BlocksInHeapAllocatedAfterMarkAreFreed_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(16U);
+    void* pBlockBeforeMark = allocator.Allocate(32U);
+    ScratchAllocator::Mark mark = allocator.GetMark();
+    allocator.Allocate(32U);
+    allocator.Allocate(32U);
+
+    // [Execution]
+    allocator.Deallocate(mark);
+
+    // [Verification]
+    ScratchAllocator::Mark markAfterDeallocating = allocator.GetMark();
+    BOOST_CHECK_EQUAL((puint_z)markAfterDeallocating.GetLastOverflowBlock() + sizeof(void*) + sizeof(puint_z), (puint_z)pBlockBeforeMark);
+}
+
+/// <summary>
+/// Checks that allocations start at the position of the mark after deallocating.
+/// </summary>
+ZTEST_CASE ( Deallocate_AllocationsStartAtMarkAfterDeallocating_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(64U);
+    ScratchAllocator::Mark mark = allocator.GetMark();
+    void* pExpectedAddress = allocator.Allocate(8U);
+    allocator.Allocate(8U);
+
+    // [Execution]
+    allocator.Deallocate(mark);
+
+    // [Verification]
+    void* pAddress = allocator.Allocate(8U);
+    BOOST_CHECK_EQUAL(pAddress, pExpectedAddress);
+}
+
+/// <summary>
+/// Checks that all the blocks are deallocated, both in the buffer and in the heap.
+/// </summary>
+ZTEST_CASE ( Clear_AllBlocksAreDeallocated_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(16U);
+    allocator.Allocate(8U);
+    allocator.Allocate(32U);
+    const puint_z EXPECTED_ALLOCATED_BYTES = 0;
+
+    // [Execution]
+    allocator.Clear();
+
+    // [Verification]
+    ScratchAllocator::Mark mark = allocator.GetMark();
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(mark.GetLastOverflowBlock() == null_z);
+}
+
+/// <summary>
+/// Checks that the overflow count is not reset when the blocks are deallocated.
+/// </summary>
+ZTEST_CASE ( GetOverflowCount_IsNotResetWhenDeallocating_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(16U);
+    ScratchAllocator::Mark mark = allocator.GetMark();
+    allocator.Allocate(32U);
+    allocator.Allocate(32U);
+    const puint_z EXPECTED_OVERFLOW_COUNT = 2U;
+
+    // [Execution]
+    allocator.Deallocate(mark);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetOverflowCount(), EXPECTED_OVERFLOW_COUNT);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the size of the block is zero.
+/// </summary>
+ZTEST_CASE ( Allocate1_AssertionFailsWhenSizeIsZero_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(16U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Allocate(0);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the mark was invalidated by a deallocation to a prior mark.
+/// </summary>
+ZTEST_CASE ( Deallocate_AssertionFailsWhenMarkWasInvalidated_Test )
+{
+    // [Preparation]
+    ScratchAllocator allocator(16U);
+    ScratchAllocator::Mark firstMark = allocator.GetMark();
+    allocator.Allocate(32U);
+    ScratchAllocator::Mark secondMark = allocator.GetMark();
+    allocator.Deallocate(firstMark);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Deallocate(secondMark);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: ScratchAllocator
+ZTEST_SUITE_END()
@@ -0,0 +1,247 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/AsyncMutex.h"
+
+#include "ZThreading/AsyncTaskExecutor.h"
+#include "ZThreading/SThisThread.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+// Task that increments a shared counter while it owns a mutex, yielding between reading and writing the counter
+class AsyncMutexTestTask : public AsyncTask
+{
+public:
+
+    AsyncMutexTestTask() : m_pMutex(null_z),
+                           m_puCounter(null_z),
+                           m_uStep(0),
+                           m_uReadValue(0)
+    {
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        bool bIsCompleted = false;
+
+        if(m_uStep == 0)
+        {
+            this->AwaitLock(*m_pMutex);
+        }
+        else if(m_uStep == 1U)
+        {
+            m_uReadValue = *m_puCounter;
+        }
+        else
+        {
+            *m_puCounter = m_uReadValue + 1U;
+            m_pMutex->Unlock();
+            bIsCompleted = true;
+        }
+
+        ++m_uStep;
+
+        return bIsCompleted;
+    }
+
+public:
+
+    AsyncMutex* m_pMutex;
+    u32_z* m_puCounter;
+    u32_z m_uStep;
+    u32_z m_uReadValue;
+};
+
+
+ZTEST_SUITE_BEGIN( AsyncMutex_TestSuite )
+
+/// <summary>
+/// Checks that the mutex is not locked after construction.
+/// </summary>
+ZTEST_CASE ( Constructor_MutexIsNotLocked_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_IS_LOCKED = false;
+
+    // [Execution]
+    AsyncMutex mutex;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(mutex.IsLocked(), EXPECTED_IS_LOCKED);
+}
+
+/// <summary>
+/// Checks that the mutex is acquired when it is not owned.
+/// </summary>
+ZTEST_CASE ( TryLock_ReturnsTrueWhenMutexIsNotOwned_Test )
+{
+    // [Preparation]
+    AsyncMutex mutex;
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    bool bResult = mutex.TryLock();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK(mutex.IsLocked());
+    mutex.Unlock();
+}
+
+/// <summary>
+/// Checks that the mutex is not acquired when it is already owned.
+/// </summary>
+ZTEST_CASE ( TryLock_ReturnsFalseWhenMutexIsAlreadyOwned_Test )
+{
+    // [Preparation]
+    AsyncMutex mutex;
+    mutex.TryLock();
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bResult = mutex.TryLock();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    mutex.Unlock();
+}
+
+/// <summary>
+/// Checks that the mutex is released when no task waits for it.
+/// </summary>
+ZTEST_CASE ( Unlock_MutexIsReleasedWhenNoTaskWaits_Test )
+{
+    // [Preparation]
+    AsyncMutex mutex;
+    mutex.TryLock();
+    const bool EXPECTED_IS_LOCKED = false;
+
+    // [Execution]
+    mutex.Unlock();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(mutex.IsLocked(), EXPECTED_IS_LOCKED);
+}
+
+/// <summary>
+/// Checks that a task that waits for the mutex is resumed when the mutex is unlocked.
+/// </summary>
+ZTEST_CASE ( Unlock_WaitingTaskAcquiresTheMutex_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_COUNTER = 1U;
+    u32_z uCounter = 0;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncMutex mutex;
+    AsyncMutexTestTask task;
+    task.m_pMutex = &mutex;
+    task.m_puCounter = &uCounter;
+    mutex.TryLock();
+    executor.Submit(task);
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 20, 0, 0));
+    const bool COMPLETED_BEFORE_UNLOCKING = task.IsCompleted();
+
+    // [Execution]
+    mutex.Unlock();
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK(!COMPLETED_BEFORE_UNLOCKING);
+    BOOST_CHECK_EQUAL(uCounter, EXPECTED_COUNTER);
+    BOOST_CHECK(!mutex.IsLocked());
+}
+
+/// <summary>
+/// Checks that only one task owns the mutex at a time, although the worker threads execute other tasks while it is owned.
+/// </summary>
+ZTEST_CASE ( Unlock_TasksOwnTheMutexOneAtATime_Test )
+{
+    // [Preparation]
+    static const u32_z TASK_COUNT = 200U;
+    const u32_z EXPECTED_COUNTER = TASK_COUNT;
+    u32_z uCounter = 0;
+    AsyncTaskExecutor executor(4U, 1U);
+    AsyncMutex mutex;
+    AsyncMutexTestTask* arTasks = new AsyncMutexTestTask[TASK_COUNT];
+
+    for(u32_z i = 0; i < TASK_COUNT; ++i)
+    {
+        arTasks[i].m_pMutex = &mutex;
+        arTasks[i].m_puCounter = &uCounter;
+    }
+
+    // [Execution]
+    for(u32_z i = 0; i < TASK_COUNT; ++i)
+        executor.Submit(arTasks[i]);
+
+    // [Verification]
+    for(u32_z i = 0; i < TASK_COUNT; ++i)
+        arTasks[i].Wait();
+
+    BOOST_CHECK_EQUAL(uCounter, EXPECTED_COUNTER);
+
+    delete[] arTasks;
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the mutex is not owned.
+/// </summary>
+ZTEST_CASE ( Unlock_AssertionFailsWhenMutexIsNotOwned_Test )
+{
+    // [Preparation]
+    AsyncMutex mutex;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        mutex.Unlock();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: AsyncMutex
+ZTEST_SUITE_END()
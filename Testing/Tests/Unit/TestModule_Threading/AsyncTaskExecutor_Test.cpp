@@ -0,0 +1,242 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/AsyncTaskExecutor.h"
+
+#include "ZThreading/SThisThread.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+// Task that sleeps a given number of times and counts how many times it is resumed
+class AsyncTaskExecutorTestTask : public AsyncTask
+{
+public:
+
+    AsyncTaskExecutorTestTask() : m_uSleepCount(0),
+                                  m_uResumptions(0)
+    {
+    }
+
+    explicit AsyncTaskExecutorTestTask(const u32_z uSleepCount) : m_uSleepCount(uSleepCount),
+                                                                   m_uResumptions(0)
+    {
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        const bool IS_COMPLETED = m_uResumptions == m_uSleepCount;
+
+        if(!IS_COMPLETED)
+            this->AwaitSleep(TimeSpan(0, 0, 0, 0, 1, 0, 0));
+
+        ++m_uResumptions;
+
+        return IS_COMPLETED;
+    }
+
+public:
+
+    u32_z m_uSleepCount;
+    u32_z m_uResumptions;
+};
+
+
+ZTEST_SUITE_BEGIN( AsyncTaskExecutor_TestSuite )
+
+/// <summary>
+/// Checks that the number of threads is stored.
+/// </summary>
+ZTEST_CASE ( Constructor_NumbersOfThreadsAreStored_Test )
+{
+    // [Preparation]
+    const u32_z WORKER_COUNT = 3U;
+    const u32_z BLOCKING_WORKER_COUNT = 2U;
+
+    // [Execution]
+    AsyncTaskExecutor executor(WORKER_COUNT, BLOCKING_WORKER_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(executor.GetWorkerCount(), WORKER_COUNT);
+    BOOST_CHECK_EQUAL(executor.GetBlockingWorkerCount(), BLOCKING_WORKER_COUNT);
+}
+
+/// <summary>
+/// Checks that the threads finish when the executor is destroyed, even if they are waiting.
+/// </summary>
+ZTEST_CASE ( Destructor_ThreadsFinish_Test )
+{
+    // [Preparation]
+    AsyncTaskExecutor* pExecutor = new AsyncTaskExecutor(2U, 2U);
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 10, 0, 0));
+
+    // [Execution]
+    delete pExecutor;
+
+    // [Verification]
+    BOOST_CHECK(true);
+}
+
+/// <summary>
+/// Checks that the task is executed until it completes.
+/// </summary>
+ZTEST_CASE ( Submit_TaskIsExecuted_Test )
+{
+    // [Preparation]
+    const u32_z SLEEP_COUNT = 3U;
+    const u32_z EXPECTED_RESUMPTIONS = SLEEP_COUNT + 1U;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskExecutorTestTask task(SLEEP_COUNT);
+
+    // [Execution]
+    executor.Submit(task);
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK(task.IsCompleted());
+    BOOST_CHECK_EQUAL(task.m_uResumptions, EXPECTED_RESUMPTIONS);
+}
+
+/// <summary>
+/// Checks that a completed task is executed again from the beginning.
+/// </summary>
+ZTEST_CASE ( Submit_CompletedTaskIsExecutedAgain_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_RESUMPTIONS = 1U;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskExecutorTestTask task;
+    executor.Submit(task);
+    task.Wait();
+    task.m_uResumptions = 0;
+
+    // [Execution]
+    executor.Submit(task);
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK(task.IsCompleted());
+    BOOST_CHECK_EQUAL(task.m_uResumptions, EXPECTED_RESUMPTIONS);
+}
+
+/// <summary>
+/// Checks that many more tasks than threads can sleep at the same time and all of them complete.
+/// </summary>
+ZTEST_CASE ( Submit_ManyTasksSleepingAtTheSameTimeComplete_Test )
+{
+    // [Preparation]
+    static const u32_z TASK_COUNT = 1000U;
+    const u32_z SLEEP_COUNT = 5U;
+    const u32_z EXPECTED_RESUMPTIONS = SLEEP_COUNT + 1U;
+    AsyncTaskExecutor executor(2U, 1U);
+    AsyncTaskExecutorTestTask* arTasks = new AsyncTaskExecutorTestTask[TASK_COUNT];
+
+    for(u32_z i = 0; i < TASK_COUNT; ++i)
+        arTasks[i].m_uSleepCount = SLEEP_COUNT;
+
+    // [Execution]
+    for(u32_z i = 0; i < TASK_COUNT; ++i)
+        executor.Submit(arTasks[i]);
+
+    // [Verification]
+    bool bAllTasksCompleted = true;
+
+    for(u32_z i = 0; i < TASK_COUNT; ++i)
+    {
+        arTasks[i].Wait();
+        bAllTasksCompleted = bAllTasksCompleted && arTasks[i].m_uResumptions == EXPECTED_RESUMPTIONS;
+    }
+
+    BOOST_CHECK(bAllTasksCompleted);
+
+    delete[] arTasks;
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of worker threads is zero.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenWorkerCountIsZero_Test )
+{
+    // [Preparation]
+    const u32_z WORKER_COUNT = 0;
+    const u32_z BLOCKING_WORKER_COUNT = 1U;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        AsyncTaskExecutor executor(WORKER_COUNT, BLOCKING_WORKER_COUNT);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the number of worker threads for blocking tasks is zero.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenBlockingWorkerCountIsZero_Test )
+{
+    // [Preparation]
+    const u32_z WORKER_COUNT = 1U;
+    const u32_z BLOCKING_WORKER_COUNT = 0;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        AsyncTaskExecutor executor(WORKER_COUNT, BLOCKING_WORKER_COUNT);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: AsyncTaskExecutor
+ZTEST_SUITE_END()
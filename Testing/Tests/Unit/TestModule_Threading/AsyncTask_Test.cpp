@@ -0,0 +1,470 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/AsyncTask.h"
+
+#include "ZThreading/AsyncTaskExecutor.h"
+#include "ZThreading/AsyncMutex.h"
+#include "ZThreading/SMonotonicClock.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+// Task that completes after being resumed a given number of times, without awaiting anything
+class AsyncTaskYieldingMock : public AsyncTask
+{
+public:
+
+    explicit AsyncTaskYieldingMock(const u32_z uResumptionsToComplete) : m_uResumptionsToComplete(uResumptionsToComplete),
+                                                                          m_uResumptions(0)
+    {
+    }
+
+    explicit AsyncTaskYieldingMock(const bool bIsBlocking) : AsyncTask(bIsBlocking),
+                                                             m_uResumptionsToComplete(1U),
+                                                             m_uResumptions(0)
+    {
+    }
+
+    // Exposes the protected method
+    void CallAwaitTask(AsyncTask &task)
+    {
+        this->AwaitTask(task);
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        ++m_uResumptions;
+        return m_uResumptions >= m_uResumptionsToComplete;
+    }
+
+public:
+
+    u32_z m_uResumptionsToComplete;
+    u32_z m_uResumptions;
+};
+
+// Task that sleeps once and stores the instant when it completes
+class AsyncTaskSleepingMock : public AsyncTask
+{
+public:
+
+    explicit AsyncTaskSleepingMock(const TimeSpan &duration) : m_duration(duration),
+                                                               m_bHasSlept(false),
+                                                               m_uCompletionInstant(0)
+    {
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        bool bIsCompleted = false;
+
+        if(m_bHasSlept)
+        {
+            m_uCompletionInstant = SMonotonicClock::GetNanoseconds();
+            bIsCompleted = true;
+        }
+        else
+        {
+            m_bHasSlept = true;
+            this->AwaitSleep(m_duration);
+        }
+
+        return bIsCompleted;
+    }
+
+public:
+
+    TimeSpan m_duration;
+    bool m_bHasSlept;
+    u64_z m_uCompletionInstant;
+};
+
+// Task that awaits another task a given number of times and stores whether it was completed every time it was resumed
+class AsyncTaskAwaitingMock : public AsyncTask
+{
+public:
+
+    AsyncTaskAwaitingMock(AsyncTask &awaitedTask, const u32_z uAwaitCount) : m_pAwaitedTask(&awaitedTask),
+                                                                            m_uAwaitCount(uAwaitCount),
+                                                                            m_uResumptions(0),
+                                                                            m_bAwaitedTaskWasAlwaysCompleted(true)
+    {
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        if(m_uResumptions > 0)
+            m_bAwaitedTaskWasAlwaysCompleted = m_bAwaitedTaskWasAlwaysCompleted && m_pAwaitedTask->IsCompleted();
+
+        const bool IS_COMPLETED = m_uResumptions == m_uAwaitCount;
+
+        if(!IS_COMPLETED)
+            this->AwaitTask(*m_pAwaitedTask);
+
+        ++m_uResumptions;
+
+        return IS_COMPLETED;
+    }
+
+public:
+
+    AsyncTask* m_pAwaitedTask;
+    u32_z m_uAwaitCount;
+    u32_z m_uResumptions;
+    bool m_bAwaitedTaskWasAlwaysCompleted;
+};
+
+// Task that acquires a mutex and stores whether it owned the mutex when it was resumed
+class AsyncTaskLockingMock : public AsyncTask
+{
+public:
+
+    explicit AsyncTaskLockingMock(AsyncMutex &mutex) : m_pMutex(&mutex),
+                                                       m_bHasAwaited(false),
+                                                       m_bMutexWasLocked(false)
+    {
+    }
+
+protected:
+
+    virtual bool Resume()
+    {
+        bool bIsCompleted = false;
+
+        if(m_bHasAwaited)
+        {
+            m_bMutexWasLocked = m_pMutex->IsLocked();
+            m_pMutex->Unlock();
+            bIsCompleted = true;
+        }
+        else
+        {
+            m_bHasAwaited = true;
+            this->AwaitLock(*m_pMutex);
+        }
+
+        return bIsCompleted;
+    }
+
+public:
+
+    AsyncMutex* m_pMutex;
+    bool m_bHasAwaited;
+    bool m_bMutexWasLocked;
+};
+
+
+ZTEST_SUITE_BEGIN( AsyncTask_TestSuite )
+
+/// <summary>
+/// Checks that the task is not completed and not blocking after construction.
+/// </summary>
+ZTEST_CASE ( Constructor1_TaskIsNotCompletedAndNotBlocking_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_IS_COMPLETED = false;
+    const bool EXPECTED_IS_BLOCKING = false;
+
+    // [Execution]
+    AsyncTaskYieldingMock task(1U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(task.IsCompleted(), EXPECTED_IS_COMPLETED);
+    BOOST_CHECK_EQUAL(task.IsBlocking(), EXPECTED_IS_BLOCKING);
+}
+
+/// <summary>
+/// Checks that the task is blocking when it is indicated.
+/// </summary>
+ZTEST_CASE ( Constructor2_TaskIsBlockingWhenIndicated_Test )
+{
+    // [Preparation]
+    const bool IS_BLOCKING = true;
+    const bool EXPECTED_IS_COMPLETED = false;
+
+    // [Execution]
+    AsyncTaskYieldingMock task(IS_BLOCKING);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(task.IsCompleted(), EXPECTED_IS_COMPLETED);
+    BOOST_CHECK_EQUAL(task.IsBlocking(), IS_BLOCKING);
+}
+
+/// <summary>
+/// Checks that the calling thread waits until the task completes.
+/// </summary>
+ZTEST_CASE ( Wait_ReturnsWhenTaskCompletes_Test )
+{
+    // [Preparation]
+    const u32_z RESUMPTIONS_TO_COMPLETE = 5U;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskSleepingMock sleepingTask(TimeSpan(0, 0, 0, 0, 20, 0, 0));
+    AsyncTaskYieldingMock yieldingTask(RESUMPTIONS_TO_COMPLETE);
+    executor.Submit(sleepingTask);
+    executor.Submit(yieldingTask);
+
+    // [Execution]
+    sleepingTask.Wait();
+    yieldingTask.Wait();
+
+    // [Verification]
+    BOOST_CHECK(sleepingTask.IsCompleted());
+    BOOST_CHECK(yieldingTask.IsCompleted());
+    BOOST_CHECK_EQUAL(yieldingTask.m_uResumptions, RESUMPTIONS_TO_COMPLETE);
+}
+
+/// <summary>
+/// Checks that it returns immediately when the task has already completed.
+/// </summary>
+ZTEST_CASE ( Wait_ReturnsImmediatelyWhenTaskHasAlreadyCompleted_Test )
+{
+    // [Preparation]
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskYieldingMock task(1U);
+    executor.Submit(task);
+    task.Wait();
+
+    // [Execution]
+    task.Wait();
+
+    // [Verification]
+    BOOST_CHECK(task.IsCompleted());
+}
+
+/// <summary>
+/// Checks that the task is not resumed before the time elapses.
+/// </summary>
+ZTEST_CASE ( AwaitSleep_TaskIsResumedAfterTheTimeElapses_Test )
+{
+    // [Preparation]
+    const TimeSpan DURATION(0, 0, 0, 0, 30, 0, 0);
+    const u64_z MINIMUM_ELAPSED_NANOSECONDS = DURATION.GetHundredsOfNanoseconds() * 100ULL;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskSleepingMock task(DURATION);
+    const u64_z START_INSTANT = SMonotonicClock::GetNanoseconds();
+
+    // [Execution]
+    executor.Submit(task);
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK(task.m_uCompletionInstant - START_INSTANT >= MINIMUM_ELAPSED_NANOSECONDS);
+}
+
+/// <summary>
+/// Checks that the task that has to be resumed earlier is resumed first, no matter the order in which they started sleeping.
+/// </summary>
+ZTEST_CASE ( AwaitSleep_TasksAreResumedInOrderOfInstant_Test )
+{
+    // [Preparation]
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskSleepingMock longTask(TimeSpan(0, 0, 0, 0, 80, 0, 0));
+    AsyncTaskSleepingMock mediumTask(TimeSpan(0, 0, 0, 0, 40, 0, 0));
+    AsyncTaskSleepingMock shortTask(TimeSpan(0, 0, 0, 0, 10, 0, 0));
+
+    // [Execution]
+    executor.Submit(longTask);
+    executor.Submit(mediumTask);
+    executor.Submit(shortTask);
+
+    // [Verification]
+    longTask.Wait();
+    mediumTask.Wait();
+    shortTask.Wait();
+    BOOST_CHECK(shortTask.m_uCompletionInstant < mediumTask.m_uCompletionInstant);
+    BOOST_CHECK(mediumTask.m_uCompletionInstant < longTask.m_uCompletionInstant);
+}
+
+/// <summary>
+/// Checks that the task owns the mutex when it is resumed.
+/// </summary>
+ZTEST_CASE ( AwaitLock_TaskIsResumedOwningTheMutex_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_MUTEX_WAS_LOCKED = true;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncMutex mutex;
+    AsyncTaskLockingMock task(mutex);
+
+    // [Execution]
+    executor.Submit(task);
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK_EQUAL(task.m_bMutexWasLocked, EXPECTED_MUTEX_WAS_LOCKED);
+    BOOST_CHECK(!mutex.IsLocked());
+}
+
+/// <summary>
+/// Checks that the awaited task is executed and that the task is resumed when it completes.
+/// </summary>
+ZTEST_CASE ( AwaitTask_TaskIsResumedWhenAwaitedTaskCompletes_Test )
+{
+    // [Preparation]
+    const u32_z AWAIT_COUNT = 1U;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskSleepingMock awaitedTask(TimeSpan(0, 0, 0, 0, 10, 0, 0));
+    AsyncTaskAwaitingMock task(awaitedTask, AWAIT_COUNT);
+
+    // [Execution]
+    executor.Submit(task);
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK(awaitedTask.IsCompleted());
+    BOOST_CHECK(task.m_bAwaitedTaskWasAlwaysCompleted);
+}
+
+/// <summary>
+/// Checks that the awaited task is executed when it is blocking, although the awaiting task is not.
+/// </summary>
+ZTEST_CASE ( AwaitTask_BlockingTaskIsExecuted_Test )
+{
+    // [Preparation]
+    const bool IS_BLOCKING = true;
+    const u32_z AWAIT_COUNT = 1U;
+    const u32_z EXPECTED_RESUMPTIONS = 1U;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskYieldingMock awaitedTask(IS_BLOCKING);
+    AsyncTaskAwaitingMock task(awaitedTask, AWAIT_COUNT);
+
+    // [Execution]
+    executor.Submit(task);
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK(task.m_bAwaitedTaskWasAlwaysCompleted);
+    BOOST_CHECK_EQUAL(awaitedTask.m_uResumptions, EXPECTED_RESUMPTIONS);
+}
+
+/// <summary>
+/// Checks that a completed task is executed again when it is awaited again.
+/// </summary>
+ZTEST_CASE ( AwaitTask_CompletedTaskIsExecutedAgain_Test )
+{
+    // [Preparation]
+    const u32_z AWAIT_COUNT = 3U;
+    const u32_z EXPECTED_RESUMPTIONS = 3U;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskYieldingMock awaitedTask(1U);
+    AsyncTaskAwaitingMock task(awaitedTask, AWAIT_COUNT);
+
+    // [Execution]
+    executor.Submit(task);
+
+    // [Verification]
+    task.Wait();
+    BOOST_CHECK(task.m_bAwaitedTaskWasAlwaysCompleted);
+    BOOST_CHECK_EQUAL(awaitedTask.m_uResumptions, EXPECTED_RESUMPTIONS);
+}
+
+/// <summary>
+/// Checks that it returns True when the task has completed.
+/// </summary>
+ZTEST_CASE ( IsCompleted_ReturnsTrueWhenTaskHasCompleted_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+    AsyncTaskExecutor executor(1U, 1U);
+    AsyncTaskYieldingMock task(1U);
+    executor.Submit(task);
+    task.Wait();
+
+    // [Execution]
+    bool bResult = task.IsCompleted();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the task has never been submitted.
+/// </summary>
+ZTEST_CASE ( Wait_AssertionFailsWhenTaskHasNotBeenSubmitted_Test )
+{
+    // [Preparation]
+    AsyncTaskYieldingMock task(1U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        task.Wait();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the task awaits itself.
+/// </summary>
+ZTEST_CASE ( AwaitTask_AssertionFailsWhenTaskAwaitsItself_Test )
+{
+    // [Preparation]
+    AsyncTaskYieldingMock task(1U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        task.CallAwaitTask(task);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: AsyncTask
+ZTEST_SUITE_END()
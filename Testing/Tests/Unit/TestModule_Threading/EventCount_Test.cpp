@@ -0,0 +1,194 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/EventCount.h"
+
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+
+// Class whose methods are to be used by the threads in the tests of EventCount
+class EventCountTestClass
+{
+public:
+
+    static boost::atomic<u32_z> sm_uValue;
+    static boost::atomic<u32_z> sm_uWokenThreads;
+    static EventCount sm_eventCount;
+
+    // Waits until the value is not zero
+    static void WaitWhileZero()
+    {
+        while(sm_uValue.load() == 0)
+        {
+            const u32_z KEY = sm_eventCount.PrepareWait();
+
+            if(sm_uValue.load() == 0)
+                sm_eventCount.Wait(KEY);
+            else
+                sm_eventCount.CancelWait();
+        }
+
+        sm_uWokenThreads.fetch_add(1U);
+    }
+};
+
+boost::atomic<u32_z> EventCountTestClass::sm_uValue(0);
+boost::atomic<u32_z> EventCountTestClass::sm_uWokenThreads(0);
+EventCount EventCountTestClass::sm_eventCount;
+
+
+ZTEST_SUITE_BEGIN( EventCount_TestSuite )
+
+/// <summary>
+/// Checks that there are no waiting threads after construction.
+/// </summary>
+ZTEST_CASE ( Constructor_ThereAreNoWaitingThreads_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_WAITER_COUNT = 0;
+
+    // [Execution]
+    EventCount eventCount;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(eventCount.GetWaiterCount(), EXPECTED_WAITER_COUNT);
+}
+
+/// <summary>
+/// Checks that the number of waiting threads increases when a wait is announced.
+/// </summary>
+ZTEST_CASE ( PrepareWait_WaiterCountIsIncremented_Test )
+{
+    // [Preparation]
+    EventCount eventCount;
+    const u32_z EXPECTED_WAITER_COUNT = 1U;
+
+    // [Execution]
+    eventCount.PrepareWait();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(eventCount.GetWaiterCount(), EXPECTED_WAITER_COUNT);
+    eventCount.CancelWait();
+}
+
+/// <summary>
+/// Checks that the number of waiting threads decreases when a wait is cancelled.
+/// </summary>
+ZTEST_CASE ( CancelWait_WaiterCountIsDecremented_Test )
+{
+    // [Preparation]
+    EventCount eventCount;
+    eventCount.PrepareWait();
+    const u32_z EXPECTED_WAITER_COUNT = 0;
+
+    // [Execution]
+    eventCount.CancelWait();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(eventCount.GetWaiterCount(), EXPECTED_WAITER_COUNT);
+}
+
+/// <summary>
+/// Checks that the thread does not wait when a notification was sent after the wait was announced.
+/// </summary>
+ZTEST_CASE ( Wait_ReturnsImmediatelyWhenNotifiedAfterPrepareWait_Test )
+{
+    // [Preparation]
+    EventCount eventCount;
+    const u32_z KEY = eventCount.PrepareWait();
+    eventCount.NotifyOne();
+    const u32_z EXPECTED_WAITER_COUNT = 0;
+
+    // [Execution]
+    eventCount.Wait(KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(eventCount.GetWaiterCount(), EXPECTED_WAITER_COUNT);
+}
+
+/// <summary>
+/// Checks that a waiting thread is woken up.
+/// </summary>
+ZTEST_CASE ( NotifyOne_WaitingThreadIsWokenUp_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_WOKEN_THREADS = 1U;
+    EventCountTestClass::sm_uValue = 0;
+    EventCountTestClass::sm_uWokenThreads = 0;
+    Thread thread(Delegate<void()>(&EventCountTestClass::WaitWhileZero));
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    const u32_z WOKEN_THREADS_BEFORE_NOTIFYING = EventCountTestClass::sm_uWokenThreads;
+
+    // [Execution]
+    EventCountTestClass::sm_uValue = 1U;
+    EventCountTestClass::sm_eventCount.NotifyOne();
+
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK_EQUAL(WOKEN_THREADS_BEFORE_NOTIFYING, 0U);
+    BOOST_CHECK_EQUAL(EventCountTestClass::sm_uWokenThreads.load(), EXPECTED_WOKEN_THREADS);
+}
+
+/// <summary>
+/// Checks that all the waiting threads are woken up.
+/// </summary>
+ZTEST_CASE ( NotifyAll_AllWaitingThreadsAreWokenUp_Test )
+{
+    // [Preparation]
+    static const u32_z NUMBER_OF_THREADS = 4U;
+    EventCountTestClass::sm_uValue = 0;
+    EventCountTestClass::sm_uWokenThreads = 0;
+    Thread* arThreads[NUMBER_OF_THREADS];
+
+    for(u32_z i = 0; i < NUMBER_OF_THREADS; ++i)
+        arThreads[i] = new Thread(Delegate<void()>(&EventCountTestClass::WaitWhileZero));
+
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+
+    // [Execution]
+    EventCountTestClass::sm_uValue = 1U;
+    EventCountTestClass::sm_eventCount.NotifyAll();
+
+    // [Verification]
+    for(u32_z i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    BOOST_CHECK_EQUAL(EventCountTestClass::sm_uWokenThreads.load(), NUMBER_OF_THREADS);
+    BOOST_CHECK_EQUAL(EventCountTestClass::sm_eventCount.GetWaiterCount(), 0U);
+}
+
+// End - Test Suite: EventCount
+ZTEST_SUITE_END()
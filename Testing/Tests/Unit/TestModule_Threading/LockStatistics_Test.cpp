@@ -0,0 +1,276 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/LockStatistics.h"
+
+#include "ZCommon/DataTypes/SFloat.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( LockStatistics_TestSuite )
+
+/// <summary>
+/// Checks that the statistics passed to the constructor are returned by the properties.
+/// </summary>
+ZTEST_CASE ( Constructor_StatisticsAreStored_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_NAME("Queue");
+    const u64_z EXPECTED_ACQUISITION_COUNT = 10U;
+    const u64_z EXPECTED_CONTENDED_ACQUISITION_COUNT = 3U;
+    const u64_z EXPECTED_HOLD_COUNT = 9U;
+    u64_z arWaitTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    u64_z arHoldTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    arWaitTimeHistogram[4] = 3U;
+    arHoldTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT - 1U] = 9U;
+
+    // [Execution]
+    LockStatistics statistics(EXPECTED_NAME, EXPECTED_ACQUISITION_COUNT, EXPECTED_CONTENDED_ACQUISITION_COUNT, 0, EXPECTED_HOLD_COUNT, 0, 
+                              arWaitTimeHistogram, arHoldTimeHistogram);
+
+    // [Verification]
+    BOOST_CHECK(statistics.GetName() == EXPECTED_NAME);
+    BOOST_CHECK_EQUAL(statistics.GetAcquisitionCount(), EXPECTED_ACQUISITION_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetContendedAcquisitionCount(), EXPECTED_CONTENDED_ACQUISITION_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetHoldCount(), EXPECTED_HOLD_COUNT);
+
+    for(u32_z i = 0; i < LockStatistics::HISTOGRAM_BUCKET_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(statistics.GetWaitTimeHistogram(i), arWaitTimeHistogram[i]);
+        BOOST_CHECK_EQUAL(statistics.GetHoldTimeHistogram(i), arHoldTimeHistogram[i]);
+    }
+}
+
+/// <summary>
+/// Checks that wait and hold times are converted from nanoseconds.
+/// </summary>
+ZTEST_CASE ( GetWaitTime_TimesAreConvertedFromNanoseconds_Test )
+{
+    // [Preparation]
+    const u64_z WAIT_NANOSECONDS = 1500U;
+    const u64_z HOLD_NANOSECONDS = 25000U;
+    const u64_z EMPTY_HISTOGRAM[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    LockStatistics statistics(string_z("Queue"), 2U, 1U, WAIT_NANOSECONDS, 2U, HOLD_NANOSECONDS, EMPTY_HISTOGRAM, EMPTY_HISTOGRAM);
+    const TimeSpan EXPECTED_WAIT_TIME(15ULL);
+    const TimeSpan EXPECTED_HOLD_TIME(250ULL);
+
+    // [Execution]
+    TimeSpan waitTime = statistics.GetWaitTime();
+    TimeSpan holdTime = statistics.GetHoldTime();
+
+    // [Verification]
+    BOOST_CHECK(waitTime == EXPECTED_WAIT_TIME);
+    BOOST_CHECK(holdTime == EXPECTED_HOLD_TIME);
+}
+
+/// <summary>
+/// Checks that the contention rate is the proportion of contended acquisitions.
+/// </summary>
+ZTEST_CASE ( GetContentionRate_ReturnsProportionOfContendedAcquisitions_Test )
+{
+    // [Preparation]
+    const u64_z EMPTY_HISTOGRAM[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    LockStatistics statistics(string_z("Queue"), 8U, 2U, 0, 0, 0, EMPTY_HISTOGRAM, EMPTY_HISTOGRAM);
+    const float_z EXPECTED_RATE = SFloat::_0_25;
+
+    // [Execution]
+    float_z fRate = statistics.GetContentionRate();
+
+    // [Verification]
+    BOOST_CHECK(SFloat::AreEqual(fRate, EXPECTED_RATE));
+}
+
+/// <summary>
+/// Checks that the contention rate is zero when the locks were never acquired.
+/// </summary>
+ZTEST_CASE ( GetContentionRate_IsZeroWhenThereAreNoAcquisitions_Test )
+{
+    // [Preparation]
+    const u64_z EMPTY_HISTOGRAM[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    LockStatistics statistics(string_z("Queue"), 0, 0, 0, 0, 0, EMPTY_HISTOGRAM, EMPTY_HISTOGRAM);
+    const float_z EXPECTED_RATE = SFloat::_0;
+
+    // [Execution]
+    float_z fRate = statistics.GetContentionRate();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(fRate, EXPECTED_RATE);
+}
+
+/// <summary>
+/// Checks that times under 2 nanoseconds belong to the first bucket.
+/// </summary>
+ZTEST_CASE ( GetHistogramBucket_ShortestTimesBelongToFirstBucket_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_BUCKET = 0;
+
+    // [Execution]
+    u32_z uBucketOfZero = LockStatistics::GetHistogramBucket(0);
+    u32_z uBucketOfOne = LockStatistics::GetHistogramBucket(1U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uBucketOfZero, EXPECTED_BUCKET);
+    BOOST_CHECK_EQUAL(uBucketOfOne, EXPECTED_BUCKET);
+}
+
+/// <summary>
+/// Checks that every power of two starts a new bucket.
+/// </summary>
+ZTEST_CASE ( GetHistogramBucket_PowersOfTwoStartNewBuckets_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_BUCKET_BEFORE = 9U;
+    const u32_z EXPECTED_BUCKET_AFTER = 10U;
+
+    // [Execution]
+    u32_z uBucketBefore = LockStatistics::GetHistogramBucket(1023U);
+    u32_z uBucketAfter = LockStatistics::GetHistogramBucket(1024U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uBucketBefore, EXPECTED_BUCKET_BEFORE);
+    BOOST_CHECK_EQUAL(uBucketAfter, EXPECTED_BUCKET_AFTER);
+}
+
+/// <summary>
+/// Checks that times longer than the start of the last bucket belong to it.
+/// </summary>
+ZTEST_CASE ( GetHistogramBucket_LongestTimesBelongToLastBucket_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_BUCKET = LockStatistics::HISTOGRAM_BUCKET_COUNT - 1U;
+
+    // [Execution]
+    u32_z uBucketOfStart = LockStatistics::GetHistogramBucket(1ULL << (LockStatistics::HISTOGRAM_BUCKET_COUNT - 1U));
+    u32_z uBucketOfMaximum = LockStatistics::GetHistogramBucket(0xFFFFFFFFFFFFFFFFULL);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uBucketOfStart, EXPECTED_BUCKET);
+    BOOST_CHECK_EQUAL(uBucketOfMaximum, EXPECTED_BUCKET);
+}
+
+/// <summary>
+/// Checks that the text contains all the statistics as key=value pairs and only the buckets that are not empty.
+/// </summary>
+ZTEST_CASE ( ToString_ReturnsKeyValuePairs_Test )
+{
+    // [Preparation]
+    u64_z arWaitTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    u64_z arHoldTimeHistogram[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    arWaitTimeHistogram[11] = 2U;
+    arWaitTimeHistogram[12] = 1U;
+    arHoldTimeHistogram[6] = 5U;
+    LockStatistics statistics(string_z("Queue"), 5U, 3U, 9000U, 5U, 400U, arWaitTimeHistogram, arHoldTimeHistogram);
+    const string_z EXPECTED_TEXT("lock=Queue acquisitions=5 contended=3 wait_ns=9000 holds=5 hold_ns=400 wait_histogram=11:2,12:1 hold_histogram=6:5");
+
+    // [Execution]
+    string_z strText = statistics.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strText == EXPECTED_TEXT);
+}
+
+/// <summary>
+/// Checks that empty histograms have no pairs.
+/// </summary>
+ZTEST_CASE ( ToString_EmptyHistogramsHaveNoPairs_Test )
+{
+    // [Preparation]
+    const u64_z EMPTY_HISTOGRAM[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    LockStatistics statistics(string_z("Queue"), 0, 0, 0, 0, 0, EMPTY_HISTOGRAM, EMPTY_HISTOGRAM);
+    const string_z EXPECTED_TEXT("lock=Queue acquisitions=0 contended=0 wait_ns=0 holds=0 hold_ns=0 wait_histogram= hold_histogram=");
+
+    // [Execution]
+    string_z strText = statistics.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strText == EXPECTED_TEXT);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when there are more contended acquisitions than acquisitions.
+/// </summary>
+ZTEST_CASE ( Constructor_AssertionFailsWhenContendedAcquisitionsExceedAcquisitions_Test )
+{
+    // [Preparation]
+    const u64_z EMPTY_HISTOGRAM[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        LockStatistics statistics(string_z("Queue"), 1U, 2U, 0, 0, 0, EMPTY_HISTOGRAM, EMPTY_HISTOGRAM);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the bucket does not exist.
+/// </summary>
+ZTEST_CASE ( GetWaitTimeHistogram_AssertionFailsWhenBucketDoesNotExist_Test )
+{
+    // [Preparation]
+    const u64_z EMPTY_HISTOGRAM[LockStatistics::HISTOGRAM_BUCKET_COUNT] = { 0 };
+    LockStatistics statistics(string_z("Queue"), 0, 0, 0, 0, 0, EMPTY_HISTOGRAM, EMPTY_HISTOGRAM);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        statistics.GetWaitTimeHistogram(LockStatistics::HISTOGRAM_BUCKET_COUNT);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: LockStatistics
+ZTEST_SUITE_END()
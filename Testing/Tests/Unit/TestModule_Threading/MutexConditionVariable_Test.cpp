@@ -0,0 +1,339 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/MutexConditionVariable.h"
+
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/Mutex.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+
+
+// Class whose methods are to be used by the threads in the tests of MutexConditionVariable
+class MutexConditionVariableTestClass
+{
+public:
+
+    static void Reset()
+    {
+        sm_uThreadCounterAfterWait = 0;
+        sm_uThreadCounterBeforeWait = 0;
+        sm_bLockIsLockedAfterWait = false;
+        sm_bCondition = false;
+        sm_bWaitResult = false;
+    }
+
+    static bool IsConditionFulfilled()
+    {
+        return sm_bCondition;
+    }
+
+    static void WaitingFunction()
+    {
+        ScopedExclusiveLock<> lock(sm_mutex);
+
+        ++sm_uThreadCounterBeforeWait;
+
+        sm_conditionVariable.Wait(lock);
+
+        sm_bLockIsLockedAfterWait = lock.IsOwner();
+
+        ++sm_uThreadCounterAfterWait;
+    }
+
+    static void WaitingWithPredicateFunction()
+    {
+        ScopedExclusiveLock<> lock(sm_mutex);
+
+        ++sm_uThreadCounterBeforeWait;
+
+        sm_conditionVariable.Wait(lock, &MutexConditionVariableTestClass::IsConditionFulfilled);
+
+        ++sm_uThreadCounterAfterWait;
+    }
+
+    static void WaitingForWithPredicateFunction()
+    {
+        ScopedExclusiveLock<> lock(sm_mutex);
+
+        ++sm_uThreadCounterBeforeWait;
+
+        sm_bWaitResult = sm_conditionVariable.WaitFor(lock, TimeSpan(0, 0, 0, 10, 0, 0, 0), &MutexConditionVariableTestClass::IsConditionFulfilled);
+
+        ++sm_uThreadCounterAfterWait;
+    }
+
+    static bool sm_bLockIsLockedAfterWait;
+    static bool sm_bCondition;
+    static bool sm_bWaitResult;
+    static unsigned int sm_uThreadCounterBeforeWait;
+    static unsigned int sm_uThreadCounterAfterWait;
+    static Mutex sm_mutex;
+    static MutexConditionVariable sm_conditionVariable;
+
+};
+
+bool MutexConditionVariableTestClass::sm_bLockIsLockedAfterWait = false;
+bool MutexConditionVariableTestClass::sm_bCondition = false;
+bool MutexConditionVariableTestClass::sm_bWaitResult = false;
+unsigned int MutexConditionVariableTestClass::sm_uThreadCounterBeforeWait = 0;
+unsigned int MutexConditionVariableTestClass::sm_uThreadCounterAfterWait = 0;
+Mutex MutexConditionVariableTestClass::sm_mutex;
+MutexConditionVariable MutexConditionVariableTestClass::sm_conditionVariable;
+
+
+ZTEST_SUITE_BEGIN( MutexConditionVariable_TestSuite )
+
+/// <summary>
+/// Checks that the thread blocks, waiting until it gets notified.
+/// </summary>
+ZTEST_CASE ( Wait_ThreadBlocksUntilNotified_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    Delegate<void()> function(&MutexConditionVariableTestClass::WaitingFunction);
+    Thread thread(function);
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+    bool bThreadPassedFirstHalf = MutexConditionVariableTestClass::sm_uThreadCounterBeforeWait > 0;
+    bool bThreadDidNotPassSecondHalfBeforeNotification = MutexConditionVariableTestClass::sm_uThreadCounterAfterWait == 0;
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyOne();
+    thread.Join();
+    bool bThreadPassedSecondHalfAfterNotification = MutexConditionVariableTestClass::sm_uThreadCounterAfterWait > 0;
+
+    // [Verification]
+    BOOST_CHECK(bThreadPassedFirstHalf);
+    BOOST_CHECK(bThreadDidNotPassSecondHalfBeforeNotification);
+    BOOST_CHECK(bThreadPassedSecondHalfAfterNotification);
+}
+
+/// <summary>
+/// Checks that the mutex is unlocked when the thread waits for a notification.
+/// </summary>
+ZTEST_CASE ( Wait_MutexIsUnlockedWhileWaiting_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    Delegate<void()> function(&MutexConditionVariableTestClass::WaitingFunction);
+    Thread thread1(function);
+    Thread thread2(function);
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+    bool bSecondThreadEnteredCriticalSectionWhileWaiting = MutexConditionVariableTestClass::sm_uThreadCounterBeforeWait == 2;
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyAll();
+
+    // [Verification]
+    thread1.Join();
+    thread2.Join();
+    BOOST_CHECK(bSecondThreadEnteredCriticalSectionWhileWaiting);
+}
+
+/// <summary>
+/// Checks that the mutex is locked again when the thread is notified.
+/// </summary>
+ZTEST_CASE ( Wait_MutexIsLockedAfterNotification_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    Delegate<void()> function(&MutexConditionVariableTestClass::WaitingFunction);
+    Thread thread(function);
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyOne();
+
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK(MutexConditionVariableTestClass::sm_bLockIsLockedAfterWait);
+}
+
+/// <summary>
+/// Checks that only one thread is notified.
+/// </summary>
+ZTEST_CASE ( NotifyOne_OnlyOneThreadIsNotified_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    Delegate<void()> function(&MutexConditionVariableTestClass::WaitingFunction);
+    Thread thread1(function);
+    Thread thread2(function);
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyOne();
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+    bool bOnlyOneThreadWasNotified = MutexConditionVariableTestClass::sm_uThreadCounterAfterWait == 1;
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyOne();
+
+    // [Verification]
+    thread1.Join();
+    thread2.Join();
+    BOOST_CHECK(bOnlyOneThreadWasNotified);
+}
+
+/// <summary>
+/// Checks that all the threads are notified.
+/// </summary>
+ZTEST_CASE ( NotifyAll_AllThreadsAreNotified_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    Delegate<void()> function(&MutexConditionVariableTestClass::WaitingFunction);
+    Thread thread1(function);
+    Thread thread2(function);
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+
+    // [Execution]
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyAll();
+
+    // [Verification]
+    thread1.Join();
+    thread2.Join();
+    BOOST_CHECK_EQUAL(MutexConditionVariableTestClass::sm_uThreadCounterAfterWait, 2U);
+}
+
+/// <summary>
+/// Checks that the thread does not wait when the condition is already fulfilled.
+/// </summary>
+ZTEST_CASE ( Wait_ReturnsImmediatelyWhenPredicateIsTrue_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    MutexConditionVariableTestClass::sm_bCondition = true;
+    MutexConditionVariable conditionVariable;
+    Mutex mutex;
+    ScopedExclusiveLock<> lock(mutex);
+
+    // [Execution]
+    conditionVariable.Wait(lock, &MutexConditionVariableTestClass::IsConditionFulfilled);
+
+    // [Verification]
+    BOOST_CHECK(lock.IsOwner());
+}
+
+/// <summary>
+/// Checks that the thread keeps waiting after a notification while the condition is not fulfilled.
+/// </summary>
+ZTEST_CASE ( Wait_ThreadKeepsWaitingWhilePredicateIsFalse_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    Delegate<void()> function(&MutexConditionVariableTestClass::WaitingWithPredicateFunction);
+    Thread thread(function);
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+
+    // [Execution]
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyOne();
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+    bool bThreadKeptWaiting = MutexConditionVariableTestClass::sm_uThreadCounterAfterWait == 0;
+
+    {
+        ScopedExclusiveLock<> lock(MutexConditionVariableTestClass::sm_mutex);
+        MutexConditionVariableTestClass::sm_bCondition = true;
+    }
+
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyOne();
+
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK(bThreadKeptWaiting);
+    BOOST_CHECK_EQUAL(MutexConditionVariableTestClass::sm_uThreadCounterAfterWait, 1U);
+}
+
+/// <summary>
+/// Checks that it returns False when nobody notifies the thread before the maximum time elapses.
+/// </summary>
+ZTEST_CASE ( WaitFor_ReturnsFalseWhenTimeoutElapses_Test )
+{
+    // [Preparation]
+    MutexConditionVariable conditionVariable;
+    Mutex mutex;
+    ScopedExclusiveLock<> lock(mutex);
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bResult = conditionVariable.WaitFor(lock, TimeSpan(0, 0, 0, 0, 50, 0, 0));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK(lock.IsOwner());
+}
+
+/// <summary>
+/// Checks that it returns False when the condition is not fulfilled before the maximum time elapses.
+/// </summary>
+ZTEST_CASE ( WaitFor_ReturnsFalseWhenPredicateIsFalseAndTimeoutElapses_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    MutexConditionVariable conditionVariable;
+    Mutex mutex;
+    ScopedExclusiveLock<> lock(mutex);
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bResult = conditionVariable.WaitFor(lock, TimeSpan(0, 0, 0, 0, 50, 0, 0), &MutexConditionVariableTestClass::IsConditionFulfilled);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns True when the condition is fulfilled and the thread is notified before the maximum time elapses.
+/// </summary>
+ZTEST_CASE ( WaitFor_ReturnsTrueWhenPredicateIsFulfilledBeforeTimeout_Test )
+{
+    // [Preparation]
+    MutexConditionVariableTestClass::Reset();
+    Delegate<void()> function(&MutexConditionVariableTestClass::WaitingForWithPredicateFunction);
+    Thread thread(function);
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 200, 0, 0));
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    {
+        ScopedExclusiveLock<> lock(MutexConditionVariableTestClass::sm_mutex);
+        MutexConditionVariableTestClass::sm_bCondition = true;
+    }
+
+    MutexConditionVariableTestClass::sm_conditionVariable.NotifyOne();
+
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK_EQUAL(MutexConditionVariableTestClass::sm_bWaitResult, EXPECTED_RESULT);
+}
+
+// End - Test Suite: MutexConditionVariable
+ZTEST_SUITE_END()
@@ -24,7 +24,7 @@
 // Kinesis Team                                                                  //
 //-------------------------------------------------------------------------------//
 
-// Note: Testing a mutex is so hard. Since Boost is used as underlying implementation and it has been already tested both by the dev team and many users, our testing effort is reduced
+// Note: Testing a mutex is so hard. Tests with several threads can only prove that it fails, not that it works in every possible interleaving
 
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/test/unit_test_log.hpp>
@@ -71,6 +71,26 @@ public:
         --sm_uThreadCounter;
     }
 
+    static void IncrementCounter()
+    {
+        for(unsigned int i = 0; i < INCREMENTS_PER_THREAD; ++i)
+        {
+            sm_mutex.Lock();
+            ++sm_uSharedResource;
+            sm_mutex.Unlock();
+        }
+    }
+
+    static void LockAndSetFlag()
+    {
+        sm_mutex.Lock();
+        sm_bFlag = true;
+        sm_mutex.Unlock();
+    }
+
+    static const unsigned int INCREMENTS_PER_THREAD = 20000U;
+    static bool sm_bFlag;
+
     static unsigned int sm_uSharedResource;
     static bool sm_bOneThreadAtATime;
     static Mutex sm_mutex;
@@ -81,6 +101,7 @@ Mutex MutexTestClass::sm_mutex;
 unsigned int MutexTestClass::sm_uThreadCounter = 0;
 unsigned int MutexTestClass::sm_uSharedResource;
 bool MutexTestClass::sm_bOneThreadAtATime = true;
+bool MutexTestClass::sm_bFlag = false;
 
 
 ZTEST_SUITE_BEGIN( Mutex_TestSuite )
@@ -109,6 +130,52 @@ ZTEST_CASE ( Lock_OnlyOneThreadOwnsTheMutexAtATime_Test )
     BOOST_CHECK(MutexTestClass::sm_bOneThreadAtATime);
 }
 
+/// <summary>
+/// Checks that no change to the shared resource is lost when many threads lock the mutex continuously.
+/// </summary>
+ZTEST_CASE ( Lock_NoChangeIsLostWhenManyThreadsCompeteForTheMutex_Test )
+{
+    // [Preparation]
+    static const unsigned int NUMBER_OF_THREADS = 8U;
+    const unsigned int EXPECTED_VALUE = NUMBER_OF_THREADS * MutexTestClass::INCREMENTS_PER_THREAD;
+    MutexTestClass::Reset();
+    Thread* arThreads[NUMBER_OF_THREADS];
+
+    // [Execution]
+    for(unsigned int i = 0; i < NUMBER_OF_THREADS; ++i)
+        arThreads[i] = new Thread(Delegate<void()>(MutexTestClass::IncrementCounter));
+
+    for(unsigned int i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(MutexTestClass::sm_uSharedResource, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that a thread that waits for the mutex continues when the owner unlocks it.
+/// </summary>
+ZTEST_CASE ( Unlock_WaitingThreadContinues_Test )
+{
+    // [Preparation]
+    MutexTestClass::sm_bFlag = false;
+    MutexTestClass::sm_mutex.Lock();
+    Thread thread(Delegate<void()>(MutexTestClass::LockAndSetFlag));
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    const bool FLAG_BEFORE_UNLOCKING = MutexTestClass::sm_bFlag;
+
+    // [Execution]
+    MutexTestClass::sm_mutex.Unlock();
+    
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK(!FLAG_BEFORE_UNLOCKING);
+    BOOST_CHECK(MutexTestClass::sm_bFlag);
+}
+
 /// <summary>
 /// Checks that it returns True when the mutex can be locked.
 /// </summary>
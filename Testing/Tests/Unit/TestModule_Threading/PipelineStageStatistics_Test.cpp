@@ -0,0 +1,147 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/PipelineStageStatistics.h"
+
+#include "ZCommon/DataTypes/SFloat.h"
+
+
+ZTEST_SUITE_BEGIN( PipelineStageStatistics_TestSuite )
+
+/// <summary>
+/// Checks that the counts passed to the constructor are returned by the properties.
+/// </summary>
+ZTEST_CASE ( Constructor_CountsAreStored_Test )
+{
+    // [Preparation]
+    const u64_z EXPECTED_PROCESSED_COUNT = 10U;
+    const u64_z EXPECTED_FILTERED_COUNT = 3U;
+    const u32_z EXPECTED_WORKER_COUNT = 2U;
+    const puint_z EXPECTED_MAXIMUM_QUEUE_DEPTH = 7U;
+
+    // [Execution]
+    PipelineStageStatistics statistics(EXPECTED_PROCESSED_COUNT, EXPECTED_FILTERED_COUNT, EXPECTED_WORKER_COUNT, 0, 0, 0, EXPECTED_MAXIMUM_QUEUE_DEPTH);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetProcessedCount(), EXPECTED_PROCESSED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetFilteredCount(), EXPECTED_FILTERED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetWorkerCount(), EXPECTED_WORKER_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetMaximumQueueDepth(), EXPECTED_MAXIMUM_QUEUE_DEPTH);
+}
+
+/// <summary>
+/// Checks that the busy time is converted from nanoseconds.
+/// </summary>
+ZTEST_CASE ( GetBusyTime_IsConvertedFromNanoseconds_Test )
+{
+    // [Preparation]
+    const u64_z BUSY_NANOSECONDS = 1500U;
+    PipelineStageStatistics statistics(1U, 0, 1U, BUSY_NANOSECONDS, 0, 0, 0);
+    const TimeSpan EXPECTED_BUSY_TIME(15ULL);
+
+    // [Execution]
+    TimeSpan busyTime = statistics.GetBusyTime();
+
+    // [Verification]
+    BOOST_CHECK(busyTime == EXPECTED_BUSY_TIME);
+}
+
+/// <summary>
+/// Checks that the throughput is calculated as if all the worker threads were busy at the same time.
+/// </summary>
+ZTEST_CASE ( GetThroughput_TakesWorkerCountIntoAccount_Test )
+{
+    // [Preparation]
+    const u64_z PROCESSED_COUNT = 100U;
+    const u32_z WORKER_COUNT = 4U;
+    const u64_z BUSY_NANOSECONDS = 2000000000ULL;
+    PipelineStageStatistics statistics(PROCESSED_COUNT, 0, WORKER_COUNT, BUSY_NANOSECONDS, 0, 0, 0);
+    const float_z EXPECTED_THROUGHPUT = scast_z(200.0, float_z);
+
+    // [Execution]
+    float_z fThroughput = statistics.GetThroughput();
+
+    // [Verification]
+    BOOST_CHECK(SFloat::AreEqual(fThroughput, EXPECTED_THROUGHPUT));
+}
+
+/// <summary>
+/// Checks that the throughput is zero when no time was measured.
+/// </summary>
+ZTEST_CASE ( GetThroughput_IsZeroWhenThereIsNoBusyTime_Test )
+{
+    // [Preparation]
+    PipelineStageStatistics statistics(0, 0, 1U, 0, 0, 0, 0);
+    const float_z EXPECTED_THROUGHPUT = SFloat::_0;
+
+    // [Execution]
+    float_z fThroughput = statistics.GetThroughput();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(fThroughput, EXPECTED_THROUGHPUT);
+}
+
+/// <summary>
+/// Checks that the average queue depth is the sum of the samples divided by their number.
+/// </summary>
+ZTEST_CASE ( GetAverageQueueDepth_IsSumDividedBySampleCount_Test )
+{
+    // [Preparation]
+    PipelineStageStatistics statistics(4U, 0, 1U, 0, 10U, 4U, 5U);
+    const float_z EXPECTED_AVERAGE = scast_z(2.5, float_z);
+
+    // [Execution]
+    float_z fAverage = statistics.GetAverageQueueDepth();
+
+    // [Verification]
+    BOOST_CHECK(SFloat::AreEqual(fAverage, EXPECTED_AVERAGE));
+}
+
+/// <summary>
+/// Checks that the average queue depth is zero when the queue was never sampled.
+/// </summary>
+ZTEST_CASE ( GetAverageQueueDepth_IsZeroWhenThereAreNoSamples_Test )
+{
+    // [Preparation]
+    PipelineStageStatistics statistics(0, 0, 1U, 0, 0, 0, 0);
+    const float_z EXPECTED_AVERAGE = SFloat::_0;
+
+    // [Execution]
+    float_z fAverage = statistics.GetAverageQueueDepth();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(fAverage, EXPECTED_AVERAGE);
+}
+
+// End - Test Suite: PipelineStageStatistics
+ZTEST_SUITE_END()
@@ -0,0 +1,440 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/Pipeline.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+#include "ZThreading/SThisThread.h"
+
+// Class whose methods are used as stages in the tests of Pipeline
+class PipelineTestClass
+{
+public:
+
+    static const u32_z MAXIMUM_TOKEN_COUNT = 64U;
+
+    static u32_z sm_arValues[MAXIMUM_TOKEN_COUNT];
+    static u32_z sm_uTokenCount;
+    static u32_z sm_uProducedCount;
+    static u32_z sm_arReceivedValues[MAXIMUM_TOKEN_COUNT];
+    static u32_z sm_uReceivedCount;
+    static boost::atomic<u32_z> sm_uTokensInFlight;
+    static u32_z sm_uMaximumTokensInFlight;
+
+    // Prepares the values of the tokens to be produced
+    static void Reset(const u32_z uTokenCount)
+    {
+        for(u32_z i = 0; i < MAXIMUM_TOKEN_COUNT; ++i)
+        {
+            sm_arValues[i] = i;
+            sm_arReceivedValues[i] = 0;
+        }
+
+        sm_uTokenCount = uTokenCount;
+        sm_uProducedCount = 0;
+        sm_uReceivedCount = 0;
+        sm_uTokensInFlight.store(0);
+        sm_uMaximumTokensInFlight = 0;
+    }
+
+    // Produces tokens that point to consecutive values, until the token count is reached
+    static void* Produce(void*)
+    {
+        void* pToken = null_z;
+
+        if(sm_uProducedCount < sm_uTokenCount)
+        {
+            pToken = &sm_arValues[sm_uProducedCount];
+            ++sm_uProducedCount;
+
+            const u32_z IN_FLIGHT = sm_uTokensInFlight.fetch_add(1U) + 1U;
+
+            if(IN_FLIGHT > sm_uMaximumTokensInFlight)
+                sm_uMaximumTokensInFlight = IN_FLIGHT;
+        }
+
+        return pToken;
+    }
+
+    // Multiplies the value by 10, spending more time with some values so tokens are reordered by parallel stages
+    static void* MultiplyBy10(void* pToken)
+    {
+        u32_z* pValue = scast_z(pToken, u32_z*);
+
+        if(*pValue % 3U == 0)
+            SThisThread::Sleep(TimeSpan(10000ULL));
+
+        *pValue *= 10U;
+        return pToken;
+    }
+
+    // Filters out the tokens whose value is odd
+    static void* FilterOutOddValues(void* pToken)
+    {
+        return *scast_z(pToken, u32_z*) % 2U == 0 ? pToken : null_z;
+    }
+
+    // Stores the value in the list of received values
+    static void* Receive(void* pToken)
+    {
+        sm_arReceivedValues[sm_uReceivedCount] = *scast_z(pToken, u32_z*);
+        ++sm_uReceivedCount;
+        sm_uTokensInFlight.fetch_sub(1U);
+        return pToken;
+    }
+};
+
+u32_z PipelineTestClass::sm_arValues[PipelineTestClass::MAXIMUM_TOKEN_COUNT];
+u32_z PipelineTestClass::sm_uTokenCount = 0;
+u32_z PipelineTestClass::sm_uProducedCount = 0;
+u32_z PipelineTestClass::sm_arReceivedValues[PipelineTestClass::MAXIMUM_TOKEN_COUNT];
+u32_z PipelineTestClass::sm_uReceivedCount = 0;
+boost::atomic<u32_z> PipelineTestClass::sm_uTokensInFlight(0);
+u32_z PipelineTestClass::sm_uMaximumTokensInFlight = 0;
+
+
+ZTEST_SUITE_BEGIN( Pipeline_TestSuite )
+
+/// <summary>
+/// Checks that the pipeline has no stages after construction.
+/// </summary>
+ZTEST_CASE ( Constructor_HasNoStages_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_STAGE_COUNT = 0;
+
+    // [Execution]
+    Pipeline pipeline;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pipeline.GetStageCount(), EXPECTED_STAGE_COUNT);
+}
+
+/// <summary>
+/// Checks that the number of stages increases when a stage is added.
+/// </summary>
+ZTEST_CASE ( AddStage_StageCountIsIncremented_Test )
+{
+    // [Preparation]
+    Pipeline pipeline;
+    const puint_z EXPECTED_STAGE_COUNT = 3U;
+
+    // [Execution]
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::MultiplyBy10), EPipelineStageMode::E_Parallel, 4U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialOutOfOrder, 1U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pipeline.GetStageCount(), EXPECTED_STAGE_COUNT);
+}
+
+/// <summary>
+/// Checks that every token produced by the first stage is processed by all the stages.
+/// </summary>
+ZTEST_CASE ( Run_AllTokensAreProcessedByAllStages_Test )
+{
+    // [Preparation]
+    const u32_z TOKEN_COUNT = 40U;
+    PipelineTestClass::Reset(TOKEN_COUNT);
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::MultiplyBy10), EPipelineStageMode::E_Parallel, 4U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialOutOfOrder, 1U);
+    const u32_z EXPECTED_SUM = 7800U; // (0 + 1 + ... + 39) * 10
+
+    // [Execution]
+    pipeline.Run(8U);
+
+    // [Verification]
+    u32_z uSum = 0;
+
+    for(u32_z i = 0; i < PipelineTestClass::sm_uReceivedCount; ++i)
+        uSum += PipelineTestClass::sm_arReceivedValues[i];
+
+    BOOST_CHECK_EQUAL(PipelineTestClass::sm_uReceivedCount, TOKEN_COUNT);
+    BOOST_CHECK_EQUAL(uSum, EXPECTED_SUM);
+}
+
+/// <summary>
+/// Checks that a stage that processes tokens in order receives them in the order they were produced, even when a previous parallel stage reorders them.
+/// </summary>
+ZTEST_CASE ( Run_InOrderStageReceivesTokensInProductionOrder_Test )
+{
+    // [Preparation]
+    const u32_z TOKEN_COUNT = 40U;
+    PipelineTestClass::Reset(TOKEN_COUNT);
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::MultiplyBy10), EPipelineStageMode::E_Parallel, 4U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialInOrder, 1U);
+
+    // [Execution]
+    pipeline.Run(8U);
+
+    // [Verification]
+    bool bIsInOrder = PipelineTestClass::sm_uReceivedCount == TOKEN_COUNT;
+
+    for(u32_z i = 0; i < PipelineTestClass::sm_uReceivedCount; ++i)
+        bIsInOrder = bIsInOrder && PipelineTestClass::sm_arReceivedValues[i] == i * 10U;
+
+    BOOST_CHECK(bIsInOrder);
+}
+
+/// <summary>
+/// Checks that the tokens for which a stage returns null are not passed to the next stages, and that in-order stages do not wait for them.
+/// </summary>
+ZTEST_CASE ( Run_FilteredTokensAreNotPassedToNextStages_Test )
+{
+    // [Preparation]
+    const u32_z TOKEN_COUNT = 20U;
+    PipelineTestClass::Reset(TOKEN_COUNT);
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::FilterOutOddValues), EPipelineStageMode::E_Parallel, 2U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialInOrder, 1U);
+    const u32_z EXPECTED_RECEIVED_COUNT = 10U;
+
+    // [Execution]
+    pipeline.Run(4U);
+
+    // [Verification]
+    bool bOnlyEvenValuesInOrder = true;
+
+    for(u32_z i = 0; i < PipelineTestClass::sm_uReceivedCount; ++i)
+        bOnlyEvenValuesInOrder = bOnlyEvenValuesInOrder && PipelineTestClass::sm_arReceivedValues[i] == i * 2U;
+
+    BOOST_CHECK_EQUAL(PipelineTestClass::sm_uReceivedCount, EXPECTED_RECEIVED_COUNT);
+    BOOST_CHECK(bOnlyEvenValuesInOrder);
+}
+
+/// <summary>
+/// Checks that the number of tokens in flight never exceeds the token limit.
+/// </summary>
+ZTEST_CASE ( Run_TokensInFlightDoNotExceedTokenLimit_Test )
+{
+    // [Preparation]
+    const u32_z TOKEN_COUNT = 60U;
+    const u32_z TOKEN_LIMIT = 3U;
+    PipelineTestClass::Reset(TOKEN_COUNT);
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::MultiplyBy10), EPipelineStageMode::E_Parallel, 4U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialOutOfOrder, 1U);
+
+    // [Execution]
+    pipeline.Run(TOKEN_LIMIT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(PipelineTestClass::sm_uReceivedCount, TOKEN_COUNT);
+    BOOST_CHECK(PipelineTestClass::sm_uMaximumTokensInFlight <= TOKEN_LIMIT);
+}
+
+/// <summary>
+/// Checks that a pipeline with only the first stage calls it until it returns null.
+/// </summary>
+ZTEST_CASE ( Run_PipelineWithOneStageProducesAllTokens_Test )
+{
+    // [Preparation]
+    const u32_z TOKEN_COUNT = 10U;
+    PipelineTestClass::Reset(TOKEN_COUNT);
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+
+    // [Execution]
+    pipeline.Run(1U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(PipelineTestClass::sm_uProducedCount, TOKEN_COUNT);
+}
+
+/// <summary>
+/// Checks that the pipeline can be run several times and the statistics of the previous run are discarded.
+/// </summary>
+ZTEST_CASE ( Run_CanBeRunSeveralTimes_Test )
+{
+    // [Preparation]
+    const u32_z TOKEN_COUNT = 10U;
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialInOrder, 1U);
+    PipelineTestClass::Reset(TOKEN_COUNT);
+    pipeline.Run(2U);
+    PipelineTestClass::Reset(TOKEN_COUNT);
+
+    // [Execution]
+    pipeline.Run(2U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(PipelineTestClass::sm_uReceivedCount, TOKEN_COUNT);
+    BOOST_CHECK_EQUAL(pipeline.GetStageStatistics(1U).GetProcessedCount(), TOKEN_COUNT);
+}
+
+/// <summary>
+/// Checks that the statistics count the tokens processed and filtered by every stage.
+/// </summary>
+ZTEST_CASE ( GetStageStatistics_CountsProcessedAndFilteredTokens_Test )
+{
+    // [Preparation]
+    const u32_z TOKEN_COUNT = 20U;
+    PipelineTestClass::Reset(TOKEN_COUNT);
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::FilterOutOddValues), EPipelineStageMode::E_Parallel, 2U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialOutOfOrder, 1U);
+    pipeline.Run(4U);
+    const u64_z EXPECTED_PRODUCED_COUNT = TOKEN_COUNT;
+    const u64_z EXPECTED_FILTERING_STAGE_PROCESSED_COUNT = TOKEN_COUNT;
+    const u64_z EXPECTED_FILTERED_COUNT = TOKEN_COUNT / 2U;
+    const u64_z EXPECTED_LAST_STAGE_PROCESSED_COUNT = TOKEN_COUNT / 2U;
+    const u32_z EXPECTED_WORKER_COUNT = 2U;
+
+    // [Execution]
+    PipelineStageStatistics firstStage = pipeline.GetStageStatistics(0);
+    PipelineStageStatistics filteringStage = pipeline.GetStageStatistics(1U);
+    PipelineStageStatistics lastStage = pipeline.GetStageStatistics(2U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(firstStage.GetProcessedCount(), EXPECTED_PRODUCED_COUNT);
+    BOOST_CHECK_EQUAL(filteringStage.GetProcessedCount(), EXPECTED_FILTERING_STAGE_PROCESSED_COUNT);
+    BOOST_CHECK_EQUAL(filteringStage.GetFilteredCount(), EXPECTED_FILTERED_COUNT);
+    BOOST_CHECK_EQUAL(filteringStage.GetWorkerCount(), EXPECTED_WORKER_COUNT);
+    BOOST_CHECK_EQUAL(lastStage.GetProcessedCount(), EXPECTED_LAST_STAGE_PROCESSED_COUNT);
+}
+
+/// <summary>
+/// Checks that the depth of the input queues never exceeds the token limit.
+/// </summary>
+ZTEST_CASE ( GetStageStatistics_QueueDepthDoesNotExceedTokenLimit_Test )
+{
+    // [Preparation]
+    const u32_z TOKEN_COUNT = 40U;
+    const puint_z TOKEN_LIMIT = 5U;
+    PipelineTestClass::Reset(TOKEN_COUNT);
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::MultiplyBy10), EPipelineStageMode::E_SerialOutOfOrder, 1U);
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialInOrder, 1U);
+    pipeline.Run(TOKEN_LIMIT);
+
+    // [Execution]
+    PipelineStageStatistics secondStage = pipeline.GetStageStatistics(1U);
+    PipelineStageStatistics lastStage = pipeline.GetStageStatistics(2U);
+
+    // [Verification]
+    BOOST_CHECK(secondStage.GetMaximumQueueDepth() <= TOKEN_LIMIT);
+    BOOST_CHECK(lastStage.GetMaximumQueueDepth() <= TOKEN_LIMIT);
+    BOOST_CHECK(secondStage.GetAverageQueueDepth() <= scast_z(TOKEN_LIMIT, float_z));
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the first stage is parallel.
+/// </summary>
+ZTEST_CASE ( AddStage_AssertionFailsWhenFirstStageIsParallel_Test )
+{
+    // [Preparation]
+    Pipeline pipeline;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_Parallel, 2U);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the concurrency of a serial stage is not 1.
+/// </summary>
+ZTEST_CASE ( AddStage_AssertionFailsWhenSerialStageConcurrencyIsNotOne_Test )
+{
+    // [Preparation]
+    Pipeline pipeline;
+    pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Produce), EPipelineStageMode::E_SerialInOrder, 1U);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        pipeline.AddStage(Pipeline::StageFunction(&PipelineTestClass::Receive), EPipelineStageMode::E_SerialOutOfOrder, 2U);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the pipeline is run without stages.
+/// </summary>
+ZTEST_CASE ( Run_AssertionFailsWhenThereAreNoStages_Test )
+{
+    // [Preparation]
+    Pipeline pipeline;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        pipeline.Run(1U);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: Pipeline
+ZTEST_SUITE_END()
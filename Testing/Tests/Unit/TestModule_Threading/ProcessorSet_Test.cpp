@@ -0,0 +1,382 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/ProcessorSet.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( ProcessorSet_TestSuite )
+
+/// <summary>
+/// Checks that the set is empty when it is created by the default constructor.
+/// </summary>
+ZTEST_CASE ( Constructor1_SetIsEmpty_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_COUNT = 0;
+
+    // [Execution]
+    ProcessorSet processors;
+
+    // [Verification]
+    BOOST_CHECK(processors.IsEmpty());
+    BOOST_CHECK_EQUAL(processors.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the set only contains the input processor.
+/// </summary>
+ZTEST_CASE ( Constructor2_SetOnlyContainsInputProcessor_Test )
+{
+    // [Preparation]
+    const u32_z INPUT_PROCESSOR = 70U;
+    const u32_z EXPECTED_COUNT = 1U;
+
+    // [Execution]
+    ProcessorSet processors(INPUT_PROCESSOR);
+
+    // [Verification]
+    BOOST_CHECK(processors.Contains(INPUT_PROCESSOR));
+    BOOST_CHECK_EQUAL(processors.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that two sets with the same processors are equal.
+/// </summary>
+ZTEST_CASE ( OperatorEquality_ReturnsTrueWhenSetsContainSameProcessors_Test )
+{
+    // [Preparation]
+    ProcessorSet processors1(3U);
+    processors1.Add(200U);
+    ProcessorSet processors2(200U);
+    processors2.Add(3U);
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    bool bResult = processors1 == processors2;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that two sets with different processors are not equal.
+/// </summary>
+ZTEST_CASE ( OperatorEquality_ReturnsFalseWhenSetsContainDifferentProcessors_Test )
+{
+    // [Preparation]
+    ProcessorSet processors1(3U);
+    ProcessorSet processors2(3U);
+    processors2.Add(200U);
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bResult = processors1 == processors2;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that two sets with different processors are different.
+/// </summary>
+ZTEST_CASE ( OperatorInequality_ReturnsTrueWhenSetsContainDifferentProcessors_Test )
+{
+    // [Preparation]
+    ProcessorSet processors1(3U);
+    ProcessorSet processors2(4U);
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    bool bResult = processors1 != processors2;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that adding a processor that is already in the set does not change it.
+/// </summary>
+ZTEST_CASE ( Add1_AddingExistingProcessorDoesNotChangeTheSet_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(5U);
+    const u32_z EXPECTED_COUNT = 1U;
+
+    // [Execution]
+    processors.Add(5U);
+
+    // [Verification]
+    BOOST_CHECK(processors.Contains(5U));
+    BOOST_CHECK_EQUAL(processors.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the last possible processor can be added.
+/// </summary>
+ZTEST_CASE ( Add1_LastProcessorCanBeAdded_Test )
+{
+    // [Preparation]
+    const u32_z INPUT_PROCESSOR = ProcessorSet::MAXIMUM_PROCESSORS - 1U;
+    ProcessorSet processors;
+
+    // [Execution]
+    processors.Add(INPUT_PROCESSOR);
+
+    // [Verification]
+    BOOST_CHECK(processors.Contains(INPUT_PROCESSOR));
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the processor is out of bounds.
+/// </summary>
+ZTEST_CASE ( Add1_AssertionFailsWhenProcessorIsOutOfBounds_Test )
+{
+    // [Preparation]
+    ProcessorSet processors;
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        processors.Add(ProcessorSet::MAXIMUM_PROCESSORS);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the result is the union of both sets.
+/// </summary>
+ZTEST_CASE ( Add2_ResultIsTheUnionOfBothSets_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(1U);
+    processors.Add(2U);
+    ProcessorSet INPUT_PROCESSORS(2U);
+    INPUT_PROCESSORS.Add(130U);
+    ProcessorSet EXPECTED_PROCESSORS(1U);
+    EXPECTED_PROCESSORS.Add(2U);
+    EXPECTED_PROCESSORS.Add(130U);
+
+    // [Execution]
+    processors.Add(INPUT_PROCESSORS);
+
+    // [Verification]
+    BOOST_CHECK(processors == EXPECTED_PROCESSORS);
+}
+
+/// <summary>
+/// Checks that the processor is removed and the others are kept.
+/// </summary>
+ZTEST_CASE ( Remove_ProcessorIsRemovedAndOthersAreKept_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(1U);
+    processors.Add(2U);
+    const ProcessorSet EXPECTED_PROCESSORS(1U);
+
+    // [Execution]
+    processors.Remove(2U);
+
+    // [Verification]
+    BOOST_CHECK(processors == EXPECTED_PROCESSORS);
+}
+
+/// <summary>
+/// Checks that the set is empty after it is cleared.
+/// </summary>
+ZTEST_CASE ( Clear_SetIsEmpty_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(1U);
+    processors.Add(900U);
+
+    // [Execution]
+    processors.Clear();
+
+    // [Verification]
+    BOOST_CHECK(processors.IsEmpty());
+}
+
+/// <summary>
+/// Checks that it returns False when the processor is not in the set.
+/// </summary>
+ZTEST_CASE ( Contains_ReturnsFalseWhenProcessorIsNotInTheSet_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(1U);
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bResult = processors.Contains(65U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that the input processor is returned when it is in the set.
+/// </summary>
+ZTEST_CASE ( GetNext_ReturnsInputProcessorWhenItIsInTheSet_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(4U);
+    processors.Add(8U);
+    const u32_z EXPECTED_PROCESSOR = 4U;
+
+    // [Execution]
+    u32_z uProcessor = processors.GetNext(4U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uProcessor, EXPECTED_PROCESSOR);
+}
+
+/// <summary>
+/// Checks that the next processor is found when it is several masks away.
+/// </summary>
+ZTEST_CASE ( GetNext_ReturnsNextProcessorWhenItIsFarAway_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(4U);
+    processors.Add(700U);
+    const u32_z EXPECTED_PROCESSOR = 700U;
+
+    // [Execution]
+    u32_z uProcessor = processors.GetNext(5U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uProcessor, EXPECTED_PROCESSOR);
+}
+
+/// <summary>
+/// Checks that NO_PROCESSOR is returned when there are no more processors.
+/// </summary>
+ZTEST_CASE ( GetNext_ReturnsNoProcessorWhenThereAreNoMoreProcessors_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(4U);
+    const u32_z EXPECTED_PROCESSOR = ProcessorSet::NO_PROCESSOR;
+
+    // [Execution]
+    u32_z uProcessor = processors.GetNext(5U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uProcessor, EXPECTED_PROCESSOR);
+}
+
+/// <summary>
+/// Checks that contiguous processors are grouped in ranges.
+/// </summary>
+ZTEST_CASE ( ToString_ContiguousProcessorsAreGroupedInRanges_Test )
+{
+    // [Preparation]
+    ProcessorSet processors;
+    processors.Add(0U);
+    processors.Add(1U);
+    processors.Add(2U);
+    processors.Add(3U);
+    processors.Add(8U);
+    processors.Add(63U);
+    processors.Add(64U);
+    const string_z EXPECTED_RESULT("0-3,8,63-64");
+
+    // [Execution]
+    string_z strResult = processors.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that an empty string is returned when the set is empty.
+/// </summary>
+ZTEST_CASE ( ToString_ReturnsEmptyStringWhenSetIsEmpty_Test )
+{
+    // [Preparation]
+    ProcessorSet processors;
+    const string_z EXPECTED_RESULT("");
+
+    // [Execution]
+    string_z strResult = processors.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns the number of processors in the set.
+/// </summary>
+ZTEST_CASE ( GetCount_ReturnsTheNumberOfProcessors_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(0U);
+    processors.Add(64U);
+    processors.Add(1023U);
+    const u32_z EXPECTED_COUNT = 3U;
+
+    // [Execution]
+    u32_z uCount = processors.GetCount();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that it returns False when the set contains any processor.
+/// </summary>
+ZTEST_CASE ( IsEmpty_ReturnsFalseWhenSetContainsProcessors_Test )
+{
+    // [Preparation]
+    ProcessorSet processors(1023U);
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bResult = processors.IsEmpty();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+// End - Test Suite: ProcessorSet
+ZTEST_SUITE_END()
@@ -0,0 +1,183 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/SFutex.h"
+
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+#include "ZThreading/SProcessorTopology.h"
+
+// Class whose methods are to be used by the threads in the tests of SFutex
+class SFutexTestClass
+{
+public:
+
+    static boost::atomic<u32_z> sm_uValue;
+    static boost::atomic<u32_z> sm_uWokenThreads;
+
+    // Sleeps until the value is not zero
+    static void WaitWhileZero()
+    {
+        while(sm_uValue.load() == 0)
+            SFutex::Wait(sm_uValue, 0);
+
+        sm_uWokenThreads.fetch_add(1U);
+    }
+};
+
+boost::atomic<u32_z> SFutexTestClass::sm_uValue(0);
+boost::atomic<u32_z> SFutexTestClass::sm_uWokenThreads(0);
+
+
+ZTEST_SUITE_BEGIN( SFutex_TestSuite )
+
+/// <summary>
+/// Checks that the thread does not sleep when the value is not the expected one.
+/// </summary>
+ZTEST_CASE ( Wait_ReturnsImmediatelyWhenValueIsNotTheExpectedOne_Test )
+{
+    // [Preparation]
+    boost::atomic<u32_z> uValue(5U);
+    const u32_z EXPECTED_VALUE = 4U;
+
+    // [Execution]
+    SFutex::Wait(uValue, EXPECTED_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uValue.load(), 5U);
+}
+
+/// <summary>
+/// Checks that a sleeping thread is woken up.
+/// </summary>
+ZTEST_CASE ( WakeOne_SleepingThreadIsWokenUp_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_WOKEN_THREADS = 1U;
+    SFutexTestClass::sm_uValue = 0;
+    SFutexTestClass::sm_uWokenThreads = 0;
+    Thread thread(Delegate<void()>(&SFutexTestClass::WaitWhileZero));
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    const u32_z WOKEN_THREADS_BEFORE_WAKING = SFutexTestClass::sm_uWokenThreads;
+
+    // [Execution]
+    SFutexTestClass::sm_uValue = 1U;
+    SFutex::WakeOne(SFutexTestClass::sm_uValue);
+
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK_EQUAL(WOKEN_THREADS_BEFORE_WAKING, 0U);
+    BOOST_CHECK_EQUAL(SFutexTestClass::sm_uWokenThreads.load(), EXPECTED_WOKEN_THREADS);
+}
+
+/// <summary>
+/// Checks that all the sleeping threads are woken up.
+/// </summary>
+ZTEST_CASE ( WakeAll_AllSleepingThreadsAreWokenUp_Test )
+{
+    // [Preparation]
+    static const u32_z NUMBER_OF_THREADS = 4U;
+    SFutexTestClass::sm_uValue = 0;
+    SFutexTestClass::sm_uWokenThreads = 0;
+    Thread* arThreads[NUMBER_OF_THREADS];
+
+    for(u32_z i = 0; i < NUMBER_OF_THREADS; ++i)
+        arThreads[i] = new Thread(Delegate<void()>(&SFutexTestClass::WaitWhileZero));
+
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+
+    // [Execution]
+    SFutexTestClass::sm_uValue = 1U;
+    SFutex::WakeAll(SFutexTestClass::sm_uValue);
+
+    // [Verification]
+    for(u32_z i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    BOOST_CHECK_EQUAL(SFutexTestClass::sm_uWokenThreads.load(), NUMBER_OF_THREADS);
+}
+
+/// <summary>
+/// Checks that it returns False when nobody wakes the thread up before the maximum time elapses.
+/// </summary>
+ZTEST_CASE ( Wait_ReturnsFalseWhenTimeoutElapses_Test )
+{
+    // [Preparation]
+    boost::atomic<u32_z> uValue(0);
+    const u32_z EXPECTED_VALUE = 0;
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bResult = SFutex::Wait(uValue, EXPECTED_VALUE, TimeSpan(0, 0, 0, 0, 50, 0, 0));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns True without waiting when the value is not the expected one.
+/// </summary>
+ZTEST_CASE ( Wait_ReturnsTrueImmediatelyWhenValueIsNotTheExpectedOneAndTimeoutIsUsed_Test )
+{
+    // [Preparation]
+    boost::atomic<u32_z> uValue(5U);
+    const u32_z EXPECTED_VALUE = 4U;
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    bool bResult = SFutex::Wait(uValue, EXPECTED_VALUE, TimeSpan(0, 0, 0, 10, 0, 0, 0));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that threads do not spin when there is only one logical processor and that they spin the maximum otherwise.
+/// </summary>
+ZTEST_CASE ( GetSpinCount_DependsOnNumberOfProcessors_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_SPIN_COUNT = SProcessorTopology::GetLogicalProcessorCount() > 1U ? SFutex::MAXIMUM_SPIN_COUNT : 0;
+
+    // [Execution]
+    u32_z uSpinCount = SFutex::GetSpinCount();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uSpinCount, EXPECTED_SPIN_COUNT);
+}
+
+// End - Test Suite: SFutex
+ZTEST_SUITE_END()
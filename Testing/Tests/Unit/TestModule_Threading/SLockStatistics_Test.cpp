@@ -0,0 +1,335 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/SLockStatistics.h"
+
+#include "ZThreading/Mutex.h"
+#include "ZThreading/SharedMutex.h"
+#include "ZThreading/ScopedExclusiveLock.h"
+#include "ZThreading/ScopedSharedLock.h"
+#include "ZThreading/Thread.h"
+#include "ZThreading/SThisThread.h"
+
+// Class whose methods are to be used by the threads and the exporters in the tests of SLockStatistics
+class SLockStatisticsTestClass
+{
+public:
+
+    static Mutex* sm_pMutex;
+    static u32_z sm_uExportedCount;
+
+    // Locks and unlocks the mutex
+    static void LockMutex()
+    {
+        sm_pMutex->Lock();
+        sm_pMutex->Unlock();
+    }
+
+    // Locks and unlocks the mutex many times
+    static void LockMutexManyTimes()
+    {
+        for(u32_z i = 0; i < 100U; ++i)
+        {
+            sm_pMutex->Lock();
+            sm_pMutex->Unlock();
+        }
+    }
+
+    // Counts the statistics it receives
+    static void CountStatistics(const LockStatistics &statistics)
+    {
+        (void)statistics;
+        ++sm_uExportedCount;
+    }
+};
+
+Mutex* SLockStatisticsTestClass::sm_pMutex = null_z;
+u32_z SLockStatisticsTestClass::sm_uExportedCount = 0;
+
+
+ZTEST_SUITE_BEGIN( SLockStatistics_TestSuite )
+
+/// <summary>
+/// Checks that it returns whether statistics are recorded, depending on the configuration.
+/// </summary>
+ZTEST_CASE ( IsEnabled_DependsOnConfiguration_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED;
+
+    // [Execution]
+    bool bResult = SLockStatistics::IsEnabled();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that all the statistics are zero for a name that was never used.
+/// </summary>
+ZTEST_CASE ( GetStatistics_StatisticsOfUnusedNameAreZero_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_NAME("SLockStatisticsTest.Unused");
+    const u64_z EXPECTED_COUNT = 0;
+
+    // [Execution]
+    LockStatistics statistics = SLockStatistics::GetStatistics("SLockStatisticsTest.Unused");
+
+    // [Verification]
+    BOOST_CHECK(statistics.GetName() == EXPECTED_NAME);
+    BOOST_CHECK_EQUAL(statistics.GetAcquisitionCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetContendedAcquisitionCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetHoldCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the exporter receives the statistics of every lock name.
+/// </summary>
+ZTEST_CASE ( Dump_ExporterReceivesEveryLockName_Test )
+{
+    // [Preparation]
+    Mutex mutex("SLockStatisticsTest.Dump");
+    mutex.Lock();
+    mutex.Unlock();
+    SLockStatisticsTestClass::sm_uExportedCount = 0;
+    const u32_z EXPECTED_COUNT = SLockStatistics::GetLockNameCount();
+
+    // [Execution]
+    SLockStatistics::Dump(Delegate<void (const LockStatistics&)>(&SLockStatisticsTestClass::CountStatistics));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(SLockStatisticsTestClass::sm_uExportedCount, EXPECTED_COUNT);
+}
+
+#if Z_CONFIG_LOCKSTATISTICS_DEFAULT == Z_CONFIG_LOCKSTATISTICS_ENABLED
+
+/// <summary>
+/// Checks that acquisitions and holds of a mutex are recorded under its name.
+/// </summary>
+ZTEST_CASE ( GetStatistics_AcquisitionsAndHoldsOfMutexAreRecorded_Test )
+{
+    // [Preparation]
+    Mutex mutex("SLockStatisticsTest.Mutex");
+    const u64_z EXPECTED_ACQUISITION_COUNT = 3U;
+    const u64_z EXPECTED_CONTENDED_ACQUISITION_COUNT = 0;
+    const u64_z EXPECTED_HOLD_COUNT = 3U;
+
+    // [Execution]
+    mutex.Lock();
+    mutex.Unlock();
+    mutex.TryLock();
+    mutex.Unlock();
+
+    {
+        ScopedExclusiveLock<> lock(mutex);
+    }
+
+    // [Verification]
+    LockStatistics statistics = SLockStatistics::GetStatistics("SLockStatisticsTest.Mutex");
+    BOOST_CHECK_EQUAL(statistics.GetAcquisitionCount(), EXPECTED_ACQUISITION_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetContendedAcquisitionCount(), EXPECTED_CONTENDED_ACQUISITION_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetHoldCount(), EXPECTED_HOLD_COUNT);
+}
+
+/// <summary>
+/// Checks that an acquisition that has to wait for another thread is recorded as contended, with its wait time.
+/// </summary>
+ZTEST_CASE ( GetStatistics_ContendedAcquisitionIsRecorded_Test )
+{
+    // [Preparation]
+    Mutex mutex("SLockStatisticsTest.Contended");
+    SLockStatisticsTestClass::sm_pMutex = &mutex;
+    const u64_z EXPECTED_CONTENDED_ACQUISITION_COUNT = 1U;
+    const u64_z MINIMUM_WAIT_NANOSECONDS = 20000000ULL;
+
+    // [Execution]
+    mutex.Lock();
+    Thread thread(Delegate<void()>(&SLockStatisticsTestClass::LockMutex));
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    mutex.Unlock();
+    thread.Join();
+
+    // [Verification]
+    LockStatistics statistics = SLockStatistics::GetStatistics("SLockStatisticsTest.Contended");
+    const u32_z WAIT_BUCKET = LockStatistics::GetHistogramBucket(statistics.GetWaitTime().GetHundredsOfNanoseconds() * 100ULL);
+    BOOST_CHECK_EQUAL(statistics.GetContendedAcquisitionCount(), EXPECTED_CONTENDED_ACQUISITION_COUNT);
+    BOOST_CHECK(statistics.GetWaitTime().GetHundredsOfNanoseconds() * 100ULL >= MINIMUM_WAIT_NANOSECONDS);
+    BOOST_CHECK_EQUAL(statistics.GetWaitTimeHistogram(WAIT_BUCKET), EXPECTED_CONTENDED_ACQUISITION_COUNT);
+    BOOST_CHECK(statistics.GetHoldTime().GetHundredsOfNanoseconds() * 100ULL >= MINIMUM_WAIT_NANOSECONDS);
+}
+
+/// <summary>
+/// Checks that the statistics recorded by all the threads, including those that ended, are added up.
+/// </summary>
+ZTEST_CASE ( GetStatistics_StatisticsOfAllThreadsAreAddedUp_Test )
+{
+    // [Preparation]
+    static const u32_z NUMBER_OF_THREADS = 4U;
+    Mutex mutex("SLockStatisticsTest.Threads");
+    SLockStatisticsTestClass::sm_pMutex = &mutex;
+    Thread* arThreads[NUMBER_OF_THREADS];
+    const u64_z EXPECTED_ACQUISITION_COUNT = NUMBER_OF_THREADS * 100U;
+
+    // [Execution]
+    for(u32_z i = 0; i < NUMBER_OF_THREADS; ++i)
+        arThreads[i] = new Thread(Delegate<void()>(&SLockStatisticsTestClass::LockMutexManyTimes));
+
+    for(u32_z i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    LockStatistics statistics = SLockStatistics::GetStatistics("SLockStatisticsTest.Threads");
+    BOOST_CHECK_EQUAL(statistics.GetAcquisitionCount(), EXPECTED_ACQUISITION_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetHoldCount(), EXPECTED_ACQUISITION_COUNT);
+}
+
+/// <summary>
+/// Checks that shared mutexes record acquisitions in both modes but only the holds in exclusive mode.
+/// </summary>
+ZTEST_CASE ( GetStatistics_OnlyExclusiveHoldsOfSharedMutexAreRecorded_Test )
+{
+    // [Preparation]
+    SharedMutex mutex("SLockStatisticsTest.SharedMutex");
+    const u64_z EXPECTED_ACQUISITION_COUNT = 4U;
+    const u64_z EXPECTED_HOLD_COUNT = 2U;
+
+    // [Execution]
+    {
+        ScopedSharedLock<> lock(mutex);
+    }
+
+    {
+        ScopedExclusiveLock<SharedMutex> lock(mutex);
+    }
+
+    mutex.TryLockShared();
+    mutex.UnlockShared();
+    mutex.TryLock();
+    mutex.Unlock();
+
+    // [Verification]
+    LockStatistics statistics = SLockStatistics::GetStatistics("SLockStatisticsTest.SharedMutex");
+    BOOST_CHECK_EQUAL(statistics.GetAcquisitionCount(), EXPECTED_ACQUISITION_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetHoldCount(), EXPECTED_HOLD_COUNT);
+}
+
+/// <summary>
+/// Checks that all the locks with the same name add up their statistics.
+/// </summary>
+ZTEST_CASE ( GetStatistics_LocksWithSameNameShareStatistics_Test )
+{
+    // [Preparation]
+    Mutex mutex1("SLockStatisticsTest.SameName");
+    Mutex mutex2("SLockStatisticsTest.SameName");
+    const u32_z EXPECTED_NAME_COUNT = SLockStatistics::GetLockNameCount();
+    const u64_z EXPECTED_ACQUISITION_COUNT = 2U;
+
+    // [Execution]
+    mutex1.Lock();
+    mutex1.Unlock();
+    mutex2.Lock();
+    mutex2.Unlock();
+
+    // [Verification]
+    LockStatistics statistics = SLockStatistics::GetStatistics("SLockStatisticsTest.SameName");
+    BOOST_CHECK_EQUAL(statistics.GetAcquisitionCount(), EXPECTED_ACQUISITION_COUNT);
+    BOOST_CHECK_EQUAL(SLockStatistics::GetLockNameCount(), EXPECTED_NAME_COUNT);
+}
+
+/// <summary>
+/// Checks that locks without a name are recorded under the name of their type.
+/// </summary>
+ZTEST_CASE ( GetStatistics_UnnamedLocksAreRecordedUnderTypeName_Test )
+{
+    // [Preparation]
+    Mutex mutex;
+    SharedMutex sharedMutex;
+    const u64_z MUTEX_ACQUISITIONS_BEFORE = SLockStatistics::GetStatistics("Mutex").GetAcquisitionCount();
+    const u64_z SHARED_MUTEX_ACQUISITIONS_BEFORE = SLockStatistics::GetStatistics("SharedMutex").GetAcquisitionCount();
+
+    // [Execution]
+    mutex.Lock();
+    mutex.Unlock();
+    sharedMutex.LockShared();
+    sharedMutex.UnlockShared();
+
+    // [Verification]
+    BOOST_CHECK(SLockStatistics::GetStatistics("Mutex").GetAcquisitionCount() > MUTEX_ACQUISITIONS_BEFORE);
+    BOOST_CHECK(SLockStatistics::GetStatistics("SharedMutex").GetAcquisitionCount() > SHARED_MUTEX_ACQUISITIONS_BEFORE);
+}
+
+/// <summary>
+/// Checks that a lock whose name is null is not tracked.
+/// </summary>
+ZTEST_CASE ( Constructor_LockWithNullNameIsNotTracked_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_NAME_COUNT = SLockStatistics::GetLockNameCount();
+
+    // [Execution]
+    Mutex mutex(null_z);
+    mutex.Lock();
+    mutex.Unlock();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(SLockStatistics::GetLockNameCount(), EXPECTED_NAME_COUNT);
+}
+
+#else
+
+/// <summary>
+/// Checks that locks do not record anything when statistics are disabled.
+/// </summary>
+ZTEST_CASE ( GetLockNameCount_NothingIsRecordedWhenDisabled_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_NAME_COUNT = 0;
+    Mutex mutex("SLockStatisticsTest.Disabled");
+
+    // [Execution]
+    mutex.Lock();
+    mutex.Unlock();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(SLockStatistics::GetLockNameCount(), EXPECTED_NAME_COUNT);
+    BOOST_CHECK_EQUAL(SLockStatistics::GetStatistics("SLockStatisticsTest.Disabled").GetAcquisitionCount(), 0U);
+}
+
+#endif
+
+// End - Test Suite: SLockStatistics
+ZTEST_SUITE_END()
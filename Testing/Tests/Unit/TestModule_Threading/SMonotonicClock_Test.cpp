@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/SMonotonicClock.h"
+
+#include "ZThreading/SThisThread.h"
+
+
+ZTEST_SUITE_BEGIN( SMonotonicClock_TestSuite )
+
+/// <summary>
+/// Checks that the instant never goes backwards.
+/// </summary>
+ZTEST_CASE ( GetNanoseconds_NeverDecreases_Test )
+{
+    // [Preparation]
+    const u64_z FIRST_INSTANT = SMonotonicClock::GetNanoseconds();
+
+    // [Execution]
+    u64_z uSecondInstant = SMonotonicClock::GetNanoseconds();
+
+    // [Verification]
+    BOOST_CHECK(uSecondInstant >= FIRST_INSTANT);
+}
+
+/// <summary>
+/// Checks that the elapsed time is at least the time the thread slept.
+/// </summary>
+ZTEST_CASE ( GetNanoseconds_MeasuresAtLeastTheSleptTime_Test )
+{
+    // [Preparation]
+    const u64_z START_INSTANT = SMonotonicClock::GetNanoseconds();
+    const u64_z EXPECTED_MINIMUM_NANOSECONDS = 10000000ULL;
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(100000ULL));
+
+    // [Verification]
+    u64_z uElapsedNanoseconds = SMonotonicClock::GetNanoseconds() - START_INSTANT;
+    BOOST_CHECK(uElapsedNanoseconds >= EXPECTED_MINIMUM_NANOSECONDS);
+}
+
+// End - Test Suite: SMonotonicClock
+ZTEST_SUITE_END()
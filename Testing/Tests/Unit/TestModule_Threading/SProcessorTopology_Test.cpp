@@ -0,0 +1,263 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+// Note: The topology depends on the machine so tests only check that the information is consistent
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/SProcessorTopology.h"
+
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( SProcessorTopology_TestSuite )
+
+/// <summary>
+/// Checks that the core of every processor is lower than the number of cores.
+/// </summary>
+ZTEST_CASE ( GetCore_CoreIsLowerThanNumberOfCores_Test )
+{
+    // [Preparation]
+    const u32_z PROCESSOR_COUNT = SProcessorTopology::GetLogicalProcessorCount();
+    const u32_z CORE_COUNT = SProcessorTopology::GetCoreCount();
+
+    for(u32_z i = 0; i < PROCESSOR_COUNT; ++i)
+    {
+        // [Execution]
+        u32_z uCore = SProcessorTopology::GetCore(i);
+
+        // [Verification]
+        BOOST_CHECK(uCore < CORE_COUNT);
+    }
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the processor does not exist.
+/// </summary>
+ZTEST_CASE ( GetCore_AssertionFailsWhenProcessorDoesNotExist_Test )
+{
+    // [Preparation]
+    const u32_z INPUT_PROCESSOR = SProcessorTopology::GetLogicalProcessorCount();
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        SProcessorTopology::GetCore(INPUT_PROCESSOR);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the package of every processor is lower than the number of packages.
+/// </summary>
+ZTEST_CASE ( GetPackage_PackageIsLowerThanNumberOfPackages_Test )
+{
+    // [Preparation]
+    const u32_z PROCESSOR_COUNT = SProcessorTopology::GetLogicalProcessorCount();
+    const u32_z PACKAGE_COUNT = SProcessorTopology::GetPackageCount();
+
+    for(u32_z i = 0; i < PROCESSOR_COUNT; ++i)
+    {
+        // [Execution]
+        u32_z uPackage = SProcessorTopology::GetPackage(i);
+
+        // [Verification]
+        BOOST_CHECK(uPackage < PACKAGE_COUNT);
+    }
+}
+
+/// <summary>
+/// Checks that the NUMA node of every processor is lower than the number of NUMA nodes.
+/// </summary>
+ZTEST_CASE ( GetNumaNode_NodeIsLowerThanNumberOfNodes_Test )
+{
+    // [Preparation]
+    const u32_z PROCESSOR_COUNT = SProcessorTopology::GetLogicalProcessorCount();
+    const u32_z NODE_COUNT = SProcessorTopology::GetNumaNodeCount();
+
+    for(u32_z i = 0; i < PROCESSOR_COUNT; ++i)
+    {
+        // [Execution]
+        u32_z uNode = SProcessorTopology::GetNumaNode(i);
+
+        // [Verification]
+        BOOST_CHECK(uNode < NODE_COUNT);
+    }
+}
+
+/// <summary>
+/// Checks that all the SMT siblings of a processor belong to the same core.
+/// </summary>
+ZTEST_CASE ( GetSmtSiblings_AllSiblingsBelongToTheSameCore_Test )
+{
+    // [Preparation]
+    const u32_z INPUT_PROCESSOR = 0;
+    const u32_z EXPECTED_CORE = SProcessorTopology::GetCore(INPUT_PROCESSOR);
+
+    // [Execution]
+    ProcessorSet siblings = SProcessorTopology::GetSmtSiblings(INPUT_PROCESSOR);
+
+    // [Verification]
+    BOOST_CHECK(siblings.Contains(INPUT_PROCESSOR));
+
+    for(u32_z i = siblings.GetNext(0); i != ProcessorSet::NO_PROCESSOR; i = siblings.GetNext(i + 1U))
+        BOOST_CHECK_EQUAL(SProcessorTopology::GetCore(i), EXPECTED_CORE);
+}
+
+/// <summary>
+/// Checks that the processors that share the L3 cache include those that share the L2 cache.
+/// </summary>
+ZTEST_CASE ( GetProcessorsSharingCache_L3ProcessorsIncludeL2Processors_Test )
+{
+    // [Preparation]
+    const u32_z INPUT_PROCESSOR = 0;
+
+    // [Execution]
+    ProcessorSet l2Processors = SProcessorTopology::GetProcessorsSharingCache(INPUT_PROCESSOR, 2U);
+    ProcessorSet l3Processors = SProcessorTopology::GetProcessorsSharingCache(INPUT_PROCESSOR, 3U);
+
+    // [Verification]
+    BOOST_CHECK(l2Processors.Contains(INPUT_PROCESSOR));
+    BOOST_CHECK(l3Processors.Contains(INPUT_PROCESSOR));
+    BOOST_CHECK(l3Processors.GetCount() >= l2Processors.GetCount());
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the level of the cache is not 2 or 3.
+/// </summary>
+ZTEST_CASE ( GetProcessorsSharingCache_AssertionFailsWhenCacheLevelIsNotValid_Test )
+{
+    // [Preparation]
+    const u32_z INPUT_LEVEL = 1U;
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        SProcessorTopology::GetProcessorsSharingCache(0, INPUT_LEVEL);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the processors of all the packages are all the processors.
+/// </summary>
+ZTEST_CASE ( GetPackageProcessors_ProcessorsOfAllPackagesAreAllTheProcessors_Test )
+{
+    // [Preparation]
+    const u32_z PACKAGE_COUNT = SProcessorTopology::GetPackageCount();
+    const ProcessorSet EXPECTED_PROCESSORS = SProcessorTopology::GetAllProcessors();
+    ProcessorSet processors;
+
+    // [Execution]
+    for(u32_z i = 0; i < PACKAGE_COUNT; ++i)
+        processors.Add(SProcessorTopology::GetPackageProcessors(i));
+
+    // [Verification]
+    BOOST_CHECK(processors == EXPECTED_PROCESSORS);
+}
+
+/// <summary>
+/// Checks that the processors of all the NUMA nodes are all the processors.
+/// </summary>
+ZTEST_CASE ( GetNumaNodeProcessors_ProcessorsOfAllNodesAreAllTheProcessors_Test )
+{
+    // [Preparation]
+    const u32_z NODE_COUNT = SProcessorTopology::GetNumaNodeCount();
+    const ProcessorSet EXPECTED_PROCESSORS = SProcessorTopology::GetAllProcessors();
+    ProcessorSet processors;
+
+    // [Execution]
+    for(u32_z i = 0; i < NODE_COUNT; ++i)
+        processors.Add(SProcessorTopology::GetNumaNodeProcessors(i));
+
+    // [Verification]
+    BOOST_CHECK(processors == EXPECTED_PROCESSORS);
+}
+
+/// <summary>
+/// Checks that it returns as many processors as logical processors there are.
+/// </summary>
+ZTEST_CASE ( GetAllProcessors_ContainsAsManyProcessorsAsLogicalProcessors_Test )
+{
+    // [Preparation]
+    const u32_z EXPECTED_COUNT = SProcessorTopology::GetLogicalProcessorCount();
+
+    // [Execution]
+    ProcessorSet processors = SProcessorTopology::GetAllProcessors();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(processors.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the number of logical processors is not lower than the number of cores and the number of cores is not lower than the number of packages.
+/// </summary>
+ZTEST_CASE ( GetLogicalProcessorCount_CountsAreConsistent_Test )
+{
+    // [Preparation]
+
+    // [Execution]
+    u32_z uProcessorCount = SProcessorTopology::GetLogicalProcessorCount();
+    u32_z uCoreCount = SProcessorTopology::GetCoreCount();
+    u32_z uPackageCount = SProcessorTopology::GetPackageCount();
+    u32_z uNodeCount = SProcessorTopology::GetNumaNodeCount();
+
+    // [Verification]
+    BOOST_CHECK(uPackageCount > 0);
+    BOOST_CHECK(uNodeCount > 0);
+    BOOST_CHECK(uCoreCount >= uPackageCount);
+    BOOST_CHECK(uProcessorCount >= uCoreCount);
+}
+
+// End - Test Suite: SProcessorTopology
+ZTEST_SUITE_END()
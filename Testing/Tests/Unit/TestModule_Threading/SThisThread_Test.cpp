@@ -70,8 +70,17 @@ public:
     {
         SThisThread::SetExitFunction(&SThisThreadTestClass::ExitFunction);
     }
+
+    static void GetScratchAllocatorInAnotherThread()
+    {
+        sm_pOtherThreadScratchAllocator = &SThisThread::GetScratchAllocator();
+    }
+
+    static ScratchAllocator* sm_pOtherThreadScratchAllocator;
 };
 
+ScratchAllocator* SThisThreadTestClass::sm_pOtherThreadScratchAllocator = null_z;
+
 bool SThisThreadTestClass::sm_bContinue = false;
 bool SThisThreadTestClass::sm_bFunctionInterrupted = false;
 bool SThisThreadTestClass::sm_bExitFunctionCalled = false;
@@ -344,5 +353,103 @@ ZTEST_CASE ( GetPriority_PriorityIsCorrectlyObtained_Test )
                 ePriority == EThreadPriority::E_Highest);
 }
 
+/// <summary>
+/// Checks that the affinity of the calling thread is changed when it contains only one processor.
+/// </summary>
+ZTEST_CASE ( SetAffinity_AffinityIsCorrectlySetWhenItContainsOneProcessor_Test )
+{
+    // [Preparation]
+    const ProcessorSet ORIGINAL_PROCESSORS = SThisThread::GetAffinity();
+    const ProcessorSet INPUT_PROCESSORS(ORIGINAL_PROCESSORS.GetNext(0));
+#if defined(Z_OS_WINDOWS) || defined(Z_OS_LINUX)
+    const bool EXPECTED_RESULT = true;
+    const ProcessorSet EXPECTED_PROCESSORS = INPUT_PROCESSORS;
+#elif defined(Z_OS_MAC)
+    const bool EXPECTED_RESULT = false;
+    const ProcessorSet EXPECTED_PROCESSORS = ORIGINAL_PROCESSORS;
+#endif
+
+    // [Execution]
+    bool bResult = SThisThread::SetAffinity(INPUT_PROCESSORS);
+
+    // [Verification]
+    ProcessorSet processors = SThisThread::GetAffinity();
+    SThisThread::SetAffinity(ORIGINAL_PROCESSORS);
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK(processors == EXPECTED_PROCESSORS);
+}
+
+/// <summary>
+/// Checks that the affinity of the calling thread is not empty.
+/// </summary>
+ZTEST_CASE ( GetAffinity_AffinityIsNotEmpty_Test )
+{
+    // [Preparation]
+
+    // [Execution]
+    ProcessorSet processors = SThisThread::GetAffinity();
+
+    // [Verification]
+    BOOST_CHECK(!processors.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the processor that executes the thread is the one it is bound to.
+/// </summary>
+ZTEST_CASE ( GetCurrentProcessor_ReturnsTheProcessorTheThreadIsBoundTo_Test )
+{
+    // [Preparation]
+    const ProcessorSet ORIGINAL_PROCESSORS = SThisThread::GetAffinity();
+#if defined(Z_OS_WINDOWS) || defined(Z_OS_LINUX)
+    const u32_z EXPECTED_PROCESSOR = ORIGINAL_PROCESSORS.GetNext(0);
+#elif defined(Z_OS_MAC)
+    const u32_z EXPECTED_PROCESSOR = 0;
+#endif
+    SThisThread::SetAffinity(ProcessorSet(ORIGINAL_PROCESSORS.GetNext(0)));
+    SThisThread::Yield(); // The thread is moved to the processor, at most, when it is scheduled again
+
+    // [Execution]
+    u32_z uProcessor = SThisThread::GetCurrentProcessor();
+
+    // [Verification]
+    SThisThread::SetAffinity(ORIGINAL_PROCESSORS);
+    BOOST_CHECK_EQUAL(uProcessor, EXPECTED_PROCESSOR);
+}
+
+/// <summary>
+/// Checks that the same allocator, with the default size, is returned every time it is called from the same thread.
+/// </summary>
+ZTEST_CASE ( GetScratchAllocator_ReturnsSameAllocatorInSameThread_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_SIZE = ScratchAllocator::DEFAULT_SIZE;
+    ScratchAllocator* pExpectedAllocator = &SThisThread::GetScratchAllocator();
+
+    // [Execution]
+    ScratchAllocator* pAllocator = &SThisThread::GetScratchAllocator();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pAllocator, pExpectedAllocator);
+    BOOST_CHECK_EQUAL(pAllocator->GetSize(), EXPECTED_SIZE);
+}
+
+/// <summary>
+/// Checks that every thread gets a different allocator.
+/// </summary>
+ZTEST_CASE ( GetScratchAllocator_ReturnsDifferentAllocatorInEveryThread_Test )
+{
+    // [Preparation]
+    SThisThreadTestClass::sm_pOtherThreadScratchAllocator = null_z;
+    ScratchAllocator* pThisThreadAllocator = &SThisThread::GetScratchAllocator();
+
+    // [Execution]
+    Thread thread(Delegate<void()>(&SThisThreadTestClass::GetScratchAllocatorInAnotherThread));
+    thread.Join();
+
+    // [Verification]
+    BOOST_CHECK(SThisThreadTestClass::sm_pOtherThreadScratchAllocator != null_z);
+    BOOST_CHECK(SThisThreadTestClass::sm_pOtherThreadScratchAllocator != pThisThreadAllocator);
+}
+
 // End - Test Suite: SThisThread
 ZTEST_SUITE_END()
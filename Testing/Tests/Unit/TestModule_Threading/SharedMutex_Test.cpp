@@ -24,7 +24,7 @@
 // Kinesis Team                                                                  //
 //-------------------------------------------------------------------------------//
 
-// Note: Testing a mutex is so hard. Since Boost is used as underlying implementation and it has been already tested both by the dev team and many users, our testing effort is reduced
+// Note: Testing a mutex is so hard. Tests with several threads can only prove that it fails, not that it works in every possible interleaving
 
 #include <boost/test/auto_unit_test.hpp>
 #include <boost/test/unit_test_log.hpp>
@@ -95,6 +95,49 @@ public:
         --sm_uThreadCounter;
     }
 
+    static void LockAndSetFlag()
+    {
+        sm_mutex.Lock();
+        sm_bFlag = true;
+        sm_mutex.Unlock();
+    }
+
+    static void LockSharedAndSetFlag()
+    {
+        sm_mutex.LockShared();
+        sm_bFlag = true;
+        sm_mutex.UnlockShared();
+    }
+
+    // Writers increment both halves of the resource; readers check that they are always equal
+    static void ReadOrWrite(unsigned int uThreadIndex)
+    {
+        for(unsigned int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+        {
+            if((i + uThreadIndex) % 8U == 0)
+            {
+                sm_mutex.Lock();
+                ++sm_uFirstHalf;
+                ++sm_uSecondHalf;
+                sm_mutex.Unlock();
+            }
+            else
+            {
+                sm_mutex.LockShared();
+                const bool HALVES_ARE_EQUAL = sm_uFirstHalf == sm_uSecondHalf;
+                sm_mutex.UnlockShared();
+
+                if(!HALVES_ARE_EQUAL)
+                    sm_bOneThreadAtATime = false;
+            }
+        }
+    }
+
+    static const unsigned int OPERATIONS_PER_THREAD = 20000U;
+    static bool sm_bFlag;
+    static unsigned int sm_uFirstHalf;
+    static unsigned int sm_uSecondHalf;
+
     static unsigned int sm_uSharedResource;
     static bool sm_bOneThreadAtATime;
     static SharedMutex sm_mutex;
@@ -105,6 +148,9 @@ SharedMutex SharedMutexTestClass::sm_mutex;
 unsigned int SharedMutexTestClass::sm_uThreadCounter = 0;
 unsigned int SharedMutexTestClass::sm_uSharedResource;
 bool SharedMutexTestClass::sm_bOneThreadAtATime = true;
+bool SharedMutexTestClass::sm_bFlag = false;
+unsigned int SharedMutexTestClass::sm_uFirstHalf = 0;
+unsigned int SharedMutexTestClass::sm_uSecondHalf = 0;
 
 
 ZTEST_SUITE_BEGIN( SharedMutex_TestSuite )
@@ -277,5 +323,79 @@ ZTEST_CASE ( TryLockShared_ReturnsFalseWhenMutexWasLockedExclusive_Test )
     mutex.Unlock();
 }
 
+/// <summary>
+/// Checks that a thread that wants to lock the mutex exclusively waits until all the readers unlock it.
+/// </summary>
+ZTEST_CASE ( Lock_WaitsUntilAllReadersUnlockTheMutex_Test )
+{
+    // [Preparation]
+    SharedMutexTestClass::sm_bFlag = false;
+    SharedMutexTestClass::sm_mutex.LockShared();
+    SharedMutexTestClass::sm_mutex.LockShared();
+    Thread thread(Delegate<void()>(SharedMutexTestClass::LockAndSetFlag));
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    SharedMutexTestClass::sm_mutex.UnlockShared();
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    const bool FLAG_BEFORE_LAST_UNLOCK = SharedMutexTestClass::sm_bFlag;
+    SharedMutexTestClass::sm_mutex.UnlockShared();
+    
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK(!FLAG_BEFORE_LAST_UNLOCK);
+    BOOST_CHECK(SharedMutexTestClass::sm_bFlag);
+}
+
+/// <summary>
+/// Checks that a thread that wants to lock the mutex in shared mode waits until the thread that locked it exclusively unlocks it.
+/// </summary>
+ZTEST_CASE ( LockShared_WaitsUntilWriterUnlocksTheMutex_Test )
+{
+    // [Preparation]
+    SharedMutexTestClass::sm_bFlag = false;
+    SharedMutexTestClass::sm_mutex.Lock();
+    Thread thread(Delegate<void()>(SharedMutexTestClass::LockSharedAndSetFlag));
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    const bool FLAG_BEFORE_UNLOCKING = SharedMutexTestClass::sm_bFlag;
+    SharedMutexTestClass::sm_mutex.Unlock();
+    
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK(!FLAG_BEFORE_UNLOCKING);
+    BOOST_CHECK(SharedMutexTestClass::sm_bFlag);
+}
+
+/// <summary>
+/// Checks that readers never see the changes of a writer half done when many threads compete for the mutex.
+/// </summary>
+ZTEST_CASE ( LockShared_ReadersNeverSeeUnfinishedChangesWhenManyThreadsCompeteForTheMutex_Test )
+{
+    // [Preparation]
+    static const unsigned int NUMBER_OF_THREADS = 8U;
+    const unsigned int EXPECTED_WRITES = NUMBER_OF_THREADS * SharedMutexTestClass::OPERATIONS_PER_THREAD / 8U;
+    SharedMutexTestClass::Reset();
+    SharedMutexTestClass::sm_uFirstHalf = 0;
+    SharedMutexTestClass::sm_uSecondHalf = 0;
+    Thread* arThreads[NUMBER_OF_THREADS];
+
+    // [Execution]
+    for(unsigned int i = 0; i < NUMBER_OF_THREADS; ++i)
+        arThreads[i] = new Thread(Delegate<void(unsigned int)>(SharedMutexTestClass::ReadOrWrite), i);
+
+    for(unsigned int i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+    
+    // [Verification]
+    BOOST_CHECK(SharedMutexTestClass::sm_bOneThreadAtATime);
+    BOOST_CHECK_EQUAL(SharedMutexTestClass::sm_uFirstHalf, EXPECTED_WRITES);
+    BOOST_CHECK_EQUAL(SharedMutexTestClass::sm_uSecondHalf, EXPECTED_WRITES);
+}
+
 // End - Test Suite: SharedMutex
 ZTEST_SUITE_END()
@@ -0,0 +1,152 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZThreading/ThreadLocalObjectPool.h"
+
+#include "ZThreading/Thread.h"
+
+// Class whose methods are to be used by the threads in the tests of ThreadLocalObjectPool
+class ThreadLocalObjectPoolTestClass
+{
+public:
+
+    static ThreadLocalObjectPool<int> sm_pool;
+    static ObjectPool<int>* sm_pOtherThreadPool;
+    static int sm_nOtherThreadValue;
+
+    static void BorrowAndReturnInAnotherThread()
+    {
+        sm_pOtherThreadPool = &sm_pool.GetThreadPool();
+
+        int* pValue = sm_pool.Borrow(3);
+        sm_nOtherThreadValue = *pValue;
+        sm_pool.Return(pValue);
+    }
+};
+
+ThreadLocalObjectPool<int> ThreadLocalObjectPoolTestClass::sm_pool(2U);
+ObjectPool<int>* ThreadLocalObjectPoolTestClass::sm_pOtherThreadPool = null_z;
+int ThreadLocalObjectPoolTestClass::sm_nOtherThreadValue = 0;
+
+
+ZTEST_SUITE_BEGIN( ThreadLocalObjectPool_TestSuite )
+
+/// <summary>
+/// Checks that the pool of every thread has the capacity passed to the constructor.
+/// </summary>
+ZTEST_CASE ( Constructor_PoolOfThreadHasExpectedCapacity_Test )
+{
+    // [Preparation]
+    const puint_z EXPECTED_CAPACITY = 4U;
+
+    // [Execution]
+    ThreadLocalObjectPool<int> pool(EXPECTED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pool.GetCapacityPerThread(), EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(pool.GetThreadPool().GetCapacity(), EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that objects are borrowed from the pool of the calling thread.
+/// </summary>
+ZTEST_CASE ( Borrow2_ObjectIsBorrowedFromPoolOfCallingThread_Test )
+{
+    // [Preparation]
+    ThreadLocalObjectPool<int> pool(2U);
+    const int EXPECTED_VALUE = 5;
+    const puint_z EXPECTED_BORROWED_COUNT = 1U;
+
+    // [Execution]
+    int* pValue = pool.Borrow(EXPECTED_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*pValue, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(pool.GetThreadPool().GetBorrowedCount(), EXPECTED_BORROWED_COUNT);
+    pool.Return(pValue);
+}
+
+/// <summary>
+/// Checks that returned objects go back to the pool of the calling thread.
+/// </summary>
+ZTEST_CASE ( Return_ObjectIsReturnedToPoolOfCallingThread_Test )
+{
+    // [Preparation]
+    ThreadLocalObjectPool<int> pool(2U);
+    int* pValue = pool.Borrow();
+    const puint_z EXPECTED_BORROWED_COUNT = 0;
+
+    // [Execution]
+    pool.Return(pValue);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pool.GetThreadPool().GetBorrowedCount(), EXPECTED_BORROWED_COUNT);
+}
+
+/// <summary>
+/// Checks that every thread uses a different pool.
+/// </summary>
+ZTEST_CASE ( GetThreadPool_EveryThreadUsesDifferentPool_Test )
+{
+    // [Preparation]
+    ObjectPool<int>* pThisThreadPool = &ThreadLocalObjectPoolTestClass::sm_pool.GetThreadPool();
+    const int EXPECTED_VALUE = 3;
+
+    // [Execution]
+    Thread thread(Delegate<void()>(&ThreadLocalObjectPoolTestClass::BorrowAndReturnInAnotherThread));
+    thread.Join();
+
+    // [Verification]
+    BOOST_CHECK(ThreadLocalObjectPoolTestClass::sm_pOtherThreadPool != null_z);
+    BOOST_CHECK(ThreadLocalObjectPoolTestClass::sm_pOtherThreadPool != pThisThreadPool);
+    BOOST_CHECK_EQUAL(ThreadLocalObjectPoolTestClass::sm_nOtherThreadValue, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the same pool is returned every time it is called from the same thread.
+/// </summary>
+ZTEST_CASE ( GetThreadPool_ReturnsSamePoolInSameThread_Test )
+{
+    // [Preparation]
+    ThreadLocalObjectPool<int> pool(2U);
+    ObjectPool<int>* pExpectedPool = &pool.GetThreadPool();
+
+    // [Execution]
+    ObjectPool<int>* pPool = &pool.GetThreadPool();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(pPool, pExpectedPool);
+}
+
+// End - Test Suite: ThreadLocalObjectPool
+ZTEST_SUITE_END()
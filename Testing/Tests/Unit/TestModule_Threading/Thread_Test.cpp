@@ -36,6 +36,7 @@ using namespace boost::unit_test;
 #include "ZCommon/DataTypes/EComparisonType.h"
 #include "ZCommon/Exceptions/AssertException.h"
 #include "ZThreading/SThisThread.h"
+#include "ZThreading/SProcessorTopology.h"
 #include "ZTime/TimeSpan.h"
 
 // Class whose methods are to be used in the tests of Thread
@@ -937,5 +938,135 @@ ZTEST_CASE ( GetPriority_AssertionFailsWhenMethodIsCalledAfterThreadHasStopped_T
 
 #endif
 
+/// <summary>
+/// Checks that the affinity of the thread is changed when it contains only one processor.
+/// </summary>
+ZTEST_CASE ( SetAffinity_AffinityIsCorrectlySetWhenItContainsOneProcessor_Test )
+{
+    // [Preparation]
+    Delegate<void(unsigned int)> function(&ThreadTestClass::Wait);
+    unsigned int uWaitTime = 100;
+    Thread thread(function, uWaitTime);
+    const ProcessorSet INPUT_PROCESSORS(thread.GetAffinity().GetNext(0));
+#if defined(Z_OS_WINDOWS) || defined(Z_OS_LINUX)
+    const bool EXPECTED_RESULT = true;
+    const ProcessorSet EXPECTED_PROCESSORS = INPUT_PROCESSORS;
+#elif defined(Z_OS_MAC)
+    const bool EXPECTED_RESULT = false;
+    const ProcessorSet EXPECTED_PROCESSORS = thread.GetAffinity();
+#endif
+
+    // [Execution]
+    bool bResult = thread.SetAffinity(INPUT_PROCESSORS);
+
+    // [Verification]
+    ProcessorSet processors = thread.GetAffinity();
+    thread.Join();
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK(processors == EXPECTED_PROCESSORS);
+}
+
+/// <summary>
+/// Checks that the affinity of a new thread is not empty and it only contains existing processors.
+/// </summary>
+ZTEST_CASE ( GetAffinity_AffinityOfNewThreadContainsExistingProcessors_Test )
+{
+    // [Preparation]
+    Delegate<void(unsigned int)> function(&ThreadTestClass::Wait);
+    unsigned int uWaitTime = 100;
+    Thread thread(function, uWaitTime);
+    const ProcessorSet ALL_PROCESSORS = SProcessorTopology::GetAllProcessors();
+
+    // [Execution]
+    ProcessorSet processors = thread.GetAffinity();
+
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK(!processors.IsEmpty());
+
+    for(u32_z i = processors.GetNext(0); i != ProcessorSet::NO_PROCESSOR; i = processors.GetNext(i + 1U))
+        BOOST_CHECK(ALL_PROCESSORS.Contains(i));
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the method is called after the thread has stopped.
+/// </summary>
+ZTEST_CASE ( SetAffinity_AssertionFailsWhenMethodIsCalledAfterThreadHasStopped_Test )
+{
+    // [Preparation]
+    Delegate<void()> function(&ThreadTestClass::FunctionWith0Params);
+    Thread thread(function);
+    thread.Join();
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        thread.SetAffinity(ProcessorSet(0));
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input set of processors is empty.
+/// </summary>
+ZTEST_CASE ( SetAffinity_AssertionFailsWhenSetIsEmpty_Test )
+{
+    // [Preparation]
+    Delegate<void(unsigned int)> function(&ThreadTestClass::Wait);
+    unsigned int uWaitTime = 100;
+    Thread thread(function, uWaitTime);
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        thread.SetAffinity(ProcessorSet());
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    thread.Join();
+    BOOST_CHECK(bAssertionFailed);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the method is called after the thread has stopped.
+/// </summary>
+ZTEST_CASE ( GetAffinity_AssertionFailsWhenMethodIsCalledAfterThreadHasStopped_Test )
+{
+    // [Preparation]
+    Delegate<void()> function(&ThreadTestClass::FunctionWith0Params);
+    Thread thread(function);
+    thread.Join();
+    bool bAssertionFailed = false;
+
+    // [Execution]
+    try
+    {
+        thread.GetAffinity();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
 // End - Test Suite: Thread
 ZTEST_SUITE_END()
@@ -0,0 +1,469 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTime/STimeBatch.h"
+
+#include "ZTime/DateTime.h"
+#include "ZTime/TimeZone.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( STimeBatch_TestSuite )
+
+/// <summary>
+/// Checks that the time span is added to every instant, including the last ones, which are not processed in groups.
+/// </summary>
+ZTEST_CASE ( Add_TimeSpanIsAddedToEveryInstant_Test )
+{
+    // [Preparation]
+    const u64_z INSTANTS[] = { 0, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U };
+    const puint_z COUNT = sizeof(INSTANTS) / sizeof(u64_z);
+    const TimeSpan TIME_SPAN(100ULL);
+    u64_z arResults[COUNT];
+
+    // [Execution]
+    STimeBatch::Add(INSTANTS, COUNT, TIME_SPAN, arResults);
+    
+    // [Verification]
+    bool bResultsAreCorrect = true;
+
+    for(puint_z i = 0; i < COUNT; ++i)
+        bResultsAreCorrect = bResultsAreCorrect && arResults[i] == INSTANTS[i] + 100U;
+
+    BOOST_CHECK(bResultsAreCorrect);
+}
+
+/// <summary>
+/// Checks that results that exceed the maximum value are set to the maximum value.
+/// </summary>
+ZTEST_CASE ( Add_ResultsAreSaturatedToMaximumValue_Test )
+{
+    // [Preparation]
+    const u64_z MAXIMUM = -1;
+    const u64_z INSTANTS[] = { MAXIMUM - 5U, MAXIMUM - 10U, MAXIMUM, 0, MAXIMUM - 5U, MAXIMUM - 10U, MAXIMUM, 0, MAXIMUM - 5U };
+    const u64_z EXPECTED_RESULTS[] = { MAXIMUM, MAXIMUM, MAXIMUM, 10U, MAXIMUM, MAXIMUM, MAXIMUM, 10U, MAXIMUM };
+    const puint_z COUNT = sizeof(INSTANTS) / sizeof(u64_z);
+    const TimeSpan TIME_SPAN(10ULL);
+    u64_z arResults[COUNT];
+
+    // [Execution]
+    STimeBatch::Add(INSTANTS, COUNT, TIME_SPAN, arResults);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResults, arResults + COUNT, EXPECTED_RESULTS, EXPECTED_RESULTS + COUNT);
+}
+
+/// <summary>
+/// Checks that the input array can be used to store the results.
+/// </summary>
+ZTEST_CASE ( Add_InputArrayCanBeUsedAsOutput_Test )
+{
+    // [Preparation]
+    u64_z arInstants[] = { 1U, 2U, 3U, 4U, 5U };
+    const u64_z EXPECTED_RESULTS[] = { 3U, 4U, 5U, 6U, 7U };
+    const puint_z COUNT = sizeof(arInstants) / sizeof(u64_z);
+    const TimeSpan TIME_SPAN(2ULL);
+
+    // [Execution]
+    STimeBatch::Add(arInstants, COUNT, TIME_SPAN, arInstants);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arInstants, arInstants + COUNT, EXPECTED_RESULTS, EXPECTED_RESULTS + COUNT);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input array is null and the count is not zero.
+/// </summary>
+ZTEST_CASE ( Add_AssertionFailsWhenInputArrayIsNull_Test )
+{
+    // [Preparation]
+    const u64_z* NULL_ARRAY = null_z;
+    u64_z arResults[4];
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        STimeBatch::Add(NULL_ARRAY, 4U, TimeSpan(1ULL), arResults);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the time span is subtracted from every instant and that results lower than zero are set to zero.
+/// </summary>
+ZTEST_CASE ( Subtract_TimeSpanIsSubtractedAndResultsAreSaturatedToZero_Test )
+{
+    // [Preparation]
+    const u64_z MAXIMUM = -1;
+    const u64_z INSTANTS[] = { 100U, 5U, MAXIMUM, 10U, 11U, 0, 9U, 1000U, 3U };
+    const u64_z EXPECTED_RESULTS[] = { 90U, 0, MAXIMUM - 10U, 0, 1U, 0, 0, 990U, 0 };
+    const puint_z COUNT = sizeof(INSTANTS) / sizeof(u64_z);
+    const TimeSpan TIME_SPAN(10ULL);
+    u64_z arResults[COUNT];
+
+    // [Execution]
+    STimeBatch::Subtract(INSTANTS, COUNT, TIME_SPAN, arResults);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResults, arResults + COUNT, EXPECTED_RESULTS, EXPECTED_RESULTS + COUNT);
+}
+
+/// <summary>
+/// Checks that the difference does not depend on which instant of the pair is earlier.
+/// </summary>
+ZTEST_CASE ( Difference_DifferenceDoesNotDependOnOrderOfInstants_Test )
+{
+    // [Preparation]
+    const u64_z MAXIMUM = -1;
+    const u64_z INSTANTS_A[] = { 100U, 5U, MAXIMUM, 0, 7U, 0x8000000000000000ULL, 3U };
+    const u64_z INSTANTS_B[] = { 5U, 100U, 0, MAXIMUM, 7U, 0x7FFFFFFFFFFFFFFFULL, 1U };
+    const u64_z EXPECTED_RESULTS[] = { 95U, 95U, MAXIMUM, MAXIMUM, 0, 1U, 2U };
+    const puint_z COUNT = sizeof(INSTANTS_A) / sizeof(u64_z);
+    u64_z arResults[COUNT];
+
+    // [Execution]
+    STimeBatch::Difference(INSTANTS_A, INSTANTS_B, COUNT, arResults);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResults, arResults + COUNT, EXPECTED_RESULTS, EXPECTED_RESULTS + COUNT);
+}
+
+/// <summary>
+/// Checks that the result is the same as the difference between date/times.
+/// </summary>
+ZTEST_CASE ( Difference_ResultIsEqualToDifferenceOfDateTimes_Test )
+{
+    // [Preparation]
+    const DateTime DATE_TIMES_A[] = { DateTime(2015, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                                      DateTime(1999, 12, 31, 23, 59, 59, 999, 999, 9, TimeZone::UTC), 
+                                      DateTime(-500, 6, 15, 12, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                                      DateTime(2000, 2, 29, 0, 0, 0, 0, 0, 1, TimeZone::UTC), 
+                                      DateTime(1, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC) };
+    const DateTime DATE_TIMES_B[] = { DateTime(2016, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                                      DateTime(2000, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                                      DateTime(-501, 6, 15, 12, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                                      DateTime(2000, 2, 29, 0, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                                      DateTime(-1, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC) };
+    const puint_z COUNT = sizeof(DATE_TIMES_A) / sizeof(DateTime);
+    u64_z arInstantsA[COUNT];
+    u64_z arInstantsB[COUNT];
+    u64_z arResults[COUNT];
+    STimeBatch::GetInstants(DATE_TIMES_A, COUNT, arInstantsA);
+    STimeBatch::GetInstants(DATE_TIMES_B, COUNT, arInstantsB);
+
+    // [Execution]
+    STimeBatch::Difference(arInstantsA, arInstantsB, COUNT, arResults);
+    
+    // [Verification]
+    bool bResultsAreCorrect = true;
+
+    for(puint_z i = 0; i < COUNT; ++i)
+        bResultsAreCorrect = bResultsAreCorrect && arResults[i] == (DATE_TIMES_A[i] - DATE_TIMES_B[i]).GetHundredsOfNanoseconds();
+
+    BOOST_CHECK(bResultsAreCorrect);
+}
+
+/// <summary>
+/// Checks that every instant is placed in the expected window.
+/// </summary>
+ZTEST_CASE ( Bin_InstantsArePlacedInExpectedWindows_Test )
+{
+    // [Preparation]
+    const u64_z ORIGIN = 1000U;
+    const TimeSpan WINDOW_LENGTH(7ULL);
+    const u64_z INSTANTS[] = { 1000U, 1006U, 1007U, 1013U, 1014U, 1700U, 1699U, 8000U, 1001U };
+    const u64_z EXPECTED_RESULTS[] = { 0, 0, 1U, 1U, 2U, 100U, 99U, 1000U, 0 };
+    const puint_z COUNT = sizeof(INSTANTS) / sizeof(u64_z);
+    u64_z arResults[COUNT];
+
+    // [Execution]
+    STimeBatch::Bin(INSTANTS, COUNT, ORIGIN, WINDOW_LENGTH, arResults);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResults, arResults + COUNT, EXPECTED_RESULTS, EXPECTED_RESULTS + COUNT);
+}
+
+/// <summary>
+/// Checks that instants earlier than the origin are placed in the first window.
+/// </summary>
+ZTEST_CASE ( Bin_InstantsEarlierThanOriginArePlacedInFirstWindow_Test )
+{
+    // [Preparation]
+    const u64_z ORIGIN = 0x8000000000000005ULL;
+    const TimeSpan WINDOW_LENGTH(10ULL);
+    const u64_z INSTANTS[] = { 0, 0x8000000000000004ULL, 0x8000000000000015ULL, 5U };
+    const u64_z EXPECTED_RESULTS[] = { 0, 0, 1U, 0 };
+    const puint_z COUNT = sizeof(INSTANTS) / sizeof(u64_z);
+    u64_z arResults[COUNT];
+
+    // [Execution]
+    STimeBatch::Bin(INSTANTS, COUNT, ORIGIN, WINDOW_LENGTH, arResults);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arResults, arResults + COUNT, EXPECTED_RESULTS, EXPECTED_RESULTS + COUNT);
+}
+
+/// <summary>
+/// Checks that results are exact when the distance to the origin is very large or the window length is not a divisor of the distances.
+/// </summary>
+ZTEST_CASE ( Bin_ResultsAreExactForLargeDistancesAndWindowLengths_Test )
+{
+    // [Preparation]
+    const u64_z ORIGIN = 0;
+    const u64_z MAXIMUM = -1;
+    const u64_z WINDOW_LENGTHS[] = { 1U, 3U, 600000000U, 4503599627370495ULL, 4503599627370497ULL, MAXIMUM };
+    const puint_z WINDOWS_COUNT = sizeof(WINDOW_LENGTHS) / sizeof(u64_z);
+    const u64_z INSTANTS[] = { 4503599627370495ULL, 4503599627370496ULL, 4503599627370494ULL, 3000000000000000ULL, 
+                               MAXIMUM, 0x8000000000000000ULL, 1ULL << 51U, 123456789012345ULL };
+    const puint_z COUNT = sizeof(INSTANTS) / sizeof(u64_z);
+    u64_z arResults[COUNT];
+    bool bResultsAreCorrect = true;
+
+    // [Execution]
+    for(puint_z iWindow = 0; iWindow < WINDOWS_COUNT; ++iWindow)
+    {
+        STimeBatch::Bin(INSTANTS, COUNT, ORIGIN, TimeSpan(WINDOW_LENGTHS[iWindow]), arResults);
+
+        for(puint_z i = 0; i < COUNT; ++i)
+            bResultsAreCorrect = bResultsAreCorrect && arResults[i] == INSTANTS[i] / WINDOW_LENGTHS[iWindow];
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bResultsAreCorrect);
+}
+
+/// <summary>
+/// Checks that results are equal to the integer division of the distances to the origin by the window length, for many different values.
+/// </summary>
+ZTEST_CASE ( Bin_ResultsAreEqualToIntegerDivisionForManyValues_Test )
+{
+    // [Preparation]
+    const puint_z COUNT = 1000U;
+    const u64_z ORIGIN = 0x8000000000000000ULL;
+    u64_z arInstants[COUNT];
+    u64_z arResults[COUNT];
+    u64_z uSeed = 1U;
+    bool bResultsAreCorrect = true;
+
+    // [Execution]
+    for(unsigned int iWindow = 0; iWindow < 50U; ++iWindow)
+    {
+        uSeed = uSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+        const u64_z WINDOW_LENGTH = (uSeed >> (12U + iWindow % 40U)) + 1U;
+
+        for(puint_z i = 0; i < COUNT; ++i)
+        {
+            uSeed = uSeed * 6364136223846793005ULL + 1442695040888963407ULL;
+            arInstants[i] = ORIGIN + (uSeed >> 12U); // Distances lower than 2^52
+        }
+
+        STimeBatch::Bin(arInstants, COUNT, ORIGIN, TimeSpan(WINDOW_LENGTH), arResults);
+
+        for(puint_z i = 0; i < COUNT; ++i)
+            bResultsAreCorrect = bResultsAreCorrect && arResults[i] == (arInstants[i] - ORIGIN) / WINDOW_LENGTH;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bResultsAreCorrect);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the length of the windows is zero.
+/// </summary>
+ZTEST_CASE ( Bin_AssertionFailsWhenWindowLengthIsZero_Test )
+{
+    // [Preparation]
+    const u64_z INSTANTS[] = { 1U, 2U };
+    u64_z arResults[2];
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        STimeBatch::Bin(INSTANTS, 2U, 0, TimeSpan(), arResults);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the lowest value is returned, wherever it is.
+/// </summary>
+ZTEST_CASE ( GetMinimum_ReturnsLowestValue_Test )
+{
+    // [Preparation]
+    const u64_z MAXIMUM = -1;
+    const u64_z INSTANTS[] = { MAXIMUM, 0x8000000000000000ULL, 0x7FFFFFFFFFFFFFFFULL, 500U, 40U, 600U, 0x9000000000000000ULL, 90U, 41U };
+    const puint_z COUNT = sizeof(INSTANTS) / sizeof(u64_z);
+
+    // [Execution]
+    u64_z uMinimumInGroups = STimeBatch::GetMinimum(INSTANTS, 8U);
+    u64_z uMinimumInLastElement = STimeBatch::GetMinimum(INSTANTS, 3U);
+    u64_z uMinimumOfAll = STimeBatch::GetMinimum(INSTANTS, COUNT);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uMinimumInGroups, 40U);
+    BOOST_CHECK_EQUAL(uMinimumInLastElement, 0x7FFFFFFFFFFFFFFFULL);
+    BOOST_CHECK_EQUAL(uMinimumOfAll, 40U);
+}
+
+/// <summary>
+/// Checks that the highest value is returned, wherever it is.
+/// </summary>
+ZTEST_CASE ( GetMaximum_ReturnsHighestValue_Test )
+{
+    // [Preparation]
+    const u64_z INSTANTS[] = { 0, 0x7FFFFFFFFFFFFFFFULL, 500U, 0x8000000000000000ULL, 40U, 0x9000000000000000ULL, 600U, 90U, 0xA000000000000000ULL };
+    const puint_z COUNT = sizeof(INSTANTS) / sizeof(u64_z);
+
+    // [Execution]
+    u64_z uMaximumInGroups = STimeBatch::GetMaximum(INSTANTS, 8U);
+    u64_z uMaximumInLastElement = STimeBatch::GetMaximum(INSTANTS, 2U);
+    u64_z uMaximumOfAll = STimeBatch::GetMaximum(INSTANTS, COUNT);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uMaximumInGroups, 0x9000000000000000ULL);
+    BOOST_CHECK_EQUAL(uMaximumInLastElement, 0x7FFFFFFFFFFFFFFFULL);
+    BOOST_CHECK_EQUAL(uMaximumOfAll, 0xA000000000000000ULL);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the array is empty.
+/// </summary>
+ZTEST_CASE ( GetMinimum_AssertionFailsWhenArrayIsEmpty_Test )
+{
+    // [Preparation]
+    const u64_z INSTANTS[] = { 1U };
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        STimeBatch::GetMinimum(INSTANTS, 0);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that date/times keep their time zone and get the same instants they had when their instants are extracted and replaced.
+/// </summary>
+ZTEST_CASE ( SetInstants_DateTimesAreEqualAfterGettingAndSettingTheirInstants_Test )
+{
+    // [Preparation]
+    const DateTime ORIGINAL_DATE_TIMES[] = { DateTime(2015, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                                             DateTime::GetUndefinedDate(), 
+                                             DateTime(-500, 6, 15, 12, 0, 0, 0, 0, 0, TimeZone::UTC) };
+    const puint_z COUNT = sizeof(ORIGINAL_DATE_TIMES) / sizeof(DateTime);
+    DateTime arDateTimes[COUNT];
+    u64_z arInstants[COUNT];
+
+    // [Execution]
+    STimeBatch::GetInstants(ORIGINAL_DATE_TIMES, COUNT, arInstants);
+    STimeBatch::SetInstants(arInstants, COUNT, arDateTimes);
+    
+    // [Verification]
+    BOOST_CHECK(arDateTimes[0] == ORIGINAL_DATE_TIMES[0]);
+    BOOST_CHECK(arDateTimes[1].IsUndefined());
+    BOOST_CHECK(arDateTimes[2] == ORIGINAL_DATE_TIMES[2]);
+    BOOST_CHECK_EQUAL(arInstants[1], 0U);
+}
+
+/// <summary>
+/// Checks that adding a time span to the instants of date/times produces the same result as adding it to every date/time.
+/// </summary>
+ZTEST_CASE ( SetInstants_AddingToInstantsIsEquivalentToAddingToDateTimes_Test )
+{
+    // [Preparation]
+    const TimeSpan TIME_SPAN(0, 25, 0, 0, 0, 0, 0);
+    DateTime arDateTimes[] = { DateTime(2015, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                               DateTime(2016, 2, 28, 12, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                               DateTime(-1, 12, 31, 23, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                               DateTime(1970, 1, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC), 
+                               DateTime(2100, 3, 1, 0, 0, 0, 0, 0, 0, TimeZone::UTC) };
+    const puint_z COUNT = sizeof(arDateTimes) / sizeof(DateTime);
+    DateTime arExpectedDateTimes[COUNT];
+
+    for(puint_z i = 0; i < COUNT; ++i)
+        arExpectedDateTimes[i] = arDateTimes[i] + TIME_SPAN;
+
+    u64_z arInstants[COUNT];
+
+    // [Execution]
+    STimeBatch::GetInstants(arDateTimes, COUNT, arInstants);
+    STimeBatch::Add(arInstants, COUNT, TIME_SPAN, arInstants);
+    STimeBatch::SetInstants(arInstants, COUNT, arDateTimes);
+    
+    // [Verification]
+    bool bResultsAreCorrect = true;
+
+    for(puint_z i = 0; i < COUNT; ++i)
+        bResultsAreCorrect = bResultsAreCorrect && arDateTimes[i] == arExpectedDateTimes[i];
+
+    BOOST_CHECK(bResultsAreCorrect);
+}
+
+// End - Test Suite: STimeBatch
+ZTEST_SUITE_END()
@@ -0,0 +1,61 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#ifndef __COARSECLOCKWHITEBOX__
+#define __COARSECLOCKWHITEBOX__
+
+#include "ZTiming/CoarseClock.h"
+
+
+namespace z
+{
+namespace Test
+{
+
+/// <summary>
+/// Exposes the protected attributes of the CoarseClock to perform white-box tests.
+/// </summary>
+class CoarseClockWhiteBox : public CoarseClock
+{
+
+    // METHODS
+	// ---------------
+public:
+
+    // Method to replace the published instant
+    void SetPublishedInstantForTest(const u64_z uInstant)
+    {
+        m_uInstant.store(uInstant);
+    }
+
+};
+
+} // namespace Test
+} // namespace z
+
+
+#endif // __COARSECLOCKWHITEBOX__
@@ -0,0 +1,427 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTiming/CoarseClock.h"
+
+#include "ZTiming/DateTimeNow.h"
+#include "ZTime/STimeBatch.h"
+#include "ZThreading/SThisThread.h"
+#include "ZTime/TimeZone.h"
+#include "ZTime/STimeZoneFactory.h"
+#include "ZCommon/Exceptions/AssertException.h"
+#include "CoarseClockWhiteBox.h"
+
+using z::Test::CoarseClockWhiteBox;
+
+
+ZTEST_SUITE_BEGIN( CoarseClock_TestSuite )
+
+/// <summary>
+/// Checks that the default values are correct.
+/// </summary>
+ZTEST_CASE ( Constructor1_DefaultValuesAreCorrect_Test )
+{
+    // [Preparation]
+    const ECoarseClockMode EXPECTED_MODE = ECoarseClockMode::E_PublishedByThread;
+    const TimeSpan EXPECTED_PERIOD(0, 0, 0, 0, 1, 0, 0);
+    const bool EXPECTED_IS_RUNNING = false;
+
+    // [Execution]
+    CoarseClock clock;
+    
+    // [Verification]
+    ECoarseClockMode eMode = clock.GetMode();
+    TimeSpan period = clock.GetUpdatePeriod();
+    bool bIsRunning = clock.IsRunning();
+    BOOST_CHECK(eMode == EXPECTED_MODE);
+    BOOST_CHECK(period == EXPECTED_PERIOD);
+    BOOST_CHECK_EQUAL(bIsRunning, EXPECTED_IS_RUNNING);
+}
+
+/// <summary>
+/// Checks that the current date and time is published during the construction.
+/// </summary>
+ZTEST_CASE ( Constructor1_CurrentDateTimeIsPublished_Test )
+{
+    // [Preparation]
+    const DateTimeNow NOW(null_z);
+    const TimeSpan MAXIMUM_DIFFERENCE(0, 0, 1, 0, 0, 0, 0);
+
+    // [Execution]
+    CoarseClock clock;
+    
+    // [Verification]
+    DateTime published = clock.GetUtcDateTime();
+    BOOST_CHECK(published >= NOW);
+    BOOST_CHECK(published - NOW < MAXIMUM_DIFFERENCE);
+}
+
+/// <summary>
+/// Checks that the input values are correctly stored.
+/// </summary>
+ZTEST_CASE ( Constructor2_ValuesAreCorrectlyStored_Test )
+{
+    // [Preparation]
+    const ECoarseClockMode EXPECTED_MODE = ECoarseClockMode::E_OperatingSystemCoarse;
+    const TimeSpan EXPECTED_PERIOD(0, 0, 0, 0, 0, 250, 0);
+
+    // [Execution]
+    CoarseClock clock(EXPECTED_MODE, EXPECTED_PERIOD);
+    
+    // [Verification]
+    ECoarseClockMode eMode = clock.GetMode();
+    TimeSpan period = clock.GetUpdatePeriod();
+    BOOST_CHECK(eMode == EXPECTED_MODE);
+    BOOST_CHECK(period == EXPECTED_PERIOD);
+}
+
+/// <summary>
+/// Checks that the current date and time is published during the construction.
+/// </summary>
+ZTEST_CASE ( Constructor2_CurrentDateTimeIsPublished_Test )
+{
+    // [Preparation]
+    const DateTimeNow NOW(null_z);
+    const TimeSpan MAXIMUM_DIFFERENCE(0, 0, 1, 0, 0, 0, 0);
+
+    // [Execution]
+    CoarseClock clock(ECoarseClockMode::E_PublishedByThread, TimeSpan(0, 0, 0, 0, 10, 0, 0));
+    
+    // [Verification]
+    DateTime published = clock.GetUtcDateTime();
+    BOOST_CHECK(published >= NOW);
+    BOOST_CHECK(published - NOW < MAXIMUM_DIFFERENCE);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the update period is zero.
+/// </summary>
+ZTEST_CASE ( Constructor2_AssertionFailsWhenUpdatePeriodIsZero_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        CoarseClock clock(ECoarseClockMode::E_PublishedByThread, TimeSpan());
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that no assertion fails when the update period is zero and the mode does not use the dedicated thread.
+/// </summary>
+ZTEST_CASE ( Constructor2_AssertionDoesNotFailWhenUpdatePeriodIsZeroAndModeIsOperatingSystemCoarse_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = false;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        CoarseClock clock(ECoarseClockMode::E_OperatingSystemCoarse, TimeSpan());
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that the published date and time does not change if the clock is not updated.
+/// </summary>
+ZTEST_CASE ( GetUtcDateTime_DoesNotChangeWhenClockIsNotUpdated_Test )
+{
+    // [Preparation]
+    CoarseClock clock;
+    const DateTime EXPECTED_DATETIME = clock.GetUtcDateTime();
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 20, 0, 0));
+    DateTime dateTime = clock.GetUtcDateTime();
+    
+    // [Verification]
+    BOOST_CHECK(dateTime == EXPECTED_DATETIME);
+}
+
+/// <summary>
+/// Checks that the time zone of the returned date and time is UTC (null).
+/// </summary>
+ZTEST_CASE ( GetUtcDateTime_TimeZoneIsNull_Test )
+{
+    // [Preparation]
+    const TimeZone* EXPECTED_TIMEZONE = null_z;
+    CoarseClock clock;
+
+    // [Execution]
+    DateTime dateTime = clock.GetUtcDateTime();
+    
+    // [Verification]
+    const TimeZone* pTimeZone = dateTime.GetTimeZone();
+    BOOST_CHECK_EQUAL(pTimeZone, EXPECTED_TIMEZONE);
+}
+
+/// <summary>
+/// Checks that the input time zone is applied to the returned date and time, which represents the same instant as the UTC date and time.
+/// </summary>
+ZTEST_CASE ( GetDateTime_TimeZoneIsApplied_Test )
+{
+    // [Preparation]
+    const TimeZone* EXPECTED_TIMEZONE = STimeZoneFactory::GetTimeZoneById("Europe/London");
+    CoarseClock clock;
+    const DateTime EXPECTED_DATETIME = clock.GetUtcDateTime();
+
+    // [Execution]
+    DateTime dateTime = clock.GetDateTime(EXPECTED_TIMEZONE);
+    
+    // [Verification]
+    const TimeZone* pTimeZone = dateTime.GetTimeZone();
+    BOOST_CHECK_EQUAL(pTimeZone, EXPECTED_TIMEZONE);
+    BOOST_CHECK(dateTime == EXPECTED_DATETIME);
+}
+
+/// <summary>
+/// Checks that the instant corresponds to the published date and time.
+/// </summary>
+ZTEST_CASE ( GetUtcInstant_IsEqualToInstantOfPublishedDateTime_Test )
+{
+    // [Preparation]
+    CoarseClock clock;
+    const DateTime PUBLISHED_DATETIME = clock.GetUtcDateTime();
+    u64_z uExpectedInstant = 0;
+    STimeBatch::GetInstants(&PUBLISHED_DATETIME, 1U, &uExpectedInstant);
+
+    // [Execution]
+    u64_z uInstant = clock.GetUtcInstant();
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uInstant, uExpectedInstant);
+}
+
+/// <summary>
+/// Checks that the date and time obtained from the operating system changes as time passes, when using the E_OperatingSystemCoarse mode.
+/// </summary>
+ZTEST_CASE ( GetUtcDateTime_ChangesAsTimePassesWhenModeIsOperatingSystemCoarse_Test )
+{
+    // [Preparation]
+    CoarseClock clock(ECoarseClockMode::E_OperatingSystemCoarse, TimeSpan());
+    const DateTime FIRST_DATETIME = clock.GetUtcDateTime();
+
+    // [Execution]
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    DateTime dateTime = clock.GetUtcDateTime();
+    
+    // [Verification]
+    BOOST_CHECK(dateTime > FIRST_DATETIME);
+}
+
+/// <summary>
+/// Checks that the date and time obtained from the operating system is close to the precise current date and time, when using the E_OperatingSystemCoarse mode.
+/// </summary>
+ZTEST_CASE ( GetUtcDateTime_IsCloseToCurrentDateTimeWhenModeIsOperatingSystemCoarse_Test )
+{
+    // [Preparation]
+    const TimeSpan MAXIMUM_DIFFERENCE(0, 0, 1, 0, 0, 0, 0);
+    CoarseClock clock(ECoarseClockMode::E_OperatingSystemCoarse, TimeSpan());
+
+    // [Execution]
+    DateTime dateTime = clock.GetUtcDateTime();
+    
+    // [Verification]
+    const DateTimeNow NOW(null_z);
+    BOOST_CHECK(NOW - dateTime < MAXIMUM_DIFFERENCE);
+}
+
+/// <summary>
+/// Checks that a new date and time is published.
+/// </summary>
+ZTEST_CASE ( Update_PublishesNewDateTime_Test )
+{
+    // [Preparation]
+    CoarseClock clock;
+    const DateTime FIRST_DATETIME = clock.GetUtcDateTime();
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 20, 0, 0));
+
+    // [Execution]
+    clock.Update();
+    
+    // [Verification]
+    DateTime dateTime = clock.GetUtcDateTime();
+    BOOST_CHECK(dateTime > FIRST_DATETIME);
+}
+
+/// <summary>
+/// Checks that the published instant does not decrease when the system clock is behind it, as it happens when the system clock is set back.
+/// </summary>
+ZTEST_CASE ( Update_PublishedInstantDoesNotDecreaseWhenSystemClockIsBehind_Test )
+{
+    // [Preparation]
+    CoarseClockWhiteBox clock;
+    const u64_z EXPECTED_INSTANT = clock.GetUtcInstant() + TimeSpan(0, 1, 0, 0, 0, 0, 0).GetHundredsOfNanoseconds();
+    clock.SetPublishedInstantForTest(EXPECTED_INSTANT);
+
+    // [Execution]
+    clock.Update();
+    
+    // [Verification]
+    u64_z uInstant = clock.GetUtcInstant();
+    BOOST_CHECK_EQUAL(uInstant, EXPECTED_INSTANT);
+}
+
+/// <summary>
+/// Checks that the dedicated thread updates the published date and time periodically.
+/// </summary>
+ZTEST_CASE ( Start_DateTimeIsUpdatedPeriodically_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_IS_RUNNING = true;
+    CoarseClock clock(ECoarseClockMode::E_PublishedByThread, TimeSpan(0, 0, 0, 0, 1, 0, 0));
+    const DateTime FIRST_DATETIME = clock.GetUtcDateTime();
+
+    // [Execution]
+    clock.Start();
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 50, 0, 0));
+    
+    // [Verification]
+    DateTime dateTime = clock.GetUtcDateTime();
+    bool bIsRunning = clock.IsRunning();
+    BOOST_CHECK(dateTime > FIRST_DATETIME);
+    BOOST_CHECK_EQUAL(bIsRunning, EXPECTED_IS_RUNNING);
+}
+
+/// <summary>
+/// Checks that no thread is created when the mode is E_OperatingSystemCoarse.
+/// </summary>
+ZTEST_CASE ( Start_ThreadIsNotCreatedWhenModeIsOperatingSystemCoarse_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_IS_RUNNING = false;
+    CoarseClock clock(ECoarseClockMode::E_OperatingSystemCoarse, TimeSpan(0, 0, 0, 0, 1, 0, 0));
+
+    // [Execution]
+    clock.Start();
+    
+    // [Verification]
+    bool bIsRunning = clock.IsRunning();
+    BOOST_CHECK_EQUAL(bIsRunning, EXPECTED_IS_RUNNING);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the thread is already running.
+/// </summary>
+ZTEST_CASE ( Start_AssertionFailsWhenThreadIsAlreadyRunning_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    CoarseClock clock;
+    clock.Start();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        clock.Start();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the published date and time does not change after the thread is stopped.
+/// </summary>
+ZTEST_CASE ( Stop_DateTimeIsNotUpdatedAfterStopping_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_IS_RUNNING = false;
+    CoarseClock clock;
+    clock.Start();
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 10, 0, 0));
+
+    // [Execution]
+    clock.Stop();
+    
+    // [Verification]
+    const DateTime DATETIME_AFTER_STOPPING = clock.GetUtcDateTime();
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 20, 0, 0));
+    DateTime dateTime = clock.GetUtcDateTime();
+    bool bIsRunning = clock.IsRunning();
+    BOOST_CHECK(dateTime == DATETIME_AFTER_STOPPING);
+    BOOST_CHECK_EQUAL(bIsRunning, EXPECTED_IS_RUNNING);
+}
+
+/// <summary>
+/// Checks that nothing happens when the thread is not running.
+/// </summary>
+ZTEST_CASE ( Stop_NothingHappensWhenThreadIsNotRunning_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_IS_RUNNING = false;
+    CoarseClock clock;
+
+    // [Execution]
+    clock.Stop();
+    
+    // [Verification]
+    bool bIsRunning = clock.IsRunning();
+    BOOST_CHECK_EQUAL(bIsRunning, EXPECTED_IS_RUNNING);
+}
+
+// End - Test Suite: CoarseClock
+ZTEST_SUITE_END()
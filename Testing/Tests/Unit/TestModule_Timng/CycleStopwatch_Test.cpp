@@ -0,0 +1,166 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTiming/CycleStopwatch.h"
+
+#include "ZTiming/STimestampCounter.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+
+ZTEST_SUITE_BEGIN( CycleStopwatch_TestSuite )
+
+/// <summary>
+/// Checks that the returned value is greater than zero when the stopwatch is set.
+/// </summary>
+ZTEST_CASE ( GetElapsedCycles_ReturnedValueIsGreaterThanZeroWhenStopWatchIsSet_Test )
+{
+    // [Preparation]
+    const u64_z ZERO = 0;
+    CycleStopwatch stopWatch;
+    stopWatch.Set();
+    
+    // Delay
+    for(int i = 0; i < 10000; ++i)
+        i = i;
+
+    // [Execution]
+    u64_z uValue = stopWatch.GetElapsedCycles();
+    
+    // [Verification]
+    BOOST_CHECK(uValue > ZERO);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the stopwatch as not been set.
+/// </summary>
+ZTEST_CASE ( GetElapsedCycles_AssertionFailsWhenStopWatchHasNotBeenSet_Test )
+{
+    // [Preparation]
+    CycleStopwatch stopWatch;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        stopWatch.GetElapsedCycles();
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the returned value is greater than zero when the stopwatch is set.
+/// </summary>
+ZTEST_CASE ( GetElapsedTimeAsInteger_ReturnedValueIsGreaterThanZeroWhenStopWatchIsSet_Test )
+{
+    // [Preparation]
+    const u64_z ZERO = 0;
+    CycleStopwatch stopWatch;
+    stopWatch.Set();
+    
+    // Delay
+    for(int i = 0; i < 10000; ++i)
+        i = i;
+
+    // [Execution]
+    u64_z uValue = stopWatch.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_CHECK(uValue > ZERO);
+}
+
+/// <summary>
+/// Checks that the returned value is greater than zero when the stopwatch is set.
+/// </summary>
+ZTEST_CASE ( GetElapsedTimeAsTimeSpan_ReturnedValueIsGreaterThanZeroWhenStopWatchIsSet_Test )
+{
+    // [Preparation]
+    const TimeSpan ZERO = TimeSpan(0ULL);
+    CycleStopwatch stopWatch;
+    stopWatch.Set();
+    
+    // Delay
+    for(int i = 0; i < 100000; ++i)
+        i = i;
+
+    // [Execution]
+    TimeSpan value = stopWatch.GetElapsedTimeAsTimeSpan();
+    
+    // [Verification]
+    BOOST_CHECK(value > ZERO);
+}
+
+/// <summary>
+/// Checks that it is cycle accurate only when the timestamp counter is available.
+/// </summary>
+ZTEST_CASE ( IsCycleAccurate_ItIsCycleAccurateOnlyWhenTimestampCounterIsAvailable_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_VALUE = STimestampCounter::IsAvailable();
+
+    // [Execution]
+    bool bIsCycleAccurate = CycleStopwatch::IsCycleAccurate();
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(bIsCycleAccurate, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the frequency of the counter is returned when the timestamp counter is available and one nanosecond per cycle otherwise.
+/// </summary>
+ZTEST_CASE ( GetCyclesPerSecond_ReturnsCounterFrequencyOrNanosecondsPerSecond_Test )
+{
+    // [Preparation]
+    const u64_z NANOSECONDS_IN_SECOND = 1000000000ULL;
+    const u64_z EXPECTED_VALUE = STimestampCounter::IsAvailable() ? STimestampCounter::GetFrequency() : 
+                                                                    NANOSECONDS_IN_SECOND;
+
+    // [Execution]
+    u64_z uCyclesPerSecond = CycleStopwatch::GetCyclesPerSecond();
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCyclesPerSecond, EXPECTED_VALUE);
+}
+
+// End - Test Suite: CycleStopwatch
+ZTEST_SUITE_END()
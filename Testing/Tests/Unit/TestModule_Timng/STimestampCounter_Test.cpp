@@ -0,0 +1,140 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTiming/STimestampCounter.h"
+
+#include "ZTiming/Stopwatch.h"
+
+
+ZTEST_SUITE_BEGIN( STimestampCounter_TestSuite )
+
+/// <summary>
+/// Checks that the counter always increases.
+/// </summary>
+ZTEST_CASE ( GetCycles_CounterIncreasesWhenItIsAvailable_Test )
+{
+    if(STimestampCounter::IsAvailable())
+    {
+        // [Preparation]
+        const u64_z FIRST_SAMPLE = STimestampCounter::GetCycles();
+
+        // Delay
+        for(int i = 0; i < 10000; ++i)
+            i = i;
+
+        // [Execution]
+        u64_z uSecondSample = STimestampCounter::GetCycles();
+
+        // [Verification]
+        BOOST_CHECK(uSecondSample > FIRST_SAMPLE);
+    }
+    else
+    {
+        BOOST_TEST_MESSAGE("The timestamp counter is not available on this machine.");
+    }
+}
+
+/// <summary>
+/// Checks that the frequency equals zero when the counter is not available and is greater than zero otherwise.
+/// </summary>
+ZTEST_CASE ( GetFrequency_FrequencyIsZeroOnlyWhenCounterIsNotAvailable_Test )
+{
+    // [Preparation]
+    const u64_z ZERO = 0;
+
+    // [Execution]
+    u64_z uFrequency = STimestampCounter::GetFrequency();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uFrequency > ZERO, STimestampCounter::IsAvailable());
+}
+
+/// <summary>
+/// Checks that the amount of cycles counted during one second (as measured by the operating system) is converted to approximately one second.
+/// </summary>
+ZTEST_CASE ( ConvertToNanoseconds_CyclesCountedDuringAPeriodAreConvertedToTheSamePeriod_Test )
+{
+    if(STimestampCounter::IsAvailable())
+    {
+        // [Preparation]
+        const u64_z PERIOD = 100000000ULL; // 100 ms
+        const u64_z ACCEPTED_ERROR = 2000000ULL; // 2 ms
+        const u64_z START_INSTANT = Stopwatch::_GetCurrentInstant();
+        const u64_z START_CYCLES = STimestampCounter::GetCycles();
+        u64_z uEndInstant = START_INSTANT;
+
+        while(uEndInstant - START_INSTANT < PERIOD)
+            uEndInstant = Stopwatch::_GetCurrentInstant();
+
+        const u64_z ELAPSED_CYCLES = STimestampCounter::GetCycles() - START_CYCLES;
+
+        // [Execution]
+        u64_z uNanoseconds = STimestampCounter::ConvertToNanoseconds(ELAPSED_CYCLES);
+
+        // [Verification]
+        BOOST_CHECK(uNanoseconds + ACCEPTED_ERROR > uEndInstant - START_INSTANT);
+        BOOST_CHECK(uNanoseconds < uEndInstant - START_INSTANT + ACCEPTED_ERROR);
+    }
+    else
+    {
+        BOOST_TEST_MESSAGE("The timestamp counter is not available on this machine.");
+    }
+}
+
+/// <summary>
+/// Checks that the conversion does not overflow when the amount of cycles is big.
+/// </summary>
+ZTEST_CASE ( ConvertToNanoseconds_DoesNotOverflowWithBigAmountsOfCycles_Test )
+{
+    if(STimestampCounter::IsAvailable())
+    {
+        // [Preparation]
+        const u64_z ONE_DAY_IN_SECONDS = 86400ULL;
+        const u64_z NANOSECONDS_IN_SECOND = 1000000000ULL;
+        const u64_z CYCLES_IN_ONE_DAY = STimestampCounter::GetFrequency() * ONE_DAY_IN_SECONDS;
+        const u64_z EXPECTED_VALUE = ONE_DAY_IN_SECONDS * NANOSECONDS_IN_SECOND;
+
+        // [Execution]
+        u64_z uNanoseconds = STimestampCounter::ConvertToNanoseconds(CYCLES_IN_ONE_DAY);
+
+        // [Verification]
+        BOOST_CHECK_EQUAL(uNanoseconds, EXPECTED_VALUE);
+    }
+    else
+    {
+        BOOST_TEST_MESSAGE("The timestamp counter is not available on this machine.");
+    }
+}
+
+// End - Test Suite: STimestampCounter
+ZTEST_SUITE_END()
@@ -33,6 +33,7 @@ using namespace boost::unit_test;
 #include "ZTiming/Stopwatch.h"
 
 #include "StopwatchWhiteBox.h"
+#include "ZTiming/STimestampCounter.h"
 #include "ZCommon/Exceptions/AssertException.h"
 
 using z::Test::StopwatchWhiteBox;
@@ -55,6 +56,52 @@ ZTEST_CASE ( Constructor_ItIsCorrectlyInitialized_Test )
     BOOST_CHECK_EQUAL(stopWatch.GetReferenceInstantForTest(), EXPECTED_VALUE);
 }
 
+/// <summary>
+/// Checks that the operating system counter is used by default.
+/// </summary>
+ZTEST_CASE ( Constructor_OperatingSystemCounterIsUsedByDefault_Test )
+{
+    // [Preparation]
+    const EClockSource EXPECTED_SOURCE = EClockSource::E_OperatingSystem;
+
+    // [Execution]
+    Stopwatch stopWatch;
+    
+    // [Verification]
+    BOOST_CHECK(stopWatch.GetClockSource() == EXPECTED_SOURCE);
+}
+
+/// <summary>
+/// Checks that the operating system counter is used when it is requested.
+/// </summary>
+ZTEST_CASE ( Constructor2_OperatingSystemCounterIsUsedWhenRequested_Test )
+{
+    // [Preparation]
+    const EClockSource EXPECTED_SOURCE = EClockSource::E_OperatingSystem;
+
+    // [Execution]
+    Stopwatch stopWatch(EClockSource::E_OperatingSystem);
+    
+    // [Verification]
+    BOOST_CHECK(stopWatch.GetClockSource() == EXPECTED_SOURCE);
+}
+
+/// <summary>
+/// Checks that the timestamp counter is used when it is available and that the operating system counter is used otherwise.
+/// </summary>
+ZTEST_CASE ( Constructor2_TimestampCounterIsUsedOnlyWhenAvailable_Test )
+{
+    // [Preparation]
+    const EClockSource EXPECTED_SOURCE = STimestampCounter::IsAvailable() ? EClockSource::E_TimestampCounter : 
+                                                                            EClockSource::E_OperatingSystem;
+
+    // [Execution]
+    Stopwatch stopWatch(EClockSource::E_TimestampCounter);
+    
+    // [Verification]
+    BOOST_CHECK(stopWatch.GetClockSource() == EXPECTED_SOURCE);
+}
+
 /// <summary>
 /// Checks that the returned value is greater than zero when the stopwatch is set.
 /// </summary>
@@ -174,6 +221,32 @@ ZTEST_CASE ( GetElapsedTimeAsTimeSpan_ReturnedValueIsGreaterThanZeroWhenStopWatc
     BOOST_CHECK(value > ZERO);
 }
 
+/// <summary>
+/// Checks that the elapsed time measured using the timestamp counter is similar to the one measured using the operating system counter.
+/// </summary>
+ZTEST_CASE ( GetElapsedTimeAsInteger_TimestampCounterAndOperatingSystemCounterMeasureSimilarTimes_Test )
+{
+    // [Preparation]
+    const u64_z ACCEPTED_ERROR = 2000000ULL; // 2 ms
+    const u64_z DELAY = 50000000ULL; // 50 ms
+    Stopwatch stopWatchTsc(EClockSource::E_TimestampCounter);
+    Stopwatch stopWatchOs(EClockSource::E_OperatingSystem);
+    stopWatchTsc.Set();
+    stopWatchOs.Set();
+
+    // Delay
+    while(stopWatchOs.GetElapsedTimeAsInteger() < DELAY)
+        ;
+
+    // [Execution]
+    u64_z uElapsedTsc = stopWatchTsc.GetElapsedTimeAsInteger();
+    u64_z uElapsedOs = stopWatchOs.GetElapsedTimeAsInteger();
+    
+    // [Verification]
+    BOOST_CHECK(uElapsedTsc + ACCEPTED_ERROR > uElapsedOs);
+    BOOST_CHECK(uElapsedTsc < uElapsedOs + ACCEPTED_ERROR);
+}
+
 #if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
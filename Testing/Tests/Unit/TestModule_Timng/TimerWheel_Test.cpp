@@ -0,0 +1,527 @@
+//-------------------------------------------------------------------------------//
+//                             ZUNDERBOLT : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Zunderbolt.                                              //
+// Zunderbolt is free software: you can redistribute it and/or modify            //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Zunderbolt is distributed in the hope that it will be useful,                 //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Zunderbolt. If not, see <http://www.gnu.org/licenses/>.            //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Zunderbolt in your project but we would appreciate         //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "ZTiming/TimerWheel.h"
+
+#include <boost/atomic.hpp>
+#include "ZThreading/SThisThread.h"
+#include "ZTime/TimeSpan.h"
+#include "ZCommon/Exceptions/AssertException.h"
+
+// Class whose methods are used as timer callbacks in the tests of TimerWheel
+class TimerWheelTestClass
+{
+public:
+
+    static boost::atomic<int> sm_nCallsCountA;
+    static boost::atomic<int> sm_nCallsCountB;
+    static string_z sm_strCallsOrder;
+    static TimerWheel* sm_pWheel;
+
+    static void ResetCounters()
+    {
+        sm_nCallsCountA = 0;
+        sm_nCallsCountB = 0;
+        sm_strCallsOrder = string_z::GetEmpty();
+        sm_pWheel = null_z;
+    }
+
+    static void CallbackA()
+    {
+        ++sm_nCallsCountA;
+        sm_strCallsOrder.Append("A");
+    }
+
+    static void CallbackB()
+    {
+        ++sm_nCallsCountB;
+        sm_strCallsOrder.Append("B");
+    }
+
+    static void CallbackThatAddsTimer()
+    {
+        sm_pWheel->AddTimer(TimeSpan(0, 0, 0, 0, 1, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    }
+};
+
+boost::atomic<int> TimerWheelTestClass::sm_nCallsCountA(0);
+boost::atomic<int> TimerWheelTestClass::sm_nCallsCountB(0);
+string_z TimerWheelTestClass::sm_strCallsOrder;
+TimerWheel* TimerWheelTestClass::sm_pWheel = null_z;
+
+
+ZTEST_SUITE_BEGIN( TimerWheel_TestSuite )
+
+/// <summary>
+/// Checks that the default duration of the ticks is one millisecond.
+/// </summary>
+ZTEST_CASE ( Constructor1_TickDurationIsOneMillisecond_Test )
+{
+    // [Preparation]
+    const TimeSpan EXPECTED_DURATION(0, 0, 0, 0, 1, 0, 0);
+
+    // [Execution]
+    TimerWheel wheel;
+    
+    // [Verification]
+    BOOST_CHECK(wheel.GetTickDuration() == EXPECTED_DURATION);
+    BOOST_CHECK_EQUAL(wheel.GetCurrentTick(), 0U);
+    BOOST_CHECK_EQUAL(wheel.GetPendingTimersCount(), 0U);
+    BOOST_CHECK(!wheel.IsRunning());
+}
+
+/// <summary>
+/// Checks that the duration of the ticks is correctly stored.
+/// </summary>
+ZTEST_CASE ( Constructor2_TickDurationIsCorrectlyStored_Test )
+{
+    // [Preparation]
+    const TimeSpan EXPECTED_DURATION(0, 0, 0, 0, 0, 250, 0);
+
+    // [Execution]
+    TimerWheel wheel(EXPECTED_DURATION);
+    
+    // [Verification]
+    BOOST_CHECK(wheel.GetTickDuration() == EXPECTED_DURATION);
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the duration of the ticks is zero.
+/// </summary>
+ZTEST_CASE ( Constructor2_AssertionFailsWhenTickDurationIsZero_Test )
+{
+    // [Preparation]
+    const TimeSpan ZERO_DURATION;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        TimerWheel wheel(ZERO_DURATION);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that every timer gets a different identifier, which is never zero.
+/// </summary>
+ZTEST_CASE ( AddTimer_ReturnsDifferentIdentifiersDifferentFromZero_Test )
+{
+    // [Preparation]
+    const TimerWheel::TimerId ZERO_ID = 0;
+    const TimeSpan DELAY(0, 0, 0, 0, 10, 0, 0);
+    TimerWheel wheel;
+
+    // [Execution]
+    TimerWheel::TimerId id1 = wheel.AddTimer(DELAY, Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    TimerWheel::TimerId id2 = wheel.AddTimer(DELAY, Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    
+    // [Verification]
+    BOOST_CHECK(id1 != ZERO_ID);
+    BOOST_CHECK(id2 != ZERO_ID);
+    BOOST_CHECK(id1 != id2);
+    BOOST_CHECK_EQUAL(wheel.GetPendingTimersCount(), 2U);
+}
+
+/// <summary>
+/// Checks that the identifier of a timer is not repeated when the internal storage of a released timer is reused.
+/// </summary>
+ZTEST_CASE ( AddTimer_IdentifiersAreNotRepeatedWhenTimersAreReused_Test )
+{
+    // [Preparation]
+    const TimeSpan DELAY(0, 0, 0, 0, 10, 0, 0);
+    TimerWheel wheel;
+    TimerWheel::TimerId cancelledId = wheel.AddTimer(DELAY, Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    wheel.CancelTimer(cancelledId);
+
+    // [Execution]
+    TimerWheel::TimerId newId = wheel.AddTimer(DELAY, Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    
+    // [Verification]
+    BOOST_CHECK(newId != cancelledId);
+    BOOST_CHECK(!wheel.CancelTimer(cancelledId));
+    BOOST_CHECK(wheel.CancelTimer(newId));
+}
+
+#if Z_CONFIG_ASSERTSBEHAVIOR_DEFAULT == Z_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the callback is null.
+/// </summary>
+ZTEST_CASE ( AddTimer_AssertionFailsWhenCallbackIsNull_Test )
+{
+    // [Preparation]
+    const TimeSpan DELAY(0, 0, 0, 0, 10, 0, 0);
+    const Delegate<void()> NULL_CALLBACK;
+    TimerWheel wheel;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        wheel.AddTimer(DELAY, NULL_CALLBACK);
+    }
+    catch(const AssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that a one-shot timer is called once, in the tick in which its delay passes.
+/// </summary>
+ZTEST_CASE ( Advance_OneShotTimerIsCalledOnceWhenDelayPasses_Test )
+{
+    // [Preparation]
+    const int EXPECTED_CALLS = 1;
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 5, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+
+    // [Execution]
+    wheel.Advance(4U);
+    int nCallsBeforeDelay = TimerWheelTestClass::sm_nCallsCountA;
+    wheel.Advance(1U);
+    int nCallsAfterDelay = TimerWheelTestClass::sm_nCallsCountA;
+    wheel.Advance(1000U);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(nCallsBeforeDelay, 0);
+    BOOST_CHECK_EQUAL(nCallsAfterDelay, EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(TimerWheelTestClass::sm_nCallsCountA, EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(wheel.GetPendingTimersCount(), 0U);
+}
+
+/// <summary>
+/// Checks that delays are rounded up to the next tick.
+/// </summary>
+ZTEST_CASE ( Advance_DelayIsRoundedUpToTicks_Test )
+{
+    // [Preparation]
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 1, 500, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+
+    // [Execution]
+    wheel.Advance(1U);
+    int nCallsAfterOneTick = TimerWheelTestClass::sm_nCallsCountA;
+    wheel.Advance(1U);
+    int nCallsAfterTwoTicks = TimerWheelTestClass::sm_nCallsCountA;
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(nCallsAfterOneTick, 0);
+    BOOST_CHECK_EQUAL(nCallsAfterTwoTicks, 1);
+}
+
+/// <summary>
+/// Checks that timers with a delay of zero are called in the next tick.
+/// </summary>
+ZTEST_CASE ( Advance_TimersWithZeroDelayAreCalledInNextTick_Test )
+{
+    // [Preparation]
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    wheel.AddTimer(TimeSpan(), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+
+    // [Execution]
+    puint_z uCallsCount = wheel.Advance(1U);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCallsCount, 1U);
+    BOOST_CHECK_EQUAL(TimerWheelTestClass::sm_nCallsCountA, 1);
+}
+
+/// <summary>
+/// Checks that periodic timers are called once per period until they are cancelled.
+/// </summary>
+ZTEST_CASE ( Advance_PeriodicTimerIsCalledEveryPeriod_Test )
+{
+    // [Preparation]
+    const int EXPECTED_CALLS = 3;
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    TimerWheel::TimerId timerId = wheel.AddPeriodicTimer(TimeSpan(0, 0, 0, 0, 3, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+
+    // [Execution]
+    wheel.Advance(10U);
+    wheel.CancelTimer(timerId);
+    wheel.Advance(10U);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(TimerWheelTestClass::sm_nCallsCountA, EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(wheel.GetPendingTimersCount(), 0U);
+}
+
+/// <summary>
+/// Checks that timers stored in every level of the wheel are called exactly in the tick in which they expire.
+/// </summary>
+ZTEST_CASE ( Advance_TimersOfAllLevelsAreCalledInTheTickTheyExpire_Test )
+{
+    // [Preparation]
+    const u64_z DELAYS[] = { 255U, 256U, 300U, 65535U, 65536U, 70000U, 16777216U, 16777300U };
+    const puint_z DELAYS_COUNT = sizeof(DELAYS) / sizeof(u64_z);
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel(TimeSpan(1ULL));
+    wheel.Advance(123U); // Timers do not start at the beginning of a turn
+    bool bAllCalledInTime = true;
+
+    // [Execution]
+    for(puint_z i = 0; i < DELAYS_COUNT; ++i)
+    {
+        TimerWheelTestClass::ResetCounters();
+        wheel.AddTimer(TimeSpan(DELAYS[i]), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+
+        wheel.Advance(DELAYS[i] - 1U);
+        bAllCalledInTime = bAllCalledInTime && TimerWheelTestClass::sm_nCallsCountA == 0;
+        wheel.Advance(1U);
+        bAllCalledInTime = bAllCalledInTime && TimerWheelTestClass::sm_nCallsCountA == 1;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAllCalledInTime);
+}
+
+/// <summary>
+/// Checks that timers are called in order of expiration, no matter the order in which they were added.
+/// </summary>
+ZTEST_CASE ( Advance_TimersAreCalledInOrderOfExpiration_Test )
+{
+    // [Preparation]
+    const string_z EXPECTED_ORDER("ABAB");
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 700, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackB));
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 600, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 5, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackB));
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 2, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+
+    // [Execution]
+    puint_z uCallsCount = wheel.Advance(1000U);
+    
+    // [Verification]
+    BOOST_CHECK(TimerWheelTestClass::sm_strCallsOrder == EXPECTED_ORDER);
+    BOOST_CHECK_EQUAL(uCallsCount, 4U);
+}
+
+/// <summary>
+/// Checks that the current tick is updated even when there are no timers.
+/// </summary>
+ZTEST_CASE ( Advance_CurrentTickIsUpdatedWhenThereAreNoTimers_Test )
+{
+    // [Preparation]
+    const u64_z EXPECTED_TICK = 12345U;
+    TimerWheel wheel;
+
+    // [Execution]
+    wheel.Advance(EXPECTED_TICK);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(wheel.GetCurrentTick(), EXPECTED_TICK);
+}
+
+/// <summary>
+/// Checks that timers can be added from the functions called when other timers expire.
+/// </summary>
+ZTEST_CASE ( Advance_CallbacksCanAddTimers_Test )
+{
+    // [Preparation]
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    TimerWheelTestClass::sm_pWheel = &wheel;
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 1, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackThatAddsTimer));
+
+    // [Execution]
+    wheel.Advance(1U);
+    int nCallsAfterFirstTick = TimerWheelTestClass::sm_nCallsCountA;
+    wheel.Advance(1U);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(nCallsAfterFirstTick, 0);
+    BOOST_CHECK_EQUAL(TimerWheelTestClass::sm_nCallsCountA, 1);
+}
+
+/// <summary>
+/// Checks that cancelled timers are not called.
+/// </summary>
+ZTEST_CASE ( CancelTimer_CancelledTimersAreNotCalled_Test )
+{
+    // [Preparation]
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    TimerWheel::TimerId timerId = wheel.AddTimer(TimeSpan(0, 0, 0, 0, 300, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 300, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackB));
+
+    // [Execution]
+    bool bCancelled = wheel.CancelTimer(timerId);
+    wheel.Advance(1000U);
+    
+    // [Verification]
+    BOOST_CHECK(bCancelled);
+    BOOST_CHECK_EQUAL(TimerWheelTestClass::sm_nCallsCountA, 0);
+    BOOST_CHECK_EQUAL(TimerWheelTestClass::sm_nCallsCountB, 1);
+}
+
+/// <summary>
+/// Checks that it returns False when the timer has already expired.
+/// </summary>
+ZTEST_CASE ( CancelTimer_ReturnsFalseWhenTimerHasExpired_Test )
+{
+    // [Preparation]
+    TimerWheel wheel;
+    TimerWheel::TimerId timerId = wheel.AddTimer(TimeSpan(0, 0, 0, 0, 1, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    wheel.Advance(1U);
+
+    // [Execution]
+    bool bCancelled = wheel.CancelTimer(timerId);
+    
+    // [Verification]
+    BOOST_CHECK(!bCancelled);
+}
+
+/// <summary>
+/// Checks that it returns False when the timer was already cancelled.
+/// </summary>
+ZTEST_CASE ( CancelTimer_ReturnsFalseWhenTimerWasAlreadyCancelled_Test )
+{
+    // [Preparation]
+    TimerWheel wheel;
+    TimerWheel::TimerId timerId = wheel.AddTimer(TimeSpan(0, 0, 0, 0, 1, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    wheel.CancelTimer(timerId);
+
+    // [Execution]
+    bool bCancelled = wheel.CancelTimer(timerId);
+    
+    // [Verification]
+    BOOST_CHECK(!bCancelled);
+    BOOST_CHECK_EQUAL(wheel.GetPendingTimersCount(), 0U);
+}
+
+/// <summary>
+/// Checks that it returns False when the identifier does not belong to any timer.
+/// </summary>
+ZTEST_CASE ( CancelTimer_ReturnsFalseWhenTimerDoesNotExist_Test )
+{
+    // [Preparation]
+    const TimerWheel::TimerId NONEXISTENT_IDS[] = { 0, 1, 0x0000000100000005ULL };
+    TimerWheel wheel;
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 1, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+
+    // [Execution]
+    bool bCancelled1 = wheel.CancelTimer(NONEXISTENT_IDS[0]);
+    bool bCancelled2 = wheel.CancelTimer(NONEXISTENT_IDS[1]);
+    bool bCancelled3 = wheel.CancelTimer(NONEXISTENT_IDS[2]);
+    
+    // [Verification]
+    BOOST_CHECK(!bCancelled1);
+    BOOST_CHECK(!bCancelled2);
+    BOOST_CHECK(!bCancelled3);
+    BOOST_CHECK_EQUAL(wheel.GetPendingTimersCount(), 1U);
+}
+
+/// <summary>
+/// Checks that the wheel moves forward as many ticks as have passed according to the clock.
+/// </summary>
+ZTEST_CASE ( Tick_WheelMovesForwardAccordingToClock_Test )
+{
+    // [Preparation]
+    const u64_z MINIMUM_TICK = 20U;
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 10, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 20, 0, 0));
+
+    // [Execution]
+    puint_z uCallsCount = wheel.Tick();
+    
+    // [Verification]
+    BOOST_CHECK(wheel.GetCurrentTick() >= MINIMUM_TICK);
+    BOOST_CHECK_EQUAL(uCallsCount, 1U);
+    BOOST_CHECK_EQUAL(TimerWheelTestClass::sm_nCallsCountA, 1);
+}
+
+/// <summary>
+/// Checks that timers are called by the dedicated thread while it is running.
+/// </summary>
+ZTEST_CASE ( Start_TimersAreCalledByDedicatedThread_Test )
+{
+    // [Preparation]
+    TimerWheelTestClass::ResetCounters();
+    TimerWheel wheel;
+    wheel.AddTimer(TimeSpan(0, 0, 0, 0, 5, 0, 0), Delegate<void()>(&TimerWheelTestClass::CallbackA));
+
+    // [Execution]
+    wheel.Start();
+    bool bIsRunning = wheel.IsRunning();
+    SThisThread::Sleep(TimeSpan(0, 0, 0, 0, 100, 0, 0));
+    wheel.Stop();
+    
+    // [Verification]
+    BOOST_CHECK(bIsRunning);
+    BOOST_CHECK(!wheel.IsRunning());
+    BOOST_CHECK_EQUAL(TimerWheelTestClass::sm_nCallsCountA, 1);
+}
+
+/// <summary>
+/// Checks that nothing happens when the dedicated thread is not running.
+/// </summary>
+ZTEST_CASE ( Stop_NothingHappensWhenThreadIsNotRunning_Test )
+{
+    // [Preparation]
+    TimerWheel wheel;
+
+    // [Execution]
+    wheel.Stop();
+    
+    // [Verification]
+    BOOST_CHECK(!wheel.IsRunning());
+}
+
+// End - Test Suite: TimerWheel
+ZTEST_SUITE_END()